@@ -12236,6 +12236,7 @@ def main(argv: list[str] | None = None) -> int:
                             non_diffpair_strategy=_phase2_strategy,
                             coupled_only=(args.strategy == "negotiated"),
                             timeout=_budgeted_timeout(args),
+                            verbose=args.verbose and not quiet,
                         )
                         diffpair_warnings.extend(dp_warnings)
                         # Issue #4095: surface any coupled pairs that
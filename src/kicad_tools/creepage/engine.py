@@ -944,6 +944,167 @@ def surface_path_length(
 # Census assembly
 # ---------------------------------------------------------------------------
 
+# (hv_number, other_number) -> (clearance, creepage, binding layer, relationship)
+_PairMeasures = dict[tuple[int, int], tuple[float, float, str, str]]
+# hv_number -> (clearance, creepage) to the board edge
+_EdgeMeasures = dict[int, tuple[float, float]]
+
+
+def _skip_pair(hv_num: int, other_num: int, hv_nets: dict[int, str], map_mode: bool) -> bool:
+    """The census pairing rule shared by the shapely and native paths.
+
+    In single-voltage mode HV-vs-HV pairs are skipped (an HV net has no
+    meaningful requirement against another net in its own group).  In per-net
+    voltage mode (#4371) that skip is relaxed so same-class nets at different
+    potentials (bank-vs-bank, phase-vs-phase) ARE evaluated; such pairs are
+    deduplicated to a single canonical direction (smaller net number first).
+    """
+    if other_num == 0 or other_num == hv_num:
+        return True
+    if other_num in hv_nets:
+        return not map_mode or other_num < hv_num
+    return False
+
+
+def _census_measures(
+    pcb: PCB, hv_nets: dict[int, str], obstacles: list[Any], map_mode: bool
+) -> tuple[_PairMeasures, _EdgeMeasures]:
+    """Measure every census pair with shapely, one surface path at a time."""
+    # Footprint-membership index (#4403): recovers the pad->footprint identity
+    # the per-net union erases, so each binding pair can be classified as a
+    # board-fixable approach or a component-internal (same-footprint) gap.
+    fp_index = _FootprintPadIndex(pcb)
+
+    # Per-layer per-net copper unions.
+    layer_unions: dict[str, dict[int, Any]] = {}
+    for layer in pcb.copper_layers:
+        layer_unions[layer.name] = _net_union_on_layer(pcb, layer.name)
+
+    # --- HV-vs-other-conductor pairs (binding layer = smallest creepage) ---
+    binding: dict[tuple[int, int], tuple[float, float, str]] = {}
+    for layer_name, unions in layer_unions.items():
+        for hv_num in hv_nets:
+            hv_geom = unions.get(hv_num)
+            if hv_geom is None:
+                continue
+            for other_num, other_geom in unions.items():
+                if _skip_pair(hv_num, other_num, hv_nets, map_mode):
+                    continue
+                clearance, creepage = surface_path_length(hv_geom, other_geom, obstacles)
+                key = (hv_num, other_num)
+                prev = binding.get(key)
+                if prev is None or creepage < prev[1]:
+                    binding[key] = (clearance, creepage, layer_name)
+    best: _PairMeasures = {
+        (hv_num, other_num): (
+            clearance,
+            creepage,
+            layer_name,
+            fp_index.relationship(layer_name, hv_num, other_num, clearance),
+        )
+        for (hv_num, other_num), (clearance, creepage, layer_name) in binding.items()
+    }
+
+    # --- HV-vs-board-edge pairs (copper union across all layers) ---
+    edges: _EdgeMeasures = {}
+    edge_geom = board_edge_geometry(pcb)
+    if edge_geom is not None and not edge_geom.is_empty:
+        from shapely.ops import unary_union
+
+        for hv_num in hv_nets:
+            parts = [unions[hv_num] for unions in layer_unions.values() if hv_num in unions]
+            if not parts:
+                continue
+            hv_all = unary_union(parts)
+            edges[hv_num] = surface_path_length(hv_all, edge_geom, obstacles)
+    return best, edges
+
+
+def _census_measures_cpp(
+    pcb: PCB, hv_nets: dict[int, str], obstacles: list[Any], map_mode: bool
+) -> tuple[_PairMeasures, _EdgeMeasures] | None:
+    """Measure every census pair with ``drc_cpp.creepage_matrix``.
+
+    The slot-corner visibility graph is built once and each HV net's row of
+    the matrix is one parallel shortest-path search, instead of a shapely
+    nearest-points walk and visibility graph per pair and layer.  Copper is
+    measured shape by shape rather than as per-net unions, and a path may
+    leave a conductor anywhere, so a slotted pair's creepage is the true
+    shortest surface path: never below the clearance, never above what the
+    nearest-points detour reports.  Returns ``None`` when the C++ backend
+    is not built.
+    """
+    from kicad_tools.drc.cpp_backend import (
+        CHECK_ZONE,
+        CopperBoardItems,
+        creepage_matrix_cpp,
+        drc_cpp,
+        is_creepage_available,
+    )
+
+    if not is_creepage_available():
+        return None
+    items = CopperBoardItems(pcb, CHECK_ZONE)
+    edge_segments = [(a, b) for a, b in _edge_line_segments(pcb) if math.dist(a, b) > _EPS]
+    slot_rings = [list(obs.exterior.coords)[:-1] for obs in obstacles]
+    sources = list(hv_nets)
+    matrix = creepage_matrix_cpp(
+        items, sources, edge_segments, slot_rings, interior_shrink=_INTERIOR_SHRINK
+    )
+
+    # Same-footprint attribution (#4403) on the exact pad shapes the matrix
+    # measured, so the binding-gap equality test compares like with like.
+    # (layer, net) -> footprint reference -> pad shapes
+    footprint_pads: dict[tuple[int, int], dict[str, list[Any]]] = {}
+    board = items.board
+    for (fp, pad), shape, mask in zip(items.pads, board.pads, board.pad_layers, strict=True):
+        if not fp.reference:
+            continue
+        for layer in range(len(items.layers)):
+            if mask >> layer & 1:
+                footprint_pads.setdefault((layer, pad.net_number), {}).setdefault(
+                    fp.reference, []
+                ).append(shape)
+
+    def _relationship(layer: int, net_a: int, net_b: int, clearance_mm: float) -> str:
+        pads_a = footprint_pads.get((layer, net_a), {})
+        pads_b = footprint_pads.get((layer, net_b), {})
+        for ref in pads_a.keys() & pads_b.keys():
+            min_dist = min(
+                max(drc_cpp.pad_shape_clearance(pa, pb).clearance, 0.0)
+                for pa in pads_a[ref]
+                for pb in pads_b[ref]
+            )
+            if abs(min_dist - clearance_mm) <= _PASS_TOLERANCE:
+                return "same_footprint"
+        return "board"
+
+    # Overlapping copper reports its penetration depth natively; the census
+    # reports touching conductors as a zero gap, as shapely's distance does.
+    nets = list(matrix.nets)
+    creepage, clearance, layers = matrix.creepage, matrix.clearance, matrix.layer
+    best: _PairMeasures = {}
+    edges: _EdgeMeasures = {}
+    for row, hv_num in enumerate(sources):
+        base = row * len(nets)
+        for col, other_num in enumerate(nets):
+            layer = layers[base + col]
+            if layer < 0 or _skip_pair(hv_num, other_num, hv_nets, map_mode):
+                continue
+            gap = max(clearance[base + col], 0.0)
+            best[(hv_num, other_num)] = (
+                gap,
+                max(creepage[base + col], 0.0),
+                items.layers[layer],
+                _relationship(layer, hv_num, other_num, gap),
+            )
+        if math.isfinite(matrix.edge_creepage[row]):
+            edges[hv_num] = (
+                max(matrix.edge_clearance[row], 0.0),
+                max(matrix.edge_creepage[row], 0.0),
+            )
+    return best, edges
+
 
 def compute_creepage_census(
     pcb: PCB,
@@ -1134,50 +1295,14 @@ def compute_creepage_census(
 
     number_to_name = {net.number: net.name for net in pcb.nets.values()}
     obstacles = board_slot_obstacles(pcb)
+    measures = _census_measures_cpp(pcb, hv_nets, obstacles, map_mode)
+    if measures is None:
+        measures = _census_measures(pcb, hv_nets, obstacles, map_mode)
+    best, edges = measures
 
-    # Per-layer per-net copper unions.
-    layer_unions: dict[str, dict[int, Any]] = {}
-    for layer in pcb.copper_layers:
-        layer_unions[layer.name] = _net_union_on_layer(pcb, layer.name)
-
-    # Footprint-membership index (#4403): recovers the pad->footprint identity
-    # the per-net union erases, so each binding pair can be classified as a
-    # board-fixable approach or a component-internal (same-footprint) gap.
-    fp_index = _FootprintPadIndex(pcb)
-
-    # --- HV-vs-other-conductor pairs (binding layer = smallest creepage) ---
-    # (hv_number, other_number) -> (clearance, creepage, layer)
-    #
-    # In single-voltage mode HV-vs-HV pairs are skipped (an HV net has no
-    # meaningful requirement against another net in its own group).  In per-net
-    # voltage mode (#4371) that skip is relaxed so same-class nets at different
-    # potentials (bank-vs-bank, phase-vs-phase) ARE evaluated; such pairs are
-    # deduplicated to a single canonical direction (smaller net number first).
-    best: dict[tuple[int, int], tuple[float, float, str]] = {}
-    for layer_name, unions in layer_unions.items():
-        for hv_num in hv_nets:
-            hv_geom = unions.get(hv_num)
-            if hv_geom is None:
-                continue
-            for other_num, other_geom in unions.items():
-                if other_num == 0 or other_num == hv_num:
-                    continue
-                if other_num in hv_nets:
-                    if not map_mode:
-                        continue
-                    # Canonical dedup: evaluate each HV-HV pair once.
-                    if other_num < hv_num:
-                        continue
-                clearance, creepage = surface_path_length(hv_geom, other_geom, obstacles)
-                key = (hv_num, other_num)
-                prev = best.get(key)
-                if prev is None or creepage < prev[1]:
-                    best[key] = (clearance, creepage, layer_name)
-
-    for (hv_num, other_num), (clearance, creepage, layer_name) in best.items():
+    for (hv_num, other_num), (clearance, creepage, layer_name, relationship) in best.items():
         net_a_name = hv_nets[hv_num]
         net_b_name = number_to_name.get(other_num, f"net{other_num}")
-        relationship = fp_index.relationship(layer_name, hv_num, other_num, clearance)
         if map_mode:
             req_creep, req_clear, prov = _pair_requirement(net_a_name, net_b_name)
             report.pairs.append(
@@ -1207,43 +1332,34 @@ def compute_creepage_census(
                 )
             )
 
-    # --- HV-vs-board-edge pairs (copper union across all layers) ---
-    edge_geom = board_edge_geometry(pcb)
-    if edge_geom is not None and not edge_geom.is_empty:
-        from shapely.ops import unary_union
-
-        for hv_num in hv_nets:
-            parts = [unions[hv_num] for unions in layer_unions.values() if hv_num in unions]
-            if not parts:
-                continue
-            hv_all = unary_union(parts)
-            clearance, creepage = surface_path_length(hv_all, edge_geom, obstacles)
-            if map_mode:
-                req_creep, req_clear, prov = _pair_requirement(hv_nets[hv_num], None, edge=True)
-                report.pairs.append(
-                    _make_pair(
-                        req_creep=req_creep,
-                        req_clear=req_clear,
-                        prov=prov,
-                        net_a=hv_nets[hv_num],
-                        net_b=BOARD_EDGE_LABEL,
-                        kind="edge",
-                        layer="*",
-                        clearance_mm=clearance,
-                        creepage_mm=creepage,
-                    )
+    # --- HV-vs-board-edge pairs ---
+    for hv_num, (clearance, creepage) in edges.items():
+        if map_mode:
+            req_creep, req_clear, prov = _pair_requirement(hv_nets[hv_num], None, edge=True)
+            report.pairs.append(
+                _make_pair(
+                    req_creep=req_creep,
+                    req_clear=req_clear,
+                    prov=prov,
+                    net_a=hv_nets[hv_num],
+                    net_b=BOARD_EDGE_LABEL,
+                    kind="edge",
+                    layer="*",
+                    clearance_mm=clearance,
+                    creepage_mm=creepage,
                 )
-            else:
-                report.pairs.append(
-                    _make_pair(
-                        net_a=hv_nets[hv_num],
-                        net_b=BOARD_EDGE_LABEL,
-                        kind="edge",
-                        layer="*",
-                        clearance_mm=clearance,
-                        creepage_mm=creepage,
-                    )
+            )
+        else:
+            report.pairs.append(
+                _make_pair(
+                    net_a=hv_nets[hv_num],
+                    net_b=BOARD_EDGE_LABEL,
+                    kind="edge",
+                    layer="*",
+                    clearance_mm=clearance,
+                    creepage_mm=creepage,
                 )
+            )
 
     # Deterministic ordering: by net A, then edge last, then net B.
     report.pairs.sort(key=lambda p: (p.net_a, p.kind == "edge", p.net_b))
@@ -0,0 +1,173 @@
+"""Incremental copper connectivity and different-net short tracking.
+
+``ConnectivityTracker`` wraps the native ``drc_cpp.CopperConnectivity``: all
+board copper (tracks, vias, pads and zone fills) sits in a per-layer spatial
+index with a union-find over touching same-net copper.  Routes are committed
+as they are produced and only the new copper is tested, so after every route
+the router can ask which shorts it made, which pads are still stranded from
+their net and which copper reaches no pad at all.
+
+Example:
+    >>> from kicad_tools.drc.copper_connectivity import ConnectivityTracker
+    >>> tracker = ConnectivityTracker(pcb)
+    >>> for short in tracker.commit(segments=new_segments, vias=new_vias):
+    ...     print(short.describe())
+    >>> tracker.pads_connected(net_number)
+    (3, 4)
+
+Requires the C++ backend (``is_connectivity_available()``); the pairwise
+Python walks in :mod:`kicad_tools.drc.different_net_short` and
+:mod:`kicad_tools.router.connectivity` remain the fallback.
+"""
+
+from __future__ import annotations
+
+from collections.abc import Iterable
+from typing import TYPE_CHECKING
+
+from kicad_tools.drc.cpp_backend import (
+    CHECK_ZONE,
+    COPPER_PAD,
+    COPPER_SEGMENT,
+    COPPER_VIA,
+    COPPER_ZONE,
+    CopperBoardItems,
+    create_copper_connectivity_cpp,
+    is_connectivity_available,
+)
+from kicad_tools.drc.different_net_short import ShortItem
+
+if TYPE_CHECKING:
+    from kicad_tools.schema.pcb import PCB, Footprint, Pad, Segment, Via
+
+_KIND = {COPPER_SEGMENT: "segment", COPPER_PAD: "pad", COPPER_VIA: "via", COPPER_ZONE: "zone"}
+# ShortItem kinds name the via first ("via-segment"), as the Python verifier.
+_KIND_RANK = {COPPER_VIA: 0, COPPER_SEGMENT: 1, COPPER_PAD: 2, COPPER_ZONE: 3}
+
+
+class ConnectivityTracker:
+    """Board copper connectivity kept current as routes are committed.
+
+    Net identity follows :func:`~kicad_tools.drc.different_net_short._net_identity`:
+    the numeric net id, or for KiCad-10 name-only copper the id of the
+    board net with that name (a private id when the board has none).
+    Unnetted copper never joins or shorts anything.
+
+    Args:
+        pcb: Board whose existing copper seeds the tracker (not mutated).
+        short_clearance: Different-net copper closer than this is a short;
+            ``0.0`` flags overlapping copper only.
+        tolerance: Same-net copper closer than this is joined (mm).
+        include_zones: Join through committed zone fills.
+    """
+
+    def __init__(
+        self,
+        pcb: PCB,
+        *,
+        short_clearance: float = 0.0,
+        tolerance: float = 1e-4,
+        include_zones: bool = True,
+    ):
+        if not is_connectivity_available():
+            raise RuntimeError("C++ DRC connectivity engine not available")
+
+        self._net_by_name = {net.name: net.number for net in pcb.nets.values() if net.name}
+        self._names = {net.number: net.name for net in pcb.nets.values()}
+
+        self.items = CopperBoardItems(pcb, CHECK_ZONE if include_zones else 0)
+        board = self.items.board
+        board.seg_net = [self._net(s.net_number, s.net_name) for s in self.items.segments]
+        board.via_net = [self._net(v.net_number, v.net_name) for v in self.items.vias]
+        board.pad_net = [self._net(p.net_number, p.net_name) for _, p in self.items.pads]
+        self._engine = create_copper_connectivity_cpp(
+            self.items, short_clearance=short_clearance, tolerance=tolerance
+        )
+
+    def _net(self, number: int, name: str) -> int:
+        if number != 0 or not name:
+            return number
+        if name not in self._net_by_name:
+            # Name-only net the board never declared: a private negative id.
+            self._net_by_name[name] = -1 - len(self._names)
+            self._names[self._net_by_name[name]] = name
+        return self._net_by_name[name]
+
+    def commit(self, segments: Iterable[Segment] = (), vias: Iterable[Via] = ()) -> list[ShortItem]:
+        """Add a route's copper and return the shorts it makes.
+
+        Segments on layers the board does not have are ignored.
+        """
+        first_seg, first_via = len(self.items.segments), len(self.items.vias)
+        route = self.items.route_board(segments, vias)
+        route.seg_net = [
+            self._net(s.net_number, s.net_name) for s in self.items.segments[first_seg:]
+        ]
+        route.via_net = [self._net(v.net_number, v.net_name) for v in self.items.vias[first_via:]]
+        return [self._short_item(s) for s in self._engine.commit(route)]
+
+    def remove_net(self, net_number: int) -> None:
+        """Rip up every track and via of a net (pads and fills stay)."""
+        self._engine.remove_net(net_number)
+
+    def shorts(self) -> list[ShortItem]:
+        """Every different-net short on the board, in item order."""
+        return [self._short_item(s) for s in self._engine.shorts()]
+
+    def stranded_pads(self) -> list[tuple[Footprint, Pad]]:
+        """Pads cut off from the copper holding most of their net's pads."""
+        return [self.items.pads[i] for i in self._engine.report().stranded_pads]
+
+    def incomplete_nets(self) -> list[int]:
+        """Nets whose pads are not all joined by copper, ascending."""
+        return list(self._engine.report().incomplete_nets)
+
+    def islands(self) -> list[Segment | Via | tuple[int, str]]:
+        """Tracks, vias and zone fills (``(net, name)``) that reach no pad."""
+        report = self._engine.report()
+        return [
+            self._item(t, i) for t, i in zip(report.island_type, report.island_index, strict=True)
+        ]
+
+    def pads_connected(self, net_number: int) -> tuple[int, int]:
+        """``(pads on the net's largest pad component, pads on the net)``."""
+        return tuple(self._engine.pads_connected(net_number))
+
+    def _item(self, item_type: int, index: int):
+        if item_type == COPPER_SEGMENT:
+            return self.items.segments[index]
+        if item_type == COPPER_VIA:
+            return self.items.vias[index]
+        if item_type == COPPER_PAD:
+            return self.items.pads[index]
+        return self.items.zones[index]
+
+    def _net_name(self, item_type: int, index: int) -> str:
+        if item_type == COPPER_ZONE:
+            net, name = self.items.zones[index]
+        else:
+            item = self._item(item_type, index)
+            if item_type == COPPER_PAD:
+                item = item[1]
+            net, name = self._net(item.net_number, item.net_name), item.net_name
+        return name or self._names.get(net) or str(net)
+
+    def _short_item(self, short) -> ShortItem:
+        a = (short.type1, short.index1)
+        b = (short.type2, short.index2)
+        if _KIND_RANK[b[0]] < _KIND_RANK[a[0]]:
+            a, b = b, a
+        return ShortItem(
+            kind=f"{_KIND[a[0]]}-{_KIND[b[0]]}",
+            net_a_name=self._net_name(*a),
+            net_b_name=self._net_name(*b),
+            layer=self.items.layers[short.layer],
+            x=short.location_x,
+            y=short.location_y,
+            gap=short.clearance,
+            via_a=self._item(*a) if a[0] == COPPER_VIA else None,
+            via_b=self._item(*b) if b[0] == COPPER_VIA else None,
+        )
+
+
+__all__ = ["ConnectivityTracker"]
@@ -0,0 +1,82 @@
+/*
+ * DRC Clearance C++ Core - whole-board pad clearance sweep
+ * Part of kicad-tools DRC performance optimization (Phase 4)
+ *
+ * check_pair_clearance() takes one footprint pair per call, so a full-board
+ * check pays one Python round trip (and one pad-array marshal per side) for
+ * every candidate pair.  check_board_clearance() takes every pad on the
+ * board at once, transforms them once, and runs a uniform-grid broadphase:
+ *
+ *   1. footprint boxes (pad rectangles, grown by min_clearance) decide which
+ *      footprint pairs are candidates -- the same filter the Python
+ *      IncrementalDRC applies through its R-tree;
+ *   2. pads are binned by their bounding circle; each pad only meets pads
+ *      of other footprints whose circles could come within min_clearance;
+ *   3. per candidate footprint pair the minimum pad-pair clearance is kept
+ *      and reported when it is below min_clearance - epsilon.
+ *
+ * Pads whose clearance is at or above the threshold can never be the
+ * minimum of a violating pair, so the reported clearance, pad indices and
+ * location are identical to check_pair_clearance() on the same pair.
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace drc {
+
+/// Every pad on the board, struct-of-arrays, grouped by footprint.
+///
+/// Pads of footprint ``f`` are ``footprint_offsets[f] ..
+/// footprint_offsets[f + 1] - 1``; ``footprint_offsets`` has one entry per
+/// footprint plus a final end offset.
+struct BoardPads {
+    std::vector<float> local_x;
+    std::vector<float> local_y;
+    std::vector<float> width;    // unrotated pad size
+    std::vector<float> height;
+    std::vector<int> net;
+    std::vector<int> footprint_offsets;
+};
+
+/// Board placement of each footprint (rotation already in the CCW
+/// convention the kernels apply -- the caller negates KiCad's angle).
+struct FootprintTransforms {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> rotation_rad;
+};
+
+struct BoardClearanceRules {
+    float min_clearance = 0.0f;
+    float epsilon = 1e-4f;   // violations are clearance < min - epsilon
+    int num_threads = 0;     // 0 = hardware concurrency
+};
+
+/// Worst pad pair of one violating footprint pair (``footprint1 <
+/// footprint2``; pad indices are local to each footprint).
+struct BoardClearanceViolation {
+    int footprint1 = -1;
+    int footprint2 = -1;
+    int pad1_index = -1;
+    int pad2_index = -1;
+    float min_clearance = 0.0f;
+    float location_x = 0.0f;
+    float location_y = 0.0f;
+};
+
+/// Whole-board pad-to-pad clearance check.
+///
+/// @param pads        Every pad, grouped by footprint
+/// @param transforms  One placement per footprint
+/// @param rules       Clearance threshold and thread count
+/// @return Violating footprint pairs, sorted by (footprint1, footprint2)
+/// @throws std::invalid_argument when the arrays disagree in length
+std::vector<BoardClearanceViolation> check_board_clearance(
+    const BoardPads& pads,
+    const FootprintTransforms& transforms,
+    const BoardClearanceRules& rules
+);
+
+} // namespace drc
@@ -0,0 +1,140 @@
+/*
+ * DRC Clearance C++ Core - copper connectivity and different-net shorts
+ *
+ * router/connectivity.py walked per-pad reachability with all-pairs
+ * Python adjacency tests, and drc/different_net_short.py tested every
+ * via and segment pair for different-net overlaps, both as whole-board
+ * passes after every route.  CopperConnectivity keeps all board copper
+ * (a CopperBoard: segments, vias, pads, zone fills) in a hashed per-layer
+ * grid with a union-find over touching copper.  Two items on a shared
+ * layer are
+ *
+ *   joined  when they carry the same non-zero net and their clearance is
+ *           below ``tolerance``
+ *   a short when their nets differ, neither is net 0, and their clearance
+ *           is below ``short_clearance - tolerance``
+ *
+ * Clearances are exact (pad_shape_clearance(): tracks are stadiums, vias
+ * discs, fills polygons).  commit() appends a route's copper and tests
+ * only the new items against their neighbours; remove_net() rips up a
+ * net's tracks and vias and replays the joins that remain.
+ */
+
+#pragma once
+
+#include "copper_drc.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace drc {
+
+struct ConnectivityRules {
+    double tolerance = 1e-4;
+    double short_clearance = 0.0;  // 0: only overlapping copper is a short
+};
+
+/// One different-net pair.  ``layer`` is the lowest layer both items are
+/// on; ``type1/index1`` sorts before ``type2/index2``.
+struct CopperShort {
+    int layer = -1;
+    int type1 = -1;
+    int index1 = -1;
+    int type2 = -1;
+    int index2 = -1;
+    double clearance = 0.0;
+    double location_x = 0.0;
+    double location_y = 0.0;
+};
+
+struct ConnectivityReport {
+    /// Every short, sorted by (type1, index1, type2, index2)
+    std::vector<CopperShort> shorts;
+    /// Pads off the component holding most of their net's pads, ascending
+    std::vector<int> stranded_pads;
+    /// Nets whose pads span more than one component, ascending
+    std::vector<int> incomplete_nets;
+    /// Tracks, vias and fills that reach no pad, by (type, index)
+    std::vector<int> island_type;
+    std::vector<int> island_index;
+};
+
+class CopperConnectivity {
+public:
+    /// Index the board and join its copper.
+    /// @throws std::invalid_argument as check_copper_drc()
+    CopperConnectivity(CopperBoard board, ConnectivityRules rules);
+
+    /// Append a route's segments, vias and zone fills (board indices
+    /// continue after the current ones) and join them.
+    /// @return The shorts the new copper makes, sorted as shorts()
+    /// @throws std::invalid_argument for pads or a different layer count
+    std::vector<CopperShort> commit(const CopperBoard& route);
+
+    /// Remove every segment and via of ``net``.  Their indices stay
+    /// reserved; component() reports -1 for them.
+    void remove_net(int net);
+
+    std::vector<CopperShort> shorts() const;
+    ConnectivityReport report() const;
+
+    /// Component id of an item (stable until the next commit() or
+    /// remove_net()); -1 for removed items and net-0 copper.
+    /// @throws std::out_of_range for an unknown item
+    int component(int type, int index) const;
+
+    /// (pads on the net's largest pad component, pads on the net); a net
+    /// with fewer than two pads counts as connected.
+    std::pair<int, int> pads_connected(int net) const;
+
+    const CopperBoard& board() const { return board_; }
+
+private:
+    struct Item {
+        int type;
+        int index;
+        int net;
+        uint64_t layers;
+        double min_x, min_y, max_x, max_y;
+        bool alive;
+    };
+
+    struct Short {
+        int a, b;  // item ids
+        CopperShort info;
+    };
+
+    void add_items(size_t first_seg, size_t first_via, size_t first_pad, size_t first_zone);
+    void add(int type, int index, int net, uint64_t layers, PadShape shape);
+    void link(size_t first_new, std::vector<CopperShort>* found);
+    void grid_insert(int id);
+    void grid_erase(int id);
+    bool in_big_list(const Item& item) const;
+    uint64_t cell_key(int layer, int col, int row) const;
+    int find(int id) const;
+    void unite(int a, int b);
+    CopperShort make_short(int a, int b, double clearance, double x, double y) const;
+
+    CopperBoard board_;
+    ConnectivityRules rules_;
+    double reach_ = 0.0;
+    double cell_ = 1.0;
+
+    std::vector<Item> items_;
+    std::vector<PadShape> shapes_;
+    std::vector<int> ids_[4];  // item id per (type, index)
+
+    std::unordered_map<uint64_t, std::vector<int>> cells_;
+    std::vector<std::vector<int>> big_;  // per layer: items spanning too many cells
+    std::vector<int> seen_;               // last item whose link() visited each item
+
+    mutable std::vector<int> parent_;
+    std::vector<int> size_;
+    std::vector<std::pair<int, int>> joins_;
+    std::vector<Short> shorts_;
+    std::unordered_map<int, std::vector<int>> net_pads_;
+};
+
+} // namespace drc
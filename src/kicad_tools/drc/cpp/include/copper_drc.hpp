@@ -0,0 +1,122 @@
+/*
+ * DRC Clearance C++ Core - unified copper DRC engine
+ *
+ * Segment, via, pad and zone-fill clearance ran in Python
+ * (validate/rules/clearance.py, validate/rules/dimensions.py), one pair at
+ * a time.  check_copper_drc() loads all board copper once and runs every
+ * clearance class natively:
+ *
+ *   CHECK_CLEARANCE       segment/via/pad pairs of different nets, with
+ *                         ClearanceRule's skips and geometry: router
+ *                         segment kernels for segments, AABB rectangles for
+ *                         segment-to-pad, exact pad_shape_clearance() for
+ *                         pad/via pairs
+ *   CHECK_ZONE            segment/via/pad against foreign zone fills
+ *   CHECK_HOLE_TO_HOLE    drill edge to drill edge, any nets
+ *   CHECK_HOLE_TO_COPPER  drill edge to foreign tracks on spanned layers
+ *
+ * Each copper layer (plus one pseudo-layer for drills) gets its own
+ * uniform-grid index; work is split into chunks of spatially sorted
+ * entries across all layers and run on a thread pool.
+ */
+
+#pragma once
+
+#include "pad_shape.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace drc {
+
+/// Item kinds, in ClearanceRule's collection order (segments, pads, vias)
+/// so violations sort the way the Python rule emits them.
+enum CopperItemType : int {
+    COPPER_SEGMENT = 0,
+    COPPER_PAD = 1,
+    COPPER_VIA = 2,
+    COPPER_ZONE = 3,
+};
+
+enum CopperCheck : int {
+    CHECK_CLEARANCE = 1,
+    CHECK_ZONE = 2,
+    CHECK_HOLE_TO_HOLE = 4,
+    CHECK_HOLE_TO_COPPER = 8,
+    CHECK_ALL = 15,
+};
+
+/// All copper on the board, struct-of-arrays, in board coordinates.
+///
+/// Layers are indices into the caller's copper layer list (at most 64);
+/// vias and pads carry a bitmask of the layers their copper is on.
+struct CopperBoard {
+    int num_layers = 0;
+
+    std::vector<double> seg_x1, seg_y1, seg_x2, seg_y2, seg_width;
+    std::vector<int> seg_layer;
+    std::vector<int> seg_net;
+
+    std::vector<double> via_x, via_y, via_size, via_drill;
+    std::vector<uint64_t> via_layers;           // every layer the barrel spans
+    std::vector<uint64_t> via_explicit_layers;  // declared endpoint layers
+    std::vector<int> via_net;
+
+    std::vector<PadShape> pads;
+    std::vector<uint64_t> pad_layers;
+    std::vector<double> pad_drill;  // 0 for SMD pads
+    std::vector<int> pad_net;
+
+    // Zone fill k is zone_x/zone_y[zone_offsets[k] .. zone_offsets[k + 1]).
+    std::vector<int> zone_offsets;
+    std::vector<double> zone_x, zone_y;
+    std::vector<int> zone_layer;
+    std::vector<int> zone_net;
+};
+
+struct CopperRules {
+    double min_clearance = 0.0;
+    double min_hole_to_hole = 0.0;
+    double min_hole_to_copper = 0.0;
+    double tolerance = 1e-4;           // violations are actual + tolerance < required
+    double colocation_epsilon = 1e-4;  // segment end on a via centre is the via (#2706)
+    std::vector<int> exempt_net_pairs; // flattened (a, b): segment pairs left to the diff-pair rule
+    int checks = CHECK_ALL;
+    int num_threads = 0;               // 0 = hardware concurrency
+};
+
+/// One violating pair.  ``layer`` is -1 for hole-to-hole; ``type1/index1``
+/// sorts before ``type2/index2``.  Hole checks name the via or pad that
+/// owns the drill.
+struct CopperViolation {
+    int check = 0;
+    int layer = -1;
+    int type1 = -1;
+    int index1 = -1;
+    int type2 = -1;
+    int index2 = -1;
+    double actual = 0.0;
+    double required = 0.0;
+    double location_x = 0.0;
+    double location_y = 0.0;
+};
+
+/// Check a CopperBoard's array lengths, zone offsets and layer indices.
+/// @throws std::invalid_argument prefixed with ``caller``
+void validate_copper_board(const CopperBoard& board, const char* caller);
+
+/// One item's copper as a PadShape: tracks are stadiums, vias discs and
+/// zone fills (``type`` COPPER_ZONE) polygons in board coordinates.
+/// The board must have passed validate_copper_board().
+PadShape copper_item_shape(const CopperBoard& board, int type, size_t index);
+
+/// Run the requested clearance classes over the whole board.
+///
+/// @param board  All copper
+/// @param rules  Thresholds, enabled checks and thread count
+/// @return Violations sorted by (check, layer, type1, index1, type2, index2)
+/// @throws std::invalid_argument when arrays disagree in length or a layer
+///         index is out of range
+std::vector<CopperViolation> check_copper_drc(const CopperBoard& board, const CopperRules& rules);
+
+} // namespace drc
@@ -0,0 +1,74 @@
+/*
+ * DRC Clearance C++ Core - creepage (surface path) census
+ *
+ * creepage/engine.py measured each HV-net / conductor pair with shapely:
+ * the straight nearest-points gap, and when that line crossed a milled
+ * Edge.Cuts slot, a visibility graph over the slot corners rebuilt and
+ * searched for every pair on every layer.  creepage_matrix() builds the
+ * slot visibility graph once and answers every (source net, net) pair in
+ * one call:
+ *
+ *   - every net's copper (a CopperBoard) is attached to the slot corners
+ *     it can see, per layer
+ *   - one multi-source shortest-path search per source net and layer,
+ *     run in parallel over the source nets
+ *   - creepage(A, B) is the shorter of the best unobstructed straight gap
+ *     between A's and B's copper and the best path over slot corners
+ *
+ * Copper is measured with pad_shape_clearance() (tracks as stadiums, vias
+ * as discs, fills as polygons).  A path is blocked only when it passes
+ * through a slot's interior; running along a slot wall is allowed.  The
+ * board edge (outline and slot linework) is one more conductor on every
+ * layer.
+ */
+
+#pragma once
+
+#include "copper_drc.hpp"
+
+#include <vector>
+
+namespace drc {
+
+/// Edge.Cuts geometry: the linework the board edge distance is taken to,
+/// and the slot/cutout rings that lengthen surface paths.
+struct CreepageOutline {
+    std::vector<double> edge_x1, edge_y1, edge_x2, edge_y2;
+    // Slot ring k is slot_x/slot_y[slot_offsets[k] .. slot_offsets[k + 1]).
+    std::vector<int> slot_offsets;
+    std::vector<double> slot_x, slot_y;
+};
+
+struct CreepageRules {
+    double interior_shrink = 1e-6;  // a path must go this deep into a slot to be blocked
+    int num_threads = 0;            // 0 = hardware concurrency
+};
+
+/// Creepage from each source net to every net with copper, row-major
+/// (``sources`` x ``nets``).  Each pair is taken on its binding layer, the
+/// one with the smallest creepage (lowest index on ties); ``clearance`` is
+/// the straight gap on that layer.  Pairs sharing no layer hold +inf and
+/// layer -1, as does a source paired with itself.
+struct CreepageMatrix {
+    std::vector<int> sources;
+    std::vector<int> nets;  // every non-zero net with copper, ascending
+    std::vector<double> clearance;
+    std::vector<double> creepage;
+    std::vector<int> layer;
+    /// Per source: straight gap and creepage to the board edge over all layers
+    std::vector<double> edge_clearance;
+    std::vector<double> edge_creepage;
+};
+
+/// Compute the creepage matrix for ``sources`` (non-zero nets).
+///
+/// @throws std::invalid_argument as check_copper_drc(), or for
+///         mismatched outline arrays or slot offsets
+CreepageMatrix creepage_matrix(
+    const CopperBoard& board,
+    const CreepageOutline& outline,
+    const std::vector<int>& sources,
+    const CreepageRules& rules
+);
+
+} // namespace drc
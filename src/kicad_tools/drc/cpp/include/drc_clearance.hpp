@@ -24,6 +24,18 @@ struct ClearanceResult {
     bool has_result = false;
 };
 
+/// Every violating pad pair of a component pair, as parallel arrays sorted
+/// by (clearance, pad1_index, pad2_index).
+struct PairViolations {
+    std::vector<int> pad1_index;
+    std::vector<int> pad2_index;
+    std::vector<float> clearance;
+    std::vector<float> location_x;
+    std::vector<float> location_y;
+
+    int size() const { return static_cast<int>(clearance.size()); }
+};
+
 /// Batch pad-to-pad clearance check using struct-of-arrays layout.
 ///
 /// All pad data is passed as flat arrays to minimize marshaling overhead.
@@ -72,4 +84,42 @@ ClearanceResult check_pair_clearance_vec(
     float fp2_x, float fp2_y, float fp2_rotation_rad
 );
 
+/// Enumerate pad pairs with clearance below ``threshold`` in one pass.
+///
+/// Takes the same pads and placements as check_pair_clearance().  With
+/// ``max_results > 0`` only that many smallest pairs are kept, and the
+/// k-th best found so far tightens the threshold, so a top-k query costs
+/// about as much as the minimum-only check.  The first entry is the pair
+/// check_pair_clearance() reports whenever it lies below the threshold.
+///
+/// @param threshold   Report pairs with clearance strictly below this
+/// @param max_results Keep only the smallest pairs; 0 keeps all
+/// @return PairViolations with midpoints as locations
+PairViolations check_pair_violations(
+    const float* pad1_local_x, const float* pad1_local_y,
+    const float* pad1_radius, const int* pad1_net,
+    int n_pads1,
+    float fp1_x, float fp1_y, float fp1_rotation_rad,
+    const float* pad2_local_x, const float* pad2_local_y,
+    const float* pad2_radius, const int* pad2_net,
+    int n_pads2,
+    float fp2_x, float fp2_y, float fp2_rotation_rad,
+    float threshold, int max_results
+);
+
+/// Vector-based wrapper for Python bindings.
+PairViolations check_pair_violations_vec(
+    const std::vector<float>& pad1_local_x,
+    const std::vector<float>& pad1_local_y,
+    const std::vector<float>& pad1_radius,
+    const std::vector<int>& pad1_net,
+    float fp1_x, float fp1_y, float fp1_rotation_rad,
+    const std::vector<float>& pad2_local_x,
+    const std::vector<float>& pad2_local_y,
+    const std::vector<float>& pad2_radius,
+    const std::vector<int>& pad2_net,
+    float fp2_x, float fp2_y, float fp2_rotation_rad,
+    float threshold, int max_results
+);
+
 } // namespace drc
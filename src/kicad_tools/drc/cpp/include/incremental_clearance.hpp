@@ -0,0 +1,133 @@
+/*
+ * DRC Clearance C++ Core - incremental pad clearance state
+ *
+ * IncrementalDRC (drc/incremental.py) kept footprint boxes in a Python
+ * R-tree and, per move, re-queried neighbours and called
+ * check_pair_clearance() once per neighbour.  IncrementalClearance holds
+ * the whole state natively: local and transformed pads per footprint, a
+ * dynamic uniform grid over footprint boxes, and the worst pad pair of
+ * every violating footprint pair.  check_move() re-evaluates only the
+ * pairs the moved footprint takes part in; apply_move() commits them.
+ * screen_moves() scores a whole batch of candidate poses in parallel
+ * against the same grid, for optimizers that try many moves per step.
+ *
+ * Pair results are the ones check_board_clearance() reports for the same
+ * placement: the same candidate filter (boxes grown by min_clearance), the
+ * same float transforms, and the pair minimum from pad_pair_minimum().
+ */
+
+#pragma once
+
+#include "board_clearance.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace drc {
+
+/// Outcome of moving one footprint.
+struct IncrementalMove {
+    /// Every violating pair of the footprint at its new pose
+    std::vector<BoardClearanceViolation> violations;
+    /// Its cached violating pairs that no longer violate
+    std::vector<BoardClearanceViolation> resolved;
+    /// Other footprints within reach of the old or the new pose, ascending
+    std::vector<int> neighbours;
+};
+
+/// Outcome of screening candidate moves, one entry per candidate.
+struct MoveScreen {
+    /// Violating pairs of the footprint at the candidate pose
+    std::vector<int> violations;
+    /// Change in the board's violating pair count were the move applied
+    std::vector<int> net_change;
+    /// Smallest pad clearance to any footprint within reach (boxes grown
+    /// by min_clearance); +inf when none is
+    std::vector<float> min_clearance;
+};
+
+class IncrementalClearance {
+public:
+    /// Build the state and run the initial whole-board check.
+    /// @throws std::invalid_argument as check_board_clearance()
+    IncrementalClearance(BoardPads pads, FootprintTransforms transforms,
+                         BoardClearanceRules rules);
+
+    int num_footprints() const { return static_cast<int>(pose_x_.size()); }
+
+    /// Cached violating pairs, sorted by (footprint1, footprint2).
+    std::vector<BoardClearanceViolation> violations() const;
+
+    /// Preview translating footprint ``f`` by (dx, dy) and turning it by
+    /// ``drot`` radians (CCW convention, as FootprintTransforms).  Poses
+    /// accumulate in double; the pads are transformed in float from them.
+    /// @throws std::out_of_range for an unknown footprint
+    IncrementalMove check_move(int f, double dx, double dy, double drot) const;
+
+    /// check_move(), then commit the pose, grid cells and pair cache.
+    IncrementalMove apply_move(int f, double dx, double dy, double drot);
+
+    /// Score candidate k = move footprint[k] by (dx[k], dy[k]) and turn it
+    /// by drot[k] from its current pose, as check_move() would, without
+    /// building the violation lists.  Candidates are independent and run in
+    /// parallel; nothing is committed.
+    /// @throws std::invalid_argument if the arrays differ in length
+    /// @throws std::out_of_range for an unknown footprint
+    MoveScreen screen_moves(const std::vector<int>& footprint, const std::vector<double>& dx,
+                            const std::vector<double>& dy, const std::vector<double>& drot,
+                            int num_threads = 0) const;
+
+    /// Footprint box (pad rectangles, as check_board_clearance builds it):
+    /// {min_x, min_y, max_x, max_y}; all +/-inf for a footprint without pads.
+    std::vector<float> bounds(int f) const;
+
+    /// Footprints whose boxes intersect the query box, ascending.
+    std::vector<int> query(float min_x, float min_y, float max_x, float max_y) const;
+
+    double x(int f) const { return pose_x_.at(f); }
+    double y(int f) const { return pose_y_.at(f); }
+    double rotation(int f) const { return pose_rot_.at(f); }
+
+private:
+    struct Box {
+        float min_x, min_y, max_x, max_y;
+    };
+
+    struct Placed {
+        std::vector<float> x, y;
+        Box box;
+    };
+
+    Placed place(int f, double x, double y, double rot) const;
+    template <typename Visit>
+    void visit_pairs(int f, const Placed& at, Visit&& visit) const;
+    void evaluate(int f, const Placed& at, IncrementalMove& out) const;
+    void candidates(const Box& box, int skip, std::vector<int>& out) const;
+    void grid_insert(int f);
+    void grid_remove(int f);
+    bool has_pads(int f) const { return offsets_[f + 1] > offsets_[f]; }
+    static uint64_t pair_key(int a, int b) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(a)) << 32) | static_cast<uint32_t>(b);
+    }
+
+    BoardPads pads_;
+    std::vector<int> offsets_;
+    std::vector<float> radius_;
+    BoardClearanceRules rules_;
+    float threshold_;  // violation: clearance < threshold
+
+    std::vector<double> pose_x_, pose_y_, pose_rot_;
+    std::vector<float> abs_x_, abs_y_;  // board pads, indexed like pads_
+    std::vector<Box> box_;
+
+    // Uniform grid over footprint boxes, cells keyed by (col, row).
+    float cell_ = 1.0f;
+    std::unordered_map<uint64_t, std::vector<int>> cells_;
+
+    // Worst pad pair per violating footprint pair, keyed (footprint1, footprint2).
+    std::unordered_map<uint64_t, BoardClearanceViolation> pairs_;
+    std::vector<std::vector<int>> partners_;
+};
+
+} // namespace drc
@@ -0,0 +1,72 @@
+/*
+ * DRC Clearance C++ Core - vectorized pad-pair minimum
+ *
+ * The O(P1 x P2) inner loop of check_pair_clearance(): the closest pair of
+ * pad discs between two footprints, skipping same-net pads (net 0 never
+ * matches).  Explicit SSE2 (4 lanes), AVX2 (8) and AVX-512 (16) kernels
+ * keep a lane-wise running minimum with masked net comparison; the level
+ * is chosen at runtime from the CPU, with a scalar fallback everywhere.
+ *
+ * Every level returns the same bits: clearances are sqrt(dx*dx + dy*dy)
+ * - (r1 + r2) in float with no contraction into FMA (the build compiles
+ * these files with -ffp-contract=off), and ties go to the first pair in
+ * row-major (i, j) order, as the scalar loop reports them.
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace drc {
+
+enum SimdLevel : int {
+    SIMD_SCALAR = 0,
+    SIMD_SSE2 = 1,
+    SIMD_AVX2 = 2,
+    SIMD_AVX512 = 3,
+};
+
+/// Closest pad pair: clearance and indices, or i = j = -1 when every pair
+/// was same-net (or a side had no pads).
+struct PairMinimum {
+    float clearance;
+    int i;
+    int j;
+};
+
+/// Highest level this CPU (and OS register state) supports.
+SimdLevel detect_simd_level();
+
+/// Level check_pair_clearance() uses: detected on first use, or the one
+/// last set with set_simd_level().
+SimdLevel active_simd_level();
+
+/// Force a level (benchmarks, tests).  Levels above detect_simd_level()
+/// are clamped to it.
+/// @return The level now active
+SimdLevel set_simd_level(SimdLevel level);
+
+/// Minimum disc clearance between two transformed pad sets.
+///
+/// @param ax, ay, ar, anet  Component 1 board positions, radii and nets
+/// @param n1                Number of component 1 pads
+/// @param bx, by, br, bnet  Component 2 board positions, radii and nets
+/// @param n2                Number of component 2 pads
+/// @param level             Kernel to run (clamped to detect_simd_level())
+PairMinimum pad_pair_minimum(
+    const float* ax, const float* ay, const float* ar, const int* anet, int n1,
+    const float* bx, const float* by, const float* br, const int* bnet, int n2,
+    SimdLevel level);
+
+/// Every pad pair with clearance below ``threshold`` (strictly), or only
+/// the ``max_results`` smallest of them when ``max_results > 0``.  The
+/// running cut (threshold, then the k-th best once k pairs are held)
+/// drives the same early rejection as pad_pair_minimum().  Every level
+/// returns the same pairs.
+/// @return Pairs sorted by (clearance, i, j)
+std::vector<PairMinimum> pad_pair_below(
+    const float* ax, const float* ay, const float* ar, const int* anet, int n1,
+    const float* bx, const float* by, const float* br, const int* bnet, int n2,
+    float threshold, int max_results, SimdLevel level);
+
+} // namespace drc
@@ -0,0 +1,91 @@
+/*
+ * DRC Clearance C++ Core - exact pad shape distance
+ *
+ * check_pair_clearance() models every pad as a disc of radius max(w, h)/2,
+ * which over-reports on elongated SMD pads.  The Python ClearanceRule then
+ * re-checks pad pairs with shapely polygons (validate/rules/clearance.py,
+ * issue #3826).  pad_shape_clearance() replaces that re-check natively.
+ *
+ * Every pad is a core polygon inflated by a radius (a Minkowski sum):
+ *
+ *   circle     point                        + min(w, h)/2
+ *   rect       w x h box                    + 0
+ *   roundrect  (w - 2r) x (h - 2r) box      + r
+ *   oval       segment on the long axis     + min(w, h)/2
+ *   polygon    custom outline (pad-local)   + corner_radius
+ *
+ * so the distance between two pads is the distance between their cores
+ * minus both radii -- exact for arcs, with no polygonised corners.  When
+ * the cores overlap the clearance is minus the penetration depth (SAT over
+ * the core edge normals; a lower bound for non-convex custom outlines).
+ *
+ * bounding_radius() is the conservative broadphase: a disc around the pad
+ * centre that contains the whole copper, so a pair whose discs clear the
+ * threshold can skip the exact test.
+ */
+
+#pragma once
+
+#include "drc_clearance.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace drc {
+
+enum PadShapeKind : int {
+    PAD_SHAPE_CIRCLE = 0,
+    PAD_SHAPE_RECT = 1,
+    PAD_SHAPE_ROUNDRECT = 2,
+    PAD_SHAPE_OVAL = 3,
+    PAD_SHAPE_POLYGON = 4,
+};
+
+/// One pad's copper outline in board coordinates.
+///
+/// Sizes are the pad's local (unrotated) size; ``rotation_rad`` turns the
+/// outline counter-clockwise about the pad centre.  Doubles throughout:
+/// results feed micron-level DRC decisions.
+struct PadShape {
+    int kind = PAD_SHAPE_RECT;
+    double x = 0.0;
+    double y = 0.0;
+    double width = 0.0;
+    double height = 0.0;
+    double rotation_rad = 0.0;
+    double corner_radius = 0.0;       // ROUNDRECT corners / POLYGON inflation
+    std::vector<double> polygon_x;    // POLYGON outline, pad-local
+    std::vector<double> polygon_y;
+};
+
+struct ShapeClearance {
+    double clearance = 0.0;   // edge to edge, negative when overlapping
+    double location_x = 0.0;  // midpoint of the closest points (overlap: centre of the overlap)
+    double location_y = 0.0;
+};
+
+/// Radius of a disc about (x, y) that contains the pad's copper.
+double bounding_radius(const PadShape& shape);
+
+/// Polygon containing the pad grown by ``distance`` (its core inflated by
+/// radius + distance), counter-clockwise in board coordinates.
+///
+/// Arcs are circumscribed with ``arc_segments`` sides per full turn, so the
+/// polygon never undercuts the exact grown outline.  A non-convex custom
+/// outline is grown from its convex hull.
+///
+/// @throws std::invalid_argument as pad_shape_clearance()
+std::vector<std::pair<double, double>> inflated_outline(
+    const PadShape& shape, double distance, int arc_segments
+);
+
+/// Exact edge-to-edge clearance between two pads.
+///
+/// @param a  First pad
+/// @param b  Second pad
+/// @return Clearance and violation location
+/// @throws std::invalid_argument for an unknown kind or a POLYGON whose
+///         outline arrays differ in length or have fewer than 3 points
+ShapeClearance pad_shape_clearance(const PadShape& a, const PadShape& b);
+
+} // namespace drc
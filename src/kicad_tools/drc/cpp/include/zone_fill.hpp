@@ -0,0 +1,78 @@
+/*
+ * DRC Clearance C++ Core - zone fill clearance carving
+ *
+ * zones/fill_clearance.py carved foreign-net antipads out of every committed
+ * filled_polygon with shapely: each obstacle buffered on its own, the
+ * buffers unioned and subtracted, the new holes vented to the exterior with
+ * slits, stranded islands dropped and the rewrite reconstructed for a safety
+ * check -- one shapely geometry per obstacle per fill, all alive at once.
+ * carve_zone_fills() runs the whole stage natively:
+ *
+ *   - obstacles are PadShapes (pad boxes, via discs, track stadiums) grown
+ *     analytically by each fill's antipad distance and polygonised outside
+ *     the exact outline (inflated_outline())
+ *   - one boolean subtraction per fill against every cutter on its layer:
+ *     edges split at their crossings on an integer nanometre grid, each
+ *     piece kept by the winding numbers on its two sides
+ *   - holes vented with hair-thin slits (each to the nearest ring already
+ *     open), islands kept only when they touch same-net copper
+ *   - the result accepted only if it keeps the antipad distance to every
+ *     obstacle's exact outline and adds no area outside the original fill
+ *   - fills processed in parallel, rings written straight into one flat
+ *     buffer
+ */
+
+#pragma once
+
+#include "pad_shape.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace drc {
+
+enum FillStatus : int {
+    FILL_UNCHANGED = 0,    // no foreign copper within the antipad distance
+    FILL_CARVED = 1,       // rewritten: see ZoneFillResult rings
+    FILL_KEPT = 2,         // carving failed a safety gate; keep the original
+    FILL_UNSUPPORTED = 3,  // beyond the integer grid or not a clean boolean
+};
+
+struct ZoneFillJob {
+    // Fill k's ring is fill_x/fill_y[fill_offsets[k] .. fill_offsets[k + 1])
+    std::vector<int> fill_offsets;
+    std::vector<double> fill_x, fill_y;
+    std::vector<int> fill_layer;
+    std::vector<int> fill_net;
+    std::vector<double> fill_antipad;  // clearance + min_thickness / 2
+
+    // Net copper: cut out of other nets' fills, anchors for its own net's
+    std::vector<PadShape> obstacles;
+    std::vector<uint64_t> obstacle_layers;
+    std::vector<int> obstacle_net;
+    std::vector<int> obstacle_cuts;  // 0 = anchor only (zero-width tracks)
+};
+
+struct ZoneFillRules {
+    double slit_width = 1e-4;    // half-width of a hole vent
+    double area_epsilon = 1e-4;  // mm^2 of overlap / gain treated as noise
+    int arc_segments = 64;       // cutter polygon sides per full turn
+    int num_threads = 0;         // 0 = hardware concurrency
+};
+
+struct ZoneFillResult {
+    std::vector<int> status;  // FillStatus per fill
+    // Carved fill k's rings are rings [fill_rings[k], fill_rings[k + 1]);
+    // ring r is ring_x/ring_y[ring_offsets[r] .. ring_offsets[r + 1])
+    std::vector<int> fill_rings;
+    std::vector<int> ring_offsets;
+    std::vector<double> ring_x, ring_y;
+};
+
+/// Carve every fill's foreign-net antipads.
+///
+/// @throws std::invalid_argument if the fill or obstacle arrays differ in
+///         length or the fill offsets are not 0..n_points
+ZoneFillResult carve_zone_fills(const ZoneFillJob& job, const ZoneFillRules& rules);
+
+} // namespace drc
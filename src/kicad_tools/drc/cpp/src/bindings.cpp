@@ -3,8 +3,17 @@
  * Part of kicad-tools DRC performance optimization (Phase 4)
  */
 
+#include "board_clearance.hpp"
+#include "connectivity.hpp"
+#include "copper_drc.hpp"
+#include "creepage.hpp"
 #include "drc_clearance.hpp"
+#include "incremental_clearance.hpp"
+#include "pad_pair_simd.hpp"
+#include "pad_shape.hpp"
+#include "zone_fill.hpp"
 #include <nanobind/nanobind.h>
+#include <nanobind/stl/pair.h>
 #include <nanobind/stl/vector.h>
 
 namespace nb = nanobind;
@@ -34,7 +43,7 @@ NB_MODULE(drc_cpp, m) {
         "fp2_x"_a, "fp2_y"_a, "fp2_rotation_rad"_a,
         "Batch pad-to-pad clearance check.\n\n"
         "Checks all pads of component 1 against all pads of component 2.\n"
-        "Uses squared-distance optimization to minimize sqrt calls.\n"
+        "The inner loop runs the SIMD kernel picked by simd_level().\n"
         "Pad data is passed as flat arrays (struct-of-arrays layout).\n\n"
         "Args:\n"
         "    pad1_local_x: Component 1 pad local X coordinates\n"
@@ -55,7 +64,458 @@ NB_MODULE(drc_cpp, m) {
         "    ClearanceResult with minimum clearance and violation location"
     );
 
+    // All violating pad pairs of one component pair, as parallel arrays
+    nb::class_<PairViolations>(m, "PairViolations")
+        .def(nb::init<>())
+        .def_ro("pad1_index", &PairViolations::pad1_index)
+        .def_ro("pad2_index", &PairViolations::pad2_index)
+        .def_ro("clearance", &PairViolations::clearance)
+        .def_ro("location_x", &PairViolations::location_x)
+        .def_ro("location_y", &PairViolations::location_y)
+        .def("__len__", &PairViolations::size);
+
+    m.def("check_pair_violations", &check_pair_violations_vec,
+        "pad1_local_x"_a, "pad1_local_y"_a,
+        "pad1_radius"_a, "pad1_net"_a,
+        "fp1_x"_a, "fp1_y"_a, "fp1_rotation_rad"_a,
+        "pad2_local_x"_a, "pad2_local_y"_a,
+        "pad2_radius"_a, "pad2_net"_a,
+        "fp2_x"_a, "fp2_y"_a, "fp2_rotation_rad"_a,
+        "threshold"_a, "max_results"_a = 0,
+        "Every pad pair below a clearance threshold, in one pass.\n\n"
+        "Same arguments as check_pair_clearance, plus:\n\n"
+        "Args:\n"
+        "    threshold: Report pairs with clearance strictly below this\n"
+        "    max_results: Keep only that many smallest pairs (0: all)\n\n"
+        "Returns:\n"
+        "    PairViolations sorted by (clearance, pad1_index, pad2_index)"
+    );
+
+    // Whole-board sweep result (one per violating footprint pair)
+    nb::class_<BoardClearanceViolation>(m, "BoardClearanceViolation")
+        .def(nb::init<>())
+        .def_ro("footprint1", &BoardClearanceViolation::footprint1)
+        .def_ro("footprint2", &BoardClearanceViolation::footprint2)
+        .def_ro("pad1_index", &BoardClearanceViolation::pad1_index)
+        .def_ro("pad2_index", &BoardClearanceViolation::pad2_index)
+        .def_ro("min_clearance", &BoardClearanceViolation::min_clearance)
+        .def_ro("location_x", &BoardClearanceViolation::location_x)
+        .def_ro("location_y", &BoardClearanceViolation::location_y);
+
+    // Whole-board clearance sweep.  GIL released: pure C++ over copied arrays.
+    m.def("check_board_clearance",
+        [](std::vector<float> pad_local_x, std::vector<float> pad_local_y,
+           std::vector<float> pad_width, std::vector<float> pad_height,
+           std::vector<int> pad_net, std::vector<int> footprint_offsets,
+           std::vector<float> fp_x, std::vector<float> fp_y,
+           std::vector<float> fp_rotation_rad,
+           float min_clearance, float epsilon, int num_threads) {
+            BoardPads pads{std::move(pad_local_x), std::move(pad_local_y),
+                           std::move(pad_width), std::move(pad_height),
+                           std::move(pad_net), std::move(footprint_offsets)};
+            FootprintTransforms transforms{std::move(fp_x), std::move(fp_y),
+                                           std::move(fp_rotation_rad)};
+            BoardClearanceRules rules;
+            rules.min_clearance = min_clearance;
+            rules.epsilon = epsilon;
+            rules.num_threads = num_threads;
+            return check_board_clearance(pads, transforms, rules);
+        },
+        "pad_local_x"_a, "pad_local_y"_a,
+        "pad_width"_a, "pad_height"_a, "pad_net"_a,
+        "footprint_offsets"_a,
+        "fp_x"_a, "fp_y"_a, "fp_rotation_rad"_a,
+        "min_clearance"_a, "epsilon"_a = 1e-4f, "num_threads"_a = 0,
+        nb::call_guard<nb::gil_scoped_release>(),
+        "Whole-board pad-to-pad clearance check.\n\n"
+        "Transforms every pad once and finds every footprint pair whose\n"
+        "closest pads are nearer than min_clearance - epsilon, using a\n"
+        "uniform-grid broadphase instead of one call per footprint pair.\n\n"
+        "Args:\n"
+        "    pad_local_x: Local X of every pad, grouped by footprint\n"
+        "    pad_local_y: Local Y of every pad\n"
+        "    pad_width: Unrotated pad widths\n"
+        "    pad_height: Unrotated pad heights\n"
+        "    pad_net: Pad net numbers\n"
+        "    footprint_offsets: First pad of each footprint, plus the pad count\n"
+        "    fp_x: Footprint X positions\n"
+        "    fp_y: Footprint Y positions\n"
+        "    fp_rotation_rad: Footprint rotations in radians\n"
+        "    min_clearance: Required clearance in mm\n"
+        "    epsilon: Tolerance below min_clearance before reporting\n"
+        "    num_threads: Worker threads (0 = hardware concurrency)\n\n"
+        "Returns:\n"
+        "    BoardClearanceViolation list sorted by (footprint1, footprint2);\n"
+        "    each holds the pair's worst pads, as check_pair_clearance reports"
+    );
+
+    // Exact pad shapes (board coordinates)
+    nb::enum_<PadShapeKind>(m, "PadShapeKind")
+        .value("CIRCLE", PAD_SHAPE_CIRCLE)
+        .value("RECT", PAD_SHAPE_RECT)
+        .value("ROUNDRECT", PAD_SHAPE_ROUNDRECT)
+        .value("OVAL", PAD_SHAPE_OVAL)
+        .value("POLYGON", PAD_SHAPE_POLYGON);
+
+    nb::class_<PadShape>(m, "PadShape")
+        .def(nb::init<>())
+        .def("__init__",
+            [](PadShape* self, int kind, double x, double y, double width, double height,
+               double rotation_rad, double corner_radius,
+               std::vector<double> polygon_x, std::vector<double> polygon_y) {
+                new (self) PadShape{kind, x, y, width, height, rotation_rad, corner_radius,
+                                    std::move(polygon_x), std::move(polygon_y)};
+            },
+            "kind"_a, "x"_a, "y"_a, "width"_a, "height"_a,
+            "rotation_rad"_a = 0.0, "corner_radius"_a = 0.0,
+            "polygon_x"_a = std::vector<double>{}, "polygon_y"_a = std::vector<double>{})
+        .def_rw("kind", &PadShape::kind)
+        .def_rw("x", &PadShape::x)
+        .def_rw("y", &PadShape::y)
+        .def_rw("width", &PadShape::width)
+        .def_rw("height", &PadShape::height)
+        .def_rw("rotation_rad", &PadShape::rotation_rad)
+        .def_rw("corner_radius", &PadShape::corner_radius)
+        .def_rw("polygon_x", &PadShape::polygon_x)
+        .def_rw("polygon_y", &PadShape::polygon_y);
+
+    nb::class_<ShapeClearance>(m, "ShapeClearance")
+        .def(nb::init<>())
+        .def_ro("clearance", &ShapeClearance::clearance)
+        .def_ro("location_x", &ShapeClearance::location_x)
+        .def_ro("location_y", &ShapeClearance::location_y);
+
+    m.def("pad_shape_clearance", &pad_shape_clearance, "a"_a, "b"_a,
+        "Exact edge-to-edge clearance between two pad shapes.\n\n"
+        "Rect, roundrect, oval and circle pads are a box, segment or point\n"
+        "inflated by a radius, so arcs are exact (no polygonised corners).\n"
+        "Overlapping pads report minus the penetration depth.\n\n"
+        "Args:\n"
+        "    a: First PadShape (board coordinates)\n"
+        "    b: Second PadShape\n\n"
+        "Returns:\n"
+        "    ShapeClearance with clearance (negative when overlapping) and location"
+    );
+
+    m.def("pad_bounding_radius", &bounding_radius, "shape"_a,
+        "Radius of a disc about the pad centre that contains its copper.");
+
+    // Unified copper DRC (segments, vias, pads, zone fills, drills)
+    nb::enum_<CopperItemType>(m, "CopperItemType")
+        .value("SEGMENT", COPPER_SEGMENT)
+        .value("PAD", COPPER_PAD)
+        .value("VIA", COPPER_VIA)
+        .value("ZONE", COPPER_ZONE);
+
+    nb::enum_<CopperCheck>(m, "CopperCheck")
+        .value("CLEARANCE", CHECK_CLEARANCE)
+        .value("ZONE", CHECK_ZONE)
+        .value("HOLE_TO_HOLE", CHECK_HOLE_TO_HOLE)
+        .value("HOLE_TO_COPPER", CHECK_HOLE_TO_COPPER)
+        .value("ALL", CHECK_ALL);
+
+    nb::class_<CopperBoard>(m, "CopperBoard")
+        .def(nb::init<>())
+        .def_rw("num_layers", &CopperBoard::num_layers)
+        .def_rw("seg_x1", &CopperBoard::seg_x1)
+        .def_rw("seg_y1", &CopperBoard::seg_y1)
+        .def_rw("seg_x2", &CopperBoard::seg_x2)
+        .def_rw("seg_y2", &CopperBoard::seg_y2)
+        .def_rw("seg_width", &CopperBoard::seg_width)
+        .def_rw("seg_layer", &CopperBoard::seg_layer)
+        .def_rw("seg_net", &CopperBoard::seg_net)
+        .def_rw("via_x", &CopperBoard::via_x)
+        .def_rw("via_y", &CopperBoard::via_y)
+        .def_rw("via_size", &CopperBoard::via_size)
+        .def_rw("via_drill", &CopperBoard::via_drill)
+        .def_rw("via_layers", &CopperBoard::via_layers)
+        .def_rw("via_explicit_layers", &CopperBoard::via_explicit_layers)
+        .def_rw("via_net", &CopperBoard::via_net)
+        .def_rw("pads", &CopperBoard::pads)
+        .def_rw("pad_layers", &CopperBoard::pad_layers)
+        .def_rw("pad_drill", &CopperBoard::pad_drill)
+        .def_rw("pad_net", &CopperBoard::pad_net)
+        .def_rw("zone_offsets", &CopperBoard::zone_offsets)
+        .def_rw("zone_x", &CopperBoard::zone_x)
+        .def_rw("zone_y", &CopperBoard::zone_y)
+        .def_rw("zone_layer", &CopperBoard::zone_layer)
+        .def_rw("zone_net", &CopperBoard::zone_net);
+
+    nb::class_<CopperRules>(m, "CopperRules")
+        .def(nb::init<>())
+        .def_rw("min_clearance", &CopperRules::min_clearance)
+        .def_rw("min_hole_to_hole", &CopperRules::min_hole_to_hole)
+        .def_rw("min_hole_to_copper", &CopperRules::min_hole_to_copper)
+        .def_rw("tolerance", &CopperRules::tolerance)
+        .def_rw("colocation_epsilon", &CopperRules::colocation_epsilon)
+        .def_rw("exempt_net_pairs", &CopperRules::exempt_net_pairs)
+        .def_rw("checks", &CopperRules::checks)
+        .def_rw("num_threads", &CopperRules::num_threads);
+
+    nb::class_<CopperViolation>(m, "CopperViolation")
+        .def(nb::init<>())
+        .def_ro("check", &CopperViolation::check)
+        .def_ro("layer", &CopperViolation::layer)
+        .def_ro("type1", &CopperViolation::type1)
+        .def_ro("index1", &CopperViolation::index1)
+        .def_ro("type2", &CopperViolation::type2)
+        .def_ro("index2", &CopperViolation::index2)
+        .def_ro("actual", &CopperViolation::actual)
+        .def_ro("required", &CopperViolation::required)
+        .def_ro("location_x", &CopperViolation::location_x)
+        .def_ro("location_y", &CopperViolation::location_y);
+
+    m.def("check_copper_drc", &check_copper_drc, "board"_a, "rules"_a,
+        nb::call_guard<nb::gil_scoped_release>(),
+        "Whole-board copper DRC in one pass.\n\n"
+        "Runs the CopperCheck classes enabled in rules.checks with per-layer\n"
+        "grid indexes, spread over rules.num_threads workers.\n\n"
+        "Args:\n"
+        "    board: CopperBoard with every segment, via, pad and zone fill\n"
+        "    rules: CopperRules thresholds and enabled checks\n\n"
+        "Returns:\n"
+        "    CopperViolation list sorted by (check, layer, type1, index1,\n"
+        "    type2, index2)"
+    );
+
+    // Incremental pad clearance state for interactive placement
+    nb::class_<IncrementalMove>(m, "IncrementalMove")
+        .def_ro("violations", &IncrementalMove::violations)
+        .def_ro("resolved", &IncrementalMove::resolved)
+        .def_ro("neighbours", &IncrementalMove::neighbours);
+
+    nb::class_<MoveScreen>(m, "MoveScreen")
+        .def_ro("violations", &MoveScreen::violations)
+        .def_ro("net_change", &MoveScreen::net_change)
+        .def_ro("min_clearance", &MoveScreen::min_clearance);
+
+    nb::class_<IncrementalClearance>(m, "IncrementalClearance")
+        .def("__init__",
+            [](IncrementalClearance* self,
+               std::vector<float> pad_local_x, std::vector<float> pad_local_y,
+               std::vector<float> pad_width, std::vector<float> pad_height,
+               std::vector<int> pad_net, std::vector<int> footprint_offsets,
+               std::vector<float> fp_x, std::vector<float> fp_y,
+               std::vector<float> fp_rotation_rad,
+               float min_clearance, float epsilon, int num_threads) {
+                BoardPads pads{std::move(pad_local_x), std::move(pad_local_y),
+                               std::move(pad_width), std::move(pad_height),
+                               std::move(pad_net), std::move(footprint_offsets)};
+                FootprintTransforms transforms{std::move(fp_x), std::move(fp_y),
+                                               std::move(fp_rotation_rad)};
+                BoardClearanceRules rules;
+                rules.min_clearance = min_clearance;
+                rules.epsilon = epsilon;
+                rules.num_threads = num_threads;
+                new (self) IncrementalClearance(std::move(pads), transforms, rules);
+            },
+            "pad_local_x"_a, "pad_local_y"_a,
+            "pad_width"_a, "pad_height"_a, "pad_net"_a,
+            "footprint_offsets"_a,
+            "fp_x"_a, "fp_y"_a, "fp_rotation_rad"_a,
+            "min_clearance"_a, "epsilon"_a = 1e-4f, "num_threads"_a = 0,
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Build the incremental state from check_board_clearance's arrays\n"
+            "and run the initial whole-board check.")
+        .def("num_footprints", &IncrementalClearance::num_footprints)
+        .def("violations", &IncrementalClearance::violations,
+            "Cached violating pairs, sorted by (footprint1, footprint2).")
+        .def("check_move", &IncrementalClearance::check_move,
+            "footprint"_a, "dx"_a, "dy"_a, "drot"_a = 0.0,
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Preview translating a footprint by (dx, dy) and turning it by drot\n"
+            "radians (CCW, the negated KiCad angle).  Only pairs the footprint\n"
+            "takes part in are evaluated; the state is unchanged.\n\n"
+            "Returns:\n"
+            "    IncrementalMove: the footprint's violating pairs at the new pose,\n"
+            "    its cached pairs that no longer violate, and the neighbours\n"
+            "    within reach of either pose")
+        .def("apply_move", &IncrementalClearance::apply_move,
+            "footprint"_a, "dx"_a, "dy"_a, "drot"_a = 0.0,
+            nb::call_guard<nb::gil_scoped_release>(),
+            "check_move(), then commit the pose, spatial index and pair cache.")
+        .def("screen_moves", &IncrementalClearance::screen_moves,
+            "footprint"_a, "dx"_a, "dy"_a, "drot"_a, "num_threads"_a = 0,
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Score a batch of candidate moves in parallel; nothing is committed.\n\n"
+            "Candidate k moves footprint[k] by (dx[k], dy[k]) and turns it by\n"
+            "drot[k] radians from its current pose, as check_move() would.\n\n"
+            "Returns:\n"
+            "    MoveScreen: per candidate the footprint's violating pair count,\n"
+            "    the change in the board's count, and the smallest pad clearance\n"
+            "    to any footprint within reach (+inf when none is)")
+        .def("bounds", &IncrementalClearance::bounds, "footprint"_a,
+            "Footprint box [min_x, min_y, max_x, max_y] at its current pose.")
+        .def("query", &IncrementalClearance::query,
+            "min_x"_a, "min_y"_a, "max_x"_a, "max_y"_a,
+            "Footprints whose boxes intersect the query box, ascending.")
+        .def("x", &IncrementalClearance::x, "footprint"_a)
+        .def("y", &IncrementalClearance::y, "footprint"_a)
+        .def("rotation", &IncrementalClearance::rotation, "footprint"_a);
+
+    // Copper connectivity (union-find) and different-net shorts
+    nb::class_<ConnectivityRules>(m, "ConnectivityRules")
+        .def(nb::init<>())
+        .def_rw("tolerance", &ConnectivityRules::tolerance)
+        .def_rw("short_clearance", &ConnectivityRules::short_clearance);
+
+    nb::class_<CopperShort>(m, "CopperShort")
+        .def(nb::init<>())
+        .def_ro("layer", &CopperShort::layer)
+        .def_ro("type1", &CopperShort::type1)
+        .def_ro("index1", &CopperShort::index1)
+        .def_ro("type2", &CopperShort::type2)
+        .def_ro("index2", &CopperShort::index2)
+        .def_ro("clearance", &CopperShort::clearance)
+        .def_ro("location_x", &CopperShort::location_x)
+        .def_ro("location_y", &CopperShort::location_y);
+
+    nb::class_<ConnectivityReport>(m, "ConnectivityReport")
+        .def_ro("shorts", &ConnectivityReport::shorts)
+        .def_ro("stranded_pads", &ConnectivityReport::stranded_pads)
+        .def_ro("incomplete_nets", &ConnectivityReport::incomplete_nets)
+        .def_ro("island_type", &ConnectivityReport::island_type)
+        .def_ro("island_index", &ConnectivityReport::island_index);
+
+    nb::class_<CopperConnectivity>(m, "CopperConnectivity")
+        .def("__init__",
+            [](CopperConnectivity* self, CopperBoard board, ConnectivityRules rules) {
+                new (self) CopperConnectivity(std::move(board), rules);
+            },
+            "board"_a, "rules"_a,
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Index all board copper and join touching same-net items.\n\n"
+            "Args:\n"
+            "    board: CopperBoard with segments, vias, pads and zone fills\n"
+            "    rules: ConnectivityRules join tolerance and short clearance")
+        .def("commit", &CopperConnectivity::commit, "route"_a,
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Add a route's segments, vias and fills (no pads).\n\n"
+            "Board indices continue after the existing items.\n\n"
+            "Returns:\n"
+            "    CopperShort list for the shorts the new copper makes")
+        .def("remove_net", &CopperConnectivity::remove_net, "net"_a,
+            "Rip up every segment and via of a net.")
+        .def("shorts", &CopperConnectivity::shorts,
+            "Every different-net short, sorted by (type1, index1, type2, index2).")
+        .def("report", &CopperConnectivity::report,
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Shorts, stranded pads, incomplete nets and copper islands.")
+        .def("component", &CopperConnectivity::component, "type"_a, "index"_a,
+            "Component id of an item; -1 for removed and net-0 copper.")
+        .def("pads_connected", &CopperConnectivity::pads_connected, "net"_a,
+            "(pads on the net's largest pad component, pads on the net).")
+        .def_prop_ro("board", &CopperConnectivity::board);
+
+    // Creepage matrix over a shared slot visibility graph
+    nb::class_<CreepageOutline>(m, "CreepageOutline")
+        .def(nb::init<>())
+        .def_rw("edge_x1", &CreepageOutline::edge_x1)
+        .def_rw("edge_y1", &CreepageOutline::edge_y1)
+        .def_rw("edge_x2", &CreepageOutline::edge_x2)
+        .def_rw("edge_y2", &CreepageOutline::edge_y2)
+        .def_rw("slot_offsets", &CreepageOutline::slot_offsets)
+        .def_rw("slot_x", &CreepageOutline::slot_x)
+        .def_rw("slot_y", &CreepageOutline::slot_y);
+
+    nb::class_<CreepageRules>(m, "CreepageRules")
+        .def(nb::init<>())
+        .def_rw("interior_shrink", &CreepageRules::interior_shrink)
+        .def_rw("num_threads", &CreepageRules::num_threads);
+
+    nb::class_<CreepageMatrix>(m, "CreepageMatrix")
+        .def_ro("sources", &CreepageMatrix::sources)
+        .def_ro("nets", &CreepageMatrix::nets)
+        .def_ro("clearance", &CreepageMatrix::clearance)
+        .def_ro("creepage", &CreepageMatrix::creepage)
+        .def_ro("layer", &CreepageMatrix::layer)
+        .def_ro("edge_clearance", &CreepageMatrix::edge_clearance)
+        .def_ro("edge_creepage", &CreepageMatrix::edge_creepage);
+
+    m.def("creepage_matrix", &creepage_matrix, "board"_a, "outline"_a, "sources"_a, "rules"_a,
+        nb::call_guard<nb::gil_scoped_release>(),
+        "Creepage from each source net to every net with copper.\n\n"
+        "Builds the slot-corner visibility graph once and runs one\n"
+        "shortest-path search per source net and layer, spread over\n"
+        "rules.num_threads workers.\n\n"
+        "Args:\n"
+        "    board: CopperBoard with every segment, via, pad and zone fill\n"
+        "    outline: CreepageOutline edge linework and slot rings\n"
+        "    sources: Source nets (rows of the matrix)\n"
+        "    rules: CreepageRules slot interior shrink and thread count\n\n"
+        "Returns:\n"
+        "    CreepageMatrix, row-major sources x nets, +inf where a pair\n"
+        "    shares no layer"
+    );
+
+    // Zone fill clearance carving
+    nb::enum_<FillStatus>(m, "FillStatus", nb::is_arithmetic())
+        .value("UNCHANGED", FILL_UNCHANGED)
+        .value("CARVED", FILL_CARVED)
+        .value("KEPT", FILL_KEPT)
+        .value("UNSUPPORTED", FILL_UNSUPPORTED);
+
+    nb::class_<ZoneFillJob>(m, "ZoneFillJob")
+        .def(nb::init<>())
+        .def_rw("fill_offsets", &ZoneFillJob::fill_offsets)
+        .def_rw("fill_x", &ZoneFillJob::fill_x)
+        .def_rw("fill_y", &ZoneFillJob::fill_y)
+        .def_rw("fill_layer", &ZoneFillJob::fill_layer)
+        .def_rw("fill_net", &ZoneFillJob::fill_net)
+        .def_rw("fill_antipad", &ZoneFillJob::fill_antipad)
+        .def_rw("obstacles", &ZoneFillJob::obstacles)
+        .def_rw("obstacle_layers", &ZoneFillJob::obstacle_layers)
+        .def_rw("obstacle_net", &ZoneFillJob::obstacle_net)
+        .def_rw("obstacle_cuts", &ZoneFillJob::obstacle_cuts);
+
+    nb::class_<ZoneFillRules>(m, "ZoneFillRules")
+        .def(nb::init<>())
+        .def_rw("slit_width", &ZoneFillRules::slit_width)
+        .def_rw("area_epsilon", &ZoneFillRules::area_epsilon)
+        .def_rw("arc_segments", &ZoneFillRules::arc_segments)
+        .def_rw("num_threads", &ZoneFillRules::num_threads);
+
+    nb::class_<ZoneFillResult>(m, "ZoneFillResult")
+        .def_ro("status", &ZoneFillResult::status)
+        .def_ro("fill_rings", &ZoneFillResult::fill_rings)
+        .def_ro("ring_offsets", &ZoneFillResult::ring_offsets)
+        .def_ro("ring_x", &ZoneFillResult::ring_x)
+        .def_ro("ring_y", &ZoneFillResult::ring_y);
+
+    m.def("carve_zone_fills", &carve_zone_fills, "job"_a, "rules"_a,
+        nb::call_guard<nb::gil_scoped_release>(),
+        "Carve foreign-net antipads out of every zone fill.\n\n"
+        "Each fill is clipped against all other-net obstacles on its layer\n"
+        "in one boolean pass, its holes vented and its islands filtered;\n"
+        "fills are spread over rules.num_threads workers.\n\n"
+        "Args:\n"
+        "    job: ZoneFillJob fill rings and obstacle PadShapes\n"
+        "    rules: ZoneFillRules slit width, area epsilon, arc segments and\n"
+        "        thread count\n\n"
+        "Returns:\n"
+        "    ZoneFillResult: a FillStatus per fill, and the rings of every\n"
+        "    CARVED fill"
+    );
+
+    // SIMD dispatch for the check_pair_clearance inner loop
+    nb::enum_<SimdLevel>(m, "SimdLevel", nb::is_arithmetic())
+        .value("SCALAR", SIMD_SCALAR)
+        .value("SSE2", SIMD_SSE2)
+        .value("AVX2", SIMD_AVX2)
+        .value("AVX512", SIMD_AVX512);
+
+    m.def("detect_simd_level", &detect_simd_level,
+        "Widest pad-pair kernel this CPU supports.");
+    m.def("simd_level", &active_simd_level,
+        "Pad-pair kernel check_pair_clearance currently runs.");
+    m.def("set_simd_level", &set_simd_level, "level"_a,
+        "Force the pad-pair kernel (clamped to detect_simd_level()).\n\n"
+        "Every level returns bit-identical minimums and pad indices; this\n"
+        "exists for benchmarks and cross-checks.\n\n"
+        "Returns:\n"
+        "    The level now active");
+
     // Version info
-    m.def("version", []() { return "1.0.0"; });
+    m.def("version", []() { return "1.10.0"; });
     m.def("is_available", []() { return true; });
 }
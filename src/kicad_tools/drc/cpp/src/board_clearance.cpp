@@ -0,0 +1,234 @@
+/*
+ * DRC Clearance C++ Core - whole-board pad clearance sweep
+ *
+ * See board_clearance.hpp.  The per-pair arithmetic (float transforms,
+ * dx = pad2 - pad1, clearance = sqrt(d^2) - (r1 + r2), first minimum in
+ * pad1-major order) matches check_pair_clearance() exactly.
+ */
+
+#include "board_clearance.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace drc {
+
+namespace {
+
+struct Box {
+    float min_x, min_y, max_x, max_y;
+};
+
+struct Candidate {
+    int fp1, fp2;
+    int pad1, pad2;  // board-wide pad indices
+    float clearance;
+};
+
+constexpr size_t kChunk = 256;
+
+} // namespace
+
+std::vector<BoardClearanceViolation> check_board_clearance(
+    const BoardPads& pads,
+    const FootprintTransforms& transforms,
+    const BoardClearanceRules& rules
+) {
+    const size_t n = pads.local_x.size();
+    if (pads.local_y.size() != n || pads.width.size() != n ||
+        pads.height.size() != n || pads.net.size() != n) {
+        throw std::invalid_argument("check_board_clearance: pad arrays differ in length");
+    }
+    const size_t n_fp = transforms.x.size();
+    if (transforms.y.size() != n_fp || transforms.rotation_rad.size() != n_fp ||
+        pads.footprint_offsets.size() != n_fp + 1 ||
+        pads.footprint_offsets.front() != 0 ||
+        static_cast<size_t>(pads.footprint_offsets.back()) != n) {
+        throw std::invalid_argument(
+            "check_board_clearance: footprint_offsets must be 0..n_pads with one "
+            "entry per footprint plus the end");
+    }
+    for (size_t f = 0; f < n_fp; ++f) {
+        if (pads.footprint_offsets[f] > pads.footprint_offsets[f + 1]) {
+            throw std::invalid_argument("check_board_clearance: footprint_offsets not sorted");
+        }
+    }
+
+    std::vector<BoardClearanceViolation> violations;
+    if (n == 0) return violations;
+
+    // --- Transform every pad once ------------------------------------------
+    std::vector<float> abs_x(n), abs_y(n), radius(n);
+    std::vector<int> owner(n);
+    std::vector<Box> fp_box(n_fp, Box{std::numeric_limits<float>::infinity(),
+                                      std::numeric_limits<float>::infinity(),
+                                      -std::numeric_limits<float>::infinity(),
+                                      -std::numeric_limits<float>::infinity()});
+    float sum_diameter = 0.0f;
+    for (size_t f = 0; f < n_fp; ++f) {
+        const float cos_a = std::cos(transforms.rotation_rad[f]);
+        const float sin_a = std::sin(transforms.rotation_rad[f]);
+        Box& box = fp_box[f];
+        for (int i = pads.footprint_offsets[f]; i < pads.footprint_offsets[f + 1]; ++i) {
+            const float lx = pads.local_x[i];
+            const float ly = pads.local_y[i];
+            abs_x[i] = transforms.x[f] + lx * cos_a - ly * sin_a;
+            abs_y[i] = transforms.y[f] + lx * sin_a + ly * cos_a;
+            radius[i] = std::max(pads.width[i], pads.height[i]) / 2.0f;
+            owner[i] = static_cast<int>(f);
+            // Footprint box from the unrotated pad rectangles, as
+            // IncrementalDRC._compute_footprint_bounds builds it.
+            box.min_x = std::min(box.min_x, abs_x[i] - pads.width[i] / 2);
+            box.min_y = std::min(box.min_y, abs_y[i] - pads.height[i] / 2);
+            box.max_x = std::max(box.max_x, abs_x[i] + pads.width[i] / 2);
+            box.max_y = std::max(box.max_y, abs_y[i] + pads.height[i] / 2);
+            sum_diameter += 2.0f * radius[i];
+        }
+    }
+
+    const float threshold = rules.min_clearance - rules.epsilon;  // violation: < threshold
+    const float reach = std::max(0.0f, threshold);
+    const float margin = rules.min_clearance;
+    auto candidate_pair = [&](int f1, int f2) {
+        const Box& a = fp_box[f1];
+        const Box& b = fp_box[f2];
+        return !(a.max_x + margin < b.min_x || a.min_x - margin > b.max_x ||
+                 a.max_y + margin < b.min_y || a.min_y - margin > b.max_y);
+    };
+
+    // --- Uniform grid over pad bounding circles ------------------------------
+    float x0 = std::numeric_limits<float>::infinity(), y0 = x0;
+    float x1 = -std::numeric_limits<float>::infinity(), y1 = x1;
+    for (size_t i = 0; i < n; ++i) {
+        x0 = std::min(x0, abs_x[i] - radius[i]);
+        y0 = std::min(y0, abs_y[i] - radius[i]);
+        x1 = std::max(x1, abs_x[i] + radius[i]);
+        y1 = std::max(y1, abs_y[i] + radius[i]);
+    }
+    float cell = std::max(sum_diameter / static_cast<float>(n) + reach, 0.05f);
+    // Keep the grid to a few cells per pad on sparse boards.
+    const float area = std::max((x1 - x0) * (y1 - y0), 1e-6f);
+    cell = std::max(cell, std::sqrt(area / (4.0f * static_cast<float>(n))));
+    const int cols = std::max(1, static_cast<int>((x1 - x0) / cell) + 1);
+    const int rows = std::max(1, static_cast<int>((y1 - y0) / cell) + 1);
+    auto col_of = [&](float x) {
+        return std::clamp(static_cast<int>((x - x0) / cell), 0, cols - 1);
+    };
+    auto row_of = [&](float y) {
+        return std::clamp(static_cast<int>((y - y0) / cell), 0, rows - 1);
+    };
+
+    // CSR buckets: count, prefix-sum, fill.
+    std::vector<int> bucket_start(static_cast<size_t>(cols) * rows + 1, 0);
+    for (size_t i = 0; i < n; ++i) {
+        for (int r = row_of(abs_y[i] - radius[i]); r <= row_of(abs_y[i] + radius[i]); ++r) {
+            for (int c = col_of(abs_x[i] - radius[i]); c <= col_of(abs_x[i] + radius[i]); ++c) {
+                ++bucket_start[static_cast<size_t>(r) * cols + c + 1];
+            }
+        }
+    }
+    for (size_t b = 1; b < bucket_start.size(); ++b) bucket_start[b] += bucket_start[b - 1];
+    std::vector<int> bucket_items(bucket_start.back());
+    {
+        std::vector<int> fill(bucket_start.begin(), bucket_start.end() - 1);
+        for (size_t i = 0; i < n; ++i) {
+            for (int r = row_of(abs_y[i] - radius[i]); r <= row_of(abs_y[i] + radius[i]); ++r) {
+                for (int c = col_of(abs_x[i] - radius[i]); c <= col_of(abs_x[i] + radius[i]);
+                     ++c) {
+                    bucket_items[fill[static_cast<size_t>(r) * cols + c]++] = static_cast<int>(i);
+                }
+            }
+        }
+    }
+
+    // --- Narrow phase, pads in parallel chunks -------------------------------
+    size_t threads = rules.num_threads > 0
+        ? static_cast<size_t>(rules.num_threads)
+        : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, (n + kChunk - 1) / kChunk));
+    std::vector<std::vector<Candidate>> found(threads);
+    std::atomic<size_t> next{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+
+    auto work = [&](size_t t) {
+        try {
+            std::vector<int> seen(n, -1);
+            std::vector<Candidate>& out = found[t];
+            for (size_t start = next.fetch_add(kChunk); start < n; start = next.fetch_add(kChunk)) {
+                const size_t end = std::min(n, start + kChunk);
+                for (size_t i = start; i < end; ++i) {
+                    const int f1 = owner[i];
+                    const float ax = abs_x[i], ay = abs_y[i], r1 = radius[i];
+                    const int net1 = pads.net[i];
+                    const float grow = r1 + reach;
+                    for (int r = row_of(ay - grow); r <= row_of(ay + grow); ++r) {
+                        for (int c = col_of(ax - grow); c <= col_of(ax + grow); ++c) {
+                            const size_t b = static_cast<size_t>(r) * cols + c;
+                            for (int k = bucket_start[b]; k < bucket_start[b + 1]; ++k) {
+                                const int j = bucket_items[k];
+                                if (seen[j] == static_cast<int>(i)) continue;
+                                seen[j] = static_cast<int>(i);
+                                const int f2 = owner[j];
+                                if (f2 <= f1) continue;  // each footprint pair once
+                                // Same-net pads may touch; net 0 is unconnected.
+                                if (net1 == pads.net[j] && net1 != 0) continue;
+                                if (!candidate_pair(f1, f2)) continue;
+                                const float dx = abs_x[j] - ax;
+                                const float dy = abs_y[j] - ay;
+                                const float r_sum = r1 + radius[j];
+                                const float clearance = std::sqrt(dx * dx + dy * dy) - r_sum;
+                                if (clearance < threshold) {
+                                    out.push_back({f1, f2, static_cast<int>(i), j, clearance});
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failure_mutex);
+            if (!failure) failure = std::current_exception();
+            next.store(n);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(work, t);
+    work(0);
+    for (std::thread& th : pool) th.join();
+    if (failure) std::rethrow_exception(failure);
+
+    // --- Worst pad pair per footprint pair -----------------------------------
+    std::vector<Candidate> all;
+    for (auto& part : found) all.insert(all.end(), part.begin(), part.end());
+    // Ties keep the first pad pair in pad1-major order, as the pair kernel.
+    std::sort(all.begin(), all.end(), [](const Candidate& a, const Candidate& b) {
+        if (a.fp1 != b.fp1) return a.fp1 < b.fp1;
+        if (a.fp2 != b.fp2) return a.fp2 < b.fp2;
+        if (a.clearance != b.clearance) return a.clearance < b.clearance;
+        if (a.pad1 != b.pad1) return a.pad1 < b.pad1;
+        return a.pad2 < b.pad2;
+    });
+    for (size_t k = 0; k < all.size(); ++k) {
+        const Candidate& c = all[k];
+        if (k > 0 && all[k - 1].fp1 == c.fp1 && all[k - 1].fp2 == c.fp2) continue;
+        BoardClearanceViolation v;
+        v.footprint1 = c.fp1;
+        v.footprint2 = c.fp2;
+        v.pad1_index = c.pad1 - pads.footprint_offsets[c.fp1];
+        v.pad2_index = c.pad2 - pads.footprint_offsets[c.fp2];
+        v.min_clearance = c.clearance;
+        v.location_x = (abs_x[c.pad1] + abs_x[c.pad2]) / 2.0f;
+        v.location_y = (abs_y[c.pad1] + abs_y[c.pad2]) / 2.0f;
+        violations.push_back(v);
+    }
+    return violations;
+}
+
+} // namespace drc
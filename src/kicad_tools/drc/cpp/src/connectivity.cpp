@@ -0,0 +1,409 @@
+/*
+ * DRC Clearance C++ Core - copper connectivity and different-net shorts
+ *
+ * See connectivity.hpp.  Every touching same-net pair is kept as a join,
+ * not just the ones that merged two components, so remove_net() can
+ * rebuild the union-find by replaying the surviving joins without
+ * re-measuring any copper.
+ */
+
+#include "connectivity.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+namespace drc {
+
+namespace {
+
+// Items covering more cells than this live in a per-layer list instead.
+constexpr long long kMaxCells = 256;
+
+bool short_before(const CopperShort& x, const CopperShort& y) {
+    return std::tie(x.type1, x.index1, x.type2, x.index2) < std::tie(y.type1, y.index1, y.type2, y.index2);
+}
+
+template <typename T>
+void append(std::vector<T>& to, const std::vector<T>& from) {
+    to.insert(to.end(), from.begin(), from.end());
+}
+
+} // namespace
+
+CopperConnectivity::CopperConnectivity(CopperBoard board, ConnectivityRules rules)
+    : board_(std::move(board)), rules_(rules) {
+    validate_copper_board(board_, "CopperConnectivity");
+    if (board_.zone_offsets.empty()) board_.zone_offsets.push_back(0);
+    reach_ = std::max(rules_.tolerance, rules_.short_clearance);
+    big_.resize(static_cast<size_t>(board_.num_layers));
+
+    // Cells sized to the typical track, via and pad; fills go to big_.
+    double sum_extent = 0.0;
+    size_t count = 0;
+    for (size_t i = 0; i < board_.seg_x1.size(); ++i) {
+        sum_extent += std::max(std::abs(board_.seg_x2[i] - board_.seg_x1[i]),
+                               std::abs(board_.seg_y2[i] - board_.seg_y1[i])) + board_.seg_width[i];
+        ++count;
+    }
+    for (double size : board_.via_size) {
+        sum_extent += size;
+        ++count;
+    }
+    for (const PadShape& pad : board_.pads) {
+        sum_extent += 2.0 * bounding_radius(pad);
+        ++count;
+    }
+    if (count > 0) cell_ = std::clamp(sum_extent / static_cast<double>(count) + reach_, 0.1, 10.0);
+
+    add_items(0, 0, 0, 0);
+    link(0, nullptr);
+}
+
+void CopperConnectivity::add_items(size_t first_seg, size_t first_via, size_t first_pad, size_t first_zone) {
+    const CopperBoard& b = board_;
+    ids_[COPPER_SEGMENT].resize(b.seg_x1.size(), -1);
+    ids_[COPPER_VIA].resize(b.via_x.size(), -1);
+    ids_[COPPER_PAD].resize(b.pads.size(), -1);
+    ids_[COPPER_ZONE].resize(b.zone_layer.size(), -1);
+
+    // Tracks as stadiums, as check_copper_drc measures them.
+    for (size_t i = first_seg; i < b.seg_x1.size(); ++i) {
+        add(COPPER_SEGMENT, static_cast<int>(i), b.seg_net[i], uint64_t{1} << b.seg_layer[i],
+            copper_item_shape(b, COPPER_SEGMENT, i));
+    }
+    for (size_t i = first_via; i < b.via_x.size(); ++i) {
+        add(COPPER_VIA, static_cast<int>(i), b.via_net[i], b.via_layers[i], copper_item_shape(b, COPPER_VIA, i));
+    }
+    for (size_t i = first_pad; i < b.pads.size(); ++i) {
+        add(COPPER_PAD, static_cast<int>(i), b.pad_net[i], b.pad_layers[i], b.pads[i]);
+        if (b.pad_net[i] != 0) net_pads_[b.pad_net[i]].push_back(static_cast<int>(i));
+    }
+    for (size_t k = first_zone; k < b.zone_layer.size(); ++k) {
+        if (b.zone_offsets[k + 1] - b.zone_offsets[k] < 3) continue;
+        add(COPPER_ZONE, static_cast<int>(k), b.zone_net[k], uint64_t{1} << b.zone_layer[k],
+            copper_item_shape(b, COPPER_ZONE, k));
+    }
+}
+
+void CopperConnectivity::add(int type, int index, int net, uint64_t layers, PadShape shape) {
+    Item item{type, index, net, layers, 0.0, 0.0, 0.0, 0.0, true};
+    if (type == COPPER_ZONE) {
+        item.min_x = *std::min_element(shape.polygon_x.begin(), shape.polygon_x.end());
+        item.max_x = *std::max_element(shape.polygon_x.begin(), shape.polygon_x.end());
+        item.min_y = *std::min_element(shape.polygon_y.begin(), shape.polygon_y.end());
+        item.max_y = *std::max_element(shape.polygon_y.begin(), shape.polygon_y.end());
+    } else {
+        const double r = bounding_radius(shape);
+        item.min_x = shape.x - r;
+        item.max_x = shape.x + r;
+        item.min_y = shape.y - r;
+        item.max_y = shape.y + r;
+    }
+    if (board_.num_layers < 64) item.layers &= (uint64_t{1} << board_.num_layers) - 1;
+
+    const int id = static_cast<int>(items_.size());
+    ids_[type][index] = id;
+    items_.push_back(item);
+    shapes_.push_back(std::move(shape));
+    parent_.push_back(id);
+    size_.push_back(1);
+    grid_insert(id);
+}
+
+uint64_t CopperConnectivity::cell_key(int layer, int col, int row) const {
+    constexpr uint64_t mask = (uint64_t{1} << 29) - 1;
+    return (static_cast<uint64_t>(layer) << 58) | ((static_cast<uint64_t>(col) & mask) << 29) |
+           (static_cast<uint64_t>(row) & mask);
+}
+
+bool CopperConnectivity::in_big_list(const Item& item) const {
+    const long long cols = static_cast<long long>(std::floor(item.max_x / cell_) - std::floor(item.min_x / cell_)) + 1;
+    const long long rows = static_cast<long long>(std::floor(item.max_y / cell_) - std::floor(item.min_y / cell_)) + 1;
+    return cols * rows > kMaxCells;
+}
+
+void CopperConnectivity::grid_insert(int id) {
+    const Item& item = items_[id];
+    const bool big = in_big_list(item);
+    const int c0 = static_cast<int>(std::floor(item.min_x / cell_)), c1 = static_cast<int>(std::floor(item.max_x / cell_));
+    const int r0 = static_cast<int>(std::floor(item.min_y / cell_)), r1 = static_cast<int>(std::floor(item.max_y / cell_));
+    for (int layer = 0; layer < board_.num_layers; ++layer) {
+        if (!(item.layers >> layer & 1)) continue;
+        if (big) {
+            big_[layer].push_back(id);
+            continue;
+        }
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) cells_[cell_key(layer, c, r)].push_back(id);
+        }
+    }
+}
+
+void CopperConnectivity::grid_erase(int id) {
+    const Item& item = items_[id];
+    auto drop = [id](std::vector<int>& ids) { ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end()); };
+    const bool big = in_big_list(item);
+    const int c0 = static_cast<int>(std::floor(item.min_x / cell_)), c1 = static_cast<int>(std::floor(item.max_x / cell_));
+    const int r0 = static_cast<int>(std::floor(item.min_y / cell_)), r1 = static_cast<int>(std::floor(item.max_y / cell_));
+    for (int layer = 0; layer < board_.num_layers; ++layer) {
+        if (!(item.layers >> layer & 1)) continue;
+        if (big) {
+            drop(big_[layer]);
+            continue;
+        }
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                auto it = cells_.find(cell_key(layer, c, r));
+                if (it == cells_.end()) continue;
+                drop(it->second);
+                if (it->second.empty()) cells_.erase(it);
+            }
+        }
+    }
+}
+
+int CopperConnectivity::find(int id) const {
+    while (parent_[id] != id) {
+        parent_[id] = parent_[parent_[id]];
+        id = parent_[id];
+    }
+    return id;
+}
+
+void CopperConnectivity::unite(int a, int b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) return;
+    if (size_[a] < size_[b]) std::swap(a, b);
+    parent_[b] = a;
+    size_[a] += size_[b];
+}
+
+CopperShort CopperConnectivity::make_short(int a, int b, double clearance, double x, double y) const {
+    const Item* first = &items_[a];
+    const Item* second = &items_[b];
+    if (std::tie(second->type, second->index) < std::tie(first->type, first->index)) std::swap(first, second);
+    CopperShort s;
+    const uint64_t shared = first->layers & second->layers;
+    for (int layer = 0; layer < 64; ++layer) {
+        if (shared >> layer & 1) {
+            s.layer = layer;
+            break;
+        }
+    }
+    s.type1 = first->type;
+    s.index1 = first->index;
+    s.type2 = second->type;
+    s.index2 = second->index;
+    s.clearance = clearance;
+    s.location_x = x;
+    s.location_y = y;
+    return s;
+}
+
+// Measure the new items [first_new, end) against everything already
+// linked and against each other (each pair once).
+void CopperConnectivity::link(size_t first_new, std::vector<CopperShort>* found) {
+    const double short_below = rules_.short_clearance - rules_.tolerance;
+    seen_.resize(items_.size(), -1);  // every item is linked once, so its id is the stamp
+    for (size_t a = first_new; a < items_.size(); ++a) {
+        const Item& ia = items_[a];
+        if (!ia.alive || ia.net == 0) continue;
+
+        auto visit = [&](int b) {
+            if (static_cast<size_t>(b) >= first_new && static_cast<size_t>(b) <= a) return;
+            if (seen_[b] == static_cast<int>(a)) return;
+            seen_[b] = static_cast<int>(a);
+            const Item& ib = items_[b];
+            if (!ib.alive || ib.net == 0 || !(ia.layers & ib.layers)) return;
+            if (ib.min_x - ia.max_x > reach_ || ia.min_x - ib.max_x > reach_ ||
+                ib.min_y - ia.max_y > reach_ || ia.min_y - ib.max_y > reach_) {
+                return;
+            }
+            const ShapeClearance c = pad_shape_clearance(shapes_[a], shapes_[b]);
+            if (ia.net == ib.net) {
+                if (c.clearance < rules_.tolerance) {
+                    unite(static_cast<int>(a), b);
+                    joins_.emplace_back(static_cast<int>(a), b);
+                }
+            } else if (c.clearance < short_below) {
+                const CopperShort s = make_short(static_cast<int>(a), b, c.clearance, c.location_x, c.location_y);
+                shorts_.push_back({static_cast<int>(a), b, s});
+                if (found) found->push_back(s);
+            }
+        };
+
+        const int c0 = static_cast<int>(std::floor((ia.min_x - reach_) / cell_));
+        const int c1 = static_cast<int>(std::floor((ia.max_x + reach_) / cell_));
+        const int r0 = static_cast<int>(std::floor((ia.min_y - reach_) / cell_));
+        const int r1 = static_cast<int>(std::floor((ia.max_y + reach_) / cell_));
+        const bool scan_cells = static_cast<long long>(c1 - c0 + 1) * (r1 - r0 + 1) <= kMaxCells;
+        for (int layer = 0; layer < board_.num_layers; ++layer) {
+            if (!(ia.layers >> layer & 1)) continue;
+            for (int b : big_[layer]) visit(b);
+            if (scan_cells) {
+                for (int r = r0; r <= r1; ++r) {
+                    for (int c = c0; c <= c1; ++c) {
+                        auto it = cells_.find(cell_key(layer, c, r));
+                        if (it == cells_.end()) continue;
+                        for (int b : it->second) visit(b);
+                    }
+                }
+            } else {
+                // A fill-sized item: walking the occupied cells is cheaper.
+                for (const auto& [key, ids] : cells_) {
+                    if (static_cast<int>(key >> 58) != layer) continue;
+                    for (int b : ids) visit(b);
+                }
+            }
+        }
+    }
+}
+
+std::vector<CopperShort> CopperConnectivity::commit(const CopperBoard& route) {
+    validate_copper_board(route, "CopperConnectivity.commit");
+    if (!route.pads.empty()) {
+        throw std::invalid_argument("CopperConnectivity.commit: routes cannot add pads");
+    }
+    if (route.num_layers != board_.num_layers) {
+        throw std::invalid_argument("CopperConnectivity.commit: route has a different layer count");
+    }
+
+    const size_t first_seg = board_.seg_x1.size();
+    const size_t first_via = board_.via_x.size();
+    const size_t first_zone = board_.zone_layer.size();
+    const size_t first_new = items_.size();
+
+    append(board_.seg_x1, route.seg_x1);
+    append(board_.seg_y1, route.seg_y1);
+    append(board_.seg_x2, route.seg_x2);
+    append(board_.seg_y2, route.seg_y2);
+    append(board_.seg_width, route.seg_width);
+    append(board_.seg_layer, route.seg_layer);
+    append(board_.seg_net, route.seg_net);
+    append(board_.via_x, route.via_x);
+    append(board_.via_y, route.via_y);
+    append(board_.via_size, route.via_size);
+    append(board_.via_drill, route.via_drill);
+    append(board_.via_layers, route.via_layers);
+    append(board_.via_explicit_layers, route.via_explicit_layers);
+    append(board_.via_net, route.via_net);
+    const int base = board_.zone_offsets.back();
+    for (size_t k = 1; k < route.zone_offsets.size(); ++k) {
+        board_.zone_offsets.push_back(base + route.zone_offsets[k]);
+    }
+    append(board_.zone_x, route.zone_x);
+    append(board_.zone_y, route.zone_y);
+    append(board_.zone_layer, route.zone_layer);
+    append(board_.zone_net, route.zone_net);
+
+    add_items(first_seg, first_via, board_.pads.size(), first_zone);
+    std::vector<CopperShort> found;
+    link(first_new, &found);
+    std::sort(found.begin(), found.end(), short_before);
+    return found;
+}
+
+void CopperConnectivity::remove_net(int net) {
+    std::vector<char> dead(items_.size(), 0);
+    for (size_t id = 0; id < items_.size(); ++id) {
+        Item& item = items_[id];
+        if (!item.alive || item.net != net || (item.type != COPPER_SEGMENT && item.type != COPPER_VIA)) continue;
+        grid_erase(static_cast<int>(id));
+        item.alive = false;
+        dead[id] = 1;
+    }
+
+    auto gone = [&](int a, int b) { return dead[a] || dead[b]; };
+    joins_.erase(std::remove_if(joins_.begin(), joins_.end(),
+                                [&](const std::pair<int, int>& j) { return gone(j.first, j.second); }),
+                 joins_.end());
+    shorts_.erase(std::remove_if(shorts_.begin(), shorts_.end(),
+                                 [&](const Short& s) { return gone(s.a, s.b); }),
+                  shorts_.end());
+
+    for (size_t id = 0; id < items_.size(); ++id) {
+        parent_[id] = static_cast<int>(id);
+        size_[id] = 1;
+    }
+    for (const auto& [a, b] : joins_) unite(a, b);
+}
+
+std::vector<CopperShort> CopperConnectivity::shorts() const {
+    std::vector<CopperShort> out;
+    out.reserve(shorts_.size());
+    for (const Short& s : shorts_) out.push_back(s.info);
+    std::sort(out.begin(), out.end(), short_before);
+    return out;
+}
+
+int CopperConnectivity::component(int type, int index) const {
+    if (type < COPPER_SEGMENT || type > COPPER_ZONE) {
+        throw std::out_of_range("CopperConnectivity.component: unknown item type");
+    }
+    const int id = ids_[type].at(index);
+    if (id < 0 || !items_[id].alive || items_[id].net == 0) return -1;
+    return find(id);
+}
+
+std::pair<int, int> CopperConnectivity::pads_connected(int net) const {
+    const auto it = net_pads_.find(net);
+    if (it == net_pads_.end()) return {0, 0};
+    const std::vector<int>& pads = it->second;
+    const int total = static_cast<int>(pads.size());
+    if (total < 2) return {total, total};
+    std::unordered_map<int, int> per_component;
+    int best = 0;
+    for (int pad : pads) best = std::max(best, ++per_component[find(ids_[COPPER_PAD][pad])]);
+    return {best, total};
+}
+
+ConnectivityReport CopperConnectivity::report() const {
+    ConnectivityReport out;
+    out.shorts = shorts();
+
+    std::vector<char> has_pad(items_.size(), 0);
+    std::vector<int> nets;
+    nets.reserve(net_pads_.size());
+    for (const auto& entry : net_pads_) nets.push_back(entry.first);
+    std::sort(nets.begin(), nets.end());
+
+    for (int net : nets) {
+        const std::vector<int>& pads = net_pads_.at(net);
+        // Components in order of their first pad; the main one holds the
+        // most pads, the earliest winning a tie.
+        std::vector<std::pair<int, int>> counts;  // (component, pads)
+        for (int pad : pads) {
+            const int root = find(ids_[COPPER_PAD][pad]);
+            has_pad[root] = 1;
+            auto it = std::find_if(counts.begin(), counts.end(), [root](const auto& c) { return c.first == root; });
+            if (it == counts.end()) {
+                counts.emplace_back(root, 1);
+            } else {
+                ++it->second;
+            }
+        }
+        if (counts.size() < 2) continue;
+        out.incomplete_nets.push_back(net);
+        const auto main = std::max_element(counts.begin(), counts.end(),
+                                           [](const auto& x, const auto& y) { return x.second < y.second; });
+        for (int pad : pads) {
+            if (find(ids_[COPPER_PAD][pad]) != main->first) out.stranded_pads.push_back(pad);
+        }
+    }
+    std::sort(out.stranded_pads.begin(), out.stranded_pads.end());
+
+    for (int type : {COPPER_SEGMENT, COPPER_VIA, COPPER_ZONE}) {
+        for (int id : ids_[type]) {
+            if (id < 0 || !items_[id].alive || items_[id].net == 0 || has_pad[find(id)]) continue;
+            out.island_type.push_back(type);
+            out.island_index.push_back(items_[id].index);
+        }
+    }
+    return out;
+}
+
+} // namespace drc
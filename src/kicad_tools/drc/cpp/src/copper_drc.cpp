@@ -0,0 +1,651 @@
+/*
+ * DRC Clearance C++ Core - unified copper DRC engine
+ *
+ * See copper_drc.hpp.  The pair rules mirror ClearanceRule._check_layer
+ * (same-net and net-0 skips, via pairs only on declared via layers,
+ * segment-end-on-via-centre colocation, diff-pair segment exemption) and
+ * its geometry, so the engine reports what the Python rules report.
+ * The router's float segment kernels run on coordinates relative to the
+ * board's lower-left corner to keep their precision on large boards.
+ */
+
+#include "copper_drc.hpp"
+
+#include "geometry.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <numbers>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+
+namespace drc {
+
+namespace {
+
+/// One item in a layer's index.  ``hole`` entries stand for the drill of
+/// the via or pad ``index``.
+struct Entry {
+    int type;
+    int index;
+    bool hole;
+    int net;
+    double min_x, min_y, max_x, max_y;
+};
+
+struct LayerIndex {
+    std::vector<Entry> entries;
+    double x0 = 0.0, y0 = 0.0, cell = 1.0;
+    int cols = 1, rows = 1;
+    std::vector<int> bucket_start;
+    std::vector<int> bucket_items;
+
+    int col_of(double x) const {
+        return std::clamp(static_cast<int>((x - x0) / cell), 0, cols - 1);
+    }
+    int row_of(double y) const {
+        return std::clamp(static_cast<int>((y - y0) / cell), 0, rows - 1);
+    }
+};
+
+constexpr size_t kChunk = 128;
+
+template <typename T>
+void require_size(const char* caller, const std::vector<T>& v, size_t n, const char* what) {
+    if (v.size() != n) {
+        throw std::invalid_argument(std::string(caller) + ": " + what + " arrays differ in length");
+    }
+}
+
+// Axis-aligned size of a rotated pad, as validate.rules.clearance.
+// _transform_pad_dimensions computes it (cardinal angles swap exactly).
+void pad_aabb_size(const PadShape& pad, double& w, double& h) {
+    double deg = std::fmod(pad.rotation_rad * 180.0 / std::numbers::pi, 360.0);
+    if (deg < 0) deg += 360.0;
+    if (std::abs(deg - 90.0) < 0.001 || std::abs(deg - 270.0) < 0.001) {
+        w = pad.height;
+        h = pad.width;
+    } else if (deg < 0.001 || std::abs(deg - 180.0) < 0.001 || deg > 360.0 - 0.001) {
+        w = pad.width;
+        h = pad.height;
+    } else {
+        const double c = std::abs(std::cos(pad.rotation_rad));
+        const double s = std::abs(std::sin(pad.rotation_rad));
+        w = pad.width * c + pad.height * s;
+        h = pad.width * s + pad.height * c;
+    }
+}
+
+class Engine {
+public:
+    Engine(const CopperBoard& board, const CopperRules& rules) : b_(board), r_(rules) {}
+
+    std::vector<CopperViolation> run();
+
+private:
+    const CopperBoard& b_;
+    const CopperRules& r_;
+    double ox_ = 0.0, oy_ = 0.0;  // float-kernel origin
+    std::vector<PadShape> seg_shapes_, via_shapes_, zone_shapes_;
+    std::vector<double> pad_aabb_w_, pad_aabb_h_;
+    std::vector<uint64_t> exempt_;
+    std::vector<LayerIndex> layers_;  // copper layers, then the drill layer
+
+    void validate() const;
+    void build_shapes();
+    void build_layer(int layer, LayerIndex& index) const;
+    void index_layer(LayerIndex& index) const;
+    double reach() const;
+    void check_pair(int layer, const Entry& a, const Entry& b, std::vector<CopperViolation>& out) const;
+    bool copper_pair(int layer, const Entry& a, const Entry& b, CopperViolation& v) const;
+    bool zone_pair(const Entry& item, const Entry& zone, CopperViolation& v) const;
+    const PadShape& shape_of(const Entry& e) const;
+    double drill_of(const Entry& e) const;
+    void centre_of(const Entry& e, double& x, double& y) const;
+    bool exempt(int net1, int net2) const;
+};
+
+void Engine::validate() const {
+    validate_copper_board(b_, "check_copper_drc");
+    if (r_.exempt_net_pairs.size() % 2 != 0) {
+        throw std::invalid_argument("check_copper_drc: exempt_net_pairs must hold (a, b) pairs");
+    }
+}
+
+void Engine::build_shapes() {
+    // Float-kernel origin: the lower-left corner of all copper.
+    ox_ = std::numeric_limits<double>::infinity();
+    oy_ = ox_;
+    auto origin = [&](double x, double y) {
+        ox_ = std::min(ox_, x);
+        oy_ = std::min(oy_, y);
+    };
+    for (size_t i = 0; i < b_.seg_x1.size(); ++i) {
+        origin(b_.seg_x1[i], b_.seg_y1[i]);
+        origin(b_.seg_x2[i], b_.seg_y2[i]);
+    }
+    for (size_t i = 0; i < b_.via_x.size(); ++i) origin(b_.via_x[i], b_.via_y[i]);
+    for (const PadShape& pad : b_.pads) origin(pad.x, pad.y);
+    if (!std::isfinite(ox_)) ox_ = oy_ = 0.0;
+
+    // Tracks as stadiums and vias as discs, for the exact shape kernel.
+    seg_shapes_.resize(b_.seg_x1.size());
+    for (size_t i = 0; i < seg_shapes_.size(); ++i) {
+        const double dx = b_.seg_x2[i] - b_.seg_x1[i];
+        const double dy = b_.seg_y2[i] - b_.seg_y1[i];
+        PadShape& s = seg_shapes_[i];
+        s.kind = PAD_SHAPE_OVAL;
+        s.x = (b_.seg_x1[i] + b_.seg_x2[i]) / 2.0;
+        s.y = (b_.seg_y1[i] + b_.seg_y2[i]) / 2.0;
+        s.width = std::hypot(dx, dy) + b_.seg_width[i];
+        s.height = b_.seg_width[i];
+        s.rotation_rad = std::atan2(dy, dx);
+    }
+    via_shapes_.resize(b_.via_x.size());
+    for (size_t i = 0; i < via_shapes_.size(); ++i) {
+        PadShape& s = via_shapes_[i];
+        s.kind = PAD_SHAPE_CIRCLE;
+        s.x = b_.via_x[i];
+        s.y = b_.via_y[i];
+        s.width = s.height = b_.via_size[i];
+    }
+    zone_shapes_.resize(b_.zone_layer.size());
+    for (size_t k = 0; k < zone_shapes_.size(); ++k) {
+        PadShape& s = zone_shapes_[k];
+        s.kind = PAD_SHAPE_POLYGON;
+        s.polygon_x.assign(b_.zone_x.begin() + b_.zone_offsets[k], b_.zone_x.begin() + b_.zone_offsets[k + 1]);
+        s.polygon_y.assign(b_.zone_y.begin() + b_.zone_offsets[k], b_.zone_y.begin() + b_.zone_offsets[k + 1]);
+    }
+    pad_aabb_w_.resize(b_.pads.size());
+    pad_aabb_h_.resize(b_.pads.size());
+    for (size_t i = 0; i < b_.pads.size(); ++i) pad_aabb_size(b_.pads[i], pad_aabb_w_[i], pad_aabb_h_[i]);
+
+    for (size_t k = 0; k < r_.exempt_net_pairs.size(); k += 2) {
+        const int a = std::min(r_.exempt_net_pairs[k], r_.exempt_net_pairs[k + 1]);
+        const int c = std::max(r_.exempt_net_pairs[k], r_.exempt_net_pairs[k + 1]);
+        exempt_.push_back((static_cast<uint64_t>(static_cast<uint32_t>(a)) << 32) | static_cast<uint32_t>(c));
+    }
+    std::sort(exempt_.begin(), exempt_.end());
+}
+
+bool Engine::exempt(int net1, int net2) const {
+    const int a = std::min(net1, net2);
+    const int c = std::max(net1, net2);
+    const uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(a)) << 32) | static_cast<uint32_t>(c);
+    return std::binary_search(exempt_.begin(), exempt_.end(), key);
+}
+
+const PadShape& Engine::shape_of(const Entry& e) const {
+    switch (e.type) {
+        case COPPER_SEGMENT: return seg_shapes_[e.index];
+        case COPPER_VIA: return via_shapes_[e.index];
+        case COPPER_PAD: return b_.pads[e.index];
+        default: return zone_shapes_[e.index];
+    }
+}
+
+double Engine::drill_of(const Entry& e) const {
+    return e.type == COPPER_VIA ? b_.via_drill[e.index] : b_.pad_drill[e.index];
+}
+
+void Engine::centre_of(const Entry& e, double& x, double& y) const {
+    if (e.type == COPPER_VIA) {
+        x = b_.via_x[e.index];
+        y = b_.via_y[e.index];
+    } else {
+        x = b_.pads[e.index].x;
+        y = b_.pads[e.index].y;
+    }
+}
+
+double Engine::reach() const {
+    double reach = 0.0;
+    if (r_.checks & (CHECK_CLEARANCE | CHECK_ZONE)) reach = std::max(reach, r_.min_clearance);
+    if (r_.checks & CHECK_HOLE_TO_COPPER) reach = std::max(reach, r_.min_hole_to_copper);
+    if (r_.checks & CHECK_HOLE_TO_HOLE) reach = std::max(reach, r_.min_hole_to_hole);
+    return reach;
+}
+
+void Engine::build_layer(int layer, LayerIndex& index) const {
+    const bool drill_layer = layer == b_.num_layers;
+    const uint64_t bit = drill_layer ? 0 : (uint64_t{1} << layer);
+    const bool copper = !drill_layer && (r_.checks & (CHECK_CLEARANCE | CHECK_ZONE | CHECK_HOLE_TO_COPPER));
+    const bool holes = drill_layer ? (r_.checks & CHECK_HOLE_TO_HOLE) != 0
+                                   : (r_.checks & CHECK_HOLE_TO_COPPER) != 0;
+    auto add = [&](int type, int i, bool hole, int net, double x0, double y0, double x1, double y1) {
+        index.entries.push_back({type, i, hole, net, x0, y0, x1, y1});
+    };
+
+    if (copper) {
+        for (size_t i = 0; i < b_.seg_x1.size(); ++i) {
+            if (b_.seg_layer[i] != layer) continue;
+            const double hw = b_.seg_width[i] / 2.0;
+            add(COPPER_SEGMENT, static_cast<int>(i), false, b_.seg_net[i],
+                std::min(b_.seg_x1[i], b_.seg_x2[i]) - hw, std::min(b_.seg_y1[i], b_.seg_y2[i]) - hw,
+                std::max(b_.seg_x1[i], b_.seg_x2[i]) + hw, std::max(b_.seg_y1[i], b_.seg_y2[i]) + hw);
+        }
+    }
+    if (copper && (r_.checks & (CHECK_CLEARANCE | CHECK_ZONE))) {
+        for (size_t i = 0; i < b_.via_x.size(); ++i) {
+            if (!(b_.via_layers[i] & bit)) continue;
+            const double r = b_.via_size[i] / 2.0;
+            add(COPPER_VIA, static_cast<int>(i), false, b_.via_net[i],
+                b_.via_x[i] - r, b_.via_y[i] - r, b_.via_x[i] + r, b_.via_y[i] + r);
+        }
+        for (size_t i = 0; i < b_.pads.size(); ++i) {
+            if (!(b_.pad_layers[i] & bit)) continue;
+            const double r = bounding_radius(b_.pads[i]);
+            const PadShape& p = b_.pads[i];
+            add(COPPER_PAD, static_cast<int>(i), false, b_.pad_net[i], p.x - r, p.y - r, p.x + r, p.y + r);
+        }
+    }
+    if (copper && (r_.checks & CHECK_ZONE)) {
+        for (size_t k = 0; k < b_.zone_layer.size(); ++k) {
+            if (b_.zone_layer[k] != layer || b_.zone_offsets[k + 1] - b_.zone_offsets[k] < 3) continue;
+            double x0 = std::numeric_limits<double>::infinity(), y0 = x0, x1 = -x0, y1 = -x0;
+            for (int p = b_.zone_offsets[k]; p < b_.zone_offsets[k + 1]; ++p) {
+                x0 = std::min(x0, b_.zone_x[p]);
+                y0 = std::min(y0, b_.zone_y[p]);
+                x1 = std::max(x1, b_.zone_x[p]);
+                y1 = std::max(y1, b_.zone_y[p]);
+            }
+            add(COPPER_ZONE, static_cast<int>(k), false, b_.zone_net[k], x0, y0, x1, y1);
+        }
+    }
+    if (holes) {
+        for (size_t i = 0; i < b_.via_x.size(); ++i) {
+            if (b_.via_drill[i] <= 0 || (!drill_layer && !(b_.via_layers[i] & bit))) continue;
+            const double r = b_.via_drill[i] / 2.0;
+            add(COPPER_VIA, static_cast<int>(i), true, b_.via_net[i],
+                b_.via_x[i] - r, b_.via_y[i] - r, b_.via_x[i] + r, b_.via_y[i] + r);
+        }
+        for (size_t i = 0; i < b_.pads.size(); ++i) {
+            if (b_.pad_drill[i] <= 0) continue;  // a drill goes through every layer
+            const double r = b_.pad_drill[i] / 2.0;
+            const PadShape& p = b_.pads[i];
+            add(COPPER_PAD, static_cast<int>(i), true, b_.pad_net[i], p.x - r, p.y - r, p.x + r, p.y + r);
+        }
+    }
+    index_layer(index);
+}
+
+void Engine::index_layer(LayerIndex& index) const {
+    std::vector<Entry>& entries = index.entries;
+    const size_t n = entries.size();
+    if (n == 0) return;
+
+    double x0 = std::numeric_limits<double>::infinity(), y0 = x0, x1 = -x0, y1 = -x0;
+    double sum_extent = 0.0;
+    size_t small = 0;
+    for (const Entry& e : entries) {
+        x0 = std::min(x0, e.min_x);
+        y0 = std::min(y0, e.min_y);
+        x1 = std::max(x1, e.max_x);
+        y1 = std::max(y1, e.max_y);
+        if (e.type != COPPER_ZONE) {
+            sum_extent += std::max(e.max_x - e.min_x, e.max_y - e.min_y);
+            ++small;
+        }
+    }
+    // Cells sized to the typical non-zone item; fills just span more cells.
+    double cell = std::max((small ? sum_extent / static_cast<double>(small) : 1.0) + reach(), 0.05);
+    const double area = std::max((x1 - x0) * (y1 - y0), 1e-6);
+    cell = std::max(cell, std::sqrt(area / (4.0 * static_cast<double>(n))));
+    index.x0 = x0;
+    index.y0 = y0;
+    index.cell = cell;
+    index.cols = std::max(1, static_cast<int>((x1 - x0) / cell) + 1);
+    index.rows = std::max(1, static_cast<int>((y1 - y0) / cell) + 1);
+
+    // Tile order: chunks of consecutive entries then cover nearby copper.
+    std::stable_sort(entries.begin(), entries.end(), [&](const Entry& a, const Entry& c) {
+        const int ra = index.row_of(a.min_y), rc = index.row_of(c.min_y);
+        if (ra != rc) return ra < rc;
+        return index.col_of(a.min_x) < index.col_of(c.min_x);
+    });
+
+    // CSR buckets: count, prefix-sum, fill.
+    index.bucket_start.assign(static_cast<size_t>(index.cols) * index.rows + 1, 0);
+    for (const Entry& e : entries) {
+        for (int r = index.row_of(e.min_y); r <= index.row_of(e.max_y); ++r) {
+            for (int c = index.col_of(e.min_x); c <= index.col_of(e.max_x); ++c) {
+                ++index.bucket_start[static_cast<size_t>(r) * index.cols + c + 1];
+            }
+        }
+    }
+    for (size_t k = 1; k < index.bucket_start.size(); ++k) {
+        index.bucket_start[k] += index.bucket_start[k - 1];
+    }
+    index.bucket_items.assign(index.bucket_start.back(), 0);
+    std::vector<int> fill(index.bucket_start.begin(), index.bucket_start.end() - 1);
+    for (size_t i = 0; i < n; ++i) {
+        const Entry& e = entries[i];
+        for (int r = index.row_of(e.min_y); r <= index.row_of(e.max_y); ++r) {
+            for (int c = index.col_of(e.min_x); c <= index.col_of(e.max_x); ++c) {
+                index.bucket_items[fill[static_cast<size_t>(r) * index.cols + c]++] = static_cast<int>(i);
+            }
+        }
+    }
+}
+
+bool Engine::copper_pair(int layer, const Entry& a, const Entry& c, CopperViolation& v) const {
+    if (a.net == c.net || a.net == 0 || c.net == 0) return false;
+    const uint64_t bit = uint64_t{1} << layer;
+
+    // Via and pad geometry is layer-independent: evaluate via pairs only
+    // on the via's declared layers (issue #3487).
+    if (a.type != COPPER_SEGMENT && c.type != COPPER_SEGMENT) {
+        for (const Entry* e : {&a, &c}) {
+            if (e->type == COPPER_VIA && b_.via_explicit_layers[e->index] &&
+                !(b_.via_explicit_layers[e->index] & bit)) {
+                return false;
+            }
+        }
+    }
+
+    double clearance = 0.0, loc_x = 0.0, loc_y = 0.0;
+    if (a.type == COPPER_SEGMENT && c.type == COPPER_SEGMENT) {
+        if (exempt(a.net, c.net)) return false;  // DiffPairClearanceIntraRule's (#2560)
+        const int i = a.index, j = c.index;
+        const float dist = router::segment_to_segment_distance(
+            static_cast<float>(b_.seg_x1[i] - ox_), static_cast<float>(b_.seg_y1[i] - oy_),
+            static_cast<float>(b_.seg_x2[i] - ox_), static_cast<float>(b_.seg_y2[i] - oy_),
+            static_cast<float>(b_.seg_x1[j] - ox_), static_cast<float>(b_.seg_y1[j] - oy_),
+            static_cast<float>(b_.seg_x2[j] - ox_), static_cast<float>(b_.seg_y2[j] - oy_));
+        clearance = dist - b_.seg_width[i] / 2.0 - b_.seg_width[j] / 2.0;
+        loc_x = (b_.seg_x1[i] + b_.seg_x2[i] + b_.seg_x1[j] + b_.seg_x2[j]) / 4.0;
+        loc_y = (b_.seg_y1[i] + b_.seg_y2[i] + b_.seg_y1[j] + b_.seg_y2[j]) / 4.0;
+    } else if (a.type == COPPER_SEGMENT || c.type == COPPER_SEGMENT) {
+        const Entry& seg = a.type == COPPER_SEGMENT ? a : c;
+        const Entry& other = a.type == COPPER_SEGMENT ? c : a;
+        const int i = seg.index;
+        double cx, cy;
+        centre_of(other, cx, cy);
+        if (other.type == COPPER_VIA &&
+            (std::hypot(b_.seg_x1[i] - cx, b_.seg_y1[i] - cy) < r_.colocation_epsilon ||
+             std::hypot(b_.seg_x2[i] - cx, b_.seg_y2[i] - cy) < r_.colocation_epsilon)) {
+            return false;  // in-pad escape: the segment end IS the via (#2706)
+        }
+        const float x1 = static_cast<float>(b_.seg_x1[i] - ox_), y1 = static_cast<float>(b_.seg_y1[i] - oy_);
+        const float x2 = static_cast<float>(b_.seg_x2[i] - ox_), y2 = static_cast<float>(b_.seg_y2[i] - oy_);
+        const float fcx = static_cast<float>(cx - ox_), fcy = static_cast<float>(cy - oy_);
+        const double half = b_.seg_width[i] / 2.0;
+        double w, h;
+        if (other.type == COPPER_VIA) {
+            w = h = b_.via_size[other.index];
+        } else {
+            w = pad_aabb_w_[other.index];
+            h = pad_aabb_h_[other.index];
+        }
+        if (other.type == COPPER_VIA || std::abs(w - h) < 0.001) {
+            clearance = router::point_to_segment_distance(fcx, fcy, x1, y1, x2, y2) - half - std::max(w, h) / 2.0;
+        } else {
+            clearance = router::rect_segment_centerline_distance(
+                fcx, fcy, static_cast<float>(w), static_cast<float>(h), x1, y1, x2, y2) - half;
+        }
+        loc_x = cx;
+        loc_y = cy;
+    } else {
+        const PadShape& sa = shape_of(a);
+        const PadShape& sc = shape_of(c);
+        if ((a.type == COPPER_VIA && c.type == COPPER_VIA) || sa.width <= 0 || sa.height <= 0 ||
+            sc.width <= 0 || sc.height <= 0) {
+            // Discs (and copperless pads) between centres, as ClearanceRule's
+            // analytic via-via path.
+            clearance = std::hypot(sc.x - sa.x, sc.y - sa.y) - std::max(sa.width, sa.height) / 2.0 -
+                        std::max(sc.width, sc.height) / 2.0;
+            loc_x = (sa.x + sc.x) / 2.0;
+            loc_y = (sa.y + sc.y) / 2.0;
+        } else {
+            const ShapeClearance exact = pad_shape_clearance(sa, sc);
+            clearance = exact.clearance;
+            loc_x = exact.location_x;
+            loc_y = exact.location_y;
+        }
+    }
+
+    if (!(clearance + r_.tolerance < r_.min_clearance)) return false;
+    v.check = CHECK_CLEARANCE;
+    v.actual = clearance;
+    v.required = r_.min_clearance;
+    v.location_x = loc_x;
+    v.location_y = loc_y;
+    return true;
+}
+
+bool Engine::zone_pair(const Entry& item, const Entry& zone, CopperViolation& v) const {
+    if (item.net == zone.net || item.net == 0 || zone.net == 0) return false;
+    const ShapeClearance exact = pad_shape_clearance(shape_of(item), zone_shapes_[zone.index]);
+    if (!(exact.clearance + r_.tolerance < r_.min_clearance)) return false;
+    v.check = CHECK_ZONE;
+    v.actual = exact.clearance;
+    v.required = r_.min_clearance;
+    v.location_x = exact.location_x;
+    v.location_y = exact.location_y;
+    return true;
+}
+
+void Engine::check_pair(int layer, const Entry& a, const Entry& c, std::vector<CopperViolation>& out) const {
+    CopperViolation v;
+    bool hit = false;
+    if (layer == b_.num_layers) {
+        // Drill pseudo-layer: hole to hole, any nets.
+        double ax, ay, cx, cy;
+        centre_of(a, ax, ay);
+        centre_of(c, cx, cy);
+        const double edge = std::hypot(cx - ax, cy - ay) - drill_of(a) / 2.0 - drill_of(c) / 2.0;
+        if (edge + r_.tolerance < r_.min_hole_to_hole) {
+            v.check = CHECK_HOLE_TO_HOLE;
+            v.actual = edge;
+            v.required = r_.min_hole_to_hole;
+            v.location_x = (ax + cx) / 2.0;
+            v.location_y = (ay + cy) / 2.0;
+            hit = true;
+        }
+    } else if (a.hole || c.hole) {
+        // Drill to a foreign track on a layer the drill passes through.
+        if (a.hole == c.hole) return;
+        const Entry& hole = a.hole ? a : c;
+        const Entry& other = a.hole ? c : a;
+        if (other.type != COPPER_SEGMENT || hole.net == other.net || hole.net == 0 || other.net == 0) return;
+        double hx, hy;
+        centre_of(hole, hx, hy);
+        const int i = other.index;
+        const double edge = router::point_to_segment_distance(
+            static_cast<float>(hx - ox_), static_cast<float>(hy - oy_),
+            static_cast<float>(b_.seg_x1[i] - ox_), static_cast<float>(b_.seg_y1[i] - oy_),
+            static_cast<float>(b_.seg_x2[i] - ox_), static_cast<float>(b_.seg_y2[i] - oy_))
+            - drill_of(hole) / 2.0 - b_.seg_width[i] / 2.0;
+        if (edge + r_.tolerance < r_.min_hole_to_copper) {
+            v.check = CHECK_HOLE_TO_COPPER;
+            v.actual = edge;
+            v.required = r_.min_hole_to_copper;
+            v.location_x = hx;
+            v.location_y = hy;
+            hit = true;
+        }
+    } else if (a.type == COPPER_ZONE || c.type == COPPER_ZONE) {
+        if (a.type == c.type || !(r_.checks & CHECK_ZONE)) return;
+        hit = a.type == COPPER_ZONE ? zone_pair(c, a, v) : zone_pair(a, c, v);
+    } else if (r_.checks & CHECK_CLEARANCE) {
+        hit = copper_pair(layer, a, c, v);
+    }
+    if (!hit) return;
+
+    v.layer = layer == b_.num_layers ? -1 : layer;
+    const bool swap = std::tie(c.type, c.index) < std::tie(a.type, a.index);
+    const Entry& first = swap ? c : a;
+    const Entry& second = swap ? a : c;
+    v.type1 = first.type;
+    v.index1 = first.index;
+    v.type2 = second.type;
+    v.index2 = second.index;
+    out.push_back(v);
+}
+
+std::vector<CopperViolation> Engine::run() {
+    validate();
+    build_shapes();
+
+    layers_.resize(static_cast<size_t>(b_.num_layers) + 1);
+    for (int layer = 0; layer <= b_.num_layers; ++layer) build_layer(layer, layers_[layer]);
+
+    // Work list: chunks of each layer's tile-ordered entries.
+    struct Chunk {
+        int layer;
+        size_t start, end;
+    };
+    std::vector<Chunk> chunks;
+    std::vector<size_t> stamp_base(layers_.size(), 0);
+    size_t max_entries = 0, total = 0;
+    for (int layer = 0; layer <= b_.num_layers; ++layer) {
+        const size_t n = layers_[layer].entries.size();
+        stamp_base[layer] = total;
+        total += n;
+        max_entries = std::max(max_entries, n);
+        for (size_t s = 0; s < n; s += kChunk) chunks.push_back({layer, s, std::min(n, s + kChunk)});
+    }
+
+    size_t threads = r_.num_threads > 0
+        ? static_cast<size_t>(r_.num_threads)
+        : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, chunks.size()));
+    std::vector<std::vector<CopperViolation>> found(threads);
+    std::atomic<size_t> next{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    const double gap = reach() + r_.tolerance;
+
+    auto work = [&](size_t t) {
+        try {
+            std::vector<size_t> seen(max_entries, static_cast<size_t>(-1));
+            std::vector<CopperViolation>& out = found[t];
+            for (size_t k = next.fetch_add(1); k < chunks.size(); k = next.fetch_add(1)) {
+                const Chunk& chunk = chunks[k];
+                const LayerIndex& index = layers_[chunk.layer];
+                for (size_t i = chunk.start; i < chunk.end; ++i) {
+                    const Entry& a = index.entries[i];
+                    const size_t stamp = stamp_base[chunk.layer] + i;  // unique across layers
+                    for (int r = index.row_of(a.min_y - gap); r <= index.row_of(a.max_y + gap); ++r) {
+                        for (int c = index.col_of(a.min_x - gap); c <= index.col_of(a.max_x + gap); ++c) {
+                            const size_t cell = static_cast<size_t>(r) * index.cols + c;
+                            for (int q = index.bucket_start[cell]; q < index.bucket_start[cell + 1]; ++q) {
+                                const size_t j = static_cast<size_t>(index.bucket_items[q]);
+                                if (j <= i || seen[j] == stamp) continue;
+                                seen[j] = stamp;
+                                const Entry& e = index.entries[j];
+                                if (e.min_x - a.max_x > gap || a.min_x - e.max_x > gap ||
+                                    e.min_y - a.max_y > gap || a.min_y - e.max_y > gap) {
+                                    continue;
+                                }
+                                check_pair(chunk.layer, a, e, out);
+                            }
+                        }
+                    }
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failure_mutex);
+            if (!failure) failure = std::current_exception();
+            next.store(chunks.size());
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(work, t);
+    work(0);
+    for (std::thread& th : pool) th.join();
+    if (failure) std::rethrow_exception(failure);
+
+    std::vector<CopperViolation> violations;
+    for (auto& part : found) violations.insert(violations.end(), part.begin(), part.end());
+    std::sort(violations.begin(), violations.end(), [](const CopperViolation& x, const CopperViolation& y) {
+        return std::tie(x.check, x.layer, x.type1, x.index1, x.type2, x.index2) <
+               std::tie(y.check, y.layer, y.type1, y.index1, y.type2, y.index2);
+    });
+    return violations;
+}
+
+} // namespace
+
+PadShape copper_item_shape(const CopperBoard& board, int type, size_t index) {
+    PadShape s;
+    if (type == COPPER_SEGMENT) {
+        const double dx = board.seg_x2[index] - board.seg_x1[index];
+        const double dy = board.seg_y2[index] - board.seg_y1[index];
+        s.kind = PAD_SHAPE_OVAL;
+        s.x = (board.seg_x1[index] + board.seg_x2[index]) / 2.0;
+        s.y = (board.seg_y1[index] + board.seg_y2[index]) / 2.0;
+        s.width = std::hypot(dx, dy) + board.seg_width[index];
+        s.height = board.seg_width[index];
+        s.rotation_rad = std::atan2(dy, dx);
+    } else if (type == COPPER_VIA) {
+        s.kind = PAD_SHAPE_CIRCLE;
+        s.x = board.via_x[index];
+        s.y = board.via_y[index];
+        s.width = s.height = board.via_size[index];
+    } else if (type == COPPER_PAD) {
+        s = board.pads[index];
+    } else {
+        const auto begin = board.zone_offsets[index];
+        const auto end = board.zone_offsets[index + 1];
+        s.kind = PAD_SHAPE_POLYGON;
+        s.polygon_x.assign(board.zone_x.begin() + begin, board.zone_x.begin() + end);
+        s.polygon_y.assign(board.zone_y.begin() + begin, board.zone_y.begin() + end);
+    }
+    return s;
+}
+
+void validate_copper_board(const CopperBoard& board, const char* caller) {
+    const size_t n_seg = board.seg_x1.size();
+    require_size(caller, board.seg_y1, n_seg, "segment");
+    require_size(caller, board.seg_x2, n_seg, "segment");
+    require_size(caller, board.seg_y2, n_seg, "segment");
+    require_size(caller, board.seg_width, n_seg, "segment");
+    require_size(caller, board.seg_layer, n_seg, "segment");
+    require_size(caller, board.seg_net, n_seg, "segment");
+    const size_t n_via = board.via_x.size();
+    require_size(caller, board.via_y, n_via, "via");
+    require_size(caller, board.via_size, n_via, "via");
+    require_size(caller, board.via_drill, n_via, "via");
+    require_size(caller, board.via_layers, n_via, "via");
+    require_size(caller, board.via_explicit_layers, n_via, "via");
+    require_size(caller, board.via_net, n_via, "via");
+    const size_t n_pad = board.pads.size();
+    require_size(caller, board.pad_layers, n_pad, "pad");
+    require_size(caller, board.pad_drill, n_pad, "pad");
+    require_size(caller, board.pad_net, n_pad, "pad");
+    const size_t n_zone = board.zone_layer.size();
+    require_size(caller, board.zone_net, n_zone, "zone");
+    require_size(caller, board.zone_y, board.zone_x.size(), "zone outline");
+    const bool no_zones = n_zone == 0 && board.zone_offsets.empty() && board.zone_x.empty();
+    if (!no_zones && (board.zone_offsets.size() != n_zone + 1 || board.zone_offsets.front() != 0 ||
+                      static_cast<size_t>(board.zone_offsets.back()) != board.zone_x.size())) {
+        throw std::invalid_argument(
+            std::string(caller) +
+            ": zone_offsets must be 0..n_points with one entry per zone plus the end");
+    }
+    if (board.num_layers < 0 || board.num_layers > 64) {
+        throw std::invalid_argument(std::string(caller) + ": num_layers must be 0..64");
+    }
+    for (int layer : board.seg_layer) {
+        if (layer < 0 || layer >= board.num_layers) {
+            throw std::invalid_argument(std::string(caller) + ": segment layer out of range");
+        }
+    }
+    for (int layer : board.zone_layer) {
+        if (layer < 0 || layer >= board.num_layers) {
+            throw std::invalid_argument(std::string(caller) + ": zone layer out of range");
+        }
+    }
+}
+
+std::vector<CopperViolation> check_copper_drc(const CopperBoard& board, const CopperRules& rules) {
+    return Engine(board, rules).run();
+}
+
+} // namespace drc
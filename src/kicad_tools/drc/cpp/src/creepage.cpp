@@ -0,0 +1,418 @@
+/*
+ * DRC Clearance C++ Core - creepage (surface path) census
+ *
+ * See creepage.hpp.  Slot walls decide micron-level "along the wall or
+ * through the slot" questions, so the visibility tests run in double
+ * precision here rather than on the router's float segment kernels.
+ */
+
+#include "creepage.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace drc {
+
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+constexpr double kOnSegment = 1e-9;
+
+struct Point {
+    double x, y;
+};
+
+double point_segment_distance(Point p, Point a, Point b) {
+    const double dx = b.x - a.x;
+    const double dy = b.y - a.y;
+    const double len2 = dx * dx + dy * dy;
+    double t = len2 > 0.0 ? ((p.x - a.x) * dx + (p.y - a.y) * dy) / len2 : 0.0;
+    t = std::clamp(t, 0.0, 1.0);
+    return std::hypot(p.x - (a.x + t * dx), p.y - (a.y + t * dy));
+}
+
+/// Slot rings and the straight-path test against their interiors.
+class Slots {
+public:
+    Slots(const CreepageOutline& outline, double shrink) : shrink_(shrink) {
+        for (size_t k = 0; k + 1 < outline.slot_offsets.size(); ++k) {
+            Ring ring{corners_.size(), 0, kInf, kInf, -kInf, -kInf};
+            for (int i = outline.slot_offsets[k]; i < outline.slot_offsets[k + 1]; ++i) {
+                const Point p{outline.slot_x[i], outline.slot_y[i]};
+                // Rings may repeat their first point to close; drop repeats.
+                if (corners_.size() > ring.begin) {
+                    const Point& last = corners_.back();
+                    if (last.x == p.x && last.y == p.y) continue;
+                }
+                corners_.push_back(p);
+                ring.min_x = std::min(ring.min_x, p.x);
+                ring.min_y = std::min(ring.min_y, p.y);
+                ring.max_x = std::max(ring.max_x, p.x);
+                ring.max_y = std::max(ring.max_y, p.y);
+            }
+            const Point first = corners_[std::min(ring.begin, corners_.size() - 1)];
+            if (corners_.size() > ring.begin + 1 && corners_.back().x == first.x &&
+                corners_.back().y == first.y) {
+                corners_.pop_back();
+            }
+            ring.end = corners_.size();
+            if (ring.end - ring.begin < 3) {
+                corners_.resize(ring.begin);
+                continue;
+            }
+            rings_.push_back(ring);
+        }
+    }
+
+    const std::vector<Point>& corners() const { return corners_; }
+
+    /// True when the segment p-q passes through some slot's interior.
+    bool blocks(Point p, Point q) const {
+        const double dx = q.x - p.x;
+        const double dy = q.y - p.y;
+        const double len = std::hypot(dx, dy);
+        if (len <= shrink_) return false;
+        const double len2 = len * len;
+        const double min_x = std::min(p.x, q.x), max_x = std::max(p.x, q.x);
+        const double min_y = std::min(p.y, q.y), max_y = std::max(p.y, q.y);
+
+        std::vector<double> ts;
+        for (const Ring& ring : rings_) {
+            if (ring.min_x > max_x || ring.max_x < min_x || ring.min_y > max_y || ring.max_y < min_y) continue;
+            // Split p-q wherever it meets the ring; a piece is inside the
+            // slot iff its midpoint is.
+            ts.assign({0.0, 1.0});
+            const size_t n = ring.end - ring.begin;
+            for (size_t k = 0; k < n; ++k) {
+                const Point a = corners_[ring.begin + k];
+                const Point b = corners_[ring.begin + (k + 1) % n];
+                const double ta = ((a.x - p.x) * dx + (a.y - p.y) * dy) / len2;
+                if (ta > 0.0 && ta < 1.0 &&
+                    std::hypot(a.x - (p.x + ta * dx), a.y - (p.y + ta * dy)) <= kOnSegment) {
+                    ts.push_back(ta);
+                }
+                const double ex = b.x - a.x;
+                const double ey = b.y - a.y;
+                const double denom = dx * ey - dy * ex;
+                if (std::abs(denom) <= 1e-12 * len * std::hypot(ex, ey)) continue;  // parallel
+                const double t = ((a.x - p.x) * ey - (a.y - p.y) * ex) / denom;
+                const double u = ((a.x - p.x) * dy - (a.y - p.y) * dx) / denom;
+                if (t > 0.0 && t < 1.0 && u >= 0.0 && u <= 1.0) ts.push_back(t);
+            }
+            std::sort(ts.begin(), ts.end());
+            for (size_t i = 0; i + 1 < ts.size(); ++i) {
+                if ((ts[i + 1] - ts[i]) * len <= shrink_) continue;
+                const double t = (ts[i] + ts[i + 1]) / 2.0;
+                const Point m{p.x + t * dx, p.y + t * dy};
+                if (inside(ring, m) && boundary_distance(ring, m) > shrink_) return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    struct Ring {
+        size_t begin, end;
+        double min_x, min_y, max_x, max_y;
+    };
+
+    bool inside(const Ring& ring, Point m) const {
+        bool in = false;
+        const size_t n = ring.end - ring.begin;
+        for (size_t k = 0, j = n - 1; k < n; j = k++) {
+            const Point a = corners_[ring.begin + k];
+            const Point b = corners_[ring.begin + j];
+            if ((a.y > m.y) != (b.y > m.y) && m.x < (b.x - a.x) * (m.y - a.y) / (b.y - a.y) + a.x) in = !in;
+        }
+        return in;
+    }
+
+    double boundary_distance(const Ring& ring, Point m) const {
+        double best = kInf;
+        const size_t n = ring.end - ring.begin;
+        for (size_t k = 0; k < n; ++k) {
+            best = std::min(best, point_segment_distance(m, corners_[ring.begin + k],
+                                                         corners_[ring.begin + (k + 1) % n]));
+        }
+        return best;
+    }
+
+    double shrink_;
+    std::vector<Point> corners_;
+    std::vector<Ring> rings_;
+};
+
+/// A piece of copper (or board edge) and its bounding disc.
+struct Part {
+    PadShape shape;
+    int conductor;
+    uint64_t layers;
+    double cx, cy, radius;
+};
+
+Part make_part(PadShape shape, int conductor, uint64_t layers) {
+    Part part{std::move(shape), conductor, layers, 0.0, 0.0, 0.0};
+    const PadShape& s = part.shape;
+    if (s.kind == PAD_SHAPE_POLYGON && s.rotation_rad == 0.0 && !s.polygon_x.empty()) {
+        // Zone fills sit far from their (0, 0) origin; bound them tightly.
+        const auto [lo_x, hi_x] = std::minmax_element(s.polygon_x.begin(), s.polygon_x.end());
+        const auto [lo_y, hi_y] = std::minmax_element(s.polygon_y.begin(), s.polygon_y.end());
+        part.cx = s.x + (*lo_x + *hi_x) / 2.0;
+        part.cy = s.y + (*lo_y + *hi_y) / 2.0;
+        part.radius = std::hypot(*hi_x - *lo_x, *hi_y - *lo_y) / 2.0 + s.corner_radius;
+    } else {
+        part.cx = s.x;
+        part.cy = s.y;
+        part.radius = bounding_radius(s);
+    }
+    return part;
+}
+
+/// Distance from a shape to a point, and the shape's nearest point.
+double nearest_on(const PadShape& shape, Point m, Point* at) {
+    PadShape probe;
+    probe.kind = PAD_SHAPE_CIRCLE;
+    probe.x = m.x;
+    probe.y = m.y;
+    const ShapeClearance r = pad_shape_clearance(shape, probe);
+    if (r.clearance <= 0.0) {
+        *at = m;
+        return 0.0;
+    }
+    // The location is the midpoint of the closest points, one of them m.
+    *at = {2.0 * r.location_x - m.x, 2.0 * r.location_y - m.y};
+    return r.clearance;
+}
+
+void validate_outline(const CreepageOutline& o) {
+    const size_t n = o.edge_x1.size();
+    if (o.edge_y1.size() != n || o.edge_x2.size() != n || o.edge_y2.size() != n) {
+        throw std::invalid_argument("creepage_matrix: edge arrays differ in length");
+    }
+    if (o.slot_y.size() != o.slot_x.size()) {
+        throw std::invalid_argument("creepage_matrix: slot outline arrays differ in length");
+    }
+    const bool no_slots = o.slot_offsets.empty() && o.slot_x.empty();
+    if (!no_slots && (o.slot_offsets.empty() || o.slot_offsets.front() != 0 ||
+                      static_cast<size_t>(o.slot_offsets.back()) != o.slot_x.size() ||
+                      !std::is_sorted(o.slot_offsets.begin(), o.slot_offsets.end()))) {
+        throw std::invalid_argument(
+            "creepage_matrix: slot_offsets must be 0..n_points with one entry per slot plus the end");
+    }
+}
+
+template <typename Work>
+void run_parallel(size_t tasks, int num_threads, Work work) {
+    size_t threads = num_threads > 0
+        ? static_cast<size_t>(num_threads)
+        : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, tasks));
+    std::atomic<size_t> next{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    auto worker = [&]() {
+        try {
+            for (size_t k = next.fetch_add(1); k < tasks; k = next.fetch_add(1)) work(k);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failure_mutex);
+            if (!failure) failure = std::current_exception();
+            next.store(tasks);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (std::thread& th : pool) th.join();
+    if (failure) std::rethrow_exception(failure);
+}
+
+} // namespace
+
+CreepageMatrix creepage_matrix(
+    const CopperBoard& board,
+    const CreepageOutline& outline,
+    const std::vector<int>& sources,
+    const CreepageRules& rules
+) {
+    validate_copper_board(board, "creepage_matrix");
+    validate_outline(outline);
+    const int num_layers = std::max(board.num_layers, 1);
+    const uint64_t all_layers = num_layers >= 64 ? ~uint64_t{0} : (uint64_t{1} << num_layers) - 1;
+
+    CreepageMatrix out;
+    out.sources = sources;
+    for (int net : board.seg_net) out.nets.push_back(net);
+    for (int net : board.via_net) out.nets.push_back(net);
+    for (int net : board.pad_net) out.nets.push_back(net);
+    for (int net : board.zone_net) out.nets.push_back(net);
+    std::sort(out.nets.begin(), out.nets.end());
+    out.nets.erase(std::unique(out.nets.begin(), out.nets.end()), out.nets.end());
+    out.nets.erase(std::remove(out.nets.begin(), out.nets.end(), 0), out.nets.end());
+
+    const int edge = static_cast<int>(out.nets.size());  // the board edge conductor
+    const size_t conductors = out.nets.size() + 1;
+    auto conductor_of = [&](int net) {
+        const auto it = std::lower_bound(out.nets.begin(), out.nets.end(), net);
+        return it != out.nets.end() && *it == net ? static_cast<int>(it - out.nets.begin()) : -1;
+    };
+
+    std::vector<Part> parts;
+    auto add = [&](int type, size_t count, const std::vector<int>& nets, auto layers_of) {
+        for (size_t i = 0; i < count; ++i) {
+            if (nets[i] == 0) continue;
+            if (type == COPPER_ZONE && board.zone_offsets[i + 1] - board.zone_offsets[i] < 3) continue;
+            parts.push_back(make_part(copper_item_shape(board, type, i), conductor_of(nets[i]),
+                                      layers_of(i) & all_layers));
+        }
+    };
+    add(COPPER_SEGMENT, board.seg_x1.size(), board.seg_net, [&](size_t i) { return uint64_t{1} << board.seg_layer[i]; });
+    add(COPPER_VIA, board.via_x.size(), board.via_net, [&](size_t i) { return board.via_layers[i]; });
+    add(COPPER_PAD, board.pads.size(), board.pad_net, [&](size_t i) { return board.pad_layers[i]; });
+    add(COPPER_ZONE, board.zone_layer.size(), board.zone_net, [&](size_t i) { return uint64_t{1} << board.zone_layer[i]; });
+    for (size_t i = 0; i < outline.edge_x1.size(); ++i) {
+        const double dx = outline.edge_x2[i] - outline.edge_x1[i];
+        const double dy = outline.edge_y2[i] - outline.edge_y1[i];
+        PadShape s;
+        s.kind = PAD_SHAPE_OVAL;
+        s.x = (outline.edge_x1[i] + outline.edge_x2[i]) / 2.0;
+        s.y = (outline.edge_y1[i] + outline.edge_y2[i]) / 2.0;
+        s.width = std::hypot(dx, dy);
+        s.rotation_rad = std::atan2(dy, dx);
+        parts.push_back(make_part(std::move(s), edge, all_layers));
+    }
+
+    const Slots slots(outline, rules.interior_shrink);
+    const std::vector<Point>& corners = slots.corners();
+    const size_t nv = corners.size();
+
+    // Slot corner visibility graph, shared by every layer and source.
+    std::vector<double> hop(nv * nv, kInf);
+    run_parallel(nv, rules.num_threads, [&](size_t i) {
+        hop[i * nv + i] = 0.0;
+        for (size_t j = i + 1; j < nv; ++j) {
+            if (!slots.blocks(corners[i], corners[j])) {
+                hop[i * nv + j] = std::hypot(corners[j].x - corners[i].x, corners[j].y - corners[i].y);
+            }
+        }
+    });
+    for (size_t i = 0; i < nv; ++i) {
+        for (size_t j = 0; j < i; ++j) hop[i * nv + j] = hop[j * nv + i];
+    }
+
+    // Per layer: the parts on it, and each conductor's distance to every
+    // corner it can see.
+    std::vector<std::vector<int>> on_layer(static_cast<size_t>(num_layers));
+    std::vector<std::vector<double>> sight(static_cast<size_t>(num_layers));
+    for (int layer = 0; layer < num_layers; ++layer) {
+        std::vector<int>& ids = on_layer[layer];
+        for (size_t p = 0; p < parts.size(); ++p) {
+            if (parts[p].layers >> layer & 1) ids.push_back(static_cast<int>(p));
+        }
+        std::vector<double>& seen = sight[layer];
+        seen.assign(conductors * nv, kInf);
+        run_parallel(nv, rules.num_threads, [&](size_t v) {
+            const Point corner = corners[v];
+            for (int id : ids) {
+                const Part& part = parts[id];
+                double& best = seen[part.conductor * nv + v];
+                if (std::hypot(part.cx - corner.x, part.cy - corner.y) - part.radius >= best) continue;
+                Point at;
+                const double d = nearest_on(part.shape, corner, &at);
+                if (d < best && (d <= 0.0 || !slots.blocks(at, corner))) best = d;
+            }
+        });
+    }
+
+    const size_t rows = sources.size();
+    const size_t cols = out.nets.size();
+    out.clearance.assign(rows * cols, kInf);
+    out.creepage.assign(rows * cols, kInf);
+    out.layer.assign(rows * cols, -1);
+    out.edge_clearance.assign(rows, kInf);
+    out.edge_creepage.assign(rows, kInf);
+
+    run_parallel(rows, rules.num_threads, [&](size_t row) {
+        const int a = conductor_of(sources[row]);
+        if (a < 0) return;
+        std::vector<double> clear(conductors), direct(conductors), reach(nv);
+        std::vector<char> done(nv);
+        for (int layer = 0; layer < num_layers; ++layer) {
+            const std::vector<int>& ids = on_layer[layer];
+            std::vector<int> mine;
+            for (int id : ids) {
+                if (parts[id].conductor == a) mine.push_back(id);
+            }
+            if (mine.empty()) continue;
+
+            // Straight gaps: the smallest overall, and the smallest whose
+            // closest-points segment stays out of every slot.
+            std::fill(clear.begin(), clear.end(), kInf);
+            std::fill(direct.begin(), direct.end(), kInf);
+            for (int ia : mine) {
+                const Part& pa = parts[ia];
+                for (int ib : ids) {
+                    const Part& pb = parts[ib];
+                    const int b = pb.conductor;
+                    if (b == a) continue;
+                    if (std::hypot(pb.cx - pa.cx, pb.cy - pa.cy) - pa.radius - pb.radius >= direct[b]) continue;
+                    const ShapeClearance r = pad_shape_clearance(pa.shape, pb.shape);
+                    clear[b] = std::min(clear[b], r.clearance);
+                    if (r.clearance >= direct[b]) continue;
+                    if (r.clearance > 0.0) {
+                        const Point mid{r.location_x, r.location_y};
+                        Point from, to;
+                        nearest_on(pa.shape, mid, &from);
+                        nearest_on(pb.shape, mid, &to);
+                        if (slots.blocks(from, to)) continue;
+                    }
+                    direct[b] = r.clearance;
+                }
+            }
+
+            // Paths over slot corners: Dijkstra seeded with every corner
+            // the source's copper can see.
+            const double* seen = sight[layer].data();
+            for (size_t v = 0; v < nv; ++v) reach[v] = seen[a * nv + v];
+            std::fill(done.begin(), done.end(), 0);
+            for (size_t step = 0; step < nv; ++step) {
+                size_t u = nv;
+                for (size_t v = 0; v < nv; ++v) {
+                    if (!done[v] && reach[v] < kInf && (u == nv || reach[v] < reach[u])) u = v;
+                }
+                if (u == nv) break;
+                done[u] = 1;
+                for (size_t v = 0; v < nv; ++v) {
+                    if (!done[v]) reach[v] = std::min(reach[v], reach[u] + hop[u * nv + v]);
+                }
+            }
+
+            for (size_t b = 0; b < conductors; ++b) {
+                if (static_cast<int>(b) == a || clear[b] == kInf) continue;
+                double creep = direct[b];
+                for (size_t v = 0; v < nv; ++v) creep = std::min(creep, reach[v] + seen[b * nv + v]);
+                creep = clear[b] <= 0.0 ? clear[b] : std::max(creep, clear[b]);
+                if (static_cast<int>(b) == edge) {
+                    out.edge_clearance[row] = std::min(out.edge_clearance[row], clear[b]);
+                    out.edge_creepage[row] = std::min(out.edge_creepage[row], creep);
+                    continue;
+                }
+                const size_t at = row * cols + b;
+                if (creep < out.creepage[at]) {
+                    out.creepage[at] = creep;
+                    out.clearance[at] = clear[b];
+                    out.layer[at] = layer;
+                }
+            }
+        }
+    });
+    return out;
+}
+
+} // namespace drc
@@ -0,0 +1,386 @@
+/*
+ * DRC Clearance C++ Core - incremental pad clearance state
+ *
+ * See incremental_clearance.hpp.  Transforms, boxes and the candidate
+ * filter repeat check_board_clearance()'s float expressions term for term
+ * so an incremental result and a fresh sweep agree bit for bit.
+ */
+
+#include "incremental_clearance.hpp"
+#include "pad_pair_simd.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace drc {
+
+namespace {
+
+constexpr float kInf = std::numeric_limits<float>::infinity();
+
+template <typename Work>
+void run_parallel(size_t tasks, int num_threads, Work work) {
+    size_t threads = num_threads > 0
+        ? static_cast<size_t>(num_threads)
+        : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, tasks));
+    std::atomic<size_t> next{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    auto worker = [&]() {
+        try {
+            for (size_t k = next.fetch_add(1); k < tasks; k = next.fetch_add(1)) work(k);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failure_mutex);
+            if (!failure) failure = std::current_exception();
+            next.store(tasks);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (std::thread& th : pool) th.join();
+    if (failure) std::rethrow_exception(failure);
+}
+
+} // namespace
+
+IncrementalClearance::IncrementalClearance(BoardPads pads, FootprintTransforms transforms,
+                                           BoardClearanceRules rules)
+    : pads_(std::move(pads)), rules_(rules) {
+    // Validates the arrays (throws) and seeds the pair cache in parallel.
+    const std::vector<BoardClearanceViolation> initial =
+        check_board_clearance(pads_, transforms, rules_);
+
+    offsets_ = pads_.footprint_offsets;
+    threshold_ = rules_.min_clearance - rules_.epsilon;
+    const size_t n = pads_.local_x.size();
+    const int n_fp = static_cast<int>(transforms.x.size());
+
+    radius_.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        radius_[i] = std::max(pads_.width[i], pads_.height[i]) / 2.0f;
+    }
+
+    pose_x_.assign(transforms.x.begin(), transforms.x.end());
+    pose_y_.assign(transforms.y.begin(), transforms.y.end());
+    pose_rot_.assign(transforms.rotation_rad.begin(), transforms.rotation_rad.end());
+    abs_x_.resize(n);
+    abs_y_.resize(n);
+    box_.resize(n_fp);
+
+    float extent = 0.0f;
+    int placed = 0;
+    for (int f = 0; f < n_fp; ++f) {
+        Placed at = place(f, pose_x_[f], pose_y_[f], pose_rot_[f]);
+        std::copy(at.x.begin(), at.x.end(), abs_x_.begin() + offsets_[f]);
+        std::copy(at.y.begin(), at.y.end(), abs_y_.begin() + offsets_[f]);
+        box_[f] = at.box;
+        if (has_pads(f)) {
+            extent += std::max(at.box.max_x - at.box.min_x, at.box.max_y - at.box.min_y);
+            ++placed;
+        }
+    }
+    // Cells about one grown footprint across: a move touches a handful.
+    if (placed > 0) {
+        cell_ = std::max(extent / static_cast<float>(placed) + rules_.min_clearance, 0.5f);
+    }
+    for (int f = 0; f < n_fp; ++f) grid_insert(f);
+
+    partners_.resize(n_fp);
+    for (const BoardClearanceViolation& v : initial) {
+        pairs_.emplace(pair_key(v.footprint1, v.footprint2), v);
+        partners_[v.footprint1].push_back(v.footprint2);
+        partners_[v.footprint2].push_back(v.footprint1);
+    }
+}
+
+IncrementalClearance::Placed IncrementalClearance::place(int f, double x, double y,
+                                                         double rot) const {
+    Placed at;
+    at.box = Box{kInf, kInf, -kInf, -kInf};
+    const float fx = static_cast<float>(x);
+    const float fy = static_cast<float>(y);
+    const float cos_a = std::cos(static_cast<float>(rot));
+    const float sin_a = std::sin(static_cast<float>(rot));
+    const int begin = offsets_[f];
+    const int end = offsets_[f + 1];
+    at.x.resize(end - begin);
+    at.y.resize(end - begin);
+    for (int i = begin; i < end; ++i) {
+        const float lx = pads_.local_x[i];
+        const float ly = pads_.local_y[i];
+        const float ax = fx + lx * cos_a - ly * sin_a;
+        const float ay = fy + lx * sin_a + ly * cos_a;
+        at.x[i - begin] = ax;
+        at.y[i - begin] = ay;
+        at.box.min_x = std::min(at.box.min_x, ax - pads_.width[i] / 2);
+        at.box.min_y = std::min(at.box.min_y, ay - pads_.height[i] / 2);
+        at.box.max_x = std::max(at.box.max_x, ax + pads_.width[i] / 2);
+        at.box.max_y = std::max(at.box.max_y, ay + pads_.height[i] / 2);
+    }
+    return at;
+}
+
+void IncrementalClearance::candidates(const Box& q, int skip, std::vector<int>& out) const {
+    if (!(q.min_x <= q.max_x && q.min_y <= q.max_y)) return;
+    const auto lo_c = static_cast<int64_t>(std::floor(q.min_x / cell_));
+    const auto hi_c = static_cast<int64_t>(std::floor(q.max_x / cell_));
+    const auto lo_r = static_cast<int64_t>(std::floor(q.min_y / cell_));
+    const auto hi_r = static_cast<int64_t>(std::floor(q.max_y / cell_));
+    const size_t first = out.size();
+
+    auto take = [&](const std::vector<int>& bucket) {
+        for (int g : bucket) {
+            if (g == skip) continue;
+            const Box& b = box_[g];
+            if (q.max_x < b.min_x || q.min_x > b.max_x || q.max_y < b.min_y ||
+                q.min_y > b.max_y) {
+                continue;
+            }
+            out.push_back(g);
+        }
+    };
+    const double span = static_cast<double>(hi_c - lo_c + 1) * static_cast<double>(hi_r - lo_r + 1);
+    if (span > static_cast<double>(cells_.size())) {
+        // Query wider than the occupied grid: walk the occupied cells.
+        for (const auto& [key, bucket] : cells_) {
+            const auto c = static_cast<int32_t>(key >> 32);
+            const auto r = static_cast<int32_t>(key & 0xffffffffu);
+            if (c >= lo_c && c <= hi_c && r >= lo_r && r <= hi_r) take(bucket);
+        }
+    } else {
+        for (int64_t r = lo_r; r <= hi_r; ++r) {
+            for (int64_t c = lo_c; c <= hi_c; ++c) {
+                const auto it = cells_.find(pair_key(static_cast<int>(c), static_cast<int>(r)));
+                if (it != cells_.end()) take(it->second);
+            }
+        }
+    }
+    // A box spanning several cells is met once per cell.
+    std::sort(out.begin() + first, out.end());
+    out.erase(std::unique(out.begin() + first, out.end()), out.end());
+}
+
+void IncrementalClearance::grid_insert(int f) {
+    if (!has_pads(f)) return;
+    const Box& b = box_[f];
+    const auto lo_c = static_cast<int>(std::floor(b.min_x / cell_));
+    const auto hi_c = static_cast<int>(std::floor(b.max_x / cell_));
+    const auto lo_r = static_cast<int>(std::floor(b.min_y / cell_));
+    const auto hi_r = static_cast<int>(std::floor(b.max_y / cell_));
+    for (int r = lo_r; r <= hi_r; ++r) {
+        for (int c = lo_c; c <= hi_c; ++c) cells_[pair_key(c, r)].push_back(f);
+    }
+}
+
+void IncrementalClearance::grid_remove(int f) {
+    if (!has_pads(f)) return;
+    const Box& b = box_[f];
+    const auto lo_c = static_cast<int>(std::floor(b.min_x / cell_));
+    const auto hi_c = static_cast<int>(std::floor(b.max_x / cell_));
+    const auto lo_r = static_cast<int>(std::floor(b.min_y / cell_));
+    const auto hi_r = static_cast<int>(std::floor(b.max_y / cell_));
+    for (int r = lo_r; r <= hi_r; ++r) {
+        for (int c = lo_c; c <= hi_c; ++c) {
+            const auto it = cells_.find(pair_key(c, r));
+            if (it == cells_.end()) continue;
+            std::vector<int>& bucket = it->second;
+            const auto pos = std::find(bucket.begin(), bucket.end(), f);
+            if (pos != bucket.end()) {
+                *pos = bucket.back();
+                bucket.pop_back();
+            }
+            if (bucket.empty()) cells_.erase(it);
+        }
+    }
+}
+
+// Every footprint within reach of ``f`` placed at ``at``, with its closest
+// pad pair: visit(g, f_first, best, gx, gy).
+template <typename Visit>
+void IncrementalClearance::visit_pairs(int f, const Placed& at, Visit&& visit) const {
+    if (!has_pads(f)) return;
+    const float margin = rules_.min_clearance;
+    const Box grown{at.box.min_x - margin, at.box.min_y - margin,
+                    at.box.max_x + margin, at.box.max_y + margin};
+    std::vector<int> near;
+    candidates(grown, f, near);
+
+    const int n_f = offsets_[f + 1] - offsets_[f];
+    const float* r_f = radius_.data() + offsets_[f];
+    const int* net_f = pads_.net.data() + offsets_[f];
+    for (int g : near) {
+        const int n_g = offsets_[g + 1] - offsets_[g];
+        const float* gx = abs_x_.data() + offsets_[g];
+        const float* gy = abs_y_.data() + offsets_[g];
+        const float* r_g = radius_.data() + offsets_[g];
+        const int* net_g = pads_.net.data() + offsets_[g];
+
+        // Lower footprint index first, as the whole-board sweep orders pairs.
+        const bool f_first = f < g;
+        const PairMinimum best = f_first
+            ? pad_pair_minimum(at.x.data(), at.y.data(), r_f, net_f, n_f,
+                               gx, gy, r_g, net_g, n_g, active_simd_level())
+            : pad_pair_minimum(gx, gy, r_g, net_g, n_g,
+                               at.x.data(), at.y.data(), r_f, net_f, n_f, active_simd_level());
+        if (best.i >= 0) visit(g, f_first, best, gx, gy);
+    }
+}
+
+void IncrementalClearance::evaluate(int f, const Placed& at, IncrementalMove& out) const {
+    visit_pairs(f, at, [&](int g, bool f_first, const PairMinimum& best,
+                           const float* gx, const float* gy) {
+        if (!(best.clearance < threshold_)) return;
+
+        const float x1 = f_first ? at.x[best.i] : gx[best.i];
+        const float y1 = f_first ? at.y[best.i] : gy[best.i];
+        const float x2 = f_first ? gx[best.j] : at.x[best.j];
+        const float y2 = f_first ? gy[best.j] : at.y[best.j];
+        BoardClearanceViolation v;
+        v.footprint1 = f_first ? f : g;
+        v.footprint2 = f_first ? g : f;
+        v.pad1_index = best.i;
+        v.pad2_index = best.j;
+        v.min_clearance = best.clearance;
+        v.location_x = (x1 + x2) / 2.0f;
+        v.location_y = (y1 + y2) / 2.0f;
+        out.violations.push_back(v);
+    });
+}
+
+IncrementalMove IncrementalClearance::check_move(int f, double dx, double dy,
+                                                 double drot) const {
+    if (f < 0 || f >= num_footprints()) {
+        throw std::out_of_range("IncrementalClearance: no footprint " + std::to_string(f));
+    }
+    IncrementalMove out;
+    const Placed at = place(f, pose_x_[f] + dx, pose_y_[f] + dy, pose_rot_[f] + drot);
+    evaluate(f, at, out);
+
+    std::vector<uint64_t> still;
+    still.reserve(out.violations.size());
+    for (const BoardClearanceViolation& v : out.violations) {
+        still.push_back(pair_key(v.footprint1, v.footprint2));
+    }
+    std::sort(still.begin(), still.end());
+    for (int g : partners_[f]) {
+        const uint64_t key = f < g ? pair_key(f, g) : pair_key(g, f);
+        if (!std::binary_search(still.begin(), still.end(), key)) {
+            out.resolved.push_back(pairs_.at(key));
+        }
+    }
+    std::sort(out.resolved.begin(), out.resolved.end(),
+              [](const BoardClearanceViolation& a, const BoardClearanceViolation& b) {
+                  return std::pair(a.footprint1, a.footprint2) < std::pair(b.footprint1, b.footprint2);
+              });
+
+    if (has_pads(f)) {
+        const float margin = rules_.min_clearance;
+        for (const Box& b : {box_[f], at.box}) {
+            candidates(Box{b.min_x - margin, b.min_y - margin, b.max_x + margin, b.max_y + margin},
+                       f, out.neighbours);
+        }
+        std::sort(out.neighbours.begin(), out.neighbours.end());
+        out.neighbours.erase(std::unique(out.neighbours.begin(), out.neighbours.end()),
+                             out.neighbours.end());
+    }
+    return out;
+}
+
+IncrementalMove IncrementalClearance::apply_move(int f, double dx, double dy, double drot) {
+    IncrementalMove out = check_move(f, dx, dy, drot);
+
+    grid_remove(f);
+    pose_x_[f] += dx;
+    pose_y_[f] += dy;
+    pose_rot_[f] += drot;
+    const Placed at = place(f, pose_x_[f], pose_y_[f], pose_rot_[f]);
+    std::copy(at.x.begin(), at.x.end(), abs_x_.begin() + offsets_[f]);
+    std::copy(at.y.begin(), at.y.end(), abs_y_.begin() + offsets_[f]);
+    box_[f] = at.box;
+    grid_insert(f);
+
+    for (int g : partners_[f]) {
+        pairs_.erase(f < g ? pair_key(f, g) : pair_key(g, f));
+        std::vector<int>& back = partners_[g];
+        back.erase(std::find(back.begin(), back.end(), f));
+    }
+    partners_[f].clear();
+    for (const BoardClearanceViolation& v : out.violations) {
+        pairs_.emplace(pair_key(v.footprint1, v.footprint2), v);
+        partners_[v.footprint1].push_back(v.footprint2);
+        partners_[v.footprint2].push_back(v.footprint1);
+    }
+    return out;
+}
+
+MoveScreen IncrementalClearance::screen_moves(const std::vector<int>& footprint,
+                                              const std::vector<double>& dx,
+                                              const std::vector<double>& dy,
+                                              const std::vector<double>& drot,
+                                              int num_threads) const {
+    const size_t n = footprint.size();
+    if (dx.size() != n || dy.size() != n || drot.size() != n) {
+        throw std::invalid_argument(
+            "IncrementalClearance.screen_moves: footprint, dx, dy and drot differ in length");
+    }
+    for (int f : footprint) {
+        if (f < 0 || f >= num_footprints()) {
+            throw std::out_of_range("IncrementalClearance: no footprint " + std::to_string(f));
+        }
+    }
+
+    MoveScreen out;
+    out.violations.assign(n, 0);
+    out.net_change.assign(n, 0);
+    out.min_clearance.assign(n, kInf);
+    // Read-only from here: the grid, poses and pair cache are shared.
+    run_parallel(n, num_threads, [&](size_t k) {
+        const int f = footprint[k];
+        const Placed at = place(f, pose_x_[f] + dx[k], pose_y_[f] + dy[k], pose_rot_[f] + drot[k]);
+        int count = 0;
+        float lowest = kInf;
+        visit_pairs(f, at, [&](int, bool, const PairMinimum& best, const float*, const float*) {
+            if (best.clearance < threshold_) ++count;
+            lowest = std::min(lowest, best.clearance);
+        });
+        out.violations[k] = count;
+        out.net_change[k] = count - static_cast<int>(partners_[f].size());
+        out.min_clearance[k] = lowest;
+    });
+    return out;
+}
+
+std::vector<BoardClearanceViolation> IncrementalClearance::violations() const {
+    std::vector<BoardClearanceViolation> all;
+    all.reserve(pairs_.size());
+    for (const auto& [key, v] : pairs_) all.push_back(v);
+    std::sort(all.begin(), all.end(),
+              [](const BoardClearanceViolation& a, const BoardClearanceViolation& b) {
+                  return std::pair(a.footprint1, a.footprint2) < std::pair(b.footprint1, b.footprint2);
+              });
+    return all;
+}
+
+std::vector<float> IncrementalClearance::bounds(int f) const {
+    const Box& b = box_.at(f);
+    return {b.min_x, b.min_y, b.max_x, b.max_y};
+}
+
+std::vector<int> IncrementalClearance::query(float min_x, float min_y, float max_x,
+                                             float max_y) const {
+    std::vector<int> out;
+    candidates(Box{min_x, min_y, max_x, max_y}, -1, out);
+    return out;
+}
+
+} // namespace drc
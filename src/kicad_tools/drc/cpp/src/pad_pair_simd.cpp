@@ -0,0 +1,518 @@
+/*
+ * DRC Clearance C++ Core - vectorized pad-pair minimum
+ *
+ * See pad_pair_simd.hpp.  The vector kernels evaluate every pair (a lane
+ * of sqrt is cheaper than the scalar loop's data-dependent skip) and keep,
+ * per lane, the smallest clearance and the first (i, j) that reached it;
+ * the lanes are reduced in (clearance, i, j) order at the end.  Component
+ * 2 is copied into arrays padded to 16 with +inf positions, whose lanes
+ * can never beat a real pair.
+ *
+ * pad_pair_below() runs the same lanes against a running cut and hands
+ * the lanes under it to a BelowSink, in row-major order at every level.
+ */
+
+#include "pad_pair_simd.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define DRC_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define DRC_TARGET(isa)
+#else
+#define DRC_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+namespace drc {
+
+namespace {
+
+constexpr float kInf = std::numeric_limits<float>::infinity();
+constexpr int kMaxLanes = 16;
+
+// Scalar skip slack: a pair is only skipped when its centre distance
+// clears the running threshold by more than the float rounding of
+// sqrt(d2) - r_sum can close, so no strictly better pair is ever dropped
+// and the result matches the vector kernels, which skip nothing.
+constexpr float kSkipSlack = 1.0f + 1.0f / (1 << 19);
+
+struct Padded {
+    std::vector<float> x, y, r;
+    std::vector<int> net;
+    int n = 0;  // padded length, a multiple of kMaxLanes
+};
+
+void pad_component(const float* bx, const float* by, const float* br, const int* bnet, int n2,
+                   Padded& out) {
+    out.n = (n2 + kMaxLanes - 1) / kMaxLanes * kMaxLanes;
+    out.x.assign(out.n, kInf);
+    out.y.assign(out.n, 0.0f);
+    out.r.assign(out.n, 0.0f);
+    out.net.assign(out.n, 0);
+    std::copy(bx, bx + n2, out.x.begin());
+    std::copy(by, by + n2, out.y.begin());
+    std::copy(br, br + n2, out.r.begin());
+    std::copy(bnet, bnet + n2, out.net.begin());
+}
+
+// Fold one lane's (clearance, i, j) into the running best: smaller
+// clearance wins, ties go to the earlier row-major pair.
+void fold(PairMinimum& best, float clearance, int i, int j) {
+    if (i < 0) return;
+    if (clearance < best.clearance ||
+        (clearance == best.clearance && (best.i < 0 || i < best.i || (i == best.i && j < best.j)))) {
+        best = {clearance, i, j};
+    }
+}
+
+PairMinimum reduce_lanes(const float* value, const int* lane_i, const int* lane_j, int lanes) {
+    PairMinimum best{kInf, -1, -1};
+    for (int k = 0; k < lanes; ++k) fold(best, value[k], lane_i[k], lane_j[k]);
+    return best;
+}
+
+PairMinimum kernel_scalar(const float* ax, const float* ay, const float* ar, const int* anet, int n1,
+                          const float* bx, const float* by, const float* br, const int* bnet,
+                          int n2) {
+    PairMinimum best{kInf, -1, -1};
+    for (int i = 0; i < n1; ++i) {
+        const float x1 = ax[i];
+        const float y1 = ay[i];
+        const float r1 = ar[i];
+        const int net1 = anet[i];
+        for (int j = 0; j < n2; ++j) {
+            // Same-net pads can touch; net 0 (unconnected) never matches.
+            if (net1 == bnet[j] && net1 != 0) continue;
+
+            const float dx = bx[j] - x1;
+            const float dy = by[j] - y1;
+            const float dist_sq = dx * dx + dy * dy;
+            const float r_sum = r1 + br[j];
+
+            // Early skip: the centre distance alone already rules the pair
+            // out (a non-positive threshold rules out every pair).
+            const float threshold = best.clearance + r_sum;
+            if (threshold <= 0.0f) continue;
+            const float slack = threshold * kSkipSlack;
+            if (dist_sq > slack * slack) continue;
+
+            const float clearance = std::sqrt(dist_sq) - r_sum;
+            if (clearance < best.clearance) best = {clearance, i, j};
+        }
+    }
+    return best;
+}
+
+// Collects pairs under a shrinking cut: the threshold, then, with a result
+// limit, the k-th best pair once k are held.  Pairs are offered in
+// row-major order, so a later pair tying the cut is never the better one.
+class BelowSink {
+public:
+    BelowSink(float threshold, int max_results) : cut_(threshold), max_(max_results) {}
+
+    float cut() const { return cut_; }
+
+    void offer(float clearance, int i, int j) {
+        if (!(clearance < cut_)) return;
+        pairs_.push_back({clearance, i, j});
+        if (max_ <= 0) return;
+        std::push_heap(pairs_.begin(), pairs_.end(), before);
+        if (static_cast<int>(pairs_.size()) > max_) {
+            std::pop_heap(pairs_.begin(), pairs_.end(), before);
+            pairs_.pop_back();
+        }
+        if (static_cast<int>(pairs_.size()) == max_) cut_ = pairs_.front().clearance;
+    }
+
+    std::vector<PairMinimum> take() {
+        std::sort(pairs_.begin(), pairs_.end(), before);
+        return std::move(pairs_);
+    }
+
+private:
+    static bool before(const PairMinimum& a, const PairMinimum& b) {
+        if (a.clearance != b.clearance) return a.clearance < b.clearance;
+        if (a.i != b.i) return a.i < b.i;
+        return a.j < b.j;
+    }
+
+    float cut_;
+    int max_;
+    std::vector<PairMinimum> pairs_;  // a max-heap while max_ > 0
+};
+
+void below_scalar(const float* ax, const float* ay, const float* ar, const int* anet, int n1,
+                  const float* bx, const float* by, const float* br, const int* bnet, int n2,
+                  BelowSink& sink) {
+    for (int i = 0; i < n1; ++i) {
+        const float x1 = ax[i];
+        const float y1 = ay[i];
+        const float r1 = ar[i];
+        const int net1 = anet[i];
+        for (int j = 0; j < n2; ++j) {
+            if (net1 == bnet[j] && net1 != 0) continue;
+
+            const float dx = bx[j] - x1;
+            const float dy = by[j] - y1;
+            const float dist_sq = dx * dx + dy * dy;
+            const float r_sum = r1 + br[j];
+
+            // Same conservative skip as kernel_scalar, against the cut.
+            const float cut = sink.cut();
+            if (cut < kInf) {
+                const float threshold = cut + r_sum;
+                if (threshold <= 0.0f) continue;
+                const float slack = threshold * kSkipSlack;
+                if (dist_sq > slack * slack) continue;
+            }
+            sink.offer(std::sqrt(dist_sq) - r_sum, i, j);
+        }
+    }
+}
+
+#ifdef DRC_SIMD_X86
+
+DRC_TARGET("sse2")
+PairMinimum kernel_sse2(const float* ax, const float* ay, const float* ar, const int* anet, int n1,
+                        const Padded& b) {
+    __m128 best = _mm_set1_ps(kInf);
+    __m128i best_i = _mm_set1_epi32(-1);
+    __m128i best_j = _mm_set1_epi32(-1);
+    const __m128 inf = _mm_set1_ps(kInf);
+    const __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+
+    for (int i = 0; i < n1; ++i) {
+        const __m128 x1 = _mm_set1_ps(ax[i]);
+        const __m128 y1 = _mm_set1_ps(ay[i]);
+        const __m128 r1 = _mm_set1_ps(ar[i]);
+        const __m128i net1 = _mm_set1_epi32(anet[i]);
+        const bool match_nets = anet[i] != 0;
+        const __m128i row = _mm_set1_epi32(i);
+        for (int j = 0; j < b.n; j += 4) {
+            const __m128 dx = _mm_sub_ps(_mm_loadu_ps(&b.x[j]), x1);
+            const __m128 dy = _mm_sub_ps(_mm_loadu_ps(&b.y[j]), y1);
+            const __m128 dist_sq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            const __m128 r_sum = _mm_add_ps(r1, _mm_loadu_ps(&b.r[j]));
+            __m128 clearance = _mm_sub_ps(_mm_sqrt_ps(dist_sq), r_sum);
+            if (match_nets) {
+                const __m128 same = _mm_castsi128_ps(
+                    _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&b.net[j])), net1));
+                clearance = _mm_or_ps(_mm_and_ps(same, inf), _mm_andnot_ps(same, clearance));
+            }
+            const __m128 better = _mm_cmplt_ps(clearance, best);
+            const __m128i better_i = _mm_castps_si128(better);
+            best = _mm_or_ps(_mm_and_ps(better, clearance), _mm_andnot_ps(better, best));
+            best_i = _mm_or_si128(_mm_and_si128(better_i, row), _mm_andnot_si128(better_i, best_i));
+            const __m128i col = _mm_add_epi32(_mm_set1_epi32(j), lane);
+            best_j = _mm_or_si128(_mm_and_si128(better_i, col), _mm_andnot_si128(better_i, best_j));
+        }
+    }
+
+    alignas(16) float value[4];
+    alignas(16) int lane_i[4], lane_j[4];
+    _mm_store_ps(value, best);
+    _mm_store_si128(reinterpret_cast<__m128i*>(lane_i), best_i);
+    _mm_store_si128(reinterpret_cast<__m128i*>(lane_j), best_j);
+    return reduce_lanes(value, lane_i, lane_j, 4);
+}
+
+DRC_TARGET("avx2")
+PairMinimum kernel_avx2(const float* ax, const float* ay, const float* ar, const int* anet, int n1,
+                        const Padded& b) {
+    __m256 best = _mm256_set1_ps(kInf);
+    __m256i best_i = _mm256_set1_epi32(-1);
+    __m256i best_j = _mm256_set1_epi32(-1);
+    const __m256 inf = _mm256_set1_ps(kInf);
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    for (int i = 0; i < n1; ++i) {
+        const __m256 x1 = _mm256_set1_ps(ax[i]);
+        const __m256 y1 = _mm256_set1_ps(ay[i]);
+        const __m256 r1 = _mm256_set1_ps(ar[i]);
+        const __m256i net1 = _mm256_set1_epi32(anet[i]);
+        const bool match_nets = anet[i] != 0;
+        const __m256i row = _mm256_set1_epi32(i);
+        for (int j = 0; j < b.n; j += 8) {
+            const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(&b.x[j]), x1);
+            const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(&b.y[j]), y1);
+            const __m256 dist_sq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            const __m256 r_sum = _mm256_add_ps(r1, _mm256_loadu_ps(&b.r[j]));
+            __m256 clearance = _mm256_sub_ps(_mm256_sqrt_ps(dist_sq), r_sum);
+            if (match_nets) {
+                const __m256 same = _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&b.net[j])), net1));
+                clearance = _mm256_blendv_ps(clearance, inf, same);
+            }
+            const __m256 better = _mm256_cmp_ps(clearance, best, _CMP_LT_OQ);
+            const __m256i better_i = _mm256_castps_si256(better);
+            best = _mm256_blendv_ps(best, clearance, better);
+            best_i = _mm256_blendv_epi8(best_i, row, better_i);
+            const __m256i col = _mm256_add_epi32(_mm256_set1_epi32(j), lane);
+            best_j = _mm256_blendv_epi8(best_j, col, better_i);
+        }
+    }
+
+    alignas(32) float value[8];
+    alignas(32) int lane_i[8], lane_j[8];
+    _mm256_store_ps(value, best);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lane_i), best_i);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lane_j), best_j);
+    return reduce_lanes(value, lane_i, lane_j, 8);
+}
+
+DRC_TARGET("avx512f")
+PairMinimum kernel_avx512(const float* ax, const float* ay, const float* ar, const int* anet,
+                          int n1, const Padded& b) {
+    __m512 best = _mm512_set1_ps(kInf);
+    __m512i best_i = _mm512_set1_epi32(-1);
+    __m512i best_j = _mm512_set1_epi32(-1);
+    const __m512 inf = _mm512_set1_ps(kInf);
+    const __m512i lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    for (int i = 0; i < n1; ++i) {
+        const __m512 x1 = _mm512_set1_ps(ax[i]);
+        const __m512 y1 = _mm512_set1_ps(ay[i]);
+        const __m512 r1 = _mm512_set1_ps(ar[i]);
+        const __m512i net1 = _mm512_set1_epi32(anet[i]);
+        const bool match_nets = anet[i] != 0;
+        const __m512i row = _mm512_set1_epi32(i);
+        for (int j = 0; j < b.n; j += 16) {
+            const __m512 dx = _mm512_sub_ps(_mm512_loadu_ps(&b.x[j]), x1);
+            const __m512 dy = _mm512_sub_ps(_mm512_loadu_ps(&b.y[j]), y1);
+            const __m512 dist_sq = _mm512_add_ps(_mm512_mul_ps(dx, dx), _mm512_mul_ps(dy, dy));
+            const __m512 r_sum = _mm512_add_ps(r1, _mm512_loadu_ps(&b.r[j]));
+            // Zero-masked form: GCC 12's _mm512_sqrt_ps trips -Wmaybe-uninitialized.
+            const __m512 dist = _mm512_maskz_sqrt_ps(static_cast<__mmask16>(0xFFFF), dist_sq);
+            __m512 clearance = _mm512_sub_ps(dist, r_sum);
+            if (match_nets) {
+                const __mmask16 same = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(&b.net[j]), net1);
+                clearance = _mm512_mask_blend_ps(same, clearance, inf);
+            }
+            const __mmask16 better = _mm512_cmp_ps_mask(clearance, best, _CMP_LT_OQ);
+            best = _mm512_mask_blend_ps(better, best, clearance);
+            best_i = _mm512_mask_blend_epi32(better, best_i, row);
+            const __m512i col = _mm512_add_epi32(_mm512_set1_epi32(j), lane);
+            best_j = _mm512_mask_blend_epi32(better, best_j, col);
+        }
+    }
+
+    alignas(64) float value[16];
+    alignas(64) int lane_i[16], lane_j[16];
+    _mm512_store_ps(value, best);
+    _mm512_store_si512(lane_i, best_i);
+    _mm512_store_si512(lane_j, best_j);
+    return reduce_lanes(value, lane_i, lane_j, 16);
+}
+
+// Enumeration kernels: the clearance lanes of the min kernels, compared
+// against the sink's cut; lanes under it are offered in lane order.
+
+DRC_TARGET("sse2")
+void below_sse2(const float* ax, const float* ay, const float* ar, const int* anet, int n1,
+                const Padded& b, BelowSink& sink) {
+    const __m128 inf = _mm_set1_ps(kInf);
+    alignas(16) float lanes[4];
+    for (int i = 0; i < n1; ++i) {
+        const __m128 x1 = _mm_set1_ps(ax[i]);
+        const __m128 y1 = _mm_set1_ps(ay[i]);
+        const __m128 r1 = _mm_set1_ps(ar[i]);
+        const __m128i net1 = _mm_set1_epi32(anet[i]);
+        const bool match_nets = anet[i] != 0;
+        for (int j = 0; j < b.n; j += 4) {
+            const __m128 dx = _mm_sub_ps(_mm_loadu_ps(&b.x[j]), x1);
+            const __m128 dy = _mm_sub_ps(_mm_loadu_ps(&b.y[j]), y1);
+            const __m128 dist_sq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            const __m128 r_sum = _mm_add_ps(r1, _mm_loadu_ps(&b.r[j]));
+            __m128 clearance = _mm_sub_ps(_mm_sqrt_ps(dist_sq), r_sum);
+            if (match_nets) {
+                const __m128 same = _mm_castsi128_ps(
+                    _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&b.net[j])), net1));
+                clearance = _mm_or_ps(_mm_and_ps(same, inf), _mm_andnot_ps(same, clearance));
+            }
+            const int mask = _mm_movemask_ps(_mm_cmplt_ps(clearance, _mm_set1_ps(sink.cut())));
+            if (mask == 0) continue;
+            _mm_store_ps(lanes, clearance);
+            for (int k = 0; k < 4; ++k) {
+                if ((mask >> k) & 1) sink.offer(lanes[k], i, j + k);
+            }
+        }
+    }
+}
+
+DRC_TARGET("avx2")
+void below_avx2(const float* ax, const float* ay, const float* ar, const int* anet, int n1,
+                const Padded& b, BelowSink& sink) {
+    const __m256 inf = _mm256_set1_ps(kInf);
+    alignas(32) float lanes[8];
+    for (int i = 0; i < n1; ++i) {
+        const __m256 x1 = _mm256_set1_ps(ax[i]);
+        const __m256 y1 = _mm256_set1_ps(ay[i]);
+        const __m256 r1 = _mm256_set1_ps(ar[i]);
+        const __m256i net1 = _mm256_set1_epi32(anet[i]);
+        const bool match_nets = anet[i] != 0;
+        for (int j = 0; j < b.n; j += 8) {
+            const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(&b.x[j]), x1);
+            const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(&b.y[j]), y1);
+            const __m256 dist_sq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            const __m256 r_sum = _mm256_add_ps(r1, _mm256_loadu_ps(&b.r[j]));
+            __m256 clearance = _mm256_sub_ps(_mm256_sqrt_ps(dist_sq), r_sum);
+            if (match_nets) {
+                const __m256 same = _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&b.net[j])), net1));
+                clearance = _mm256_blendv_ps(clearance, inf, same);
+            }
+            const int mask = _mm256_movemask_ps(
+                _mm256_cmp_ps(clearance, _mm256_set1_ps(sink.cut()), _CMP_LT_OQ));
+            if (mask == 0) continue;
+            _mm256_store_ps(lanes, clearance);
+            for (int k = 0; k < 8; ++k) {
+                if ((mask >> k) & 1) sink.offer(lanes[k], i, j + k);
+            }
+        }
+    }
+}
+
+DRC_TARGET("avx512f")
+void below_avx512(const float* ax, const float* ay, const float* ar, const int* anet, int n1,
+                  const Padded& b, BelowSink& sink) {
+    const __m512 inf = _mm512_set1_ps(kInf);
+    alignas(64) float lanes[16];
+    for (int i = 0; i < n1; ++i) {
+        const __m512 x1 = _mm512_set1_ps(ax[i]);
+        const __m512 y1 = _mm512_set1_ps(ay[i]);
+        const __m512 r1 = _mm512_set1_ps(ar[i]);
+        const __m512i net1 = _mm512_set1_epi32(anet[i]);
+        const bool match_nets = anet[i] != 0;
+        for (int j = 0; j < b.n; j += 16) {
+            const __m512 dx = _mm512_sub_ps(_mm512_loadu_ps(&b.x[j]), x1);
+            const __m512 dy = _mm512_sub_ps(_mm512_loadu_ps(&b.y[j]), y1);
+            const __m512 dist_sq = _mm512_add_ps(_mm512_mul_ps(dx, dx), _mm512_mul_ps(dy, dy));
+            const __m512 r_sum = _mm512_add_ps(r1, _mm512_loadu_ps(&b.r[j]));
+            const __m512 dist = _mm512_maskz_sqrt_ps(static_cast<__mmask16>(0xFFFF), dist_sq);
+            __m512 clearance = _mm512_sub_ps(dist, r_sum);
+            if (match_nets) {
+                const __mmask16 same = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(&b.net[j]), net1);
+                clearance = _mm512_mask_blend_ps(same, clearance, inf);
+            }
+            const __mmask16 mask =
+                _mm512_cmp_ps_mask(clearance, _mm512_set1_ps(sink.cut()), _CMP_LT_OQ);
+            if (mask == 0) continue;
+            _mm512_store_ps(lanes, clearance);
+            for (int k = 0; k < 16; ++k) {
+                if ((mask >> k) & 1) sink.offer(lanes[k], i, j + k);
+            }
+        }
+    }
+}
+
+SimdLevel cpu_simd_level() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int regs[4];
+    __cpuid(regs, 0);
+    const int max_leaf = regs[0];
+    __cpuid(regs, 1);
+    const bool sse2 = (regs[3] >> 26) & 1;
+    const bool osxsave = (regs[2] >> 27) & 1;
+    if (!sse2) return SIMD_SCALAR;
+    if (!osxsave || max_leaf < 7) return SIMD_SSE2;
+    const unsigned long long xcr0 = _xgetbv(0);
+    __cpuidex(regs, 7, 0);
+    const bool avx2 = (regs[1] >> 5) & 1;
+    const bool avx512f = (regs[1] >> 16) & 1;
+    if (avx512f && (xcr0 & 0xE6) == 0xE6) return SIMD_AVX512;
+    if (avx2 && (xcr0 & 0x6) == 0x6) return SIMD_AVX2;
+    return SIMD_SSE2;
+#else
+    // libgcc / compiler-rt also check that the OS saves the wide registers.
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SIMD_AVX512;
+    if (__builtin_cpu_supports("avx2")) return SIMD_AVX2;
+    if (__builtin_cpu_supports("sse2")) return SIMD_SSE2;
+    return SIMD_SCALAR;
+#endif
+}
+
+#else
+
+SimdLevel cpu_simd_level() { return SIMD_SCALAR; }
+
+#endif  // DRC_SIMD_X86
+
+std::atomic<int> g_active_level{-1};
+
+} // namespace
+
+SimdLevel detect_simd_level() {
+    static const SimdLevel detected = cpu_simd_level();
+    return detected;
+}
+
+SimdLevel active_simd_level() {
+    int level = g_active_level.load(std::memory_order_relaxed);
+    if (level < 0) {
+        level = detect_simd_level();
+        g_active_level.store(level, std::memory_order_relaxed);
+    }
+    return static_cast<SimdLevel>(level);
+}
+
+SimdLevel set_simd_level(SimdLevel level) {
+    const SimdLevel clamped = std::clamp(level, SIMD_SCALAR, detect_simd_level());
+    g_active_level.store(clamped, std::memory_order_relaxed);
+    return clamped;
+}
+
+PairMinimum pad_pair_minimum(
+    const float* ax, const float* ay, const float* ar, const int* anet, int n1,
+    const float* bx, const float* by, const float* br, const int* bnet, int n2,
+    SimdLevel level) {
+    if (n1 <= 0 || n2 <= 0) return {kInf, -1, -1};
+    level = std::clamp(level, SIMD_SCALAR, detect_simd_level());
+
+#ifdef DRC_SIMD_X86
+    if (level != SIMD_SCALAR) {
+        thread_local Padded b;
+        pad_component(bx, by, br, bnet, n2, b);
+        switch (level) {
+            case SIMD_AVX512: return kernel_avx512(ax, ay, ar, anet, n1, b);
+            case SIMD_AVX2: return kernel_avx2(ax, ay, ar, anet, n1, b);
+            default: return kernel_sse2(ax, ay, ar, anet, n1, b);
+        }
+    }
+#endif
+    return kernel_scalar(ax, ay, ar, anet, n1, bx, by, br, bnet, n2);
+}
+
+std::vector<PairMinimum> pad_pair_below(
+    const float* ax, const float* ay, const float* ar, const int* anet, int n1,
+    const float* bx, const float* by, const float* br, const int* bnet, int n2,
+    float threshold, int max_results, SimdLevel level) {
+    BelowSink sink(threshold, max_results);
+    if (n1 <= 0 || n2 <= 0) return sink.take();
+    level = std::clamp(level, SIMD_SCALAR, detect_simd_level());
+
+#ifdef DRC_SIMD_X86
+    if (level != SIMD_SCALAR) {
+        thread_local Padded b;
+        pad_component(bx, by, br, bnet, n2, b);
+        switch (level) {
+            case SIMD_AVX512: below_avx512(ax, ay, ar, anet, n1, b, sink); break;
+            case SIMD_AVX2: below_avx2(ax, ay, ar, anet, n1, b, sink); break;
+            default: below_sse2(ax, ay, ar, anet, n1, b, sink); break;
+        }
+        return sink.take();
+    }
+#endif
+    below_scalar(ax, ay, ar, anet, n1, bx, by, br, bnet, n2, sink);
+    return sink.take();
+}
+
+} // namespace drc
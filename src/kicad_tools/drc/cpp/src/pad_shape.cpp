@@ -0,0 +1,368 @@
+/*
+ * DRC Clearance C++ Core - exact pad shape distance
+ *
+ * See pad_shape.hpp.  Cores are at most a handful of vertices (a custom
+ * outline rarely more than a few dozen), so the edge-pair loops below are
+ * cheaper than any acceleration structure.
+ */
+
+#include "pad_shape.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace drc {
+
+namespace {
+
+struct Vec {
+    double x, y;
+};
+
+inline Vec sub(Vec a, Vec b) { return {a.x - b.x, a.y - b.y}; }
+inline Vec add(Vec a, Vec b) { return {a.x + b.x, a.y + b.y}; }
+inline Vec scale(Vec a, double s) { return {a.x * s, a.y * s}; }
+inline double dot(Vec a, Vec b) { return a.x * b.x + a.y * b.y; }
+inline double cross(Vec a, Vec b) { return a.x * b.y - a.y * b.x; }
+inline double norm(Vec a) { return std::sqrt(dot(a, a)); }
+
+constexpr double kDegenerate = 1e-12;
+constexpr double kPi = 3.14159265358979323846;
+
+/// Core point set (1 = point, 2 = segment, >= 3 = closed polygon) plus the
+/// inflation radius, in board coordinates.
+struct Core {
+    std::vector<Vec> pts;
+    double radius = 0.0;
+    bool convex = true;
+};
+
+size_t edge_count(const Core& c) {
+    return c.pts.size() < 3 ? 1 : c.pts.size();
+}
+
+void edge(const Core& c, size_t i, Vec& a, Vec& b) {
+    a = c.pts[i];
+    b = c.pts.size() == 1 ? c.pts[0] : c.pts[(i + 1) % c.pts.size()];
+}
+
+// Centred box of half-sizes (hw, hh), collapsing to a segment or a point.
+void box_core(std::vector<Vec>& pts, double hw, double hh) {
+    hw = std::max(hw, 0.0);
+    hh = std::max(hh, 0.0);
+    if (hw <= kDegenerate && hh <= kDegenerate) {
+        pts = {{0.0, 0.0}};
+    } else if (hw <= kDegenerate) {
+        pts = {{0.0, -hh}, {0.0, hh}};
+    } else if (hh <= kDegenerate) {
+        pts = {{-hw, 0.0}, {hw, 0.0}};
+    } else {
+        pts = {{-hw, -hh}, {hw, -hh}, {hw, hh}, {-hw, hh}};
+    }
+}
+
+bool is_convex(const std::vector<Vec>& pts) {
+    const size_t n = pts.size();
+    int sign = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const double z = cross(sub(pts[(i + 1) % n], pts[i]), sub(pts[(i + 2) % n], pts[(i + 1) % n]));
+        if (std::abs(z) <= kDegenerate) continue;
+        const int s = z > 0 ? 1 : -1;
+        if (sign != 0 && s != sign) return false;
+        sign = s;
+    }
+    return true;
+}
+
+Core make_core(const PadShape& shape) {
+    Core core;
+    const double w = shape.width;
+    const double h = shape.height;
+    switch (shape.kind) {
+        case PAD_SHAPE_CIRCLE:
+            core.pts = {{0.0, 0.0}};
+            core.radius = std::max(0.0, std::min(w, h) / 2.0);
+            break;
+        case PAD_SHAPE_OVAL:
+            // Stadium: the short axis becomes the cap radius.
+            core.radius = std::max(0.0, std::min(w, h) / 2.0);
+            box_core(core.pts, w / 2.0 - core.radius, h / 2.0 - core.radius);
+            break;
+        case PAD_SHAPE_ROUNDRECT:
+            core.radius = std::clamp(shape.corner_radius, 0.0, std::max(0.0, std::min(w, h) / 2.0));
+            box_core(core.pts, w / 2.0 - core.radius, h / 2.0 - core.radius);
+            break;
+        case PAD_SHAPE_RECT:
+            box_core(core.pts, w / 2.0, h / 2.0);
+            break;
+        case PAD_SHAPE_POLYGON: {
+            if (shape.polygon_x.size() != shape.polygon_y.size()) {
+                throw std::invalid_argument("pad_shape_clearance: polygon_x/polygon_y differ in length");
+            }
+            for (size_t i = 0; i < shape.polygon_x.size(); ++i) {
+                const Vec p{shape.polygon_x[i], shape.polygon_y[i]};
+                if (!core.pts.empty() && norm(sub(p, core.pts.back())) <= kDegenerate) continue;
+                core.pts.push_back(p);
+            }
+            while (core.pts.size() > 1 && norm(sub(core.pts.front(), core.pts.back())) <= kDegenerate) {
+                core.pts.pop_back();  // closed outlines repeat the first point
+            }
+            if (core.pts.size() < 3) {
+                throw std::invalid_argument("pad_shape_clearance: polygon needs at least 3 points");
+            }
+            core.radius = std::max(0.0, shape.corner_radius);
+            core.convex = is_convex(core.pts);
+            break;
+        }
+        default:
+            throw std::invalid_argument("pad_shape_clearance: unknown pad shape kind");
+    }
+
+    const double c = std::cos(shape.rotation_rad);
+    const double s = std::sin(shape.rotation_rad);
+    for (Vec& p : core.pts) {
+        p = {shape.x + p.x * c - p.y * s, shape.y + p.x * s + p.y * c};
+    }
+    return core;
+}
+
+// Closest point on segment ab to p.
+Vec closest_on_segment(Vec p, Vec a, Vec b) {
+    const Vec ab = sub(b, a);
+    const double len_sq = dot(ab, ab);
+    if (len_sq <= kDegenerate * kDegenerate) return a;
+    const double t = std::clamp(dot(sub(p, a), ab) / len_sq, 0.0, 1.0);
+    return add(a, scale(ab, t));
+}
+
+// Proper crossing of segments (p1,q1) and (p2,q2): interiors intersect at
+// a single point, neither touching at an end nor collinear.
+bool proper_crossing(Vec p1, Vec q1, Vec p2, Vec q2, Vec& at) {
+    const Vec r = sub(q1, p1);
+    const Vec s = sub(q2, p2);
+    const double d1 = cross(r, sub(p2, p1));
+    const double d2 = cross(r, sub(q2, p1));
+    const double d3 = cross(s, sub(p1, p2));
+    const double d4 = cross(s, sub(q1, p2));
+    if (!((d1 > 0 && d2 < 0) || (d1 < 0 && d2 > 0))) return false;
+    if (!((d3 > 0 && d4 < 0) || (d3 < 0 && d4 > 0))) return false;
+    at = add(p2, scale(s, d1 / (d1 - d2)));
+    return true;
+}
+
+struct Closest {
+    double dist = std::numeric_limits<double>::infinity();
+    Vec on_a{0.0, 0.0};
+    Vec on_b{0.0, 0.0};
+};
+
+void closest_segments(Vec p1, Vec q1, Vec p2, Vec q2, Closest& best) {
+    auto consider = [&](Vec pa, Vec pb) {
+        const double d = norm(sub(pb, pa));
+        if (d < best.dist) best = {d, pa, pb};
+    };
+    consider(p1, closest_on_segment(p1, p2, q2));
+    consider(q1, closest_on_segment(q1, p2, q2));
+    consider(closest_on_segment(p2, p1, q1), p2);
+    consider(closest_on_segment(q2, p1, q1), q2);
+}
+
+bool point_in_polygon(Vec p, const std::vector<Vec>& poly) {
+    bool inside = false;
+    for (size_t i = 0, j = poly.size() - 1; i < poly.size(); j = i++) {
+        const Vec a = poly[i];
+        const Vec b = poly[j];
+        if ((a.y > p.y) != (b.y > p.y) && p.x < (b.x - a.x) * (p.y - a.y) / (b.y - a.y) + a.x) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+double distance_to_boundary(Vec p, const Core& c) {
+    double best = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < edge_count(c); ++i) {
+        Vec a, b;
+        edge(c, i, a, b);
+        best = std::min(best, norm(sub(p, closest_on_segment(p, a, b))));
+    }
+    return best;
+}
+
+// Minimum translation distance of two overlapping convex cores: the
+// smallest projection overlap over both cores' edge normals.
+double sat_penetration(const Core& a, const Core& b) {
+    double pen = std::numeric_limits<double>::infinity();
+    auto test_axes = [&](const Core& src) {
+        for (size_t i = 0; i < edge_count(src); ++i) {
+            Vec p, q;
+            edge(src, i, p, q);
+            const Vec d = sub(q, p);
+            const double len = norm(d);
+            if (len <= kDegenerate) continue;
+            const Vec n{-d.y / len, d.x / len};
+            double min_a = std::numeric_limits<double>::infinity(), max_a = -min_a;
+            double min_b = min_a, max_b = -min_a;
+            for (Vec v : a.pts) { min_a = std::min(min_a, dot(v, n)); max_a = std::max(max_a, dot(v, n)); }
+            for (Vec v : b.pts) { min_b = std::min(min_b, dot(v, n)); max_b = std::max(max_b, dot(v, n)); }
+            pen = std::min(pen, std::min(max_a - min_b, max_b - min_a));
+        }
+    };
+    test_axes(a);
+    test_axes(b);
+    return std::isfinite(pen) ? std::max(pen, 0.0) : 0.0;
+}
+
+// Non-convex fallback: deepest vertex of either core inside the other.
+double vertex_penetration(const Core& a, const Core& b) {
+    double pen = 0.0;
+    auto probe = [&](const Core& from, const Core& into) {
+        if (into.pts.size() < 3) return;
+        for (Vec v : from.pts) {
+            if (point_in_polygon(v, into.pts)) pen = std::max(pen, distance_to_boundary(v, into));
+        }
+    };
+    probe(a, b);
+    probe(b, a);
+    return pen;
+}
+
+} // namespace
+
+double bounding_radius(const PadShape& shape) {
+    const Core core = make_core(shape);
+    double r = 0.0;
+    for (Vec p : core.pts) r = std::max(r, norm(sub(p, Vec{shape.x, shape.y})));
+    return r + core.radius;
+}
+
+std::vector<std::pair<double, double>> inflated_outline(
+    const PadShape& shape, double distance, int arc_segments
+) {
+    const Core core = make_core(shape);
+    const double radius = std::max(0.0, core.radius + distance);
+
+    // Counter-clockwise convex hull (monotone chain); a segment core stays
+    // a two-point "polygon" whose ends get half-turn caps.
+    std::vector<Vec> pts = core.pts;
+    std::sort(pts.begin(), pts.end(), [](Vec a, Vec b) { return a.x < b.x || (a.x == b.x && a.y < b.y); });
+    pts.erase(std::unique(pts.begin(), pts.end(), [](Vec a, Vec b) {
+        return norm(sub(a, b)) <= kDegenerate;
+    }), pts.end());
+    if (pts.size() >= 3) {
+        std::vector<Vec> hull(2 * pts.size());
+        size_t k = 0;
+        for (size_t i = 0; i < pts.size(); ++i) {
+            while (k >= 2 && cross(sub(hull[k - 1], hull[k - 2]), sub(pts[i], hull[k - 2])) <= 0) --k;
+            hull[k++] = pts[i];
+        }
+        for (size_t i = pts.size() - 1, lower = k + 1; i-- > 0;) {
+            while (k >= lower && cross(sub(hull[k - 1], hull[k - 2]), sub(pts[i], hull[k - 2])) <= 0) --k;
+            hull[k++] = pts[i];
+        }
+        hull.resize(k - 1);
+        pts = std::move(hull);
+    }
+
+    std::vector<std::pair<double, double>> out;
+    const double step = 2.0 * kPi / std::max(arc_segments, 3);
+    auto arc = [&](Vec c, double from, double sweep) {
+        if (radius <= 0.0) {
+            out.emplace_back(c.x, c.y);
+            return;
+        }
+        // Tangent lines every `delta` meet at radius / cos(delta / 2).
+        const int n = std::max(1, static_cast<int>(std::ceil(sweep / step - 1e-9)));
+        const double delta = sweep / n;
+        const double outer = radius / std::cos(delta / 2.0);
+        out.emplace_back(c.x + radius * std::cos(from), c.y + radius * std::sin(from));
+        for (int i = 0; i < n; ++i) {
+            const double t = from + (i + 0.5) * delta;
+            out.emplace_back(c.x + outer * std::cos(t), c.y + outer * std::sin(t));
+        }
+        out.emplace_back(c.x + radius * std::cos(from + sweep), c.y + radius * std::sin(from + sweep));
+    };
+
+    if (pts.size() == 1) {
+        const int n = std::max(arc_segments, 3);
+        const double outer = radius / std::cos(kPi / n);
+        for (int i = 0; i < n; ++i) {
+            const double t = (i + 0.5) * 2.0 * kPi / n;
+            out.emplace_back(pts[0].x + outer * std::cos(t), pts[0].y + outer * std::sin(t));
+        }
+        return out;
+    }
+    const size_t n = pts.size();
+    for (size_t i = 0; i < n; ++i) {
+        // Outward normals of the edges into and out of vertex i.
+        const Vec in = sub(pts[i], pts[(i + n - 1) % n]);
+        const Vec next = sub(pts[(i + 1) % n], pts[i]);
+        const double from = std::atan2(-in.x, in.y);
+        double sweep = std::atan2(-next.x, next.y) - from;
+        while (sweep < 0.0) sweep += 2.0 * kPi;
+        arc(pts[i], from, sweep);
+    }
+    return out;
+}
+
+ShapeClearance pad_shape_clearance(const PadShape& shape_a, const PadShape& shape_b) {
+    const Core a = make_core(shape_a);
+    const Core b = make_core(shape_b);
+
+    // Closest boundary points, and every point of the cores' overlap
+    // outline (crossings plus vertices inside the other core).
+    Closest best;
+    std::vector<Vec> overlap_pts;
+    for (size_t i = 0; i < edge_count(a); ++i) {
+        Vec p1, q1;
+        edge(a, i, p1, q1);
+        for (size_t j = 0; j < edge_count(b); ++j) {
+            Vec p2, q2;
+            edge(b, j, p2, q2);
+            Vec at;
+            if (proper_crossing(p1, q1, p2, q2, at)) {
+                overlap_pts.push_back(at);
+                best = {0.0, at, at};
+            } else if (best.dist > 0.0) {
+                closest_segments(p1, q1, p2, q2, best);
+            }
+        }
+    }
+    if (b.pts.size() >= 3) {
+        for (Vec v : a.pts) if (point_in_polygon(v, b.pts)) overlap_pts.push_back(v);
+    }
+    if (a.pts.size() >= 3) {
+        for (Vec v : b.pts) if (point_in_polygon(v, a.pts)) overlap_pts.push_back(v);
+    }
+
+    ShapeClearance out;
+    if (overlap_pts.empty()) {
+        out.clearance = best.dist - a.radius - b.radius;
+        Vec mid = scale(add(best.on_a, best.on_b), 0.5);
+        if (best.dist > kDegenerate) {
+            // Midpoint of the closest points on the inflated outlines.
+            const Vec u = scale(sub(best.on_b, best.on_a), 1.0 / best.dist);
+            mid = add(mid, scale(u, (a.radius - b.radius) / 2.0));
+        }
+        out.location_x = mid.x;
+        out.location_y = mid.y;
+        return out;
+    }
+
+    const double pen = a.convex && b.convex ? sat_penetration(a, b) : vertex_penetration(a, b);
+    out.clearance = 0.0 - (pen + a.radius + b.radius);  // +0.0 for a touch
+    double min_x = overlap_pts[0].x, max_x = min_x, min_y = overlap_pts[0].y, max_y = min_y;
+    for (Vec p : overlap_pts) {
+        min_x = std::min(min_x, p.x);
+        max_x = std::max(max_x, p.x);
+        min_y = std::min(min_y, p.y);
+        max_y = std::max(max_y, p.y);
+    }
+    out.location_x = (min_x + max_x) / 2.0;
+    out.location_y = (min_y + max_y) / 2.0;
+    return out;
+}
+
+} // namespace drc
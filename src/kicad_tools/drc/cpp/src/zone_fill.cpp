@@ -0,0 +1,932 @@
+/*
+ * DRC Clearance C++ Core - zone fill clearance carving
+ *
+ * See zone_fill.hpp.  Fill vertices come from the board file at nanometre
+ * resolution, so the booleans run on an integer nanometre grid about each
+ * fill's centre: orientation tests are exact, and only the crossing points
+ * of two edges are rounded.  Everything a fill touches must lie within
+ * 2^29 nm (~537 mm) of that centre; larger fills are reported unsupported
+ * and left to the shapely path.
+ */
+
+#include "zone_fill.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace drc {
+
+namespace {
+
+constexpr double kNmPerMm = 1e6;
+constexpr double kNm2PerMm2 = 1e12;
+// Keeps edge deltas within 2^30 and doubled-midpoint ray tests within int64.
+constexpr double kMaxSpan = 536870912.0;
+constexpr double kInf = std::numeric_limits<double>::infinity();
+// Cutters are grown this much (mm) past the antipad to absorb grid rounding.
+constexpr double kSnapMargin = 2e-6;
+
+struct IPt {
+    int64_t x, y;
+};
+
+bool same(IPt a, IPt b) { return a.x == b.x && a.y == b.y; }
+
+/// Sweep order: by y, then x.  Pieces are stored running upward in it.
+bool below(IPt a, IPt b) { return a.y < b.y || (a.y == b.y && a.x < b.x); }
+
+int64_t cross(IPt o, IPt a, IPt b) {
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+using Ring = std::vector<IPt>;
+
+struct Polygon {
+    Ring outer;
+    std::vector<Ring> holes;
+};
+
+/// Signed area in nm^2, counter-clockwise positive.
+double ring_area(const Ring& ring) {
+    double sum = 0.0;
+    for (size_t i = 1; i + 1 < ring.size(); ++i) {
+        sum += static_cast<double>(cross(ring[0], ring[i], ring[i + 1]));
+    }
+    return 0.5 * sum;
+}
+
+double polygons_area(const std::vector<Polygon>& polygons) {
+    double sum = 0.0;
+    for (const Polygon& poly : polygons) {
+        sum += ring_area(poly.outer);
+        for (const Ring& hole : poly.holes) sum += ring_area(hole);
+    }
+    return sum;
+}
+
+/// Directed input edge and the winding it adds walking a -> b.
+struct Edge {
+    IPt a, b;
+    int subject, clip;
+};
+
+/// Undirected boundary piece, p below q, with its net winding.
+struct Piece {
+    IPt p, q;
+    int subject, clip;
+};
+
+bool on_segment(IPt a, IPt b, IPt p) {
+    return std::min(a.x, b.x) <= p.x && p.x <= std::max(a.x, b.x) &&
+           std::min(a.y, b.y) <= p.y && p.y <= std::max(a.y, b.y);
+}
+
+/// Record where edges i and j meet; true for a proper crossing (a rounded point).
+bool add_crossings(const std::vector<Edge>& edges, size_t i, size_t j, std::vector<std::vector<IPt>>& cuts) {
+    const IPt a = edges[i].a, b = edges[i].b, c = edges[j].a, d = edges[j].b;
+    const int64_t d1 = cross(a, b, c), d2 = cross(a, b, d);
+    const int64_t d3 = cross(c, d, a), d4 = cross(c, d, b);
+    if (((d1 > 0 && d2 < 0) || (d1 < 0 && d2 > 0)) && ((d3 > 0 && d4 < 0) || (d3 < 0 && d4 > 0))) {
+        const double t = static_cast<double>(d3) / (static_cast<double>(d3) - static_cast<double>(d4));
+        const IPt x{
+            a.x + std::llround(t * static_cast<double>(b.x - a.x)),
+            a.y + std::llround(t * static_cast<double>(b.y - a.y)),
+        };
+        cuts[i].push_back(x);
+        cuts[j].push_back(x);
+        return true;
+    }
+    // Touching and collinear overlaps split at the shared endpoints.
+    if (d1 == 0 && on_segment(a, b, c)) cuts[i].push_back(c);
+    if (d2 == 0 && on_segment(a, b, d)) cuts[i].push_back(d);
+    if (d3 == 0 && on_segment(c, d, a)) cuts[j].push_back(a);
+    if (d4 == 0 && on_segment(c, d, b)) cuts[j].push_back(b);
+    return false;
+}
+
+/// One splitting pass: every edge cut wherever another touches or crosses
+/// it.  ``crossed`` is set when a crossing point had to be rounded.
+std::vector<Piece> split_pass(const std::vector<Edge>& edges, bool& crossed) {
+    const size_t n = edges.size();
+    std::vector<std::vector<IPt>> cuts(n);
+    if (n > 0) {
+        int64_t min_x = edges[0].a.x, min_y = edges[0].a.y, max_x = min_x, max_y = min_y;
+        for (const Edge& e : edges) {
+            min_x = std::min({min_x, e.a.x, e.b.x});
+            min_y = std::min({min_y, e.a.y, e.b.y});
+            max_x = std::max({max_x, e.a.x, e.b.x});
+            max_y = std::max({max_y, e.a.y, e.b.y});
+        }
+        // Uniform grid of ~n cells; a pair is tested only in the cell holding
+        // the low corner of their bounding-box overlap, so once.
+        const int64_t side = std::max<int64_t>(1, static_cast<int64_t>(std::ceil(std::sqrt(static_cast<double>(n)))));
+        const int64_t cell = std::max<int64_t>(1, (std::max(max_x - min_x, max_y - min_y) + side) / side);
+        auto cx = [&](int64_t v) { return std::min(side - 1, (v - min_x) / cell); };
+        auto cy = [&](int64_t v) { return std::min(side - 1, (v - min_y) / cell); };
+        // Cell contents as one flat array (counted, then filled).
+        std::vector<size_t> start(static_cast<size_t>(side * side) + 1, 0);
+        auto each_cell = [&](const Edge& e, auto&& visit) {
+            for (int64_t gy = cy(std::min(e.a.y, e.b.y)); gy <= cy(std::max(e.a.y, e.b.y)); ++gy) {
+                for (int64_t gx = cx(std::min(e.a.x, e.b.x)); gx <= cx(std::max(e.a.x, e.b.x)); ++gx) {
+                    visit(static_cast<size_t>(gy * side + gx));
+                }
+            }
+        };
+        for (const Edge& e : edges) each_cell(e, [&](size_t g) { ++start[g + 1]; });
+        for (size_t g = 1; g < start.size(); ++g) start[g] += start[g - 1];
+        std::vector<size_t> fill_at(start.begin(), start.end() - 1);
+        std::vector<size_t> ids(start.back());
+        for (size_t i = 0; i < n; ++i) each_cell(edges[i], [&](size_t g) { ids[fill_at[g]++] = i; });
+        for (int64_t g = 0; g < side * side; ++g) {
+            const size_t lo = start[static_cast<size_t>(g)], hi = start[static_cast<size_t>(g) + 1];
+            for (size_t u = lo; u < hi; ++u) {
+                const Edge& e = edges[ids[u]];
+                for (size_t v = u + 1; v < hi; ++v) {
+                    const Edge& f = edges[ids[v]];
+                    const int64_t lo_x = std::max(std::min(e.a.x, e.b.x), std::min(f.a.x, f.b.x));
+                    const int64_t lo_y = std::max(std::min(e.a.y, e.b.y), std::min(f.a.y, f.b.y));
+                    if (lo_x > std::min(std::max(e.a.x, e.b.x), std::max(f.a.x, f.b.x)) ||
+                        lo_y > std::min(std::max(e.a.y, e.b.y), std::max(f.a.y, f.b.y)) ||
+                        cy(lo_y) * side + cx(lo_x) != g) {
+                        continue;
+                    }
+                    if (add_crossings(edges, ids[u], ids[v], cuts)) {
+                        crossed = true;
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<Piece> pieces;
+    for (size_t i = 0; i < n; ++i) {
+        const Edge& e = edges[i];
+        const int64_t dx = e.b.x - e.a.x, dy = e.b.y - e.a.y;
+        const int64_t len2 = dx * dx + dy * dy;
+        auto along = [&](IPt p) { return (p.x - e.a.x) * dx + (p.y - e.a.y) * dy; };
+        std::vector<IPt>& pts = cuts[i];
+        // A crossing rounded onto or past an end would detach the edge from
+        // its neighbour; the end itself already splits there.
+        pts.erase(std::remove_if(pts.begin(), pts.end(), [&](IPt p) {
+            const int64_t t = along(p);
+            return t <= 0 || t >= len2;
+        }), pts.end());
+        pts.push_back(e.a);
+        pts.push_back(e.b);
+        std::sort(pts.begin(), pts.end(), [&](IPt p, IPt q) { return along(p) < along(q); });
+        pts.erase(std::unique(pts.begin(), pts.end(), same), pts.end());
+        for (size_t k = 0; k + 1 < pts.size(); ++k) {
+            if (below(pts[k], pts[k + 1])) {
+                pieces.push_back({pts[k], pts[k + 1], e.subject, e.clip});
+            } else {
+                pieces.push_back({pts[k + 1], pts[k], -e.subject, -e.clip});
+            }
+        }
+    }
+
+    return pieces;
+}
+
+/// Split every edge wherever another touches or crosses it, and merge the
+/// coincident pieces (their windings add; pieces that cancel are dropped).
+///
+/// A rounded crossing point can land a piece across a neighbouring edge,
+/// so passes repeat over the pieces until no crossing is left.
+std::vector<Piece> split_edges(const std::vector<Edge>& edges) {
+    constexpr int kMaxPasses = 8;
+    bool crossed = false;
+    std::vector<Piece> pieces = split_pass(edges, crossed);
+    for (int pass = 1; crossed && pass < kMaxPasses; ++pass) {
+        std::vector<Edge> again;
+        again.reserve(pieces.size());
+        for (const Piece& s : pieces) again.push_back({s.p, s.q, s.subject, s.clip});
+        crossed = false;
+        pieces = split_pass(again, crossed);
+    }
+
+    std::sort(pieces.begin(), pieces.end(), [](const Piece& s, const Piece& t) {
+        if (!same(s.p, t.p)) return below(s.p, t.p);
+        return below(s.q, t.q);
+    });
+    std::vector<Piece> merged;
+    for (const Piece& s : pieces) {
+        if (!merged.empty() && same(merged.back().p, s.p) && same(merged.back().q, s.q)) {
+            merged.back().subject += s.subject;
+            merged.back().clip += s.clip;
+        } else {
+            merged.push_back(s);
+        }
+    }
+    merged.erase(std::remove_if(merged.begin(), merged.end(), [](const Piece& s) {
+        return s.subject == 0 && s.clip == 0;
+    }), merged.end());
+    return merged;
+}
+
+/// Winding numbers of the pieces to the right of a point, by a +x ray.
+///
+/// Points are given doubled (a piece midpoint is p + q).  ``upper`` casts
+/// the ray just above the point's row, otherwise just below it.
+class Winding {
+public:
+    explicit Winding(const std::vector<Piece>& pieces) : pieces_(pieces) {
+        int64_t lo = std::numeric_limits<int64_t>::max(), hi = std::numeric_limits<int64_t>::min();
+        for (const Piece& s : pieces) {
+            lo = std::min(lo, 2 * s.p.y);
+            hi = std::max(hi, 2 * s.q.y);
+        }
+        if (pieces.empty()) return;
+        lo_ = lo;
+        count_ = std::max<int64_t>(1, static_cast<int64_t>(pieces.size() / 4));
+        height_ = (hi - lo) / count_ + 1;
+        // Band contents as one flat array (counted, then filled);
+        // horizontal pieces never cross the ray.
+        start_.assign(static_cast<size_t>(count_) + 1, 0);
+        for (const Piece& s : pieces) {
+            if (s.p.y == s.q.y) continue;
+            for (int64_t b = band(2 * s.p.y); b <= band(2 * s.q.y); ++b) ++start_[static_cast<size_t>(b) + 1];
+        }
+        for (size_t b = 1; b < start_.size(); ++b) start_[b] += start_[b - 1];
+        std::vector<size_t> fill_at(start_.begin(), start_.end() - 1);
+        ids_.resize(start_.back());
+        for (size_t i = 0; i < pieces.size(); ++i) {
+            const Piece& s = pieces[i];
+            if (s.p.y == s.q.y) continue;
+            for (int64_t b = band(2 * s.p.y); b <= band(2 * s.q.y); ++b) ids_[fill_at[static_cast<size_t>(b)]++] = i;
+        }
+    }
+
+    std::pair<int, int> at(int64_t mx2, int64_t my2, bool upper, size_t skip) const {
+        std::pair<int, int> w{0, 0};
+        if (start_.empty() || my2 < lo_ || band(my2) >= count_) return w;
+        const size_t b = static_cast<size_t>(band(my2));
+        for (size_t k = start_[b]; k < start_[b + 1]; ++k) {
+            const size_t i = ids_[k];
+            if (i == skip) continue;
+            const Piece& s = pieces_[i];
+            const bool spans = upper ? (2 * s.p.y <= my2 && my2 < 2 * s.q.y)
+                                     : (2 * s.p.y < my2 && my2 <= 2 * s.q.y);
+            if (!spans) continue;
+            const int64_t side = (s.q.x - s.p.x) * (my2 - 2 * s.p.y) - (s.q.y - s.p.y) * (mx2 - 2 * s.p.x);
+            if (side > 0) {
+                w.first += s.subject;
+                w.second += s.clip;
+            }
+        }
+        return w;
+    }
+
+private:
+    int64_t band(int64_t y2) const { return (y2 - lo_) / height_; }
+
+    const std::vector<Piece>& pieces_;
+    int64_t lo_ = 0;
+    int64_t count_ = 0;
+    int64_t height_ = 1;
+    std::vector<size_t> start_;  // band b holds ids_[start_[b] .. start_[b + 1])
+    std::vector<size_t> ids_;
+};
+
+/// Collinear vertices (straight runs and zero-width spikes) removed.
+Ring simplify(const Ring& ring) {
+    Ring out;
+    for (const IPt& p : ring) {
+        while (out.size() >= 2 && cross(out[out.size() - 2], out.back(), p) == 0) out.pop_back();
+        out.push_back(p);
+    }
+    while (out.size() >= 3 && cross(out[out.size() - 2], out.back(), out[0]) == 0) out.pop_back();
+    while (out.size() >= 3 && cross(out.back(), out[0], out[1]) == 0) out.erase(out.begin());
+    return out;
+}
+
+/// Chain directed boundary edges into rings, turning as far left as
+/// possible at shared vertices so touching regions stay separate.
+bool link_rings(std::vector<std::pair<IPt, IPt>>& edges, std::vector<Ring>& rings) {
+    std::sort(edges.begin(), edges.end(), [](const auto& s, const auto& t) {
+        if (!same(s.first, t.first)) return below(s.first, t.first);
+        return below(s.second, t.second);
+    });
+    std::vector<char> used(edges.size(), 0);
+    for (size_t start = 0; start < edges.size(); ++start) {
+        if (used[start]) continue;
+        used[start] = 1;
+        Ring ring;
+        size_t cur = start;
+        while (true) {
+            ring.push_back(edges[cur].first);
+            const IPt from = edges[cur].first, v = edges[cur].second;
+            if (same(v, edges[start].first)) break;
+            auto lo = std::lower_bound(edges.begin(), edges.end(), v, [](const auto& e, IPt p) {
+                return below(e.first, p);
+            });
+            size_t best = edges.size();
+            double best_turn = -kInf;
+            for (auto it = lo; it != edges.end() && same(it->first, v); ++it) {
+                const size_t k = static_cast<size_t>(it - edges.begin());
+                if (used[k]) continue;
+                const IPt g = it->second;
+                const double turn = std::atan2(
+                    static_cast<double>(cross(from, v, g) ),
+                    static_cast<double>((v.x - from.x) * (g.x - v.x) + (v.y - from.y) * (g.y - v.y))
+                );
+                if (turn > best_turn) {
+                    best_turn = turn;
+                    best = k;
+                }
+            }
+            if (best == edges.size()) return false;  // open chain: not a clean boolean
+            used[best] = 1;
+            cur = best;
+        }
+        Ring clean = simplify(ring);
+        if (clean.size() >= 3) rings.push_back(std::move(clean));
+    }
+    return true;
+}
+
+bool ring_contains(const Ring& ring, int64_t mx2, int64_t my2) {
+    int w = 0;
+    for (size_t i = 0, n = ring.size(); i < n; ++i) {
+        IPt p = ring[i], q = ring[(i + 1) % n];
+        int k = 1;
+        if (below(q, p)) {
+            std::swap(p, q);
+            k = -1;
+        }
+        if (p.y == q.y || !(2 * p.y <= my2 && my2 < 2 * q.y)) continue;
+        if ((q.x - p.x) * (my2 - 2 * p.y) - (q.y - p.y) * (mx2 - 2 * p.x) > 0) w += k;
+    }
+    return w != 0;
+}
+
+enum class Op { Difference, Intersection };
+
+/// Directed boundary of subject - clip or subject & clip (both under the
+/// non-zero rule), inside on the left of every edge.
+std::vector<std::pair<IPt, IPt>> boolean_boundary(const std::vector<Ring>& subject, const std::vector<Ring>& clip, Op op) {
+    std::vector<Edge> edges;
+    auto add = [&](const std::vector<Ring>& rings, int s, int c) {
+        for (const Ring& ring : rings) {
+            for (size_t i = 0, n = ring.size(); i < n; ++i) {
+                if (!same(ring[i], ring[(i + 1) % n])) edges.push_back({ring[i], ring[(i + 1) % n], s, c});
+            }
+        }
+    };
+    add(subject, 1, 0);
+    add(clip, 0, 1);
+    const std::vector<Piece> pieces = split_edges(edges);
+    const Winding winding(pieces);
+    auto inside = [op](std::pair<int, int> w) {
+        return w.first != 0 && (op == Op::Difference ? w.second == 0 : w.second != 0);
+    };
+
+    std::vector<std::pair<IPt, IPt>> boundary;
+    for (size_t i = 0; i < pieces.size(); ++i) {
+        const Piece& s = pieces[i];
+        const int64_t mx2 = s.p.x + s.q.x, my2 = s.p.y + s.q.y;
+        bool left, right;  // walking p -> q
+        if (s.p.y == s.q.y) {
+            left = inside(winding.at(mx2, my2, true, pieces.size()));
+            right = inside(winding.at(mx2, my2, false, pieces.size()));
+        } else {
+            const std::pair<int, int> w = winding.at(mx2, my2, true, i);
+            right = inside(w);
+            left = inside({w.first + s.subject, w.second + s.clip});
+        }
+        if (left && !right) boundary.emplace_back(s.p, s.q);
+        if (right && !left) boundary.emplace_back(s.q, s.p);
+    }
+    return boundary;
+}
+
+/// Area (nm^2) of a boolean result, straight from its boundary, so
+/// slivers that do not chain into clean rings still count.
+double boolean_area(const std::vector<Ring>& subject, const std::vector<Ring>& clip, Op op) {
+    double sum = 0.0;
+    for (const auto& [a, b] : boolean_boundary(subject, clip, op)) {
+        sum += static_cast<double>(cross(IPt{0, 0}, a, b));
+    }
+    return 0.5 * sum;
+}
+
+/// The boolean result as polygons; false when its boundary does not chain
+/// into closed rings.
+bool clip_rings(const std::vector<Ring>& subject, const std::vector<Ring>& clip, Op op, std::vector<Polygon>& out) {
+    std::vector<std::pair<IPt, IPt>> boundary = boolean_boundary(subject, clip, op);
+    std::vector<Ring> rings;
+    if (!link_rings(boundary, rings)) return false;
+    std::vector<size_t> outers;
+    for (size_t r = 0; r < rings.size(); ++r) {
+        if (ring_area(rings[r]) > 0.0) {
+            outers.push_back(out.size());
+            out.push_back({rings[r], {}});
+        }
+    }
+    for (Ring& ring : rings) {
+        if (ring_area(ring) >= 0.0) continue;
+        const int64_t mx2 = ring[0].x + ring[1].x, my2 = ring[0].y + ring[1].y;
+        size_t owner = out.size();
+        double owner_area = kInf;
+        for (size_t k : outers) {
+            const double area = ring_area(out[k].outer);
+            if (area < owner_area && ring_contains(out[k].outer, mx2, my2)) {
+                owner = k;
+                owner_area = area;
+            }
+        }
+        if (owner < out.size()) out[owner].holes.push_back(std::move(ring));
+    }
+    return true;
+}
+
+struct DPt {
+    double x, y;
+};
+
+DPt closest_on_segment(DPt p, DPt a, DPt b) {
+    const double dx = b.x - a.x, dy = b.y - a.y;
+    const double len2 = dx * dx + dy * dy;
+    const double t = len2 > 0.0 ? std::clamp(((p.x - a.x) * dx + (p.y - a.y) * dy) / len2, 0.0, 1.0) : 0.0;
+    return {a.x + t * dx, a.y + t * dy};
+}
+
+/// Ring edges bucketed on a uniform grid of about one cell per vertex.
+class EdgeGrid {
+public:
+    struct EdgeRef {
+        size_t ring, index;
+    };
+
+    explicit EdgeGrid(std::vector<const Ring*> rings) : rings_(std::move(rings)) {
+        size_t points = 0;
+        for (const Ring* ring : rings_) {
+            for (const IPt& p : *ring) {
+                min_x_ = std::min(min_x_, static_cast<double>(p.x));
+                min_y_ = std::min(min_y_, static_cast<double>(p.y));
+                max_x_ = std::max(max_x_, static_cast<double>(p.x));
+                max_y_ = std::max(max_y_, static_cast<double>(p.y));
+            }
+            points += ring->size();
+        }
+        if (points == 0) return;
+        side_ = std::max<int64_t>(1, static_cast<int64_t>(std::sqrt(static_cast<double>(points))));
+        cell_ = std::max(1.0, std::max(max_x_ - min_x_, max_y_ - min_y_) / static_cast<double>(side_));
+        cells_.resize(static_cast<size_t>(side_ * side_));
+        for (size_t r = 0; r < rings_.size(); ++r) {
+            for (size_t j = 0, m = rings_[r]->size(); j < m; ++j) {
+                const DPt e0 = point(r, j), e1 = point(r, (j + 1) % m);
+                for (int64_t gy = cell_y(std::min(e0.y, e1.y)); gy <= cell_y(std::max(e0.y, e1.y)); ++gy) {
+                    for (int64_t gx = cell_x(std::min(e0.x, e1.x)); gx <= cell_x(std::max(e0.x, e1.x)); ++gx) {
+                        cells_[static_cast<size_t>(gy * side_ + gx)].push_back({r, j});
+                    }
+                }
+            }
+        }
+    }
+
+    const Ring& ring(size_t r) const { return *rings_[r]; }
+    DPt point(size_t r, size_t i) const {
+        const IPt p = (*rings_[r])[i];
+        return {static_cast<double>(p.x), static_cast<double>(p.y)};
+    }
+    int64_t side() const { return cells_.empty() ? 0 : side_; }
+    double cell() const { return cell_; }
+    int64_t cell_x(double x) const {
+        return std::clamp<int64_t>(static_cast<int64_t>(std::floor((x - min_x_) / cell_)), 0, side_ - 1);
+    }
+    int64_t cell_y(double y) const {
+        return std::clamp<int64_t>(static_cast<int64_t>(std::floor((y - min_y_) / cell_)), 0, side_ - 1);
+    }
+    const std::vector<EdgeRef>& at(int64_t gx, int64_t gy) const {
+        return cells_[static_cast<size_t>(gy * side_ + gx)];
+    }
+
+    /// Every edge in a cell overlapping the box (an edge may repeat).
+    template <class Visit>
+    void visit(double lo_x, double lo_y, double hi_x, double hi_y, Visit visit) const {
+        if (cells_.empty() || hi_x < min_x_ || lo_x > max_x_ || hi_y < min_y_ || lo_y > max_y_) return;
+        for (int64_t gy = cell_y(lo_y); gy <= cell_y(hi_y); ++gy) {
+            for (int64_t gx = cell_x(lo_x); gx <= cell_x(hi_x); ++gx) {
+                for (const EdgeRef& e : at(gx, gy)) visit(e);
+            }
+        }
+    }
+
+    /// Whether (x, y) lies inside some ring (non-zero winding), casting a
+    /// +x ray along the point's row of cells.
+    bool contains(IPt c) const {
+        if (cells_.empty()) return false;
+        const double cy = static_cast<double>(c.y);
+        if (cy < min_y_ || cy > max_y_) return false;
+        const int64_t gy = cell_y(cy);
+        int w = 0;
+        for (int64_t gx = cell_x(static_cast<double>(c.x)); gx < side_; ++gx) {
+            for (const EdgeRef& e : at(gx, gy)) {
+                const Ring& ring = *rings_[e.ring];
+                IPt p = ring[e.index], q = ring[(e.index + 1) % ring.size()];
+                int k = 1;
+                if (below(q, p)) {
+                    std::swap(p, q);
+                    k = -1;
+                }
+                if (p.y == q.y || !(p.y <= c.y && c.y < q.y) || cross(p, q, c) <= 0) continue;
+                // Count each edge once: in the cell where it meets the row.
+                const double x = static_cast<double>(p.x) + static_cast<double>(q.x - p.x) *
+                    static_cast<double>(c.y - p.y) / static_cast<double>(q.y - p.y);
+                if (std::clamp(cell_x(x), cell_x(static_cast<double>(c.x)), side_ - 1) == gx) w += k;
+            }
+        }
+        return w != 0;
+    }
+
+private:
+    std::vector<const Ring*> rings_;
+    double min_x_ = kInf, min_y_ = kInf, max_x_ = -kInf, max_y_ = -kInf;
+    int64_t side_ = 1;
+    double cell_ = 1.0;
+    std::vector<std::vector<EdgeRef>> cells_;
+};
+
+/// Hair-thin slits that open every hole of a polygon.
+///
+/// Holes are taken from the outside in (by depth inside the polygon's
+/// bounding box) and each is slit to the nearest ring already open: the
+/// exterior or a hole before it.  Slits then stay about as long as the gap
+/// between neighbouring antipads instead of reaching across the fill.
+class Vents {
+public:
+    explicit Vents(const Polygon& poly) : grid_(rings(poly)), rank_(poly.holes.size() + 1, 0) {}
+
+    /// One slit per hole: a thin rectangle between the closest points,
+    /// overrunning both ends by twice its half-width so subtracting it
+    /// opens the hole.
+    std::vector<Ring> slits(double half_width) {
+        const size_t holes = rank_.size() - 1;
+        double min_x = kInf, min_y = kInf, max_x = -kInf, max_y = -kInf;
+        for (const IPt& p : grid_.ring(0)) {
+            min_x = std::min(min_x, static_cast<double>(p.x));
+            min_y = std::min(min_y, static_cast<double>(p.y));
+            max_x = std::max(max_x, static_cast<double>(p.x));
+            max_y = std::max(max_y, static_cast<double>(p.y));
+        }
+        std::vector<std::pair<double, size_t>> order;
+        for (size_t h = 1; h <= holes; ++h) {
+            double depth = kInf;
+            for (const IPt& p : grid_.ring(h)) {
+                const double x = static_cast<double>(p.x), y = static_cast<double>(p.y);
+                depth = std::min({depth, x - min_x, max_x - x, y - min_y, max_y - y});
+            }
+            order.emplace_back(depth, h);
+        }
+        std::sort(order.begin(), order.end());
+        for (size_t k = 0; k < holes; ++k) rank_[order[k].second] = k + 1;
+
+        std::vector<Ring> out;
+        for (const auto& entry : order) {
+            const auto [from, to] = nearest(entry.second);
+            double ux = to.x - from.x, uy = to.y - from.y;
+            const double len = std::hypot(ux, uy);
+            if (len < 1e-9) {
+                ux = 0.0;
+                uy = 1.0;
+            } else {
+                ux /= len;
+                uy /= len;
+            }
+            const double reach = 2.0 * half_width;
+            const DPt a{from.x - ux * reach, from.y - uy * reach};
+            const DPt b{to.x + ux * reach, to.y + uy * reach};
+            const double nx = -uy * half_width, ny = ux * half_width;
+            auto grid = [](double x, double y) { return IPt{std::llround(x), std::llround(y)}; };
+            out.push_back({grid(a.x - nx, a.y - ny), grid(b.x - nx, b.y - ny), grid(b.x + nx, b.y + ny),
+                           grid(a.x + nx, a.y + ny)});
+        }
+        return out;
+    }
+
+private:
+    static std::vector<const Ring*> rings(const Polygon& poly) {
+        std::vector<const Ring*> out{&poly.outer};
+        for (const Ring& hole : poly.holes) out.push_back(&hole);
+        return out;
+    }
+
+    /// Closest points from hole h to the nearest ring ranked before it.
+    std::pair<DPt, DPt> nearest(size_t h) const {
+        const Ring& hole = grid_.ring(h);
+        double lo_x = kInf, lo_y = kInf, hi_x = -kInf, hi_y = -kInf;
+        for (const IPt& p : hole) {
+            lo_x = std::min(lo_x, static_cast<double>(p.x));
+            lo_y = std::min(lo_y, static_cast<double>(p.y));
+            hi_x = std::max(hi_x, static_cast<double>(p.x));
+            hi_y = std::max(hi_y, static_cast<double>(p.y));
+        }
+        const int64_t side = grid_.side();
+        const int64_t gx0 = grid_.cell_x(lo_x), gx1 = grid_.cell_x(hi_x);
+        const int64_t gy0 = grid_.cell_y(lo_y), gy1 = grid_.cell_y(hi_y);
+        double best = kInf;
+        DPt from{0.0, 0.0}, to{0.0, 0.0};
+        // Grow a square of cells around the hole until no unvisited cell can
+        // hold anything closer than the best so far.
+        for (int64_t r = 0; r <= side; ++r) {
+            for (int64_t gy = std::max<int64_t>(0, gy0 - r); gy <= std::min(side - 1, gy1 + r); ++gy) {
+                for (int64_t gx = std::max<int64_t>(0, gx0 - r); gx <= std::min(side - 1, gx1 + r); ++gx) {
+                    if (gx != gx0 - r && gx != gx1 + r && gy != gy0 - r && gy != gy1 + r) continue;
+                    for (const EdgeGrid::EdgeRef& e : grid_.at(gx, gy)) {
+                        if (rank_[e.ring] < rank_[h]) closest(hole, e, best, from, to);
+                    }
+                }
+            }
+            if (best <= static_cast<double>(r) * grid_.cell()) break;
+        }
+        return {from, to};
+    }
+
+    /// Closest points between the hole and edge e, if nearer than best.
+    void closest(const Ring& hole, EdgeGrid::EdgeRef e, double& best, DPt& from, DPt& to) const {
+        const DPt e0 = grid_.point(e.ring, e.index);
+        const DPt e1 = grid_.point(e.ring, (e.index + 1) % grid_.ring(e.ring).size());
+        for (size_t i = 0, n = hole.size(); i < n; ++i) {
+            const DPt h0{static_cast<double>(hole[i].x), static_cast<double>(hole[i].y)};
+            const DPt h1{static_cast<double>(hole[(i + 1) % n].x), static_cast<double>(hole[(i + 1) % n].y)};
+            const double gap_x = std::max({0.0, std::min(e0.x, e1.x) - std::max(h0.x, h1.x),
+                                           std::min(h0.x, h1.x) - std::max(e0.x, e1.x)});
+            const double gap_y = std::max({0.0, std::min(e0.y, e1.y) - std::max(h0.y, h1.y),
+                                           std::min(h0.y, h1.y) - std::max(e0.y, e1.y)});
+            if (std::hypot(gap_x, gap_y) >= best) continue;
+            const std::pair<DPt, DPt> candidates[4] = {
+                {h0, closest_on_segment(h0, e0, e1)},
+                {h1, closest_on_segment(h1, e0, e1)},
+                {closest_on_segment(e0, h0, h1), e0},
+                {closest_on_segment(e1, h0, h1), e1},
+            };
+            for (const auto& [a, b] : candidates) {
+                const double d = std::hypot(b.x - a.x, b.y - a.y);
+                if (d < best) {
+                    best = d;
+                    from = a;
+                    to = b;
+                }
+            }
+        }
+    }
+
+    EdgeGrid grid_;
+    std::vector<size_t> rank_;  // 0 = exterior, k = k-th hole vented
+};
+
+template <class Work>
+void run_parallel(size_t tasks, int num_threads, Work work) {
+    size_t threads = num_threads > 0
+        ? static_cast<size_t>(num_threads)
+        : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, tasks));
+    std::atomic<size_t> next{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    auto worker = [&]() {
+        try {
+            for (size_t k = next.fetch_add(1); k < tasks; k = next.fetch_add(1)) work(k);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failure_mutex);
+            if (!failure) failure = std::current_exception();
+            next.store(tasks);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (std::thread& th : pool) th.join();
+    if (failure) std::rethrow_exception(failure);
+}
+
+void validate_job(const ZoneFillJob& job) {
+    const size_t nf = job.fill_layer.size();
+    if (job.fill_net.size() != nf || job.fill_antipad.size() != nf || job.fill_offsets.size() != nf + 1) {
+        throw std::invalid_argument("carve_zone_fills: fill arrays must have matching lengths");
+    }
+    if (job.fill_x.size() != job.fill_y.size() || job.fill_offsets.front() != 0 ||
+        job.fill_offsets.back() != static_cast<int>(job.fill_x.size()) ||
+        !std::is_sorted(job.fill_offsets.begin(), job.fill_offsets.end())) {
+        throw std::invalid_argument("carve_zone_fills: fill offsets must run from 0 to the point count");
+    }
+    const size_t no = job.obstacles.size();
+    if (job.obstacle_layers.size() != no || job.obstacle_net.size() != no || job.obstacle_cuts.size() != no) {
+        throw std::invalid_argument("carve_zone_fills: obstacle arrays must have matching lengths");
+    }
+}
+
+/// One fill's outcome, rings in board millimetres.
+struct Carved {
+    int status = FILL_UNCHANGED;
+    std::vector<std::vector<std::pair<double, double>>> rings;
+};
+
+Carved carve_fill(
+    const ZoneFillJob& job,
+    const ZoneFillRules& rules,
+    const std::vector<double>& reach,
+    size_t k
+) {
+    Carved out;
+    const int begin = job.fill_offsets[k], end = job.fill_offsets[k + 1];
+    if (end - begin < 3) return out;
+    double min_x = kInf, min_y = kInf, max_x = -kInf, max_y = -kInf;
+    for (int i = begin; i < end; ++i) {
+        min_x = std::min(min_x, job.fill_x[i]);
+        min_y = std::min(min_y, job.fill_y[i]);
+        max_x = std::max(max_x, job.fill_x[i]);
+        max_y = std::max(max_y, job.fill_y[i]);
+    }
+    const int layer = job.fill_layer[k];
+    const uint64_t bit = layer >= 0 && layer < 64 ? uint64_t{1} << layer : 0;
+    const double antipad = job.fill_antipad[k];
+
+    std::vector<std::vector<std::pair<double, double>>> cutters;
+    std::vector<size_t> cutting, anchors;
+    for (size_t o = 0; o < job.obstacles.size(); ++o) {
+        if (!(job.obstacle_layers[o] & bit)) continue;
+        const PadShape& shape = job.obstacles[o];
+        if (job.obstacle_net[o] == job.fill_net[k]) {
+            anchors.push_back(o);
+            continue;
+        }
+        if (!job.obstacle_cuts[o]) continue;
+        const double r = reach[o] + antipad;
+        if (shape.x + r < min_x || shape.x - r > max_x || shape.y + r < min_y || shape.y - r > max_y) continue;
+        cutting.push_back(o);
+        cutters.push_back(inflated_outline(shape, antipad + kSnapMargin, rules.arc_segments));
+    }
+    if (cutters.empty()) return out;
+
+    // A whole-nanometre origin, so output coordinates survive the 6-decimal
+    // rounding the S-expression writer applies.
+    const double ox = std::round(0.5 * (min_x + max_x) * kNmPerMm) / kNmPerMm;
+    const double oy = std::round(0.5 * (min_y + max_y) * kNmPerMm) / kNmPerMm;
+    auto to_grid = [&](auto&& point, size_t n, Ring& ring) {
+        for (size_t i = 0; i < n; ++i) {
+            const auto [x, y] = point(i);
+            const double gx = (x - ox) * kNmPerMm, gy = (y - oy) * kNmPerMm;
+            if (!(std::fabs(gx) < kMaxSpan && std::fabs(gy) < kMaxSpan)) return false;
+            const IPt p{std::llround(gx), std::llround(gy)};
+            if (ring.empty() || !same(ring.back(), p)) ring.push_back(p);
+        }
+        while (ring.size() > 1 && same(ring.front(), ring.back())) ring.pop_back();
+        return true;
+    };
+    std::vector<Ring> fill(1), cut(cutters.size());
+    const bool in_span = to_grid([&](size_t i) {
+        return std::pair<double, double>{job.fill_x[begin + i], job.fill_y[begin + i]};
+    }, static_cast<size_t>(end - begin), fill[0]);
+    if (!in_span) {
+        out.status = FILL_UNSUPPORTED;
+        return out;
+    }
+    for (size_t c = 0; c < cutters.size(); ++c) {
+        if (!to_grid([&](size_t i) { return cutters[c][i]; }, cutters[c].size(), cut[c])) {
+            out.status = FILL_UNSUPPORTED;
+            return out;
+        }
+    }
+
+    std::vector<Polygon> carved;
+    if (!clip_rings(fill, cut, Op::Difference, carved)) {
+        out.status = FILL_UNSUPPORTED;
+        return out;
+    }
+    const double eps = rules.area_epsilon * kNm2PerMm2;
+    if (std::fabs(ring_area(fill[0])) - polygons_area(carved) <= eps) return out;
+    out.status = FILL_KEPT;
+    if (carved.empty()) return out;
+
+    // Vent every hole; only exteriors survive.
+    std::vector<Ring> rings;
+    const double half_width = rules.slit_width * kNmPerMm;
+    for (Polygon& poly : carved) {
+        if (poly.holes.empty()) {
+            rings.push_back(std::move(poly.outer));
+            continue;
+        }
+        const std::vector<Ring> slits = Vents(poly).slits(half_width);
+        std::vector<Ring> body{poly.outer};
+        for (Ring& hole : poly.holes) body.push_back(std::move(hole));
+        std::vector<Polygon> vented;
+        if (!clip_rings(body, slits, Op::Difference, vented)) {
+            out.status = FILL_UNSUPPORTED;
+            return out;
+        }
+        for (Polygon& part : vented) rings.push_back(std::move(part.outer));
+    }
+    if (rings.empty()) return out;
+
+    auto board_ring = [&](const Ring& ring) {
+        std::vector<std::pair<double, double>> pts;
+        pts.reserve(ring.size());
+        for (const IPt& p : ring) {
+            pts.emplace_back(ox + static_cast<double>(p.x) / kNmPerMm, oy + static_cast<double>(p.y) / kNmPerMm);
+        }
+        return pts;
+    };
+
+    // Islands: keep the rings touching same-net copper (all of them when
+    // the net has none on this layer, the largest when none touch).
+    if (rings.size() > 1 && !anchors.empty()) {
+        std::vector<Ring> kept;
+        size_t largest = 0;
+        for (size_t r = 0; r < rings.size(); ++r) {
+            if (ring_area(rings[r]) > ring_area(rings[largest])) largest = r;
+            PadShape island;
+            island.kind = PAD_SHAPE_POLYGON;
+            for (const auto& [x, y] : board_ring(rings[r])) {
+                island.polygon_x.push_back(x);
+                island.polygon_y.push_back(y);
+            }
+            const auto [lo_x, hi_x] = std::minmax_element(island.polygon_x.begin(), island.polygon_x.end());
+            const auto [lo_y, hi_y] = std::minmax_element(island.polygon_y.begin(), island.polygon_y.end());
+            for (size_t o : anchors) {
+                const PadShape& anchor = job.obstacles[o];
+                const double r0 = reach[o];
+                if (anchor.x + r0 < *lo_x || anchor.x - r0 > *hi_x || anchor.y + r0 < *lo_y || anchor.y - r0 > *hi_y) {
+                    continue;
+                }
+                if (pad_shape_clearance(anchor, island).clearance <= 0.0) {
+                    kept.push_back(rings[r]);
+                    break;
+                }
+            }
+        }
+        if (kept.empty()) kept.push_back(rings[largest]);
+        rings = std::move(kept);
+    }
+
+    // The rewrite must keep the antipad distance to every cutting obstacle,
+    // measured against its exact outline, and stay inside the old fill.
+    std::vector<const Ring*> kept;
+    for (const Ring& ring : rings) kept.push_back(&ring);
+    const EdgeGrid grid(std::move(kept));
+    auto board = [&](DPt p) { return DPt{ox + p.x / kNmPerMm, oy + p.y / kNmPerMm}; };
+    for (size_t o : cutting) {
+        const PadShape& shape = job.obstacles[o];
+        const IPt centre{std::llround((shape.x - ox) * kNmPerMm), std::llround((shape.y - oy) * kNmPerMm)};
+        if (grid.contains(centre)) return out;
+        const double r = (reach[o] + antipad) * kNmPerMm;
+        bool clear = true;
+        grid.visit(centre.x - r, centre.y - r, centre.x + r, centre.y + r, [&](EdgeGrid::EdgeRef e) {
+            if (!clear) return;
+            const DPt a = board(grid.point(e.ring, e.index));
+            const DPt b = board(grid.point(e.ring, (e.index + 1) % grid.ring(e.ring).size()));
+            PadShape edge;
+            edge.kind = PAD_SHAPE_OVAL;
+            edge.x = 0.5 * (a.x + b.x);
+            edge.y = 0.5 * (a.y + b.y);
+            edge.width = std::hypot(b.x - a.x, b.y - a.y);
+            edge.rotation_rad = std::atan2(b.y - a.y, b.x - a.x);
+            if (pad_shape_clearance(shape, edge).clearance < antipad) clear = false;
+        });
+        if (!clear) return out;
+    }
+    if (boolean_area(rings, fill, Op::Difference) > eps) return out;
+
+    out.status = FILL_CARVED;
+    for (const Ring& ring : rings) out.rings.push_back(board_ring(ring));
+    return out;
+}
+
+} // namespace
+
+ZoneFillResult carve_zone_fills(const ZoneFillJob& job, const ZoneFillRules& rules) {
+    validate_job(job);
+    std::vector<double> reach(job.obstacles.size());
+    for (size_t o = 0; o < job.obstacles.size(); ++o) reach[o] = bounding_radius(job.obstacles[o]);
+
+    const size_t nf = job.fill_layer.size();
+    std::vector<Carved> carved(nf);
+    run_parallel(nf, rules.num_threads, [&](size_t k) { carved[k] = carve_fill(job, rules, reach, k); });
+
+    ZoneFillResult out;
+    out.status.reserve(nf);
+    out.fill_rings.push_back(0);
+    out.ring_offsets.push_back(0);
+    for (Carved& fill : carved) {
+        out.status.push_back(fill.status);
+        for (const auto& ring : fill.rings) {
+            for (const auto& [x, y] : ring) {
+                out.ring_x.push_back(x);
+                out.ring_y.push_back(y);
+            }
+            out.ring_offsets.push_back(static_cast<int>(out.ring_x.size()));
+        }
+        out.fill_rings.push_back(static_cast<int>(out.ring_offsets.size()) - 1);
+        std::vector<std::vector<std::pair<double, double>>>().swap(fill.rings);
+    }
+    return out;
+}
+
+} // namespace drc
@@ -7,7 +7,7 @@ to pure Python.
 
 The C++ backend provides significant speedup for the O(P1 x P2) inner loop
 in pad-to-pad clearance computation by using:
-- Squared-distance optimization (avoids sqrt for non-minimum pairs)
+- SSE2/AVX2/AVX-512 kernels chosen at runtime, with a scalar fallback
 - Struct-of-arrays memory layout for contiguous access
 - Single trig computation per footprint
 - No Python interpreter overhead per iteration
@@ -19,7 +19,11 @@ import math
 from typing import TYPE_CHECKING
 
 if TYPE_CHECKING:
-    from kicad_tools.schema.pcb import Footprint
+    from collections.abc import Iterable, Sequence
+
+    from kicad_tools.manufacturers import DesignRules
+    from kicad_tools.schema.pcb import PCB, Footprint, Pad, Segment, Via
+    from kicad_tools.validate.violations import DRCResults
 
 # Try to import C++ module with detailed error tracking
 _CPP_IMPORT_ERROR: str | None = None
@@ -38,6 +42,191 @@ def is_cpp_available() -> bool:
     return _CPP_AVAILABLE
 
 
+def is_board_clearance_available() -> bool:
+    """Check if the C++ backend has the whole-board clearance sweep.
+
+    Extensions built before ``check_board_clearance`` was added still load;
+    callers fall back to per-pair checks with them.
+    """
+    return _CPP_AVAILABLE and hasattr(drc_cpp, "check_board_clearance")
+
+
+def is_pad_shape_available() -> bool:
+    """Check if the C++ backend has the exact pad shape kernels.
+
+    Extensions built before ``pad_shape_clearance`` was added still load;
+    callers fall back to shapely polygons with them.
+    """
+    return _CPP_AVAILABLE and hasattr(drc_cpp, "pad_shape_clearance")
+
+
+def is_copper_drc_available() -> bool:
+    """Check if the C++ backend has the unified copper DRC engine.
+
+    Extensions built before ``check_copper_drc`` was added still load;
+    callers keep the per-layer Python rules with them.
+    """
+    return _CPP_AVAILABLE and hasattr(drc_cpp, "check_copper_drc")
+
+
+def is_incremental_clearance_available() -> bool:
+    """Check if the C++ backend has the incremental clearance state.
+
+    Extensions built before ``IncrementalClearance`` was added still load;
+    ``IncrementalDRC`` keeps its Python spatial index with them.
+    """
+    return _CPP_AVAILABLE and hasattr(drc_cpp, "IncrementalClearance")
+
+
+def is_move_screening_available() -> bool:
+    """Check if the native incremental state screens candidate moves in batches.
+
+    Extensions built before ``IncrementalClearance.screen_moves`` was added
+    still load; ``IncrementalDRC.screen_moves`` scores candidates in Python
+    with them.
+    """
+    return is_incremental_clearance_available() and hasattr(
+        drc_cpp.IncrementalClearance, "screen_moves"
+    )
+
+
+def is_pair_violations_available() -> bool:
+    """Check if the C++ backend enumerates every violating pad pair.
+
+    Extensions built before ``check_pair_violations`` was added still load;
+    callers enumerate pairs in Python with them.
+    """
+    return _CPP_AVAILABLE and hasattr(drc_cpp, "check_pair_violations")
+
+
+def is_connectivity_available() -> bool:
+    """Check if the C++ backend has the copper connectivity engine.
+
+    Extensions built before ``CopperConnectivity`` was added still load;
+    callers keep the pairwise Python short and reachability walks with them.
+    """
+    return _CPP_AVAILABLE and hasattr(drc_cpp, "CopperConnectivity")
+
+
+def is_creepage_available() -> bool:
+    """Check if the C++ backend has the native creepage matrix.
+
+    Extensions built before ``creepage_matrix`` was added still load; the
+    creepage census keeps its per-pair shapely surface paths with them.
+    """
+    return _CPP_AVAILABLE and hasattr(drc_cpp, "creepage_matrix")
+
+
+def is_zone_fill_available() -> bool:
+    """Check if the C++ backend has native zone fill clearance carving.
+
+    Extensions built before ``carve_zone_fills`` was added still load;
+    ``zones.fill_clearance`` keeps carving every fill with shapely with them.
+    """
+    return _CPP_AVAILABLE and hasattr(drc_cpp, "carve_zone_fills")
+
+
+def is_simd_dispatch_available() -> bool:
+    """Check if the C++ backend exposes its pad-pair SIMD level controls.
+
+    Extensions built before ``set_simd_level`` was added still load and run
+    the scalar loop; ``simd_levels()`` is then empty.
+    """
+    return _CPP_AVAILABLE and hasattr(drc_cpp, "set_simd_level")
+
+
+# drc_cpp.SimdLevel values, widest last.
+SIMD_SCALAR = 0
+SIMD_SSE2 = 1
+SIMD_AVX2 = 2
+SIMD_AVX512 = 3
+
+_SIMD_NAMES = {SIMD_SCALAR: "scalar", SIMD_SSE2: "sse2", SIMD_AVX2: "avx2", SIMD_AVX512: "avx512"}
+
+
+def simd_levels() -> list[int]:
+    """Pad-pair kernel levels this CPU can run, scalar first."""
+    if not is_simd_dispatch_available():
+        return []
+    return list(range(int(drc_cpp.detect_simd_level()) + 1))
+
+
+def simd_level_name(level: int) -> str:
+    """Lower-case name of a ``SimdLevel`` (``"avx2"``, ...)."""
+    return _SIMD_NAMES[int(level)]
+
+
+# drc_cpp.PadShapeKind values, kept as plain ints so the mapping below
+# needs no extension at import time.
+PAD_SHAPE_CIRCLE = 0
+PAD_SHAPE_RECT = 1
+PAD_SHAPE_ROUNDRECT = 2
+PAD_SHAPE_OVAL = 3
+PAD_SHAPE_POLYGON = 4
+
+
+def pad_shape_kind(
+    shape: str,
+    width: float,
+    height: float,
+    rratio: float,
+    outline: Sequence[tuple[float, float]] = (),
+    outline_width: float = 0.0,
+) -> tuple[int, float]:
+    """Map a KiCad pad shape onto a native ``PadShapeKind`` and corner radius.
+
+    Mirrors the outlines ``validate.rules.clearance._pad_polygon`` builds:
+    an oval with equal axes is a circle, a roundrect corner radius is
+    ``rratio * min(w, h)``, a ``custom`` pad with an ``outline`` is a
+    polygon grown by half its stroke ``outline_width``, and a ``custom``
+    pad without one or an unknown shape is a rectangle.
+    """
+    if shape == "custom" and len(outline) >= 3:
+        return PAD_SHAPE_POLYGON, outline_width / 2.0
+    if shape == "circle" or (shape in ("oval", "obround") and abs(width - height) < 1e-6):
+        return PAD_SHAPE_CIRCLE, 0.0
+    if shape in ("oval", "obround"):
+        return PAD_SHAPE_OVAL, 0.0
+    if shape == "roundrect":
+        radius = rratio * min(width, height)
+        if radius > 0:
+            return PAD_SHAPE_ROUNDRECT, radius
+    return PAD_SHAPE_RECT, 0.0
+
+
+def native_pad_shape(
+    shape: str,
+    x: float,
+    y: float,
+    width: float,
+    height: float,
+    rotation_deg: float,
+    rratio: float,
+    outline: Sequence[tuple[float, float]] = (),
+    outline_width: float = 0.0,
+):
+    """Build the ``drc_cpp.PadShape`` of a pad centred at ``(x, y)``.
+
+    ``outline`` is a ``custom`` pad's copper polygon as board-frame offsets
+    from the centre, already turned by the pad orientation, so the shape
+    itself is unrotated; the other shapes turn by ``rotation_deg``.
+    """
+    kind, corner = pad_shape_kind(shape, width, height, rratio, outline, outline_width)
+    if kind == PAD_SHAPE_POLYGON:
+        return drc_cpp.PadShape(
+            kind,
+            x,
+            y,
+            width,
+            height,
+            0.0,
+            corner,
+            [p[0] for p in outline],
+            [p[1] for p in outline],
+        )
+    return drc_cpp.PadShape(kind, x, y, width, height, math.radians(rotation_deg), corner)
+
+
 def get_cpp_unavailable_reason() -> str | None:
     """Get the reason why C++ backend is unavailable.
 
@@ -68,12 +257,15 @@ def get_backend_info() -> dict:
     }
 
     if _CPP_AVAILABLE:
-        return {
+        info = {
             "backend": "cpp",
             "version": drc_cpp.version(),
             "available": True,
             "platform": platform_info,
         }
+        if is_simd_dispatch_available():
+            info["simd"] = simd_level_name(drc_cpp.simd_level())
+        return info
 
     reason = _CPP_IMPORT_ERROR or "Unknown error"
     build_hint = (
@@ -124,6 +316,7 @@ def check_pair_clearance_cpp(
     ref1: str,
     ref2: str,
     fp1_position: tuple[float, float] | None = None,
+    fp1_rotation: float | None = None,
 ) -> tuple[float, tuple[float, float], tuple[str, ...], tuple[str, ...]] | None:
     """Check pad-to-pad clearance using C++ backend.
 
@@ -134,6 +327,8 @@ def check_pair_clearance_cpp(
         ref2: Reference designator for fp2
         fp1_position: Override position for fp1 (for moved component checks).
             If None, uses fp1.position.
+        fp1_rotation: Override rotation for fp1 in degrees. If None, uses
+            fp1.rotation.
 
     Returns:
         Tuple of (min_clearance, location, items, nets) or None if no pads.
@@ -156,7 +351,7 @@ def check_pair_clearance_cpp(
     # receives; KiCad uses the NEGATED footprint orientation (verified vs
     # pcbnew, issue #3739), so we pass -rotation here. This keeps the convention
     # in one place (Python) without recompiling the native extension.
-    rot1_rad = math.radians(-fp1.rotation)
+    rot1_rad = math.radians(-(fp1_rotation if fp1_rotation is not None else fp1.rotation))
     rot2_rad = math.radians(-fp2.rotation)
 
     result = drc_cpp.check_pair_clearance(
@@ -186,3 +381,731 @@ def check_pair_clearance_cpp(
     net_names = (fp1.pads[i].net_name, fp2.pads[j].net_name)
 
     return (result.min_clearance, (result.location_x, result.location_y), items, net_names)
+
+
+def check_pair_violations_cpp(
+    fp1: Footprint,
+    fp2: Footprint,
+    ref1: str,
+    ref2: str,
+    threshold: float,
+    max_results: int = 0,
+    fp1_position: tuple[float, float] | None = None,
+    fp1_rotation: float | None = None,
+) -> list[tuple[float, tuple[float, float], tuple[str, ...], tuple[str, ...]]]:
+    """Every pad pair closer than ``threshold`` using C++ backend.
+
+    Same pads, transforms and overrides as ``check_pair_clearance_cpp``.
+
+    Args:
+        threshold: Report pairs with clearance strictly below this, in mm
+        max_results: Keep only that many smallest pairs; 0 keeps all
+
+    Returns:
+        (min_clearance, location, items, nets) per pair, closest first, in
+        ``check_pair_clearance_cpp`` format.
+    """
+    if not _CPP_AVAILABLE:
+        raise RuntimeError("C++ DRC backend not available")
+
+    lx1, ly1, r1, nets1, pids1 = _extract_pad_arrays(fp1)
+    lx2, ly2, r2, nets2, pids2 = _extract_pad_arrays(fp2)
+
+    if not lx1 or not lx2:
+        return []
+
+    pos1 = fp1_position if fp1_position is not None else fp1.position
+    # Negated KiCad orientation, as in check_pair_clearance_cpp (issue #3739).
+    rot1_rad = math.radians(-(fp1_rotation if fp1_rotation is not None else fp1.rotation))
+    rot2_rad = math.radians(-fp2.rotation)
+
+    result = drc_cpp.check_pair_violations(
+        lx1,
+        ly1,
+        r1,
+        nets1,
+        pos1[0],
+        pos1[1],
+        rot1_rad,
+        lx2,
+        ly2,
+        r2,
+        nets2,
+        fp2.position[0],
+        fp2.position[1],
+        rot2_rad,
+        threshold,
+        max_results,
+    )
+
+    return [
+        (
+            c,
+            (x, y),
+            (f"{ref1}-{pids1[i]}", f"{ref2}-{pids2[j]}"),
+            (fp1.pads[i].net_name, fp2.pads[j].net_name),
+        )
+        for i, j, c, x, y in zip(
+            result.pad1_index,
+            result.pad2_index,
+            result.clearance,
+            result.location_x,
+            result.location_y,
+            strict=True,
+        )
+    ]
+
+
+def check_board_clearance_cpp(
+    footprints: Sequence[Footprint],
+    refs: Sequence[str],
+    min_clearance: float,
+    epsilon: float = 1e-4,
+) -> list[tuple[int, int, float, tuple[float, float], tuple[str, ...], tuple[str, ...]]]:
+    """Check pad-to-pad clearance between every pair of footprints at once.
+
+    The whole board is marshalled once and swept in a single native call
+    (GIL released), instead of one ``check_pair_clearance_cpp`` call per
+    candidate pair.  Per pair, the reported clearance, pads and location
+    are the ones ``check_pair_clearance_cpp`` would report.
+
+    Args:
+        footprints: Footprints to check
+        refs: Reference designator for each footprint
+        min_clearance: Required clearance in mm
+        epsilon: Only clearances below ``min_clearance - epsilon`` are reported
+
+    Returns:
+        One tuple per violating pair, sorted by footprint index:
+        (i, j, min_clearance, location, items, nets) with ``i < j`` indexing
+        ``footprints`` and the remaining fields as in
+        ``check_pair_clearance_cpp``.
+    """
+    if not is_board_clearance_available():
+        raise RuntimeError("C++ DRC board clearance sweep not available")
+
+    results = drc_cpp.check_board_clearance(*_board_pad_arrays(footprints), min_clearance, epsilon)
+
+    return [
+        (v.footprint1, v.footprint2, *board_violation_fields(footprints, refs, v))
+        for v in results
+    ]
+
+
+def _board_pad_arrays(footprints: Sequence[Footprint]) -> tuple[list, ...]:
+    """Every pad of ``footprints`` in ``BoardPads``/``FootprintTransforms`` order."""
+    local_x: list[float] = []
+    local_y: list[float] = []
+    width: list[float] = []
+    height: list[float] = []
+    net_nums: list[int] = []
+    offsets: list[int] = [0]
+    fp_x: list[float] = []
+    fp_y: list[float] = []
+    fp_rot: list[float] = []
+
+    for fp in footprints:
+        for pad in fp.pads:
+            local_x.append(pad.position[0])
+            local_y.append(pad.position[1])
+            width.append(pad.size[0])
+            height.append(pad.size[1])
+            net_nums.append(pad.net_number)
+        offsets.append(len(local_x))
+        fp_x.append(fp.position[0])
+        fp_y.append(fp.position[1])
+        # Negated orientation, as in check_pair_clearance_cpp (issue #3739).
+        fp_rot.append(math.radians(-fp.rotation))
+
+    return local_x, local_y, width, height, net_nums, offsets, fp_x, fp_y, fp_rot
+
+
+def board_violation_fields(
+    footprints: Sequence[Footprint], refs: Sequence[str], v
+) -> tuple[float, tuple[float, float], tuple[str, ...], tuple[str, ...]]:
+    """(min_clearance, location, items, nets) of a native ``BoardClearanceViolation``."""
+    pad1 = footprints[v.footprint1].pads[v.pad1_index]
+    pad2 = footprints[v.footprint2].pads[v.pad2_index]
+    items = (f"{refs[v.footprint1]}-{pad1.number}", f"{refs[v.footprint2]}-{pad2.number}")
+    return v.min_clearance, (v.location_x, v.location_y), items, (pad1.net_name, pad2.net_name)
+
+
+def create_incremental_clearance_cpp(
+    footprints: Sequence[Footprint],
+    min_clearance: float,
+    epsilon: float = 1e-4,
+):
+    """Build a native ``IncrementalClearance`` over ``footprints``.
+
+    The initial whole-board check runs during construction; footprint ``i``
+    of the returned state is ``footprints[i]``.  Moves take deltas, with the
+    rotation delta in radians of the negated KiCad angle.
+    """
+    if not is_incremental_clearance_available():
+        raise RuntimeError("C++ DRC incremental clearance state not available")
+    return drc_cpp.IncrementalClearance(*_board_pad_arrays(footprints), min_clearance, epsilon)
+
+
+def screen_moves_cpp(
+    state,
+    footprints: Sequence[int],
+    dx: Sequence[float],
+    dy: Sequence[float],
+    drot: Sequence[float],
+    num_threads: int = 0,
+) -> tuple[list[int], list[int], list[float]]:
+    """Score candidate moves against a native ``IncrementalClearance``.
+
+    Candidate ``k`` moves footprint ``footprints[k]`` by ``(dx[k], dy[k])``
+    and turns it by ``drot[k]`` radians (the negated KiCad angle) from its
+    current pose.  Nothing is committed.
+
+    Returns:
+        Per candidate: the footprint's violating pair count, the change in
+        the board's violating pair count, and the smallest pad clearance to
+        any footprint within reach (``inf`` when none is).
+    """
+    if not is_move_screening_available():
+        raise RuntimeError("C++ DRC move screening not available")
+    screen = state.screen_moves(
+        list(footprints), list(dx), list(dy), list(drot), num_threads=num_threads
+    )
+    return list(screen.violations), list(screen.net_change), list(screen.min_clearance)
+
+
+# drc_cpp.CopperItemType / CopperCheck values, as plain ints.
+COPPER_SEGMENT = 0
+COPPER_PAD = 1
+COPPER_VIA = 2
+COPPER_ZONE = 3
+
+CHECK_CLEARANCE = 1
+CHECK_ZONE = 2
+CHECK_HOLE_TO_HOLE = 4
+CHECK_HOLE_TO_COPPER = 8
+CHECK_ALL = 15
+
+
+class CopperBoardItems:
+    """A PCB's copper marshalled into a ``drc_cpp.CopperBoard``.
+
+    Keeps the schema objects behind every native index so violations can
+    be mapped back: ``segments[i]``, ``pads[i]`` (``(footprint, pad)``),
+    ``vias[i]`` and ``zones[i]`` (``(net_number, net_name)``), plus the
+    copper layer names the board's layer indices refer to.
+
+    Only what ``checks`` needs is read: drills for the hole checks and
+    zone fills for ``CHECK_ZONE``.
+    """
+
+    def __init__(self, pcb: PCB, checks: int = CHECK_ALL, *, include_pads: bool = True):
+        from kicad_tools.validate.rules.clearance import (
+            _custom_outline_offsets,
+            _transform_pad_position,
+        )
+
+        self.layers: list[str] = [layer.name for layer in pcb.copper_layers][:64]
+        self._layer_index = {name: i for i, name in enumerate(self.layers)}
+        layer_index = self._layer_index
+        all_layers = (1 << len(self.layers)) - 1
+        holes = bool(checks & (CHECK_HOLE_TO_HOLE | CHECK_HOLE_TO_COPPER))
+        self._holes = holes
+
+        self.segments: list[Segment] = []
+        self.pads: list[tuple[Footprint, Pad]] = []
+        self.vias: list[Via] = []
+        self.zones: list[tuple[int, str]] = []
+        self._net_names = {net.number: net.name for net in pcb.nets.values()}
+
+        board = drc_cpp.CopperBoard()
+        board.num_layers = len(self.layers)
+        self._fill_segments(board, pcb.segments)
+
+        pads, pad_layers, pad_drill, pad_net = [], [], [], []
+        for fp in pcb.footprints if include_pads else ():
+            for pad in fp.pads:
+                if "*.Cu" in pad.layers:
+                    mask = all_layers
+                else:
+                    mask = 0
+                    for name in pad.layers:
+                        if name in layer_index:
+                            mask |= 1 << layer_index[name]
+                drill = 0.0
+                if holes and pad.type == "thru_hole" and pad.drill > 0:
+                    drill = pad.drill
+                if mask == 0 and drill == 0.0:
+                    continue
+                x, y = _transform_pad_position(pad, fp)
+                w, h = pad.size
+                self.pads.append((fp, pad))
+                # pad.rotation is board-frame (issue #3902).
+                pads.append(
+                    native_pad_shape(
+                        pad.shape,
+                        x,
+                        y,
+                        w,
+                        h,
+                        getattr(pad, "rotation", 0.0),
+                        getattr(pad, "roundrect_rratio", 0.25),
+                        _custom_outline_offsets(pad),
+                        getattr(pad, "custom_outline_width", 0.0),
+                    )
+                )
+                pad_layers.append(mask)
+                pad_drill.append(drill)
+                pad_net.append(pad.net_number)
+        board.pads, board.pad_layers = pads, pad_layers
+        board.pad_drill, board.pad_net = pad_drill, pad_net
+
+        self._fill_vias(board, pcb.vias)
+
+        # Zone fills: the committed filled_polygon rings, nets resolved as
+        # validate.rules.clearance._collect_zone_fills does.  KiCad traces
+        # knockouts into the ring itself, so each ring is passed unrepaired.
+        offsets, zone_x, zone_y, zone_layer, zone_net = [0], [], [], [], []
+        if checks & CHECK_ZONE:
+            name_to_number = {name: number for number, name in self._net_names.items() if name}
+            for zone in pcb.zones:
+                net_number = zone.net_number
+                if net_number == 0 and zone.net_name:
+                    net_number = name_to_number.get(zone.net_name, 0)
+                if net_number == 0:
+                    continue
+                net_name = zone.net_name or self._net_names.get(net_number, "")
+                for i, points in enumerate(zone.filled_polygons):
+                    layer = zone.filled_polygon_layer(i)
+                    if layer not in layer_index or len(set(points)) < 3:
+                        continue
+                    self.zones.append((net_number, net_name))
+                    zone_x.extend(p[0] for p in points)
+                    zone_y.extend(p[1] for p in points)
+                    offsets.append(len(zone_x))
+                    zone_layer.append(layer_index[layer])
+                    zone_net.append(net_number)
+        board.zone_offsets, board.zone_x, board.zone_y = offsets, zone_x, zone_y
+        board.zone_layer, board.zone_net = zone_layer, zone_net
+
+        self.board = board
+
+    def route_board(self, segments: Iterable[Segment] = (), vias: Iterable[Via] = ()):
+        """Marshal a route's copper for ``drc_cpp.CopperConnectivity.commit``.
+
+        The items are appended to ``segments`` / ``vias``, so their native
+        indices continue after the board's.
+        """
+        board = drc_cpp.CopperBoard()
+        board.num_layers = len(self.layers)
+        self._fill_segments(board, segments)
+        self._fill_vias(board, vias)
+        return board
+
+    def _fill_segments(self, board, segments: Iterable[Segment]) -> None:
+        seg_x1, seg_y1, seg_x2, seg_y2 = [], [], [], []
+        seg_width, seg_layer, seg_net = [], [], []
+        for seg in segments:
+            if seg.layer not in self._layer_index:
+                continue
+            self.segments.append(seg)
+            seg_x1.append(seg.start[0])
+            seg_y1.append(seg.start[1])
+            seg_x2.append(seg.end[0])
+            seg_y2.append(seg.end[1])
+            seg_width.append(seg.width)
+            seg_layer.append(self._layer_index[seg.layer])
+            seg_net.append(seg.net_number)
+        board.seg_x1, board.seg_y1 = seg_x1, seg_y1
+        board.seg_x2, board.seg_y2 = seg_x2, seg_y2
+        board.seg_width, board.seg_layer, board.seg_net = seg_width, seg_layer, seg_net
+
+    def _fill_vias(self, board, vias: Iterable[Via]) -> None:
+        from kicad_tools.core.layers import via_spans_layer
+
+        via_x, via_y, via_size, via_drill = [], [], [], []
+        via_layers, via_explicit, via_net = [], [], []
+        for via in vias:
+            self.vias.append(via)
+            via_x.append(via.position[0])
+            via_y.append(via.position[1])
+            via_size.append(via.size)
+            via_drill.append(via.drill if self._holes else 0.0)
+            spans = 0
+            for i, name in enumerate(self.layers):
+                if via_spans_layer(via.layers, name):
+                    spans |= 1 << i
+            explicit = 0
+            for name in via.layers:
+                if name in self._layer_index:
+                    explicit |= 1 << self._layer_index[name]
+            via_layers.append(spans)
+            via_explicit.append(explicit)
+            via_net.append(via.net_number)
+        board.via_x, board.via_y, board.via_size = via_x, via_y, via_size
+        board.via_drill, board.via_layers = via_drill, via_layers
+        board.via_explicit_layers, board.via_net = via_explicit, via_net
+
+    def element(self, item_type: int, index: int):
+        """Return the ``CopperElement`` ClearanceRule builds for an item."""
+        from kicad_tools.validate.rules.clearance import CopperElement
+
+        if item_type == COPPER_SEGMENT:
+            return CopperElement.from_segment(self.segments[index])
+        if item_type == COPPER_PAD:
+            fp, pad = self.pads[index]
+            return CopperElement.from_pad(pad, fp)
+        return CopperElement.from_via(self.vias[index])
+
+    def reference(self, item_type: int, index: int) -> str:
+        """Item reference in DRC report style (``Trace-1a2b3c4d``, ``U1-3``)."""
+        if item_type == COPPER_ZONE:
+            net_name = self.zones[index][1]
+            return f"ZoneFill-{net_name}" if net_name else "ZoneFill"
+        return self.element(item_type, index).reference
+
+    def net_name(self, item_type: int, index: int) -> str:
+        """Net name reported for an item (empty for net 0)."""
+        if item_type == COPPER_ZONE:
+            return self.zones[index][1]
+        return self.element(item_type, index).net_name
+
+
+def run_copper_drc_cpp(
+    items: CopperBoardItems,
+    min_clearance: float,
+    *,
+    min_hole_to_hole: float = 0.0,
+    min_hole_to_copper: float = 0.0,
+    checks: int = CHECK_ALL,
+    exempt_net_pairs: Iterable[tuple[int, int]] = (),
+    num_threads: int = 0,
+) -> list:
+    """Run the native copper DRC over a marshalled board.
+
+    Returns:
+        The raw ``drc_cpp.CopperViolation`` list, sorted by
+        (check, layer, type1, index1, type2, index2).
+    """
+    if not is_copper_drc_available():
+        raise RuntimeError("C++ DRC copper engine not available")
+
+    from kicad_tools.validate.rules.base import DRC_TOLERANCE
+    from kicad_tools.validate.rules.clearance import _COLOCATION_EPSILON_MM
+
+    rules = drc_cpp.CopperRules()
+    rules.min_clearance = min_clearance
+    rules.min_hole_to_hole = min_hole_to_hole
+    rules.min_hole_to_copper = min_hole_to_copper
+    rules.tolerance = DRC_TOLERANCE
+    rules.colocation_epsilon = _COLOCATION_EPSILON_MM
+    rules.exempt_net_pairs = [net for pair in exempt_net_pairs for net in pair]
+    rules.checks = checks
+    rules.num_threads = num_threads
+    return drc_cpp.check_copper_drc(items.board, rules)
+
+
+def create_copper_connectivity_cpp(
+    items: CopperBoardItems,
+    *,
+    short_clearance: float = 0.0,
+    tolerance: float = 1e-4,
+):
+    """Build a native ``CopperConnectivity`` over a marshalled board.
+
+    Same-net copper closer than ``tolerance`` is joined; different-net
+    copper closer than ``short_clearance - tolerance`` is a short.  Routes
+    committed later are marshalled with ``items.route_board()`` so their
+    indices line up with ``items``.
+    """
+    if not is_connectivity_available():
+        raise RuntimeError("C++ DRC connectivity engine not available")
+    rules = drc_cpp.ConnectivityRules()
+    rules.tolerance = tolerance
+    rules.short_clearance = short_clearance
+    return drc_cpp.CopperConnectivity(items.board, rules)
+
+
+def creepage_matrix_cpp(
+    items: CopperBoardItems,
+    sources: Iterable[int],
+    edge_segments: Iterable[tuple[tuple[float, float], tuple[float, float]]] = (),
+    slot_rings: Iterable[Sequence[tuple[float, float]]] = (),
+    *,
+    interior_shrink: float = 1e-6,
+    num_threads: int = 0,
+):
+    """Creepage from each source net to every net with copper, natively.
+
+    ``edge_segments`` is the Edge.Cuts linework the board-edge distance is
+    taken to and ``slot_rings`` the cutout outlines that lengthen surface
+    paths.  Marshal ``items`` with ``CHECK_ZONE`` so zone fills count as
+    copper.
+
+    Returns:
+        The raw ``drc_cpp.CreepageMatrix`` (row-major sources x nets).
+    """
+    if not is_creepage_available():
+        raise RuntimeError("C++ DRC creepage matrix not available")
+
+    outline = drc_cpp.CreepageOutline()
+    edges = list(edge_segments)
+    outline.edge_x1 = [a[0] for a, _ in edges]
+    outline.edge_y1 = [a[1] for a, _ in edges]
+    outline.edge_x2 = [b[0] for _, b in edges]
+    outline.edge_y2 = [b[1] for _, b in edges]
+    offsets, slot_x, slot_y = [0], [], []
+    for ring in slot_rings:
+        slot_x.extend(p[0] for p in ring)
+        slot_y.extend(p[1] for p in ring)
+        offsets.append(len(slot_x))
+    if len(offsets) > 1:
+        outline.slot_offsets, outline.slot_x, outline.slot_y = offsets, slot_x, slot_y
+
+    rules = drc_cpp.CreepageRules()
+    rules.interior_shrink = interior_shrink
+    rules.num_threads = num_threads
+    return drc_cpp.creepage_matrix(items.board, outline, list(sources), rules)
+
+
+# drc_cpp.FillStatus values
+ZONE_FILL_UNCHANGED = 0
+ZONE_FILL_CARVED = 1
+ZONE_FILL_KEPT = 2
+ZONE_FILL_UNSUPPORTED = 3
+
+
+def carve_zone_fills_cpp(
+    fills: Iterable[tuple[Sequence[tuple[float, float]], int, int, float]],
+    obstacles: Iterable[tuple[int, float, float, float, float, float, int, int, bool]],
+    *,
+    slit_width: float = 1e-4,
+    area_epsilon: float = 1e-4,
+    arc_segments: int = 64,
+    num_threads: int = 0,
+) -> list[tuple[int, list[list[tuple[float, float]]]]]:
+    """Carve foreign-net antipads out of zone fills natively.
+
+    ``fills`` are ``(ring, layer, net, antipad)``, ``layer`` being a bit
+    index into the obstacle layer masks.  ``obstacles`` are ``(kind, x, y,
+    width, height, rotation_rad, layer_mask, net, cuts)``: PadShape
+    parameters, the layers the copper is on, and whether it is cut out of
+    other nets' fills (``False`` for anchor-only copper such as zero-width
+    tracks).  Every obstacle anchors its own net's fills.
+
+    Returns:
+        ``(status, rings)`` per fill: a ``ZONE_FILL_*`` status and, when
+        it is ``ZONE_FILL_CARVED``, the rings replacing the fill.
+    """
+    if not is_zone_fill_available():
+        raise RuntimeError("C++ DRC zone fill carving not available")
+
+    job = drc_cpp.ZoneFillJob()
+    offsets, fill_x, fill_y, layers, nets, antipads = [0], [], [], [], [], []
+    for ring, layer, net, antipad in fills:
+        fill_x.extend(p[0] for p in ring)
+        fill_y.extend(p[1] for p in ring)
+        offsets.append(len(fill_x))
+        layers.append(layer)
+        nets.append(net)
+        antipads.append(antipad)
+    job.fill_offsets, job.fill_x, job.fill_y = offsets, fill_x, fill_y
+    job.fill_layer, job.fill_net, job.fill_antipad = layers, nets, antipads
+
+    shapes, masks, owners, cuts = [], [], [], []
+    for kind, x, y, width, height, rotation, mask, net, cut in obstacles:
+        shapes.append(drc_cpp.PadShape(kind, x, y, width, height, rotation))
+        masks.append(mask)
+        owners.append(net)
+        cuts.append(1 if cut else 0)
+    job.obstacles, job.obstacle_layers, job.obstacle_net, job.obstacle_cuts = (
+        shapes,
+        masks,
+        owners,
+        cuts,
+    )
+
+    rules = drc_cpp.ZoneFillRules()
+    rules.slit_width = slit_width
+    rules.area_epsilon = area_epsilon
+    rules.arc_segments = arc_segments
+    rules.num_threads = num_threads
+    result = drc_cpp.carve_zone_fills(job, rules)
+
+    offsets = result.ring_offsets
+    xs, ys = result.ring_x, result.ring_y
+    out: list[tuple[int, list[list[tuple[float, float]]]]] = []
+    for k, status in enumerate(result.status):
+        rings = [
+            list(zip(xs[offsets[r] : offsets[r + 1]], ys[offsets[r] : offsets[r + 1]]))
+            for r in range(result.fill_rings[k], result.fill_rings[k + 1])
+        ]
+        out.append((int(status), rings))
+    return out
+
+
+def check_copper_drc_cpp(
+    pcb: PCB,
+    design_rules: DesignRules,
+    *,
+    min_hole_to_copper: float | None = None,
+    checks: int = CHECK_ALL,
+    num_threads: int = 0,
+) -> DRCResults:
+    """Whole-board copper DRC in one native pass.
+
+    Produces the violations the Python rules emit, with their rule ids:
+    ``clearance_<type>_<type>`` (ClearanceRule's per-layer pass, without
+    the net-0 bridge check), ``clearance_segment_zone`` /
+    ``clearance_via_zone`` / ``clearance_pad_zone``, and
+    ``hole_to_hole_clearance``.  Hole-to-track clearance is reported as
+    ``drill_clearance`` when ``min_hole_to_copper`` is given.
+
+    Zone shorts report the native penetration depth, which can differ
+    from the shapely rules' representative-point depth by a few microns.
+
+    Args:
+        pcb: The PCB to check
+        design_rules: Design rules from the manufacturer profile
+        min_hole_to_copper: Drill edge to foreign track clearance in mm;
+            ``None`` leaves that check off
+        checks: ``CHECK_*`` bitmask of clearance classes to run
+        num_threads: Worker threads (0 = hardware concurrency)
+    """
+    from kicad_tools.validate.rules.clearance import ClearanceRule, _build_diff_pair_set
+    from kicad_tools.validate.violations import DRCResults
+
+    if min_hole_to_copper is None:
+        checks &= ~CHECK_HOLE_TO_COPPER
+    items = CopperBoardItems(pcb, checks)
+    raw = run_copper_drc_cpp(
+        items,
+        design_rules.min_clearance_mm,
+        min_hole_to_hole=design_rules.min_hole_to_hole_mm,
+        min_hole_to_copper=min_hole_to_copper or 0.0,
+        checks=checks,
+        exempt_net_pairs=_build_diff_pair_set(pcb) if checks & CHECK_CLEARANCE else (),
+        num_threads=num_threads,
+    )
+
+    results = DRCResults()
+    results.rules_checked = bin(checks & CHECK_ALL).count("1")
+    rule = ClearanceRule()
+    for v in raw:
+        layer = items.layers[v.layer] if v.layer >= 0 else None
+        if v.check == CHECK_CLEARANCE:
+            results.add(
+                rule._create_violation(
+                    items.element(v.type1, v.index1),
+                    items.element(v.type2, v.index2),
+                    v.actual,
+                    v.required,
+                    layer,
+                    v.location_x,
+                    v.location_y,
+                )
+            )
+        elif v.check == CHECK_ZONE:
+            results.add(_zone_violation(items, v, layer))
+        elif v.check == CHECK_HOLE_TO_HOLE:
+            results.add(_hole_to_hole_violation(items, v))
+        else:
+            results.add(_hole_to_copper_violation(items, v, layer))
+    return results
+
+
+def _drill_label(items: CopperBoardItems, item_type: int, index: int) -> tuple[str, str, str]:
+    """(item, footprint reference, net) as DimensionRules labels a drill."""
+    if item_type == COPPER_VIA:
+        via = items.vias[index]
+        # The board's net table, as DimensionRules resolves via nets.
+        net_name = items._net_names.get(via.net_number, f"net:{via.net_number}")
+        return net_name, "", net_name
+    fp, pad = items.pads[index]
+    net_name = pad.net_name or f"net:{pad.net_number}"
+    return f"{fp.reference}-{pad.number}:{net_name}", fp.reference, net_name
+
+
+def _zone_violation(items: CopperBoardItems, v, layer: str):
+    from kicad_tools.validate.violations import DRCViolation
+
+    kind = {COPPER_SEGMENT: "segment", COPPER_PAD: "pad", COPPER_VIA: "via"}[v.type1]
+    net_label = items.net_name(v.type1, v.index1)
+    zone_net = items.net_name(v.type2, v.index2)
+    half_width = items.segments[v.index1].width / 2.0 if v.type1 == COPPER_SEGMENT else 0.0
+    if v.actual < 0 and -v.actual < half_width:
+        # Centreline outside the fill, only the track's width overlaps it.
+        message = (
+            f"Short: segment on net '{net_label}' copper overlaps zone fill of "
+            f"net '{zone_net}' on {layer} by {-v.actual:.3f}mm"
+        )
+    elif v.actual <= 0:
+        message = (
+            f"Short: {kind} on net '{net_label}' overlaps zone fill of net "
+            f"'{zone_net}' on {layer} (overlap depth {-v.actual:.3f}mm)"
+        )
+    else:
+        message = (
+            f"{kind.title()} to zone fill clearance {v.actual:.3f}mm < "
+            f"minimum {v.required:.3f}mm (net '{net_label}' vs zone net '{zone_net}')"
+        )
+    return DRCViolation(
+        rule_id=f"clearance_{kind}_zone",
+        severity="error",
+        message=message,
+        location=(round(v.location_x, 3), round(v.location_y, 3)),
+        layer=layer,
+        actual_value=round(v.actual, 4),
+        required_value=v.required,
+        items=(items.reference(v.type1, v.index1), items.reference(v.type2, v.index2)),
+        nets=(net_label, zone_net),
+    )
+
+
+def _hole_to_hole_violation(items: CopperBoardItems, v):
+    from kicad_tools.validate.violations import DRCViolation
+
+    # Vias before pads, each in board order, as DimensionRules pairs them.
+    first, second = sorted(
+        ((v.type1, v.index1), (v.type2, v.index2)), key=lambda end: (end[0] != COPPER_VIA, end)
+    )
+    item1, fp_ref1, net1 = _drill_label(items, *first)
+    item2, fp_ref2, net2 = _drill_label(items, *second)
+    # Same-footprint holes are intentional (dense connectors): warning.
+    same_footprint = fp_ref1 != "" and fp_ref1 == fp_ref2
+    prefix = "(same-footprint) " if same_footprint else ""
+    return DRCViolation(
+        rule_id="hole_to_hole_clearance",
+        severity="warning" if same_footprint else "error",
+        message=(
+            f"{prefix}Hole-to-hole clearance {v.actual:.3f}mm < minimum {v.required:.3f}mm"
+        ),
+        location=(v.location_x, v.location_y),
+        layer=None,
+        actual_value=v.actual,
+        required_value=v.required,
+        items=(item1, item2),
+        nets=(net1, net2),
+    )
+
+
+def _hole_to_copper_violation(items: CopperBoardItems, v, layer: str):
+    from kicad_tools.validate.violations import DRCViolation
+
+    # The drill owner is the via or pad; the other item is the track.
+    if v.type1 == COPPER_SEGMENT:
+        track, hole = (v.type1, v.index1), (v.type2, v.index2)
+    else:
+        track, hole = (v.type2, v.index2), (v.type1, v.index1)
+    return DRCViolation(
+        rule_id="drill_clearance",
+        severity="error",
+        message=(
+            f"Hole to track clearance {v.actual:.3f}mm < minimum {v.required:.3f}mm"
+        ),
+        location=(round(v.location_x, 3), round(v.location_y, 3)),
+        layer=layer,
+        actual_value=round(v.actual, 4),
+        required_value=v.required,
+        items=(items.reference(*hole), items.reference(*track)),
+        nets=(items.net_name(*hole), items.net_name(*track)),
+    )
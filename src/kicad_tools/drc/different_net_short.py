@@ -229,6 +229,10 @@ def find_different_net_shorts(
     grid-occupancy model, it operates on raw world coordinates, so it
     catches sub-cell overlaps the occupancy model cannot represent.
 
+    With the C++ backend the pairs come from the native connectivity
+    engine's spatial index instead of the all-pairs loops; the result is
+    the same.
+
     Args:
         pcb: The routed board to inspect (not mutated).
         clearance: Minimum required edge-to-edge gap (mm).  ``0.0`` = flag
@@ -239,6 +243,10 @@ def find_different_net_shorts(
         One :class:`ShortItem` per different-net violation, deterministically
         ordered.
     """
+    native = _find_different_net_shorts_cpp(pcb, clearance)
+    if native is not None:
+        return native
+
     threshold = clearance - _EPS
     shorts: list[ShortItem] = []
 
@@ -364,6 +372,99 @@ def find_different_net_shorts(
     return shorts
 
 
+def _find_different_net_shorts_cpp(pcb: PCB, clearance: float) -> list[ShortItem] | None:
+    """The same check on the native connectivity engine's spatial index.
+
+    Returns ``None`` (use the pairwise loops) without the C++ backend or
+    when a segment sits on a layer outside the board's copper stack.  Nets
+    keep their :func:`_net_identity` keys, via barrels their ordinal spans,
+    and each short is reported exactly as the Python loops report it.
+    """
+    from kicad_tools.drc.cpp_backend import (
+        COPPER_VIA,
+        CopperBoardItems,
+        create_copper_connectivity_cpp,
+        is_connectivity_available,
+    )
+
+    if not is_connectivity_available():
+        return None
+    items = CopperBoardItems(pcb, 0, include_pads=False)
+    if len(items.segments) != len(pcb.segments):
+        return None
+
+    keys: dict[object, int] = {}
+    seg_ident = [_net_identity(pcb, s.net_number, s.net_name) for s in items.segments]
+    via_ident = [_net_identity(pcb, v.net_number, v.net_name) for v in items.vias]
+
+    def net_id(ident: tuple[object, str] | None) -> int:
+        return 0 if ident is None else keys.setdefault(ident[0], len(keys) + 1)
+
+    ordinals = [_copper_ordinal(name) for name in items.layers]
+    spans = [_via_layer_span(via) for via in items.vias]
+    board = items.board
+    board.seg_net = [net_id(ident) for ident in seg_ident]
+    board.via_net = [net_id(ident) for ident in via_ident]
+    board.via_layers = [
+        sum(1 << i for i, o in enumerate(ordinals) if o is not None and lo <= o <= hi)
+        for lo, hi in spans
+    ]
+    engine = create_copper_connectivity_cpp(items, short_clearance=clearance, tolerance=_EPS)
+
+    # Keyed by the Python loops' visiting order so sort ties come out alike.
+    found: list[tuple[tuple[int, int, int], ShortItem]] = []
+    for short in engine.shorts():
+        if short.type1 == COPPER_VIA:
+            vi, vj = items.vias[short.index1], items.vias[short.index2]
+            lo = max(spans[short.index1][0], spans[short.index2][0])
+            key = (0, short.index1, short.index2)
+            item = ShortItem(
+                kind="via-via",
+                net_a_name=via_ident[short.index1][1],
+                net_b_name=via_ident[short.index2][1],
+                layer=_ordinal_layer_name(pcb, lo),
+                x=(vi.position[0] + vj.position[0]) / 2.0,
+                y=(vi.position[1] + vj.position[1]) / 2.0,
+                gap=short.clearance,
+                via_a=vi,
+                via_b=vj,
+            )
+        elif short.type2 == COPPER_VIA:
+            vi, seg = items.vias[short.index2], items.segments[short.index1]
+            key = (1, short.index2, short.index1)
+            item = ShortItem(
+                kind="via-segment",
+                net_a_name=via_ident[short.index2][1],
+                net_b_name=seg_ident[short.index1][1],
+                layer=seg.layer,
+                x=vi.position[0],
+                y=vi.position[1],
+                gap=short.clearance,
+                via_a=vi,
+                via_b=None,
+            )
+        else:
+            sa, sb = items.segments[short.index1], items.segments[short.index2]
+            key = (2, short.index1, short.index2)
+            item = ShortItem(
+                kind="segment-segment",
+                net_a_name=seg_ident[short.index1][1],
+                net_b_name=seg_ident[short.index2][1],
+                layer=sa.layer,
+                x=(sa.start[0] + sa.end[0] + sb.start[0] + sb.end[0]) / 4.0,
+                y=(sa.start[1] + sa.end[1] + sb.start[1] + sb.end[1]) / 4.0,
+                gap=short.clearance,
+                via_a=None,
+                via_b=None,
+            )
+        found.append((key, item))
+
+    found.sort(key=lambda entry: entry[0])
+    shorts = [item for _, item in found]
+    shorts.sort(key=lambda s: (s.kind, s.net_a_name, s.net_b_name, round(s.x, 3), round(s.y, 3)))
+    return shorts
+
+
 def _ordinal_layer_name(pcb: PCB, ordinal: int) -> str:
     """Best-effort reverse map from a copper ordinal to a layer name."""
     for layer in pcb.copper_layers:
@@ -1,13 +1,16 @@
 """Incremental DRC engine for real-time design validation.
 
 This module provides an incremental DRC engine that can efficiently validate
-changes without re-checking the entire board. It uses R-tree spatial indexing
-for fast region queries and caches DRC state between checks.
+changes without re-checking the entire board. When the C++ backend has it,
+the whole state (transformed pads, a dynamic spatial index and the cached
+per-pair results) lives in ``drc_cpp.IncrementalClearance``; otherwise an
+R-tree (or linear scan) index and per-pair checks are used.
 
 The main class is IncrementalDRC which provides:
 - full_check(): Perform full DRC and cache state
 - check_move(): Check DRC impact of moving a component (preview)
 - apply_move(): Apply move and update cached state
+- screen_moves(): Score many candidate moves at once (no state change)
 
 Example:
     >>> from kicad_tools.drc.incremental import IncrementalDRC
@@ -40,12 +43,23 @@ from datetime import datetime
 from typing import TYPE_CHECKING
 
 if TYPE_CHECKING:
+    from collections.abc import Sequence
+
     from kicad_tools.manufacturers.base import DesignRules
     from kicad_tools.schema.pcb import PCB, Footprint
 
 # Try to import C++ DRC backend for accelerated clearance checking
 from kicad_tools.drc.cpp_backend import (
+    board_violation_fields,
+    check_board_clearance_cpp,
     check_pair_clearance_cpp,
+    check_pair_violations_cpp,
+    create_incremental_clearance_cpp,
+    is_board_clearance_available,
+    is_incremental_clearance_available,
+    is_move_screening_available,
+    is_pair_violations_available,
+    screen_moves_cpp,
 )
 from kicad_tools.drc.cpp_backend import (
     is_cpp_available as _is_drc_cpp_available,
@@ -311,6 +325,37 @@ class SpatialIndex:
         return ref in self._id_map
 
 
+class NativeSpatialIndex:
+    """Read-only ``SpatialIndex`` view of a native ``IncrementalClearance``.
+
+    The native state owns the footprint grid and updates it on every
+    committed move; this view answers queries against it by reference.
+    Footprints without pads are not in the native grid, so ``query`` never
+    returns them.
+    """
+
+    def __init__(self, native, refs: list[str], bounds: dict[str, Rectangle]) -> None:
+        self._native = native
+        self._refs = refs
+        self._bounds = bounds
+
+    def query(self, bounds: Rectangle) -> list[str]:
+        """Find all footprints whose boxes intersect the given bounds."""
+        return [self._refs[i] for i in self._native.query(*bounds.as_tuple())]
+
+    def get_bounds(self, ref: str) -> Rectangle | None:
+        """Get the current bounds for a footprint."""
+        return self._bounds.get(ref)
+
+    def __len__(self) -> int:
+        """Return the number of footprints in the state."""
+        return len(self._refs)
+
+    def __contains__(self, ref: str) -> bool:
+        """Check if a reference is in the state."""
+        return ref in self._bounds
+
+
 @dataclass
 class DRCState:
     """Cached DRC state for incremental updates.
@@ -320,14 +365,15 @@ class DRCState:
 
     Attributes:
         violations: Current list of DRC violations
-        spatial_index: R-tree index for fast spatial queries
+        spatial_index: R-tree index for fast spatial queries (a view of the
+            native grid when the C++ incremental state is in use)
         component_bounds: Bounding boxes for each component
         net_segments: Trace segments grouped by net
         last_full_check: Timestamp of last full DRC check
     """
 
     violations: list[Violation] = field(default_factory=list)
-    spatial_index: SpatialIndex = field(default_factory=SpatialIndex)
+    spatial_index: SpatialIndex | NativeSpatialIndex = field(default_factory=SpatialIndex)
     component_bounds: dict[str, Rectangle] = field(default_factory=dict)
     net_segments: dict[str, list[tuple[float, float, float, float]]] = field(default_factory=dict)
     last_full_check: datetime = field(default_factory=datetime.now)
@@ -374,12 +420,38 @@ class DRCDelta:
             return f"No net change ({len(self.new_violations)} new, {len(self.resolved_violations)} resolved)"
 
 
+@dataclass
+class MoveScreen:
+    """Predicted clearance outcome of one candidate move.
+
+    Attributes:
+        ref: Component reference designator
+        x: Candidate X position in mm (as passed to ``check_move``)
+        y: Candidate Y position in mm
+        rotation: Candidate rotation in degrees (None = keep current)
+        violations: Clearance violations the component would take part in
+        net_change: Change in the board's violation count if applied
+        min_clearance: Smallest pad clearance to any component within reach
+            of the candidate pose (``inf`` when none is)
+    """
+
+    ref: str
+    x: float
+    y: float
+    rotation: float | None = None
+    violations: int = 0
+    net_change: int = 0
+    min_clearance: float = math.inf
+
+
 class IncrementalDRC:
     """DRC engine with incremental update capability.
 
     Provides efficient DRC checking by caching state and only re-checking
-    affected areas when components move. Uses R-tree spatial indexing for
-    O(log n) region queries.
+    affected areas when components move. With the C++ backend the cached
+    state is native and a move costs one grid query plus one pad-pair kernel
+    call per neighbour, with no Python round trips in between; without it,
+    R-tree spatial indexing gives O(log n) region queries.
 
     Performance targets:
         - 50 components: full <100ms, incremental <5ms
@@ -406,6 +478,16 @@ class IncrementalDRC:
         self._component_nets: dict[str, list[str]] = {}
         self._max_clearance = self._compute_max_clearance()
 
+        # Native incremental state (drc_cpp.IncrementalClearance), built by
+        # full_check() when the backend has it.  Footprint i is
+        # self._native_refs[i]; cached violations are keyed by index pair.
+        self._native = None
+        self._native_refs: list[str] = []
+        self._native_footprints: list[Footprint] = []
+        self._native_index: dict[str, int] = {}
+        self._native_violations: dict[tuple[int, int], Violation] = {}
+        self._rotations: dict[str, float] = {}
+
     def _compute_max_clearance(self) -> float:
         """Compute the maximum clearance that needs to be checked."""
         # Use the minimum clearance as the check distance
@@ -425,9 +507,13 @@ class IncrementalDRC:
 
         # Initialize state
         self.state = DRCState()
+        self._native = None
 
         # Build spatial index and component bounds
-        self._build_spatial_index()
+        if _is_drc_cpp_available() and is_incremental_clearance_available():
+            self._build_native_state()
+        else:
+            self._build_spatial_index()
 
         # Build net-to-component mapping
         self._build_net_mapping()
@@ -446,7 +532,9 @@ class IncrementalDRC:
 
         return violations
 
-    def check_move(self, ref: str, new_x: float, new_y: float) -> DRCDelta:
+    def check_move(
+        self, ref: str, new_x: float, new_y: float, rotation: float | None = None
+    ) -> DRCDelta:
         """Check DRC impact of moving a component.
 
         Performs an incremental check to determine what violations would
@@ -462,6 +550,9 @@ class IncrementalDRC:
             ref: Component reference designator (e.g., "U1")
             new_x: New X position in mm
             new_y: New Y position in mm
+            rotation: New rotation in degrees (None = keep current).  The
+                footprint turns about its origin; (new_x, new_y) places the
+                center of its current bounds.
 
         Returns:
             DRCDelta describing the changes in violations
@@ -482,7 +573,20 @@ class IncrementalDRC:
         # Calculate new bounds
         dx = new_x - old_bounds.center_x
         dy = new_y - old_bounds.center_y
-        new_bounds = old_bounds.translate(dx, dy)
+
+        if self._native is not None and ref in self._native_index:
+            delta = self._native_move(ref, dx, dy, rotation, commit=False)
+            delta.check_time_ms = (time.perf_counter() - start_time) * 1000
+            return delta
+
+        fp = self.pcb.get_footprint(ref)
+        if fp is None:
+            return DRCDelta(check_time_ms=(time.perf_counter() - start_time) * 1000)
+        new_position = (fp.position[0] + dx, fp.position[1] + dy)
+        if rotation is None:
+            new_bounds = old_bounds.translate(dx, dy)
+        else:
+            new_bounds = self._compute_footprint_bounds(fp, new_position, rotation)
 
         # Find affected area (union of old and new positions, expanded by clearance)
         affected_area = old_bounds.union(new_bounds).expand(self._max_clearance)
@@ -496,7 +600,9 @@ class IncrementalDRC:
         connected_nets = self._component_nets.get(ref, [])
 
         # Check clearances for the moved component at new position
-        new_violations = self._check_component_clearances(ref, new_bounds, nearby_refs)
+        new_violations = self._check_component_clearances(
+            ref, new_position, nearby_refs, rotation
+        )
 
         # Find violations that would be resolved
         resolved = [v for v in self.state.violations if v.involves(ref) and v not in new_violations]
@@ -511,7 +617,9 @@ class IncrementalDRC:
             check_time_ms=elapsed_ms,
         )
 
-    def apply_move(self, ref: str, new_x: float, new_y: float) -> DRCDelta:
+    def apply_move(
+        self, ref: str, new_x: float, new_y: float, rotation: float | None = None
+    ) -> DRCDelta:
         """Apply move and update cached state.
 
         Performs the same check as check_move() but also updates the
@@ -521,11 +629,29 @@ class IncrementalDRC:
             ref: Component reference designator
             new_x: New X position in mm
             new_y: New Y position in mm
+            rotation: New rotation in degrees (None = keep current)
 
         Returns:
             DRCDelta describing the changes in violations
         """
-        delta = self.check_move(ref, new_x, new_y)
+        if self.state is None:
+            self.full_check()
+        assert self.state is not None
+
+        if self._native is not None and ref in self._native_index:
+            start_time = time.perf_counter()
+            old_bounds = self.state.component_bounds[ref]
+            delta = self._native_move(
+                ref,
+                new_x - old_bounds.center_x,
+                new_y - old_bounds.center_y,
+                rotation,
+                commit=True,
+            )
+            delta.check_time_ms = (time.perf_counter() - start_time) * 1000
+            return delta
+
+        delta = self.check_move(ref, new_x, new_y, rotation)
 
         if self.state is None:
             return delta
@@ -538,7 +664,12 @@ class IncrementalDRC:
         # Calculate new bounds
         dx = new_x - old_bounds.center_x
         dy = new_y - old_bounds.center_y
-        new_bounds = old_bounds.translate(dx, dy)
+        fp = self.pcb.get_footprint(ref)
+        if rotation is None or fp is None:
+            new_bounds = old_bounds.translate(dx, dy)
+        else:
+            position = (fp.position[0] + dx, fp.position[1] + dy)
+            new_bounds = self._compute_footprint_bounds(fp, position, rotation)
 
         # Update violations
         self.state.violations = [
@@ -551,6 +682,98 @@ class IncrementalDRC:
 
         return delta
 
+    def screen_moves(
+        self,
+        candidates: Sequence[tuple[str, float, float, float | None]],
+        num_threads: int = 0,
+    ) -> list[MoveScreen]:
+        """Score many candidate moves without changing the cached state.
+
+        Each candidate is ``(ref, new_x, new_y, rotation)`` with the
+        meaning ``check_move`` gives them, always measured from the current
+        placement.  With the native state the whole batch is one call,
+        evaluated in parallel against the shared spatial index; candidates
+        only report counts and the minimum clearance, not the violations.
+
+        Args:
+            candidates: Candidate moves, any mix of components
+            num_threads: Native worker threads (0 = hardware concurrency)
+
+        Returns:
+            One MoveScreen per candidate, in order.  Unknown components
+            report no violations and ``inf`` clearance.
+        """
+        if self.state is None:
+            self.full_check()
+        assert self.state is not None
+
+        screens = [MoveScreen(ref, x, y, rotation) for ref, x, y, rotation in candidates]
+        if self._native is None or not is_move_screening_available():
+            for screen in screens:
+                self._screen_move_python(screen)
+            return screens
+
+        picked: list[MoveScreen] = []
+        fs: list[int] = []
+        dxs: list[float] = []
+        dys: list[float] = []
+        drots: list[float] = []
+        for screen in screens:
+            f = self._native_index.get(screen.ref)
+            if f is None:
+                continue
+            bounds = self.state.component_bounds[screen.ref]
+            turn = 0.0 if screen.rotation is None else screen.rotation - self._rotations[screen.ref]
+            picked.append(screen)
+            fs.append(f)
+            dxs.append(screen.x - bounds.center_x)
+            dys.append(screen.y - bounds.center_y)
+            # Negated orientation, as everywhere else (issue #3739).
+            drots.append(math.radians(-turn))
+
+        counts, changes, lowest = screen_moves_cpp(
+            self._native, fs, dxs, dys, drots, num_threads=num_threads
+        )
+        for screen, count, change, clearance in zip(picked, counts, changes, lowest, strict=True):
+            screen.violations = count
+            screen.net_change = change
+            screen.min_clearance = clearance
+        return screens
+
+    def _screen_move_python(self, screen: MoveScreen) -> None:
+        """Fill one MoveScreen with the pure-Python pair loop."""
+        assert self.state is not None
+        old_bounds = self.state.component_bounds.get(screen.ref)
+        fp = self.pcb.get_footprint(screen.ref)
+        if old_bounds is None or fp is None:
+            return
+
+        dx = screen.x - old_bounds.center_x
+        dy = screen.y - old_bounds.center_y
+        position = (fp.position[0] + dx, fp.position[1] + dy)
+        if screen.rotation is None:
+            new_bounds = old_bounds.translate(dx, dy)
+        else:
+            new_bounds = self._compute_footprint_bounds(fp, position, screen.rotation)
+
+        threshold = self.rules.min_clearance_mm - _CLEARANCE_EPSILON_MM
+        for other_ref in self.state.spatial_index.query(new_bounds.expand(self._max_clearance)):
+            fp2 = self.pcb.get_footprint(other_ref) if other_ref != screen.ref else None
+            if fp2 is None:
+                continue
+            clearance, _, _, _ = self._pair_minimum_python(
+                fp, fp2, screen.ref, other_ref, position, screen.rotation
+            )
+            screen.min_clearance = min(screen.min_clearance, clearance)
+            if clearance < threshold:
+                screen.violations += 1
+
+        prefix = f"{screen.ref}-"
+        cached = sum(
+            1 for v in self.state.violations if any(item.startswith(prefix) for item in v.items)
+        )
+        screen.net_change = screen.violations - cached
+
     def get_current_violations(self) -> list[Violation]:
         """Get the current list of DRC violations.
 
@@ -561,6 +784,154 @@ class IncrementalDRC:
             return []
         return list(self.state.violations)
 
+    def pair_violations(self, ref1: str, ref2: str, max_results: int = 0) -> list[Violation]:
+        """Every violating pad pair between two components, closest first.
+
+        ``_check_pair_clearance`` reports only the worst pair; this lists
+        them all (or the ``max_results`` worst), at the board's placement,
+        with the same epsilon and net rules.
+
+        Args:
+            ref1: First component reference designator
+            ref2: Second component reference designator
+            max_results: Keep only that many pairs; 0 keeps all
+
+        Returns:
+            Clearance violations sorted by (clearance, pad1, pad2)
+        """
+        fp1 = self.pcb.get_footprint(ref1)
+        fp2 = self.pcb.get_footprint(ref2)
+        if fp1 is None or fp2 is None:
+            return []
+
+        threshold = self.rules.min_clearance_mm - _CLEARANCE_EPSILON_MM
+        if _is_drc_cpp_available() and is_pair_violations_available():
+            results = check_pair_violations_cpp(fp1, fp2, ref1, ref2, threshold, max_results)
+        else:
+            results = self._pair_violations_python(fp1, fp2, ref1, ref2, threshold)
+            if max_results > 0:
+                results = results[:max_results]
+        return [self._clearance_violation(*r) for r in results]
+
+    def _pair_violations_python(
+        self, fp1: Footprint, fp2: Footprint, ref1: str, ref2: str, threshold: float
+    ) -> list[tuple[float, tuple[float, float], tuple[str, ...], tuple[str, ...]]]:
+        """Pad pairs below ``threshold`` using pure Python (fallback)."""
+        # Negated KiCad orientation (issue #3739).
+        def placed(fp: Footprint) -> list[tuple[float, float, float]]:
+            c = math.cos(math.radians(-fp.rotation))
+            s = math.sin(math.radians(-fp.rotation))
+            return [
+                (
+                    fp.position[0] + pad.position[0] * c - pad.position[1] * s,
+                    fp.position[1] + pad.position[0] * s + pad.position[1] * c,
+                    max(pad.size[0], pad.size[1]) / 2,
+                )
+                for pad in fp.pads
+            ]
+
+        found = []
+        pads2 = list(zip(fp2.pads, placed(fp2), strict=True))
+        for i, (pad1, (x1, y1, r1)) in enumerate(zip(fp1.pads, placed(fp1), strict=True)):
+            for j, (pad2, (x2, y2, r2)) in enumerate(pads2):
+                # Same net pads can touch
+                if pad1.net_number == pad2.net_number and pad1.net_number != 0:
+                    continue
+                clearance = math.hypot(x2 - x1, y2 - y1) - r1 - r2
+                if clearance < threshold:
+                    found.append((clearance, i, j, ((x1 + x2) / 2, (y1 + y2) / 2)))
+
+        found.sort(key=lambda f: f[:3])
+        return [
+            (
+                clearance,
+                location,
+                (f"{ref1}-{fp1.pads[i].number}", f"{ref2}-{fp2.pads[j].number}"),
+                (fp1.pads[i].net_name, fp2.pads[j].net_name),
+            )
+            for clearance, i, j, location in found
+        ]
+
+    def _build_native_state(self) -> None:
+        """Build the native incremental state and its initial violations."""
+        assert self.state is not None
+
+        for fp in self.pcb.footprints:
+            self.state.component_bounds[fp.reference] = self._compute_footprint_bounds(fp)
+
+        refs: list[str] = []
+        footprints: list[Footprint] = []
+        for ref in self.state.component_bounds:
+            fp = self.pcb.get_footprint(ref)
+            if fp is not None:
+                refs.append(ref)
+                footprints.append(fp)
+
+        self._native = create_incremental_clearance_cpp(
+            footprints, self.rules.min_clearance_mm, _CLEARANCE_EPSILON_MM
+        )
+        self._native_refs = refs
+        self._native_footprints = footprints
+        self._native_index = {ref: i for i, ref in enumerate(refs)}
+        self._rotations = {ref: fp.rotation for ref, fp in zip(refs, footprints, strict=True)}
+        self._native_violations = {
+            (v.footprint1, v.footprint2): self._native_violation(v)
+            for v in self._native.violations()
+        }
+        self.state.spatial_index = NativeSpatialIndex(
+            self._native, refs, self.state.component_bounds
+        )
+
+    def _native_violation(self, v) -> Violation:
+        """Violation for a native ``BoardClearanceViolation``."""
+        return self._clearance_violation(
+            *board_violation_fields(self._native_footprints, self._native_refs, v)
+        )
+
+    def _native_move(
+        self, ref: str, dx: float, dy: float, rotation: float | None, *, commit: bool
+    ) -> DRCDelta:
+        """Preview (or commit) a move in the native state.
+
+        Only the pairs the footprint takes part in are evaluated.  As in the
+        Python path, ``new_violations`` holds every violation of the moved
+        footprint and ``resolved_violations`` the cached ones not among them.
+        """
+        assert self.state is not None
+        f = self._native_index[ref]
+        turn = 0.0 if rotation is None else rotation - self._rotations[ref]
+        # Negated orientation, as everywhere else (issue #3739).
+        drot = math.radians(-turn)
+        move = (self._native.apply_move if commit else self._native.check_move)(f, dx, dy, drot)
+
+        new = {(v.footprint1, v.footprint2): self._native_violation(v) for v in move.violations}
+        cached = self._native_violations
+        old_keys = [(v.footprint1, v.footprint2) for v in move.resolved]
+        old_keys += [key for key in new if key in cached]
+        resolved = [cached[key] for key in sorted(old_keys) if new.get(key) != cached[key]]
+
+        if commit:
+            for key in old_keys:
+                del cached[key]
+            cached.update(new)
+            self.state.violations = list(cached.values())
+            if rotation is not None:
+                self._rotations[ref] = rotation
+            box = self._native.bounds(f)
+            if all(math.isfinite(c) for c in box):
+                self.state.component_bounds[ref] = Rectangle(*box)
+            else:  # no pads: the box is the 1mm marker around the origin
+                self.state.component_bounds[ref] = self.state.component_bounds[ref].translate(
+                    dx, dy
+                )
+
+        return DRCDelta(
+            new_violations=list(new.values()),
+            resolved_violations=resolved,
+            affected_components=[ref] + [self._native_refs[g] for g in move.neighbours],
+            affected_nets=self._component_nets.get(ref, []),
+        )
+
     def _build_spatial_index(self) -> None:
         """Build spatial index from PCB footprints."""
         assert self.state is not None
@@ -570,11 +941,22 @@ class IncrementalDRC:
             self.state.spatial_index.insert(fp.reference, bounds)
             self.state.component_bounds[fp.reference] = bounds
 
-    def _compute_footprint_bounds(self, fp: Footprint) -> Rectangle:
-        """Compute bounding box for a footprint including all pads."""
+    def _compute_footprint_bounds(
+        self,
+        fp: Footprint,
+        position: tuple[float, float] | None = None,
+        rotation: float | None = None,
+    ) -> Rectangle:
+        """Compute bounding box for a footprint including all pads.
+
+        ``position`` and ``rotation`` (degrees) override the footprint's own
+        placement, for previewing moves.
+        """
+        position = position if position is not None else fp.position
+        rotation = rotation if rotation is not None else fp.rotation
         if not fp.pads:
             # Use footprint position with small default size
-            return Rectangle.from_center(fp.position[0], fp.position[1], 1.0, 1.0)
+            return Rectangle.from_center(position[0], position[1], 1.0, 1.0)
 
         # Get bounds from all pads (in board coordinates)
         min_x = float("inf")
@@ -584,16 +966,16 @@ class IncrementalDRC:
 
         # KiCad applies the footprint orientation as a NEGATED angle vs
         # standard CCW math (verified vs pcbnew, issue #3739).
-        cos_a = math.cos(math.radians(-fp.rotation))
-        sin_a = math.sin(math.radians(-fp.rotation))
+        cos_a = math.cos(math.radians(-rotation))
+        sin_a = math.sin(math.radians(-rotation))
 
         for pad in fp.pads:
             # Transform pad position to board coordinates
             local_x, local_y = pad.position
             rotated_x = local_x * cos_a - local_y * sin_a
             rotated_y = local_x * sin_a + local_y * cos_a
-            abs_x = fp.position[0] + rotated_x
-            abs_y = fp.position[1] + rotated_y
+            abs_x = position[0] + rotated_x
+            abs_y = position[1] + rotated_y
 
             # Expand by pad size
             pad_half_w = pad.size[0] / 2
@@ -642,7 +1024,19 @@ class IncrementalDRC:
         return violations
 
     def _check_all_clearances(self) -> list[Violation]:
-        """Check clearances between all components."""
+        """Check clearances between all components.
+
+        Reads the native incremental state when it was built (its
+        construction ran the whole-board sweep), else uses the C++
+        whole-board sweep when available; otherwise checks each pair of
+        components whose bounds come within clearance.
+        """
+        if self._native is not None:
+            return list(self._native_violations.values())
+
+        if _is_drc_cpp_available() and is_board_clearance_available():
+            return self._check_all_clearances_cpp()
+
         violations: list[Violation] = []
 
         # Get all footprint references
@@ -677,6 +1071,44 @@ class IncrementalDRC:
 
         return violations
 
+    def _check_all_clearances_cpp(self) -> list[Violation]:
+        """Check clearances between all components in one native sweep."""
+        refs: list[str] = []
+        footprints: list[Footprint] = []
+        for ref in self.state.component_bounds if self.state else ():
+            fp = self.pcb.get_footprint(ref)
+            if fp is not None:
+                refs.append(ref)
+                footprints.append(fp)
+
+        results = check_board_clearance_cpp(
+            footprints, refs, self.rules.min_clearance_mm, _CLEARANCE_EPSILON_MM
+        )
+
+        return [
+            self._clearance_violation(min_clearance, location, items, nets)
+            for _i, _j, min_clearance, location, items, nets in results
+        ]
+
+    def _clearance_violation(
+        self,
+        min_clearance: float,
+        location: tuple[float, float],
+        items: tuple[str, ...],
+        nets: tuple[str, ...],
+    ) -> Violation:
+        """Clearance violation as the native sweeps report it."""
+        return Violation(
+            rule_id="clearance",
+            message=f"Clearance {min_clearance:.3f}mm < minimum {self.rules.min_clearance_mm:.3f}mm",
+            severity="error",
+            location=location,
+            items=items,
+            nets=nets,
+            actual_value=min_clearance,
+            required_value=self.rules.min_clearance_mm,
+        )
+
     def _check_pair_clearance(self, ref1: str, ref2: str) -> Violation | None:
         """Check clearance between two components.
 
@@ -700,9 +1132,10 @@ class IncrementalDRC:
         ref1: str,
         ref2: str,
         fp1_position: tuple[float, float] | None = None,
+        fp1_rotation: float | None = None,
     ) -> Violation | None:
         """Check clearance using C++ backend."""
-        result = check_pair_clearance_cpp(fp1, fp2, ref1, ref2, fp1_position)
+        result = check_pair_clearance_cpp(fp1, fp2, ref1, ref2, fp1_position, fp1_rotation)
         if result is None:
             return None
 
@@ -731,8 +1164,43 @@ class IncrementalDRC:
         ref1: str,
         ref2: str,
         fp1_position: tuple[float, float] | None = None,
+        fp1_rotation: float | None = None,
     ) -> Violation | None:
         """Check clearance using pure Python (fallback)."""
+        min_clearance, min_location, min_items, min_nets = self._pair_minimum_python(
+            fp1, fp2, ref1, ref2, fp1_position, fp1_rotation
+        )
+
+        # Check if below minimum clearance.
+        # Apply floating-point epsilon (#2428 pattern) to avoid spurious
+        # sub-micron violations from IEEE-754 rounding in radius/trig math.
+        if min_clearance < self.rules.min_clearance_mm - _CLEARANCE_EPSILON_MM:
+            return Violation(
+                rule_id="clearance",
+                message=f"Clearance {min_clearance:.3f}mm < minimum {self.rules.min_clearance_mm:.3f}mm",
+                severity="error",
+                location=min_location,
+                items=min_items,
+                nets=min_nets,
+                actual_value=min_clearance,
+                required_value=self.rules.min_clearance_mm,
+            )
+
+        return None
+
+    def _pair_minimum_python(
+        self,
+        fp1: Footprint,
+        fp2: Footprint,
+        ref1: str,
+        ref2: str,
+        fp1_position: tuple[float, float] | None = None,
+        fp1_rotation: float | None = None,
+    ) -> tuple[float, tuple[float, float], tuple[str, ...], tuple[str, ...]]:
+        """Closest different-net pad pair: clearance, location, items, nets.
+
+        The clearance is ``inf`` when every pad pair shares a net.
+        """
         # Check pad-to-pad clearances
         min_clearance = float("inf")
         min_location = (0.0, 0.0)
@@ -740,11 +1208,12 @@ class IncrementalDRC:
         min_nets: tuple[str, ...] = ()
 
         pos1 = fp1_position if fp1_position is not None else fp1.position
+        rot1 = fp1_rotation if fp1_rotation is not None else fp1.rotation
 
         # KiCad applies the footprint orientation as a NEGATED angle vs
         # standard CCW math (verified vs pcbnew, issue #3739).
-        cos1 = math.cos(math.radians(-fp1.rotation))
-        sin1 = math.sin(math.radians(-fp1.rotation))
+        cos1 = math.cos(math.radians(-rot1))
+        sin1 = math.sin(math.radians(-rot1))
         cos2 = math.cos(math.radians(-fp2.rotation))
         sin2 = math.sin(math.radians(-fp2.rotation))
 
@@ -780,25 +1249,14 @@ class IncrementalDRC:
                     min_items = (f"{ref1}-{pad1.number}", f"{ref2}-{pad2.number}")
                     min_nets = (pad1.net_name, pad2.net_name)
 
-        # Check if below minimum clearance.
-        # Apply floating-point epsilon (#2428 pattern) to avoid spurious
-        # sub-micron violations from IEEE-754 rounding in radius/trig math.
-        if min_clearance < self.rules.min_clearance_mm - _CLEARANCE_EPSILON_MM:
-            return Violation(
-                rule_id="clearance",
-                message=f"Clearance {min_clearance:.3f}mm < minimum {self.rules.min_clearance_mm:.3f}mm",
-                severity="error",
-                location=min_location,
-                items=min_items,
-                nets=min_nets,
-                actual_value=min_clearance,
-                required_value=self.rules.min_clearance_mm,
-            )
-
-        return None
+        return min_clearance, min_location, min_items, min_nets
 
     def _check_component_clearances(
-        self, ref: str, bounds: Rectangle, nearby_refs: list[str]
+        self,
+        ref: str,
+        new_position: tuple[float, float],
+        nearby_refs: list[str],
+        rotation: float | None = None,
     ) -> list[Violation]:
         """Check clearances for a single component against nearby components.
 
@@ -811,17 +1269,6 @@ class IncrementalDRC:
         if fp is None:
             return violations
 
-        # Calculate the offset from original position
-        original_bounds = self.state.component_bounds.get(ref) if self.state else None
-        if original_bounds is None:
-            return violations
-
-        dx = bounds.center_x - original_bounds.center_x
-        dy = bounds.center_y - original_bounds.center_y
-
-        # Create a modified position tuple
-        new_position = (fp.position[0] + dx, fp.position[1] + dy)
-
         use_cpp = _is_drc_cpp_available()
 
         for other_ref in nearby_refs:
@@ -834,11 +1281,11 @@ class IncrementalDRC:
 
             if use_cpp:
                 violation = self._check_pair_clearance_cpp(
-                    fp, fp2, ref, other_ref, fp1_position=new_position
+                    fp, fp2, ref, other_ref, fp1_position=new_position, fp1_rotation=rotation
                 )
             else:
                 violation = self._check_pair_clearance_python(
-                    fp, fp2, ref, other_ref, fp1_position=new_position
+                    fp, fp2, ref, other_ref, fp1_position=new_position, fp1_rotation=rotation
                 )
 
             if violation:
@@ -855,6 +1302,8 @@ __all__ = [
     "DRCDelta",
     "DRCState",
     "IncrementalDRC",
+    "MoveScreen",
+    "NativeSpatialIndex",
     "Rectangle",
     "SpatialIndex",
     "Violation",
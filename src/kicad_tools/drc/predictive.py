@@ -15,6 +15,10 @@ Example:
     >>> warnings = analyzer.analyze_move("U1", (50.0, 30.0))
     >>> for w in warnings:
     ...     print(f"{w.type}: {w.message}")
+    >>>
+    >>> # Screen many candidate moves at once (counts and clearances only)
+    >>> screens = analyzer.screen_moves([("U1", (50.0, 30.0)), ("U1", (52.0, 30.0))])
+    >>> best = min(screens, key=lambda s: (s.net_change, -s.min_clearance))
 """
 
 from __future__ import annotations
@@ -24,12 +28,17 @@ import time
 from dataclasses import dataclass, field
 from typing import TYPE_CHECKING
 
-from kicad_tools.drc.incremental import Rectangle
+from kicad_tools.drc.incremental import MoveScreen, Rectangle
 
 if TYPE_CHECKING:
+    from collections.abc import Sequence
+
     from kicad_tools.intent.types import IntentDeclaration
     from kicad_tools.optim.session import PlacementSession
 
+    # (ref, (x, y)) or (ref, (x, y), rotation_degrees)
+    MoveCandidate = tuple[str, tuple[float, float]] | tuple[str, tuple[float, float], float]
+
 
 @dataclass
 class PredictiveWarning:
@@ -159,6 +168,34 @@ class PredictiveAnalyzer:
 
         return warnings
 
+    def screen_moves(
+        self,
+        candidates: Sequence[MoveCandidate],
+        num_threads: int = 0,
+    ) -> list[MoveScreen]:
+        """Predict the clearance outcome of many candidate moves in one batch.
+
+        Meant for optimizers that try thousands of moves per step:
+        candidates are scored against the DRC engine's shared spatial index
+        (in parallel, natively, when the C++ backend is built) without the
+        per-move warnings of :meth:`analyze_move` or any state change.
+
+        Args:
+            candidates: ``(ref, (x, y))`` or ``(ref, (x, y), rotation)``
+                tuples; positions and rotations (degrees) as for
+                :meth:`analyze_move`, each from the current placement
+            num_threads: Worker threads for the native pass (0 = all cores)
+
+        Returns:
+            One MoveScreen per candidate, in order: the violations the
+            component would take part in, the change in the board's
+            violation count, and the minimum clearance to its neighbours
+        """
+        moves = [
+            (ref, pos[0], pos[1], rest[0] if rest else None) for ref, pos, *rest in candidates
+        ]
+        return self._drc_engine.screen_moves(moves, num_threads=num_threads)
+
     def _check_routing_difficulty(
         self,
         ref: str,
@@ -771,6 +808,7 @@ class PredictiveAnalyzer:
 
 
 __all__ = [
+    "MoveScreen",
     "PredictiveAnalyzer",
     "PredictiveWarning",
 ]
@@ -260,49 +260,71 @@ def steiner_lower_bound(pads: list[PadFeature]) -> float:
     For 0 or 1 pads we return 0 (no routing needed).  For 2 pads the lower
     bound is Manhattan distance.  For 3+ pads we delegate to the RSMT solver.
     """
-    n = len(pads)
-    if n < 2:
-        return 0.0
+    return steiner_lower_bounds({0: pads})[0]
+
 
-    coords = [(p.x, p.y) for p in pads]
-    if n == 2:
-        return manhattan(coords[0], coords[1])
+def steiner_lower_bounds(nets: dict[int, list[PadFeature]]) -> dict[int, float]:
+    """:func:`steiner_lower_bound` for every net of a board in one call.
+
+    The 3+ pad nets go through
+    :func:`kicad_tools.router.algorithms.steiner.build_rsmt_batch` together,
+    without a grid, so the native ``router_cpp.build_rsmt_all`` builds the
+    whole board in one threaded call rather than one net at a time.  Any
+    solver failure falls back to the per-net MST cost.
+    """
+    out: dict[int, float] = {}
+    multi: dict[int, list[PadFeature]] = {}
+    for net_num, pads in nets.items():
+        if len(pads) < 2:
+            out[net_num] = 0.0
+        elif len(pads) == 2:
+            out[net_num] = manhattan((pads[0].x, pads[0].y), (pads[1].x, pads[1].y))
+        else:
+            multi[net_num] = pads
+    if not multi:
+        return out
 
-    # Delegate to the router's RSMT solver.  We construct lightweight
-    # adapter objects that quack like router.primitives.Pad: only x/y
-    # are accessed in the multi-terminal case we care about.
     try:
-        from kicad_tools.router.algorithms.steiner import build_rsmt
-        from kicad_tools.router.layers import Layer
-        from kicad_tools.router.primitives import Pad as RouterPad
-
-        # Build minimal pad-like objects.  The Steiner solver only reads
-        # x/y and (for the virtual-pad output) net/net_name/layer/ref/pin --
-        # we supply sensible defaults via a duck-typed namedtuple alike.
-        router_pads = [
-            RouterPad(
-                x=p.x,
-                y=p.y,
-                width=0.1,
-                height=0.1,
-                net=p.net_number,
-                net_name=p.net_name,
-                layer=Layer.F_CU,
-                ref=p.reference,
-                pin=p.pad_number,
-                through_hole=p.is_through_hole,
-                drill=0.0,
+        from kicad_tools.router.algorithms.steiner import build_rsmt_batch
+
+        trees = build_rsmt_batch({net_num: _router_pads(pads) for net_num, pads in multi.items()})
+        for net_num, (all_pads, edges) in trees.items():
+            out[net_num] = sum(
+                manhattan((all_pads[i].x, all_pads[i].y), (all_pads[j].x, all_pads[j].y))
+                for i, j in edges
             )
-            for p in pads
-        ]
-        all_pads, edges = build_rsmt(router_pads)
-        total = 0.0
-        for i, j in edges:
-            total += manhattan((all_pads[i].x, all_pads[i].y), (all_pads[j].x, all_pads[j].y))
-        return total
     except Exception:
         # Fall back to MST cost as a conservative lower bound.
-        return _mst_cost_manhattan(coords)
+        for net_num, pads in multi.items():
+            out[net_num] = _mst_cost_manhattan([(p.x, p.y) for p in pads])
+    return out
+
+
+def _router_pads(pads: list[PadFeature]) -> list:
+    """Adapt pad features to ``router.primitives.Pad`` for the Steiner solver.
+
+    The solver only reads x/y and (for the virtual-pad output)
+    net/net_name/layer/ref/pin, so the remaining fields get defaults.
+    """
+    from kicad_tools.router.layers import Layer
+    from kicad_tools.router.primitives import Pad as RouterPad
+
+    return [
+        RouterPad(
+            x=p.x,
+            y=p.y,
+            width=0.1,
+            height=0.1,
+            net=p.net_number,
+            net_name=p.net_name,
+            layer=Layer.F_CU,
+            ref=p.reference,
+            pin=p.pad_number,
+            through_hole=p.is_through_hole,
+            drill=0.0,
+        )
+        for p in pads
+    ]
 
 
 def _mst_cost_manhattan(points: list[tuple[float, float]]) -> float:
@@ -482,15 +504,12 @@ def _steiner_total_signal_length(features: BoardFeatures) -> float:
     Power nets (heuristically detected by name) are excluded so the
     feature captures signal congestion rather than plane-net pad count.
     """
-    total = 0.0
-    for net_num, pads in features.nets_to_pads.items():
-        if len(pads) < 2:
-            continue
-        name = features.net_names.get(net_num, "") or ""
-        if _looks_like_power_net(name):
-            continue
-        total += steiner_lower_bound(pads)
-    return total
+    signal_nets = {
+        net_num: pads
+        for net_num, pads in features.nets_to_pads.items()
+        if len(pads) >= 2 and not _looks_like_power_net(features.net_names.get(net_num, "") or "")
+    }
+    return sum(steiner_lower_bounds(signal_nets).values())
 
 
 def _looks_like_power_net(name: str) -> bool:
@@ -472,7 +472,7 @@ class PlacementSession:
         new_rot = rotation if rotation is not None else old_rot
 
         # Check DRC impact using incremental engine (preview only)
-        drc_delta = self._drc_engine.check_move(ref, x, y)
+        drc_delta = self._drc_engine.check_move(ref, x, y, rotation)
 
         # Temporarily apply the move for placement violations
         comp.x, comp.y, comp.rotation = x, y, new_rot
@@ -577,7 +577,7 @@ class PlacementSession:
         comp.update_pin_positions()
 
         # Apply the move to DRC engine and get actual delta
-        drc_delta = self._drc_engine.apply_move(ref, x, y)
+        drc_delta = self._drc_engine.apply_move(ref, x, y, rotation)
 
         # Record DRC history
         self._drc_history.append((f"move:{ref}", drc_delta))
@@ -60,6 +60,13 @@ class PlacementCostConfig:
             that share a voltage domain into a compact zone but never gates
             feasibility. Kept small relative to the hard-constraint weights so
             it only shapes the layout once a placement is already feasible.
+        congestion_weight: Weight for the RUDY congestion term (peak tile
+            demand, see :class:`~kicad_tools.placement.cpp_backend.PlacementCongestion`).
+            A soft preference like cohesion; only the multi-fidelity
+            evaluator at fidelity >= 1 fills the term.  Off (0.0) by
+            default: the peak demand is raw wire length per tile and is
+            not normalised against the other terms, so a positive weight
+            is an opt-in that changes every fidelity >= 1 score.
         mode: Scoring mode (weighted_sum or lexicographic).
     """
 
@@ -72,6 +79,7 @@ class PlacementCostConfig:
     inter_block_spacing: float = 1.0
     creepage_weight: float = 1e5
     cohesion_weight: float = 1.0
+    congestion_weight: float = 0.0
     mode: CostMode = CostMode.WEIGHTED_SUM
 
 
@@ -113,6 +121,9 @@ class CostBreakdown:
             every voltage domain with two or more members, of each member's
             distance to its domain centroid (a radius-of-gyration-style spread
             penalty). Lower means each domain is packed more tightly.
+        congestion: Raw RUDY congestion (mm) -- the peak per-tile routing
+            demand of the nets' pad bounding boxes.  Filled by the
+            multi-fidelity evaluator at fidelity >= 1; ``0.0`` elsewhere.
     """
 
     wirelength: float = 0.0
@@ -124,6 +135,7 @@ class CostBreakdown:
     inter_block: float = 0.0
     creepage: float = 0.0
     cohesion: float = 0.0
+    congestion: float = 0.0
 
 
 @dataclass(frozen=True)
@@ -856,6 +868,7 @@ def _weighted_sum_score(breakdown: CostBreakdown, config: PlacementCostConfig) -
         + config.block_boundary_weight * breakdown.inter_block
         + config.creepage_weight * breakdown.creepage
         + config.cohesion_weight * breakdown.cohesion
+        + config.congestion_weight * breakdown.congestion
     )
 
 
@@ -872,10 +885,10 @@ def _lexicographic_score(
     large constant offset.
 
     Feasible placements are scored by the weighted sum of wirelength, area,
-    and the soft same-domain cohesion term. Cohesion shapes the layout only
-    once a placement is already feasible -- it is absent from the infeasible
-    offset branch so it can never make one infeasible placement outrank
-    another on preference alone.
+    and the soft same-domain cohesion and congestion terms. These shape the
+    layout only once a placement is already feasible -- they are absent from
+    the infeasible offset branch so they can never make one infeasible
+    placement outrank another on preference alone.
     """
     if not is_feasible:
         # Large offset ensures any infeasible score > any feasible score.
@@ -892,4 +905,5 @@ def _lexicographic_score(
             config.wirelength_weight * breakdown.wirelength
             + config.area_weight * breakdown.area
             + config.cohesion_weight * breakdown.cohesion
+            + config.congestion_weight * breakdown.congestion
         )
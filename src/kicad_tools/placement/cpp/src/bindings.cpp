@@ -2,14 +2,16 @@
  * Placement C++ Core - nanobind Python bindings
  *
  * Exposes AABB overlap/clearance operations, the BatchCostEvaluator,
- * force-directed placement engine, and evolutionary fitness evaluation
- * for high-performance placement cost and force evaluation.
+ * force-directed placement engine, evolutionary fitness evaluation and the
+ * RUDY congestion map for high-performance placement cost and force
+ * evaluation.
  */
 
 #include "aabb.hpp"
 #include "cost_evaluator.hpp"
 #include "fitness_evaluator.hpp"
 #include "force_engine.hpp"
+#include "rudy_bindings.hpp"
 #include <nanobind/nanobind.h>
 #include <nanobind/stl/pair.h>
 #include <nanobind/stl/string.h>
@@ -21,6 +23,15 @@ namespace nb = nanobind;
 using namespace nb::literals;
 using namespace placement;
 
+namespace placement {
+// The RUDY kernel shared with router_cpp, under this module's own C++ type
+// (see rudy_bindings.hpp).
+class RudyMap : public congestion::RudyMap {
+public:
+    using congestion::RudyMap::RudyMap;
+};
+}  // namespace placement
+
 NB_MODULE(placement_cpp, m) {
     m.doc() = "C++ placement core for high-performance AABB cost, force, and fitness evaluation";
 
@@ -143,7 +154,10 @@ NB_MODULE(placement_cpp, m) {
           "Mirrors _evaluate_fitness_worker() in evolutionary.py.\n"
           "Returns a fitness value (higher is better).");
 
+    // --- RUDY congestion map (shared kernel with router_cpp) ---
+    congestion::bind_rudy<placement::RudyMap>(m);
+
     // Version info
-    m.def("version", []() { return "2.1.0"; });
+    m.def("version", []() { return "2.2.0"; });
     m.def("is_available", []() { return true; });
 }
@@ -18,10 +18,12 @@ installed. Build it with:
 from __future__ import annotations
 
 import logging
+import os
 from typing import TYPE_CHECKING, Sequence
 
 if TYPE_CHECKING:
-    from .cost import BoardOutline, ComponentPlacement, DesignRuleSet
+    from .cost import BoardOutline, ComponentPlacement, DesignRuleSet, Net
+    from .vector import PlacedComponent
 
 logger = logging.getLogger(__name__)
 
@@ -409,3 +411,118 @@ class BatchCostEvaluatorWrapper:
         from .cost import compute_drc_violations
 
         return compute_drc_violations(placements, self._rules, footprint_sizes)
+
+
+def create_rudy_map(board: BoardOutline, target_tiles: int = 100):
+    """Create a ``placement_cpp.RudyMap`` over the board, or ``None`` without C++.
+
+    The map is the RUDY kernel ``router/congestion_estimator.py`` uses on the
+    routing side, over the same ``TileGrid`` tiling.  Register each net with
+    ``set_net(net, [(x, y, component), ...])`` (component ``-1`` for fixed
+    pins); ``move_component(component, dx, dy)`` then re-applies only that
+    component's nets, so a placement move costs O(its nets + tiles) before
+    ``peak()`` / ``overflow(capacity)`` / ``net_score(net)`` are read back.
+    """
+    if not _CPP_AVAILABLE or not hasattr(placement_cpp, "RudyMap"):
+        return None
+    from ..router.congestion_estimator import TileGrid
+
+    grid = TileGrid.from_board(
+        board.min_x,
+        board.min_y,
+        board.max_x - board.min_x,
+        board.max_y - board.min_y,
+        target_tiles=target_tiles,
+    )
+    return placement_cpp.RudyMap(
+        grid.origin_x, grid.origin_y, grid.tile_w, grid.tile_h, grid.cols, grid.rows
+    )
+
+
+class PlacementCongestion:
+    """Incremental RUDY congestion of a placement, for fitness evaluation.
+
+    Every net is registered on a :func:`create_rudy_map` map with its real
+    pad positions, each pin tagged with its component.  :meth:`update`
+    diffs a new placement against the previous one: a translated component
+    is one ``move_component`` (only its nets are re-applied), a rotated or
+    flipped one re-registers its nets from the transformed pads.  Without
+    the C++ backend (or with ``KCT_RUDY_CPP=0``) each update rebuilds the
+    demand with the Python loops of ``CongestionEstimator``.
+
+    Net ids on the map are ``index + 1`` into ``nets``.
+    """
+
+    def __init__(
+        self,
+        board: BoardOutline,
+        nets: Sequence[Net],
+        target_tiles: int = 100,
+        use_native: bool | None = None,
+    ):
+        if use_native is None:
+            use_native = os.environ.get("KCT_RUDY_CPP", "1") != "0"
+        self._board = board
+        self._target_tiles = target_tiles
+        self._nets = {n + 1: [tuple(pin) for pin in net.pins] for n, net in enumerate(nets)}
+        self._components: dict[str, int] = {}
+        self._component_nets: dict[str, set[int]] = {}
+        for net_id, pins in self._nets.items():
+            for ref, _pin in pins:
+                self._components.setdefault(ref, len(self._components))
+                self._component_nets.setdefault(ref, set()).add(net_id)
+        self._poses: dict[str, tuple[float, float, float, int]] = {}
+        self._map = create_rudy_map(board, target_tiles) if use_native else None
+
+    @property
+    def native(self) -> bool:
+        """True when the demand lives in ``placement_cpp.RudyMap``."""
+        return self._map is not None
+
+    def update(self, placements: Sequence[PlacedComponent]) -> float:
+        """Bring the map to ``placements``; returns the peak tile demand (mm)."""
+        if self._map is None:
+            return self._python_peak(placements)
+
+        stale: set[int] = set()
+        for p in placements:
+            pose = (p.x, p.y, p.rotation, p.side)
+            old = self._poses.get(p.reference)
+            if old == pose:
+                continue
+            self._poses[p.reference] = pose
+            component = self._components.get(p.reference)
+            if component is None:
+                continue
+            if old is None or old[2:] != pose[2:]:
+                stale |= self._component_nets[p.reference]
+            else:
+                self._map.move_component(component, p.x - old[0], p.y - old[1])
+        if stale:
+            pads = {(p.reference, pad.name): pad for p in placements for pad in p.pads}
+            for net_id in stale:
+                self._map.set_net(
+                    net_id,
+                    [
+                        (pads[key].x, pads[key].y, self._components[key[0]])
+                        for key in self._nets[net_id]
+                        if key in pads
+                    ],
+                )
+        return self._map.peak()
+
+    def _python_peak(self, placements: Sequence[PlacedComponent]) -> float:
+        from ..router.congestion_estimator import CongestionEstimator
+
+        board = self._board
+        estimator = CongestionEstimator.from_nets(
+            self._nets,
+            {(p.reference, pad.name): pad for p in placements for pad in p.pads},
+            board.min_x,
+            board.min_y,
+            board.width,
+            board.height,
+            target_tiles=self._target_tiles,
+            use_native=False,
+        )
+        return max((max(row) for row in estimator.demand if row), default=0.0)
@@ -11,7 +11,7 @@ Fidelity Levels
 Level  Method                      Approx Cost  Use
 =====  ==========================  ===========  ==============================
 0      HPWL + overlap + boundary   ~1 ms        Broad exploration
-1      + DRC clearance checking    ~10 ms       Promising region refinement
+1      + DRC + RUDY congestion     ~10 ms       Promising region refinement
 2      + Global trial routing      ~100 ms      Routability verification
 3      + Full detailed routing     ~1 s         Final validation
 =====  ==========================  ===========  ==============================
@@ -56,6 +56,7 @@ from .drc import DrcResult, check_placement_drc
 from .vector import ComponentDef, PlacedComponent
 
 if TYPE_CHECKING:
+    from kicad_tools.placement.cpp_backend import PlacementCongestion
     from kicad_tools.router.global_router import GlobalRouter
     from kicad_tools.router.orchestrator import RoutingOrchestrator
     from kicad_tools.router.rules import DesignRules
@@ -77,7 +78,8 @@ class FidelityLevel(IntEnum):
     """Fidelity 0: HPWL wirelength + overlap + boundary checks only (~1 ms)."""
 
     DRC = 1
-    """Fidelity 1: Adds DRC courtyard/pad clearance checking (~10 ms)."""
+    """Fidelity 1: Adds DRC courtyard/pad clearance checking and the RUDY
+    congestion term over the real pad positions (~10 ms)."""
 
     GLOBAL_ROUTE = 2
     """Fidelity 2: Adds global router routability check (~100 ms)."""
@@ -296,11 +298,13 @@ def _evaluate_fidelity_1(
     board: BoardOutline,
     config: FidelityConfig,
     design_rules: DesignRules | None,
+    congestion: PlacementCongestion,
 ) -> tuple[CostBreakdown, bool, DrcResult | None]:
-    """Fidelity 1: Fidelity 0 + DRC clearance checking.
+    """Fidelity 1: Fidelity 0 + DRC clearance checking + RUDY congestion.
 
-    Uses the richer PlacedComponent type with transformed pads for DRC.
-    Falls back to fidelity 0 DRC score (0) if no design rules provided.
+    Uses the richer PlacedComponent type with transformed pads for DRC and
+    for the congestion map's pins.  Falls back to fidelity 0 DRC score (0)
+    if no design rules provided.
     """
     # First compute fidelity-0 metrics using simple placement types
     simple_placements = [
@@ -336,6 +340,7 @@ def _evaluate_fidelity_1(
         boundary=boundary,
         drc=drc_score,
         area=area,
+        congestion=congestion.update(placements_rich),
     )
     is_feasible = overlap == 0.0 and boundary == 0.0 and drc_score == 0.0
     return breakdown, is_feasible, drc_result
@@ -381,6 +386,7 @@ def evaluate_placement_multifidelity(
     design_rules: DesignRules | None = None,
     global_router: GlobalRouter | None = None,
     orchestrator: RoutingOrchestrator | None = None,
+    congestion: PlacementCongestion | None = None,
 ) -> FidelityResult:
     """Evaluate a placement at the specified fidelity level.
 
@@ -399,6 +405,9 @@ def evaluate_placement_multifidelity(
         design_rules: Design rules for DRC (required for fidelity >= 1).
         global_router: Pre-configured GlobalRouter (required for fidelity >= 2).
         orchestrator: Pre-configured RoutingOrchestrator (required for fidelity 3).
+        congestion: RUDY map of the previous evaluation (fidelity >= 1).  Reusing
+            one across calls makes each update incremental in the components
+            that moved; ``None`` builds a fresh one for this call.
 
     Returns:
         :class:`FidelityResult` with score, timing, and level-specific details.
@@ -461,6 +470,10 @@ def evaluate_placement_multifidelity(
             )
         rich_placements = placements  # type: ignore[assignment]
         assert component_defs is not None  # validated above
+        if congestion is None:
+            from .cpp_backend import PlacementCongestion
+
+            congestion = PlacementCongestion(board, nets)
 
         # --- Fidelity 1: + DRC ---
         breakdown, is_feasible, drc_result = _evaluate_fidelity_1(
@@ -470,6 +483,7 @@ def evaluate_placement_multifidelity(
             board,
             config,
             design_rules,
+            congestion,
         )
 
         # --- Fidelity 2: + global routing ---
@@ -606,7 +620,8 @@ def make_fixed_fidelity_evaluator(
 
     Returns a callable that accepts only placements and returns a
     :class:`FidelityResult`.  All other parameters are captured in the
-    closure.
+    closure, along with one congestion map that successive evaluations
+    update incrementally.
 
     Args:
         fidelity: Fixed fidelity level for all evaluations.
@@ -621,6 +636,9 @@ def make_fixed_fidelity_evaluator(
     Returns:
         A callable ``(placements) -> FidelityResult``.
     """
+    from .cpp_backend import PlacementCongestion
+
+    congestion = PlacementCongestion(board, nets) if fidelity >= FidelityLevel.DRC else None
 
     def _evaluate(
         placements: Sequence[ComponentPlacement] | Sequence[PlacedComponent],
@@ -635,6 +653,7 @@ def make_fixed_fidelity_evaluator(
             design_rules=design_rules,
             global_router=global_router,
             orchestrator=orchestrator,
+            congestion=congestion,
         )
 
     return _evaluate
@@ -674,7 +693,10 @@ def make_adaptive_evaluator(
     Returns:
         A callable ``(placements, iteration) -> FidelityResult``.
     """
+    from .cpp_backend import PlacementCongestion
+
     # Mutable state shared across calls via list wrappers
+    congestion = PlacementCongestion(board, nets)
     _budget_spent = [0.0]
     _best_score: list[PlacementScore | None] = [None]
 
@@ -700,6 +722,7 @@ def make_adaptive_evaluator(
             design_rules=design_rules,
             global_router=global_router,
             orchestrator=orchestrator,
+            congestion=congestion,
         )
 
         # Update state
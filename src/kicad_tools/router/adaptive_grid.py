@@ -22,6 +22,12 @@ This module implements a two-phase adaptive routing strategy:
 
 The result is 100% pad reachability at coarse-grid routing speed.
 
+With the C++ router, ``single_search=True`` replaces both phases: Phase 1
+installs refinement regions on the native grid around the fine-pitch
+components (:func:`install_refinement_regions`) and Phase 2 routes every
+connection with one :meth:`CppPathfinder.route_multires` search across the
+coarse and fine cells, so no escape segments are generated.
+
 Example::
 
     from kicad_tools.router.adaptive_grid import AdaptiveGridRouter
@@ -43,6 +49,7 @@ from dataclasses import dataclass, field
 from typing import TYPE_CHECKING
 
 if TYPE_CHECKING:
+    from .cpp_backend import CppGrid
     from .grid import RoutingGrid
     from .pathfinder import Router
     from .rules import DesignRules
@@ -251,6 +258,84 @@ def identify_fine_pitch_components(
     return fine_components
 
 
+def install_refinement_regions(
+    cpp_grid: CppGrid,
+    pads: dict[tuple[str, str], Pad] | list[Pad],
+    rules: DesignRules,
+    fine_pitch_threshold: float = 0.8,
+    margin_cells: int = 2,
+    max_factor: int = 8,
+) -> list[int]:
+    """Refine the native grid around fine-pitch components.
+
+    Single-search alternative to the two-phase escape: each component found
+    by :func:`identify_fine_pitch_components` gets a refinement region over
+    its pad bounding box plus ``margin_cells`` coarse cells, refined by the
+    coarse / fine resolution ratio (capped at ``max_factor``).  Overlapping
+    or touching regions are merged (regions are only connected through
+    coarse cells), keeping the largest factor.  Route through the regions
+    with :meth:`CppPathfinder.route_multires`.
+
+    Args:
+        cpp_grid: Native grid, with its pads already registered
+        pads: All board pads
+        rules: Design rules (trace width / clearance for the fine cells)
+        fine_pitch_threshold: Pin pitch at or below this is refined
+        margin_cells: Coarse cells added around each component's pads
+        max_factor: Upper bound on the refinement factor
+
+    Returns:
+        Indices of the regions added
+    """
+    fine = identify_fine_pitch_components(pads, cpp_grid.resolution, fine_pitch_threshold)
+    if not fine:
+        return []
+    pad_list = list(pads.values()) if isinstance(pads, dict) else list(pads)
+
+    rects: list[list[int]] = []  # [x0, y0, x1, y1, factor]
+    for ref, fine_res in fine.items():
+        comp = [p for p in pad_list if p.ref == ref]
+        gx0, gy0 = cpp_grid.world_to_grid(
+            min(p.x - p.width / 2 for p in comp), min(p.y - p.height / 2 for p in comp)
+        )
+        gx1, gy1 = cpp_grid.world_to_grid(
+            max(p.x + p.width / 2 for p in comp), max(p.y + p.height / 2 for p in comp)
+        )
+        factor = min(max_factor, max(2, round(cpp_grid.resolution / fine_res)))
+        rects.append(
+            [gx0 - margin_cells, gy0 - margin_cells, gx1 + margin_cells, gy1 + margin_cells, factor]
+        )
+
+    merged = True
+    while merged:
+        merged = False
+        for i in range(len(rects)):
+            for j in range(i + 1, len(rects)):
+                a, b = rects[i], rects[j]
+                if a[0] <= b[2] + 1 and b[0] <= a[2] + 1 and a[1] <= b[3] + 1 and b[1] <= a[3] + 1:
+                    rects[i] = [
+                        min(a[0], b[0]),
+                        min(a[1], b[1]),
+                        max(a[2], b[2]),
+                        max(a[3], b[3]),
+                        max(a[4], b[4]),
+                    ]
+                    del rects[j]
+                    merged = True
+                    break
+            if merged:
+                break
+
+    regions = [
+        cpp_grid.add_refinement(
+            x0, y0, x1, y1, factor, rules.trace_width / 2, rules.trace_clearance
+        )
+        for x0, y0, x1, y1, factor in rects
+    ]
+    logger.debug("Installed %d refinement regions for %d components", len(regions), len(fine))
+    return regions
+
+
 class AdaptiveGridRouter:
     """Two-phase adaptive grid router.
 
@@ -265,6 +350,10 @@ class AdaptiveGridRouter:
             Default 0.8mm catches SSOP (0.65mm), TSSOP (0.5mm), QFN (0.4mm).
         escape_search_radius: Grid cells to search for escape endpoints.
             Larger values find more escape options but take longer.
+        single_search: Refine the native grid around fine-pitch components
+            and route each connection with ``route_multires`` instead of the
+            two-phase escape.  Needs ``router`` to be a ``CppPathfinder``;
+            ignored otherwise.
     """
 
     def __init__(
@@ -274,52 +363,81 @@ class AdaptiveGridRouter:
         router: Router | None = None,
         fine_pitch_threshold: float = 0.8,
         escape_search_radius: int = 3,
+        single_search: bool = False,
     ):
         self.grid = grid
         self.rules = rules
         self.router = router
         self.fine_pitch_threshold = fine_pitch_threshold
         self.escape_search_radius = escape_search_radius
+        self.single_search = single_search
         self._subgrid = SubGridRouter(
             grid,
             rules,
             escape_search_radius=escape_search_radius,
         )
 
+    @property
+    def uses_single_search(self) -> bool:
+        """True when routing goes through the native refinement regions."""
+        if not self.single_search or self.router is None:
+            return False
+        from .cpp_backend import CppPathfinder
+
+        return isinstance(self.router, CppPathfinder)
+
     def route_adaptive(
         self,
         nets: dict[int, list[tuple[str, str]]],
         pads: dict[tuple[str, str], Pad],
         route_fn: Callable[[], list[Route]] | None = None,
+        mark_fn: Callable[[Route], None] | None = None,
     ) -> AdaptiveGridResult:
         """Execute two-phase adaptive grid routing.
 
         Phase 1: Escape routing for fine-pitch pads
         Phase 2: Channel routing on the coarse grid
 
+        In single-search mode (see :attr:`uses_single_search`) Phase 1
+        refines the native grid instead and Phase 2 routes every connection
+        with ``route_multires``; ``route_fn`` is not called.
+
         Args:
             nets: Map of net_id to list of (ref, pin) pad identifiers
             pads: Map of (ref, pin) to Pad objects
             route_fn: Callable that routes all nets and returns list[Route].
                 If None, uses self.router (must be set).
+            mark_fn: Commits a single-search route to the grids before the
+                next connection is searched.  Defaults to
+                ``self.grid.mark_route``.
 
         Returns:
             AdaptiveGridResult with escape and channel routes
         """
         result = AdaptiveGridResult(coarse_resolution=self.grid.resolution)
+        single = self.uses_single_search
 
         # Phase 1: Pad escape routing
         phase1_start = time.time()
-        result.escape_result, result.escape_routes, result.fine_resolutions = (
-            self._phase1_pad_escape(pads)
-        )
+        if single:
+            result.escape_result = SubGridResult()
+            result.fine_resolutions = self._phase1_refine(pads)
+        else:
+            result.escape_result, result.escape_routes, result.fine_resolutions = (
+                self._phase1_pad_escape(pads)
+            )
         result.phase1_time_ms = (time.time() - phase1_start) * 1000
 
         # Phase 2: Channel routing
         phase2_start = time.time()
-        result.main_routes, result.nets_attempted, result.nets_routed = (
-            self._phase2_channel_routing(nets, pads, route_fn)
-        )
+        if single:
+            result.main_routes, result.nets_attempted, result.nets_routed = (
+                self._route_multires(nets, pads, mark_fn or self.grid.mark_route)
+            )
+        else:
+            result.main_routes, result.nets_attempted, result.nets_routed = (
+                self._phase2_channel_routing(nets, pads, route_fn)
+            )
         result.phase2_time_ms = (time.time() - phase2_start) * 1000
 
         logger.info(
@@ -394,6 +512,69 @@ class AdaptiveGridRouter:
 
         return subgrid_result, escape_routes, fine_components
 
+    def _phase1_refine(self, pads: dict[tuple[str, str], Pad]) -> dict[str, float]:
+        """Single-search Phase 1: refine the native grid around fine-pitch parts.
+
+        Replaces any regions left by a previous pass, so repeated calls do
+        not stack overlapping regions.
+
+        Returns:
+            Map of fine-pitch component ref to fine resolution
+        """
+        cpp_grid = self.router._grid
+        cpp_grid.clear_refinements()
+        fine_components = identify_fine_pitch_components(
+            pads, self.grid.resolution, self.fine_pitch_threshold
+        )
+        if fine_components:
+            regions = install_refinement_regions(
+                cpp_grid, pads, self.rules, self.fine_pitch_threshold
+            )
+            logger.info(
+                "Phase 1: %d refinement regions over %d fine-pitch components",
+                len(regions),
+                len(fine_components),
+            )
+        return fine_components
+
+    def _route_multires(
+        self,
+        nets: dict[int, list[tuple[str, str]]],
+        pads: dict[tuple[str, str], Pad],
+        mark_fn: Callable[[Route], None],
+    ) -> tuple[list[Route], int, int]:
+        """Single-search Phase 2: route each pad pair across the regions.
+
+        Pads are chained in net order like :meth:`_route_with_router`; every
+        route is committed through ``mark_fn`` so later searches see it.
+
+        Returns:
+            Tuple of (routes, nets_attempted, nets_routed)
+        """
+        routes: list[Route] = []
+        nets_attempted = 0
+        nets_routed = 0
+        for pad_keys in nets.values():
+            net_pads = [pads[key] for key in pad_keys if key in pads]
+            if len(net_pads) < 2:
+                continue
+            nets_attempted += 1
+            complete = True
+            for src_pad, tgt_pad in zip(net_pads, net_pads[1:]):
+                route = self.router.route_multires(src_pad, tgt_pad)
+                if route is None:
+                    complete = False
+                    continue
+                mark_fn(route)
+                routes.append(route)
+            if complete:
+                nets_routed += 1
+
+        logger.info(
+            "Phase 2 complete: %d/%d nets routed in one search", nets_routed, nets_attempted
+        )
+        return routes, nets_attempted, nets_routed
+
     def _raise_if_component_fully_failed(
         self,
         subgrid_result: SubGridResult,
@@ -38,7 +38,7 @@ from .negotiated import (
     select_seg_seg_demotion_nets,
     should_terminate_early,
 )
-from .steiner import build_rsmt
+from .steiner import build_rsmt, build_rsmt_batch
 from .two_phase import TwoPhaseRouter
 
 __all__ = [
@@ -50,6 +50,7 @@ __all__ = [
     "RoutingChromosome",
     "TwoPhaseRouter",
     "build_rsmt",
+    "build_rsmt_batch",
     # Initial-pass grace pass (Issue #3452)
     "GRACE_PASS_BUDGET_S",
     "GRACE_PASS_PER_NET_S",
@@ -125,11 +125,7 @@ class MSTRouter:
 
         if len(pad_objs) > 2:
             if use_steiner:
-                from .steiner import (
-                    build_rsmt,
-                    make_blocked_cell_predicate,
-                    relocate_blocked_point,
-                )
+                from .steiner import build_rsmt_batch
 
                 # PR #3481 fix: snap synthetic Steiner branch points
                 # onto the routing grid (off-grid virtual pads have no
@@ -146,16 +142,10 @@ class MSTRouter:
                 # ``NegotiatedRouter.route_net_negotiated``; MSTRouter
                 # is the path the auto-layers two-phase flow actually
                 # executes, so it needs the relocation too.
-                grid = self.grid
-                blocked_fn = make_blocked_cell_predicate(grid, self.rules, pad_objs[0].net)
-
-                def snap_fn(x: float, y: float) -> tuple[float, float]:
-                    gx, gy = grid.world_to_grid(x, y)
-                    if blocked_fn is not None:
-                        gx, gy = relocate_blocked_point(gx, gy, blocked_fn)
-                    return grid.grid_to_world(gx, gy)
-
-                pad_objs, edges = build_rsmt(pad_objs, snap_fn=snap_fn)
+                # ``build_rsmt_batch`` does both, natively on a ``CppGrid``.
+                net_id = pad_objs[0].net
+                trees = build_rsmt_batch({net_id: pad_objs}, self.grid, self.rules)
+                pad_objs, edges = trees[net_id]
             else:
                 # Build and sort MST edges by length
                 edges = self.build_mst(pad_objs)
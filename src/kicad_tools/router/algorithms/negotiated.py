@@ -1109,6 +1109,7 @@ class NegotiatedRouter:
             # RSMT-based routing with negotiated mode
             from .steiner import (
                 build_rsmt,
+                build_rsmt_batch,
                 make_blocked_cell_predicate,
                 relocate_blocked_point,
             )
@@ -1159,9 +1160,15 @@ class NegotiatedRouter:
                     gx, gy = relocate_blocked_point(gx, gy, _point_blocked)
                 return self.grid.grid_to_world(gx, gy)
 
-            pad_objs, rsmt_edges = build_rsmt(
-                pad_objs, congestion_fn=congestion_fn, snap_fn=_snap_to_grid
-            )
+            if congestion_fn is None:
+                # Same snap / relocation, natively on a ``CppGrid``.
+                net_id = pad_objs[0].net
+                trees = build_rsmt_batch({net_id: pad_objs}, self.grid, self.rules)
+                pad_objs, rsmt_edges = trees[net_id]
+            else:
+                pad_objs, rsmt_edges = build_rsmt(
+                    pad_objs, congestion_fn=congestion_fn, snap_fn=_snap_to_grid
+                )
 
             # Issue #2306: Incremental Steiner target-set expansion.
             # After routing each RSMT edge, collect the grid cells along
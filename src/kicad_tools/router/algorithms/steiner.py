@@ -17,11 +17,26 @@ For 2-terminal nets, the result is identical to MST (single edge).
 For 3-terminal nets, the optimal Steiner topology is found directly.
 For larger nets, iterative 1-Steiner insertion provides a good
 approximation with bounded runtime.
+
+Every candidate above rebuilds a full MST, roughly O(n^4) per net, so wide
+power and bus nets took seconds to decompose.  When the C++ router backend is
+built, :func:`build_rsmt` (without a ``congestion_fn``) uses
+``router_cpp.build_rsmt`` instead: exact Hanan-subset enumeration up to five
+terminals and batched 1-Steiner with incremental MST scoring above.
+:func:`build_rsmt_batch` builds every net of a board in one threaded call
+and, on a :class:`~kicad_tools.router.cpp_backend.CppGrid`, relocates blocked
+Steiner points against the native grid.  The placement FOM's board-wide
+Steiner length (:func:`kicad_tools.optim.fom_features.steiner_lower_bounds`)
+uses its gridless form; ``MSTRouter.route_net`` and the uncongested
+``NegotiatedRouter.route_net_negotiated`` decompose through it on the live
+routing grid.  ``KCT_STEINER_CPP=0`` (or
+``use_native=False``) forces the pure-Python path.
 """
 
 from __future__ import annotations
 
 import math
+import os
 from typing import TYPE_CHECKING, Any, Callable
 
 if TYPE_CHECKING:
@@ -123,18 +138,7 @@ def make_blocked_cell_predicate(
     if not routable_indices or not hasattr(grid, "is_blocked_for_net"):
         return None
 
-    margin_cells = 1
-    try:
-        res = float(getattr(grid, "resolution", 0.0) or 0.0)
-        if res > 0 and rules is not None:
-            margin_cells = max(
-                1,
-                math.ceil((rules.trace_width / 2.0 + rules.trace_clearance) / res),
-            )
-    except Exception:
-        # Fixture/mock rules without these attributes: keep the 1-cell
-        # margin.
-        margin_cells = 1
+    margin_cells = _relocation_margin_cells(grid, rules)
 
     def _point_blocked(gx: int, gy: int) -> bool:
         try:
@@ -156,6 +160,32 @@ def make_blocked_cell_predicate(
     return _point_blocked
 
 
+def _relocation_margin_cells(grid: Any, rules: Any) -> int:
+    """Trace-radius + clearance margin in cells (at least 1) for relocation."""
+    try:
+        res = float(getattr(grid, "resolution", 0.0) or 0.0)
+        if res > 0 and rules is not None:
+            return max(1, math.ceil((rules.trace_width / 2.0 + rules.trace_clearance) / res))
+    except Exception:
+        # Fixture/mock rules without these attributes: keep the 1-cell
+        # margin.
+        pass
+    return 1
+
+
+def _native_steiner(use_native: bool | None):
+    """``router_cpp`` when the native RSMT builder should be used, else ``None``."""
+    if use_native is None:
+        use_native = os.environ.get("KCT_STEINER_CPP", "1") != "0"
+    if not use_native:
+        return None
+    from ..cpp_backend import is_cpp_available, router_cpp
+
+    if not is_cpp_available() or not hasattr(router_cpp, "SteinerBuilder"):
+        return None
+    return router_cpp
+
+
 def _manhattan(x1: float, y1: float, x2: float, y2: float) -> float:
     """Compute Manhattan distance between two points."""
     return abs(x1 - x2) + abs(y1 - y2)
@@ -346,10 +376,32 @@ def _solve_3_terminal(
         return list(terminals), mst_edges
 
 
+def _steiner_pad(ref_pad: Pad, x: float, y: float) -> Pad:
+    """Virtual Steiner-point pad carrying ``ref_pad``'s net info."""
+    from ..primitives import Pad
+
+    return Pad(
+        x=x,
+        y=y,
+        width=0.0,
+        height=0.0,
+        net=ref_pad.net,
+        net_name=ref_pad.net_name,
+        layer=ref_pad.layer,
+        ref="",
+        pin="",
+        through_hole=False,
+        drill=0.0,
+        steiner_point=True,
+    )
+
+
 def build_rsmt(
     pad_objs: list[Pad],
     congestion_fn: Callable[[float, float, float, float], float] | None = None,
     snap_fn: Callable[[float, float], tuple[float, float]] | None = None,
+    *,
+    use_native: bool | None = None,
 ) -> tuple[list[Pad], list[tuple[int, int]]]:
     """Build Rectilinear Steiner Minimum Tree.
 
@@ -378,14 +430,17 @@ def build_rsmt(
             with ``PADS_OFF_GRID: steiner@(...)`` — the softstart
             SRC_POS / BUS_LINE / SCAP_POS+ / VRECT signature.  Terminal
             pads are never snapped, only synthetic points.
+        use_native: Build the topology with ``router_cpp.build_rsmt``
+            (exact up to five terminals, batched 1-Steiner above).
+            ``None`` means "when the C++ backend is built and
+            ``KCT_STEINER_CPP`` is not ``0``".  A ``congestion_fn``
+            always takes the Python path.
 
     Returns:
         (extended_pads, edges) where extended_pads includes original
         pads plus any Steiner points (marked with steiner_point=True),
         and edges are index pairs into extended_pads sorted by cost.
     """
-    from ..primitives import Pad
-
     n = len(pad_objs)
     if n < 2:
         return list(pad_objs), []
@@ -396,15 +451,33 @@ def build_rsmt(
     # Extract coordinates
     terminals = [(p.x, p.y) for p in pad_objs]
 
-    # Choose algorithm based on terminal count
-    if n == 3:
-        all_points, edges = _solve_3_terminal(terminals, congestion_fn)
-    elif n <= 9:
-        all_points, edges = _iterative_one_steiner(terminals, congestion_fn, max_iterations=50)
+    native = _native_steiner(use_native) if congestion_fn is None else None
+    if native is not None:
+        # Edges come back sorted by Manhattan length already.
+        tree = native.build_rsmt(terminals)
+        all_points = [tuple(pt) for pt in tree.points]
+        edges = [tuple(e) for e in tree.edges]
     else:
-        # Larger nets: limit iterations to keep runtime bounded
-        all_points, edges = _iterative_one_steiner(
-            terminals, congestion_fn, max_iterations=min(n, 30)
+        # Choose algorithm based on terminal count
+        if n == 3:
+            all_points, edges = _solve_3_terminal(terminals, congestion_fn)
+        elif n <= 9:
+            all_points, edges = _iterative_one_steiner(terminals, congestion_fn, max_iterations=50)
+        else:
+            # Larger nets: limit iterations to keep runtime bounded
+            all_points, edges = _iterative_one_steiner(
+                terminals, congestion_fn, max_iterations=min(n, 30)
+            )
+
+        # Sort edges by cost (shortest first) for routing order
+        dist_fn = congestion_fn or _manhattan
+        edges.sort(
+            key=lambda e: dist_fn(
+                all_points[e[0]][0],
+                all_points[e[0]][1],
+                all_points[e[1]][0],
+                all_points[e[1]][1],
+            )
         )
 
     # Build extended pad list with Steiner point virtual pads
@@ -419,32 +492,78 @@ def build_rsmt(
             sx, sy = snap_fn(sx, sy)
         # Create virtual Steiner point pad using the net info from the
         # first terminal pad. Use minimal size for a virtual pad.
-        ref_pad = pad_objs[0]
-        steiner_pad = Pad(
-            x=sx,
-            y=sy,
-            width=0.0,
-            height=0.0,
-            net=ref_pad.net,
-            net_name=ref_pad.net_name,
-            layer=ref_pad.layer,
-            ref="",
-            pin="",
-            through_hole=False,
-            drill=0.0,
-            steiner_point=True,
-        )
-        extended_pads.append(steiner_pad)
-
-    # Sort edges by cost (shortest first) for routing order
-    dist_fn = congestion_fn or _manhattan
-    edges.sort(
-        key=lambda e: dist_fn(
-            all_points[e[0]][0],
-            all_points[e[0]][1],
-            all_points[e[1]][0],
-            all_points[e[1]][1],
-        )
-    )
+        extended_pads.append(_steiner_pad(pad_objs[0], sx, sy))
 
     return extended_pads, edges
+
+
+def build_rsmt_batch(
+    nets: dict[int, list[Pad]],
+    grid: Any = None,
+    rules: Any = None,
+    *,
+    num_threads: int = 0,
+    use_native: bool | None = None,
+) -> dict[int, tuple[list[Pad], list[tuple[int, int]]]]:
+    """Build the RSMT of every net of a board in one call.
+
+    Equivalent to calling :func:`build_rsmt` per net with the snap /
+    relocation ``snap_fn`` of ``MSTRouter.route_net`` (grid snap, then
+    :func:`relocate_blocked_point` with :func:`make_blocked_cell_predicate`).
+    When the native builder is available, every net is built in one C++
+    call across a thread pool: ``router_cpp.build_rsmt_all`` without a grid,
+    ``router_cpp.SteinerBuilder`` on a
+    :class:`~kicad_tools.router.cpp_backend.CppGrid`, with the blocked-cell
+    checks read straight off the C++ grid.  Other grids build net by net.
+
+    Args:
+        nets: Net ID -> terminal pads.
+        grid: Routing grid used to snap and relocate Steiner points, or
+            ``None`` to leave them at their Hanan-grid coordinates.
+        rules: ``DesignRules`` giving the relocation margin (may be ``None``).
+        num_threads: C++ workers (0 = hardware concurrency).
+        use_native: See :func:`build_rsmt`.
+
+    Returns:
+        Net ID -> ``(extended_pads, edges)`` as returned by :func:`build_rsmt`.
+    """
+    native = _native_steiner(use_native)
+    impl = getattr(grid, "_impl", None)
+    if native is not None and (grid is None or isinstance(impl, native.Grid3D)):
+        requests = []
+        for net_id, pads in nets.items():
+            req = native.SteinerNetRequest()
+            req.net = int(net_id)
+            req.terminals = [(p.x, p.y) for p in pads]
+            requests.append(req)
+        if grid is None:
+            trees = native.build_rsmt_all(requests, int(num_threads))
+        else:
+            builder = native.SteinerBuilder(
+                impl,
+                _relocation_margin_cells(grid, rules),
+                [int(v) for v in grid.get_routable_indices()],
+            )
+            trees = builder.build_all(requests, int(num_threads))
+        out: dict[int, tuple[list[Pad], list[tuple[int, int]]]] = {}
+        for (net_id, pads), tree in zip(nets.items(), trees, strict=True):
+            extended = list(pads)
+            for sx, sy in tree.points[tree.num_terminals :]:
+                extended.append(_steiner_pad(pads[0], sx, sy))
+            out[net_id] = (extended, [tuple(e) for e in tree.edges])
+        return out
+
+    out = {}
+    for net_id, pads in nets.items():
+        snap_fn = None
+        if grid is not None and pads:
+            blocked_fn = make_blocked_cell_predicate(grid, rules, net_id)
+
+            def snap_fn(x: float, y: float, blocked_fn=blocked_fn) -> tuple[float, float]:
+                gx, gy = grid.world_to_grid(x, y)
+                if blocked_fn is not None:
+                    gx, gy = relocate_blocked_point(gx, gy, blocked_fn)
+                return grid.grid_to_world(gx, gy)
+
+        out[net_id] = build_rsmt(pads, snap_fn=snap_fn, use_native=use_native)
+    return out
@@ -6,6 +6,11 @@ Phase 2 uses grid-based routing with corridor guidance.
 
 Issue #2276: Replaced SparseRouter global phase with tile-based
 GlobalRouter supporting per-layer capacity and negotiated congestion.
+
+With the C++ pathfinder as the detailed router, Phase 1 runs on the native
+``CppGlobalRouter`` instead and each net's planned tile corridor restricts
+its initial-pass search (``CppPathfinder.set_search_corridor``); the Python
+RegionGraph/GlobalRouter remains the fallback.
 """
 
 from __future__ import annotations
@@ -129,6 +134,17 @@ class TwoPhaseRouter:
         # TwoPhaseRouter directly) preserves legacy behaviour.
         self._relief_rescue = relief_rescue
 
+        # Native global routing: when the detailed router is the C++
+        # pathfinder, Phase 1 plans on ``CppGlobalRouter`` and each net's
+        # tile corridor restricts its initial-pass searches through
+        # ``set_search_corridor``.  ``KCT_GLOBAL_CPP=0`` (or a Python
+        # detailed router) keeps the RegionGraph/GlobalRouter guidance.
+        # Only the tile lists are kept; the per-cell mask is expanded for
+        # the one net being routed.
+        self.use_native_global: bool = os.environ.get("KCT_GLOBAL_CPP", "1") != "0"
+        self._search_corridors: dict[int, list[int]] = {}
+        self._search_corridor_router = None
+
         # Issue #2597: Communicates the reason the negotiated outer loop in
         # ``_detailed_negotiated()`` exited.  Read by the progress-callback
         # status string in :class:`Autorouter` to distinguish ``"stagnated"``
@@ -163,6 +179,79 @@ class TwoPhaseRouter:
                 tracked_ids.add(id(r))
         return [r for r in self.routes if id(r) not in tracked_ids]
 
+    def _native_global_router(self):
+        """``CppGlobalRouter`` over the detailed router's C++ grid, or None.
+
+        None when disabled (``KCT_GLOBAL_CPP=0``), when the C++ backend is
+        not built, or when the detailed router is the Python ``Router``
+        (which reads the Python corridor preferences instead).
+        """
+        if not self.use_native_global or not hasattr(self.router, "set_search_corridor"):
+            return None
+        from ..cpp_backend import CppGlobalRouter, is_cpp_available
+
+        if not is_cpp_available():
+            return None
+        return CppGlobalRouter(self.router._grid, self.rules)
+
+    def _plan_search_corridors(
+        self,
+        global_router,
+        net_order: list[int],
+        total_nets: int,
+        elapsed_str: Callable[[], str],
+    ) -> None:
+        """Plan every net on ``global_router`` and keep its corridor tiles."""
+        pins: dict[int, list[tuple[float, float]]] = {}
+        for net in net_order:
+            pads = [self.pads[key] for key in self.nets.get(net, []) if key in self.pads]
+            pins[net] = [(pad.x, pad.y) for pad in pads]
+        result = global_router.route_all(pins, net_order)
+        self._search_corridors = dict(result["tiles"])
+        self._search_corridor_router = global_router
+
+        flush_print(
+            f"  Global routing (native): {len(self._search_corridors)}/{total_nets} nets "
+            f"have corridors ({result['iterations']} iterations, "
+            f"overflow={result['final_overflow']}, {elapsed_str()})"
+        )
+        if result["failed_nets"]:
+            flush_print(
+                f"  {len(result['failed_nets'])} nets failed global routing (will attempt anyway)"
+            )
+
+    def _route_in_search_corridor(
+        self,
+        net: int,
+        route: Callable[[float | None], list[Route]],
+        per_net_timeout: float | None = None,
+    ) -> list[Route]:
+        """Run ``route`` with the search restricted to ``net``'s native corridor.
+
+        ``route`` takes the per-net timeout to search with.  The plan is
+        guidance, not a wall: when nothing lands inside the corridor the net
+        is routed again unrestricted on what is left of ``per_net_timeout``,
+        or not at all once the corridor attempt has used it up.  Nets without
+        a planned corridor route unrestricted straight away.  The
+        ``cols*rows`` mask is expanded from the net's tiles for this call
+        only.
+        """
+        if net not in self._search_corridors or self._search_corridor_router is None:
+            return route(per_net_timeout)
+        bits = self._search_corridor_router.corridor_bitset(net)
+        started = time.monotonic()
+        self.router.set_search_corridor(bits)
+        try:
+            routes = route(per_net_timeout)
+        finally:
+            self.router.set_search_corridor(None)
+        if routes:
+            return routes
+        if per_net_timeout is None:
+            return route(None)
+        remaining = per_net_timeout - (time.monotonic() - started)
+        return route(remaining) if remaining > 0 else []
+
     def route_all(
         self,
         use_negotiated: bool = True,
@@ -334,70 +423,74 @@ class TwoPhaseRouter:
             if not progress_callback(0.0, "Phase 1: Global routing", True):
                 return list(self.routes)
 
-        # Compute routing pitch from design rules
-        trace_pitch = self.rules.trace_width + self.rules.trace_clearance
-        corridor_width = corridor_width_factor * self.rules.trace_clearance
-
-        # Determine tile grid size: ~10x trace pitch per tile, minimum 3x3
-        tile_size = max(trace_pitch * 10.0, 1.0)
-        num_cols = max(3, int(self.grid.width / tile_size))
-        num_rows = max(3, int(self.grid.height / tile_size))
-
-        # Build tile-based region graph with geometry-based capacity
-        region_graph = RegionGraph(
-            board_width=self.grid.width,
-            board_height=self.grid.height,
-            origin_x=self.grid.origin_x,
-            origin_y=self.grid.origin_y,
-            num_cols=num_cols,
-            num_rows=num_rows,
-            trace_pitch=trace_pitch,
-            num_layers=self.grid.num_layers,
-        )
+        corridors: dict[int, Corridor] = {}
+        native_global = self._native_global_router()
+        if native_global is not None:
+            self._plan_search_corridors(native_global, net_order, total_nets, elapsed_str)
+        else:
+            # Compute routing pitch from design rules
+            trace_pitch = self.rules.trace_width + self.rules.trace_clearance
+            corridor_width = corridor_width_factor * self.rules.trace_clearance
+
+            # Determine tile grid size: ~10x trace pitch per tile, minimum 3x3
+            tile_size = max(trace_pitch * 10.0, 1.0)
+            num_cols = max(3, int(self.grid.width / tile_size))
+            num_rows = max(3, int(self.grid.height / tile_size))
+
+            # Build tile-based region graph with geometry-based capacity
+            region_graph = RegionGraph(
+                board_width=self.grid.width,
+                board_height=self.grid.height,
+                origin_x=self.grid.origin_x,
+                origin_y=self.grid.origin_y,
+                num_cols=num_cols,
+                num_rows=num_rows,
+                trace_pitch=trace_pitch,
+                num_layers=self.grid.num_layers,
+            )
 
-        # Register pads as obstacles for blockage-aware capacity
-        pad_list = list(self.pads.values())
-        region_graph.register_obstacles(pad_list)
+            # Register pads as obstacles for blockage-aware capacity
+            pad_list = list(self.pads.values())
+            region_graph.register_obstacles(pad_list)
 
-        stats = region_graph.get_statistics()
-        flush_print(
-            f"  Tile grid: {num_cols}x{num_rows} "
-            f"({stats['num_regions']} regions, {stats['num_edges']} edges, "
-            f"pitch={trace_pitch:.3f}mm, layers={self.grid.num_layers})"
-        )
+            stats = region_graph.get_statistics()
+            flush_print(
+                f"  Tile grid: {num_cols}x{num_rows} "
+                f"({stats['num_regions']} regions, {stats['num_edges']} edges, "
+                f"pitch={trace_pitch:.3f}mm, layers={self.grid.num_layers})"
+            )
 
-        # Run global routing with negotiated iteration
-        global_router = GlobalRouter(
-            region_graph=region_graph,
-            corridor_width=corridor_width,
-            default_layer=0,
-            negotiated=True,
-            max_iterations=15,
-            history_increment=1.0,
-        )
+            # Run global routing with negotiated iteration
+            global_router = GlobalRouter(
+                region_graph=region_graph,
+                corridor_width=corridor_width,
+                default_layer=0,
+                negotiated=True,
+                max_iterations=15,
+                history_increment=1.0,
+            )
 
-        global_result = global_router.route_all(
-            nets=self.nets,
-            pad_dict=self.pads,
-            net_order=net_order,
-        )
+            global_result = global_router.route_all(
+                nets=self.nets,
+                pad_dict=self.pads,
+                net_order=net_order,
+            )
 
-        # Extract corridors from global routing result
-        corridors: dict[int, Corridor] = {}
-        for net_id, assign in global_result.assignments.items():
-            corridors[net_id] = assign.corridor
+            # Extract corridors from global routing result
+            for net_id, assign in global_result.assignments.items():
+                corridors[net_id] = assign.corridor
 
-        flush_print(
-            f"  Global routing: {len(corridors)}/{total_nets} nets have corridors "
-            f"({global_result.iterations} iterations, "
-            f"overflow={global_result.final_overflow}, "
-            f"{elapsed_str()})"
-        )
-        if global_result.failed_nets:
             flush_print(
-                f"  {len(global_result.failed_nets)} nets failed global routing "
-                f"(will attempt anyway)"
+                f"  Global routing: {len(corridors)}/{total_nets} nets have corridors "
+                f"({global_result.iterations} iterations, "
+                f"overflow={global_result.final_overflow}, "
+                f"{elapsed_str()})"
             )
+            if global_result.failed_nets:
+                flush_print(
+                    f"  {len(global_result.failed_nets)} nets failed global routing "
+                    f"(will attempt anyway)"
+                )
 
         # =====================================================================
         # Phase 2: Detailed Routing with Corridor Guidance
@@ -435,6 +528,8 @@ class TwoPhaseRouter:
 
         # Clear corridor preferences (not needed after routing)
         self.grid.clear_all_corridor_preferences()
+        self._search_corridors = {}
+        self._search_corridor_router = None
 
         # Summary — use connectivity-aware counting so we only report
         # nets where all pads are in the same connected component (#2352).
@@ -455,7 +550,10 @@ class TwoPhaseRouter:
         total_elapsed = time.time() - start_time
         print("\n=== Two-Phase Routing Complete ===")
         print(f"  Total nets: {total_nets}")
-        print(f"  Global routing: {len(corridors)} corridors assigned")
+        print(
+            f"  Global routing: {len(corridors) or len(self._search_corridors)} "
+            "corridors assigned"
+        )
         print(f"  Detailed routing: {connected_nets} nets routed")
         if connected_nets < nets_with_segments:
             print(
@@ -580,8 +678,12 @@ class TwoPhaseRouter:
             pct = (i / total_nets * 100) if total_nets > 0 else 0
             flush_print(f"  [{pct:5.1f}%] Routing {net_name}... ({elapsed_str()})")
 
-            routes = self._route_net_with_corridor(
-                net, present_factor, per_net_timeout=per_net_timeout
+            routes = self._route_in_search_corridor(
+                net,
+                lambda timeout, net=net: self._route_net_with_corridor(
+                    net, present_factor, per_net_timeout=timeout
+                ),
+                per_net_timeout,
             )
             if routes:
                 net_routes[net] = routes
@@ -625,7 +727,13 @@ class TwoPhaseRouter:
             grace_start = time.monotonic()
 
             def _grace_route(net: int, cap: float) -> list[Route]:
-                return self._route_net_with_corridor(net, present_factor, per_net_timeout=cap)
+                return self._route_in_search_corridor(
+                    net,
+                    lambda timeout: self._route_net_with_corridor(
+                        net, present_factor, per_net_timeout=timeout
+                    ),
+                    cap,
+                )
 
             def _grace_commit(net: int, routes: list[Route]) -> None:
                 net_routes[net] = routes
@@ -1329,7 +1437,9 @@ class TwoPhaseRouter:
                 if not progress_callback(progress, f"Routing {net_name}", True):
                     break
 
-            routes = self._route_net(net)
+            routes = self._route_in_search_corridor(
+                net, lambda _timeout, net=net: self._route_net(net)
+            )
             all_routes.extend(routes)
 
         return all_routes
@@ -14,6 +14,7 @@ Estimation for Efficient Routability-Driven Placement", DATE 2007.
 from __future__ import annotations
 
 import math
+import os
 from dataclasses import dataclass, field
 from typing import TYPE_CHECKING
 
@@ -136,6 +137,17 @@ class NetBBox:
         return self.width + self.height
 
 
+def _native_rudy(grid: TileGrid):
+    """Build an empty ``router_cpp.RudyMap`` over ``grid``, or ``None`` when unavailable."""
+    from .cpp_backend import is_cpp_available, router_cpp
+
+    if not is_cpp_available() or not hasattr(router_cpp, "RudyMap"):
+        return None
+    return router_cpp.RudyMap(
+        grid.origin_x, grid.origin_y, grid.tile_w, grid.tile_h, grid.cols, grid.rows
+    )
+
+
 @dataclass
 class CongestionEstimator:
     """RUDY-based pre-route congestion estimator.
@@ -149,11 +161,15 @@ class CongestionEstimator:
         grid: The tile grid used for demand estimation.
         demand: 2-D demand array indexed ``[row][col]``.
         net_scores: Mapping of net ID to congestion score.
+        native: The ``router_cpp.RudyMap`` that computed the estimate, or
+            ``None`` on the pure-Python path.  It keeps the nets, so callers
+            can update it incrementally (``set_net`` / ``remove_net``).
     """
 
     grid: TileGrid
     demand: list[list[float]] = field(default_factory=list)
     net_scores: dict[int, float] = field(default_factory=dict)
+    native: object | None = field(default=None, repr=False, compare=False)
 
     @classmethod
     def from_nets(
@@ -166,6 +182,7 @@ class CongestionEstimator:
         board_height: float,
         target_tiles: int = 100,
         pour_net_ids: set[int] | None = None,
+        use_native: bool | None = None,
     ) -> CongestionEstimator:
         """Build a RUDY congestion estimate from net pad positions.
 
@@ -178,6 +195,9 @@ class CongestionEstimator:
             board_height: Board height (mm).
             target_tiles: Target tile count for the grid (default 100).
             pour_net_ids: Set of net IDs that are pour nets (excluded from RUDY).
+            use_native: Accumulate demand in ``router_cpp.RudyMap`` (2-D
+                difference array, O(nets + tiles)).  ``None`` means "when the
+                C++ backend is built and ``KCT_RUDY_CPP`` is not ``0``".
 
         Returns:
             A populated ``CongestionEstimator``.
@@ -224,6 +244,24 @@ class CongestionEstimator:
                 )
             )
 
+        if use_native is None:
+            use_native = os.environ.get("KCT_RUDY_CPP", "1") != "0"
+        rudy = _native_rudy(tile_grid) if use_native else None
+        if rudy is not None:
+            for bbox in net_bboxes:
+                rudy.set_net(
+                    bbox.net_id, [(bbox.min_x, bbox.min_y, -1), (bbox.max_x, bbox.max_y, -1)]
+                )
+            flat = rudy.demand()
+            cols = tile_grid.cols
+            estimator.demand = [
+                list(flat[r * cols : (r + 1) * cols]) for r in range(tile_grid.rows)
+            ]
+            for bbox in net_bboxes:
+                estimator.net_scores[bbox.net_id] = rudy.net_score(bbox.net_id)
+            estimator.native = rudy
+            return estimator
+
         # Phase 2: distribute HPWL across tiles
         for bbox in net_bboxes:
             col_lo, row_lo, col_hi, row_hi = tile_grid.tile_range(
@@ -119,6 +119,58 @@ def _seg_layer_key(seg: Any) -> object:
     return layer
 
 
+def _pad_connectivity_cpp(
+    pad_positions: list[tuple[float, float]],
+    seg_records: list[_Seg],
+    via_points: list[tuple[float, float]],
+) -> tuple[int, int] | None:
+    """Run the reachability walk on the native copper connectivity engine.
+
+    Pads and vias become zero-size discs on every layer and segments
+    zero-width tracks on their own layer, all on one net, so the engine's
+    ``tolerance`` join is the same coincidence test as the Python walk.
+    Returns ``None`` when the C++ backend is not built.
+    """
+    from kicad_tools.drc.cpp_backend import (
+        PAD_SHAPE_CIRCLE,
+        drc_cpp,
+        is_connectivity_available,
+    )
+
+    if not is_connectivity_available():
+        return None
+    layer_index: dict[object, int] = {}
+    for s in seg_records:
+        layer_index.setdefault(s.layer, len(layer_index))
+    if len(layer_index) > 64:
+        return None
+    num_layers = max(1, len(layer_index))
+    all_layers = (1 << num_layers) - 1
+
+    board = drc_cpp.CopperBoard()
+    board.num_layers = num_layers
+    board.seg_x1 = [s.x1 for s in seg_records]
+    board.seg_y1 = [s.y1 for s in seg_records]
+    board.seg_x2 = [s.x2 for s in seg_records]
+    board.seg_y2 = [s.y2 for s in seg_records]
+    board.seg_width = [0.0] * len(seg_records)
+    board.seg_layer = [layer_index[s.layer] for s in seg_records]
+    board.seg_net = [1] * len(seg_records)
+    board.via_x = [x for x, _ in via_points]
+    board.via_y = [y for _, y in via_points]
+    board.via_size = board.via_drill = [0.0] * len(via_points)
+    board.via_layers = board.via_explicit_layers = [all_layers] * len(via_points)
+    board.via_net = [1] * len(via_points)
+    board.pads = [drc_cpp.PadShape(PAD_SHAPE_CIRCLE, x, y, 0.0, 0.0) for x, y in pad_positions]
+    board.pad_layers = [all_layers] * len(pad_positions)
+    board.pad_drill = [0.0] * len(pad_positions)
+    board.pad_net = [1] * len(pad_positions)
+
+    rules = drc_cpp.ConnectivityRules()
+    rules.tolerance = EPS
+    return tuple(drc_cpp.CopperConnectivity(board, rules).pads_connected(1))
+
+
 def check_net_pad_connectivity(
     pad_positions: list[tuple[float, float]],
     segments: list[Any],
@@ -147,6 +199,9 @@ def check_net_pad_connectivity(
         of the largest single copper component that contains pads, and
         ``pads_total`` is ``len(pad_positions)``.  If the net has <2 pads the
         result is ``(pads_total, pads_total)`` (trivially connected).
+
+    With the C++ backend the walk runs on ``drc_cpp.CopperConnectivity``'s
+    spatial index instead of the all-pairs loops below.
     """
     n = len(pad_positions)
     if n < 2:
@@ -181,6 +236,10 @@ def check_net_pad_connectivity(
             except (AttributeError, TypeError, ValueError):
                 continue
 
+    native = _pad_connectivity_cpp(pad_positions, seg_records, via_points)
+    if native is not None:
+        return native
+
     # Node id layout:  0..n-1 = pads, then one node per segment, then one node
     # per via.  Vias join copper regardless of layer (they are through-features
     # in this coarse model), so they union any segment/pad touching their site.
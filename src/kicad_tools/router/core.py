@@ -2100,8 +2100,9 @@ class Autorouter:
         return routes, connected_indices
 
     def clear_zones(self) -> None:
-        """Remove all zone markings from the grid."""
+        """Remove all zone markings from the grid (and the mesh pours)."""
         self.zone_manager.clear_all_zones()
+        self._sync_mesh_pours()
 
     def get_zone_statistics(self) -> dict:
         """Get statistics about filled zones."""
@@ -2392,10 +2393,44 @@ class Autorouter:
                 outline,
                 list(self.pads.values()),
                 self.rules,
+                pours=self._mesh_pour_polygons(),
                 layer_stack=self.layer_stack,
             )
         return self._mesh_pathfinder
 
+    def _mesh_pour_polygons(self) -> list[list[tuple[float, float]]]:
+        """Outlines of the filled zones the mesh must route around.
+
+        Same filter as the fixed copper of ``_negotiate_mesh_netset``: only
+        zones of nets outside the routable set.  Mesh pours are net-agnostic
+        holes, so a routed net's own zone would wall it off.
+        """
+        return [
+            list(filled.zone.polygon)
+            for filled in self.zone_manager.filled_zones
+            if filled.filled_cells
+            and len(filled.zone.polygon) >= 3
+            and filled.zone.net_number not in self.nets
+        ]
+
+    def _sync_mesh_pours(self) -> None:
+        """Bring a built mesh pathfinder's pours in line with the filled zones.
+
+        Zone edits after the navmesh exists go through
+        ``MeshPathfinder.add_pour`` / ``remove_pour``, which cut or fill only
+        the triangles around the pour and keep portal history elsewhere.
+        """
+        pf = self._mesh_pathfinder
+        if pf is None:
+            return
+        wanted = self._mesh_pour_polygons()
+        for index in reversed(range(len(pf.pours))):
+            if pf.pours[index] not in wanted:
+                pf.remove_pour(index)
+        for poly in wanted:
+            if poly not in pf.pours:
+                pf.add_pour(poly)
+
     def _negotiate_mesh_netset(self) -> dict[int, list[Route]]:
         """Negotiate every routable net through the shared navmesh (issue #4269).
 
@@ -2405,6 +2440,7 @@ class Autorouter:
         for the whole board inside :meth:`MeshPathfinder.route_netset`.
         """
         pf = self._ensure_mesh_pathfinder()
+        self._sync_mesh_pours()
 
         connections: list[tuple[object, Pad, Pad, object]] = []
         for net, pad_keys in self.nets.items():
@@ -15025,6 +15061,9 @@ class Autorouter:
                     board_thickness_mm=board_thickness_mm,
                     num_copper_layers=num_layers,
                     blind_buried_supported=blind_buried_supported,
+                    # Single-ended groups tune natively when the C++ grid
+                    # mirrors the board (``KCT_MEANDER_CPP=0`` opts out).
+                    cpp_grid=self._cpp_grid,
                 )
             except ValueError as exc:
                 # Defensive: a malformed group (e.g. mixed pair/scalar
@@ -15093,6 +15132,7 @@ class Autorouter:
                     "exceeded_max_inserts",
                     "cascade_budget_exhausted",
                     "no_suitable_segment",
+                    "partial_tune",
                 )
                 for member_net_id in sorted(group_results):
                     res = group_results[member_net_id][1]
@@ -15287,6 +15327,7 @@ class Autorouter:
         non_diffpair_strategy: object = None,
         coupled_only: bool = False,
         timeout: float | None = None,
+        verbose: bool = True,
     ) -> tuple[list[Route], list[LengthMismatchWarning]]:
         """Route all nets with differential pair-aware routing.
 
@@ -15314,6 +15355,7 @@ class Autorouter:
                 budget-exit path (see ``route_all_with_diffpairs`` in
                 ``diffpair_routing.py``).  When ``None`` (default) the
                 legacy unbounded behaviour is preserved for back-compat.
+            verbose: Print the coupled-batch progress lines.
         """
         # Issue #3419: enable the paired-escape pre-pass for this run.
         # ``route_all_with_diffpairs`` routes pairs through the
@@ -15403,6 +15445,7 @@ class Autorouter:
             coupled_only=coupled_only,
             per_pair_timeout=derived_per_pair_timeout,
             aggregate_timeout=derived_aggregate_timeout,
+            verbose=verbose,
         )
 
         # Issue #3040 Phase B: rip-up and retry any pairs whose coupled
@@ -15447,6 +15490,7 @@ class Autorouter:
     def route_diffpair_prepass(
         self,
         diffpair_config: DifferentialPairConfig | None = None,
+        verbose: bool = True,
     ) -> tuple[list[Route], list[LengthMismatchWarning], set[int]]:
         """Route only differential pairs as a pre-pass (Issue #2464).
 
@@ -15457,12 +15501,13 @@ class Autorouter:
         Args:
             diffpair_config: Configuration for diff-pair routing.  No-op
                 when None or ``enabled`` is False.
+            verbose: Print the coupled-batch progress lines.
 
         Returns:
             ``(routes, warnings, routed_net_ids)`` — see
             :meth:`DiffPairRouter.route_diffpair_prepass` for details.
         """
-        return self._diffpair.route_diffpair_prepass(diffpair_config)
+        return self._diffpair.route_diffpair_prepass(diffpair_config, verbose=verbose)
 
     # =========================================================================
     # Failure Analysis API
@@ -17391,6 +17436,7 @@ class Autorouter:
         fine_pitch_threshold: float = 0.8,
         progress_callback: ProgressCallback | None = None,
         timeout: float | None = None,
+        single_search: bool = False,
     ) -> list[Route]:
         """Route with adaptive grid: fine grid near pads, coarse grid in channels.
 
@@ -17402,11 +17448,18 @@ class Autorouter:
 
         This achieves 100% pad reachability at coarse-grid routing speed.
 
+        With ``single_search`` and the C++ pathfinder, the fine-pitch
+        components get refinement regions on the native grid instead and
+        every connection is routed by one multi-resolution A*
+        (:meth:`CppPathfinder.route_multires`); ``use_negotiated``,
+        ``progress_callback`` and ``timeout`` then do not apply.
+
         Args:
             use_negotiated: Use negotiated congestion routing for Phase 2
             fine_pitch_threshold: Pin pitch below this triggers fine-grid escape
             progress_callback: Optional progress callback
             timeout: Optional timeout in seconds
+            single_search: Route through native refinement regions
 
         Returns:
             List of all routes (escape segments + channel routes)
@@ -17425,6 +17478,7 @@ class Autorouter:
             rules=self.rules,
             router=self.router,
             fine_pitch_threshold=fine_pitch_threshold,
+            single_search=single_search,
         )
 
         def _route_phase2() -> list[Route]:
@@ -17444,11 +17498,15 @@ class Autorouter:
             nets=self.nets,
             pads=self.pads,
             route_fn=_route_phase2,
+            mark_fn=self._mark_route,
         )
 
         # Add escape routes to our route list
         for route in result.escape_routes:
             self.routes.append(route)
+        if adaptive.uses_single_search:
+            # route_fn was not called; the searches were only marked.
+            self.routes.extend(result.main_routes)
 
         # Summary
         flush_print(f"\n{result.format_summary()}")
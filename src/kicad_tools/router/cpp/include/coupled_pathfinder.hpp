@@ -13,8 +13,9 @@
  * path-history / trail-proximity guard, the #3439 corridor bitset, the
  * ``partner_aware`` heuristic (#3115), weighted A* (#3508) and the #3508
  * LIFO-seq tie-break.  The ``allow_swap_via`` polarity-swap move (#2473)
- * and the ``manhattan_sum`` legacy heuristic are intentionally DEFERRED to
- * the pure-Python fallback; the Python wrapper routes those cases to Python.
+ * and the ``manhattan_sum`` legacy heuristic, deferred to the pure-Python
+ * fallback in v1, are now native as well (``set_allow_swap_via`` /
+ * ``set_heuristic_mode``), so every coupled-pair configuration runs here.
  * Issue #4459 wired the ``last_rejections`` string-keyed histogram out of
  * the C++ search (surfaced on ``CoupledRouteResult::rejections``) so a
  * C++-path budget-exit reports which guard pruned the frontier.
@@ -22,6 +23,8 @@
  * The search consumes the SAME ``Grid3D`` the single-ended ``Pathfinder``
  * uses (marshalled once via ``CppGrid.from_routing_grid``); it is a new
  * consumer of existing grid data, not a new grid representation.
+ * ``route_batch`` runs several pairs' searches concurrently against that
+ * grid (read-only) and commits them in priority order.
  */
 
 #pragma once
@@ -30,7 +33,9 @@
 #include "grid.hpp"
 #include <vector>
 #include <cstdint>
+#include <limits>
 #include <optional>
+#include <utility>
 
 namespace router {
 
@@ -88,6 +93,104 @@ struct CoupledNodeGreater {
     }
 };
 
+// Open-addressing closed-set / g-score table for the coupled joint state.
+//
+// The joint search used to key a ``std::unordered_set`` (closed) and a
+// ``std::unordered_map`` (g-scores) by a 128-bit six-coordinate key, paying
+// two node allocations and two bucket walks per expanded candidate.  Both
+// heads always sit on grid cells, so the joint state packs exactly into one
+// 64-bit key (``p_cell * total_cells + n_cell``) and a single linear-probe
+// table answers both questions with one probe sequence.
+//
+// Slots carry a generation stamp: ``reset()`` bumps the generation, which
+// empties the table in O(1) while keeping its capacity, so a
+// ``CoupledPathfinder`` reused across ``route()`` calls allocates only when
+// a search outgrows the previous high-water mark.  The table is never
+// iterated, so lookup order cannot perturb the A* pop sequence.
+class JointStateTable {
+public:
+    struct Slot {
+        uint64_t key;
+        float g_score;
+        uint32_t gen;
+        bool closed;
+    };
+
+    // Empty the table (O(1) generation bump; full clear on wraparound).
+    void reset() {
+        if (slots_.empty()) rehash(kInitialCapacity);
+        if (gen_ == UINT32_MAX) {
+            for (Slot& s : slots_) s.gen = 0;
+            gen_ = 0;
+        }
+        ++gen_;
+        size_ = 0;
+    }
+
+    // Return the slot for ``key``, inserting an open (not closed,
+    // g = +infinity) entry when absent.  The pointer is valid until the
+    // next ``find_or_insert``.
+    Slot* find_or_insert(uint64_t key) {
+        if ((size_ + 1) * 2 > slots_.size()) rehash(slots_.size() * 2);
+        size_t i = probe_start(key);
+        while (true) {
+            Slot& s = slots_[i];
+            if (s.gen != gen_) {
+                s.key = key;
+                s.g_score = std::numeric_limits<float>::infinity();
+                s.gen = gen_;
+                s.closed = false;
+                ++size_;
+                return &s;
+            }
+            if (s.key == key) return &s;
+            i = (i + 1) & mask_;
+        }
+    }
+
+    size_t size() const { return size_; }
+    size_t capacity() const { return slots_.size(); }
+
+private:
+    static constexpr size_t kInitialCapacity = 1u << 12;
+
+    size_t probe_start(uint64_t key) const {
+        // splitmix64 finalizer: packed keys are dense and highly
+        // structured, so the low bits alone would cluster badly.
+        key ^= key >> 30;
+        key *= 0xBF58476D1CE4E5B9ULL;
+        key ^= key >> 27;
+        key *= 0x94D049BB133111EBULL;
+        key ^= key >> 31;
+        return static_cast<size_t>(key) & mask_;
+    }
+
+    void rehash(size_t new_capacity) {
+        std::vector<Slot> old;
+        old.swap(slots_);
+        slots_.assign(new_capacity, Slot{0, 0.0f, 0, false});
+        mask_ = new_capacity - 1;
+        const uint32_t live = gen_;
+        // Fresh storage starts at generation 1 so zero-initialised slots
+        // read as empty.
+        gen_ = 1;
+        size_ = 0;
+        for (const Slot& s : old) {
+            if (s.gen != live) continue;
+            size_t i = probe_start(s.key);
+            while (slots_[i].gen == gen_) i = (i + 1) & mask_;
+            slots_[i] = s;
+            slots_[i].gen = gen_;
+            ++size_;
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_t mask_ = 0;
+    size_t size_ = 0;
+    uint32_t gen_ = 0;
+};
+
 class CoupledPathfinder {
 public:
     // All construction-time scalars mirror the Python
@@ -128,6 +231,59 @@ public:
         int max_iterations_budget,
         double timeout_seconds);
 
+    // Opt-in goal-distance heuristic.  When enabled, every ``route()``
+    // first runs one backward Dijkstra per head from its goal over that
+    // head's passable cells (restricted to the corridor bitset when one is
+    // given) and the joint heuristic becomes
+    //   max(D_p(p), D_n(n), partner_aware Manhattan term) + spacing_penalty
+    // where ``D`` is the single-trace, turn-aware cost-to-goal.  Each joint
+    // move advances each head by at most one planar step or one layer
+    // change, so ``D`` is a lower bound on the joint remaining cost and the
+    // heuristic is never
+    // looser than ``partner_aware``; in congested regions (detours around
+    // blockages) it is far tighter, which is what lets the #4052 budget
+    // exits converge.  Joint states whose head cannot reach its goal at all
+    // are pruned (``unreachable`` rejection).  Off by default: the
+    // partner_aware heuristic keeps frontier-order parity with Python.
+    void set_distance_heuristic(bool enabled) { distance_heuristic_ = enabled; }
+    bool distance_heuristic() const { return distance_heuristic_; }
+
+    // Issue #2473 polarity-swap move (mirror of the Python ``allow_swap_via``
+    // branch of ``_get_coupled_neighbors``): both heads drop a via and
+    // re-emerge on another routable layer with their grid positions
+    // exchanged, at ``3 * cost_via`` with the direction reset.  Off by
+    // default, as in Python.
+    void set_allow_swap_via(bool enabled) { allow_swap_via_ = enabled; }
+    bool allow_swap_via() const { return allow_swap_via_; }
+
+    // Issue #3115 heuristic selection (mirror of Python ``heuristic_mode``).
+    // ``PARTNER_AWARE`` (default) is ``max(p_dist, n_dist)`` plus the
+    // spacing penalty; ``MANHATTAN_SUM`` is the legacy
+    // ``(p_dist + n_dist) * cost_straight + layer_cost``.  With the
+    // distance heuristic on, MANHATTAN_SUM tightens with ``D_p + D_n``.
+    enum class HeuristicMode { PARTNER_AWARE, MANHATTAN_SUM };
+    void set_heuristic_mode(HeuristicMode mode) { heuristic_mode_ = mode; }
+    HeuristicMode heuristic_mode() const { return heuristic_mode_; }
+
+    // Route several pairs (a byte lane, a USB3/PCIe group) in one call.
+    //
+    // Each round runs the pending pairs' joint searches concurrently on
+    // ``num_threads`` workers (0 = hardware concurrency), each worker a
+    // private ``CoupledPathfinder`` with this one's configuration reading
+    // the shared ``Grid3D``, which is never written.  The round's successful
+    // paths then commit serially in ``(priority, request index)`` order into
+    // a batch-local claim overlay: every committed cell is claimed, with the
+    // ``RoutingGrid.mark_route`` clearance envelope, for its net.  A path
+    // that enters a cell claimed by another net re-queues its pair for the
+    // next round, whose searches treat claimed cells as blocked.  The first
+    // successful pair of every round always commits, so the loop terminates;
+    // ``max_rounds`` (0 = no limit) caps it anyway.  Results do not depend
+    // on the thread count.  The caller marks committed paths on its grid
+    // (the overlay is discarded on return).
+    CoupledBatchResult route_batch(const std::vector<CoupledPairRequest>& requests,
+                                   int num_threads,
+                                   int max_rounds);
+
 private:
     Grid3D& grid_;
     DesignRules rules_;
@@ -145,7 +301,10 @@ private:
         if (gx < 0 || gx >= cols_ || gy < 0 || gy >= rows_) return true;
         if (layer < 0 || layer >= num_layers_) return true;
         const GridCell& cell = grid_.at(gx, gy, layer);
-        return cell.blocked && cell.net != net;
+        if (cell.blocked && cell.net != net) return true;
+        if (claims_ == nullptr) return false;
+        const int32_t owner = claims_[cell_index(gx, gy, layer)];
+        return owner != kNoClaim && owner != net;
     }
     inline bool is_trace_blocked(int gx, int gy, int layer, int net) const {
         return is_cell_blocked(gx, gy, layer, net);
@@ -160,6 +319,116 @@ private:
                      int n_x, int n_y, int n_layer,
                      int p_goal_x, int p_goal_y, int p_goal_layer,
                      int n_goal_x, int n_goal_y, int n_goal_layer) const;
+
+    // Dense search state reused across ``route()`` calls.
+    //
+    // ``joint_table_`` replaces the per-call closed-set / g-score hash
+    // containers.  ``pool_`` / ``open_heap_`` keep their capacity between
+    // calls (the heap is driven with ``std::push_heap`` / ``std::pop_heap``
+    // and ``CoupledNodeGreater``, exactly the operations
+    // ``std::priority_queue`` performs, so the pop order is unchanged).
+    //
+    // ``p_trail_stamp_`` / ``n_trail_stamp_`` replace the per-pop
+    // ``p_visited`` / ``n_visited`` hash sets and the proximity bucket maps:
+    // one ``uint32_t`` per grid cell (``layer * rows * cols + y * cols + x``,
+    // the ``Grid3D`` layout), equal to ``trail_gen_`` iff the cell lies on
+    // the popped node's parent chain.  Each pop bumps ``trail_gen_`` and
+    // re-stamps the chain -- still O(depth), but without hashing, bucket
+    // vectors or clears.
+    JointStateTable joint_table_;
+    std::vector<CoupledAStarNode> pool_;
+    std::vector<CoupledAStarNode> open_heap_;
+    std::vector<uint32_t> p_trail_stamp_;
+    std::vector<uint32_t> n_trail_stamp_;
+    uint32_t trail_gen_ = 0;
+    // Single-trace cost-to-goal field for the opt-in distance heuristic.
+    // Turn-aware: one distance per (cell, heading), where the heading is
+    // the joint direction (+x, -x, +y, -y, or none at the root), so the
+    // ``cost_turn`` plateaus that flood the joint search are priced in.
+    // Generation-stamped per cell like the trail arrays, so a reused
+    // pathfinder pays no O(cells) clear per ``route()``; a cell's distances
+    // are valid iff ``gen`` matches ``cur``, and unstamped cells are
+    // unreachable.
+    static constexpr int kHeadings = 5;
+    static constexpr int kNoHeading = 4;
+    static constexpr int kHeadingDx[4] = {1, -1, 0, 0};
+    static constexpr int kHeadingDy[4] = {0, 0, 1, -1};
+    struct GoalDistanceField {
+        std::vector<float> dist;     // cells * kHeadings
+        std::vector<uint32_t> gen;   // cells
+        uint32_t cur = 0;
+    };
+    bool distance_heuristic_ = false;
+    bool allow_swap_via_ = false;
+    HeuristicMode heuristic_mode_ = HeuristicMode::PARTNER_AWARE;
+    GoalDistanceField p_goal_field_;
+    GoalDistanceField n_goal_field_;
+    std::vector<std::pair<float, size_t>> dijkstra_heap_;
+
+    // Backward Dijkstra from ``(goal_x, goal_y)`` (seeded on every layer in
+    // ``layers``, matching the layer-agnostic goal test) for one head, over
+    // (cell, heading) states.
+    // ``exempt`` are the packed (x,y) corridor-exempt endpoint cells;
+    // ``start`` / ``goal`` are this head's own endpoints, which are passable
+    // regardless of blockage (the search's endpoint exemption).
+    void build_goal_distance_field(GoalDistanceField& field,
+                                   int goal_x, int goal_y,
+                                   int start_x, int start_y,
+                                   int net,
+                                   const std::vector<int>& layers,
+                                   const std::vector<uint8_t>& corridor_bitset,
+                                   const uint64_t (&exempt)[4]);
+
+    static inline int heading_index(int dx, int dy) {
+        if (dx > 0) return 0;
+        if (dx < 0) return 1;
+        if (dy > 0) return 2;
+        if (dy < 0) return 3;
+        return kNoHeading;
+    }
+
+    inline float goal_distance(const GoalDistanceField& field, size_t cell,
+                               int heading) const {
+        return field.gen[cell] == field.cur
+                   ? field.dist[cell * kHeadings + heading]
+                   : std::numeric_limits<float>::infinity();
+    }
+
+    // Disc offsets ``(dx, dy)`` with ``dx^2 + dy^2 < min_spacing_cells_^2``,
+    // the trail-proximity neighbourhood (built once in the constructor).
+    std::vector<std::pair<int, int>> prox_offsets_;
+
+    inline size_t cell_index(int x, int y, int layer) const {
+        return (static_cast<size_t>(layer) * static_cast<size_t>(rows_) +
+                static_cast<size_t>(y)) * static_cast<size_t>(cols_) +
+               static_cast<size_t>(x);
+    }
+
+    // Size the trail stamp arrays to the grid and start a new trail
+    // generation (full clear on wraparound).
+    void next_trail_generation();
+
+    // ``route_batch`` claim overlay: one owner net per grid cell (same
+    // layout as the trail stamps), ``kNoClaim`` when free.  Null outside a
+    // batch, so ``route()`` pays one pointer test per blocked-cell query.
+    static constexpr int32_t kNoClaim = -1;
+    const int32_t* claims_ = nullptr;
+    std::vector<int32_t> batch_claims_;
+
+    // Clearance envelopes of committed batch copper, in cells: the
+    // ``RoutingGrid.mark_route`` trace radius (half width + clearance, +1
+    // for truncation, +1 quantisation margin) and the ``_mark_via`` radius.
+    int claim_trace_radius_ = 0;
+    int claim_via_radius_ = 0;
+
+    // True iff a cell of the pair's committed copper (each head's cells, and
+    // the via footprint ``is_via_blocked`` checks at every via site) is
+    // claimed by another net.  The pair's own endpoint cells are exempt, as
+    // in the search.
+    bool path_conflicts(const CoupledPairRequest& req,
+                        const CoupledRouteResult& res) const;
+    // Claim the clearance envelope of the pair's path for its nets.
+    void claim_path(const CoupledPairRequest& req, const CoupledRouteResult& res);
 };
 
 }  // namespace router
@@ -0,0 +1,130 @@
+/*
+ * Router C++ Core - package escape (fanout) planner
+ *
+ * Native counterpart of the fanout generators in ``router/escape.py``
+ * (``_escape_bga_rings``, ``_escape_qfp_alternating``).  The Python
+ * generators build each stub as Python objects, check it against Python
+ * pad / route lists and then push every stub through the Python -> C++
+ * grid sync; on a 400+ ball BGA that costs more than routing the rest of
+ * the board.
+ *
+ * ``EscapePlanner::plan`` computes the fanout of a whole package in one
+ * call:
+ *
+ *   1. every pin gets an ordered list of candidate stubs for the pattern;
+ *   2. each candidate is checked, in parallel, against the ``Grid3D``
+ *      board state -- registered pads, stored segments and vias with the
+ *      same clearance rules as ``Grid3D::validate_route``, plus via-to-pad
+ *      copper, hole-to-hole spacing and net-0 keep-out cells;
+ *   3. pins are visited outer ring first and take their first board-legal
+ *      candidate that clears the stubs already accepted for this package.
+ *
+ * ``EscapePlanner::commit`` writes accepted stubs straight into the grid:
+ * stored geometry for validation, blocked cells with the same radii as
+ * ``RoutingCore._mark_route_on_cpp_grid``, and a soft corridor reservation
+ * (attractor only) continuing outward from each escape point.
+ *
+ * Patterns:
+ *
+ *   - ``ESCAPE_RING`` (BGA): the outer ring escapes on the surface layer
+ *     straight past the package edge; inner rings drop a dog-bone via
+ *     between balls (diagonal away from the center) and, where a channel
+ *     is free, run out on an inner layer along the ball row / column.
+ *     Inner layers are assigned ring by ring from ``inner_layers``.  A pin
+ *     whose channel is taken keeps a via-only stub.
+ *   - ``ESCAPE_ALTERNATING`` (QFP/QFN): perimeter pins escape
+ *     perpendicular to their edge; every other pin along an edge runs
+ *     ``via_spacing`` further and drops a via, so the via row staggers.
+ *     Pins near the center (thermal pads) are skipped.
+ *
+ * Net-0 and through-hole pins are skipped in every pattern.
+ */
+
+#pragma once
+
+#include "grid.hpp"
+#include "types.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace router {
+
+enum EscapePattern : int {
+    ESCAPE_RING = 0,
+    ESCAPE_ALTERNATING = 1,
+};
+
+enum EscapeStatus : int {
+    ESCAPE_OK = 0,
+    ESCAPE_SKIPPED = 1,   // net 0, through-hole or thermal pad
+    ESCAPE_BLOCKED = 2,   // no candidate clears the board
+    ESCAPE_CONFLICT = 3,  // board-legal candidates all clash with this package's stubs
+};
+
+struct EscapePin {
+    float x = 0.0f;
+    float y = 0.0f;
+    float width = 0.0f;
+    float height = 0.0f;
+    int net = 0;
+    int layer = 0;  // grid layer index; -1 = through-hole
+};
+
+struct EscapeConfig {
+    int pattern = ESCAPE_RING;
+    std::vector<int> inner_layers;  // via escape layers (cycled by ring)
+    float escape_clearance = 0.0f;  // past the package edge (0 = 2 x trace_clearance)
+    float via_spacing = 0.0f;       // 0 = via_diameter + via_clearance
+    float min_drill_clearance = 0.0f;  // hole-to-hole, any net (0 = rules default)
+    int corridor_cells = 4;         // soft reservation past the escape point
+    int num_threads = 0;            // 0 = hardware concurrency
+};
+
+struct EscapeStub {
+    int pin = -1;
+    int net = 0;
+    int ring = 0;
+    int status = ESCAPE_SKIPPED;
+    float dir_x = 0.0f;  // outward unit direction
+    float dir_y = 0.0f;
+    float escape_x = 0.0f;
+    float escape_y = 0.0f;
+    int escape_layer = 0;
+    bool has_via = false;
+    Via via{};
+    std::vector<Segment> segments;
+};
+
+class EscapePlanner {
+public:
+    // Holds a reference to ``grid``; register pads (and stored routes) on
+    // it before planning.
+    EscapePlanner(Grid3D& grid, const DesignRules& rules);
+
+    // One stub per pin (same order); check ``status``.
+    std::vector<EscapeStub> plan(const std::vector<EscapePin>& pins,
+                                 const EscapeConfig& config) const;
+
+    // Write the ``ESCAPE_OK`` stubs into the grid; returns how many.
+    // Callers that sync stored routes / reservations from Python pass
+    // ``store_geometry`` / ``reserve`` false and only get the cell marks.
+    int commit(const std::vector<EscapeStub>& stubs, const EscapeConfig& config,
+               bool store_geometry = true, bool reserve = true);
+
+    // Grid cells ``commit`` soft-reserves for ``stub`` on its escape layer:
+    // up to ``corridor_cells`` outward from the escape point, stopping at
+    // foreign copper or an existing reservation.
+    std::vector<std::pair<int, int>> corridor_cells(const EscapeStub& stub,
+                                                    const EscapeConfig& config) const;
+
+    // Candidates checked against the board by the last ``plan``.
+    int last_candidates() const { return last_candidates_; }
+
+private:
+    Grid3D& grid_;
+    DesignRules rules_;
+    mutable int last_candidates_ = 0;
+};
+
+}  // namespace router
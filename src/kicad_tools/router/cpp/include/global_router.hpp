@@ -0,0 +1,142 @@
+/*
+ * Router C++ Core - native coarse global router
+ *
+ * Native counterpart of ``router/region_graph.py::RegionGraph`` +
+ * ``router/global_router.py::GlobalRouter`` (issues #1095 / #2276).  The
+ * Python planner builds its own tile graph from pad rectangles, runs one
+ * ``_GlobalSearchNode`` heap A* per net and re-derives every congestion
+ * figure in dict loops; the detailed router then rebuilds a corridor from
+ * the resulting waypoint polyline.  On boards with a few hundred nets the
+ * negotiation loop dominated the planning phase.
+ *
+ * ``GlobalRouter`` plans directly over a ``Grid3D``:
+ *
+ *   - the regions ARE the grid's coarse congestion tiles
+ *     (``Grid3D::congestion_tile()`` cells per side, the last row/column
+ *     absorbing the remainder exactly like ``get_congestion``);
+ *   - a boundary's capacity is counted from the grid cells themselves:
+ *     per routable layer, the boundary rows/columns whose cells on BOTH
+ *     sides are unblocked, divided by the trace pitch in cells (the
+ *     ``(length - blockage) / pitch`` of ``_compute_edge_capacity``, with
+ *     the blockage read off the grid instead of re-derived from pads --
+ *     copper already committed to the grid consumes capacity too);
+ *   - edge cost is ``distance * congestion_cost`` with ``RegionEdge``'s
+ *     piecewise congestion cost and negotiated history term.
+ *
+ * Multi-pin nets are planned as a tree (each remaining pin tile is reached
+ * by a multi-source A* from the tiles already in the tree) instead of the
+ * Python planner's single farthest-pin-pair corridor.
+ *
+ * ``route_all`` runs the negotiation loop of ``GlobalRouter.route_all``
+ * with batched parallel searches: a batch of nets is searched concurrently
+ * against the usage committed before the batch (read-only), then the batch
+ * commits in request order.  The result depends on ``batch_size`` but not
+ * on the thread count.
+ *
+ * Each planned net yields a corridor: its tree tiles dilated by ``halo``
+ * tiles, expanded to the flat ``cols*rows`` cell bitset that
+ * ``Pathfinder::set_search_corridor`` and ``CoupledPathfinder::route``
+ * consume.
+ */
+
+#pragma once
+
+#include "grid.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace router {
+
+// One net to plan: its pin cells in GRID coordinates.
+struct GlobalNetRequest {
+    int net = 0;
+    std::vector<std::pair<int, int>> pins;
+};
+
+// Outcome of ``GlobalRouter::route_all``.  ``nets`` lists the planned nets in
+// request order; ``tiles[k]`` / ``edges[k]`` are net ``nets[k]``'s tree
+// (sorted tile and boundary-edge indices).  Requests with fewer than two
+// distinct pin cells are skipped, like the Python planner.
+struct GlobalRouteResult {
+    std::vector<int> nets;
+    std::vector<std::vector<int>> tiles;
+    std::vector<std::vector<int>> edges;
+    std::vector<int> failed_nets;
+    int iterations = 0;
+    int final_overflow = 0;
+};
+
+class GlobalRouter {
+public:
+    // ``pitch_cells`` is the trace pitch (width + clearance) in grid cells;
+    // ``routable_layers`` empty means every grid layer.
+    GlobalRouter(const Grid3D& grid, int pitch_cells,
+                 const std::vector<int>& routable_layers = {});
+
+    // Negotiation knobs (``GlobalRouter`` kwargs in Python).
+    bool negotiated = true;
+    int max_iterations = 15;
+    double history_increment = 1.0;
+
+    // Recount boundary capacities from the grid (after marking new copper).
+    void refresh_capacity();
+
+    GlobalRouteResult route_all(const std::vector<GlobalNetRequest>& requests,
+                                int num_threads = 0, int batch_size = 32);
+
+    // Flat ``cols*rows`` cell bitset covering ``tiles`` dilated by ``halo``
+    // tiles (Chebyshev distance).
+    std::vector<uint8_t> corridor_bitset(const std::vector<int>& tiles, int halo) const;
+
+    // Tiling and per-edge state, for inspection.
+    int tile_cols() const { return tcols_; }
+    int tile_rows() const { return trows_; }
+    int tile_of(int x, int y) const;
+    size_t num_edges() const { return capacity_.size(); }
+    std::pair<int, int> edge_tiles(int edge) const;
+    int capacity(int edge) const { return capacity_[edge]; }
+    int usage(int edge) const { return usage_[edge]; }
+    double history(int edge) const { return history_[edge]; }
+    int total_overflow() const;
+
+private:
+    // Per-worker search scratch (stamped, so no per-search clears).
+    struct Scratch {
+        std::vector<double> g;
+        std::vector<int> parent_edge;
+        std::vector<uint32_t> stamp;
+        std::vector<uint32_t> closed;
+        uint32_t generation = 0;
+    };
+
+    // A net's planned tree.
+    struct Tree {
+        std::vector<int> tiles;
+        std::vector<int> edges;
+    };
+
+    const Grid3D& grid_;
+    int pitch_cells_;
+    std::vector<int> layers_;
+    int tile_;
+    int tcols_, trows_;
+    int h_edges_;  // horizontal boundaries come first: r * (tcols - 1) + c
+    std::vector<double> cx_, cy_;  // tile centers, mm
+    std::vector<double> length_;   // center-to-center edge distance, mm
+    std::vector<int> capacity_;
+    std::vector<int> usage_;
+    std::vector<double> history_;
+
+    // Cell span [begin, end) of tile ``t`` of ``n`` along an axis of
+    // ``count`` cells; the last tile absorbs the remainder.
+    int span_begin(int t) const { return t * tile_; }
+    int span_end(int t, int n, int count) const {
+        return t == n - 1 ? count : (t + 1) * tile_;
+    }
+    double edge_cost(int edge) const;
+    int edge_between(int a, int b) const;
+    bool plan(const std::vector<int>& pin_tiles, Scratch& s, Tree& out) const;
+};
+
+}  // namespace router
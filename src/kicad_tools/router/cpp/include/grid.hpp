@@ -11,10 +11,47 @@
 #include "types.hpp"
 #include <vector>
 #include <cmath>
+#include <unordered_map>
 #include <algorithm>
 
 namespace router {
 
+// A refinement region: a rectangle of coarse cells re-gridded ``factor``
+// times finer, so fine-pitch pads get on-grid access without a board-wide
+// fine grid.  Fine cell (fx, fy) subdivides coarse cell
+// (x0 + fx / factor, y0 + fy / factor); with an odd factor the middle fine
+// cell shares the coarse cell's center.
+//
+// Fine cells are rasterized from geometry instead of being copied from
+// the coarse cells: a fine cell is ``blocked`` when a trace centerline
+// there would violate clearance to a registered pad (``add_pad``) or a
+// stored segment / via -- the trace half-width is baked in, so the search
+// tests a single fine cell instead of a kernel.  ``net`` is the owner of
+// that copper (-1 when two nets claim the cell); ``pad_blocked`` /
+// ``is_obstacle`` mark pad metal.  Coarse keep-out cells (``is_obstacle``
+// without ``pad_blocked``, net 0: board edge, keepouts) are inherited.
+//
+// ``transitions`` are the explicit coarse <-> fine edges: every coarse
+// cell 4-adjacent to the region (and not refined itself) links to the
+// ``factor`` fine cells along the shared side, on every layer.
+struct RefinementRegion {
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;  // covered coarse cells (inclusive)
+    int factor = 1;                      // fine cells per coarse cell side
+    int cols = 0, rows = 0;              // fine cells
+    float resolution = 0.0f;             // fine cell size (mm)
+    float origin_x = 0.0f, origin_y = 0.0f;  // world center of fine cell (0, 0)
+    float trace_half_width = 0.0f;       // baked into the clearance halos
+    float clearance = 0.0f;              // default (pad clearance_override wins)
+    std::vector<GridCell> cells;         // layers x rows x cols
+    // (coarse y * grid cols + x, fine fy * cols + fx) pairs.
+    std::vector<std::pair<int, int>> transitions;
+
+    inline size_t index(int fx, int fy, int layer) const {
+        return static_cast<size_t>(layer) * rows * cols +
+               static_cast<size_t>(fy) * cols + static_cast<size_t>(fx);
+    }
+};
+
 class Grid3D {
 public:
     Grid3D(int cols, int rows, int layers, float resolution,
@@ -188,6 +225,14 @@ public:
     float get_congestion(int x, int y, int layer) const;
     void update_congestion(int x, int y, int layer, int delta = 1);
 
+    // Coarse congestion tiling: ``congestion_tile()`` cells per side, the
+    // last row/column of tiles absorbing any remainder (see
+    // ``get_congestion``).  The native global router (global_router.hpp)
+    // plans over the same tiles.
+    int congestion_tile() const { return congestion_size_; }
+    int congestion_cols() const { return congestion_cols_; }
+    int congestion_rows() const { return congestion_rows_; }
+
     // DRC avoidance feedback
     void boost_region_cost(int center_x, int center_y, int layer,
                            int radius_cells, float amount);
@@ -211,6 +256,44 @@ public:
     void update_history_costs(float increment);
     int get_total_overflow() const;
 
+    // Blocker identification for targeted rip-up.  Ports the cell walks of
+    // ``CppPathfinder.find_blocking_nets`` / ``find_blocking_nets_relaxed``
+    // (previously quadruple-nested Python loops run for every failed net in
+    // every negotiated iteration) into one native pass.
+    //
+    // ``segments`` are grid-coordinate ``(x1, y1, x2, y2, layer)`` runs,
+    // walked with Bresenham; every cell in the circular (Euclidean) kernel
+    // of ``radius`` cells around each step is inspected -- the same disc
+    // metric ``Pathfinder::is_trace_blocked`` uses.  ``via_cells`` are
+    // ``(x, y)`` via locations, inspected on every layer without a kernel
+    // (matching the Python via-location check).  The strict caller passes
+    // the single direct start->end line; the relaxed caller passes the
+    // relaxed route's segments and vias.
+    //
+    // A cell counts as a conflict when it is blocked by a net other than
+    // 0, ``source_net`` and ``partner_net`` (the diff-pair partner, -1 when
+    // none).  ``relaxed == false`` additionally requires
+    // ``usage_count > 0`` (routed copper, the strict direct-line mode);
+    // ``relaxed == true`` instead skips ``pad_blocked`` cells (static pad
+    // metal is never a rip-up candidate).
+    //
+    // ``saved_blocked`` / ``saved_net``, when non-null, are C-contiguous
+    // ``layers x rows x cols`` snapshots read instead of the live cells'
+    // ``blocked`` / ``net`` -- the relaxed caller runs inside
+    // ``temporarily_unblock_routed_nets()`` and passes the pre-unblock
+    // arrays.  Overlapping kernels are deduplicated, so each per-net count
+    // is the number of DISTINCT conflicting cells; the result is sorted by
+    // net id for determinism.
+    std::vector<std::pair<int, int>> collect_blocking_nets(
+        const std::vector<std::tuple<int, int, int, int, int>>& segments,
+        const std::vector<std::pair<int, int>>& via_cells,
+        int radius,
+        bool relaxed,
+        int source_net,
+        int partner_net = -1,
+        const bool* saved_blocked = nullptr,
+        const int32_t* saved_net = nullptr) const;
+
     // Accessors
     int cols() const { return cols_; }
     int rows() const { return rows_; }
@@ -293,6 +376,8 @@ public:
 
     // Accessors for validation data sizes (for testing/debugging)
     size_t pad_count() const { return pads_.size(); }
+    const std::vector<PadInfo>& pads() const { return pads_; }
+    const std::vector<StoredSegment>& stored_segments() const { return stored_segments_; }
     size_t stored_segment_count() const { return stored_segments_.size(); }
     size_t stored_via_count() const { return stored_vias_.size(); }
 
@@ -302,6 +387,44 @@ public:
     // refuses placements the post-route validator would later reject.
     const std::vector<StoredVia>& stored_vias() const { return stored_vias_; }
 
+    // -----------------------------------------------------------------------
+    // Refinement regions (multi-resolution search, see RefinementRegion).
+    // ``Pathfinder::route_multires`` searches coarse and fine cells in one
+    // A* run; the plain ``route`` ignores the regions.
+    // -----------------------------------------------------------------------
+
+    // Refine coarse cells [x0, x1] x [y0, y1] (clamped to the grid) by
+    // ``factor`` (>= 2).  Regions must not overlap; adjacent regions are
+    // only connected through coarse cells, so merge neighbours into one
+    // region.  Rasterizes the fine cells from the registered pads and
+    // stored routes, so register those first.  Returns the region index.
+    int add_refinement(int x0, int y0, int x1, int y1, int factor,
+                       float trace_half_width, float clearance);
+    void clear_refinements();
+    // Re-rasterize every region (after bulk coarse edits).  Stored
+    // segments / vias are stamped incrementally as they are added, and
+    // ``clear_stored_routes`` re-rasterizes on its own.
+    void refresh_refinements();
+
+    int num_refinements() const { return static_cast<int>(refinements_.size()); }
+    const RefinementRegion& refinement(int region) const { return refinements_[region]; }
+    // Region refining coarse cell (x, y), or -1.
+    inline int refinement_at(int x, int y) const {
+        if (refine_owner_.empty() || x < 0 || x >= cols_ || y < 0 || y >= rows_) return -1;
+        return refine_owner_[static_cast<size_t>(y) * cols_ + x];
+    }
+    // (region, fine fy * cols + fx) transition partners of coarse cell (x, y).
+    const std::vector<std::pair<int, int>>& refinement_links(int x, int y) const;
+    // (coarse y * cols + x) transition partners of a fine cell.
+    const std::vector<int>& refinement_links_fine(int region, int fx, int fy) const;
+
+    inline const GridCell& fine_at(int region, int fx, int fy, int layer) const {
+        const RefinementRegion& r = refinements_[region];
+        return r.cells[r.index(fx, fy, layer)];
+    }
+    std::pair<float, float> fine_to_world(int region, int fx, int fy) const;
+    std::pair<int, int> world_to_fine(int region, float x, float y) const;  // clamped
+
 private:
     inline size_t index(int x, int y, int layer) const {
         return static_cast<size_t>(layer) * rows_ * cols_ +
@@ -328,6 +451,16 @@ private:
     std::vector<PadInfo> pads_;
     std::vector<StoredSegment> stored_segments_;
     std::vector<StoredVia> stored_vias_;
+
+    // Refinement regions; ``refine_owner_`` (cols x rows, -1 = coarse) is
+    // empty while there are none.
+    std::vector<RefinementRegion> refinements_;
+    std::vector<int16_t> refine_owner_;
+    std::unordered_map<int, std::vector<std::pair<int, int>>> refine_links_;
+    std::vector<std::unordered_map<int, std::vector<int>>> refine_links_fine_;
+
+    void rasterize_refinement(int region);
+    void stamp_refinements(const StoredSegment* seg, const StoredVia* via);
 };
 
 }  // namespace router
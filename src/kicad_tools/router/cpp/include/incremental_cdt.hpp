@@ -0,0 +1,121 @@
+/*
+ * Router C++ Core - incremental constrained-Delaunay updates for the mesh router
+ *
+ * poly2tri (mesh.cpp, issue #4268) only triangulates a whole polygon with
+ * holes in one shot, so any change to the hole set -- a pour added or
+ * removed between negotiation runs -- used to mean a full board remesh.
+ * ``IncrementalCDT`` adopts an existing triangulation and edits it locally:
+ *
+ *   - ``insert_hole`` cuts a new hole polygon out of the mesh;
+ *   - ``remove_hole`` fills a hole back in.
+ *
+ * Both collect the *cavity* (the triangles the edit touches), grow it until
+ * its boundary is one simple outer loop plus whole existing hole loops,
+ * re-triangulate only that patch with poly2tri (the cavity boundary is the
+ * patch's outer polygon, so the patch conforms to the untouched mesh), and
+ * then run Lawson edge flips outward from the patch to restore the Delaunay
+ * property across its boundary.  Every constraint in this mesh (outline and
+ * hole loops) is a boundary edge, so any interior edge may be flipped.
+ *
+ * Triangle ids outside the edited region are stable: patch triangles reuse
+ * the cavity's slots, and when the patch is smaller the tail triangles are
+ * moved into the remaining slots (reported in ``Update::moved``).  Vertex ids
+ * are stable too; vertices the edit drops are set to NaN (never coincident
+ * with anything) and their ids recycled by later inserts.
+ *
+ * A failed edit (hole outside the domain, overlapping another hole or the
+ * outline, or a poly2tri failure) returns ``ok == false`` and leaves the mesh
+ * untouched; callers fall back to a full ``constrained_delaunay``.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace router {
+
+class IncrementalCDT {
+public:
+    using Pt = std::pair<double, double>;
+    using Tri = std::array<int, 3>;
+
+    // Outcome of one local edit.
+    struct Update {
+        bool ok = false;
+        int hole_id = -1;                        // inserted / removed hole
+        std::vector<int> changed;                // triangle ids with new contents
+        std::vector<std::pair<int, int>> moved;  // (old id, new id) compaction moves
+    };
+
+    // Adopt a triangulation (e.g. ``constrained_delaunay`` output).  Triangles
+    // are normalized to counter-clockwise order; every boundary loop other
+    // than the outermost one becomes a removable hole, numbered from 0 in
+    // order of its lowest vertex id.
+    IncrementalCDT(const std::vector<Pt>& vertices, const std::vector<Tri>& triangles);
+
+    const std::vector<Pt>& vertices() const { return vertices_; }
+    const std::vector<Tri>& triangles() const { return tris_; }
+
+    std::vector<int> hole_ids() const;
+    std::vector<int> hole_loop(int hole_id) const;
+
+    // Hole whose loop has a vertex coincident with ``p`` or whose interior
+    // contains ``p``; -1 when none.
+    int hole_at(const Pt& p) const;
+
+    Update insert_hole(const std::vector<Pt>& polygon);
+    Update remove_hole(int hole_id);
+
+    // Structural self-check: every directed edge used once, every triangle
+    // counter-clockwise and non-degenerate, no dropped vertex referenced.
+    bool is_valid() const;
+
+    static constexpr double kEps = 1e-9;
+
+private:
+    std::vector<Pt> vertices_;
+    std::vector<Tri> tris_;
+    std::vector<int> free_vertices_;
+
+    // Directed edge (u -> v) -> triangle owning it; twin lookup is (v -> u).
+    std::unordered_map<uint64_t, int> half_;
+    std::vector<std::vector<int>> vtx_tris_;
+
+    // Hole id -> vertex loop.
+    std::map<int, std::vector<int>> holes_;
+    int next_hole_id_ = 0;
+
+    // Uniform bucket grid over the adopted domain (per-bucket id lists so
+    // edits update it in place).
+    double bx0_ = 0.0, by0_ = 0.0, bucket_w_ = 1.0, bucket_h_ = 1.0;
+    int bucket_cols_ = 1, bucket_rows_ = 1;
+    std::vector<std::vector<int>> buckets_;
+
+    // Cavity boundary, split into the outer loop and whole hole loops.
+    struct Boundary {
+        std::vector<int> outer;
+        std::vector<std::vector<int>> holes;
+        std::vector<int> interior;  // cavity vertices on no loop
+    };
+
+    int twin(int u, int v) const;
+    void link(int t);
+    void unlink(int t);
+    void bucket_range(int t, int& c0, int& c1, int& r0, int& r1) const;
+    int alloc_vertex(const Pt& p);
+    void drop_vertex(int v);
+
+    std::optional<Boundary> close_cavity(std::vector<uint8_t>& in_cavity,
+                                         std::vector<int>& cavity,
+                                         const std::vector<int>& skip_loop) const;
+    Update apply_patch(const std::vector<int>& cavity, const std::vector<Tri>& patch);
+    void legalize(Update& up);
+};
+
+}  // namespace router
@@ -0,0 +1,234 @@
+/*
+ * Router C++ Core - balanced-quadtree octilinear lattice
+ *
+ * Native counterpart of ``router/lattice/quadtree.py::OctilinearLattice``,
+ * the static pad masks of ``router/lattice/obstacles.py`` and the
+ * single-agent (node, layer) A* of ``LatticePathfinder._route_impl``
+ * (issue #4278).  Building the quadtree, balancing it, deriving the graph
+ * and masking every node/edge against the inflated pad keep-outs were all
+ * Python dict/set loops; on a full board the lattice build alone dominated
+ * the P2 run, and the A* spent most of its time hashing tuple keys.
+ *
+ * ``OctilinearLattice`` keeps the exact Python geometry (same levels, same
+ * leaves, same node keys, same edges) but stores the graph as flat arrays:
+ *
+ *   - node keys sorted ascending, so node indices are deterministic;
+ *   - edges as sorted ``(min_key, max_key)`` node-index pairs, ascending;
+ *   - a CSR adjacency built by walking the edge list in order (the Python
+ *     wrapper rebuilds ``adj`` in the same order, so both A* flavours
+ *     expand neighbours identically).
+ *
+ * ``set_pads`` builds the per-layer pad masks (``node_pads`` /
+ * ``edge_pads``) once; the predicates resolve net membership at query time
+ * exactly like ``LatticeObstacleModel``.
+ *
+ * ``LatticeCopper`` mirrors ``CommittedCopper``: per-layer segment hash +
+ * flat via list, with the same gap formulas (issue #4271 per-class widths)
+ * and the same-net via body-crossing veto (#4318).
+ *
+ * ``astar`` runs the non-fat search.  Via legality has pad-geometry rules
+ * (#4284 via-in-pad, #4291 hole-to-hole) that live in the Python pathfinder,
+ * so it is supplied as a callback and cached per node like the Python loop.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace router {
+
+// A rectangular region requesting a local cell size of ``fine`` mm.
+struct RefineRegion {
+    std::array<double, 4> rect;  // (xmin, ymin, xmax, ymax)
+    double fine;
+
+    // Quadtree level whose cell size first reaches ``fine``.
+    int level_for(double coarse) const;
+};
+
+class LatticeCopper;
+
+class OctilinearLattice {
+public:
+    using Pt = std::pair<double, double>;
+    using Rect = std::array<double, 4>;
+    using Key = std::pair<int, int>;
+    using Cell = std::array<int, 3>;  // (level, i, j)
+
+    // One (node, layer) stub end: where an escape stub meets the lattice
+    // and the stub's length.
+    struct Terminal {
+        int node;
+        int layer;
+        double length;
+    };
+
+    // Inputs of one single-agent search (see ``_route_impl``).
+    struct Search {
+        std::vector<Terminal> starts;
+        std::vector<Terminal> goals;
+        Pt end_pt{0.0, 0.0};
+        int net = 0;
+        double half = 0.0;
+        double clearance = 0.0;
+        double extra = 0.0;      // keep-out surcharge over the agent radius
+        double present = 0.0;
+        // (edge index, layer, history) / (node index, history).
+        std::vector<std::tuple<int, int, double>> edge_history;
+        std::vector<std::pair<int, double>> via_history;
+        bool allow_vias = true;
+        int num_layers = 1;
+        double via_cost = 0.0;
+    };
+
+    // Start-to-goal state chain; ``moves[k]`` ("move" / "via") joins
+    // ``nodes/layers[k]`` to ``[k + 1]``.  Empty when no path exists.
+    struct Path {
+        std::vector<int> nodes;
+        std::vector<int> layers;
+        std::vector<std::string> moves;
+    };
+
+    OctilinearLattice(const Rect& bbox, const std::vector<RefineRegion>& regions, double coarse);
+
+    double coarse() const { return coarse_; }
+    double fine() const { return fine_; }
+    double unit() const { return unit_; }
+    int max_level() const { return max_level_; }
+    int nx() const { return nx_; }
+    int ny() const { return ny_; }
+    Pt origin() const { return {bbox_[0], bbox_[1]}; }
+
+    std::vector<Cell> leaves() const;
+    int neighbor_max_level(int level, int i, int j, char direction) const;
+
+    size_t num_nodes() const { return keys_.size(); }
+    size_t num_edges() const { return edges_.size(); }
+    const std::vector<Key>& node_keys() const { return keys_; }
+    const std::vector<std::pair<int, int>>& edges() const { return edges_; }
+    const std::vector<double>& edge_lengths() const { return edge_len_; }
+    Pt node_point(const Key& key) const;
+    Pt node_point(int node) const { return node_point(keys_[node]); }
+    int node_index(const Key& key) const;  // -1 when absent
+    // Edge joining ``a`` and ``b`` (either order); -1 when absent.
+    int edge_index(const Key& a, const Key& b) const;
+    // Nodes within ``radius`` of ``p`` as ``(distance, node)``, ascending
+    // (the escape-stub candidate scan of ``_scan_stubs``).
+    std::vector<std::pair<double, int>> nodes_within(const Pt& p, double radius) const;
+
+    // Static per-layer pad masks.  ``rects`` are the inflated pad
+    // keep-outs, ``layers[p]`` the layer indices pad ``p`` occupies.
+    void set_pads(const std::vector<Rect>& rects, const std::vector<int>& nets,
+                  const std::vector<std::vector<int>>& layers, int num_layers);
+    // Per layer, the (node, pad) / (edge, pad) mask pairs, ascending.
+    std::vector<std::vector<std::pair<int, int>>> node_pad_pairs() const;
+    std::vector<std::vector<std::pair<int, int>>> edge_pad_pairs() const;
+
+    bool node_blocked(int node, int layer, int net) const;
+    bool edge_blocked(int edge, int layer, int net) const;
+    bool segment_blocked(const Pt& a, const Pt& b, int layer, int net, double extra) const;
+
+    Path astar(const Search& q, const LatticeCopper& committed,
+               const std::function<bool(int)>& via_ok) const;
+
+private:
+    Rect bbox_;
+    double coarse_;
+    int max_level_ = 0;
+    double fine_;
+    double unit_;
+    int nx_ = 1, ny_ = 1;
+    std::vector<std::pair<Rect, int>> region_levels_;
+
+    // Leaves keyed by (level, i, j) packed into one integer.
+    std::unordered_map<uint64_t, uint8_t> leaves_;
+
+    std::vector<Key> keys_;
+    std::unordered_map<uint64_t, int> key_index_;
+    std::vector<std::pair<int, int>> edges_;
+    std::vector<double> edge_len_;
+    std::vector<int> adj_start_;
+    std::vector<int> adj_node_;
+    std::vector<int> adj_edge_;
+
+    // Pad masks: CSR pad lists per (layer, node) / (layer, edge).
+    int num_layers_ = 0;
+    std::vector<Rect> pad_rects_;
+    std::vector<int> pad_nets_;
+    std::vector<std::vector<uint8_t>> pad_on_layer_;  // [pad][layer]
+    std::vector<std::vector<int>> node_mask_start_, node_mask_pad_;
+    std::vector<std::vector<int>> edge_mask_start_, edge_mask_pad_;
+    std::unordered_map<uint64_t, std::vector<int>> pad_buckets_;
+
+    static uint64_t cell_id(int level, int i, int j);
+    static uint64_t key_id(const Key& key);
+    bool is_leaf(int level, int i, int j) const;
+    Rect cell_rect(int level, int i, int j) const;
+    bool needs_refine(const Rect& rect, int level) const;
+    bool cell_in_bounds(const Rect& rect) const;
+    bool inside(double x, double y) const;
+    Key node_key(double x, double y) const;
+
+    void build_quadtree();
+    void balance();
+    void build_graph();
+    std::vector<int> pads_near(double x0, double y0, double x1, double y1) const;
+};
+
+// Copper committed by already-routed nets in one negotiation pass
+// (``CommittedCopper``).  Negative ``half`` / ``clearance`` arguments fall
+// back to the board-global trace geometry, like ``None`` in Python.
+class LatticeCopper {
+public:
+    using Pt = std::pair<double, double>;
+
+    LatticeCopper(int num_layers, double trace_half, double clearance, double via_radius,
+                  double via_via_gap, double same_net_via_gap);
+
+    void add_run(int layer, const std::vector<Pt>& points, int net, double half_width,
+                 double clearance = -1.0);
+    void add_run_widths(int layer, const std::vector<Pt>& points, int net,
+                        const std::vector<double>& seg_halves, double clearance = -1.0);
+    void add_via(const Pt& point, int net);
+
+    bool seg_clear(const Pt& a, const Pt& b, int layer, int net, double half = -1.0,
+                   double clearance = -1.0) const;
+    bool node_clear(const Pt& point, int layer, int net, double half = -1.0,
+                    double clearance = -1.0) const;
+    bool via_clear(const Pt& point, int net) const;
+
+    size_t num_segments() const;
+    size_t num_vias() const { return vias_.size(); }
+
+private:
+    struct Seg {
+        Pt a, b;
+        int net;
+        double half;
+        double clearance;
+    };
+
+    static constexpr double kCell = 2.0;  // SegHash bucket size, mm
+
+    int num_layers_;
+    double trace_half_;
+    double clearance_;
+    double via_radius_;
+    double via_via_gap_;
+    double same_net_via_gap_;
+    std::vector<std::vector<Seg>> segs_;                                 // per layer
+    std::vector<std::unordered_map<uint64_t, std::vector<int>>> hash_;  // per layer
+    std::vector<std::pair<Pt, int>> vias_;
+
+    void add_seg(int layer, const Pt& a, const Pt& b, int net, double half, double clearance);
+    std::vector<int> query(int layer, const Pt& a, const Pt& b, double pad) const;
+};
+
+}  // namespace router
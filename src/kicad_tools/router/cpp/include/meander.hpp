@@ -0,0 +1,104 @@
+/*
+ * Router C++ Core - serpentine (meander) length tuning
+ *
+ * Native counterpart of ``SerpentineGenerator.generate_trombone``
+ * (router/optimizer/serpentine.py) and the single-ended match-group cascade
+ * in ``router/match_group_tuning.py``.  The Python cascade re-checks every
+ * candidate trombone against every route, via and pad on the board; for a
+ * DDR byte lane with dozens of members that post-pass takes minutes.
+ *
+ * ``MeanderTuner::tune_group`` tunes a whole match group in one call:
+ *
+ *   1. the board state -- ``Grid3D`` stored segments / vias and registered
+ *      pads, minus the group's own nets, plus the members' current
+ *      geometry -- is filed in a uniform bucket index once;
+ *   2. members are tuned in parallel.  Each member merges collinear runs,
+ *      ranks host segments (longest, interior, axis-aligned first), and
+ *      tries trombones on them with an amplitude back-off ladder, bulging
+ *      away from the nearest other member.  Every loop count is fitted so
+ *      the member lands on its target length;
+ *   3. tuned members are reconciled in request order: a member whose new
+ *      loops clash with an earlier member's accepted loops is re-tuned
+ *      against them.
+ *
+ * Loops use the same 45-degree-aligned trombone shape as the Python
+ * generator (direction snapped to the 8 routing directions, dogleg exit).
+ * Lengths are planar; via-inclusive targets are resolved by the caller.
+ */
+
+#pragma once
+
+#include "grid.hpp"
+#include "types.hpp"
+
+#include <vector>
+
+namespace router {
+
+enum MeanderStatus : int {
+    MEANDER_TUNED = 0,             // within tolerance of the target
+    MEANDER_WITHIN_TOLERANCE = 1,  // untouched, already matched
+    MEANDER_NO_SEGMENT = 2,        // no segment can host a trombone
+    MEANDER_BLOCKED = 3,           // every candidate trombone clips copper
+    MEANDER_PARTIAL = 4,           // some loops placed, still short
+};
+
+struct MeanderConfig {
+    float amplitude = 1.0f;           // base loop height (mm)
+    float min_spacing = 0.2f;         // loop gap = min_spacing * gap_factor
+    float gap_factor = 2.0f;
+    float min_segment_length = 2.0f;  // host floor (falls back to one loop's span)
+    int max_loops = 20;               // per trombone
+    int max_inserts = 3;              // trombones per member
+    int max_candidates = 3;           // host segments tried per insert
+    std::vector<float> amplitude_backoff{1.0f, 0.5f, 0.25f, 0.125f};
+    float trace_clearance = 0.2f;     // vs foreign segments
+    float via_clearance = 0.2f;       // vs foreign vias; negative skips the via check
+    float pad_clearance = 0.2f;       // vs foreign pads without an override
+    float tolerance = 0.5f;
+};
+
+struct MeanderRequest {
+    int net = 0;
+    std::vector<Segment> segments;  // current route (any order)
+    std::vector<Via> vias;
+    float target_length = 0.0f;     // planar target; <= current means leave as is
+};
+
+struct MeanderResult {
+    int net = 0;
+    int status = MEANDER_WITHIN_TOLERANCE;
+    float length_before = 0.0f;
+    float length_after = 0.0f;
+    int inserts = 0;
+    int loops = 0;
+    std::vector<Segment> segments;  // tuned route (== request when untouched)
+};
+
+class MeanderTuner {
+public:
+    // Holds a reference to ``grid``; its stored routes and pads are the
+    // board the loops must clear.
+    MeanderTuner(const Grid3D& grid, const MeanderConfig& config);
+
+    // One result per request, same order.  ``num_threads`` 0 = hardware
+    // concurrency.
+    std::vector<MeanderResult> tune_group(const std::vector<MeanderRequest>& members,
+                                          int num_threads = 0) const;
+
+    // Trombone replacing ``host`` that adds about ``length_add`` mm,
+    // bulging toward ``side`` (+1 = left of travel, -1 = right, 0 =
+    // alternate).  Empty when the host is too short.
+    std::vector<Segment> trombone(const Segment& host, float length_add, float amplitude,
+                                  int side, float min_host) const;
+
+    static float length(const std::vector<Segment>& segments);
+
+    const MeanderConfig& config() const { return config_; }
+
+private:
+    const Grid3D& grid_;
+    MeanderConfig config_;
+};
+
+}  // namespace router
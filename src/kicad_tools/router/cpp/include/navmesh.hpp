@@ -0,0 +1,182 @@
+/*
+ * Router C++ Core - triangle-dual navmesh for the mesh router
+ *
+ * Native counterpart of ``router/mesh/navmesh.py::NavMesh`` and
+ * ``router/mesh/funnel.py::string_pull`` (mesh-router epic #4267).  The
+ * Python classes build the triangle adjacency, run the portal-midpoint A*
+ * (issue #4268, congestion-aware since #4269), narrow portals by the
+ * committed-copper bands (#4274) and string-pull the corridor over lists of
+ * tuples; on a full board that Python overhead, not the mesh size, is what
+ * keeps the mesh router confined to P1 vertical slices.
+ *
+ * ``NavMesh`` is built once from the poly2tri output (``vertices``,
+ * ``triangles``) into flat arrays:
+ *
+ *   - an edge table (sorted vertex pair, portal midpoint, length) numbered
+ *     in first-seen order, which is the order the Python ``_adj`` lists
+ *     neighbours in, so A* ties break identically;
+ *   - per triangle, its three neighbours and shared-edge ids (the compact
+ *     half-edge twin links; -1 on a constraint/boundary edge);
+ *   - a vertex -> incident-triangle fan and a uniform bucket grid for
+ *     endpoint location.
+ *
+ * ``apply_update`` patches these tables in place after an ``IncrementalCDT``
+ * pour edit (incremental_cdt.hpp), so negotiation state survives the edit.
+ *
+ * Portal occupancy and history live here too, so the Python ``NavMesh``
+ * delegates its negotiation bookkeeping and the whole
+ * A* -> oriented portals -> funnel pipeline (``find_path``) is one native
+ * call.  The clearance-aware octilinear fit stays in Python: it validates
+ * every leg against the per-net obstacle model.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace router {
+
+class NavMesh {
+public:
+    using Pt = std::pair<double, double>;
+    using Edge = std::pair<int, int>;       // sorted vertex-index pair
+    using Portal = std::pair<Pt, Pt>;       // oriented (left, right)
+    using Interval = std::pair<double, double>;
+    using ConsumedBands = std::map<Edge, std::vector<Interval>>;
+
+    // Which residual gap a narrowed portal keeps (``_narrow_portal`` pack).
+    enum class Pack { LARGEST, LEFT, RIGHT };
+
+    // One-call result of ``find_path``: the triangle corridor, the portal
+    // edges it crosses (for occupancy), and the string-pulled geodesic.
+    struct PathResult {
+        std::vector<int> corridor;
+        std::vector<Edge> portals;
+        std::vector<Pt> path;
+    };
+
+    NavMesh(const std::vector<Pt>& vertices,
+            const std::vector<std::array<int, 3>>& triangles,
+            double channel);
+
+    size_t num_vertices() const { return vertices_.size(); }
+    size_t num_triangles() const { return triangles_.size(); }
+    double channel() const { return channel_; }
+
+    // Patch the mesh after an ``IncrementalCDT`` edit: ``vertices`` /
+    // ``triangles`` are the edited mesh, ``changed`` / ``moved`` the edit's
+    // ``Update``.  Only the slots the edit rewrote, the edges they touch and
+    // the triangles on those edges are rebuilt.  Edge ids are stable (new
+    // edges are appended), so occupancy and history carry over on every
+    // portal the edit leaves in place; a portal it destroys reads 0.
+    void apply_update(const std::vector<Pt>& vertices,
+                      const std::vector<std::array<int, 3>>& triangles,
+                      const std::vector<int>& changed,
+                      const std::vector<std::pair<int, int>>& moved);
+
+    // Triangles ``p`` belongs to: the fan of the coincident vertex (within
+    // ``kEps``), else every triangle containing ``p``; ascending order.
+    std::vector<int> locate(const Pt& p) const;
+
+    // Portal capacity / occupancy / history (issue #4269), keyed by the
+    // sorted vertex pair like the Python tables.  Pairs that are not a mesh
+    // edge read as 0 and updates to them are ignored.
+    double edge_length(const Edge& e) const;
+    int capacity(const Edge& e) const;
+    int occupancy(const Edge& e) const;
+    double history(const Edge& e) const;
+    void commit_portal(const Edge& e);
+    void release_portal(const Edge& e);
+    void reset_occupancy();
+    void add_history(const Edge& e, double increment);
+    void clear_history();
+    bool has_history() const { return has_history_; }
+    std::vector<Edge> occupied_portals() const;
+    double portal_penalty(int edge_id, double present_cost_factor,
+                          double cost_congestion, double congestion_threshold) const;
+
+    // Portal-midpoint A* over the triangle dual (``NavMesh.astar``).
+    std::optional<std::vector<int>> astar(const Pt& start, const Pt& goal,
+                                          double present_cost_factor,
+                                          double cost_congestion,
+                                          double congestion_threshold) const;
+
+    std::vector<Edge> corridor_portals(const std::vector<int>& corridor) const;
+
+    // Oriented ``(left, right)`` portal list bracketed by the degenerate
+    // start/goal portals, each narrowed to its residual opening when
+    // ``consumed`` lists bands for it (``corridor_to_portals``).
+    std::vector<Portal> corridor_to_portals(const std::vector<int>& corridor,
+                                            const Pt& start, const Pt& goal,
+                                            const ConsumedBands& consumed,
+                                            Pack pack) const;
+
+    // Simple Stupid Funnel (Mononen string-pull) over oriented portals.
+    static std::vector<Pt> string_pull(const std::vector<Portal>& portals);
+
+    // A* + portals + funnel in one call; nullopt when start and goal are in
+    // disconnected regions (or cannot be located).
+    std::optional<PathResult> find_path(const Pt& start, const Pt& goal,
+                                        double present_cost_factor,
+                                        double cost_congestion,
+                                        double congestion_threshold,
+                                        const ConsumedBands& consumed,
+                                        Pack pack) const;
+
+    // Distances below this (mm) are coincident (``mesh/geometry.py::EPS``).
+    static constexpr double kEps = 1e-9;
+
+private:
+    std::vector<Pt> vertices_;
+    std::vector<std::array<int, 3>> triangles_;
+    double channel_;
+
+    // Edge table, first-seen order.  ``edge_tris_`` holds the (up to two)
+    // incident triangles; a third incidence (non-manifold input) makes the
+    // edge a non-portal, as in Python.  ``apply_update`` keeps edges whose
+    // last triangle left (``edge_count_ == 0``) so ids never shift.
+    std::vector<Edge> edges_;
+    std::vector<Pt> edge_mid_;
+    std::vector<double> edge_len_;
+    std::vector<std::array<int, 2>> edge_tris_;
+    std::vector<int> edge_count_;
+    std::vector<uint8_t> edge_is_portal_;
+    std::unordered_map<uint64_t, int> edge_id_;  // packed (u, v) -> id
+
+    // Per-triangle edge ids (``(a,b), (b,c), (c,a)``) and neighbour links.
+    // The links are ordered by ascending shared-edge id (the Python ``_adj``
+    // order); ``-1`` past the last real neighbour.
+    std::vector<std::array<int, 3>> tri_edges_;
+    std::vector<std::array<int, 3>> tri_nbr_;
+    std::vector<std::array<int, 3>> tri_nbr_edge_;
+    std::vector<Pt> centroids_;
+
+    // Vertex -> incident triangles (ascending).
+    std::vector<std::vector<int>> vtx_tris_;
+
+    // Uniform bucket grid over triangle bounding boxes (ascending per
+    // bucket).  The extent is fixed at construction; later triangles clamp
+    // into the border buckets like out-of-range queries do.
+    double bx0_ = 0.0, by0_ = 0.0, bucket_w_ = 1.0, bucket_h_ = 1.0;
+    int bucket_cols_ = 0, bucket_rows_ = 0;
+    std::vector<std::vector<int>> buckets_;
+
+    std::vector<int> occupancy_;
+    std::vector<double> history_;
+    bool has_history_ = false;
+
+    int edge_index(const Edge& e) const;
+    int shared_edge_id(int t0, int t1) const;
+    int bucket_of(double x, double y) const;
+    void tri_buckets(const std::array<int, 3>& tri, std::vector<int>& out) const;
+    void build_buckets();
+    void link_neighbours(int t);
+};
+
+}  // namespace router
@@ -145,6 +145,40 @@ public:
     // Configure routable layers (skip plane layers)
     void set_routable_layers(const std::vector<int>& layers);
 
+    // Restrict planar moves to a flat ``cols*rows`` cell mask -- the per-net
+    // corridor emitted by the native global router (global_router.hpp).  The
+    // mask must cover both endpoints; an empty mask (or one whose size does
+    // not match the grid) lifts the restriction.
+    void set_search_corridor(const std::vector<uint8_t>& bits);
+    void clear_search_corridor() { search_corridor_.clear(); }
+    bool has_search_corridor() const { return !search_corridor_.empty(); }
+
+    // Multi-resolution A* over the grid's refinement regions (see
+    // ``RefinementRegion`` in grid.hpp): one search over the coarse cells
+    // outside the regions, the fine cells inside them, and the explicit
+    // transition edges between the two.  Endpoints inside a region start /
+    // end on the nearest fine cell, so fine-pitch pads need neither a
+    // separate escape pass nor a board-wide fine grid; the emitted route
+    // runs from the exact start to the exact end coordinates.
+    //
+    // Coarse cells use the standard-mode predicates (``is_trace_blocked`` /
+    // ``is_diagonal_blocked`` / ``is_via_blocked``, no sharing) and the
+    // search corridor; fine cells are free when unblocked or owned by
+    // ``net``, and a fine via needs its via-minus-trace radius free on every
+    // routable layer.  Steps cost ``cost_straight`` per coarse cell length
+    // (fine steps proportionally less), vias ``cost_via``.  Negotiated
+    // costs, diff-pair and pad-bounds options are not modelled -- this is
+    // the fine-pitch access search, the plain ``route`` stays the workhorse.
+    //
+    // ``max_search_iterations <= 0`` caps expansions at 4x the node count.
+    RouteResult route_multires(
+        float start_x, float start_y, int start_layer,
+        float end_x, float end_y, int end_layer,
+        int net,
+        const std::vector<int>& start_layers = {},
+        const std::vector<int>& end_layers = {},
+        int max_search_iterations = 0);
+
     // Statistics from last route
     int get_iterations() const { return last_iterations_; }
     int get_nodes_explored() const { return last_nodes_explored_; }
@@ -348,6 +382,13 @@ private:
     // Routable layer indices
     std::vector<int> routable_layers_;
 
+    // Global-router corridor (empty = unrestricted), see set_search_corridor.
+    std::vector<uint8_t> search_corridor_;
+    inline bool in_search_corridor(int x, int y) const {
+        return search_corridor_.empty() ||
+               search_corridor_[static_cast<size_t>(y) * grid_.cols() + x] != 0;
+    }
+
     // Statistics
     int last_iterations_ = 0;
     int last_nodes_explored_ = 0;
@@ -0,0 +1,265 @@
+/*
+ * RUDY congestion map - shared by router_cpp and placement_cpp
+ *
+ * Native counterpart of ``router/congestion_estimator.py``
+ * (``TileGrid`` + ``CongestionEstimator``, issue #2278).  Each net's HPWL is
+ * spread uniformly over the tiles its pin bounding box covers; the Python
+ * estimator does that with a nested tile loop per net, which is fine once
+ * per routing run but far too slow inside placement fitness evaluation.
+ *
+ * ``RudyMap`` accumulates every net as four corner updates of a 2D
+ * difference array and materialises the demand map with one prefix-sum
+ * pass (O(nets + tiles)); per-net scores (the average demand over the
+ * net's bbox) come from a summed-area table of that map.  Nets are keyed by
+ * id and their pins carry a component id, so moving one component only
+ * re-applies the nets it touches.
+ *
+ * Header-only: placement_cpp adds this include directory and binds its own
+ * subclass (see rudy_bindings.hpp), so both extension modules share one
+ * kernel without sharing a registered Python type.
+ *
+ * Incremental updates subtract and re-add net densities; ``rebuild()``
+ * re-derives the difference array from the stored nets when the caller
+ * wants to shed accumulated rounding after many moves.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace congestion {
+
+// One net pin: its position and the owning component (-1 = fixed).
+struct RudyPin {
+    double x = 0.0;
+    double y = 0.0;
+    int component = -1;
+};
+
+class RudyMap {
+public:
+    RudyMap(double origin_x, double origin_y, double tile_w, double tile_h, int cols, int rows)
+        : origin_x_(origin_x),
+          origin_y_(origin_y),
+          tile_w_(tile_w > 0.0 ? tile_w : 1.0),
+          tile_h_(tile_h > 0.0 ? tile_h : 1.0),
+          cols_(std::max(1, cols)),
+          rows_(std::max(1, rows)),
+          diff_(static_cast<size_t>(cols_ + 1) * (rows_ + 1), 0.0) {}
+
+    int cols() const { return cols_; }
+    int rows() const { return rows_; }
+    double origin_x() const { return origin_x_; }
+    double origin_y() const { return origin_y_; }
+    double tile_w() const { return tile_w_; }
+    double tile_h() const { return tile_h_; }
+    size_t num_nets() const { return nets_.size(); }
+
+    // (col, row) of the tile holding (x, y), clamped like ``TileGrid.tile_at``.
+    std::pair<int, int> tile_at(double x, double y) const {
+        const int col = static_cast<int>((x - origin_x_) / tile_w_);
+        const int row = static_cast<int>((y - origin_y_) / tile_h_);
+        return {std::clamp(col, 0, cols_ - 1), std::clamp(row, 0, rows_ - 1)};
+    }
+
+    // Insert or replace a net.  Nets with fewer than two pins carry no
+    // demand and score 0, like the Python estimator.
+    void set_net(int net, const std::vector<RudyPin>& pins) {
+        auto it = nets_.find(net);
+        if (it != nets_.end()) {
+            apply(it->second, -1.0);
+            unlink(net, it->second);
+        } else {
+            it = nets_.emplace(net, Net{}).first;
+        }
+        Net& n = it->second;
+        n.pins = pins;
+        measure(n);
+        apply(n, 1.0);
+        link(net, n);
+    }
+
+    bool remove_net(int net) {
+        auto it = nets_.find(net);
+        if (it == nets_.end()) return false;
+        apply(it->second, -1.0);
+        unlink(net, it->second);
+        nets_.erase(it);
+        return true;
+    }
+
+    // Translate every pin owned by ``component`` and re-apply only the nets
+    // it belongs to.  Returns the number of nets touched.
+    int move_component(int component, double dx, double dy) {
+        auto cit = component_nets_.find(component);
+        if (cit == component_nets_.end()) return 0;
+        for (int net : cit->second) {
+            Net& n = nets_.at(net);
+            apply(n, -1.0);
+            for (RudyPin& p : n.pins) {
+                if (p.component == component) {
+                    p.x += dx;
+                    p.y += dy;
+                }
+            }
+            measure(n);
+            apply(n, 1.0);
+        }
+        return static_cast<int>(cit->second.size());
+    }
+
+    // Re-derive the difference array from the stored nets.
+    void rebuild() {
+        std::fill(diff_.begin(), diff_.end(), 0.0);
+        for (auto& [id, n] : nets_) apply(n, 1.0);
+    }
+
+    // Row-major ``rows * cols`` demand map.
+    const std::vector<double>& demand() {
+        refresh();
+        return demand_;
+    }
+
+    double tile_demand(int row, int col) {
+        if (row < 0 || row >= rows_ || col < 0 || col >= cols_) return 0.0;
+        refresh();
+        return demand_[static_cast<size_t>(row) * cols_ + col];
+    }
+
+    // Average demand over the net's bbox tiles (0 for unknown or sub-2-pin
+    // nets), ``CongestionEstimator.get_net_congestion_score``.
+    double net_score(int net) {
+        auto it = nets_.find(net);
+        if (it == nets_.end() || !it->second.active) return 0.0;
+        refresh();
+        return score(it->second);
+    }
+
+    // Every net's score, ascending net id.
+    std::vector<std::pair<int, double>> net_scores() {
+        refresh();
+        std::vector<std::pair<int, double>> out;
+        out.reserve(nets_.size());
+        for (const auto& [id, n] : nets_) out.emplace_back(id, n.active ? score(n) : 0.0);
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    double peak() {
+        refresh();
+        double best = 0.0;
+        for (double d : demand_) best = std::max(best, d);
+        return best;
+    }
+
+    // Demand in excess of ``capacity`` per tile, summed over the map.
+    double overflow(double capacity) {
+        refresh();
+        double total = 0.0;
+        for (double d : demand_) total += std::max(0.0, d - capacity);
+        return total;
+    }
+
+private:
+    struct Net {
+        std::vector<RudyPin> pins;
+        bool active = false;
+        int c0 = 0, r0 = 0, c1 = 0, r1 = 0;  // inclusive tile range
+        double density = 0.0;                // HPWL / tile count
+    };
+
+    double origin_x_, origin_y_, tile_w_, tile_h_;
+    int cols_, rows_;
+    std::unordered_map<int, Net> nets_;
+    std::unordered_map<int, std::vector<int>> component_nets_;
+    std::vector<double> diff_;    // (rows + 1) x (cols + 1)
+    std::vector<double> demand_;  // rows x cols
+    std::vector<double> sat_;     // (rows + 1) x (cols + 1) summed-area table
+    bool dirty_ = true;
+
+    size_t d_at(int row, int col) const { return static_cast<size_t>(row) * (cols_ + 1) + col; }
+
+    void measure(Net& n) const {
+        n.active = n.pins.size() >= 2;
+        if (!n.active) return;
+        double min_x = std::numeric_limits<double>::infinity(), max_x = -min_x;
+        double min_y = min_x, max_y = -min_x;
+        for (const RudyPin& p : n.pins) {
+            min_x = std::min(min_x, p.x);
+            max_x = std::max(max_x, p.x);
+            min_y = std::min(min_y, p.y);
+            max_y = std::max(max_y, p.y);
+        }
+        std::tie(n.c0, n.r0) = tile_at(min_x, min_y);
+        std::tie(n.c1, n.r1) = tile_at(max_x, max_y);
+        const int tiles = (n.c1 - n.c0 + 1) * (n.r1 - n.r0 + 1);
+        n.density = ((max_x - min_x) + (max_y - min_y)) / std::max(1, tiles);
+    }
+
+    void apply(const Net& n, double sign) {
+        if (!n.active) return;
+        const double d = sign * n.density;
+        diff_[d_at(n.r0, n.c0)] += d;
+        diff_[d_at(n.r0, n.c1 + 1)] -= d;
+        diff_[d_at(n.r1 + 1, n.c0)] -= d;
+        diff_[d_at(n.r1 + 1, n.c1 + 1)] += d;
+        dirty_ = true;
+    }
+
+    void link(int net, const Net& n) {
+        for (const RudyPin& p : n.pins) {
+            if (p.component < 0) continue;
+            std::vector<int>& list = component_nets_[p.component];
+            if (std::find(list.begin(), list.end(), net) == list.end()) list.push_back(net);
+        }
+    }
+
+    void unlink(int net, const Net& n) {
+        for (const RudyPin& p : n.pins) {
+            auto it = component_nets_.find(p.component);
+            if (it == component_nets_.end()) continue;
+            std::vector<int>& list = it->second;
+            list.erase(std::remove(list.begin(), list.end(), net), list.end());
+            if (list.empty()) component_nets_.erase(it);
+        }
+    }
+
+    void refresh() {
+        if (!dirty_) return;
+        demand_.assign(static_cast<size_t>(rows_) * cols_, 0.0);
+        sat_.assign(static_cast<size_t>(rows_ + 1) * (cols_ + 1), 0.0);
+        // Prefix-sum the difference array into the demand map, then build
+        // the summed-area table of the demand map.
+        std::vector<double> run(static_cast<size_t>(cols_), 0.0);
+        for (int r = 0; r < rows_; ++r) {
+            double acc = 0.0;
+            for (int c = 0; c < cols_; ++c) {
+                acc += diff_[d_at(r, c)];
+                run[c] += acc;
+                demand_[static_cast<size_t>(r) * cols_ + c] = run[c];
+            }
+        }
+        for (int r = 0; r < rows_; ++r) {
+            for (int c = 0; c < cols_; ++c) {
+                sat_[d_at(r + 1, c + 1)] = demand_[static_cast<size_t>(r) * cols_ + c] +
+                                           sat_[d_at(r, c + 1)] + sat_[d_at(r + 1, c)] -
+                                           sat_[d_at(r, c)];
+            }
+        }
+        dirty_ = false;
+    }
+
+    double score(const Net& n) const {
+        const double total = sat_[d_at(n.r1 + 1, n.c1 + 1)] - sat_[d_at(n.r0, n.c1 + 1)] -
+                             sat_[d_at(n.r1 + 1, n.c0)] + sat_[d_at(n.r0, n.c0)];
+        return total / ((n.c1 - n.c0 + 1) * (n.r1 - n.r0 + 1));
+    }
+};
+
+}  // namespace congestion
@@ -0,0 +1,69 @@
+/*
+ * RUDY congestion map - shared nanobind registration
+ *
+ * ``bind_rudy<Map>`` registers a ``RudyMap`` class on a module.  Each
+ * extension instantiates it with its own ``congestion::RudyMap`` subclass
+ * (``router::RudyMap`` / ``placement::RudyMap``): nanobind keys registered
+ * types by C++ type, so two modules binding the same class would collide
+ * when both are imported.
+ */
+
+#pragma once
+
+#include "rudy.hpp"
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/pair.h>
+#include <nanobind/stl/tuple.h>
+#include <nanobind/stl/vector.h>
+#include <tuple>
+#include <vector>
+
+namespace congestion {
+
+// (x, y, component) tuples -> kernel pins.
+inline std::vector<RudyPin> rudy_pins(const std::vector<std::tuple<double, double, int>>& pins) {
+    std::vector<RudyPin> out;
+    out.reserve(pins.size());
+    for (const auto& [x, y, component] : pins) out.push_back({x, y, component});
+    return out;
+}
+
+template <class Map>
+void bind_rudy(nanobind::module_& m) {
+    namespace nb = nanobind;
+    using namespace nb::literals;
+    using Pins = std::vector<std::tuple<double, double, int>>;
+
+    nb::class_<Map>(m, "RudyMap")
+        .def(nb::init<double, double, double, double, int, int>(),
+             "origin_x"_a, "origin_y"_a, "tile_w"_a, "tile_h"_a, "cols"_a, "rows"_a)
+        .def_prop_ro("cols", &Map::cols)
+        .def_prop_ro("rows", &Map::rows)
+        .def_prop_ro("num_nets", &Map::num_nets)
+        .def("tile_at", [](const Map& map, double x, double y) { return map.tile_at(x, y); },
+             "x"_a, "y"_a)
+        .def("set_net",
+             [](Map& map, int net, const Pins& pins) { map.set_net(net, rudy_pins(pins)); },
+             "net"_a, "pins"_a,
+             "Insert or replace a net; ``pins`` are (x, y, component) with "
+             "component -1 for fixed pins.")
+        .def("remove_net", [](Map& map, int net) { return map.remove_net(net); }, "net"_a)
+        .def("move_component",
+             [](Map& map, int component, double dx, double dy) {
+                 return map.move_component(component, dx, dy);
+             },
+             "component"_a, "dx"_a, "dy"_a,
+             "Translate a component's pins; only its nets are re-applied.")
+        .def("rebuild", [](Map& map) { map.rebuild(); })
+        .def("demand", [](Map& map) { return map.demand(); },
+             "Row-major rows*cols demand map.")
+        .def("tile_demand", [](Map& map, int row, int col) { return map.tile_demand(row, col); },
+             "row"_a, "col"_a)
+        .def("net_score", [](Map& map, int net) { return map.net_score(net); }, "net"_a)
+        .def("net_scores", [](Map& map) { return map.net_scores(); })
+        .def("peak", [](Map& map) { return map.peak(); })
+        .def("overflow", [](Map& map, double capacity) { return map.overflow(capacity); },
+             "capacity"_a);
+}
+
+}  // namespace congestion
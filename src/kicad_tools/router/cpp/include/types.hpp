@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <vector>
@@ -179,7 +180,73 @@ namespace router {
 // crossing net onto its inner-layer channel while leaving the mandatory
 // crossings legal.  Old .so files lack ``reserved_soft`` and the new
 // ``reserve_cell`` signature; the version bump forces a rebuild.
-constexpr int ROUTER_CPP_BUILD_VERSION = 17;
+// Version 18: native blocker identification.  ``Grid3D`` gains
+// ``collect_blocking_nets`` (circular-kernel walk over a failed net's direct
+// line or relaxed route, returning per-net conflict-cell counts), replacing
+// the quadruple-nested Python loops in ``CppPathfinder.find_blocking_nets``
+// / ``find_blocking_nets_relaxed``.  Old .so files lack the method; the
+// version bump forces a rebuild.
+// Version 19: dense joint-state tables for ``CoupledPathfinder``.  The
+// closed set / g-scores move to a generation-stamped open-addressing table
+// over packed 64-bit joint keys, the per-pop trail sets become per-cell
+// stamp arrays, and ``CoupledRouteResult::rejections`` becomes a fixed
+// per-reason array (still surfaced to Python as a ``reason -> count``
+// dict).  Old .so files expose the map-typed field; the version bump forces
+// a rebuild.
+// Version 20: opt-in goal-distance heuristic for ``CoupledPathfinder``
+// (backward single-trace Dijkstra per head, bounded by the corridor bitset;
+// ``distance_heuristic`` property) and the ``unreachable`` rejection reason.
+// Old .so files lack the property; the version bump forces a rebuild.
+// Version 21: the v1-deferred coupled features are native.
+// ``CoupledPathfinder`` gains the ``allow_swap_via`` (Issue #2473
+// polarity-swap move) and ``heuristic_mode`` (Issue #3115
+// ``manhattan_sum``) properties, so diff pairs no longer need the
+// pure-Python search.  Old .so files lack the properties; the version bump
+// forces a rebuild.
+// Version 22: ``CoupledPathfinder::route_batch`` routes several pairs on a
+// worker pool against the shared (read-only) ``Grid3D`` and commits them in
+// priority order; new ``CoupledPairRequest`` / ``CoupledBatchResult``
+// structs.  Old .so files lack the method; the version bump forces a
+// rebuild.
+// Version 23: native mesh-router navmesh.  ``NavMesh`` (navmesh.hpp) runs
+// the triangle-dual A*, portal narrowing and the funnel string-pull that
+// ``router/mesh/navmesh.py`` delegates to.  Old .so files lack the class;
+// the version bump forces a rebuild.
+// Version 24: ``IncrementalCDT`` / ``CdtUpdate`` (incremental_cdt.hpp) let
+// ``MeshPathfinder`` add and remove pour holes by re-triangulating only the
+// touched cavity.  Old .so files lack the classes; the version bump forces a
+// rebuild.
+// Version 25: native octilinear lattice.  ``OctilinearLattice`` /
+// ``RefineRegion`` / ``LatticeCopper`` (lattice.hpp) build the balanced
+// quadtree, its pad masks and run the lattice A* for ``router/lattice``.
+// Old .so files lack the classes; the version bump forces a rebuild.
+// Version 26: native global router.  ``GlobalRouter`` / ``GlobalNetRequest``
+// / ``GlobalRouteResult`` (global_router.hpp) plan per-net corridors over the
+// grid's congestion tiles, and ``Pathfinder.set_search_corridor`` consumes
+// them.  Old .so files lack both; the version bump forces a rebuild.
+// Version 27: ``RudyMap`` (rudy.hpp), the RUDY congestion kernel shared with
+// placement_cpp.  Old .so files lack the class; the version bump forces a
+// rebuild.
+// Version 28: ``build_rsmt`` / ``SteinerBuilder`` (steiner.hpp), native
+// rectilinear Steiner trees.  Old .so files lack them; the version bump
+// forces a rebuild.
+// Version 29: ``SparseGraph`` (sparse_graph.hpp), native sparse
+// clearance-contour routing graph.  Old .so files lack it; the version bump
+// forces a rebuild.
+// Version 30: ``Grid3D.add_refinement`` (grid.hpp) refinement regions and
+// ``Pathfinder.route_multires``.  Old .so files lack them; the version bump
+// forces a rebuild.
+// Version 31: ``EscapePlanner`` (escape.hpp) package fanout planner.  Old .so
+// files lack it; the version bump forces a rebuild.
+// Version 32: ``MeanderTuner`` (meander.hpp) match-group serpentine tuning.
+// Old .so files lack it; the version bump forces a rebuild.
+// Version 33: ``ESCAPE_STAGGERED`` removed; ``ESCAPE_ALTERNATING`` is now 1.
+// Version 34: ``build_rsmt_all`` (steiner.hpp), gridless batched Steiner
+// trees.  Old .so files lack it; the version bump forces a rebuild.
+// Version 35: ``NavMesh`` (navmesh.hpp) rejects out-of-range vertex and
+// triangle indices.  Old .so files lack the check; the version bump forces a
+// rebuild.
+constexpr int ROUTER_CPP_BUILD_VERSION = 35;
 
 // Issue #4071: fixed-capacity owner-set size for per-cell corridor
 // reservations.  Observed owner sets in practice are tiny: 1 for the
@@ -362,6 +429,50 @@ struct CoupledPathNode {
     bool via_from_parent;
 };
 
+// Coupled diff-pair move-rejection reasons (Issue #4459).
+//
+// One enumerator per guard in the coupled joint-state loop.  The names
+// returned by ``coupled_rejection_name`` are the ``last_rejections`` keys
+// the pure-Python coupled loop uses (diffpair_routing.py), so the two
+// backends report the same taxonomy; the via-guard keys are the C++ path's
+// superset.  Append new reasons before ``COUPLED_REJECTION_COUNT``.
+enum CoupledRejection : int {
+    REJ_SYM_BLOCKED_P = 0,
+    REJ_SYM_BLOCKED_N,
+    REJ_SYM_SPACING,
+    REJ_SYM_FLOOR,
+    REJ_SYM_TRAIL,
+    REJ_ASYM_BLOCKED_P,
+    REJ_ASYM_SPACING_P,
+    REJ_ASYM_FLOOR_P,
+    REJ_ASYM_TRAIL_P,
+    REJ_ASYM_BLOCKED_N,
+    REJ_ASYM_SPACING_N,
+    REJ_ASYM_FLOOR_N,
+    REJ_ASYM_TRAIL_N,
+    REJ_VIA_BLOCKED_P,
+    REJ_VIA_BLOCKED_N,
+    REJ_VIA_TRACE_BLOCKED_P,
+    REJ_VIA_TRACE_BLOCKED_N,
+    REJ_CORRIDOR,
+    // Opt-in distance heuristic: a head cannot reach its goal at all.
+    REJ_UNREACHABLE,
+    COUPLED_REJECTION_COUNT
+};
+
+inline const char* coupled_rejection_name(int reason) {
+    static constexpr const char* kNames[COUPLED_REJECTION_COUNT] = {
+        "sym_blocked_p",  "sym_blocked_n",  "sym_spacing",
+        "sym_floor",      "sym_trail",      "asym_blocked_p",
+        "asym_spacing_p", "asym_floor_p",   "asym_trail_p",
+        "asym_blocked_n", "asym_spacing_n", "asym_floor_n",
+        "asym_trail_n",   "via_blocked_p",  "via_blocked_n",
+        "via_trace_blocked_p", "via_trace_blocked_n", "corridor",
+        "unreachable",
+    };
+    return (reason >= 0 && reason < COUPLED_REJECTION_COUNT) ? kNames[reason] : "";
+}
+
 // Coupled diff-pair A* result (Issue #4065).
 //
 // Mirrors the pure-Python ``CoupledPathfinder.route_coupled`` return value
@@ -388,6 +499,11 @@ struct CoupledPathNode {
 //                           triaged (plateau vs no-progress vs off-angle vs
 //                           infeasible-gap) instead of reading the old
 //                           categorically-empty dict on the C++ path.
+//                           Counted into a fixed per-reason array indexed by
+//                           ``CoupledRejection``; the string keys are only
+//                           materialised at the binding boundary (the hot
+//                           loop used to hash a ``std::string`` per pruned
+//                           candidate).
 struct CoupledRouteResult {
     std::vector<CoupledPathNode> path;  // root->goal; empty when !success.
     bool success = false;
@@ -396,9 +512,52 @@ struct CoupledRouteResult {
     double best_progress = -1.0;
     bool timeout_exceeded = false;
     bool iteration_limited = false;
-    // Issue #4459: rejection histogram (reason -> count).  Empty only when the
-    // search popped no neighbours at all (e.g. the start state is the goal).
-    std::unordered_map<std::string, int64_t> rejections;
+    // Issue #4459: rejection histogram, one counter per ``CoupledRejection``.
+    // The bindings convert it to the ``reason -> count`` dict (non-zero
+    // reasons only), so the dict is empty only when the search popped no
+    // neighbours at all (e.g. the start state is the goal).
+    std::array<int64_t, COUPLED_REJECTION_COUNT> rejections{};
+};
+
+// One pair of a ``CoupledPathfinder::route_batch`` call: the ``route()``
+// arguments (grid coordinates, same meaning) plus the commit ``priority``.
+// Lower priority values commit first, the ``Autorouter._get_net_priority``
+// convention; ties commit in request order.
+struct CoupledPairRequest {
+    int p_start_x = 0, p_start_y = 0;
+    int n_start_x = 0, n_start_y = 0;
+    int start_layer = 0;
+    int p_goal_x = 0, p_goal_y = 0;
+    int n_goal_x = 0, n_goal_y = 0;
+    int end_layer = 0;
+    int p_net = 0, n_net = 0;
+    int effective_target_spacing = 0;
+    int effective_approach_radius = 0;
+    int effective_departure_radius = 0;
+    std::vector<int> routable_layers;
+    std::vector<uint8_t> corridor_bitset;
+    int max_iterations_budget = 0;
+    double timeout_seconds = 0.0;
+    int priority = 0;
+};
+
+// Result of ``CoupledPathfinder::route_batch``.  Per-request vectors are in
+// REQUEST order.
+//   results      -- the final search of each pair.  A pair that still
+//                   conflicted when the round limit ran out reports
+//                   ``success == false`` with an empty path.
+//   committed    -- 1 iff the pair's path was committed to the batch.
+//   requeues     -- how often the pair was re-searched because its path
+//                   crossed the clearance envelope of a pair committed
+//                   ahead of it.
+//   commit_order -- request indices in the order their paths committed.
+//   rounds       -- search rounds run (1 when nothing was re-queued).
+struct CoupledBatchResult {
+    std::vector<CoupledRouteResult> results;
+    std::vector<uint8_t> committed;
+    std::vector<int> requeues;
+    std::vector<int> commit_order;
+    int rounds = 0;
 };
 
 // Neighbor direction: dx, dy, dlayer, cost_multiplier
@@ -7,6 +7,13 @@
 #include "geometry.hpp"
 #include "pathfinder.hpp"
 #include "coupled_pathfinder.hpp"
+#include "escape.hpp"
+#include "global_router.hpp"
+#include "lattice.hpp"
+#include "meander.hpp"
+#include "rudy_bindings.hpp"
+#include "sparse_graph.hpp"
+#include "steiner.hpp"
 #include "types.hpp"
 #include <nanobind/nanobind.h>
 #include <nanobind/stl/vector.h>
@@ -15,6 +22,9 @@
 #include <nanobind/stl/optional.h>
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/unordered_map.h>
+#include <nanobind/stl/array.h>
+#include <nanobind/stl/function.h>
+#include <nanobind/ndarray.h>
 
 namespace nb = nanobind;
 using namespace nb::literals;
@@ -25,6 +35,21 @@ using namespace router;
 // the vendored poly2tri headers stay out of the main bindings compile.
 void register_mesh(nb::module_& m);
 
+// ``None`` -> the board-global geometry, which ``LatticeCopper`` spells as a
+// negative value (issue #4271 ``CommittedCopper._own``).
+static double unset_as_default(const std::optional<double>& v)
+{
+    return v ? *v : -1.0;
+}
+
+namespace router {
+// The shared RUDY kernel under this module's own C++ type (rudy_bindings.hpp).
+class RudyMap : public congestion::RudyMap {
+public:
+    using congestion::RudyMap::RudyMap;
+};
+}  // namespace router
+
 NB_MODULE(router_cpp, m) {
     m.doc() = "C++ router core for high-performance PCB routing";
 
@@ -233,6 +258,48 @@ NB_MODULE(router_cpp, m) {
              "x"_a, "y"_a, "layer"_a, "present_factor"_a, "net"_a = 0)
         .def("update_history_costs", &Grid3D::update_history_costs, "increment"_a)
         .def("get_total_overflow", &Grid3D::get_total_overflow)
+        // Native blocker identification for targeted rip-up (replaces the
+        // Python cell walks in ``CppPathfinder.find_blocking_nets`` /
+        // ``find_blocking_nets_relaxed``).  ``saved_blocked`` / ``saved_net``
+        // are the optional pre-unblock numpy snapshots (bool / int32,
+        // ``layers x rows x cols``) read zero-copy in place of the live
+        // cells.  Returns ``[(net, conflict_cell_count), ...]`` sorted by net.
+        .def("collect_blocking_nets",
+             [](const Grid3D& self,
+                const std::vector<std::tuple<int, int, int, int, int>>& segments,
+                const std::vector<std::pair<int, int>>& via_cells,
+                int radius, bool relaxed, int source_net, int partner_net,
+                std::optional<nb::ndarray<const bool, nb::ndim<3>, nb::c_contig,
+                                          nb::device::cpu>> saved_blocked,
+                std::optional<nb::ndarray<const int32_t, nb::ndim<3>, nb::c_contig,
+                                          nb::device::cpu>> saved_net) {
+                 auto check_shape = [&](size_t d0, size_t d1, size_t d2) {
+                     if (d0 != static_cast<size_t>(self.layers()) ||
+                         d1 != static_cast<size_t>(self.rows()) ||
+                         d2 != static_cast<size_t>(self.cols())) {
+                         throw nb::value_error(
+                             "saved arrays must have shape (layers, rows, cols)");
+                     }
+                 };
+                 const bool* blocked_ptr = nullptr;
+                 const int32_t* net_ptr = nullptr;
+                 if (saved_blocked) {
+                     check_shape(saved_blocked->shape(0), saved_blocked->shape(1),
+                                 saved_blocked->shape(2));
+                     blocked_ptr = saved_blocked->data();
+                 }
+                 if (saved_net) {
+                     check_shape(saved_net->shape(0), saved_net->shape(1),
+                                 saved_net->shape(2));
+                     net_ptr = saved_net->data();
+                 }
+                 return self.collect_blocking_nets(
+                     segments, via_cells, radius, relaxed, source_net,
+                     partner_net, blocked_ptr, net_ptr);
+             },
+             "segments"_a, "via_cells"_a, "radius"_a, "relaxed"_a,
+             "source_net"_a, "partner_net"_a = -1,
+             "saved_blocked"_a = nb::none(), "saved_net"_a = nb::none())
         // Properties
         .def_prop_ro("cols", &Grid3D::cols)
         .def_prop_ro("rows", &Grid3D::rows)
@@ -269,7 +336,44 @@ NB_MODULE(router_cpp, m) {
              "of trace_clearance (defaults preserve pre-#2559 behavior).")
         .def_prop_ro("pad_count", &Grid3D::pad_count)
         .def_prop_ro("stored_segment_count", &Grid3D::stored_segment_count)
-        .def_prop_ro("stored_via_count", &Grid3D::stored_via_count);
+        .def_prop_ro("stored_via_count", &Grid3D::stored_via_count)
+        // Refinement regions (multi-resolution search, see route_multires).
+        .def("add_refinement", &Grid3D::add_refinement,
+             "x0"_a, "y0"_a, "x1"_a, "y1"_a, "factor"_a,
+             "trace_half_width"_a, "clearance"_a,
+             "Refine coarse cells [x0, x1] x [y0, y1] by ``factor`` and "
+             "rasterize them from the registered pads / stored routes.  "
+             "Regions must not overlap.  Returns the region index.")
+        .def("clear_refinements", &Grid3D::clear_refinements)
+        .def("refresh_refinements", &Grid3D::refresh_refinements)
+        .def_prop_ro("num_refinements", &Grid3D::num_refinements)
+        .def("refinement", &Grid3D::refinement, "region"_a,
+             nb::rv_policy::reference_internal)
+        .def("refinement_at", &Grid3D::refinement_at, "x"_a, "y"_a)
+        .def("fine_cell",
+             [](const Grid3D& self, int region, int fx, int fy, int layer) {
+                 const RefinementRegion& r = self.refinement(region);
+                 if (fx < 0 || fx >= r.cols || fy < 0 || fy >= r.rows ||
+                     layer < 0 || layer >= self.layers()) {
+                     throw nb::index_error("fine cell out of range");
+                 }
+                 return self.fine_at(region, fx, fy, layer);
+             },
+             "region"_a, "fx"_a, "fy"_a, "layer"_a)
+        .def("fine_to_world", &Grid3D::fine_to_world, "region"_a, "fx"_a, "fy"_a)
+        .def("world_to_fine", &Grid3D::world_to_fine, "region"_a, "x"_a, "y"_a);
+
+    nb::class_<RefinementRegion>(m, "RefinementRegion")
+        .def_ro("x0", &RefinementRegion::x0)
+        .def_ro("y0", &RefinementRegion::y0)
+        .def_ro("x1", &RefinementRegion::x1)
+        .def_ro("y1", &RefinementRegion::y1)
+        .def_ro("factor", &RefinementRegion::factor)
+        .def_ro("cols", &RefinementRegion::cols)
+        .def_ro("rows", &RefinementRegion::rows)
+        .def_ro("resolution", &RefinementRegion::resolution)
+        .def_prop_ro("num_transitions",
+                     [](const RefinementRegion& r) { return r.transitions.size(); });
 
     // Pathfinder class
     nb::class_<Pathfinder>(m, "Pathfinder")
@@ -428,6 +532,11 @@ NB_MODULE(router_cpp, m) {
              "reject_x"_a, "reject_y"_a, "reject_layer"_a)
         .def("clear_search_state", &Pathfinder::clear_search_state)
         .def("set_routable_layers", &Pathfinder::set_routable_layers, "layers"_a)
+        .def("set_search_corridor", &Pathfinder::set_search_corridor, "bits"_a,
+             "Restrict planar moves to a flat cols*rows cell mask (a "
+             "GlobalRouter corridor); an empty mask lifts the restriction.")
+        .def("clear_search_corridor", &Pathfinder::clear_search_corridor)
+        .def_prop_ro("has_search_corridor", &Pathfinder::has_search_corridor)
         .def("is_via_blocked", &Pathfinder::is_via_blocked,
              "x"_a, "y"_a, "net"_a, "allow_sharing"_a, "radius_override"_a = 0,
              "Check if a via placement at (x, y) is blocked. "
@@ -465,6 +574,17 @@ NB_MODULE(router_cpp, m) {
              "zero-overflow hard failure can produce a min-conflict probe "
              "path whose crossed owner nets feed the targeted rip-up.")
         .def_prop_ro("relief_mode", &Pathfinder::relief_mode)
+        // GIL released: pure C++ search over the grid and its regions.
+        .def("route_multires", &Pathfinder::route_multires,
+             "start_x"_a, "start_y"_a, "start_layer"_a,
+             "end_x"_a, "end_y"_a, "end_layer"_a,
+             "net"_a,
+             "start_layers"_a = std::vector<int>{},
+             "end_layers"_a = std::vector<int>{},
+             "max_search_iterations"_a = 0,
+             nb::call_guard<nb::gil_scoped_release>(),
+             "One A* over coarse cells and the Grid3D refinement regions, "
+             "crossing between them on the regions' transition edges.")
         .def_prop_ro("iterations", &Pathfinder::get_iterations)
         .def_prop_ro("nodes_explored", &Pathfinder::get_nodes_explored);
 
@@ -496,12 +616,58 @@ NB_MODULE(router_cpp, m) {
         .def_ro("timeout_exceeded", &CoupledRouteResult::timeout_exceeded)
         .def_ro("iteration_limited", &CoupledRouteResult::iteration_limited)
         // Issue #4459: per-reason move-rejection histogram (reason -> count).
-        .def_ro("rejections", &CoupledRouteResult::rejections);
+        // The C++ side counts into a fixed per-reason array; the string-keyed
+        // dict (non-zero reasons only, matching the Python loop's
+        // ``last_rejections``) is built here, once per result.
+        .def_prop_ro("rejections", [](const CoupledRouteResult& r) {
+            nb::dict out;
+            for (int i = 0; i < COUPLED_REJECTION_COUNT; ++i) {
+                if (r.rejections[i] != 0) {
+                    out[coupled_rejection_name(i)] = r.rejections[i];
+                }
+            }
+            return out;
+        });
+
+    // CoupledPairRequest / CoupledBatchResult: the ``route_batch`` request
+    // (the ``route()`` arguments plus a commit priority) and its per-request
+    // outcome.
+    nb::class_<CoupledPairRequest>(m, "CoupledPairRequest")
+        .def(nb::init<>())
+        .def_rw("p_start_x", &CoupledPairRequest::p_start_x)
+        .def_rw("p_start_y", &CoupledPairRequest::p_start_y)
+        .def_rw("n_start_x", &CoupledPairRequest::n_start_x)
+        .def_rw("n_start_y", &CoupledPairRequest::n_start_y)
+        .def_rw("start_layer", &CoupledPairRequest::start_layer)
+        .def_rw("p_goal_x", &CoupledPairRequest::p_goal_x)
+        .def_rw("p_goal_y", &CoupledPairRequest::p_goal_y)
+        .def_rw("n_goal_x", &CoupledPairRequest::n_goal_x)
+        .def_rw("n_goal_y", &CoupledPairRequest::n_goal_y)
+        .def_rw("end_layer", &CoupledPairRequest::end_layer)
+        .def_rw("p_net", &CoupledPairRequest::p_net)
+        .def_rw("n_net", &CoupledPairRequest::n_net)
+        .def_rw("effective_target_spacing", &CoupledPairRequest::effective_target_spacing)
+        .def_rw("effective_approach_radius", &CoupledPairRequest::effective_approach_radius)
+        .def_rw("effective_departure_radius", &CoupledPairRequest::effective_departure_radius)
+        .def_rw("routable_layers", &CoupledPairRequest::routable_layers)
+        .def_rw("corridor_bitset", &CoupledPairRequest::corridor_bitset)
+        .def_rw("max_iterations_budget", &CoupledPairRequest::max_iterations_budget)
+        .def_rw("timeout_seconds", &CoupledPairRequest::timeout_seconds)
+        .def_rw("priority", &CoupledPairRequest::priority);
+
+    nb::class_<CoupledBatchResult>(m, "CoupledBatchResult")
+        .def(nb::init<>())
+        .def_ro("results", &CoupledBatchResult::results)
+        .def_ro("committed", &CoupledBatchResult::committed)
+        .def_ro("requeues", &CoupledBatchResult::requeues)
+        .def_ro("commit_order", &CoupledBatchResult::commit_order)
+        .def_ro("rounds", &CoupledBatchResult::rounds);
 
     // CoupledPathfinder class (Issue #4065): C++ port of the joint-state
     // diff-pair A* loop.  Consumes the SAME Grid3D as the single-ended
-    // Pathfinder.  See coupled_pathfinder.hpp for the v1 scope / deferred
-    // features (allow_swap_via, manhattan_sum heuristic).  Issue #4459 wired
+    // Pathfinder.  See coupled_pathfinder.hpp for the scope; the v1-deferred
+    // ``allow_swap_via`` move and ``manhattan_sum`` heuristic are exposed as
+    // properties (defaults match the Python constructor).  Issue #4459 wired
     // the string-keyed rejection histogram out of the C++ search (previously
     // Python-only), surfaced on ``CoupledRouteResult::rejections``.
     nb::class_<CoupledPathfinder>(m, "CoupledPathfinder")
@@ -525,7 +691,46 @@ NB_MODULE(router_cpp, m) {
              "effective_target_spacing"_a, "effective_approach_radius"_a,
              "effective_departure_radius"_a,
              "routable_layers"_a, "corridor_bitset"_a,
-             "max_iterations_budget"_a, "timeout_seconds"_a);
+             "max_iterations_budget"_a, "timeout_seconds"_a)
+        // Runs with the GIL released: the requests are converted before
+        // and the result after the call.  The worker threads only read the
+        // Grid3D, so the caller must not mutate it concurrently.
+        .def("route_batch", &CoupledPathfinder::route_batch,
+             "requests"_a, "num_threads"_a = 0, "max_rounds"_a = 0,
+             nb::call_guard<nb::gil_scoped_release>(),
+             "Route several pairs concurrently and commit them in priority "
+             "order; pairs whose path conflicts with an earlier commit are "
+             "re-searched around it.")
+        .def_prop_rw("distance_heuristic",
+             &CoupledPathfinder::distance_heuristic,
+             &CoupledPathfinder::set_distance_heuristic,
+             "Opt-in goal-distance heuristic.  When enabled, each route() "
+             "runs a backward single-trace Dijkstra per head from its goal "
+             "(bounded by the corridor bitset) and tightens the partner_aware "
+             "heuristic with the resulting cost-to-goal; joint states whose "
+             "head cannot reach its goal are pruned as 'unreachable'.")
+        .def_prop_rw("allow_swap_via",
+             &CoupledPathfinder::allow_swap_via,
+             &CoupledPathfinder::set_allow_swap_via,
+             "Issue #2473: allow the polarity-swap via move (both heads "
+             "re-emerge on another layer with their positions exchanged).")
+        .def_prop_rw("heuristic_mode",
+             [](const CoupledPathfinder& pf) -> std::string {
+                 return pf.heuristic_mode() == CoupledPathfinder::HeuristicMode::MANHATTAN_SUM
+                            ? "manhattan_sum" : "partner_aware";
+             },
+             [](CoupledPathfinder& pf, const std::string& mode) {
+                 if (mode == "partner_aware") {
+                     pf.set_heuristic_mode(CoupledPathfinder::HeuristicMode::PARTNER_AWARE);
+                 } else if (mode == "manhattan_sum") {
+                     pf.set_heuristic_mode(CoupledPathfinder::HeuristicMode::MANHATTAN_SUM);
+                 } else {
+                     throw nb::value_error(
+                         "heuristic_mode must be 'manhattan_sum' or 'partner_aware'");
+                 }
+             },
+             "Issue #3115: 'partner_aware' (default) or the legacy "
+             "'manhattan_sum' heuristic.");
 
     // Geometry functions (Issue #2439)
     m.def("fnv1a_hash", [](const std::string& s) -> uint32_t {
@@ -565,4 +770,398 @@ NB_MODULE(router_cpp, m) {
     // Issue #4268: poly2tri constrained-Delaunay mesh binding for the
     // mesh-router navigation substrate.
     register_mesh(m);
+
+    // Issue #4278: balanced-quadtree octilinear lattice, its static pad
+    // masks, the committed-copper model and the single-agent lattice A*
+    // (native twins of router/lattice/{quadtree,obstacles}.py).
+    nb::class_<RefineRegion>(m, "RefineRegion")
+        .def("__init__",
+             [](RefineRegion* r, const std::array<double, 4>& rect, double fine) {
+                 new (r) RefineRegion{rect, fine};
+             },
+             "rect"_a, "fine"_a)
+        .def_ro("rect", &RefineRegion::rect)
+        .def_ro("fine", &RefineRegion::fine)
+        .def("level_for", &RefineRegion::level_for, "coarse"_a);
+
+    nb::class_<LatticeCopper>(m, "LatticeCopper")
+        .def(nb::init<int, double, double, double, double, double>(),
+             "num_layers"_a, "trace_half"_a, "clearance"_a, "via_radius"_a,
+             "via_via_gap"_a, "same_net_via_gap"_a)
+        .def("add_run",
+             [](LatticeCopper& c, int layer, const std::vector<LatticeCopper::Pt>& points,
+                   int net, double half_width, std::optional<double> clearance) {
+                 c.add_run(layer, points, net, half_width, unset_as_default(clearance));
+             },
+             "layer"_a, "points"_a, "net"_a, "half_width"_a, "clearance"_a = nb::none())
+        .def("add_run_widths",
+             [](LatticeCopper& c, int layer, const std::vector<LatticeCopper::Pt>& points,
+                   int net, const std::vector<double>& seg_halves,
+                   std::optional<double> clearance) {
+                 c.add_run_widths(layer, points, net, seg_halves, unset_as_default(clearance));
+             },
+             "layer"_a, "points"_a, "net"_a, "seg_halves"_a, "clearance"_a = nb::none())
+        .def("add_via", &LatticeCopper::add_via, "point"_a, "net"_a)
+        .def("seg_clear",
+             [](const LatticeCopper& c, const LatticeCopper::Pt& a, const LatticeCopper::Pt& b,
+                   int layer, int net, std::optional<double> half,
+                   std::optional<double> clearance) {
+                 return c.seg_clear(a, b, layer, net, unset_as_default(half), unset_as_default(clearance));
+             },
+             "a"_a, "b"_a, "layer"_a, "net"_a, "half"_a = nb::none(),
+             "clearance"_a = nb::none())
+        .def("node_clear",
+             [](const LatticeCopper& c, const LatticeCopper::Pt& point, int layer, int net,
+                   std::optional<double> half, std::optional<double> clearance) {
+                 return c.node_clear(point, layer, net, unset_as_default(half), unset_as_default(clearance));
+             },
+             "point"_a, "layer"_a, "net"_a, "half"_a = nb::none(), "clearance"_a = nb::none())
+        .def("via_clear", &LatticeCopper::via_clear, "point"_a, "net"_a)
+        .def_prop_ro("num_segments", &LatticeCopper::num_segments)
+        .def_prop_ro("num_vias", &LatticeCopper::num_vias);
+
+    using Lattice = router::OctilinearLattice;
+    using Terminals = std::vector<std::tuple<int, int, double>>;
+    nb::class_<Lattice>(m, "OctilinearLattice")
+        .def(nb::init<const Lattice::Rect&, const std::vector<RefineRegion>&, double>(),
+             "bbox"_a, "refine_regions"_a, "coarse"_a = 3.2)
+        .def_prop_ro("coarse", &Lattice::coarse)
+        .def_prop_ro("fine", &Lattice::fine)
+        .def_prop_ro("unit", &Lattice::unit)
+        .def_prop_ro("max_level", &Lattice::max_level)
+        .def_prop_ro("nx", &Lattice::nx)
+        .def_prop_ro("ny", &Lattice::ny)
+        .def_prop_ro("origin", &Lattice::origin)
+        .def_prop_ro("num_nodes", &Lattice::num_nodes)
+        .def_prop_ro("num_edges", &Lattice::num_edges)
+        .def("leaves", &Lattice::leaves)
+        .def("neighbor_max_level",
+             [](const Lattice& l, int level, int i, int j, const std::string& direction) {
+                 if (direction.size() != 1 || std::string("EWNS").find(direction) == std::string::npos) {
+                     throw nb::value_error("direction must be one of 'E', 'W', 'N', 'S'");
+                 }
+                 return l.neighbor_max_level(level, i, j, direction[0]);
+             },
+             "level"_a, "i"_a, "j"_a, "direction"_a)
+        .def("node_keys", &Lattice::node_keys)
+        .def("edges", &Lattice::edges)
+        .def("edge_lengths", &Lattice::edge_lengths)
+        .def("node_index", &Lattice::node_index, "key"_a)
+        .def("node_key", [](const Lattice& l, int node) { return l.node_keys().at(node); },
+             "node"_a)
+        .def("edge_index", &Lattice::edge_index, "a"_a, "b"_a)
+        .def("nodes_within",
+             [](const Lattice& l, const Lattice::Pt& p, double radius) {
+                 std::vector<std::tuple<double, Lattice::Key, Lattice::Pt>> out;
+                 for (const auto& [d, node] : l.nodes_within(p, radius)) {
+                     const auto& key = l.node_keys()[node];
+                     out.emplace_back(d, key, l.node_point(key));
+                 }
+                 return out;
+             },
+             "p"_a, "radius"_a,
+             "(distance, key, point) of every node within ``radius`` of ``p``, "
+             "ascending.")
+        .def("node_point", nb::overload_cast<const Lattice::Key&>(&Lattice::node_point, nb::const_),
+             "key"_a)
+        .def("set_pads", &Lattice::set_pads,
+             "rects"_a, "nets"_a, "layers"_a, "num_layers"_a)
+        .def("node_pad_pairs", &Lattice::node_pad_pairs)
+        .def("edge_pad_pairs", &Lattice::edge_pad_pairs)
+        .def("node_blocked", &Lattice::node_blocked, "node"_a, "layer"_a, "net"_a)
+        .def("edge_blocked", &Lattice::edge_blocked, "edge"_a, "layer"_a, "net"_a)
+        .def("segment_blocked", &Lattice::segment_blocked,
+             "a"_a, "b"_a, "layer"_a, "net"_a, "extra"_a = 0.0)
+        .def("astar",
+             [](const Lattice& l, const Terminals& starts, const Terminals& goals,
+                const Lattice::Pt& end_pt, int net, double half, double clearance,
+                double extra, const LatticeCopper& committed, const Terminals& edge_history,
+                const std::vector<std::pair<int, double>>& via_history, double present,
+                bool allow_vias, int num_layers, double via_cost,
+                const std::function<bool(int)>& via_ok)
+                 -> std::optional<std::tuple<std::vector<int>, std::vector<int>,
+                                             std::vector<std::string>>> {
+                 Lattice::Search q;
+                 for (const auto& [node, layer, length] : starts) {
+                     q.starts.push_back({node, layer, length});
+                 }
+                 for (const auto& [node, layer, length] : goals) {
+                     q.goals.push_back({node, layer, length});
+                 }
+                 q.end_pt = end_pt;
+                 q.net = net;
+                 q.half = half;
+                 q.clearance = clearance;
+                 q.extra = extra;
+                 q.present = present;
+                 for (const auto& [edge, layer, value] : edge_history) {
+                     q.edge_history.emplace_back(edge, layer, value);
+                 }
+                 q.via_history = via_history;
+                 q.allow_vias = allow_vias;
+                 q.num_layers = num_layers;
+                 q.via_cost = via_cost;
+                 // The GIL stays held: ``via_ok`` calls back into Python.
+                 Lattice::Path path = l.astar(q, committed, via_ok);
+                 if (path.nodes.empty()) {
+                     return std::nullopt;
+                 }
+                 return std::make_tuple(std::move(path.nodes), std::move(path.layers),
+                                        std::move(path.moves));
+             },
+             "starts"_a, "goals"_a, "end_pt"_a, "net"_a, "half"_a, "clearance"_a, "extra"_a,
+             "committed"_a, "edge_history"_a, "via_history"_a, "present"_a, "allow_vias"_a,
+             "num_layers"_a, "via_cost"_a, "via_ok"_a,
+             "Single-agent (node, layer) A*; ``(nodes, layers, moves)`` or None.");
+
+    // Coarse global router over the grid's congestion tiles (native twin of
+    // router/{region_graph,global_router}.py); per-net corridors come back as
+    // flat cols*rows bitsets for Pathfinder / CoupledPathfinder.
+    nb::class_<GlobalNetRequest>(m, "GlobalNetRequest")
+        .def(nb::init<>())
+        .def_rw("net", &GlobalNetRequest::net)
+        .def_rw("pins", &GlobalNetRequest::pins);
+
+    nb::class_<GlobalRouteResult>(m, "GlobalRouteResult")
+        .def(nb::init<>())
+        .def_ro("nets", &GlobalRouteResult::nets)
+        .def_ro("tiles", &GlobalRouteResult::tiles)
+        .def_ro("edges", &GlobalRouteResult::edges)
+        .def_ro("failed_nets", &GlobalRouteResult::failed_nets)
+        .def_ro("iterations", &GlobalRouteResult::iterations)
+        .def_ro("final_overflow", &GlobalRouteResult::final_overflow);
+
+    nb::class_<GlobalRouter>(m, "GlobalRouter")
+        // Holds a ``const Grid3D&``: keep the grid alive (see #4485).
+        .def(nb::init<const Grid3D&, int, const std::vector<int>&>(),
+             "grid"_a, "pitch_cells"_a, "routable_layers"_a = std::vector<int>{},
+             nb::keep_alive<1, 2>())
+        .def_rw("negotiated", &GlobalRouter::negotiated)
+        .def_rw("max_iterations", &GlobalRouter::max_iterations)
+        .def_rw("history_increment", &GlobalRouter::history_increment)
+        .def("refresh_capacity", &GlobalRouter::refresh_capacity)
+        // GIL released: the workers only read the grid.
+        .def("route_all", &GlobalRouter::route_all,
+             "requests"_a, "num_threads"_a = 0, "batch_size"_a = 32,
+             nb::call_guard<nb::gil_scoped_release>())
+        .def("corridor_bitset", &GlobalRouter::corridor_bitset, "tiles"_a, "halo"_a = 1)
+        .def_prop_ro("tile_cols", &GlobalRouter::tile_cols)
+        .def_prop_ro("tile_rows", &GlobalRouter::tile_rows)
+        .def_prop_ro("num_edges", &GlobalRouter::num_edges)
+        .def("tile_of", &GlobalRouter::tile_of, "x"_a, "y"_a)
+        .def("edge_tiles", &GlobalRouter::edge_tiles, "edge"_a)
+        .def("capacity", &GlobalRouter::capacity, "edge"_a)
+        .def("usage", &GlobalRouter::usage, "edge"_a)
+        .def("history", &GlobalRouter::history, "edge"_a)
+        .def("total_overflow", &GlobalRouter::total_overflow);
+
+    // RUDY congestion map shared with placement_cpp (rudy.hpp).
+    congestion::bind_rudy<router::RudyMap>(m);
+
+    // Rectilinear Steiner trees (native twin of algorithms/steiner.py):
+    // exact for small degrees, batched 1-Steiner above; build_rsmt_all builds
+    // a whole board's nets at once, SteinerBuilder also relocates blocked
+    // Steiner points on a grid.
+    nb::class_<SteinerTree>(m, "SteinerTree")
+        .def(nb::init<>())
+        .def_ro("net", &SteinerTree::net)
+        .def_ro("num_terminals", &SteinerTree::num_terminals)
+        .def_ro("points", &SteinerTree::points)
+        .def_ro("edges", &SteinerTree::edges)
+        .def_ro("length", &SteinerTree::length);
+
+    m.def("build_rsmt", &build_rsmt, "terminals"_a, "max_iterations"_a = -1,
+          nb::call_guard<nb::gil_scoped_release>(),
+          "RSMT topology of ``terminals`` (terminals first, then Steiner points).");
+
+    nb::class_<SteinerNetRequest>(m, "SteinerNetRequest")
+        .def(nb::init<>())
+        .def_rw("net", &SteinerNetRequest::net)
+        .def_rw("terminals", &SteinerNetRequest::terminals);
+
+    // GIL released: each worker builds its own trees.
+    m.def("build_rsmt_all", &build_rsmt_all, "requests"_a, "num_threads"_a = 0,
+          "max_iterations"_a = -1, nb::call_guard<nb::gil_scoped_release>(),
+          "RSMT topology of every request, in request order, without a grid.");
+
+    nb::class_<SteinerBuilder>(m, "SteinerBuilder")
+        // Holds a ``const Grid3D&``: keep the grid alive (see #4485).
+        .def(nb::init<const Grid3D&, int, const std::vector<int>&, int>(),
+             "grid"_a, "margin_cells"_a, "routable_layers"_a = std::vector<int>{},
+             "max_radius"_a = 20, nb::keep_alive<1, 2>())
+        .def("point_blocked", &SteinerBuilder::point_blocked, "gx"_a, "gy"_a, "net"_a)
+        .def("relocate", &SteinerBuilder::relocate, "gx"_a, "gy"_a, "net"_a)
+        // GIL released: the workers only read the grid.
+        .def("build_all", &SteinerBuilder::build_all,
+             "requests"_a, "num_threads"_a = 0, "max_iterations"_a = -1,
+             nb::call_guard<nb::gil_scoped_release>());
+
+    // Sparse clearance-contour routing graph (native twin of router/sparse.py):
+    // contour / lattice waypoints, exact visibility over a bucket index, CSR
+    // A*.
+    m.attr("SPARSE_PAD") = static_cast<int>(SPARSE_PAD);
+    m.attr("SPARSE_CONTOUR") = static_cast<int>(SPARSE_CONTOUR);
+    m.attr("SPARSE_LATTICE") = static_cast<int>(SPARSE_LATTICE);
+    m.attr("SPARSE_VIA") = static_cast<int>(SPARSE_VIA);
+
+    nb::class_<SparsePath>(m, "SparsePath")
+        .def(nb::init<>())
+        .def_ro("success", &SparsePath::success)
+        .def_ro("waypoints", &SparsePath::waypoints)
+        .def_ro("via_before", &SparsePath::via_before)
+        .def_ro("cost", &SparsePath::cost)
+        .def_ro("expanded", &SparsePath::expanded);
+
+    nb::class_<SparseGraph>(m, "SparseGraph")
+        .def(nb::init<double, double, double, double, int, double, int>(),
+             "width"_a, "height"_a, "origin_x"_a, "origin_y"_a, "num_layers"_a,
+             "clearance_buffer"_a, "contour_samples"_a = 8)
+        .def_rw("corridor_penalty", &SparseGraph::corridor_penalty)
+        .def("add_pad", &SparseGraph::add_pad,
+             "x"_a, "y"_a, "half_w"_a, "half_h"_a, "net"_a, "layers"_a)
+        .def("add_obstacle", &SparseGraph::add_obstacle,
+             "x"_a, "y"_a, "half_w"_a, "half_h"_a, "net"_a, "layers"_a)
+        .def("add_sparse_grid", &SparseGraph::add_sparse_grid, "spacing"_a)
+        // GIL released: build() only touches this graph.
+        .def("build", &SparseGraph::build, "max_edge_length"_a = 20.0, "num_threads"_a = 0,
+             nb::call_guard<nb::gil_scoped_release>())
+        .def_prop_ro("built", &SparseGraph::built)
+        .def("point_blocked", &SparseGraph::point_blocked, "x"_a, "y"_a, "layer"_a)
+        .def("line_of_sight", &SparseGraph::line_of_sight,
+             "x1"_a, "y1"_a, "x2"_a, "y2"_a, "layer"_a, "skip_a"_a = -1, "skip_b"_a = -1)
+        .def_prop_ro("num_waypoints", &SparseGraph::num_waypoints)
+        .def_prop_ro("num_base_waypoints", &SparseGraph::num_base_waypoints)
+        .def_prop_ro("num_obstacles", &SparseGraph::num_obstacles)
+        .def_prop_ro("num_edges", &SparseGraph::num_edges)
+        .def_prop_ro("num_corridors", &SparseGraph::num_corridors)
+        .def("waypoints_from", &SparseGraph::waypoints_from, "first"_a = 0)
+        .def("neighbors", &SparseGraph::neighbors, "id"_a)
+        .def("pad_waypoints", &SparseGraph::pad_waypoints, "net"_a, "x"_a, "y"_a)
+        .def("set_corridor", &SparseGraph::set_corridor, "net"_a, "segments"_a, "half_width"_a)
+        .def("clear_corridor", &SparseGraph::clear_corridor, "net"_a)
+        .def("clear_all_corridors", &SparseGraph::clear_all_corridors)
+        // GIL released: the search only reads the graph.
+        .def("route", &SparseGraph::route,
+             "net"_a, "starts"_a, "goals"_a, "via_cost"_a, "use_corridors"_a = false,
+             nb::call_guard<nb::gil_scoped_release>());
+
+    // Package escape planner (native twin of the fanout generators in
+    // router/escape.py): plans a whole BGA / QFN fanout in one call and
+    // commits the accepted stubs straight into the grid.
+    m.attr("ESCAPE_RING") = static_cast<int>(ESCAPE_RING);
+    m.attr("ESCAPE_ALTERNATING") = static_cast<int>(ESCAPE_ALTERNATING);
+    m.attr("ESCAPE_OK") = static_cast<int>(ESCAPE_OK);
+    m.attr("ESCAPE_SKIPPED") = static_cast<int>(ESCAPE_SKIPPED);
+    m.attr("ESCAPE_BLOCKED") = static_cast<int>(ESCAPE_BLOCKED);
+    m.attr("ESCAPE_CONFLICT") = static_cast<int>(ESCAPE_CONFLICT);
+
+    nb::class_<EscapePin>(m, "EscapePin")
+        .def(nb::init<>())
+        .def("__init__",
+             [](EscapePin* self, float x, float y, float width, float height, int net, int layer) {
+                 new (self) EscapePin{x, y, width, height, net, layer};
+             },
+             "x"_a, "y"_a, "width"_a, "height"_a, "net"_a, "layer"_a = 0)
+        .def_rw("x", &EscapePin::x)
+        .def_rw("y", &EscapePin::y)
+        .def_rw("width", &EscapePin::width)
+        .def_rw("height", &EscapePin::height)
+        .def_rw("net", &EscapePin::net)
+        .def_rw("layer", &EscapePin::layer);
+
+    nb::class_<EscapeConfig>(m, "EscapeConfig")
+        .def(nb::init<>())
+        .def_rw("pattern", &EscapeConfig::pattern)
+        .def_rw("inner_layers", &EscapeConfig::inner_layers)
+        .def_rw("escape_clearance", &EscapeConfig::escape_clearance)
+        .def_rw("via_spacing", &EscapeConfig::via_spacing)
+        .def_rw("min_drill_clearance", &EscapeConfig::min_drill_clearance)
+        .def_rw("corridor_cells", &EscapeConfig::corridor_cells)
+        .def_rw("num_threads", &EscapeConfig::num_threads);
+
+    nb::class_<EscapeStub>(m, "EscapeStub")
+        .def(nb::init<>())
+        .def_ro("pin", &EscapeStub::pin)
+        .def_ro("net", &EscapeStub::net)
+        .def_ro("ring", &EscapeStub::ring)
+        .def_ro("status", &EscapeStub::status)
+        .def_ro("dir_x", &EscapeStub::dir_x)
+        .def_ro("dir_y", &EscapeStub::dir_y)
+        .def_ro("escape_x", &EscapeStub::escape_x)
+        .def_ro("escape_y", &EscapeStub::escape_y)
+        .def_ro("escape_layer", &EscapeStub::escape_layer)
+        .def_ro("has_via", &EscapeStub::has_via)
+        .def_ro("via", &EscapeStub::via)
+        .def_ro("segments", &EscapeStub::segments);
+
+    nb::class_<EscapePlanner>(m, "EscapePlanner")
+        // Holds a ``Grid3D&``: keep the grid alive (see #4485).
+        .def(nb::init<Grid3D&, const DesignRules&>(), "grid"_a, "rules"_a,
+             nb::keep_alive<1, 2>())
+        // GIL released: planning only reads the grid.
+        .def("plan", &EscapePlanner::plan, "pins"_a, "config"_a,
+             nb::call_guard<nb::gil_scoped_release>())
+        .def("commit", &EscapePlanner::commit,
+             "stubs"_a, "config"_a, "store_geometry"_a = true, "reserve"_a = true)
+        .def("corridor_cells", &EscapePlanner::corridor_cells, "stub"_a, "config"_a)
+        .def_prop_ro("last_candidates", &EscapePlanner::last_candidates);
+
+    // Serpentine length tuning (native twin of the single-ended cascade in
+    // router/match_group_tuning.py): tunes a whole match group per call.
+    m.attr("MEANDER_TUNED") = static_cast<int>(MEANDER_TUNED);
+    m.attr("MEANDER_WITHIN_TOLERANCE") = static_cast<int>(MEANDER_WITHIN_TOLERANCE);
+    m.attr("MEANDER_NO_SEGMENT") = static_cast<int>(MEANDER_NO_SEGMENT);
+    m.attr("MEANDER_BLOCKED") = static_cast<int>(MEANDER_BLOCKED);
+    m.attr("MEANDER_PARTIAL") = static_cast<int>(MEANDER_PARTIAL);
+
+    nb::class_<MeanderConfig>(m, "MeanderConfig")
+        .def(nb::init<>())
+        .def_rw("amplitude", &MeanderConfig::amplitude)
+        .def_rw("min_spacing", &MeanderConfig::min_spacing)
+        .def_rw("gap_factor", &MeanderConfig::gap_factor)
+        .def_rw("min_segment_length", &MeanderConfig::min_segment_length)
+        .def_rw("max_loops", &MeanderConfig::max_loops)
+        .def_rw("max_inserts", &MeanderConfig::max_inserts)
+        .def_rw("max_candidates", &MeanderConfig::max_candidates)
+        .def_rw("amplitude_backoff", &MeanderConfig::amplitude_backoff)
+        .def_rw("trace_clearance", &MeanderConfig::trace_clearance)
+        .def_rw("via_clearance", &MeanderConfig::via_clearance)
+        .def_rw("pad_clearance", &MeanderConfig::pad_clearance)
+        .def_rw("tolerance", &MeanderConfig::tolerance);
+
+    nb::class_<MeanderRequest>(m, "MeanderRequest")
+        .def(nb::init<>())
+        .def("__init__",
+             [](MeanderRequest* self, int net, std::vector<Segment> segments,
+                std::vector<Via> vias, float target_length) {
+                 new (self) MeanderRequest{net, std::move(segments), std::move(vias),
+                                           target_length};
+             },
+             "net"_a, "segments"_a, "vias"_a, "target_length"_a)
+        .def_rw("net", &MeanderRequest::net)
+        .def_rw("segments", &MeanderRequest::segments)
+        .def_rw("vias", &MeanderRequest::vias)
+        .def_rw("target_length", &MeanderRequest::target_length);
+
+    nb::class_<MeanderResult>(m, "MeanderResult")
+        .def(nb::init<>())
+        .def_ro("net", &MeanderResult::net)
+        .def_ro("status", &MeanderResult::status)
+        .def_ro("length_before", &MeanderResult::length_before)
+        .def_ro("length_after", &MeanderResult::length_after)
+        .def_ro("inserts", &MeanderResult::inserts)
+        .def_ro("loops", &MeanderResult::loops)
+        .def_ro("segments", &MeanderResult::segments);
+
+    nb::class_<MeanderTuner>(m, "MeanderTuner")
+        // Holds a ``Grid3D&``: keep the grid alive (see #4485).
+        .def(nb::init<const Grid3D&, const MeanderConfig&>(), "grid"_a, "config"_a,
+             nb::keep_alive<1, 2>())
+        // GIL released: tuning only reads the grid.
+        .def("tune_group", &MeanderTuner::tune_group, "members"_a, "num_threads"_a = 0,
+             nb::call_guard<nb::gil_scoped_release>())
+        .def("trombone", &MeanderTuner::trombone,
+             "host"_a, "length_add"_a, "amplitude"_a, "side"_a = 0, "min_host"_a = 0.0f)
+        .def_static("length", &MeanderTuner::length, "segments"_a)
+        .def_prop_ro("config", &MeanderTuner::config);
 }
@@ -11,32 +11,29 @@
 #include "coupled_pathfinder.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
-#include <queue>
-#include <unordered_map>
-#include <unordered_set>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
 #include <vector>
 
 namespace router {
 
 namespace {
 
-// Pack (x, y) into a single 64-bit key for the corridor / bucket maps.
+// Pack (x, y) into a single 64-bit key for the corridor-exempt cells.
 inline uint64_t xy_key(int x, int y) {
     return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) |
            static_cast<uint32_t>(y);
 }
 
-// Pack (x, y, layer) into a 64-bit key for the visited-cell sets.  Layers
-// are tiny (<16) so 8 bits is plenty; x/y fit in 28 bits each (grids are far
-// below 2^28 cells on a side).
-inline uint64_t xyl_key(int x, int y, int layer) {
-    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 36) |
-           (static_cast<uint64_t>(static_cast<uint32_t>(y)) << 8) |
-           static_cast<uint64_t>(static_cast<uint32_t>(layer) & 0xFF);
-}
 
 }  // namespace
 
@@ -60,7 +57,164 @@ CoupledPathfinder::CoupledPathfinder(Grid3D& grid,
       heuristic_weight_(std::max(1.0, heuristic_weight)),
       cols_(grid.cols()),
       rows_(grid.rows()),
-      num_layers_(grid.layers()) {}
+      num_layers_(grid.layers()) {
+    // ``route_batch`` claim envelopes (``RoutingGrid.mark_route`` /
+    // ``_mark_via`` radius formulas).
+    const double res = grid.resolution() > 0.0f ? grid.resolution() : rules.grid_resolution;
+    claim_trace_radius_ =
+        static_cast<int>((rules.trace_width / 2.0 + rules.trace_clearance) / res) + 2;
+    claim_via_radius_ = static_cast<int>(
+        (rules.via_diameter / 2.0 + rules.via_clearance + rules.trace_width / 2.0) / res) + 1;
+    // Trail-proximity disc (mirror of the ``_too_close_to_trail`` distance
+    // test, diffpair_routing.py:937-954): every offset strictly inside
+    // ``min_spacing_cells_``.  Empty when the guard is disabled (r <= 1).
+    const int r = min_spacing_cells_;
+    if (r > 1) {
+        const double r_sq = static_cast<double>(r) * r;
+        for (int dy = -r; dy <= r; ++dy) {
+            for (int dx = -r; dx <= r; ++dx) {
+                if (static_cast<double>(dx * dx + dy * dy) < r_sq - 1e-9) {
+                    prox_offsets_.emplace_back(dx, dy);
+                }
+            }
+        }
+    }
+}
+
+void CoupledPathfinder::next_trail_generation() {
+    cols_ = grid_.cols();
+    rows_ = grid_.rows();
+    num_layers_ = grid_.layers();
+    const size_t total = static_cast<size_t>(cols_) * rows_ * num_layers_;
+    if (p_trail_stamp_.size() != total) {
+        p_trail_stamp_.assign(total, 0u);
+        n_trail_stamp_.assign(total, 0u);
+        trail_gen_ = 0;
+    }
+    if (trail_gen_ == UINT32_MAX) {
+        std::fill(p_trail_stamp_.begin(), p_trail_stamp_.end(), 0u);
+        std::fill(n_trail_stamp_.begin(), n_trail_stamp_.end(), 0u);
+        trail_gen_ = 0;
+    }
+    ++trail_gen_;
+}
+
+void CoupledPathfinder::build_goal_distance_field(
+    GoalDistanceField& field,
+    int goal_x, int goal_y,
+    int start_x, int start_y,
+    int net,
+    const std::vector<int>& layers,
+    const std::vector<uint8_t>& corridor_bitset,
+    const uint64_t (&exempt)[4]) {
+
+    const size_t total = static_cast<size_t>(cols_) * rows_ * num_layers_;
+    if (field.gen.size() != total) {
+        field.dist.assign(total * kHeadings, 0.0f);
+        field.gen.assign(total, 0u);
+        field.cur = 0;
+    }
+    if (field.cur == UINT32_MAX) {
+        std::fill(field.gen.begin(), field.gen.end(), 0u);
+        field.cur = 0;
+    }
+    const uint32_t cur = ++field.cur;
+    const float inf = std::numeric_limits<float>::infinity();
+
+    // Edge weights are per-head lower bounds on the JOINT move cost: a
+    // planar joint move costs ``cost_straight`` (+ ``cost_turn`` when the
+    // joint direction changes) and a via move ``2 * cost_via``, each minus
+    // at most one attractor bonus per head (Issue #4080), so subtract both
+    // heads' worst-case bonus.  A head's own move directions are a
+    // subsequence of the joint directions, so it changes direction no more
+    // often than the joint state does: charging ``cost_turn`` per change of
+    // the head's heading (seeded with the joint direction) stays admissible.
+    const bool attract = grid_.has_reservations() && rules_.cost_corridor_attractor > 0.0f;
+    const double bonus = attract ? 2.0 * rules_.cost_corridor_attractor : 0.0;
+    const float w_step = static_cast<float>(std::max(0.0, rules_.cost_straight - bonus));
+    const float w_turn =
+        static_cast<float>(std::max(0.0, rules_.cost_straight + rules_.cost_turn - bonus));
+    const float w_via = static_cast<float>(std::max(0.0, rules_.cost_via * 2.0 - bonus));
+
+    const bool have_corridor = !corridor_bitset.empty();
+    auto passable = [&](int x, int y, int layer) -> bool {
+        if (x < 0 || x >= cols_ || y < 0 || y >= rows_) return false;
+        if (have_corridor && !corridor_bitset[static_cast<size_t>(y) * cols_ + x]) {
+            const uint64_t k = xy_key(x, y);
+            if (k != exempt[0] && k != exempt[1] && k != exempt[2] && k != exempt[3]) {
+                return false;
+            }
+        }
+        if ((x == goal_x && y == goal_y) || (x == start_x && y == start_y)) return true;
+        return !is_trace_blocked(x, y, layer, net);
+    };
+
+    // State = cell * kHeadings + heading.  A cell's ``kHeadings`` distances
+    // are initialised together the first time the generation touches it.
+    auto& heap = dijkstra_heap_;
+    heap.clear();
+    const auto heap_greater = [](const std::pair<float, size_t>& a,
+                                 const std::pair<float, size_t>& b) {
+        return a.first > b.first || (a.first == b.first && a.second > b.second);
+    };
+    auto relax = [&](size_t cell, int heading, float d) {
+        if (field.gen[cell] != cur) {
+            field.gen[cell] = cur;
+            std::fill_n(field.dist.begin() + cell * kHeadings, kHeadings, inf);
+        }
+        const size_t state = cell * kHeadings + heading;
+        if (field.dist[state] <= d) return;
+        field.dist[state] = d;
+        heap.emplace_back(d, state);
+        std::push_heap(heap.begin(), heap.end(), heap_greater);
+    };
+
+    // The search's goal test ignores layers, so the goal (x,y) is a zero-
+    // cost sink on every layer a head can occupy, whatever its heading.
+    for (int layer : layers) {
+        if (layer < 0 || layer >= num_layers_) continue;
+        if (!passable(goal_x, goal_y, layer)) continue;
+        for (int h = 0; h < kHeadings; ++h) {
+            relax(cell_index(goal_x, goal_y, layer), h, 0.0f);
+        }
+    }
+
+    // Backward relaxation.  Popping ``(v, d)`` (head at ``v`` having just
+    // moved along heading ``d``, cost-to-goal ``D``) relaxes:
+    //   * the planar predecessor ``v - d`` under every heading ``h``, at
+    //     ``D + w_step`` when ``h`` is ``d`` or none, else ``D + w_turn``;
+    //   * ``v`` on every other layer with the same heading (via moves keep
+    //     the joint direction), at ``D + w_via``.
+    const size_t plane = static_cast<size_t>(cols_) * rows_;
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), heap_greater);
+        const auto [d, state] = heap.back();
+        heap.pop_back();
+        if (field.dist[state] < d) continue;  // stale entry
+
+        const size_t cell = state / kHeadings;
+        const int heading = static_cast<int>(state % kHeadings);
+        const int layer = static_cast<int>(cell / plane);
+        const size_t rem = cell % plane;
+        const int y = static_cast<int>(rem / cols_);
+        const int x = static_cast<int>(rem % cols_);
+
+        if (heading != kNoHeading) {
+            const int px = x - kHeadingDx[heading], py = y - kHeadingDy[heading];
+            if (passable(px, py, layer)) {
+                const size_t pcell = cell_index(px, py, layer);
+                for (int h = 0; h < kHeadings; ++h) {
+                    const bool straight = (h == heading || h == kNoHeading);
+                    relax(pcell, h, d + (straight ? w_step : w_turn));
+                }
+            }
+        }
+        for (int other : layers) {
+            if (other == layer || other < 0 || other >= num_layers_) continue;
+            if (passable(x, y, other)) relax(cell_index(x, y, other), heading, d + w_via);
+        }
+    }
+}
 
 // Mirror of Python ``_is_via_blocked`` (diffpair_routing.py:793-832).
 bool CoupledPathfinder::is_via_blocked(int gx, int gy, int net) const {
@@ -82,9 +236,8 @@ bool CoupledPathfinder::is_via_blocked(int gx, int gy, int net) const {
     return false;
 }
 
-// Mirror of Python ``_heuristic`` partner_aware branch
-// (diffpair_routing.py:1393-1458).  Only ``partner_aware`` is ported; the
-// Python wrapper routes ``manhattan_sum`` callers to the Python fallback.
+// Mirror of Python ``_heuristic`` (diffpair_routing.py:1393-1458), both
+// the ``partner_aware`` and the legacy ``manhattan_sum`` branches.
 double CoupledPathfinder::heuristic(int p_x, int p_y, int p_layer,
                                     int n_x, int n_y, int n_layer,
                                     int p_goal_x, int p_goal_y, int p_goal_layer,
@@ -95,6 +248,10 @@ double CoupledPathfinder::heuristic(int p_x, int p_y, int p_layer,
     if (p_layer != p_goal_layer) layer_cost += rules_.cost_via;
     if (n_layer != n_goal_layer) layer_cost += rules_.cost_via;
 
+    if (heuristic_mode_ == HeuristicMode::MANHATTAN_SUM) {
+        return (p_dist + n_dist) * rules_.cost_straight + layer_cost;
+    }
+
     int max_dist = std::max(p_dist, n_dist);
     double spacing_dx = static_cast<double>(p_x - n_x);
     double spacing_dy = static_cast<double>(p_y - n_y);
@@ -125,67 +282,117 @@ CoupledRouteResult CoupledPathfinder::route(
 
     const bool have_corridor = !corridor_bitset.empty();
     // Corridor-exempt endpoint (x,y) cells (diffpair_routing.py:1630-1637).
-    std::unordered_set<uint64_t> corridor_exempt;
-    corridor_exempt.reserve(4);
-    corridor_exempt.insert(xy_key(p_start_x, p_start_y));
-    corridor_exempt.insert(xy_key(p_goal_x, p_goal_y));
-    corridor_exempt.insert(xy_key(n_start_x, n_start_y));
-    corridor_exempt.insert(xy_key(n_goal_x, n_goal_y));
+    const uint64_t corridor_exempt[4] = {
+        xy_key(p_start_x, p_start_y), xy_key(p_goal_x, p_goal_y),
+        xy_key(n_start_x, n_start_y), xy_key(n_goal_x, n_goal_y)};
+    auto is_corridor_exempt = [&corridor_exempt](int x, int y) -> bool {
+        const uint64_t k = xy_key(x, y);
+        return k == corridor_exempt[0] || k == corridor_exempt[1] ||
+               k == corridor_exempt[2] || k == corridor_exempt[3];
+    };
 
     auto in_corridor = [&](int x, int y) -> bool {
         if (!have_corridor) return true;
         if (x < 0 || x >= cols_ || y < 0 || y >= rows_) {
-            return corridor_exempt.count(xy_key(x, y)) != 0;
+            return is_corridor_exempt(x, y);
         }
         if (corridor_bitset[static_cast<size_t>(y) * cols_ + x]) return true;
-        return corridor_exempt.count(xy_key(x, y)) != 0;
+        return is_corridor_exempt(x, y);
     };
 
-    // Node pool (contiguous) + index-based parent chain.
-    std::vector<CoupledAStarNode> pool;
-    pool.reserve(4096);
-
-    // Priority queue over pool INDICES, ordered by a copy of the node's keys.
-    // We store the node itself in the heap so the comparator is self-contained
-    // (the pool may reallocate; storing indices + comparator-by-lookup would
-    // be invalidated).  Heap entries are small PODs.
-    std::priority_queue<CoupledAStarNode, std::vector<CoupledAStarNode>,
-                        CoupledNodeGreater>
-        open_set;
-
-    // closed_set / g_scores keyed by the joint (p_pos, n_pos) IGNORING
-    // direction, exactly as the Python loop keys ``(current.state.p_pos,
-    // current.state.n_pos)`` (diffpair_routing.py:1746, 1873).  The key packs
-    // both heads' (x,y,layer) into 128 bits via a pair of 64-bit keys.
-    struct JointKey {
-        uint64_t p, n;
-        bool operator==(const JointKey& o) const { return p == o.p && n == o.n; }
-    };
-    struct JointKeyHash {
-        size_t operator()(const JointKey& k) const {
-            // 64-bit mix (splitmix64-ish) of the two halves.
-            uint64_t h = k.p * 0x9E3779B97F4A7C15ULL ^ (k.n + 0x9E3779B97F4A7C15ULL +
-                                                        (k.p << 6) + (k.p >> 2));
-            return static_cast<size_t>(h);
+    // Per-call reset of the dense search state (see coupled_pathfinder.hpp):
+    // the trail stamp arrays are (re)sized to the grid first so ``cell_index``
+    // uses the current dimensions.
+    next_trail_generation();
+    joint_table_.reset();
+
+    // Opt-in goal-distance fields, one per head.  Heads may sit on the start
+    // layer, the end layer or any routable layer.  The per-head bound
+    // assumes each head moves by planar steps and layer changes, which the
+    // polarity-swap move breaks (it teleports each head onto its partner's
+    // cell), so the fields are not used when swaps are allowed.
+    const bool use_fields = distance_heuristic_ && !allow_swap_via_;
+    if (use_fields) {
+        std::vector<int> field_layers = routable_layers;
+        for (int layer : {start_layer, end_layer}) {
+            if (std::find(field_layers.begin(), field_layers.end(), layer) ==
+                field_layers.end()) {
+                field_layers.push_back(layer);
+            }
         }
-    };
-    std::unordered_set<JointKey, JointKeyHash> closed_set;
-    std::unordered_map<JointKey, float, JointKeyHash> g_scores;
+        build_goal_distance_field(p_goal_field_, p_goal_x, p_goal_y,
+                                  p_start_x, p_start_y, p_net,
+                                  field_layers, corridor_bitset, corridor_exempt);
+        build_goal_distance_field(n_goal_field_, n_goal_x, n_goal_y,
+                                  n_start_x, n_start_y, n_net,
+                                  field_layers, corridor_bitset, corridor_exempt);
+    }
+
+    // Node pool (contiguous) + index-based parent chain.
+    std::vector<CoupledAStarNode>& pool = pool_;
+    pool.clear();
 
-    auto joint_key = [](int px, int py, int pl, int nx, int ny, int nl) -> JointKey {
-        return JointKey{xyl_key(px, py, pl), xyl_key(nx, ny, nl)};
+    // Open set as a binary heap over node COPIES.  We store the node itself
+    // in the heap so the comparator is self-contained (the pool may
+    // reallocate; storing indices + comparator-by-lookup would be
+    // invalidated).  Heap entries are small PODs.
+    std::vector<CoupledAStarNode>& open_set = open_heap_;
+    open_set.clear();
+    const CoupledNodeGreater node_greater;
+
+    // The closed set / g-scores are keyed by the joint (p_pos, n_pos)
+    // IGNORING direction, exactly as the Python loop keys
+    // ``(current.state.p_pos, current.state.n_pos)``
+    // (diffpair_routing.py:1746, 1873).  Both heads are always on-grid (the
+    // endpoints come from the clamped ``world_to_grid`` and every other
+    // candidate passes the bounds-checking blocked predicates), so the
+    // joint state packs into one 64-bit key over the flat cell indices.
+    const uint64_t total_cells =
+        static_cast<uint64_t>(cols_) * rows_ * num_layers_;
+    auto joint_key = [&](int px, int py, int pl, int nx, int ny, int nl) -> uint64_t {
+        return static_cast<uint64_t>(cell_index(px, py, pl)) * total_cells +
+               cell_index(nx, ny, nl);
+    };
+    auto on_grid = [&](int x, int y, int layer) -> bool {
+        return x >= 0 && x < cols_ && y >= 0 && y < rows_ &&
+               layer >= 0 && layer < num_layers_;
     };
 
     const int directions[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
 
+    // Joint heuristic: partner_aware, tightened by the goal-distance fields
+    // when enabled (see ``set_distance_heuristic``).  +infinity means a head
+    // cannot reach its goal from this state.
+    auto joint_heuristic = [&](int px, int py, int pl, int nx, int ny, int nl,
+                               int dir_dx, int dir_dy) -> double {
+        double h = heuristic(px, py, pl, nx, ny, nl,
+                             p_goal_x, p_goal_y, end_layer,
+                             n_goal_x, n_goal_y, end_layer);
+        if (!use_fields || !on_grid(px, py, pl) || !on_grid(nx, ny, nl)) return h;
+        const int heading = heading_index(dir_dx, dir_dy);
+        const float dp = goal_distance(p_goal_field_, cell_index(px, py, pl), heading);
+        const float dn = goal_distance(n_goal_field_, cell_index(nx, ny, nl), heading);
+        if (std::isinf(dp) || std::isinf(dn)) {
+            return std::numeric_limits<double>::infinity();
+        }
+        const double sdx = static_cast<double>(px - nx);
+        const double sdy = static_cast<double>(py - ny);
+        const double spacing_penalty =
+            std::abs(std::sqrt(sdx * sdx + sdy * sdy) - target_spacing_cells_) *
+            rules_.cost_straight * spacing_penalty_factor_;
+        if (heuristic_mode_ == HeuristicMode::MANHATTAN_SUM) {
+            return std::max(h, static_cast<double>(dp) + static_cast<double>(dn));
+        }
+        const double d = std::max(static_cast<double>(dp), static_cast<double>(dn));
+        return std::max(h, d + spacing_penalty);
+    };
+
     uint64_t seq_counter = 0;
 
     // Root node.
     double start_h = heuristic_weight_ *
-                     heuristic(p_start_x, p_start_y, start_layer,
-                               n_start_x, n_start_y, start_layer,
-                               p_goal_x, p_goal_y, end_layer,
-                               n_goal_x, n_goal_y, end_layer);
+                     joint_heuristic(p_start_x, p_start_y, start_layer,
+                                     n_start_x, n_start_y, start_layer, 0, 0);
     CoupledAStarNode root;
     root.p_x = p_start_x; root.p_y = p_start_y; root.p_layer = start_layer;
     root.n_x = n_start_x; root.n_y = n_start_y; root.n_layer = start_layer;
@@ -198,9 +405,14 @@ CoupledRouteResult CoupledPathfinder::route(
     // The heap holds a copy; the pool records nodes as they are POPPED and
     // become the parent of expanded neighbors (mirrors the single-ended
     // pathfinder, whose closed set is the parent store).
-    open_set.push(root);
-    g_scores[joint_key(p_start_x, p_start_y, start_layer,
-                       n_start_x, n_start_y, start_layer)] = 0.0f;
+    open_set.push_back(root);
+    std::push_heap(open_set.begin(), open_set.end(), node_greater);
+    if (on_grid(p_start_x, p_start_y, start_layer) &&
+        on_grid(n_start_x, n_start_y, start_layer)) {
+        joint_table_.find_or_insert(joint_key(p_start_x, p_start_y, start_layer,
+                                              n_start_x, n_start_y, start_layer))
+            ->g_score = 0.0f;
+    }
 
     const long max_iterations = static_cast<long>(cols_) * rows_ * 4;
     long iterations = 0;
@@ -219,30 +431,35 @@ CoupledRouteResult CoupledPathfinder::route(
     // constraint dominates the frontier).  Keys mirror the pure-Python
     // ``last_rejections`` vocabulary (diffpair_routing.py) so the two backends
     // report the same taxonomy; the via-guard keys are the C++ path's superset
-    // (the Python via move does not currently count rejections).
-    std::unordered_map<std::string, int64_t> rejections;
-    auto rej = [&rejections](const char* reason) { ++rejections[reason]; };
+    // (the Python via move does not currently count rejections).  Counted
+    // into a fixed per-reason array; the bindings build the string-keyed
+    // dict once per call.
+    std::array<int64_t, COUPLED_REJECTION_COUNT> rejections{};
+    auto rej = [&rejections](CoupledRejection reason) { ++rejections[reason]; };
 
     // Endpoint (x,y,layer) cells stripped from the trail sets, mirroring the
-    // Python discard at diffpair_routing.py:1829-1838.
-    const uint64_t p_start_cell = xyl_key(p_start_x, p_start_y, start_layer);
-    const uint64_t p_goal_cell = xyl_key(p_goal_x, p_goal_y, end_layer);
-    const uint64_t n_start_cell = xyl_key(n_start_x, n_start_y, start_layer);
-    const uint64_t n_goal_cell = xyl_key(n_goal_x, n_goal_y, end_layer);
-
-    const int prox_r = min_spacing_cells_;
-    const int prox_bucket = std::max(1, prox_r);
-    const double prox_r_sq = static_cast<double>(prox_r) * prox_r;
-
-    // Issue #4065: trail-history containers hoisted OUT of the loop and
-    // ``.clear()``-reused every pop.  Rebuilding fresh ``unordered_set`` /
-    // ``unordered_map`` objects per iteration (the naive port) dominated a
-    // short converging run's wall-clock -- clearing retained buckets keeps
-    // the allocated capacity across pops so only the growth beyond the
-    // previous high-water mark allocates.  This is the per-pop-allocation
-    // half of the curator's O(depth^2) caveat; the walk itself stays O(depth).
-    std::unordered_set<uint64_t> p_visited, n_visited;
-    std::unordered_map<uint64_t, std::vector<uint64_t>> p_prox, n_prox;
+    // Python discard at diffpair_routing.py:1829-1838.  ``SIZE_MAX`` marks an
+    // endpoint that is off-grid (and so can never be stamped).
+    auto endpoint_cell = [&](int x, int y, int layer) -> size_t {
+        return on_grid(x, y, layer) ? cell_index(x, y, layer) : SIZE_MAX;
+    };
+    const size_t p_start_cell = endpoint_cell(p_start_x, p_start_y, start_layer);
+    const size_t p_goal_cell = endpoint_cell(p_goal_x, p_goal_y, end_layer);
+    const size_t n_start_cell = endpoint_cell(n_start_x, n_start_y, start_layer);
+    const size_t n_goal_cell = endpoint_cell(n_goal_x, n_goal_y, end_layer);
+
+    uint32_t* const p_stamp = p_trail_stamp_.data();
+    uint32_t* const n_stamp = n_trail_stamp_.data();
+
+    // Collected neighbors: (px,py,pl, nx,ny,nl, dir_dx,dir_dy, cost, is_via).
+    // Hoisted out of the loop so the buffer is allocated once per call.
+    struct Cand {
+        int px, py, pl, nx, ny, nl, ddx, ddy;
+        double cost;
+        bool is_via;
+    };
+    std::vector<Cand> neighbors;
+    neighbors.reserve(16);
 
     while (!open_set.empty() && iterations < max_iterations) {
         ++iterations;
@@ -254,7 +471,7 @@ CoupledRouteResult CoupledPathfinder::route(
             result.best_progress = best_progress;
             result.timeout_exceeded = true;
             result.iteration_limited = true;  // #3921: iteration budget bound.
-            result.rejections = std::move(rejections);  // #4459
+            result.rejections = rejections;  // #4459
             return result;
         }
         // Wall-clock check every 64 iters (diffpair_routing.py:1728-1743).
@@ -264,17 +481,22 @@ CoupledRouteResult CoupledPathfinder::route(
             result.best_progress = best_progress;
             result.timeout_exceeded = true;
             result.iteration_limited = false;  // wall-clock bound.
-            result.rejections = std::move(rejections);  // #4459
+            result.rejections = rejections;  // #4459
             return result;
         }
 
-        CoupledAStarNode current = open_set.top();
-        open_set.pop();
+        std::pop_heap(open_set.begin(), open_set.end(), node_greater);
+        CoupledAStarNode current = open_set.back();
+        open_set.pop_back();
 
-        JointKey ckey = joint_key(current.p_x, current.p_y, current.p_layer,
-                                  current.n_x, current.n_y, current.n_layer);
-        if (closed_set.count(ckey)) continue;
-        closed_set.insert(ckey);
+        if (on_grid(current.p_x, current.p_y, current.p_layer) &&
+            on_grid(current.n_x, current.n_y, current.n_layer)) {
+            JointStateTable::Slot* cslot = joint_table_.find_or_insert(
+                joint_key(current.p_x, current.p_y, current.p_layer,
+                          current.n_x, current.n_y, current.n_layer));
+            if (cslot->closed) continue;
+            cslot->closed = true;
+        }
 
         // Record this node in the pool so its children can reference it.
         int current_idx = static_cast<int>(pool.size());
@@ -301,7 +523,7 @@ CoupledRouteResult CoupledPathfinder::route(
             result.success = true;
             result.iterations = static_cast<int>(iterations);
             result.best_progress = best_progress;
-            result.rejections = std::move(rejections);  // #4459
+            result.rejections = rejections;  // #4459
             return result;
         }
 
@@ -326,58 +548,63 @@ CoupledRouteResult CoupledPathfinder::route(
         // Python while removing the interpreter overhead that dominated the
         // #4052 profile.  This is the honest v1 boundary called out on the
         // issue.
+        //
+        // The chain is recorded by stamping ``trail_gen_`` into the per-cell
+        // ``p_trail_stamp_`` / ``n_trail_stamp_`` arrays rather than
+        // rebuilding hash sets + proximity bucket maps; bumping the
+        // generation empties both trails in O(1).  ``p_live`` / ``n_live``
+        // count the distinct stamped cells that survive the endpoint strip,
+        // i.e. the sizes of the Python ``p_visited`` / ``n_visited`` sets.
         // ------------------------------------------------------------------
-        p_visited.clear();
-        n_visited.clear();
-        // ``.clear()`` on the bucket maps keeps the bucket vectors' capacity;
-        // clear each retained vector too so membership from a prior pop's
-        // longer chain does not leak into this one.
-        for (auto& kv : p_prox) kv.second.clear();
-        for (auto& kv : n_prox) kv.second.clear();
+        next_trail_generation();
+        const uint32_t tgen = trail_gen_;
+        size_t p_live = 0, n_live = 0;
         {
             int walk = current_idx;
             while (walk >= 0) {
                 const CoupledAStarNode& nd = pool[static_cast<size_t>(walk)];
-                uint64_t pc = xyl_key(nd.p_x, nd.p_y, nd.p_layer);
-                uint64_t nc = xyl_key(nd.n_x, nd.n_y, nd.n_layer);
-                p_visited.insert(pc);
-                n_visited.insert(nc);
-                if (prox_r > 1) {
-                    p_prox[xy_key(nd.p_x / prox_bucket, nd.p_y / prox_bucket)].push_back(pc);
-                    n_prox[xy_key(nd.n_x / prox_bucket, nd.n_y / prox_bucket)].push_back(nc);
+                if (on_grid(nd.p_x, nd.p_y, nd.p_layer)) {
+                    size_t pc = cell_index(nd.p_x, nd.p_y, nd.p_layer);
+                    if (p_stamp[pc] != tgen) {
+                        p_stamp[pc] = tgen;
+                        if (pc != p_start_cell && pc != p_goal_cell) ++p_live;
+                    }
+                }
+                if (on_grid(nd.n_x, nd.n_y, nd.n_layer)) {
+                    size_t nc = cell_index(nd.n_x, nd.n_y, nd.n_layer);
+                    if (n_stamp[nc] != tgen) {
+                        n_stamp[nc] = tgen;
+                        if (nc != n_start_cell && nc != n_goal_cell) ++n_live;
+                    }
                 }
                 walk = nd.parent_idx;
             }
         }
-        // Strip endpoint pad cells (diffpair_routing.py:1829-1838).
-        p_visited.erase(p_start_cell);
-        p_visited.erase(p_goal_cell);
-        n_visited.erase(n_start_cell);
-        n_visited.erase(n_goal_cell);
+        // Trail membership with the endpoint pad cells stripped
+        // (diffpair_routing.py:1829-1838).
+        auto in_p_visited = [&](int x, int y, int layer) -> bool {
+            if (!on_grid(x, y, layer)) return false;
+            size_t c = cell_index(x, y, layer);
+            return p_stamp[c] == tgen && c != p_start_cell && c != p_goal_cell;
+        };
+        auto in_n_visited = [&](int x, int y, int layer) -> bool {
+            if (!on_grid(x, y, layer)) return false;
+            size_t c = cell_index(x, y, layer);
+            return n_stamp[c] == tgen && c != n_start_cell && c != n_goal_cell;
+        };
 
         // Proximity guard, mirror of ``_too_close_to_trail``
-        // (diffpair_routing.py:937-954).  ``buckets`` selects which trail's
-        // spatial buckets to probe.
-        auto too_close = [&](int cx, int cy, int clayer,
-                             const std::unordered_map<uint64_t, std::vector<uint64_t>>& prox)
-            -> bool {
-            if (prox.empty() || prox_r <= 1) return false;
-            int bx = cx / prox_bucket, by = cy / prox_bucket;
-            for (int dbx = -1; dbx <= 1; ++dbx) {
-                for (int dby = -1; dby <= 1; ++dby) {
-                    auto it = prox.find(xy_key(bx + dbx, by + dby));
-                    if (it == prox.end()) continue;
-                    for (uint64_t packed : it->second) {
-                        int tlayer = static_cast<int>(packed & 0xFF);
-                        if (tlayer != clayer) continue;
-                        int tx = static_cast<int>((packed >> 36) & 0xFFFFFFF);
-                        int ty = static_cast<int>((packed >> 8) & 0xFFFFFFF);
-                        // xyl_key stored x in bits 36+, y in bits 8..35.
-                        double dx = static_cast<double>(tx - cx);
-                        double dy = static_cast<double>(ty - cy);
-                        if (dx * dx + dy * dy < prox_r_sq - 1e-9) return true;
-                    }
-                }
+        // (diffpair_routing.py:937-954).  ``stamp`` selects which trail to
+        // probe.  Like the Python bucket index, proximity sees the UNSTRIPPED
+        // trail (endpoints included), so it reads the raw stamps over the
+        // precomputed disc.
+        auto too_close = [&](int cx, int cy, int clayer, const uint32_t* stamp) -> bool {
+            if (prox_offsets_.empty()) return false;
+            if (clayer < 0 || clayer >= num_layers_) return false;
+            for (const auto& off : prox_offsets_) {
+                int tx = cx + off.first, ty = cy + off.second;
+                if (tx < 0 || tx >= cols_ || ty < 0 || ty >= rows_) continue;
+                if (stamp[cell_index(tx, ty, clayer)] == tgen) return true;
             }
             return false;
         };
@@ -388,15 +615,13 @@ CoupledRouteResult CoupledPathfinder::route(
                                    int nn_x, int nn_y, int nn_l,
                                    bool p_adv, bool n_adv,
                                    bool p_ep, bool n_ep) -> bool {
-            if (p_visited.empty() && n_visited.empty()) return false;
-            uint64_t pk = xyl_key(np_x, np_y, np_l);
-            uint64_t nk = xyl_key(nn_x, nn_y, nn_l);
-            if (p_adv && !p_ep && n_visited.count(pk)) return true;
-            if (n_adv && !n_ep && p_visited.count(nk)) return true;
-            if (p_adv && !p_ep && too_close(np_x, np_y, np_l, n_prox)) return true;
-            if (n_adv && !n_ep && too_close(nn_x, nn_y, nn_l, p_prox)) return true;
-            if (p_adv && !p_ep && p_visited.count(pk)) return true;
-            if (n_adv && !n_ep && n_visited.count(nk)) return true;
+            if (p_live == 0 && n_live == 0) return false;
+            if (p_adv && !p_ep && in_n_visited(np_x, np_y, np_l)) return true;
+            if (n_adv && !n_ep && in_p_visited(nn_x, nn_y, nn_l)) return true;
+            if (p_adv && !p_ep && too_close(np_x, np_y, np_l, n_stamp)) return true;
+            if (n_adv && !n_ep && too_close(nn_x, nn_y, nn_l, p_stamp)) return true;
+            if (p_adv && !p_ep && in_p_visited(np_x, np_y, np_l)) return true;
+            if (n_adv && !n_ep && in_n_visited(nn_x, nn_y, nn_l)) return true;
             return false;
         };
 
@@ -431,14 +656,7 @@ CoupledRouteResult CoupledPathfinder::route(
         if (approach_relaxed) relaxed_tolerance = std::max(relaxed_tolerance, effective_approach_radius);
         if (departure_relaxed) relaxed_tolerance = std::max(relaxed_tolerance, effective_departure_radius);
 
-        // Collected neighbors: (px,py,pl, nx,ny,nl, dir_dx,dir_dy, cost, is_via).
-        struct Cand {
-            int px, py, pl, nx, ny, nl, ddx, ddy;
-            double cost;
-            bool is_via;
-        };
-        std::vector<Cand> neighbors;
-        neighbors.reserve(16);
+        neighbors.clear();
 
         // Symmetric moves (diffpair_routing.py:1071-1153).
         for (auto& d : directions) {
@@ -450,19 +668,19 @@ CoupledRouteResult CoupledPathfinder::route(
                         at_goal(np_x, np_y, p_start_x, p_start_y);
             bool n_ep = at_goal(nn_x, nn_y, n_goal_x, n_goal_y) ||
                         at_goal(nn_x, nn_y, n_start_x, n_start_y);
-            if (!p_ep && is_trace_blocked(np_x, np_y, np_l, p_net)) { rej("sym_blocked_p"); continue; }
-            if (!n_ep && is_trace_blocked(nn_x, nn_y, nn_l, n_net)) { rej("sym_blocked_n"); continue; }
+            if (!p_ep && is_trace_blocked(np_x, np_y, np_l, p_net)) { rej(REJ_SYM_BLOCKED_P); continue; }
+            if (!n_ep && is_trace_blocked(nn_x, nn_y, nn_l, n_net)) { rej(REJ_SYM_BLOCKED_N); continue; }
 
             double sdx = np_x - nn_x, sdy = np_y - nn_y;
             double new_spacing = std::sqrt(sdx * sdx + sdy * sdy);
             int tolerance = spacing_relaxed ? relaxed_tolerance : 1;
-            if (std::abs(new_spacing - target_spacing) > tolerance) { rej("sym_spacing"); continue; }
+            if (std::abs(new_spacing - target_spacing) > tolerance) { rej(REJ_SYM_SPACING); continue; }
 
             if (min_spacing_cells_ > 0 && !(p_ep && n_ep)) {
-                if (new_spacing + 1e-9 < min_spacing_cells_) { rej("sym_floor"); continue; }
+                if (new_spacing + 1e-9 < min_spacing_cells_) { rej(REJ_SYM_FLOOR); continue; }
             }
             if (self_intersects(np_x, np_y, np_l, nn_x, nn_y, nn_l,
-                                true, true, p_ep, n_ep)) { rej("sym_trail"); continue; }
+                                true, true, p_ep, n_ep)) { rej(REJ_SYM_TRAIL); continue; }
 
             double cost = rules_.cost_straight;
             bool dir_changed = !(current.dir_dx == 0 && current.dir_dy == 0) &&
@@ -495,12 +713,12 @@ CoupledRouteResult CoupledPathfinder::route(
                     bool p_ep = at_goal(cp_x, cp_y, p_goal_x, p_goal_y) ||
                                 at_goal(cp_x, cp_y, p_start_x, p_start_y);
                     bool blocked = !(p_ep || !is_trace_blocked(cp_x, cp_y, cp_l, p_net));
-                    if (blocked) rej("asym_blocked_p");  // #4459
+                    if (blocked) rej(REJ_ASYM_BLOCKED_P);  // #4459
                     if (!blocked) {
                         double sdx = cp_x - cn_x, sdy = cp_y - cn_y;
                         double new_spacing = std::sqrt(sdx * sdx + sdy * sdy);
                         if (std::abs(new_spacing - target_spacing) > asym_tolerance) {
-                            rej("asym_spacing_p");  // #4459
+                            rej(REJ_ASYM_SPACING_P);  // #4459
                         } else {
                             bool n_ep = at_goal(cn_x, cn_y, n_goal_x, n_goal_y) ||
                                         at_goal(cn_x, cn_y, n_start_x, n_start_y);
@@ -509,10 +727,10 @@ CoupledRouteResult CoupledPathfinder::route(
                                 !(min_spacing_cells_ > 0 && !bypass_floor &&
                                   new_spacing + 1e-9 < min_spacing_cells_);
                             if (!floor_ok) {
-                                rej("asym_floor_p");  // #4459
+                                rej(REJ_ASYM_FLOOR_P);  // #4459
                             } else if (self_intersects(cp_x, cp_y, cp_l, cn_x, cn_y, cn_l,
                                                        true, false, p_ep, n_ep)) {
-                                rej("asym_trail_p");  // #4459
+                                rej(REJ_ASYM_TRAIL_P);  // #4459
                             } else {
                                 double cost = rules_.cost_straight;
                                 bool dir_changed =
@@ -545,12 +763,12 @@ CoupledRouteResult CoupledPathfinder::route(
                     bool n_ep = at_goal(cn_x, cn_y, n_goal_x, n_goal_y) ||
                                 at_goal(cn_x, cn_y, n_start_x, n_start_y);
                     if (!(n_ep || !is_trace_blocked(cn_x, cn_y, cn_l, n_net))) {
-                        rej("asym_blocked_n");  // #4459
+                        rej(REJ_ASYM_BLOCKED_N);  // #4459
                     } else {
                         double sdx = cp_x - cn_x, sdy = cp_y - cn_y;
                         double new_spacing = std::sqrt(sdx * sdx + sdy * sdy);
                         if (std::abs(new_spacing - target_spacing) > asym_tolerance) {
-                            rej("asym_spacing_n");  // #4459
+                            rej(REJ_ASYM_SPACING_N);  // #4459
                         } else {
                             bool p_ep = at_goal(cp_x, cp_y, p_goal_x, p_goal_y) ||
                                         at_goal(cp_x, cp_y, p_start_x, p_start_y);
@@ -559,10 +777,10 @@ CoupledRouteResult CoupledPathfinder::route(
                                 !(min_spacing_cells_ > 0 && !bypass_floor &&
                                   new_spacing + 1e-9 < min_spacing_cells_);
                             if (!floor_ok) {
-                                rej("asym_floor_n");  // #4459
+                                rej(REJ_ASYM_FLOOR_N);  // #4459
                             } else if (self_intersects(cp_x, cp_y, cp_l, cn_x, cn_y, cn_l,
                                                        false, true, p_ep, n_ep)) {
-                                rej("asym_trail_n");  // #4459
+                                rej(REJ_ASYM_TRAIL_N);  // #4459
                             } else {
                                 double cost = rules_.cost_straight;
                                 bool dir_changed =
@@ -598,10 +816,10 @@ CoupledRouteResult CoupledPathfinder::route(
                            at_goal(current.n_x, current.n_y, n_start_x, n_start_y);
             for (int new_layer : routable_layers) {
                 if (new_layer == current.p_layer) continue;
-                if (!p_at_ep && is_via_blocked(current.p_x, current.p_y, p_net)) { rej("via_blocked_p"); continue; }
-                if (!n_at_ep && is_via_blocked(current.n_x, current.n_y, n_net)) { rej("via_blocked_n"); continue; }
-                if (!p_at_ep && is_trace_blocked(current.p_x, current.p_y, new_layer, p_net)) { rej("via_trace_blocked_p"); continue; }
-                if (!n_at_ep && is_trace_blocked(current.n_x, current.n_y, new_layer, n_net)) { rej("via_trace_blocked_n"); continue; }
+                if (!p_at_ep && is_via_blocked(current.p_x, current.p_y, p_net)) { rej(REJ_VIA_BLOCKED_P); continue; }
+                if (!n_at_ep && is_via_blocked(current.n_x, current.n_y, n_net)) { rej(REJ_VIA_BLOCKED_N); continue; }
+                if (!p_at_ep && is_trace_blocked(current.p_x, current.p_y, new_layer, p_net)) { rej(REJ_VIA_TRACE_BLOCKED_P); continue; }
+                if (!n_at_ep && is_trace_blocked(current.n_x, current.n_y, new_layer, n_net)) { rej(REJ_VIA_TRACE_BLOCKED_N); continue; }
                 double cost = rules_.cost_via * 2.0;
                 // Issue #4080: corridor attractor on the via-drop
                 // destination cells -- the reservation is what makes the
@@ -619,6 +837,29 @@ CoupledRouteResult CoupledPathfinder::route(
                                      current.n_x, current.n_y, new_layer,
                                      current.dir_dx, current.dir_dy, cost, true});
             }
+
+            // Issue #2473: polarity-swap via (diffpair_routing.py, the
+            // ``allow_swap_via`` branch of ``_get_coupled_neighbors``).  Both
+            // heads drop a via and re-emerge on ``new_layer`` with their
+            // positions exchanged.  The landing cells get NO endpoint
+            // exemption, exactly as in Python.  Rejections reuse the via
+            // guard vocabulary.
+            if (allow_swap_via_) {
+                for (int new_layer : routable_layers) {
+                    if (new_layer == current.p_layer) continue;
+                    if (!p_at_ep && is_via_blocked(current.p_x, current.p_y, p_net)) { rej(REJ_VIA_BLOCKED_P); continue; }
+                    if (!n_at_ep && is_via_blocked(current.n_x, current.n_y, n_net)) { rej(REJ_VIA_BLOCKED_N); continue; }
+                    // After the swap P continues from N's cell and vice versa.
+                    if (is_trace_blocked(current.n_x, current.n_y, new_layer, p_net)) { rej(REJ_VIA_TRACE_BLOCKED_P); continue; }
+                    if (is_trace_blocked(current.p_x, current.p_y, new_layer, n_net)) { rej(REJ_VIA_TRACE_BLOCKED_N); continue; }
+                    // Costlier than a plain via pair to discourage gratuitous
+                    // swaps; the direction resets because the orientation
+                    // has inverted.
+                    neighbors.push_back({current.n_x, current.n_y, new_layer,
+                                         current.p_x, current.p_y, new_layer,
+                                         0, 0, rules_.cost_via * 3.0, true});
+                }
+            }
         }
 
         // Expand neighbors into the open set (diffpair_routing.py:1842-1890).
@@ -626,20 +867,29 @@ CoupledRouteResult CoupledPathfinder::route(
             // Corridor pruning (diffpair_routing.py:1864-1871).
             if (have_corridor) {
                 if (!in_corridor(c.px, c.py) || !in_corridor(c.nx, c.ny)) {
-                    rej("corridor");  // #4459
+                    rej(REJ_CORRIDOR);  // #4459
                     continue;
                 }
             }
-            JointKey nkey = joint_key(c.px, c.py, c.pl, c.nx, c.ny, c.nl);
-            if (closed_set.count(nkey)) continue;
+            // Defensive: every candidate is on-grid by construction (see
+            // ``joint_key`` above); an off-grid joint state has no table key.
+            if (!on_grid(c.px, c.py, c.pl) || !on_grid(c.nx, c.ny, c.nl)) continue;
+            JointStateTable::Slot* nslot =
+                joint_table_.find_or_insert(joint_key(c.px, c.py, c.pl, c.nx, c.ny, c.nl));
+            if (nslot->closed) continue;
 
             float new_g = current.g_score + static_cast<float>(c.cost);
-            auto git = g_scores.find(nkey);
-            if (git == g_scores.end() || new_g < git->second) {
-                g_scores[nkey] = new_g;
-                double h = heuristic(c.px, c.py, c.pl, c.nx, c.ny, c.nl,
-                                     p_goal_x, p_goal_y, end_layer,
-                                     n_goal_x, n_goal_y, end_layer);
+            if (new_g < nslot->g_score) {
+                double h = joint_heuristic(c.px, c.py, c.pl, c.nx, c.ny, c.nl,
+                                           c.ddx, c.ddy);
+                if (std::isinf(h)) {
+                    // Goal unreachable from this joint state (distance
+                    // heuristic only).  Close it so it is never re-scored.
+                    nslot->closed = true;
+                    rej(REJ_UNREACHABLE);
+                    continue;
+                }
+                nslot->g_score = new_g;
                 float f = new_g + static_cast<float>(heuristic_weight_ * h);
                 CoupledAStarNode node;
                 node.p_x = c.px; node.p_y = c.py; node.p_layer = c.pl;
@@ -650,7 +900,8 @@ CoupledRouteResult CoupledPathfinder::route(
                 node.parent_idx = current_idx;
                 node.via_from_parent = c.is_via;
                 node.seq = seq_counter++;
-                open_set.push(node);
+                open_set.push_back(node);
+                std::push_heap(open_set.begin(), open_set.end(), node_greater);
             }
         }
     }
@@ -659,8 +910,195 @@ CoupledRouteResult CoupledPathfinder::route(
     result.success = false;
     result.iterations = static_cast<int>(iterations);
     result.best_progress = best_progress;
-    result.rejections = std::move(rejections);  // #4459
+    result.rejections = rejections;  // #4459
     return result;
 }
 
+bool CoupledPathfinder::path_conflicts(const CoupledPairRequest& req,
+                                       const CoupledRouteResult& res) const {
+    const uint64_t endpoints[4] = {
+        xy_key(req.p_start_x, req.p_start_y), xy_key(req.p_goal_x, req.p_goal_y),
+        xy_key(req.n_start_x, req.n_start_y), xy_key(req.n_goal_x, req.n_goal_y)};
+    auto is_endpoint = [&endpoints](int x, int y) {
+        const uint64_t k = xy_key(x, y);
+        return k == endpoints[0] || k == endpoints[1] ||
+               k == endpoints[2] || k == endpoints[3];
+    };
+    auto foreign = [&](int x, int y, int layer, int net) {
+        if (x < 0 || x >= cols_ || y < 0 || y >= rows_) return false;
+        if (layer < 0 || layer >= num_layers_) return false;
+        const int32_t owner = batch_claims_[cell_index(x, y, layer)];
+        return owner != kNoClaim && owner != net;
+    };
+    // Same footprint as ``is_via_blocked``: the via-extra square on every
+    // layer.
+    auto via_conflicts = [&](int x, int y, int net) {
+        if (is_endpoint(x, y)) return false;
+        for (int layer = 0; layer < num_layers_; ++layer) {
+            for (int dy = -via_extra_cells_; dy <= via_extra_cells_; ++dy) {
+                for (int dx = -via_extra_cells_; dx <= via_extra_cells_; ++dx) {
+                    if (foreign(x + dx, y + dy, layer, net)) return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    for (size_t k = 0; k < res.path.size(); ++k) {
+        const CoupledPathNode& node = res.path[k];
+        if (!is_endpoint(node.p_x, node.p_y) &&
+            foreign(node.p_x, node.p_y, node.p_layer, req.p_net)) return true;
+        if (!is_endpoint(node.n_x, node.n_y) &&
+            foreign(node.n_x, node.n_y, node.n_layer, req.n_net)) return true;
+        if (node.via_from_parent && k > 0) {
+            const CoupledPathNode& parent = res.path[k - 1];
+            if (via_conflicts(parent.p_x, parent.p_y, req.p_net)) return true;
+            if (via_conflicts(parent.n_x, parent.n_y, req.n_net)) return true;
+        }
+    }
+    return false;
+}
+
+void CoupledPathfinder::claim_path(const CoupledPairRequest& req,
+                                   const CoupledRouteResult& res) {
+    // First claim wins: a cell inside both heads' envelopes stays with the
+    // head that reached it first, which blocks every other pair equally.
+    auto claim_square = [&](int cx, int cy, int layer, int radius, int net) {
+        const int x0 = std::max(0, cx - radius), x1 = std::min(cols_ - 1, cx + radius);
+        const int y0 = std::max(0, cy - radius), y1 = std::min(rows_ - 1, cy + radius);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                int32_t& owner = batch_claims_[cell_index(x, y, layer)];
+                if (owner == kNoClaim) owner = net;
+            }
+        }
+    };
+
+    for (size_t k = 0; k < res.path.size(); ++k) {
+        const CoupledPathNode& node = res.path[k];
+        claim_square(node.p_x, node.p_y, node.p_layer, claim_trace_radius_, req.p_net);
+        claim_square(node.n_x, node.n_y, node.n_layer, claim_trace_radius_, req.n_net);
+        if (node.via_from_parent && k > 0) {
+            const CoupledPathNode& parent = res.path[k - 1];
+            for (int layer = 0; layer < num_layers_; ++layer) {
+                claim_square(parent.p_x, parent.p_y, layer, claim_via_radius_, req.p_net);
+                claim_square(parent.n_x, parent.n_y, layer, claim_via_radius_, req.n_net);
+            }
+        }
+    }
+}
+
+CoupledBatchResult CoupledPathfinder::route_batch(
+    const std::vector<CoupledPairRequest>& requests,
+    int num_threads,
+    int max_rounds) {
+
+    CoupledBatchResult out;
+    const size_t count = requests.size();
+    out.results.resize(count);
+    out.committed.assign(count, 0);
+    out.requeues.assign(count, 0);
+    if (count == 0) return out;
+
+    cols_ = grid_.cols();
+    rows_ = grid_.rows();
+    num_layers_ = grid_.layers();
+    batch_claims_.assign(static_cast<size_t>(cols_) * rows_ * num_layers_, kNoClaim);
+
+    // Commit order: priority, then request index (stable sort).
+    std::vector<int> pending(count);
+    std::iota(pending.begin(), pending.end(), 0);
+    std::stable_sort(pending.begin(), pending.end(), [&requests](int a, int b) {
+        return requests[a].priority < requests[b].priority;
+    });
+
+    size_t threads = num_threads > 0
+                         ? static_cast<size_t>(num_threads)
+                         : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::min(threads, count);
+
+    // Worker 0 is this pathfinder; the others are private clones of its
+    // configuration (the search scratch state is per instance).
+    std::vector<std::unique_ptr<CoupledPathfinder>> clones;
+    std::vector<CoupledPathfinder*> workers{this};
+    for (size_t t = 1; t < threads; ++t) {
+        auto clone = std::make_unique<CoupledPathfinder>(
+            grid_, rules_, target_spacing_cells_, min_spacing_cells_,
+            trace_half_width_cells_, via_extra_cells_, via_drill_cells_,
+            spacing_penalty_factor_, heuristic_weight_);
+        clone->distance_heuristic_ = distance_heuristic_;
+        clone->allow_swap_via_ = allow_swap_via_;
+        clone->heuristic_mode_ = heuristic_mode_;
+        workers.push_back(clone.get());
+        clones.push_back(std::move(clone));
+    }
+    for (CoupledPathfinder* pf : workers) pf->claims_ = batch_claims_.data();
+
+    while (!pending.empty() && (max_rounds <= 0 || out.rounds < max_rounds)) {
+        ++out.rounds;
+
+        // Search phase: the grid and the claim overlay are read-only until
+        // every worker has joined.
+        std::atomic<size_t> next{0};
+        std::exception_ptr failure;
+        std::mutex failure_mutex;
+        auto work = [&](CoupledPathfinder* pf) {
+            try {
+                for (size_t k = next.fetch_add(1); k < pending.size();
+                     k = next.fetch_add(1)) {
+                    const CoupledPairRequest& r = requests[pending[k]];
+                    out.results[pending[k]] = pf->route(
+                        r.p_start_x, r.p_start_y, r.n_start_x, r.n_start_y,
+                        r.start_layer,
+                        r.p_goal_x, r.p_goal_y, r.n_goal_x, r.n_goal_y,
+                        r.end_layer, r.p_net, r.n_net,
+                        r.effective_target_spacing, r.effective_approach_radius,
+                        r.effective_departure_radius, r.routable_layers,
+                        r.corridor_bitset, r.max_iterations_budget,
+                        r.timeout_seconds);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(failure_mutex);
+                if (!failure) failure = std::current_exception();
+                next.store(pending.size());
+            }
+        };
+        const size_t active = std::min(workers.size(), pending.size());
+        std::vector<std::thread> pool;
+        for (size_t t = 1; t < active; ++t) pool.emplace_back(work, workers[t]);
+        work(workers[0]);
+        for (std::thread& th : pool) th.join();
+        if (failure) {
+            for (CoupledPathfinder* pf : workers) pf->claims_ = nullptr;
+            std::rethrow_exception(failure);
+        }
+
+        // Commit phase, serial in priority order (``pending`` keeps it).
+        std::vector<int> requeued;
+        for (int i : pending) {
+            const CoupledRouteResult& res = out.results[i];
+            if (!res.success) continue;
+            if (path_conflicts(requests[i], res)) {
+                ++out.requeues[i];
+                requeued.push_back(i);
+                continue;
+            }
+            claim_path(requests[i], res);
+            out.committed[i] = 1;
+            out.commit_order.push_back(i);
+        }
+        pending.swap(requeued);
+    }
+
+    // Round limit hit with pairs still conflicting: their last paths were
+    // never committed, so they are reported as failures.
+    for (int i : pending) {
+        out.results[i].success = false;
+        out.results[i].path.clear();
+    }
+    for (CoupledPathfinder* pf : workers) pf->claims_ = nullptr;
+    std::vector<int32_t>().swap(batch_claims_);
+    return out;
+}
+
 }  // namespace router
@@ -0,0 +1,530 @@
+/*
+ * Router C++ Core - package escape (fanout) planner
+ *
+ * See escape.hpp for the patterns and the legality model.
+ */
+
+#include "escape.hpp"
+#include "geometry.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace router {
+
+namespace {
+
+constexpr float kEps = 1e-4f;  // CLEARANCE_EPSILON_MM (grid.cpp)
+
+struct Clearances {
+    float trace = 0.0f;
+    float via = 0.0f;
+    float drill = 0.0f;
+};
+
+struct Box {
+    float x0, y0, x1, y1;
+    bool overlaps(const Box& o) const {
+        return x0 <= o.x1 && o.x0 <= x1 && y0 <= o.y1 && o.y0 <= y1;
+    }
+};
+
+// Copper extent of a stub, grown by ``margin``.
+Box stub_box(const EscapeStub& s, float margin) {
+    Box b{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+          std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+    auto grow = [&](float x, float y, float r) {
+        b.x0 = std::min(b.x0, x - r - margin);
+        b.y0 = std::min(b.y0, y - r - margin);
+        b.x1 = std::max(b.x1, x + r + margin);
+        b.y1 = std::max(b.y1, y + r + margin);
+    };
+    for (const Segment& seg : s.segments) {
+        grow(seg.x1, seg.y1, seg.width / 2);
+        grow(seg.x2, seg.y2, seg.width / 2);
+    }
+    if (s.has_via) grow(s.via.x, s.via.y, s.via.diameter / 2);
+    return b;
+}
+
+inline bool via_spans(const Via& v, int layer) {
+    return layer >= std::min(v.layer_from, v.layer_to) &&
+           layer <= std::max(v.layer_from, v.layer_to);
+}
+
+// Signed copper distance from a segment centerline to a pad (as in
+// ``Grid3D::validate_route``: disc for square pads, rectangle otherwise).
+float pad_centerline_distance(const PadInfo& pad, float x1, float y1, float x2, float y2) {
+    if (std::abs(pad.width - pad.height) < 0.001f) {
+        return point_to_segment_distance(pad.x, pad.y, x1, y1, x2, y2) -
+               std::max(pad.width, pad.height) / 2;
+    }
+    return rect_segment_centerline_distance(pad.x, pad.y, pad.width, pad.height, x1, y1, x2, y2);
+}
+
+// Two stubs of one package: copper clearances between different nets,
+// hole-to-hole spacing between any two vias.
+bool stubs_clash(const EscapeStub& a, const EscapeStub& b, const Clearances& c) {
+    const bool foreign = a.net != b.net;
+    if (foreign) {
+        for (const Segment& sa : a.segments) {
+            for (const Segment& sb : b.segments) {
+                if (sa.layer != sb.layer) continue;
+                const float d = segment_to_segment_distance(sa.x1, sa.y1, sa.x2, sa.y2,
+                                                            sb.x1, sb.y1, sb.x2, sb.y2);
+                if (d - sa.width / 2 - sb.width / 2 < c.trace - kEps) return true;
+            }
+        }
+        auto seg_via = [&](const EscapeStub& s, const EscapeStub& v) {
+            if (!v.has_via) return false;
+            for (const Segment& seg : s.segments) {
+                if (!via_spans(v.via, seg.layer)) continue;
+                const float d = point_to_segment_distance(v.via.x, v.via.y, seg.x1, seg.y1,
+                                                          seg.x2, seg.y2);
+                if (d - seg.width / 2 - v.via.diameter / 2 < std::max(c.trace, c.via) - kEps) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        if (seg_via(a, b) || seg_via(b, a)) return true;
+    }
+    if (a.has_via && b.has_via) {
+        const float d = std::hypot(a.via.x - b.via.x, a.via.y - b.via.y);
+        if (foreign && d - a.via.diameter / 2 - b.via.diameter / 2 < c.via - kEps) return true;
+        if (d > 1e-6f && d - a.via.drill / 2 - b.via.drill / 2 < c.drill - kEps) return true;
+    }
+    return false;
+}
+
+// Board state near the package, filtered once per ``plan``.
+struct LocalBoard {
+    std::vector<const PadInfo*> pads;
+    std::vector<const StoredSegment*> segments;
+    std::vector<const StoredVia*> vias;
+};
+
+}  // namespace
+
+EscapePlanner::EscapePlanner(Grid3D& grid, const DesignRules& rules)
+    : grid_(grid), rules_(rules) {}
+
+std::vector<EscapeStub> EscapePlanner::plan(const std::vector<EscapePin>& pins,
+                                            const EscapeConfig& config) const {
+    const size_t n = pins.size();
+    std::vector<EscapeStub> out(n);
+    last_candidates_ = 0;
+    if (n == 0) return out;
+
+    const float tw = rules_.trace_width;
+    const float esc = config.escape_clearance > 0.0f ? config.escape_clearance
+                                                      : 2.0f * rules_.trace_clearance;
+    const float via_spacing = config.via_spacing > 0.0f
+                                  ? config.via_spacing
+                                  : rules_.via_diameter + rules_.via_clearance;
+    const Clearances clr{rules_.trace_clearance, rules_.via_clearance,
+                         config.min_drill_clearance > 0.0f ? config.min_drill_clearance
+                                                           : rules_.min_drill_clearance};
+
+    // Package frame: pin-center extent, copper extent, center, pitch.
+    Box centers{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+    Box metal = centers;
+    for (const EscapePin& p : pins) {
+        centers = {std::min(centers.x0, p.x), std::min(centers.y0, p.y),
+                   std::max(centers.x1, p.x), std::max(centers.y1, p.y)};
+        metal = {std::min(metal.x0, p.x - p.width / 2), std::min(metal.y0, p.y - p.height / 2),
+                 std::max(metal.x1, p.x + p.width / 2), std::max(metal.y1, p.y + p.height / 2)};
+    }
+    const float cx = (centers.x0 + centers.x1) / 2;
+    const float cy = (centers.y0 + centers.y1) / 2;
+    float pitch = std::numeric_limits<float>::max();
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = i + 1; j < n; ++j) {
+            const float d = std::hypot(pins[i].x - pins[j].x, pins[i].y - pins[j].y);
+            if (d > 0.001f) pitch = std::min(pitch, d);
+        }
+    }
+    if (pitch == std::numeric_limits<float>::max()) pitch = via_spacing;
+    const float half = pitch / 2;
+
+    auto inner_layer = [&](int ring) {
+        if (config.inner_layers.empty()) return -1;
+        const int k = std::max(0, ring - 1) % static_cast<int>(config.inner_layers.size());
+        return config.inner_layers[k];
+    };
+    // Distance from the pin center to ``esc`` past the package copper.
+    auto edge_reach = [&](const EscapePin& p, float dx, float dy) {
+        if (dx > 0) return metal.x1 + esc - p.x;
+        if (dx < 0) return p.x - metal.x0 + esc;
+        if (dy > 0) return metal.y1 + esc - p.y;
+        return p.y - metal.y0 + esc;
+    };
+    auto segment = [&](float x1, float y1, float x2, float y2, int layer, int net) {
+        return Segment{x1, y1, x2, y2, tw, layer, net};
+    };
+    auto make_via = [&](float x, float y, int from, int to, int net) {
+        return Via{x, y, rules_.via_drill, rules_.via_diameter, from, to, net};
+    };
+    auto finish = [](EscapeStub& s, float ex, float ey, int layer) {
+        s.escape_x = ex;
+        s.escape_y = ey;
+        s.escape_layer = layer;
+    };
+
+    // Candidate stubs per pin, best first.
+    std::vector<std::vector<EscapeStub>> candidates(n);
+    std::vector<int> ring(n, 0);
+
+    // ESCAPE_ALTERNATING: edge membership and index along the edge.
+    const float edge_margin = std::min(centers.x1 - centers.x0, centers.y1 - centers.y0) * 0.2f;
+    std::vector<int> edge_of(n, -1), edge_rank(n, 0);
+    if (config.pattern == ESCAPE_ALTERNATING) {
+        std::vector<std::vector<size_t>> edges(4);  // N, S, E, W
+        for (size_t i = 0; i < n; ++i) {
+            const EscapePin& p = pins[i];
+            if (std::abs(p.x - cx) < edge_margin && std::abs(p.y - cy) < edge_margin) continue;
+            // Nearest side wins, so corner pins of a side row stay on it.
+            const float gap[4] = {std::abs(p.y - centers.y1), std::abs(p.y - centers.y0),
+                                  std::abs(p.x - centers.x1), std::abs(p.x - centers.x0)};
+            const int e = static_cast<int>(std::min_element(gap, gap + 4) - gap);
+            if (gap[e] < edge_margin) edges[e].push_back(i);
+        }
+        for (int e = 0; e < 4; ++e) {
+            std::sort(edges[e].begin(), edges[e].end(), [&](size_t a, size_t b) {
+                return e < 2 ? pins[a].x < pins[b].x : pins[a].y < pins[b].y;
+            });
+            for (size_t k = 0; k < edges[e].size(); ++k) {
+                edge_of[edges[e][k]] = e;
+                edge_rank[edges[e][k]] = static_cast<int>(k);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        const EscapePin& p = pins[i];
+        EscapeStub& base = out[i];
+        base.pin = static_cast<int>(i);
+        base.net = p.net;
+        base.status = ESCAPE_SKIPPED;
+        const float dxc = p.x - cx, dyc = p.y - cy;
+        const float sx = dxc < 0 ? -1.0f : 1.0f;
+        const float sy = dyc < 0 ? -1.0f : 1.0f;
+        // Dominant-axis outward direction (``_get_quadrant_direction``).
+        if (std::abs(dxc) > std::abs(dyc)) {
+            base.dir_x = sx;
+        } else {
+            base.dir_y = sy;
+        }
+        if (p.net == 0 || p.layer < 0) continue;
+
+        auto straight = [&](float dx, float dy) {
+            EscapeStub s = base;
+            s.dir_x = dx;
+            s.dir_y = dy;
+            const float reach = edge_reach(p, dx, dy);
+            const float ex = p.x + dx * reach, ey = p.y + dy * reach;
+            s.segments.push_back(segment(p.x, p.y, ex, ey, p.layer, p.net));
+            finish(s, ex, ey, p.layer);
+            return s;
+        };
+        // Dog-bone to (p + o); with ``channel`` the stub continues on the
+        // via layer back onto the pin's row / column and out past the edge.
+        auto dogbone = [&](float ox, float oy, int layer, bool channel) {
+            EscapeStub s = base;
+            const float vx = p.x + ox, vy = p.y + oy;
+            s.segments.push_back(segment(p.x, p.y, vx, vy, p.layer, p.net));
+            s.has_via = true;
+            s.via = make_via(vx, vy, p.layer, layer, p.net);
+            finish(s, vx, vy, layer);
+            if (!channel) return s;
+            // Offset across the escape direction, and the jog that removes it.
+            const float px = s.dir_x == 0.0f ? ox : 0.0f;
+            const float py = s.dir_y == 0.0f ? oy : 0.0f;
+            const float jog = std::hypot(px, py);
+            const float jx = vx - px + s.dir_x * jog, jy = vy - py + s.dir_y * jog;
+            const float reach = edge_reach(p, s.dir_x, s.dir_y);
+            const float ex = s.dir_x != 0.0f ? p.x + s.dir_x * reach : jx;
+            const float ey = s.dir_y != 0.0f ? p.y + s.dir_y * reach : jy;
+            if ((ex - jx) * s.dir_x + (ey - jy) * s.dir_y <= 0.0f) return s;
+            s.segments.push_back(segment(vx, vy, jx, jy, layer, p.net));
+            s.segments.push_back(segment(jx, jy, ex, ey, layer, p.net));
+            finish(s, ex, ey, layer);
+            return s;
+        };
+        // Diagonals, the preferred one first, the inward one last.
+        auto diagonals = [&](float fx, float fy) {
+            return std::vector<std::pair<float, float>>{
+                {fx * half, fy * half}, {fx * half, -fy * half},
+                {-fx * half, fy * half}, {-fx * half, -fy * half}};
+        };
+
+        std::vector<EscapeStub>& cand = candidates[i];
+        if (config.pattern == ESCAPE_RING) {
+            const float edge_gap = std::min(std::min(p.x - centers.x0, centers.x1 - p.x),
+                                            std::min(p.y - centers.y0, centers.y1 - p.y));
+            ring[i] = std::max(0, static_cast<int>(std::lround(edge_gap / pitch)));
+            base.ring = ring[i];
+            if (ring[i] == 0) {
+                cand.push_back(straight(base.dir_x, base.dir_y));
+                // Corner balls may also leave along the other axis.
+                if (base.dir_x != 0.0f) cand.push_back(straight(0.0f, sy));
+                else cand.push_back(straight(sx, 0.0f));
+            } else {
+                const int layer = inner_layer(ring[i]);
+                if (layer >= 0 && layer != p.layer) {
+                    const auto diag = diagonals(sx, sy);
+                    for (const auto& [ox, oy] : diag) cand.push_back(dogbone(ox, oy, layer, true));
+                    for (const auto& [ox, oy] : diag) cand.push_back(dogbone(ox, oy, layer, false));
+                }
+                cand.push_back(straight(base.dir_x, base.dir_y));
+            }
+        } else if (config.pattern == ESCAPE_ALTERNATING) {
+            if (edge_of[i] < 0) continue;
+            static constexpr float kNormal[4][2] = {{0, 1}, {0, -1}, {1, 0}, {-1, 0}};
+            const float dx = kNormal[edge_of[i]][0], dy = kNormal[edge_of[i]][1];
+            base.dir_x = dx;
+            base.dir_y = dy;
+            const float extent = dx != 0.0f ? p.width / 2 : p.height / 2;
+            const float short_len = extent + esc + 2.0f * tw;
+            auto stub = [&](float len, bool via) {
+                EscapeStub s = base;
+                const float ex = p.x + dx * len, ey = p.y + dy * len;
+                s.segments.push_back(segment(p.x, p.y, ex, ey, p.layer, p.net));
+                finish(s, ex, ey, p.layer);
+                const int layer = inner_layer(1);
+                if (via && layer >= 0 && layer != p.layer) {
+                    s.has_via = true;
+                    s.via = make_via(ex, ey, p.layer, layer, p.net);
+                    s.escape_layer = layer;
+                }
+                return s;
+            };
+            const bool long_first = edge_rank[i] % 2 == 1;
+            if (long_first) cand.push_back(stub(short_len + via_spacing, true));
+            cand.push_back(stub(short_len, false));
+            if (!long_first) cand.push_back(stub(short_len + via_spacing, true));
+        }
+        if (!cand.empty()) base.status = ESCAPE_BLOCKED;
+    }
+
+    // Board state within reach of any candidate.
+    float reach_margin = std::max(rules_.via_diameter, tw) + esc + via_spacing + pitch +
+                         std::max(rules_.trace_clearance, rules_.via_clearance);
+    Box area{metal.x0 - reach_margin, metal.y0 - reach_margin, metal.x1 + reach_margin,
+             metal.y1 + reach_margin};
+    LocalBoard board;
+    for (const PadInfo& pad : grid_.pads()) {
+        const float r = std::max(pad.width, pad.height) / 2;
+        if (area.overlaps({pad.x - r, pad.y - r, pad.x + r, pad.y + r})) board.pads.push_back(&pad);
+    }
+    for (const StoredSegment& seg : grid_.stored_segments()) {
+        const Box b{std::min(seg.x1, seg.x2), std::min(seg.y1, seg.y2),
+                    std::max(seg.x1, seg.x2), std::max(seg.y1, seg.y2)};
+        if (area.overlaps(b)) board.segments.push_back(&seg);
+    }
+    for (const StoredVia& via : grid_.stored_vias()) {
+        if (area.overlaps({via.x, via.y, via.x, via.y})) board.vias.push_back(&via);
+    }
+
+    const float res = grid_.resolution();
+    // Net-0 keep-out cells (board edge, mechanical keep-outs).
+    auto keepout = [&](float x, float y, int layer) {
+        const auto [gx, gy] = grid_.world_to_grid(x, y);
+        if (!grid_.is_valid(gx, gy, layer)) return true;
+        const GridCell& cell = grid_.at(gx, gy, layer);
+        return cell.is_obstacle && cell.net == 0 && !cell.pad_blocked;
+    };
+    auto board_legal = [&](const EscapeStub& s) {
+        for (const Segment& seg : s.segments) {
+            const float len = std::hypot(seg.x2 - seg.x1, seg.y2 - seg.y1);
+            const int steps = std::max(1, static_cast<int>(std::ceil(len / (res / 2))));
+            for (int k = 0; k <= steps; ++k) {
+                const float t = static_cast<float>(k) / steps;
+                if (keepout(seg.x1 + (seg.x2 - seg.x1) * t, seg.y1 + (seg.y2 - seg.y1) * t,
+                            seg.layer)) {
+                    return false;
+                }
+            }
+            for (const PadInfo* pad : board.pads) {
+                if (pad->net == s.net) continue;
+                if (pad->layer_idx != -1 && pad->layer_idx != seg.layer) continue;
+                const float need =
+                    pad->clearance_override > 0.0f ? pad->clearance_override : clr.trace;
+                const float d = pad_centerline_distance(*pad, seg.x1, seg.y1, seg.x2, seg.y2);
+                if (d - seg.width / 2 < need - kEps) return false;
+            }
+            for (const StoredSegment* other : board.segments) {
+                if (other->net == s.net || other->layer_idx != seg.layer) continue;
+                const float d = segment_to_segment_distance(seg.x1, seg.y1, seg.x2, seg.y2,
+                                                            other->x1, other->y1,
+                                                            other->x2, other->y2);
+                if (d - seg.width / 2 - other->width / 2 < clr.trace - kEps) return false;
+            }
+            for (const StoredVia* via : board.vias) {
+                if (via->net == s.net) continue;
+                const float d = point_to_segment_distance(via->x, via->y, seg.x1, seg.y1,
+                                                          seg.x2, seg.y2);
+                if (d - seg.width / 2 - via->diameter / 2 < clr.trace - kEps) return false;
+            }
+        }
+        if (!s.has_via) return true;
+        const Via& v = s.via;
+        const float vr = v.diameter / 2;
+        const int lo = std::min(v.layer_from, v.layer_to), hi = std::max(v.layer_from, v.layer_to);
+        const int cells = static_cast<int>(std::ceil(vr / res));
+        for (int layer = lo; layer <= hi; ++layer) {
+            for (int oy = -cells; oy <= cells; ++oy) {
+                for (int ox = -cells; ox <= cells; ++ox) {
+                    if (ox * ox + oy * oy > cells * cells) continue;
+                    if (keepout(v.x + ox * res, v.y + oy * res, layer)) return false;
+                }
+            }
+        }
+        for (const PadInfo* pad : board.pads) {
+            if (pad->net == s.net) continue;
+            if (pad->layer_idx != -1 && (pad->layer_idx < lo || pad->layer_idx > hi)) continue;
+            const float need = pad->clearance_override > 0.0f ? pad->clearance_override : clr.via;
+            if (pad_centerline_distance(*pad, v.x, v.y, v.x, v.y) - vr < need - kEps) return false;
+        }
+        for (const StoredSegment* seg : board.segments) {
+            if (seg->net == s.net || seg->layer_idx < lo || seg->layer_idx > hi) continue;
+            const float d = point_to_segment_distance(v.x, v.y, seg->x1, seg->y1, seg->x2, seg->y2);
+            if (d - vr - seg->width / 2 < clr.via - kEps) return false;
+        }
+        for (const StoredVia* other : board.vias) {
+            const float d = std::hypot(v.x - other->x, v.y - other->y);
+            if (other->net != s.net && d - vr - other->diameter / 2 < clr.via - kEps) return false;
+            if (d > 1e-6f && d - v.drill / 2 - other->drill / 2 < clr.drill - kEps) return false;
+        }
+        return true;
+    };
+
+    // Board check, in parallel over pins.
+    std::vector<std::vector<uint8_t>> legal(n);
+    int total = 0;
+    for (size_t i = 0; i < n; ++i) {
+        legal[i].assign(candidates[i].size(), 0);
+        total += static_cast<int>(candidates[i].size());
+    }
+    last_candidates_ = total;
+
+    size_t threads = config.num_threads > 0
+                         ? static_cast<size_t>(config.num_threads)
+                         : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, n / 16 + 1));
+    std::atomic<size_t> next{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    auto work = [&]() {
+        try {
+            for (size_t i = next.fetch_add(1); i < n; i = next.fetch_add(1)) {
+                for (size_t k = 0; k < candidates[i].size(); ++k) {
+                    legal[i][k] = board_legal(candidates[i][k]) ? 1 : 0;
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failure_mutex);
+            if (!failure) failure = std::current_exception();
+            next.store(n);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(work);
+    work();
+    for (std::thread& th : pool) th.join();
+    if (failure) std::rethrow_exception(failure);
+
+    // Outer ring first; each pin takes its first candidate that clears the
+    // stubs already accepted.
+    std::vector<size_t> order(n);
+    for (size_t i = 0; i < n; ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return ring[a] < ring[b]; });
+    const float box_margin = std::max(clr.trace, clr.via) + std::max(clr.drill, 0.0f);
+    std::vector<size_t> accepted;
+    std::vector<Box> accepted_box;
+    for (size_t i : order) {
+        bool any_legal = false;
+        for (size_t k = 0; k < candidates[i].size(); ++k) {
+            if (!legal[i][k]) continue;
+            any_legal = true;
+            const EscapeStub& c = candidates[i][k];
+            const Box box = stub_box(c, box_margin);
+            bool clash = false;
+            for (size_t a = 0; a < accepted.size() && !clash; ++a) {
+                clash = box.overlaps(accepted_box[a]) && stubs_clash(c, out[accepted[a]], clr);
+            }
+            if (clash) continue;
+            out[i] = c;
+            out[i].status = ESCAPE_OK;
+            accepted.push_back(i);
+            accepted_box.push_back(box);
+            break;
+        }
+        if (out[i].status != ESCAPE_OK && any_legal) out[i].status = ESCAPE_CONFLICT;
+    }
+    return out;
+}
+
+int EscapePlanner::commit(const std::vector<EscapeStub>& stubs, const EscapeConfig& config,
+                          bool store_geometry, bool reserve) {
+    const float res = grid_.resolution();
+    int committed = 0;
+    for (const EscapeStub& s : stubs) {
+        if (s.status != ESCAPE_OK) continue;
+        ++committed;
+        // Radii as in ``RoutingCore._mark_route_on_cpp_grid``.
+        for (const Segment& seg : s.segments) {
+            if (store_geometry) {
+                grid_.add_stored_segment(seg.x1, seg.y1, seg.x2, seg.y2, seg.width, seg.layer,
+                                         seg.net);
+            }
+            const int clearance_cells =
+                static_cast<int>((seg.width / 2 + rules_.trace_clearance) / res) + 1;
+            const auto [x1, y1] = grid_.world_to_grid(seg.x1, seg.y1);
+            const auto [x2, y2] = grid_.world_to_grid(seg.x2, seg.y2);
+            grid_.mark_segment(x1, y1, x2, y2, seg.layer, seg.net, clearance_cells);
+        }
+        if (s.has_via) {
+            if (store_geometry) {
+                grid_.add_stored_via(s.via.x, s.via.y, s.via.drill, s.via.diameter, s.net);
+            }
+            const int radius_cells =
+                static_cast<int>(std::ceil((s.via.diameter / 2 + rules_.via_clearance +
+                                            rules_.trace_width / 2) / res)) + 1;
+            const auto [gx, gy] = grid_.world_to_grid(s.via.x, s.via.y);
+            grid_.mark_via(gx, gy, s.net, radius_cells);
+        }
+        if (reserve) {
+            for (const auto& [x, y] : corridor_cells(s, config)) {
+                grid_.reserve_cell(x, y, s.escape_layer, {s.net}, true);
+            }
+        }
+    }
+    return committed;
+}
+
+std::vector<std::pair<int, int>> EscapePlanner::corridor_cells(const EscapeStub& stub,
+                                                               const EscapeConfig& config) const {
+    std::vector<std::pair<int, int>> cells;
+    if (stub.status != ESCAPE_OK || config.corridor_cells <= 0) return cells;
+    const float res = grid_.resolution();
+    for (int k = 1; k <= config.corridor_cells; ++k) {
+        const auto [gx, gy] = grid_.world_to_grid(stub.escape_x + stub.dir_x * k * res,
+                                                  stub.escape_y + stub.dir_y * k * res);
+        if (!grid_.is_valid(gx, gy, stub.escape_layer)) break;
+        const GridCell& cell = grid_.at(gx, gy, stub.escape_layer);
+        // Never overwrite another reservation or claim foreign copper.
+        if (cell.reserved_count > 0 || (cell.blocked && cell.net != stub.net)) break;
+        if (cells.empty() || cells.back() != std::make_pair(gx, gy)) cells.emplace_back(gx, gy);
+    }
+    return cells;
+}
+
+}  // namespace router
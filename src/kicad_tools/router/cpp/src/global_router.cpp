@@ -0,0 +1,386 @@
+/*
+ * Router C++ Core - native coarse global router
+ *
+ * See global_router.hpp for the model.  The search and negotiation loop
+ * follow ``RegionGraph.find_path`` and ``GlobalRouter.route_all``; the
+ * congestion cost is ``RegionEdge.congestion_cost`` verbatim.
+ */
+
+#include "global_router.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace router {
+
+GlobalRouter::GlobalRouter(const Grid3D& grid, int pitch_cells,
+                           const std::vector<int>& routable_layers)
+    : grid_(grid),
+      pitch_cells_(std::max(1, pitch_cells)),
+      layers_(routable_layers),
+      tile_(grid.congestion_tile()),
+      tcols_(grid.congestion_cols()),
+      trows_(grid.congestion_rows()) {
+    if (layers_.empty()) {
+        for (int l = 0; l < grid_.layers(); ++l) layers_.push_back(l);
+    }
+    h_edges_ = trows_ * (tcols_ - 1);
+    const size_t edges = static_cast<size_t>(h_edges_) + static_cast<size_t>(trows_ - 1) * tcols_;
+
+    const double res = grid_.resolution();
+    cx_.resize(static_cast<size_t>(tcols_) * trows_);
+    cy_.resize(cx_.size());
+    for (int r = 0; r < trows_; ++r) {
+        for (int c = 0; c < tcols_; ++c) {
+            const int t = r * tcols_ + c;
+            cx_[t] = 0.5 * (span_begin(c) + span_end(c, tcols_, grid_.cols())) * res;
+            cy_[t] = 0.5 * (span_begin(r) + span_end(r, trows_, grid_.rows())) * res;
+        }
+    }
+    length_.resize(edges);
+    for (size_t e = 0; e < edges; ++e) {
+        const auto [a, b] = edge_tiles(static_cast<int>(e));
+        length_[e] = std::hypot(cx_[a] - cx_[b], cy_[a] - cy_[b]);
+    }
+    usage_.assign(edges, 0);
+    history_.assign(edges, 0.0);
+    refresh_capacity();
+}
+
+void GlobalRouter::refresh_capacity() {
+    capacity_.assign(length_.size(), 0);
+    auto free_cell = [this](int x, int y, int layer) {
+        return !grid_.at(x, y, layer).blocked;
+    };
+    for (size_t e = 0; e < length_.size(); ++e) {
+        const int a = edge_tiles(static_cast<int>(e)).first;
+        int total = 0;
+        for (int layer : layers_) {
+            if (layer < 0 || layer >= grid_.layers()) continue;
+            int open = 0;
+            if (static_cast<int>(e) < h_edges_) {
+                // Column boundary between tiles a (left) and b (right).
+                const int c = a % tcols_, r = a / tcols_;
+                const int x = span_end(c, tcols_, grid_.cols());
+                for (int y = span_begin(r); y < span_end(r, trows_, grid_.rows()); ++y) {
+                    if (free_cell(x - 1, y, layer) && free_cell(x, y, layer)) ++open;
+                }
+            } else {
+                // Row boundary between tiles a (above) and b (below).
+                const int c = a % tcols_, r = a / tcols_;
+                const int y = span_end(r, trows_, grid_.rows());
+                for (int x = span_begin(c); x < span_end(c, tcols_, grid_.cols()); ++x) {
+                    if (free_cell(x, y - 1, layer) && free_cell(x, y, layer)) ++open;
+                }
+            }
+            total += open / pitch_cells_;
+        }
+        capacity_[e] = total;
+    }
+}
+
+int GlobalRouter::tile_of(int x, int y) const {
+    x = std::clamp(x, 0, grid_.cols() - 1);
+    y = std::clamp(y, 0, grid_.rows() - 1);
+    const int c = std::min(x / tile_, tcols_ - 1);
+    const int r = std::min(y / tile_, trows_ - 1);
+    return r * tcols_ + c;
+}
+
+std::pair<int, int> GlobalRouter::edge_tiles(int edge) const {
+    if (edge < h_edges_) {
+        const int r = edge / (tcols_ - 1), c = edge % (tcols_ - 1);
+        const int t = r * tcols_ + c;
+        return {t, t + 1};
+    }
+    const int t = edge - h_edges_;
+    return {t, t + tcols_};
+}
+
+int GlobalRouter::edge_between(int a, int b) const {
+    if (a > b) std::swap(a, b);
+    if (b == a + 1 && a % tcols_ != tcols_ - 1) {
+        return (a / tcols_) * (tcols_ - 1) + a % tcols_;
+    }
+    if (b == a + tcols_) return h_edges_ + a;
+    return -1;
+}
+
+double GlobalRouter::edge_cost(int edge) const {
+    // RegionEdge.congestion_cost.
+    const int cap = capacity_[edge];
+    const double hist = history_[edge];
+    if (cap <= 0) return 100.0 + hist;
+    const double ratio = static_cast<double>(usage_[edge]) / cap;
+    if (ratio >= 1.0) return 10.0 + hist;
+    return 1.0 + 4.0 * ratio * ratio + hist;
+}
+
+int GlobalRouter::total_overflow() const {
+    int total = 0;
+    for (size_t e = 0; e < usage_.size(); ++e) {
+        total += std::max(0, usage_[e] - capacity_[e]);
+    }
+    return total;
+}
+
+bool GlobalRouter::plan(const std::vector<int>& pin_tiles, Scratch& s, Tree& out) const {
+    out.tiles.clear();
+    out.edges.clear();
+    if (pin_tiles.empty()) return false;
+
+    const size_t ntiles = cx_.size();
+    if (s.g.size() != ntiles) {
+        s.g.assign(ntiles, 0.0);
+        s.parent_edge.assign(ntiles, -1);
+        s.stamp.assign(ntiles, 0);
+        s.closed.assign(ntiles, 0);
+        s.generation = 0;
+    }
+    std::vector<uint8_t> in_tree(ntiles, 0);
+    std::vector<uint8_t> is_target(ntiles, 0);
+    in_tree[pin_tiles[0]] = 1;
+    out.tiles.push_back(pin_tiles[0]);
+    std::vector<int> remaining;
+    for (size_t k = 1; k < pin_tiles.size(); ++k) {
+        if (!in_tree[pin_tiles[k]] && !is_target[pin_tiles[k]]) {
+            remaining.push_back(pin_tiles[k]);
+            is_target[pin_tiles[k]] = 1;
+        }
+    }
+
+    using Entry = std::pair<double, int>;  // (f, tile)
+    while (!remaining.empty()) {
+        if (++s.generation == 0) {
+            std::fill(s.stamp.begin(), s.stamp.end(), 0);
+            std::fill(s.closed.begin(), s.closed.end(), 0);
+            s.generation = 1;
+        }
+        const uint32_t gen = s.generation;
+        auto h = [&](int t) {
+            double best = std::numeric_limits<double>::infinity();
+            for (int goal : remaining) {
+                best = std::min(best, std::hypot(cx_[t] - cx_[goal], cy_[t] - cy_[goal]));
+            }
+            return best;
+        };
+
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+        for (int t : out.tiles) {
+            s.g[t] = 0.0;
+            s.parent_edge[t] = -1;
+            s.stamp[t] = gen;
+            open.push({h(t), t});
+        }
+
+        int reached = -1;
+        while (!open.empty()) {
+            const int t = open.top().second;
+            open.pop();
+            if (s.closed[t] == gen) continue;
+            s.closed[t] = gen;
+            if (is_target[t]) {
+                reached = t;
+                break;
+            }
+            const int c = t % tcols_, r = t / tcols_;
+            const int nbrs[4] = {c + 1 < tcols_ ? t + 1 : -1, c > 0 ? t - 1 : -1,
+                                 r + 1 < trows_ ? t + tcols_ : -1, r > 0 ? t - tcols_ : -1};
+            for (int n : nbrs) {
+                if (n < 0 || s.closed[n] == gen) continue;
+                const int e = edge_between(t, n);
+                const double ng = s.g[t] + length_[e] * edge_cost(e);
+                if (s.stamp[n] != gen || ng < s.g[n]) {
+                    s.stamp[n] = gen;
+                    s.g[n] = ng;
+                    s.parent_edge[n] = e;
+                    open.push({ng + h(n), n});
+                }
+            }
+        }
+        if (reached < 0) return false;
+
+        // Walk back to the tree, adopting the branch.
+        for (int t = reached; !in_tree[t];) {
+            in_tree[t] = 1;
+            out.tiles.push_back(t);
+            const int e = s.parent_edge[t];
+            out.edges.push_back(e);
+            const auto [a, b] = edge_tiles(e);
+            t = a == t ? b : a;
+        }
+        remaining.erase(std::remove_if(remaining.begin(), remaining.end(),
+                                       [&](int t) { return in_tree[t] != 0; }),
+                        remaining.end());
+        for (int t : out.tiles) is_target[t] = 0;
+    }
+    std::sort(out.tiles.begin(), out.tiles.end());
+    std::sort(out.edges.begin(), out.edges.end());
+    return true;
+}
+
+GlobalRouteResult GlobalRouter::route_all(const std::vector<GlobalNetRequest>& requests,
+                                          int num_threads, int batch_size) {
+    GlobalRouteResult out;
+    std::fill(usage_.begin(), usage_.end(), 0);
+    std::fill(history_.begin(), history_.end(), 0.0);
+
+    // Distinct pin tiles per plannable request; out-of-grid pins fail the net.
+    std::vector<int> planned;                 // request indices
+    std::vector<std::vector<int>> pin_tiles;  // per planned net
+    std::vector<uint8_t> invalid(requests.size(), 0);
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const GlobalNetRequest& req = requests[i];
+        std::vector<std::pair<int, int>> cells = req.pins;
+        std::sort(cells.begin(), cells.end());
+        cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+        if (cells.size() < 2) continue;
+        std::vector<int> tiles;
+        for (const auto& [x, y] : cells) {
+            if (!grid_.is_valid(x, y, 0)) {
+                invalid[i] = 1;
+                break;
+            }
+            const int t = tile_of(x, y);
+            if (std::find(tiles.begin(), tiles.end(), t) == tiles.end()) tiles.push_back(t);
+        }
+        if (invalid[i]) continue;
+        planned.push_back(static_cast<int>(i));
+        pin_tiles.push_back(std::move(tiles));
+    }
+
+    const size_t count = planned.size();
+    std::vector<Tree> trees(count);
+    std::vector<uint8_t> ok(count, 0);
+
+    const size_t batch = static_cast<size_t>(std::max(1, batch_size));
+    size_t threads = num_threads > 0
+                         ? static_cast<size_t>(num_threads)
+                         : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, batch));
+    std::vector<Scratch> scratch(threads);
+
+    // Plan ``which`` (ascending planned indices) in batches: search
+    // concurrently against the usage committed so far, then commit in order.
+    auto run = [&](const std::vector<int>& which) {
+        for (size_t lo = 0; lo < which.size(); lo += batch) {
+            const size_t hi = std::min(which.size(), lo + batch);
+            std::atomic<size_t> next{lo};
+            std::exception_ptr failure;
+            std::mutex failure_mutex;
+            auto work = [&](Scratch* s) {
+                try {
+                    for (size_t k = next.fetch_add(1); k < hi; k = next.fetch_add(1)) {
+                        const int n = which[k];
+                        ok[n] = plan(pin_tiles[n], *s, trees[n]) ? 1 : 0;
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(failure_mutex);
+                    if (!failure) failure = std::current_exception();
+                    next.store(hi);
+                }
+            };
+            const size_t active = std::min(threads, hi - lo);
+            std::vector<std::thread> pool;
+            for (size_t t = 1; t < active; ++t) pool.emplace_back(work, &scratch[t]);
+            work(&scratch[0]);
+            for (std::thread& th : pool) th.join();
+            if (failure) std::rethrow_exception(failure);
+
+            for (size_t k = lo; k < hi; ++k) {
+                const int n = which[k];
+                if (!ok[n]) continue;
+                for (int e : trees[n].edges) ++usage_[e];
+            }
+        }
+    };
+
+    std::vector<int> all(count);
+    for (size_t n = 0; n < count; ++n) all[n] = static_cast<int>(n);
+    run(all);
+
+    int overflow = total_overflow();
+    if (negotiated && overflow > 0) {
+        for (int iteration = 1; iteration <= max_iterations; ++iteration) {
+            out.iterations = iteration;
+            std::vector<uint8_t> hot(usage_.size(), 0);
+            for (size_t e = 0; e < usage_.size(); ++e) {
+                if (usage_[e] > capacity_[e]) {
+                    history_[e] += history_increment;
+                    hot[e] = 1;
+                }
+            }
+            std::vector<int> reroute;
+            for (size_t n = 0; n < count; ++n) {
+                if (!ok[n]) continue;
+                for (int e : trees[n].edges) {
+                    if (hot[e]) {
+                        reroute.push_back(static_cast<int>(n));
+                        break;
+                    }
+                }
+            }
+            if (reroute.empty()) break;
+            for (int n : reroute) {
+                for (int e : trees[n].edges) --usage_[e];
+            }
+            run(reroute);
+            overflow = total_overflow();
+            if (overflow == 0) break;
+        }
+    }
+
+    for (size_t i = 0, n = 0; i < requests.size(); ++i) {
+        if (invalid[i]) {
+            out.failed_nets.push_back(requests[i].net);
+            continue;
+        }
+        if (n >= count || planned[n] != static_cast<int>(i)) continue;
+        if (ok[n]) {
+            out.nets.push_back(requests[i].net);
+            out.tiles.push_back(trees[n].tiles);
+            out.edges.push_back(trees[n].edges);
+        } else {
+            out.failed_nets.push_back(requests[i].net);
+        }
+        ++n;
+    }
+    out.final_overflow = overflow;
+    return out;
+}
+
+std::vector<uint8_t> GlobalRouter::corridor_bitset(const std::vector<int>& tiles,
+                                                   int halo) const {
+    std::vector<uint8_t> tmask(cx_.size(), 0);
+    halo = std::max(0, halo);
+    for (int t : tiles) {
+        if (t < 0 || t >= static_cast<int>(tmask.size())) continue;
+        const int c = t % tcols_, r = t / tcols_;
+        for (int rr = std::max(0, r - halo); rr <= std::min(trows_ - 1, r + halo); ++rr) {
+            for (int cc = std::max(0, c - halo); cc <= std::min(tcols_ - 1, c + halo); ++cc) {
+                tmask[rr * tcols_ + cc] = 1;
+            }
+        }
+    }
+    const int cols = grid_.cols(), rows = grid_.rows();
+    std::vector<uint8_t> bits(static_cast<size_t>(cols) * rows, 0);
+    for (int r = 0; r < trows_; ++r) {
+        for (int c = 0; c < tcols_; ++c) {
+            if (!tmask[r * tcols_ + c]) continue;
+            const int x0 = span_begin(c), x1 = span_end(c, tcols_, cols);
+            for (int y = span_begin(r); y < span_end(r, trows_, rows); ++y) {
+                std::fill(bits.begin() + static_cast<size_t>(y) * cols + x0,
+                          bits.begin() + static_cast<size_t>(y) * cols + x1, 1);
+            }
+        }
+    }
+    return bits;
+}
+
+}  // namespace router
@@ -8,6 +8,7 @@
 #include <cmath>
 #include <algorithm>
 #include <limits>
+#include <stdexcept>
 
 namespace router {
 
@@ -415,6 +416,104 @@ int Grid3D::get_total_overflow() const {
     return overflow;
 }
 
+std::vector<std::pair<int, int>> Grid3D::collect_blocking_nets(
+    const std::vector<std::tuple<int, int, int, int, int>>& segments,
+    const std::vector<std::pair<int, int>>& via_cells,
+    int radius,
+    bool relaxed,
+    int source_net,
+    int partner_net,
+    const bool* saved_blocked,
+    const int32_t* saved_net) const
+{
+    // Circular (Euclidean) kernel, same construction as
+    // ``Pathfinder::circular_kernel_offsets_`` (Issue #3229).
+    const int r = std::max(0, radius);
+    const int r_sq = r * r;
+    std::vector<std::pair<int, int>> kernel;
+    kernel.reserve(static_cast<size_t>(3.15f * r_sq + 1));
+    for (int dy = -r; dy <= r; ++dy) {
+        for (int dx = -r; dx <= r; ++dx) {
+            if (dx * dx + dy * dy <= r_sq) {
+                kernel.emplace_back(dx, dy);
+            }
+        }
+    }
+
+    // Gather every inspected cell index first, then dedupe.  Adjacent
+    // Bresenham steps share most of their kernel, so evaluating cells once
+    // keeps the counts meaningful (distinct conflicting cells per net).
+    std::vector<size_t> visited;
+
+    auto visit_kernel = [&](int gx, int gy, int layer) {
+        for (const auto& [dx, dy] : kernel) {
+            const int nx = gx + dx, ny = gy + dy;
+            if (is_valid(nx, ny, layer)) {
+                visited.push_back(index(nx, ny, layer));
+            }
+        }
+    };
+
+    auto walk_line = [&](int x1, int y1, int x2, int y2, int layer) {
+        int dx = std::abs(x2 - x1);
+        int dy = std::abs(y2 - y1);
+        int sx = (x1 < x2) ? 1 : -1;
+        int sy = (y1 < y2) ? 1 : -1;
+        int err = dx - dy;
+
+        int x = x1, y = y1;
+        while (true) {
+            visit_kernel(x, y, layer);
+            if (x == x2 && y == y2) break;
+
+            int e2 = 2 * err;
+            if (e2 > -dy) {
+                err -= dy;
+                x += sx;
+            }
+            if (e2 < dx) {
+                err += dx;
+                y += sy;
+            }
+        }
+    };
+
+    for (const auto& [x1, y1, x2, y2, layer] : segments) {
+        walk_line(x1, y1, x2, y2, layer);
+    }
+    for (const auto& [vx, vy] : via_cells) {
+        for (int layer = 0; layer < layers_; ++layer) {
+            if (is_valid(vx, vy, layer)) visited.push_back(index(vx, vy, layer));
+        }
+    }
+
+    std::sort(visited.begin(), visited.end());
+    visited.erase(std::unique(visited.begin(), visited.end()), visited.end());
+
+    std::vector<std::pair<int, int>> counts;
+    for (size_t idx : visited) {
+        const GridCell& cell = cells_[idx];
+        const bool blocked = saved_blocked ? saved_blocked[idx] : cell.blocked;
+        if (!blocked) continue;
+        const int net = saved_net ? static_cast<int>(saved_net[idx]) : cell.net;
+        if (net == 0 || net == source_net || net == partner_net) continue;
+        if (relaxed) {
+            if (cell.pad_blocked) continue;
+        } else {
+            if (cell.usage_count <= 0) continue;
+        }
+        auto it = std::lower_bound(
+            counts.begin(), counts.end(), net,
+            [](const std::pair<int, int>& entry, int key) { return entry.first < key; });
+        if (it != counts.end() && it->first == net) {
+            ++it->second;
+        } else {
+            counts.insert(it, {net, 1});
+        }
+    }
+    return counts;
+}
+
 int Grid3D::count_blocked() const {
     int count = 0;
     for (const auto& cell : cells_) {
@@ -443,16 +542,19 @@ void Grid3D::add_pad(float x, float y, float width, float height,
 void Grid3D::add_stored_segment(float x1, float y1, float x2, float y2,
                                 float width, int layer_idx, int net) {
     stored_segments_.push_back({x1, y1, x2, y2, width, layer_idx, net});
+    if (!refinements_.empty()) stamp_refinements(&stored_segments_.back(), nullptr);
 }
 
 void Grid3D::add_stored_via(float x, float y, float drill, float diameter, int net) {
     stored_vias_.push_back({x, y, drill, diameter, net});
+    if (!refinements_.empty()) stamp_refinements(nullptr, &stored_vias_.back());
 }
 
 void Grid3D::clear_validation_data() {
     pads_.clear();
     stored_segments_.clear();
     stored_vias_.clear();
+    refresh_refinements();
 }
 
 void Grid3D::clear_stored_routes() {
@@ -461,6 +563,7 @@ void Grid3D::clear_stored_routes() {
     // and must survive rip-up cycles.
     stored_segments_.clear();
     stored_vias_.clear();
+    refresh_refinements();
 }
 
 ValidationResult Grid3D::validate_route(
@@ -770,4 +873,233 @@ ValidationResult Grid3D::validate_route(
     return result;
 }
 
+// -----------------------------------------------------------------------
+// Refinement regions (multi-resolution search)
+// -----------------------------------------------------------------------
+
+namespace {
+
+// Claim a fine cell for ``net``'s copper clearance; a second net makes it
+// a conflict cell (-1) no net may use.
+inline void claim_fine_cell(GridCell& cell, int net, bool metal) {
+    if (!cell.blocked) {
+        cell.blocked = true;
+        cell.net = net;
+    } else if (cell.net != net) {
+        cell.net = -1;
+    }
+    if (metal) {
+        cell.is_obstacle = true;
+        cell.pad_blocked = true;
+    }
+}
+
+// Stamp one shape into a region: every fine cell whose center lies closer
+// than ``halo`` to the shape (``distance`` <= 0 inside it) is claimed;
+// ``metal`` shapes also mark the cells inside them as pad metal.
+template <typename Distance>
+void stamp_fine(RefinementRegion& r, int layer, int num_layers, float min_x, float min_y,
+                float max_x, float max_y, float halo, int net, bool metal,
+                Distance distance) {
+    auto cell_x = [&](float x) { return (x - r.origin_x) / r.resolution; };
+    auto cell_y = [&](float y) { return (y - r.origin_y) / r.resolution; };
+    const int fx0 = std::max(0, static_cast<int>(std::floor(cell_x(min_x - halo))));
+    const int fy0 = std::max(0, static_cast<int>(std::floor(cell_y(min_y - halo))));
+    const int fx1 = std::min(r.cols - 1, static_cast<int>(std::ceil(cell_x(max_x + halo))));
+    const int fy1 = std::min(r.rows - 1, static_cast<int>(std::ceil(cell_y(max_y + halo))));
+    if (fx0 > fx1 || fy0 > fy1) return;
+    const int l0 = layer < 0 ? 0 : layer;
+    const int l1 = layer < 0 ? num_layers - 1 : layer;
+    for (int fy = fy0; fy <= fy1; ++fy) {
+        const float py = r.origin_y + fy * r.resolution;
+        for (int fx = fx0; fx <= fx1; ++fx) {
+            const float px = r.origin_x + fx * r.resolution;
+            const float d = distance(px, py);
+            if (d >= halo - CLEARANCE_EPSILON_MM) continue;
+            for (int l = l0; l <= l1; ++l) {
+                claim_fine_cell(r.cells[r.index(fx, fy, l)], net, metal && d <= 0.0f);
+            }
+        }
+    }
+}
+
+void stamp_pad(RefinementRegion& r, int num_layers, const PadInfo& pad) {
+    const float hw = pad.width / 2, hh = pad.height / 2;
+    const float clearance = pad.clearance_override > 0.0f ? pad.clearance_override : r.clearance;
+    stamp_fine(r, pad.layer_idx, num_layers, pad.x - hw, pad.y - hh, pad.x + hw, pad.y + hh,
+               r.trace_half_width + clearance, pad.net, true, [&](float px, float py) {
+                   const float dx = std::max(std::abs(px - pad.x) - hw, 0.0f);
+                   const float dy = std::max(std::abs(py - pad.y) - hh, 0.0f);
+                   return std::sqrt(dx * dx + dy * dy);
+               });
+}
+
+void stamp_segment(RefinementRegion& r, int num_layers, const StoredSegment& seg) {
+    const float hw = seg.width / 2;
+    stamp_fine(r, seg.layer_idx, num_layers, std::min(seg.x1, seg.x2) - hw,
+               std::min(seg.y1, seg.y2) - hw, std::max(seg.x1, seg.x2) + hw,
+               std::max(seg.y1, seg.y2) + hw, r.trace_half_width + r.clearance, seg.net,
+               false, [&](float px, float py) {
+                   return point_to_segment_distance(px, py, seg.x1, seg.y1, seg.x2, seg.y2) - hw;
+               });
+}
+
+void stamp_via(RefinementRegion& r, int num_layers, const StoredVia& via) {
+    const float rad = via.diameter / 2;
+    stamp_fine(r, -1, num_layers, via.x - rad, via.y - rad, via.x + rad, via.y + rad,
+               r.trace_half_width + r.clearance, via.net, false, [&](float px, float py) {
+                   return std::hypot(px - via.x, py - via.y) - rad;
+               });
+}
+
+}  // namespace
+
+int Grid3D::add_refinement(int x0, int y0, int x1, int y1, int factor,
+                           float trace_half_width, float clearance) {
+    if (factor < 2) throw std::invalid_argument("refinement factor must be >= 2");
+    x0 = std::clamp(x0, 0, cols_ - 1);
+    x1 = std::clamp(x1, 0, cols_ - 1);
+    y0 = std::clamp(y0, 0, rows_ - 1);
+    y1 = std::clamp(y1, 0, rows_ - 1);
+    if (x0 > x1 || y0 > y1) throw std::invalid_argument("empty refinement region");
+    if (refinements_.size() >= static_cast<size_t>(std::numeric_limits<int16_t>::max())) {
+        throw std::invalid_argument("too many refinement regions");
+    }
+    if (refine_owner_.empty()) {
+        refine_owner_.assign(static_cast<size_t>(cols_) * rows_, -1);
+    }
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            if (refinement_at(x, y) >= 0) {
+                throw std::invalid_argument("refinement regions must not overlap");
+            }
+        }
+    }
+
+    const int id = static_cast<int>(refinements_.size());
+    RefinementRegion r;
+    r.x0 = x0;
+    r.y0 = y0;
+    r.x1 = x1;
+    r.y1 = y1;
+    r.factor = factor;
+    r.cols = (x1 - x0 + 1) * factor;
+    r.rows = (y1 - y0 + 1) * factor;
+    r.resolution = resolution_ / factor;
+    r.origin_x = origin_x_ + x0 * resolution_ - resolution_ / 2 + r.resolution / 2;
+    r.origin_y = origin_y_ + y0 * resolution_ - resolution_ / 2 + r.resolution / 2;
+    r.trace_half_width = trace_half_width;
+    r.clearance = clearance;
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            refine_owner_[static_cast<size_t>(y) * cols_ + x] = static_cast<int16_t>(id);
+        }
+    }
+    refinements_.push_back(std::move(r));
+    refine_links_fine_.emplace_back();
+
+    // Transition edges: coarse cells just outside each side.
+    RefinementRegion& reg = refinements_.back();
+    auto link = [&](int cx, int cy, int fx, int fy) {
+        if (cx < 0 || cx >= cols_ || cy < 0 || cy >= rows_) return;
+        if (refinement_at(cx, cy) >= 0) return;
+        const int coarse = cy * cols_ + cx;
+        const int fine = fy * reg.cols + fx;
+        reg.transitions.emplace_back(coarse, fine);
+        refine_links_[coarse].emplace_back(id, fine);
+        refine_links_fine_[id][fine].push_back(coarse);
+    };
+    for (int x = x0; x <= x1; ++x) {
+        for (int k = 0; k < factor; ++k) {
+            const int fx = (x - x0) * factor + k;
+            link(x, y0 - 1, fx, 0);
+            link(x, y1 + 1, fx, reg.rows - 1);
+        }
+    }
+    for (int y = y0; y <= y1; ++y) {
+        for (int k = 0; k < factor; ++k) {
+            const int fy = (y - y0) * factor + k;
+            link(x0 - 1, y, 0, fy);
+            link(x1 + 1, y, reg.cols - 1, fy);
+        }
+    }
+
+    rasterize_refinement(id);
+    return id;
+}
+
+void Grid3D::clear_refinements() {
+    refinements_.clear();
+    refine_owner_.clear();
+    refine_links_.clear();
+    refine_links_fine_.clear();
+}
+
+void Grid3D::refresh_refinements() {
+    for (int i = 0; i < num_refinements(); ++i) rasterize_refinement(i);
+}
+
+void Grid3D::rasterize_refinement(int region) {
+    RefinementRegion& r = refinements_[region];
+    r.cells.assign(static_cast<size_t>(r.cols) * r.rows * layers_, GridCell{});
+
+    // Inherit coarse keep-outs (board edge, keepout zones): net-0
+    // obstacles that are not pad metal.
+    for (int layer = 0; layer < layers_; ++layer) {
+        for (int y = r.y0; y <= r.y1; ++y) {
+            for (int x = r.x0; x <= r.x1; ++x) {
+                const GridCell& coarse = at(x, y, layer);
+                if (!coarse.blocked || !coarse.is_obstacle || coarse.pad_blocked ||
+                    coarse.net != 0) {
+                    continue;
+                }
+                for (int k = 0; k < r.factor * r.factor; ++k) {
+                    const int fx = (x - r.x0) * r.factor + k % r.factor;
+                    const int fy = (y - r.y0) * r.factor + k / r.factor;
+                    GridCell& cell = r.cells[r.index(fx, fy, layer)];
+                    cell.blocked = true;
+                    cell.is_obstacle = true;
+                    cell.static_blocked = true;
+                }
+            }
+        }
+    }
+
+    for (const PadInfo& pad : pads_) stamp_pad(r, layers_, pad);
+    for (const StoredSegment& seg : stored_segments_) stamp_segment(r, layers_, seg);
+    for (const StoredVia& via : stored_vias_) stamp_via(r, layers_, via);
+}
+
+void Grid3D::stamp_refinements(const StoredSegment* seg, const StoredVia* via) {
+    for (RefinementRegion& r : refinements_) {
+        if (seg) stamp_segment(r, layers_, *seg);
+        if (via) stamp_via(r, layers_, *via);
+    }
+}
+
+const std::vector<std::pair<int, int>>& Grid3D::refinement_links(int x, int y) const {
+    static const std::vector<std::pair<int, int>> kNone;
+    auto it = refine_links_.find(y * cols_ + x);
+    return it == refine_links_.end() ? kNone : it->second;
+}
+
+const std::vector<int>& Grid3D::refinement_links_fine(int region, int fx, int fy) const {
+    static const std::vector<int> kNone;
+    const auto& links = refine_links_fine_[region];
+    auto it = links.find(fy * refinements_[region].cols + fx);
+    return it == links.end() ? kNone : it->second;
+}
+
+std::pair<float, float> Grid3D::fine_to_world(int region, int fx, int fy) const {
+    const RefinementRegion& r = refinements_[region];
+    return {r.origin_x + fx * r.resolution, r.origin_y + fy * r.resolution};
+}
+
+std::pair<int, int> Grid3D::world_to_fine(int region, float x, float y) const {
+    const RefinementRegion& r = refinements_[region];
+    const int fx = static_cast<int>(std::round((x - r.origin_x) / r.resolution));
+    const int fy = static_cast<int>(std::round((y - r.origin_y) / r.resolution));
+    return {std::clamp(fx, 0, r.cols - 1), std::clamp(fy, 0, r.rows - 1)};
+}
+
 }  // namespace router
@@ -0,0 +1,766 @@
+/*
+ * Router C++ Core - incremental constrained-Delaunay updates
+ *
+ * Implementation of incremental_cdt.hpp.  The patch re-triangulation reuses
+ * the vendored poly2tri exactly as ``constrained_delaunay`` (mesh.cpp) does;
+ * only the input shrinks from the whole board to the cavity.
+ */
+
+#include "incremental_cdt.hpp"
+
+#include "poly2tri.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <unordered_set>
+
+namespace router {
+
+namespace {
+
+using Pt = IncrementalCDT::Pt;
+using Tri = IncrementalCDT::Tri;
+constexpr double kEps = IncrementalCDT::kEps;
+
+inline uint64_t edge_key(int u, int v) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(u)) << 32) |
+           static_cast<uint32_t>(v);
+}
+
+inline double orient(const Pt& a, const Pt& b, const Pt& c) {
+    return (b.first - a.first) * (c.second - a.second) -
+           (c.first - a.first) * (b.second - a.second);
+}
+
+double polygon_area(const std::vector<Pt>& poly) {
+    double s = 0.0;
+    for (size_t i = 0, n = poly.size(); i < n; ++i) {
+        const Pt& p = poly[i];
+        const Pt& q = poly[(i + 1) % n];
+        s += p.first * q.second - q.first * p.second;
+    }
+    return s / 2.0;
+}
+
+double segment_distance(const Pt& p, const Pt& a, const Pt& b) {
+    const double dx = b.first - a.first, dy = b.second - a.second;
+    const double len2 = dx * dx + dy * dy;
+    double t = 0.0;
+    if (len2 > 0.0) {
+        t = ((p.first - a.first) * dx + (p.second - a.second) * dy) / len2;
+        t = std::clamp(t, 0.0, 1.0);
+    }
+    return std::hypot(p.first - (a.first + t * dx), p.second - (a.second + t * dy));
+}
+
+// Closed segment intersection (touching and collinear overlap count).
+bool segments_intersect(const Pt& p1, const Pt& p2, const Pt& q1, const Pt& q2) {
+    const double d1 = orient(q1, q2, p1);
+    const double d2 = orient(q1, q2, p2);
+    const double d3 = orient(p1, p2, q1);
+    const double d4 = orient(p1, p2, q2);
+    if (((d1 > kEps && d2 < -kEps) || (d1 < -kEps && d2 > kEps)) &&
+        ((d3 > kEps && d4 < -kEps) || (d3 < -kEps && d4 > kEps))) {
+        return true;
+    }
+    return segment_distance(p1, q1, q2) <= kEps || segment_distance(p2, q1, q2) <= kEps ||
+           segment_distance(q1, p1, p2) <= kEps || segment_distance(q2, p1, p2) <= kEps;
+}
+
+// Crossing-number test; boundary points are not classified.
+bool point_in_polygon(const Pt& p, const std::vector<Pt>& poly) {
+    bool inside = false;
+    for (size_t i = 0, j = poly.size() - 1; i < poly.size(); j = i++) {
+        const Pt& a = poly[i];
+        const Pt& b = poly[j];
+        if ((a.second > p.second) != (b.second > p.second)) {
+            const double x = a.first + (p.second - a.second) * (b.first - a.first) /
+                                           (b.second - a.second);
+            if (p.first < x) inside = !inside;
+        }
+    }
+    return inside;
+}
+
+double distance_to_polygon(const Pt& p, const std::vector<Pt>& poly) {
+    double best = std::numeric_limits<double>::infinity();
+    for (size_t i = 0, n = poly.size(); i < n; ++i) {
+        best = std::min(best, segment_distance(p, poly[i], poly[(i + 1) % n]));
+    }
+    return best;
+}
+
+bool point_in_triangle(const Pt& p, const Pt& a, const Pt& b, const Pt& c) {
+    const double d1 = orient(p, a, b);
+    const double d2 = orient(p, b, c);
+    const double d3 = orient(p, c, a);
+    const bool has_neg = d1 < -kEps || d2 < -kEps || d3 < -kEps;
+    const bool has_pos = d1 > kEps || d2 > kEps || d3 > kEps;
+    return !(has_neg && has_pos);
+}
+
+// Closed overlap of a triangle and a simple polygon.
+bool triangle_overlaps(const Pt& a, const Pt& b, const Pt& c, const std::vector<Pt>& poly) {
+    for (const Pt& p : poly) {
+        if (point_in_triangle(p, a, b, c)) return true;
+    }
+    for (const Pt* v : {&a, &b, &c}) {
+        if (point_in_polygon(*v, poly) || distance_to_polygon(*v, poly) <= kEps) return true;
+    }
+    const Pt* tri[3] = {&a, &b, &c};
+    for (int k = 0; k < 3; ++k) {
+        for (size_t i = 0, n = poly.size(); i < n; ++i) {
+            if (segments_intersect(*tri[k], *tri[(k + 1) % 3], poly[i], poly[(i + 1) % n])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// ``in_circle`` for the counter-clockwise triangle (a, b, c), with a small
+// relative tolerance so co-circular quads never flip back and forth.
+bool in_circle(const Pt& a, const Pt& b, const Pt& c, const Pt& d) {
+    const double adx = a.first - d.first, ady = a.second - d.second;
+    const double bdx = b.first - d.first, bdy = b.second - d.second;
+    const double cdx = c.first - d.first, cdy = c.second - d.second;
+    const double ad = adx * adx + ady * ady;
+    const double bd = bdx * bdx + bdy * bdy;
+    const double cd = cdx * cdx + cdy * cdy;
+    const double t1 = ad * (bdx * cdy - cdx * bdy);
+    const double t2 = bd * (cdx * ady - adx * cdy);
+    const double t3 = cd * (adx * bdy - bdx * ady);
+    const double mag = std::abs(t1) + std::abs(t2) + std::abs(t3);
+    return t1 + t2 + t3 > 1e-10 * mag;
+}
+
+// poly2tri over one patch.  Returns triangles as indices into the
+// concatenation ``outer ++ holes... ++ steiner``, counter-clockwise, or
+// nullopt on a poly2tri failure.
+std::optional<std::vector<Tri>> triangulate(const std::vector<Pt>& outer,
+                                            const std::vector<std::vector<Pt>>& holes,
+                                            const std::vector<Pt>& steiner) {
+    std::vector<std::unique_ptr<p2t::Point>> storage;
+    std::unordered_map<p2t::Point*, int> index_of;
+    auto make_point = [&](const Pt& c) {
+        storage.push_back(std::make_unique<p2t::Point>(c.first, c.second));
+        index_of.emplace(storage.back().get(), static_cast<int>(storage.size()) - 1);
+        return storage.back().get();
+    };
+
+    std::vector<p2t::Point*> polyline;
+    for (const Pt& c : outer) polyline.push_back(make_point(c));
+    std::vector<std::vector<p2t::Point*>> hole_lines;
+    hole_lines.reserve(holes.size());
+
+    std::vector<Tri> out;
+    try {
+        p2t::CDT cdt(polyline);
+        for (const auto& h : holes) {
+            std::vector<p2t::Point*> hl;
+            for (const Pt& c : h) hl.push_back(make_point(c));
+            hole_lines.push_back(std::move(hl));
+            cdt.AddHole(hole_lines.back());
+        }
+        for (const Pt& c : steiner) cdt.AddPoint(make_point(c));
+        cdt.Triangulate();
+        for (p2t::Triangle* t : cdt.GetTriangles()) {
+            Tri tri{};
+            for (int k = 0; k < 3; ++k) {
+                auto it = index_of.find(t->GetPoint(k));
+                if (it == index_of.end()) return std::nullopt;
+                tri[k] = it->second;
+            }
+            out.push_back(tri);
+        }
+    } catch (...) {
+        return std::nullopt;
+    }
+
+    auto coord = [&](int i) {
+        const p2t::Point* p = storage[i].get();
+        return Pt{p->x, p->y};
+    };
+    for (Tri& t : out) {
+        if (orient(coord(t[0]), coord(t[1]), coord(t[2])) < 0.0) std::swap(t[1], t[2]);
+    }
+    return out;
+}
+
+}  // namespace
+
+IncrementalCDT::IncrementalCDT(const std::vector<Pt>& vertices,
+                               const std::vector<Tri>& triangles)
+    : vertices_(vertices), tris_(triangles) {
+    vtx_tris_.resize(vertices_.size());
+    for (Tri& t : tris_) {
+        if (orient(vertices_[t[0]], vertices_[t[1]], vertices_[t[2]]) < 0.0) {
+            std::swap(t[1], t[2]);
+        }
+    }
+
+    // Bucket grid over the adopted domain, about two triangles per bucket.
+    double x0 = std::numeric_limits<double>::infinity(), y0 = x0;
+    double x1 = -x0, y1 = -x0;
+    for (const Tri& t : tris_) {
+        for (int v : t) {
+            x0 = std::min(x0, vertices_[v].first);
+            y0 = std::min(y0, vertices_[v].second);
+            x1 = std::max(x1, vertices_[v].first);
+            y1 = std::max(y1, vertices_[v].second);
+        }
+    }
+    if (!tris_.empty()) {
+        const int side = std::clamp(static_cast<int>(std::sqrt(tris_.size() / 2.0)), 1, 1024);
+        bucket_cols_ = bucket_rows_ = side;
+        bx0_ = x0;
+        by0_ = y0;
+        bucket_w_ = x1 > x0 ? (x1 - x0) / side : 1.0;
+        bucket_h_ = y1 > y0 ? (y1 - y0) / side : 1.0;
+    }
+    buckets_.resize(static_cast<size_t>(bucket_cols_) * bucket_rows_);
+    for (int t = 0; t < static_cast<int>(tris_.size()); ++t) link(t);
+
+    // Boundary loops: a directed edge whose twin is absent.  The hole loops
+    // run clockwise (negative area) around the untriangulated interior.
+    std::unordered_map<int, int> next;
+    for (const Tri& t : tris_) {
+        for (int k = 0; k < 3; ++k) {
+            const int u = t[k], v = t[(k + 1) % 3];
+            if (twin(u, v) < 0) next.emplace(u, v);
+        }
+    }
+    std::vector<int> starts;
+    starts.reserve(next.size());
+    for (const auto& [u, v] : next) starts.push_back(u);
+    std::sort(starts.begin(), starts.end());
+    std::unordered_set<int> seen;
+    std::vector<std::vector<int>> loops;
+    for (int s : starts) {
+        if (seen.count(s)) continue;
+        std::vector<int> loop;
+        for (int u = s; !seen.count(u);) {
+            seen.insert(u);
+            loop.push_back(u);
+            auto it = next.find(u);
+            if (it == next.end()) break;
+            u = it->second;
+        }
+        loops.push_back(std::move(loop));
+    }
+    for (const auto& loop : loops) {
+        std::vector<Pt> pts;
+        for (int v : loop) pts.push_back(vertices_[v]);
+        if (loop.size() >= 3 && polygon_area(pts) < 0.0) holes_.emplace(next_hole_id_++, loop);
+    }
+}
+
+std::vector<int> IncrementalCDT::hole_ids() const {
+    std::vector<int> ids;
+    for (const auto& [id, loop] : holes_) ids.push_back(id);
+    return ids;
+}
+
+std::vector<int> IncrementalCDT::hole_loop(int hole_id) const {
+    auto it = holes_.find(hole_id);
+    return it == holes_.end() ? std::vector<int>{} : it->second;
+}
+
+int IncrementalCDT::hole_at(const Pt& p) const {
+    for (const auto& [id, loop] : holes_) {
+        std::vector<Pt> pts;
+        for (int v : loop) {
+            if (std::hypot(vertices_[v].first - p.first, vertices_[v].second - p.second) <= kEps) {
+                return id;
+            }
+            pts.push_back(vertices_[v]);
+        }
+        if (point_in_polygon(p, pts)) return id;
+    }
+    return -1;
+}
+
+int IncrementalCDT::twin(int u, int v) const {
+    auto it = half_.find(edge_key(v, u));
+    return it == half_.end() ? -1 : it->second;
+}
+
+void IncrementalCDT::bucket_range(int t, int& c0, int& c1, int& r0, int& r1) const {
+    const Tri& tri = tris_[t];
+    double tx0 = vertices_[tri[0]].first, tx1 = tx0;
+    double ty0 = vertices_[tri[0]].second, ty1 = ty0;
+    for (int k = 1; k < 3; ++k) {
+        tx0 = std::min(tx0, vertices_[tri[k]].first);
+        tx1 = std::max(tx1, vertices_[tri[k]].first);
+        ty0 = std::min(ty0, vertices_[tri[k]].second);
+        ty1 = std::max(ty1, vertices_[tri[k]].second);
+    }
+    auto col = [&](double x) {
+        return std::clamp(static_cast<int>(std::floor((x - bx0_) / bucket_w_)), 0, bucket_cols_ - 1);
+    };
+    auto row = [&](double y) {
+        return std::clamp(static_cast<int>(std::floor((y - by0_) / bucket_h_)), 0, bucket_rows_ - 1);
+    };
+    c0 = col(tx0 - kEps);
+    c1 = col(tx1 + kEps);
+    r0 = row(ty0 - kEps);
+    r1 = row(ty1 + kEps);
+}
+
+void IncrementalCDT::link(int t) {
+    const Tri& tri = tris_[t];
+    for (int k = 0; k < 3; ++k) {
+        half_[edge_key(tri[k], tri[(k + 1) % 3])] = t;
+        vtx_tris_[tri[k]].push_back(t);
+    }
+    int c0, c1, r0, r1;
+    bucket_range(t, c0, c1, r0, r1);
+    for (int r = r0; r <= r1; ++r) {
+        for (int c = c0; c <= c1; ++c) buckets_[r * bucket_cols_ + c].push_back(t);
+    }
+}
+
+void IncrementalCDT::unlink(int t) {
+    const Tri& tri = tris_[t];
+    auto drop = [t](std::vector<int>& ids) {
+        ids.erase(std::remove(ids.begin(), ids.end(), t), ids.end());
+    };
+    for (int k = 0; k < 3; ++k) {
+        auto it = half_.find(edge_key(tri[k], tri[(k + 1) % 3]));
+        if (it != half_.end() && it->second == t) half_.erase(it);
+        drop(vtx_tris_[tri[k]]);
+    }
+    int c0, c1, r0, r1;
+    bucket_range(t, c0, c1, r0, r1);
+    for (int r = r0; r <= r1; ++r) {
+        for (int c = c0; c <= c1; ++c) drop(buckets_[r * bucket_cols_ + c]);
+    }
+}
+
+int IncrementalCDT::alloc_vertex(const Pt& p) {
+    if (!free_vertices_.empty()) {
+        const int v = free_vertices_.back();
+        free_vertices_.pop_back();
+        vertices_[v] = p;
+        return v;
+    }
+    vertices_.push_back(p);
+    vtx_tris_.emplace_back();
+    return static_cast<int>(vertices_.size()) - 1;
+}
+
+void IncrementalCDT::drop_vertex(int v) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    vertices_[v] = {nan, nan};
+    free_vertices_.push_back(v);
+}
+
+// Grow the cavity until its boundary is one simple outer loop plus whole
+// hole loops: a pinch vertex (two boundary edges leaving it) pulls in its
+// fan, and an inner loop with triangles across it is a pocket that is
+// flooded in.  ``skip_loop`` (the hole being removed) is left out of the
+// reported hole loops.
+std::optional<IncrementalCDT::Boundary> IncrementalCDT::close_cavity(
+    std::vector<uint8_t>& in_cavity, std::vector<int>& cavity,
+    const std::vector<int>& skip_loop) const {
+    auto add = [&](int t) {
+        if (!in_cavity[t]) {
+            in_cavity[t] = 1;
+            cavity.push_back(t);
+            return true;
+        }
+        return false;
+    };
+    std::vector<int> skip_sorted(skip_loop);
+    std::sort(skip_sorted.begin(), skip_sorted.end());
+
+    for (int iter = 0; iter < 64; ++iter) {
+        std::unordered_map<int, std::vector<int>> out;
+        for (int t : cavity) {
+            const Tri& tri = tris_[t];
+            for (int k = 0; k < 3; ++k) {
+                const int u = tri[k], v = tri[(k + 1) % 3];
+                const int tw = twin(u, v);
+                if (tw < 0 || !in_cavity[tw]) out[u].push_back(v);
+            }
+        }
+
+        bool grew = false;
+        bool pinched = false;
+        for (const auto& [u, nexts] : out) {
+            if (nexts.size() < 2) continue;
+            pinched = true;
+            for (int t : vtx_tris_[u]) grew |= add(t);
+        }
+        if (grew) continue;
+        if (pinched) return std::nullopt;  // touches another boundary at a vertex
+
+        std::vector<int> starts;
+        for (const auto& [u, nexts] : out) starts.push_back(u);
+        std::sort(starts.begin(), starts.end());
+        std::unordered_set<int> seen;
+        Boundary b;
+        int outers = 0;
+        for (int s : starts) {
+            if (seen.count(s)) continue;
+            std::vector<int> loop;
+            std::vector<Pt> pts;
+            for (int u = s; !seen.count(u);) {
+                seen.insert(u);
+                loop.push_back(u);
+                pts.push_back(vertices_[u]);
+                auto nx = out.find(u);
+                if (nx == out.end()) return std::nullopt;  // open chain
+                u = nx->second[0];
+            }
+            if (polygon_area(pts) > 0.0) {
+                ++outers;
+                b.outer = std::move(loop);
+                continue;
+            }
+            // Inner loop: a pocket when any triangle lies across it.
+            std::vector<int> seeds;
+            for (size_t i = 0; i < loop.size(); ++i) {
+                const int across = twin(loop[i], loop[(i + 1) % loop.size()]);
+                if (across >= 0) seeds.push_back(across);
+            }
+            if (!seeds.empty()) {
+                std::vector<int> stack(seeds);
+                while (!stack.empty()) {
+                    const int t = stack.back();
+                    stack.pop_back();
+                    if (!add(t)) continue;
+                    const Tri& tri = tris_[t];
+                    for (int k = 0; k < 3; ++k) {
+                        const int n = twin(tri[k], tri[(k + 1) % 3]);
+                        if (n >= 0 && !in_cavity[n]) stack.push_back(n);
+                    }
+                }
+                grew = true;
+                continue;
+            }
+            std::vector<int> sorted(loop);
+            std::sort(sorted.begin(), sorted.end());
+            if (sorted != skip_sorted) b.holes.push_back(std::move(loop));
+        }
+        if (grew) continue;
+        if (outers != 1) return std::nullopt;
+
+        std::unordered_set<int> on_loop(b.outer.begin(), b.outer.end());
+        for (const auto& h : b.holes) on_loop.insert(h.begin(), h.end());
+        on_loop.insert(skip_loop.begin(), skip_loop.end());
+        std::unordered_set<int> interior;
+        for (int t : cavity) {
+            for (int v : tris_[t]) {
+                if (!on_loop.count(v)) interior.insert(v);
+            }
+        }
+        b.interior.assign(interior.begin(), interior.end());
+        std::sort(b.interior.begin(), b.interior.end());
+        return b;
+    }
+    return std::nullopt;
+}
+
+// Replace the cavity triangles by ``patch``: patch triangles take the cavity
+// slots in ascending order; surplus slots are refilled from the tail.
+IncrementalCDT::Update IncrementalCDT::apply_patch(const std::vector<int>& cavity,
+                                                   const std::vector<Tri>& patch) {
+    Update up;
+    std::vector<int> slots(cavity);
+    std::sort(slots.begin(), slots.end());
+    for (int t : slots) unlink(t);
+
+    for (size_t i = 0; i < patch.size(); ++i) {
+        int id;
+        if (i < slots.size()) {
+            id = slots[i];
+            tris_[id] = patch[i];
+        } else {
+            id = static_cast<int>(tris_.size());
+            tris_.push_back(patch[i]);
+        }
+        link(id);
+        up.changed.push_back(id);
+    }
+
+    auto pop_dead = [&] {
+        while (!tris_.empty() && tris_.back()[0] < 0) tris_.pop_back();
+    };
+    for (size_t i = patch.size(); i < slots.size(); ++i) tris_[slots[i]] = {-1, -1, -1};
+    for (size_t i = patch.size(); i < slots.size(); ++i) {
+        const int s = slots[i];
+        pop_dead();
+        if (s >= static_cast<int>(tris_.size())) break;
+        const int last = static_cast<int>(tris_.size()) - 1;
+        unlink(last);
+        tris_[s] = tris_[last];
+        tris_.pop_back();
+        link(s);
+        up.moved.emplace_back(last, s);
+    }
+    pop_dead();
+    return up;
+}
+
+// Lawson flips outward from the patch until every interior edge it reached
+// is locally Delaunay.
+void IncrementalCDT::legalize(Update& up) {
+    std::deque<std::pair<int, int>> queue;
+    for (int t : up.changed) {
+        const Tri& tri = tris_[t];
+        for (int k = 0; k < 3; ++k) queue.emplace_back(tri[k], tri[(k + 1) % 3]);
+    }
+    auto third = [&](int t, int u) {
+        const Tri& tri = tris_[t];
+        for (int k = 0; k < 3; ++k) {
+            if (tri[k] == u) return tri[(k + 2) % 3];
+        }
+        return -1;
+    };
+
+    size_t budget = 64 * queue.size() + 1024;
+    while (!queue.empty() && budget-- > 0) {
+        const auto [u, v] = queue.front();
+        queue.pop_front();
+        auto it = half_.find(edge_key(u, v));
+        if (it == half_.end()) continue;
+        const int t1 = it->second;
+        const int t2 = twin(u, v);
+        if (t2 < 0) continue;  // constraint (boundary) edge
+        const int a = third(t1, u);
+        const int b = third(t2, v);
+        const Pt& pu = vertices_[u];
+        const Pt& pv = vertices_[v];
+        const Pt& pa = vertices_[a];
+        const Pt& pb = vertices_[b];
+        if (!in_circle(pu, pv, pa, pb)) continue;
+        if (orient(pu, pb, pa) <= kEps || orient(pb, pv, pa) <= kEps) continue;  // non-convex
+
+        unlink(t1);
+        unlink(t2);
+        tris_[t1] = {u, b, a};
+        tris_[t2] = {b, v, a};
+        link(t1);
+        link(t2);
+        up.changed.push_back(t1);
+        up.changed.push_back(t2);
+        queue.emplace_back(u, b);
+        queue.emplace_back(b, v);
+        queue.emplace_back(v, a);
+        queue.emplace_back(a, u);
+    }
+    std::sort(up.changed.begin(), up.changed.end());
+    up.changed.erase(std::unique(up.changed.begin(), up.changed.end()), up.changed.end());
+}
+
+IncrementalCDT::Update IncrementalCDT::insert_hole(const std::vector<Pt>& polygon) {
+    std::vector<Pt> poly(polygon);
+    if (poly.size() > 1 && std::hypot(poly.front().first - poly.back().first,
+                                      poly.front().second - poly.back().second) <= kEps) {
+        poly.pop_back();
+    }
+    if (poly.size() < 3 || tris_.empty() || std::abs(polygon_area(poly)) <= kEps) return {};
+
+    // Seed the cavity with every triangle the (closed) polygon touches.
+    double x0 = poly[0].first, x1 = x0, y0 = poly[0].second, y1 = y0;
+    for (const Pt& p : poly) {
+        x0 = std::min(x0, p.first);
+        x1 = std::max(x1, p.first);
+        y0 = std::min(y0, p.second);
+        y1 = std::max(y1, p.second);
+    }
+    auto col = [&](double x) {
+        return std::clamp(static_cast<int>(std::floor((x - bx0_) / bucket_w_)), 0, bucket_cols_ - 1);
+    };
+    auto row = [&](double y) {
+        return std::clamp(static_cast<int>(std::floor((y - by0_) / bucket_h_)), 0, bucket_rows_ - 1);
+    };
+    std::vector<uint8_t> in_cavity(tris_.size(), 0);
+    std::vector<int> cavity;
+    for (int r = row(y0 - kEps); r <= row(y1 + kEps); ++r) {
+        for (int c = col(x0 - kEps); c <= col(x1 + kEps); ++c) {
+            for (int t : buckets_[r * bucket_cols_ + c]) {
+                if (in_cavity[t]) continue;
+                const Tri& tri = tris_[t];
+                if (triangle_overlaps(vertices_[tri[0]], vertices_[tri[1]], vertices_[tri[2]], poly)) {
+                    in_cavity[t] = 1;
+                    cavity.push_back(t);
+                }
+            }
+        }
+    }
+    if (cavity.empty()) return {};
+
+    const auto boundary = close_cavity(in_cavity, cavity, {});
+    if (!boundary) return {};
+
+    // The new hole must sit strictly inside the cavity: clear of the outer
+    // loop and of every enclosed hole, and enclosing none of them.
+    auto coords = [&](const std::vector<int>& loop) {
+        std::vector<Pt> pts;
+        pts.reserve(loop.size());
+        for (int v : loop) pts.push_back(vertices_[v]);
+        return pts;
+    };
+    std::vector<Pt> outer = coords(boundary->outer);
+    std::vector<std::vector<Pt>> holes;
+    for (const auto& h : boundary->holes) holes.push_back(coords(h));
+    for (const Pt& p : poly) {
+        if (!point_in_polygon(p, outer) || distance_to_polygon(p, outer) <= kEps) return {};
+        for (const auto& h : holes) {
+            if (point_in_polygon(p, h) || distance_to_polygon(p, h) <= kEps) return {};
+        }
+    }
+    for (size_t i = 0, n = poly.size(); i < n; ++i) {
+        const Pt& a = poly[i];
+        const Pt& b = poly[(i + 1) % n];
+        for (size_t j = 0, m = outer.size(); j < m; ++j) {
+            if (segments_intersect(a, b, outer[j], outer[(j + 1) % m])) return {};
+        }
+        for (const auto& h : holes) {
+            for (size_t j = 0, m = h.size(); j < m; ++j) {
+                if (segments_intersect(a, b, h[j], h[(j + 1) % m])) return {};
+            }
+        }
+    }
+    for (const auto& h : holes) {
+        if (point_in_polygon(h[0], poly)) return {};
+    }
+
+    // Interior vertices covered by the new hole are dropped.
+    std::vector<int> steiner_ids;
+    std::vector<Pt> steiner;
+    for (int v : boundary->interior) {
+        const Pt& p = vertices_[v];
+        if (point_in_polygon(p, poly) || distance_to_polygon(p, poly) <= kEps) continue;
+        steiner_ids.push_back(v);
+        steiner.push_back(p);
+    }
+
+    std::vector<std::vector<Pt>> patch_holes(holes);
+    patch_holes.push_back(poly);
+    const auto patch = triangulate(outer, patch_holes, steiner);
+    if (!patch) return {};
+
+    // The patch must tile exactly the cavity minus the new hole.
+    double cavity_area = 0.0, patch_area = 0.0;
+    for (int t : cavity) {
+        const Tri& tri = tris_[t];
+        cavity_area += orient(vertices_[tri[0]], vertices_[tri[1]], vertices_[tri[2]]) / 2.0;
+    }
+    std::vector<Pt> all(outer);
+    for (const auto& h : patch_holes) all.insert(all.end(), h.begin(), h.end());
+    all.insert(all.end(), steiner.begin(), steiner.end());
+    for (const Tri& t : *patch) patch_area += orient(all[t[0]], all[t[1]], all[t[2]]) / 2.0;
+    const double expected = cavity_area - std::abs(polygon_area(poly));
+    if (std::abs(patch_area - expected) > 1e-7 * std::max(1.0, cavity_area)) return {};
+
+    // Patch-local index -> vertex id; the new hole's corners get ids now.
+    std::vector<int> ids(boundary->outer);
+    for (const auto& h : boundary->holes) ids.insert(ids.end(), h.begin(), h.end());
+    std::vector<int> hole_ids;
+    for (const Pt& p : poly) hole_ids.push_back(alloc_vertex(p));
+    ids.insert(ids.end(), hole_ids.begin(), hole_ids.end());
+    ids.insert(ids.end(), steiner_ids.begin(), steiner_ids.end());
+    std::vector<Tri> mapped;
+    mapped.reserve(patch->size());
+    for (const Tri& t : *patch) mapped.push_back({ids[t[0]], ids[t[1]], ids[t[2]]});
+
+    std::unordered_set<int> before;
+    for (int t : cavity) before.insert(tris_[t].begin(), tris_[t].end());
+    Update up = apply_patch(cavity, mapped);
+    for (int v : before) {
+        if (vtx_tris_[v].empty()) drop_vertex(v);
+    }
+    legalize(up);
+    up.ok = true;
+    up.hole_id = next_hole_id_++;
+    holes_.emplace(up.hole_id, std::move(hole_ids));
+    return up;
+}
+
+IncrementalCDT::Update IncrementalCDT::remove_hole(int hole_id) {
+    auto it = holes_.find(hole_id);
+    if (it == holes_.end()) return {};
+    const std::vector<int> ring = it->second;
+
+    std::vector<uint8_t> in_cavity(tris_.size(), 0);
+    std::vector<int> cavity;
+    for (int v : ring) {
+        for (int t : vtx_tris_[v]) {
+            if (!in_cavity[t]) {
+                in_cavity[t] = 1;
+                cavity.push_back(t);
+            }
+        }
+    }
+    if (cavity.empty()) return {};
+    const auto boundary = close_cavity(in_cavity, cavity, ring);
+    if (!boundary) return {};
+
+    auto coords = [&](const std::vector<int>& loop) {
+        std::vector<Pt> pts;
+        pts.reserve(loop.size());
+        for (int v : loop) pts.push_back(vertices_[v]);
+        return pts;
+    };
+    std::vector<Pt> outer = coords(boundary->outer);
+    std::vector<std::vector<Pt>> holes;
+    for (const auto& h : boundary->holes) holes.push_back(coords(h));
+    std::vector<Pt> steiner = coords(boundary->interior);
+
+    const auto patch = triangulate(outer, holes, steiner);
+    if (!patch) return {};
+
+    double cavity_area = 0.0, patch_area = 0.0;
+    for (int t : cavity) {
+        const Tri& tri = tris_[t];
+        cavity_area += orient(vertices_[tri[0]], vertices_[tri[1]], vertices_[tri[2]]) / 2.0;
+    }
+    std::vector<Pt> all(outer);
+    for (const auto& h : holes) all.insert(all.end(), h.begin(), h.end());
+    all.insert(all.end(), steiner.begin(), steiner.end());
+    for (const Tri& t : *patch) patch_area += orient(all[t[0]], all[t[1]], all[t[2]]) / 2.0;
+    const double expected = cavity_area + std::abs(polygon_area(coords(ring)));
+    if (std::abs(patch_area - expected) > 1e-7 * std::max(1.0, expected)) return {};
+
+    std::vector<int> ids(boundary->outer);
+    for (const auto& h : boundary->holes) ids.insert(ids.end(), h.begin(), h.end());
+    ids.insert(ids.end(), boundary->interior.begin(), boundary->interior.end());
+    std::vector<Tri> mapped;
+    mapped.reserve(patch->size());
+    for (const Tri& t : *patch) mapped.push_back({ids[t[0]], ids[t[1]], ids[t[2]]});
+
+    std::unordered_set<int> before;
+    for (int t : cavity) before.insert(tris_[t].begin(), tris_[t].end());
+    Update up = apply_patch(cavity, mapped);
+    for (int v : before) {
+        if (vtx_tris_[v].empty()) drop_vertex(v);
+    }
+    legalize(up);
+    up.ok = true;
+    up.hole_id = hole_id;
+    holes_.erase(hole_id);
+    return up;
+}
+
+bool IncrementalCDT::is_valid() const {
+    const int nv = static_cast<int>(vertices_.size());
+    for (int t = 0; t < static_cast<int>(tris_.size()); ++t) {
+        const Tri& tri = tris_[t];
+        for (int k = 0; k < 3; ++k) {
+            const int v = tri[k];
+            if (v < 0 || v >= nv || std::isnan(vertices_[v].first)) return false;
+            auto it = half_.find(edge_key(v, tri[(k + 1) % 3]));
+            if (it == half_.end() || it->second != t) return false;
+        }
+        if (orient(vertices_[tri[0]], vertices_[tri[1]], vertices_[tri[2]]) <= 0.0) return false;
+    }
+    return half_.size() == 3 * tris_.size();
+}
+
+}  // namespace router
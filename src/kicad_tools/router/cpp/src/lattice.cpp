@@ -0,0 +1,1043 @@
+/*
+ * Router C++ Core - balanced-quadtree octilinear lattice implementation
+ *
+ * Line-for-line port of router/lattice/{quadtree,obstacles}.py and the
+ * non-fat search in LatticePathfinder._route_impl (issue #4278).  Every
+ * tolerance below is the Python one; see lattice.hpp for the layout.
+ */
+
+#include "lattice.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+
+namespace router {
+
+namespace {
+
+using Pt = OctilinearLattice::Pt;
+using Rect = OctilinearLattice::Rect;
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+constexpr double kBucket = 4.0;         // pad-lookup grid, mm (_BUCKET)
+constexpr double kColocationEps = 1e-4;  // _COLOCATION_EPSILON_MM
+
+double dist(const Pt& a, const Pt& b)
+{
+    return std::hypot(a.first - b.first, a.second - b.second);
+}
+
+double seg_pt_dist(const Pt& a, const Pt& b, const Pt& p)
+{
+    const double dx = b.first - a.first;
+    const double dy = b.second - a.second;
+    const double length2 = dx * dx + dy * dy;
+    if (length2 <= 1e-18) {
+        return std::hypot(p.first - a.first, p.second - a.second);
+    }
+    double t = ((p.first - a.first) * dx + (p.second - a.second) * dy) / length2;
+    t = std::max(0.0, std::min(1.0, t));
+    return std::hypot(p.first - (a.first + t * dx), p.second - (a.second + t * dy));
+}
+
+double orient(const Pt& a, const Pt& b, const Pt& c)
+{
+    return (b.first - a.first) * (c.second - a.second) - (b.second - a.second) * (c.first - a.first);
+}
+
+bool segs_intersect(const Pt& a, const Pt& b, const Pt& c, const Pt& d)
+{
+    const double o1 = orient(a, b, c), o2 = orient(a, b, d);
+    const double o3 = orient(c, d, a), o4 = orient(c, d, b);
+    return ((o1 > 0) != (o2 > 0)) && ((o3 > 0) != (o4 > 0));
+}
+
+double seg_seg_dist(const Pt& a, const Pt& b, const Pt& c, const Pt& d)
+{
+    if (segs_intersect(a, b, c, d)) {
+        return 0.0;
+    }
+    return std::min(std::min(seg_pt_dist(a, b, c), seg_pt_dist(a, b, d)),
+                    std::min(seg_pt_dist(c, d, a), seg_pt_dist(c, d, b)));
+}
+
+bool pt_in_rect(const Pt& p, const Rect& r)
+{
+    return r[0] <= p.first && p.first <= r[2] && r[1] <= p.second && p.second <= r[3];
+}
+
+bool rects_overlap(const Rect& a, const Rect& b)
+{
+    return !(a[2] < b[0] || b[2] < a[0] || a[3] < b[1] || b[3] < a[1]);
+}
+
+bool seg_rect_intersect(const Pt& a, const Pt& b, const Rect& r)
+{
+    if (pt_in_rect(a, r) || pt_in_rect(b, r)) {
+        return true;
+    }
+    const Pt corners[4] = {{r[0], r[1]}, {r[2], r[1]}, {r[2], r[3]}, {r[0], r[3]}};
+    for (int k = 0; k < 4; ++k) {
+        const Pt& c1 = corners[k];
+        const Pt& c2 = corners[(k + 1) % 4];
+        if (segs_intersect(a, b, c1, c2) || seg_seg_dist(a, b, c1, c2) < 1e-12) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ``seg_body_crosses_pt``: ``p`` on the segment interior, not an endpoint.
+bool seg_body_crosses_pt(const Pt& a, const Pt& b, const Pt& p)
+{
+    if (seg_pt_dist(a, b, p) >= kColocationEps) {
+        return false;
+    }
+    return dist(a, p) >= kColocationEps && dist(b, p) >= kColocationEps;
+}
+
+uint64_t pack_cell(int ix, int iy)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(ix)) << 32) | static_cast<uint32_t>(iy);
+}
+
+// (pad index) lists -> per-layer CSR, keyed by resource index.
+void build_csr(std::vector<std::pair<int, int>>& pairs, size_t n, std::vector<int>& start,
+               std::vector<int>& pads)
+{
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+    start.assign(n + 1, 0);
+    pads.resize(pairs.size());
+    for (const auto& [res, pad] : pairs) {
+        ++start[res + 1];
+    }
+    for (size_t k = 0; k < n; ++k) {
+        start[k + 1] += start[k];
+    }
+    for (size_t k = 0; k < pairs.size(); ++k) {
+        pads[k] = pairs[k].second;
+    }
+}
+
+}  // namespace
+
+// =============================================================================
+// RefineRegion
+// =============================================================================
+
+int RefineRegion::level_for(double coarse) const
+{
+    if (fine >= coarse) {
+        return 0;
+    }
+    return std::max(0, static_cast<int>(std::ceil(std::log2(coarse / fine) - 1e-9)));
+}
+
+// =============================================================================
+// OctilinearLattice: quadtree
+// =============================================================================
+
+OctilinearLattice::OctilinearLattice(const Rect& bbox, const std::vector<RefineRegion>& regions,
+                                     double coarse)
+    : bbox_(bbox), coarse_(coarse)
+{
+    if (!(coarse > 0.0)) {
+        throw std::invalid_argument("coarse cell size must be positive");
+    }
+    for (const auto& r : regions) {
+        const int level = r.level_for(coarse);
+        max_level_ = std::max(max_level_, level);
+        region_levels_.emplace_back(r.rect, level);
+    }
+    fine_ = coarse / std::ldexp(1.0, max_level_);
+    unit_ = fine_ / 2.0;
+    nx_ = std::max(1, static_cast<int>(std::ceil((bbox[2] - bbox[0]) / coarse - 1e-9)));
+    ny_ = std::max(1, static_cast<int>(std::ceil((bbox[3] - bbox[1]) / coarse - 1e-9)));
+
+    build_quadtree();
+    balance();
+    build_graph();
+}
+
+uint64_t OctilinearLattice::cell_id(int level, int i, int j)
+{
+    // Levels stay far below 256 and indices below 2^28 on any real board.
+    return (static_cast<uint64_t>(level) << 56) |
+           (static_cast<uint64_t>(static_cast<uint32_t>(i) & 0x0fffffffu) << 28) |
+           (static_cast<uint32_t>(j) & 0x0fffffffu);
+}
+
+uint64_t OctilinearLattice::key_id(const Key& key)
+{
+    return pack_cell(key.first, key.second);
+}
+
+bool OctilinearLattice::is_leaf(int level, int i, int j) const
+{
+    if (level < 0 || i < 0 || j < 0) {
+        return false;
+    }
+    return leaves_.count(cell_id(level, i, j)) != 0;
+}
+
+OctilinearLattice::Rect OctilinearLattice::cell_rect(int level, int i, int j) const
+{
+    const double s = coarse_ / std::ldexp(1.0, level);
+    const double x0 = bbox_[0] + i * s;
+    const double y0 = bbox_[1] + j * s;
+    return {x0, y0, x0 + s, y0 + s};
+}
+
+bool OctilinearLattice::needs_refine(const Rect& rect, int level) const
+{
+    for (const auto& [region, region_level] : region_levels_) {
+        if (region_level > level && rects_overlap(rect, region)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool OctilinearLattice::cell_in_bounds(const Rect& rect) const
+{
+    return rect[0] < bbox_[2] - 1e-9 && rect[1] < bbox_[3] - 1e-9;
+}
+
+bool OctilinearLattice::inside(double x, double y) const
+{
+    return bbox_[0] - 1e-9 <= x && x <= bbox_[2] + 1e-9 && bbox_[1] - 1e-9 <= y &&
+           y <= bbox_[3] + 1e-9;
+}
+
+void OctilinearLattice::build_quadtree()
+{
+    std::vector<Cell> stack;
+    for (int i = 0; i < nx_; ++i) {
+        for (int j = 0; j < ny_; ++j) {
+            stack.push_back({0, i, j});
+        }
+    }
+    while (!stack.empty()) {
+        const auto [level, i, j] = stack.back();
+        stack.pop_back();
+        const Rect rect = cell_rect(level, i, j);
+        if (!cell_in_bounds(rect)) {
+            continue;
+        }
+        if (level < max_level_ && needs_refine(rect, level)) {
+            for (int di = 0; di < 2; ++di) {
+                for (int dj = 0; dj < 2; ++dj) {
+                    stack.push_back({level + 1, 2 * i + di, 2 * j + dj});
+                }
+            }
+        } else {
+            leaves_.emplace(cell_id(level, i, j), 1);
+        }
+    }
+}
+
+int OctilinearLattice::neighbor_max_level(int level, int i, int j, char direction) const
+{
+    int di = 0, dj = 0;
+    switch (direction) {
+        case 'E': di = 1; break;
+        case 'W': di = -1; break;
+        case 'N': dj = 1; break;
+        default: dj = -1; break;
+    }
+    const int ni = i + di, nj = j + dj;
+    if (ni < 0 || nj < 0) {
+        return -1;
+    }
+    // Coarser ancestors (including the same level).
+    for (int ll = level; ll >= 0; --ll) {
+        if (is_leaf(ll, ni >> (level - ll), nj >> (level - ll))) {
+            return ll;
+        }
+    }
+    // Descend into finer children adjacent to the shared side.
+    int best = -1;
+    std::vector<Cell> frontier{{level, ni, nj}};
+    while (!frontier.empty()) {
+        const auto [cl, ci, cj] = frontier.back();
+        frontier.pop_back();
+        if (is_leaf(cl, ci, cj)) {
+            best = std::max(best, cl);
+            continue;
+        }
+        if (cl >= max_level_) {
+            continue;
+        }
+        switch (direction) {
+            case 'E':  // neighbor's west children face back at us
+                frontier.push_back({cl + 1, 2 * ci, 2 * cj});
+                frontier.push_back({cl + 1, 2 * ci, 2 * cj + 1});
+                break;
+            case 'W':
+                frontier.push_back({cl + 1, 2 * ci + 1, 2 * cj});
+                frontier.push_back({cl + 1, 2 * ci + 1, 2 * cj + 1});
+                break;
+            case 'N':
+                frontier.push_back({cl + 1, 2 * ci, 2 * cj});
+                frontier.push_back({cl + 1, 2 * ci + 1, 2 * cj});
+                break;
+            default:  // 'S'
+                frontier.push_back({cl + 1, 2 * ci, 2 * cj + 1});
+                frontier.push_back({cl + 1, 2 * ci + 1, 2 * cj + 1});
+                break;
+        }
+    }
+    return best;
+}
+
+void OctilinearLattice::balance()
+{
+    static constexpr char kSides[4] = {'E', 'W', 'N', 'S'};
+    static constexpr int kDi[4] = {1, -1, 0, 0};
+    static constexpr int kDj[4] = {0, 0, 1, -1};
+
+    // The minimal balanced refinement is unique, so the queue order (a set
+    // iteration order in Python) does not change the resulting leaves.
+    std::vector<Cell> queue = leaves();
+    while (!queue.empty()) {
+        const auto [level, i, j] = queue.back();
+        queue.pop_back();
+        if (!is_leaf(level, i, j)) {
+            continue;  // already split by a prior iteration
+        }
+        bool split = false;
+        for (char d : kSides) {
+            if (neighbor_max_level(level, i, j, d) >= level + 2) {
+                split = true;
+                break;
+            }
+        }
+        if (!split) {
+            continue;
+        }
+        leaves_.erase(cell_id(level, i, j));
+        for (int di = 0; di < 2; ++di) {
+            for (int dj = 0; dj < 2; ++dj) {
+                const Cell kid{level + 1, 2 * i + di, 2 * j + dj};
+                if (!cell_in_bounds(cell_rect(kid[0], kid[1], kid[2]))) {
+                    continue;
+                }
+                leaves_.emplace(cell_id(kid[0], kid[1], kid[2]), 1);
+                queue.push_back(kid);
+            }
+        }
+        // Splitting may push a coarser neighbor out of balance in turn.
+        for (int s = 0; s < 4; ++s) {
+            int ll = level, ii = i + kDi[s], jj = j + kDj[s];
+            while (ll >= 0) {
+                if (is_leaf(ll, ii, jj)) {
+                    queue.push_back({ll, ii, jj});
+                    break;
+                }
+                --ll;
+                ii >>= 1;
+                jj >>= 1;
+            }
+        }
+    }
+}
+
+std::vector<OctilinearLattice::Cell> OctilinearLattice::leaves() const
+{
+    std::vector<Cell> out;
+    out.reserve(leaves_.size());
+    for (const auto& [id, _] : leaves_) {
+        out.push_back({static_cast<int>(id >> 56), static_cast<int>((id >> 28) & 0x0fffffffu),
+                       static_cast<int>(id & 0x0fffffffu)});
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+// =============================================================================
+// OctilinearLattice: graph
+// =============================================================================
+
+OctilinearLattice::Key OctilinearLattice::node_key(double x, double y) const
+{
+    // Python ``round`` is round-half-to-even, as is nearbyint by default.
+    return {static_cast<int>(std::nearbyint((x - bbox_[0]) / unit_)),
+            static_cast<int>(std::nearbyint((y - bbox_[1]) / unit_))};
+}
+
+OctilinearLattice::Pt OctilinearLattice::node_point(const Key& key) const
+{
+    return {bbox_[0] + key.first * unit_, bbox_[1] + key.second * unit_};
+}
+
+int OctilinearLattice::node_index(const Key& key) const
+{
+    const auto it = key_index_.find(key_id(key));
+    return it == key_index_.end() ? -1 : it->second;
+}
+
+int OctilinearLattice::edge_index(const Key& a, const Key& b) const
+{
+    const int na = node_index(a);
+    const int nb = node_index(b);
+    if (na < 0 || nb < 0) {
+        return -1;
+    }
+    for (int k = adj_start_[na]; k < adj_start_[na + 1]; ++k) {
+        if (adj_node_[k] == nb) {
+            return adj_edge_[k];
+        }
+    }
+    return -1;
+}
+
+std::vector<std::pair<double, int>> OctilinearLattice::nodes_within(const Pt& p,
+                                                                   double radius) const
+{
+    std::vector<std::pair<double, int>> out;
+    if (radius < 0.0 || keys_.empty()) {
+        return out;
+    }
+    auto consider = [&](int node) {
+        const Pt q = node_point(keys_[node]);
+        const double d = std::hypot(q.first - p.first, q.second - p.second);
+        if (d <= radius) {
+            out.emplace_back(d, node);
+        }
+    };
+    // Node keys are integer multiples of ``unit_``: probe the key window
+    // around ``p`` unless it holds more slots than the lattice has nodes.
+    const double i0 = std::ceil((p.first - radius - bbox_[0]) / unit_ - 1e-9);
+    const double i1 = std::floor((p.first + radius - bbox_[0]) / unit_ + 1e-9);
+    const double j0 = std::ceil((p.second - radius - bbox_[1]) / unit_ - 1e-9);
+    const double j1 = std::floor((p.second + radius - bbox_[1]) / unit_ + 1e-9);
+    const double window = (i1 - i0 + 1.0) * (j1 - j0 + 1.0);
+    if (window > static_cast<double>(keys_.size())) {
+        for (int n = 0; n < static_cast<int>(keys_.size()); ++n) {
+            consider(n);
+        }
+    } else {
+        for (int i = static_cast<int>(i0); i <= static_cast<int>(i1); ++i) {
+            for (int j = static_cast<int>(j0); j <= static_cast<int>(j1); ++j) {
+                const int n = node_index({i, j});
+                if (n >= 0) {
+                    consider(n);
+                }
+            }
+        }
+    }
+    // Node indices follow the sorted keys, so this is the Python
+    // ``(distance, key)`` candidate order.
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+void OctilinearLattice::build_graph()
+{
+    std::vector<Key> keys;
+    std::vector<std::pair<Key, Key>> edges;
+    constexpr int kNone = std::numeric_limits<int>::min();
+    const Key none{kNone, kNone};
+
+    auto add_node = [&](double x, double y) -> Key {
+        if (!inside(x, y)) {
+            return none;  // board outline (bbox) clips the lattice
+        }
+        const Key k = node_key(x, y);
+        keys.push_back(k);
+        return k;
+    };
+    auto add_edge = [&](const Key& k1, const Key& k2) {
+        if (k1 == none || k2 == none || k1 == k2) {
+            return;
+        }
+        edges.emplace_back(std::min(k1, k2), std::max(k1, k2));
+    };
+
+    for (const auto& [level, i, j] : leaves()) {
+        const Rect r = cell_rect(level, i, j);
+        const double x0 = r[0], y0 = r[1], x1 = r[2], y1 = r[3];
+        const double mx = (x0 + x1) / 2, my = (y0 + y1) / 2;
+        const Key c00 = add_node(x0, y0);
+        const Key c10 = add_node(x1, y0);
+        const Key c01 = add_node(x0, y1);
+        const Key c11 = add_node(x1, y1);
+        const Key center = add_node(mx, my);
+        // The 4 corner->center half-diagonals (exact 45 degrees).
+        for (const Key& corner : {c00, c10, c01, c11}) {
+            add_edge(corner, center);
+        }
+        // Sides, split at the midpoint when the (balanced, so exactly one
+        // level finer) neighbor across is finer.
+        const struct {
+            char dir;
+            Key a, b;
+            double x, y;
+        } sides[4] = {{'S', c00, c10, mx, y0},
+                      {'N', c01, c11, mx, y1},
+                      {'W', c00, c01, x0, my},
+                      {'E', c10, c11, x1, my}};
+        for (const auto& side : sides) {
+            if (neighbor_max_level(level, i, j, side.dir) >= level + 1) {
+                const Key mid = add_node(side.x, side.y);
+                add_edge(side.a, mid);
+                add_edge(mid, side.b);
+            } else {
+                add_edge(side.a, side.b);
+            }
+        }
+    }
+
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    keys_ = std::move(keys);
+    key_index_.reserve(keys_.size());
+    for (size_t n = 0; n < keys_.size(); ++n) {
+        key_index_.emplace(key_id(keys_[n]), static_cast<int>(n));
+    }
+
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    edges_.clear();
+    edges_.reserve(edges.size());
+    edge_len_.reserve(edges.size());
+    for (const auto& [k1, k2] : edges) {
+        edges_.emplace_back(node_index(k1), node_index(k2));
+        edge_len_.push_back(dist(node_point(k1), node_point(k2)));
+    }
+
+    // CSR adjacency in edge-list order: (k1 -> k2) then (k2 -> k1).
+    adj_start_.assign(keys_.size() + 1, 0);
+    for (const auto& [a, b] : edges_) {
+        ++adj_start_[a + 1];
+        ++adj_start_[b + 1];
+    }
+    for (size_t n = 0; n < keys_.size(); ++n) {
+        adj_start_[n + 1] += adj_start_[n];
+    }
+    adj_node_.assign(adj_start_.back(), 0);
+    adj_edge_.assign(adj_start_.back(), 0);
+    std::vector<int> fill(adj_start_.begin(), adj_start_.end() - 1);
+    for (size_t e = 0; e < edges_.size(); ++e) {
+        const auto [a, b] = edges_[e];
+        adj_node_[fill[a]] = b;
+        adj_edge_[fill[a]++] = static_cast<int>(e);
+        adj_node_[fill[b]] = a;
+        adj_edge_[fill[b]++] = static_cast<int>(e);
+    }
+}
+
+// =============================================================================
+// OctilinearLattice: static pad masks
+// =============================================================================
+
+std::vector<int> OctilinearLattice::pads_near(double x0, double y0, double x1, double y1) const
+{
+    std::vector<int> out;
+    const int ix0 = static_cast<int>(std::floor(x0 / kBucket));
+    const int ix1 = static_cast<int>(std::floor(x1 / kBucket));
+    const int iy0 = static_cast<int>(std::floor(y0 / kBucket));
+    const int iy1 = static_cast<int>(std::floor(y1 / kBucket));
+    for (int ix = ix0; ix <= ix1; ++ix) {
+        for (int iy = iy0; iy <= iy1; ++iy) {
+            const auto it = pad_buckets_.find(pack_cell(ix, iy));
+            if (it != pad_buckets_.end()) {
+                out.insert(out.end(), it->second.begin(), it->second.end());
+            }
+        }
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return out;
+}
+
+void OctilinearLattice::set_pads(const std::vector<Rect>& rects, const std::vector<int>& nets,
+                                 const std::vector<std::vector<int>>& layers, int num_layers)
+{
+    if (nets.size() != rects.size() || layers.size() != rects.size()) {
+        throw std::invalid_argument("set_pads: rects, nets and layers differ in length");
+    }
+    num_layers_ = num_layers;
+    pad_rects_ = rects;
+    pad_nets_ = nets;
+    pad_on_layer_.assign(rects.size(), std::vector<uint8_t>(num_layers, 0));
+    for (size_t p = 0; p < rects.size(); ++p) {
+        for (int layer : layers[p]) {
+            if (layer >= 0 && layer < num_layers) {
+                pad_on_layer_[p][layer] = 1;
+            }
+        }
+    }
+
+    pad_buckets_.clear();
+    for (size_t p = 0; p < rects.size(); ++p) {
+        const Rect& r = rects[p];
+        const int ix0 = static_cast<int>(std::floor(r[0] / kBucket));
+        const int ix1 = static_cast<int>(std::floor(r[2] / kBucket));
+        const int iy0 = static_cast<int>(std::floor(r[1] / kBucket));
+        const int iy1 = static_cast<int>(std::floor(r[3] / kBucket));
+        for (int ix = ix0; ix <= ix1; ++ix) {
+            for (int iy = iy0; iy <= iy1; ++iy) {
+                pad_buckets_[pack_cell(ix, iy)].push_back(static_cast<int>(p));
+            }
+        }
+    }
+
+    std::vector<std::vector<std::pair<int, int>>> node_pairs(num_layers), edge_pairs(num_layers);
+    for (size_t n = 0; n < keys_.size(); ++n) {
+        const Pt pt = node_point(keys_[n]);
+        for (int p : pads_near(pt.first, pt.second, pt.first, pt.second)) {
+            if (!pt_in_rect(pt, pad_rects_[p])) {
+                continue;
+            }
+            for (int layer = 0; layer < num_layers; ++layer) {
+                if (pad_on_layer_[p][layer]) {
+                    node_pairs[layer].emplace_back(static_cast<int>(n), p);
+                }
+            }
+        }
+    }
+    for (size_t e = 0; e < edges_.size(); ++e) {
+        const Pt a = node_point(edges_[e].first);
+        const Pt b = node_point(edges_[e].second);
+        for (int p : pads_near(std::min(a.first, b.first), std::min(a.second, b.second),
+                               std::max(a.first, b.first), std::max(a.second, b.second))) {
+            if (!seg_rect_intersect(a, b, pad_rects_[p])) {
+                continue;
+            }
+            for (int layer = 0; layer < num_layers; ++layer) {
+                if (pad_on_layer_[p][layer]) {
+                    edge_pairs[layer].emplace_back(static_cast<int>(e), p);
+                }
+            }
+        }
+    }
+
+    node_mask_start_.assign(num_layers, {});
+    node_mask_pad_.assign(num_layers, {});
+    edge_mask_start_.assign(num_layers, {});
+    edge_mask_pad_.assign(num_layers, {});
+    for (int layer = 0; layer < num_layers; ++layer) {
+        build_csr(node_pairs[layer], keys_.size(), node_mask_start_[layer], node_mask_pad_[layer]);
+        build_csr(edge_pairs[layer], edges_.size(), edge_mask_start_[layer], edge_mask_pad_[layer]);
+    }
+}
+
+namespace {
+
+std::vector<std::vector<std::pair<int, int>>> csr_pairs(
+    const std::vector<std::vector<int>>& starts, const std::vector<std::vector<int>>& pads)
+{
+    std::vector<std::vector<std::pair<int, int>>> out(starts.size());
+    for (size_t layer = 0; layer < starts.size(); ++layer) {
+        const auto& start = starts[layer];
+        for (size_t r = 0; r + 1 < start.size(); ++r) {
+            for (int k = start[r]; k < start[r + 1]; ++k) {
+                out[layer].emplace_back(static_cast<int>(r), pads[layer][k]);
+            }
+        }
+    }
+    return out;
+}
+
+}  // namespace
+
+std::vector<std::vector<std::pair<int, int>>> OctilinearLattice::node_pad_pairs() const
+{
+    return csr_pairs(node_mask_start_, node_mask_pad_);
+}
+
+std::vector<std::vector<std::pair<int, int>>> OctilinearLattice::edge_pad_pairs() const
+{
+    return csr_pairs(edge_mask_start_, edge_mask_pad_);
+}
+
+bool OctilinearLattice::node_blocked(int node, int layer, int net) const
+{
+    if (layer < 0 || layer >= num_layers_) {
+        return false;
+    }
+    const auto& start = node_mask_start_[layer];
+    for (int k = start[node]; k < start[node + 1]; ++k) {
+        if (pad_nets_[node_mask_pad_[layer][k]] != net) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool OctilinearLattice::edge_blocked(int edge, int layer, int net) const
+{
+    if (layer < 0 || layer >= num_layers_) {
+        return false;
+    }
+    const auto& start = edge_mask_start_[layer];
+    for (int k = start[edge]; k < start[edge + 1]; ++k) {
+        if (pad_nets_[edge_mask_pad_[layer][k]] != net) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool OctilinearLattice::segment_blocked(const Pt& a, const Pt& b, int layer, int net,
+                                        double extra) const
+{
+    if (layer < 0 || layer >= num_layers_) {
+        return false;
+    }
+    const double x0 = std::min(a.first, b.first), x1 = std::max(a.first, b.first);
+    const double y0 = std::min(a.second, b.second), y1 = std::max(a.second, b.second);
+    for (int p : pads_near(x0 - extra, y0 - extra, x1 + extra, y1 + extra)) {
+        if (pad_nets_[p] == net || !pad_on_layer_[p][layer]) {
+            continue;
+        }
+        Rect rect = pad_rects_[p];
+        if (extra > 0.0) {
+            rect = {rect[0] - extra, rect[1] - extra, rect[2] + extra, rect[3] + extra};
+        }
+        if (seg_rect_intersect(a, b, rect)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// =============================================================================
+// OctilinearLattice: single-agent A*
+// =============================================================================
+
+OctilinearLattice::Path OctilinearLattice::astar(const Search& q, const LatticeCopper& committed,
+                                                 const std::function<bool(int)>& via_ok) const
+{
+    const int L = std::max(1, q.num_layers);
+    const size_t n_states = keys_.size() * static_cast<size_t>(L);
+    constexpr int kGoal = -1;
+    constexpr uint8_t kMove = 1, kVia = 2;
+
+    auto h = [&](int node) { return dist(node_point(node), q.end_pt); };
+
+    std::unordered_map<uint64_t, double> edge_hist;
+    std::unordered_map<int, double> via_hist;
+    if (q.present != 0.0) {
+        for (const auto& [edge, layer, value] : q.edge_history) {
+            edge_hist[static_cast<uint64_t>(edge) * L + layer] = value;
+        }
+        for (const auto& [node, value] : q.via_history) {
+            via_hist[node] = value;
+        }
+    }
+
+    // Goal states keep the shortest stub (first one on ties).
+    std::unordered_map<int, double> goal;
+    for (const auto& t : q.goals) {
+        const int s = t.node * L + t.layer;
+        const auto it = goal.find(s);
+        if (it == goal.end() || t.length < it->second) {
+            goal[s] = t.length;
+        }
+    }
+
+    std::vector<double> g(n_states, kInf);
+    std::vector<int> parent(n_states, -1);
+    std::vector<uint8_t> move(n_states, 0);
+    using Entry = std::tuple<double, uint64_t, int>;  // (f, seq, state)
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    uint64_t counter = 0;
+    for (const auto& t : q.starts) {
+        const int s = t.node * L + t.layer;
+        if (t.length < g[s]) {
+            g[s] = t.length;
+            heap.emplace(t.length + h(t.node), counter++, s);
+        }
+    }
+
+    std::vector<int8_t> edge_ok(edges_.size() * static_cast<size_t>(L), -1);
+    std::vector<int8_t> node_ok(n_states, -1);
+    std::vector<int8_t> via_cache(keys_.size(), -1);
+    double goal_g = kInf;
+    int goal_from = -1;
+    int end_state = -1;
+
+    auto node_legal = [&](int node, int layer) -> bool {
+        int8_t& ok = node_ok[static_cast<size_t>(node) * L + layer];
+        if (ok < 0) {
+            const Pt npt = node_point(node);
+            ok = !node_blocked(node, layer, q.net) &&
+                 !(q.extra > 0.0 && segment_blocked(npt, npt, layer, q.net, q.extra)) &&
+                 committed.node_clear(npt, layer, q.net, q.half, q.clearance);
+        }
+        return ok != 0;
+    };
+
+    while (!heap.empty()) {
+        const auto [f, _seq, state] = heap.top();
+        heap.pop();
+        if (state == kGoal) {
+            end_state = goal_from;
+            break;
+        }
+        const int key = state / L;
+        const int layer = state % L;
+        const double gs = g[state];
+        if (f > gs + h(key) + 1e-9) {
+            continue;  // stale heap entry
+        }
+        const auto git = goal.find(state);
+        if (git != goal.end()) {
+            const double total = gs + git->second;
+            if (total < goal_g - 1e-12) {
+                goal_g = total;
+                goal_from = state;
+                heap.emplace(total, counter++, kGoal);
+            }
+        }
+        for (int k = adj_start_[key]; k < adj_start_[key + 1]; ++k) {
+            const int nbr = adj_node_[k];
+            const int edge = adj_edge_[k];
+            int8_t& ok = edge_ok[static_cast<size_t>(edge) * L + layer];
+            if (ok < 0) {
+                const Pt ea = node_point(edges_[edge].first);
+                const Pt eb = node_point(edges_[edge].second);
+                ok = !edge_blocked(edge, layer, q.net) &&
+                     !(q.extra > 0.0 && segment_blocked(ea, eb, layer, q.net, q.extra)) &&
+                     committed.seg_clear(ea, eb, layer, q.net, q.half, q.clearance);
+            }
+            if (!ok || !node_legal(nbr, layer)) {
+                continue;
+            }
+            double step = edge_len_[edge];
+            if (!edge_hist.empty()) {
+                const auto hit = edge_hist.find(static_cast<uint64_t>(edge) * L + layer);
+                step += q.present * (hit == edge_hist.end() ? 0.0 : hit->second);
+            }
+            const double tentative = gs + step;
+            const int ns = nbr * L + layer;
+            if (tentative < g[ns] - 1e-12) {
+                g[ns] = tentative;
+                parent[ns] = state;
+                move[ns] = kMove;
+                heap.emplace(tentative + h(nbr), counter++, ns);
+            }
+        }
+        if (q.allow_vias && q.num_layers > 1) {
+            int8_t& vok = via_cache[key];
+            if (vok < 0) {
+                vok = via_ok(key) ? 1 : 0;
+            }
+            if (!vok) {
+                continue;
+            }
+            // Via edges join matching nodes on ADJACENT layers only.
+            for (int nl : {layer - 1, layer + 1}) {
+                if (nl < 0 || nl >= q.num_layers || !node_legal(key, nl)) {
+                    continue;
+                }
+                double step = q.via_cost;
+                if (!via_hist.empty()) {
+                    const auto hit = via_hist.find(key);
+                    step += q.present * (hit == via_hist.end() ? 0.0 : hit->second);
+                }
+                const double tentative = gs + step;
+                const int ns = key * L + nl;
+                if (tentative < g[ns] - 1e-12) {
+                    g[ns] = tentative;
+                    parent[ns] = state;
+                    move[ns] = kVia;
+                    heap.emplace(tentative + h(key), counter++, ns);
+                }
+            }
+        }
+    }
+
+    Path path;
+    if (end_state < 0) {
+        return path;
+    }
+    std::vector<int> chain{end_state};
+    for (int cur = end_state; parent[cur] >= 0; cur = parent[cur]) {
+        chain.push_back(parent[cur]);
+    }
+    std::reverse(chain.begin(), chain.end());
+    for (size_t k = 0; k < chain.size(); ++k) {
+        path.nodes.push_back(chain[k] / L);
+        path.layers.push_back(chain[k] % L);
+        if (k > 0) {
+            path.moves.emplace_back(move[chain[k]] == kVia ? "via" : "move");
+        }
+    }
+    return path;
+}
+
+// =============================================================================
+// LatticeCopper
+// =============================================================================
+
+LatticeCopper::LatticeCopper(int num_layers, double trace_half, double clearance,
+                             double via_radius, double via_via_gap, double same_net_via_gap)
+    : num_layers_(num_layers),
+      trace_half_(trace_half),
+      clearance_(clearance),
+      via_radius_(via_radius),
+      via_via_gap_(via_via_gap),
+      same_net_via_gap_(same_net_via_gap),
+      segs_(num_layers),
+      hash_(num_layers)
+{
+}
+
+size_t LatticeCopper::num_segments() const
+{
+    size_t n = 0;
+    for (const auto& layer : segs_) {
+        n += layer.size();
+    }
+    return n;
+}
+
+void LatticeCopper::add_seg(int layer, const Pt& a, const Pt& b, int net, double half,
+                            double clearance)
+{
+    if (layer < 0 || layer >= num_layers_) {
+        return;
+    }
+    const int id = static_cast<int>(segs_[layer].size());
+    segs_[layer].push_back({a, b, net, half, clearance});
+    const double pad = half + clearance + 0.5;
+    const int ix0 = static_cast<int>(std::floor((std::min(a.first, b.first) - pad) / kCell));
+    const int ix1 = static_cast<int>(std::floor((std::max(a.first, b.first) + pad) / kCell));
+    const int iy0 = static_cast<int>(std::floor((std::min(a.second, b.second) - pad) / kCell));
+    const int iy1 = static_cast<int>(std::floor((std::max(a.second, b.second) + pad) / kCell));
+    for (int ix = ix0; ix <= ix1; ++ix) {
+        for (int iy = iy0; iy <= iy1; ++iy) {
+            hash_[layer][pack_cell(ix, iy)].push_back(id);
+        }
+    }
+}
+
+std::vector<int> LatticeCopper::query(int layer, const Pt& a, const Pt& b, double pad) const
+{
+    std::vector<int> out;
+    if (layer < 0 || layer >= num_layers_ || segs_[layer].empty()) {
+        return out;
+    }
+    const int ix0 = static_cast<int>(std::floor((std::min(a.first, b.first) - pad) / kCell));
+    const int ix1 = static_cast<int>(std::floor((std::max(a.first, b.first) + pad) / kCell));
+    const int iy0 = static_cast<int>(std::floor((std::min(a.second, b.second) - pad) / kCell));
+    const int iy1 = static_cast<int>(std::floor((std::max(a.second, b.second) + pad) / kCell));
+    const auto& buckets = hash_[layer];
+    for (int ix = ix0; ix <= ix1; ++ix) {
+        for (int iy = iy0; iy <= iy1; ++iy) {
+            const auto it = buckets.find(pack_cell(ix, iy));
+            if (it != buckets.end()) {
+                out.insert(out.end(), it->second.begin(), it->second.end());
+            }
+        }
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return out;
+}
+
+void LatticeCopper::add_run(int layer, const std::vector<Pt>& points, int net, double half_width,
+                            double clearance)
+{
+    const double clr = clearance < 0.0 ? clearance_ : clearance;
+    for (size_t k = 0; k + 1 < points.size(); ++k) {
+        if (dist(points[k], points[k + 1]) > 1e-9) {
+            add_seg(layer, points[k], points[k + 1], net, half_width, clr);
+        }
+    }
+}
+
+void LatticeCopper::add_run_widths(int layer, const std::vector<Pt>& points, int net,
+                                   const std::vector<double>& seg_halves, double clearance)
+{
+    const double clr = clearance < 0.0 ? clearance_ : clearance;
+    for (size_t k = 0; k + 1 < points.size() && k < seg_halves.size(); ++k) {
+        if (dist(points[k], points[k + 1]) > 1e-9) {
+            add_seg(layer, points[k], points[k + 1], net, seg_halves[k], clr);
+        }
+    }
+}
+
+void LatticeCopper::add_via(const Pt& point, int net)
+{
+    vias_.emplace_back(point, net);
+}
+
+bool LatticeCopper::seg_clear(const Pt& a, const Pt& b, int layer, int net, double half,
+                              double clearance) const
+{
+    const double own_half = half < 0.0 ? trace_half_ : half;
+    const double own_clr = clearance < 0.0 ? clearance_ : clearance;
+    for (int id : query(layer, a, b, own_half + own_clr + 0.5)) {
+        const Seg& s = segs_[layer][id];
+        const double gap = own_half + s.half + std::max(own_clr, s.clearance);
+        if (s.net != net && seg_seg_dist(a, b, s.a, s.b) < gap - 1e-9) {
+            return false;
+        }
+    }
+    const double via_gap = via_radius_ + own_clr + own_half;
+    for (const auto& [point, vnet] : vias_) {
+        if (vnet != net) {
+            if (seg_pt_dist(a, b, point) < via_gap - 1e-9) {
+                return false;
+            }
+        } else if (seg_body_crosses_pt(a, b, point)) {
+            return false;  // same-net body over a via center (#4318)
+        }
+    }
+    return true;
+}
+
+bool LatticeCopper::node_clear(const Pt& point, int layer, int net, double half,
+                               double clearance) const
+{
+    const double own_half = half < 0.0 ? trace_half_ : half;
+    const double own_clr = clearance < 0.0 ? clearance_ : clearance;
+    for (int id : query(layer, point, point, own_half + own_clr + 0.5)) {
+        const Seg& s = segs_[layer][id];
+        const double gap = own_half + s.half + std::max(own_clr, s.clearance);
+        if (s.net != net && seg_pt_dist(s.a, s.b, point) < gap - 1e-9) {
+            return false;
+        }
+    }
+    const double via_gap = via_radius_ + own_clr + own_half;
+    for (const auto& [vpt, vnet] : vias_) {
+        if (vnet != net && dist(point, vpt) < via_gap - 1e-9) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool LatticeCopper::via_clear(const Pt& point, int net) const
+{
+    const double pad = via_radius_ + clearance_ + trace_half_ + 2.0;
+    for (int layer = 0; layer < num_layers_; ++layer) {
+        for (int id : query(layer, point, point, pad)) {
+            const Seg& s = segs_[layer][id];
+            const double gap = via_radius_ + s.half + std::max(clearance_, s.clearance);
+            if (s.net != net && seg_pt_dist(s.a, s.b, point) < gap - 1e-9) {
+                return false;
+            }
+        }
+    }
+    for (const auto& [vpt, vnet] : vias_) {
+        // Cross-net vias honor both the copper gap and the hole-to-hole
+        // floor (#4291); same-net vias only the hole floor.
+        const double gap =
+            vnet != net ? std::max(via_via_gap_, same_net_via_gap_) : same_net_via_gap_;
+        if (dist(point, vpt) < gap - 1e-9) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace router
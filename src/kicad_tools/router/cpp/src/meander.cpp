@@ -0,0 +1,483 @@
+/*
+ * Router C++ Core - serpentine (meander) length tuning
+ *
+ * See meander.hpp for the cascade and the clearance model.
+ */
+
+#include "meander.hpp"
+#include "geometry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace router {
+
+namespace {
+
+constexpr float kEps = 1e-6f;
+constexpr float kPi = 3.14159265358979f;
+constexpr float kDiag = 0.70710678118654752f;
+constexpr float kAngleTolDeg = 0.01f;  // quantize.ANGLE_TOL_DEG
+
+inline float seg_length(const Segment& s) { return std::hypot(s.x2 - s.x1, s.y2 - s.y1); }
+
+// Nearest of the 8 routing directions (``quantize.snap_direction_8``).
+std::pair<float, float> snap_direction_8(float dx, float dy) {
+    static constexpr float kDirs[8][2] = {{1, 0},      {kDiag, kDiag},   {0, 1},  {-kDiag, kDiag},
+                                          {-1, 0},     {-kDiag, -kDiag}, {0, -1}, {kDiag, -kDiag}};
+    if (dx == 0.0f && dy == 0.0f) return {1.0f, 0.0f};
+    const int idx = ((static_cast<int>(std::lround(std::atan2(dy, dx) / (kPi / 4))) % 8) + 8) % 8;
+    return {kDirs[idx][0], kDirs[idx][1]};
+}
+
+bool is_45_aligned(float dx, float dy) {
+    if (dx == 0.0f || dy == 0.0f) return true;
+    const float deg = std::atan2(std::abs(dy), std::abs(dx)) * 180.0f / kPi;
+    return std::min({deg, std::abs(deg - 45.0f), 90.0f - deg}) <= kAngleTolDeg;
+}
+
+// ``quantize.dogleg_points``: diagonal leg first, axis leg onto the end.
+std::vector<std::pair<float, float>> dogleg_points(float x1, float y1, float x2, float y2) {
+    const float dx = x2 - x1, dy = y2 - y1;
+    if (is_45_aligned(dx, dy)) return {{x1, y1}, {x2, y2}};
+    const float adx = std::abs(dx), ady = std::abs(dy);
+    std::pair<float, float> mid = adx >= ady ? std::make_pair(x1 + std::copysign(ady, dx), y2)
+                                             : std::make_pair(x2, y1 + std::copysign(adx, dy));
+    return {{x1, y1}, mid, {x2, y2}};
+}
+
+// Merge consecutive connected collinear runs (``optimizer.merge_collinear``).
+std::vector<Segment> merge_collinear(const std::vector<Segment>& in) {
+    std::vector<Segment> out;
+    for (const Segment& s : in) {
+        if (!out.empty()) {
+            Segment& last = out.back();
+            const float ax = last.x2 - last.x1, ay = last.y2 - last.y1;
+            const float bx = s.x2 - s.x1, by = s.y2 - s.y1;
+            const float la = std::hypot(ax, ay), lb = std::hypot(bx, by);
+            if (last.layer == s.layer && last.width == s.width &&
+                std::abs(last.x2 - s.x1) < 1e-5f && std::abs(last.y2 - s.y1) < 1e-5f &&
+                la > 0.0f && lb > 0.0f && std::abs(ax * by - ay * bx) <= 1e-4f * la * lb &&
+                ax * bx + ay * by > 0.0f) {
+                last.x2 = s.x2;
+                last.y2 = s.y2;
+                continue;
+            }
+        }
+        out.push_back(s);
+    }
+    return out;
+}
+
+// Host segments for a trombone, best first (``_rank_candidate_segments``).
+std::vector<int> rank_hosts(const std::vector<Segment>& segs, float min_length, int max_count) {
+    std::vector<std::pair<float, int>> scored;
+    const int last = static_cast<int>(segs.size()) - 1;
+    for (int i = 0; i <= last; ++i) {
+        const float len = seg_length(segs[i]);
+        if (len < min_length) continue;
+        float score = len;
+        if (i > 0 && i < last) score *= 1.2f;
+        if (std::abs(segs[i].x2 - segs[i].x1) / len > 0.95f ||
+            std::abs(segs[i].y2 - segs[i].y1) / len > 0.95f) {
+            score *= 1.5f;
+        }
+        scored.emplace_back(score, i);
+    }
+    std::stable_sort(scored.begin(), scored.end(),
+                     [](const auto& a, const auto& b) { return a.first > b.first; });
+    std::vector<int> out;
+    for (size_t k = 0; k < scored.size() && static_cast<int>(k) < max_count; ++k) {
+        out.push_back(scored[k].second);
+    }
+    return out;
+}
+
+struct Obstacle {
+    enum Kind { SEG, VIA, PAD } kind;
+    int net;
+    float x1, y1, x2, y2;  // SEG endpoints; VIA / PAD center in x1, y1
+    float width;           // SEG width, VIA diameter, PAD width
+    float height;          // PAD height
+    int layer_lo, layer_hi;  // SEG: its layer; VIA: span; PAD: -1 = all layers
+    float clearance_override;
+};
+
+// Uniform bucket index over the board (one list per bucket, all layers);
+// an obstacle is filed in every bucket its box overlaps.
+class ObstacleIndex {
+public:
+    void build(std::vector<Obstacle> obstacles) {
+        items_ = std::move(obstacles);
+        if (items_.empty()) return;
+        float x0 = std::numeric_limits<float>::max(), y0 = x0;
+        float x1 = std::numeric_limits<float>::lowest(), y1 = x1;
+        for (const Obstacle& o : items_) {
+            const Box b = box(o);
+            x0 = std::min(x0, b[0]);
+            y0 = std::min(y0, b[1]);
+            x1 = std::max(x1, b[2]);
+            y1 = std::max(y1, b[3]);
+        }
+        const float area = std::max(1.0f, (x1 - x0) * (y1 - y0));
+        bucket_ = std::clamp(std::sqrt(area / static_cast<float>(items_.size())), 0.5f, 10.0f);
+        bucket_ = std::max(bucket_, std::sqrt(area / 4.0e6f));
+        bx0_ = x0;
+        by0_ = y0;
+        cols_ = std::max(1, static_cast<int>(std::ceil((x1 - x0) / bucket_)) + 1);
+        rows_ = std::max(1, static_cast<int>(std::ceil((y1 - y0) / bucket_)) + 1);
+        buckets_.assign(static_cast<size_t>(cols_) * rows_, {});
+        for (size_t i = 0; i < items_.size(); ++i) {
+            const Box b = box(items_[i]);
+            int c0, r0, c1, r1;
+            span(b[0], b[1], b[2], b[3], c0, r0, c1, r1);
+            for (int r = r0; r <= r1; ++r) {
+                for (int c = c0; c <= c1; ++c) {
+                    buckets_[static_cast<size_t>(r) * cols_ + c].push_back(static_cast<int>(i));
+                }
+            }
+        }
+    }
+
+    // Calls ``fn(obstacle)`` for obstacles whose buckets meet the box; an
+    // obstacle may be visited more than once.  Stops when ``fn`` is false.
+    template <typename Fn>
+    bool visit(float x0, float y0, float x1, float y1, Fn&& fn) const {
+        if (items_.empty()) return true;
+        int c0, r0, c1, r1;
+        span(x0, y0, x1, y1, c0, r0, c1, r1);
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                for (int id : buckets_[static_cast<size_t>(r) * cols_ + c]) {
+                    if (!fn(items_[id])) return false;
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    using Box = std::array<float, 4>;
+
+    static Box box(const Obstacle& o) {
+        switch (o.kind) {
+            case Obstacle::SEG: {
+                const float h = o.width / 2;
+                return {std::min(o.x1, o.x2) - h, std::min(o.y1, o.y2) - h,
+                        std::max(o.x1, o.x2) + h, std::max(o.y1, o.y2) + h};
+            }
+            case Obstacle::VIA: {
+                const float r = o.width / 2;
+                return {o.x1 - r, o.y1 - r, o.x1 + r, o.y1 + r};
+            }
+            default:
+                return {o.x1 - o.width / 2, o.y1 - o.height / 2, o.x1 + o.width / 2,
+                        o.y1 + o.height / 2};
+        }
+    }
+
+    void span(float x0, float y0, float x1, float y1, int& c0, int& r0, int& c1,
+              int& r1) const {
+        c0 = std::clamp(static_cast<int>(std::floor((x0 - bx0_) / bucket_)), 0, cols_ - 1);
+        r0 = std::clamp(static_cast<int>(std::floor((y0 - by0_) / bucket_)), 0, rows_ - 1);
+        c1 = std::clamp(static_cast<int>(std::floor((x1 - bx0_) / bucket_)), 0, cols_ - 1);
+        r1 = std::clamp(static_cast<int>(std::floor((y1 - by0_) / bucket_)), 0, rows_ - 1);
+    }
+
+    std::vector<Obstacle> items_;
+    std::vector<std::vector<int>> buckets_;
+    float bx0_ = 0.0f, by0_ = 0.0f, bucket_ = 1.0f;
+    int cols_ = 0, rows_ = 0;
+};
+
+}  // namespace
+
+MeanderTuner::MeanderTuner(const Grid3D& grid, const MeanderConfig& config)
+    : grid_(grid), config_(config) {}
+
+float MeanderTuner::length(const std::vector<Segment>& segments) {
+    float total = 0.0f;
+    for (const Segment& s : segments) total += seg_length(s);
+    return total;
+}
+
+std::vector<Segment> MeanderTuner::trombone(const Segment& host, float length_add,
+                                            float amplitude, int side, float min_host) const {
+    const float dx = host.x2 - host.x1, dy = host.y2 - host.y1;
+    const float len = std::hypot(dx, dy);
+    if (len < min_host || amplitude <= 0.0f) return {};
+    if (length_add <= 0.0f) return {host};
+
+    // Travel along the snapped direction so every leg is 45-aligned; the
+    // perpendicular of a legal direction is legal too.
+    const auto [ux, uy] = snap_direction_8(dx, dy);
+    const float px = -uy, py = ux;
+    const float gap = config_.min_spacing * config_.gap_factor;
+
+    int loops = std::min(static_cast<int>(std::ceil(length_add / (2.0f * amplitude))),
+                         config_.max_loops);
+    if (loops <= 0) return {host};
+    if (loops * gap * 2.0f + gap > len * 0.9f) {
+        loops = static_cast<int>((len * 0.9f - gap) / (2.0f * gap));
+        if (loops <= 0) return {};
+    }
+
+    std::vector<Segment> out;
+    float cx = host.x1, cy = host.y1;
+    auto leg = [&](float nx, float ny) {
+        out.push_back(Segment{cx, cy, nx, ny, host.width, host.layer, host.net});
+        cx = nx;
+        cy = ny;
+    };
+    leg(cx + ux * gap, cy + uy * gap);
+    int dir = side == 0 ? 1 : side;
+    for (int loop = 0; loop < loops; ++loop) {
+        leg(cx + px * amplitude * dir, cy + py * amplitude * dir);
+        leg(cx + ux * gap, cy + uy * gap);
+        leg(cx - px * amplitude * dir, cy - py * amplitude * dir);
+        if (loop < loops - 1) leg(cx + ux * gap, cy + uy * gap);
+        if (side == 0) dir = -dir;
+    }
+    const auto exit = dogleg_points(cx, cy, host.x2, host.y2);
+    for (size_t k = 1; k < exit.size(); ++k) {
+        if (exit[k] == exit[k - 1]) continue;
+        leg(exit[k].first, exit[k].second);
+    }
+    // Pin the end exactly.
+    out.back().x2 = host.x2;
+    out.back().y2 = host.y2;
+    return out;
+}
+
+std::vector<MeanderResult> MeanderTuner::tune_group(const std::vector<MeanderRequest>& members,
+                                                    int num_threads) const {
+    const size_t n = members.size();
+    std::vector<MeanderResult> results(n);
+    if (n == 0) return results;
+
+    // Board: stored routes of other nets, every pad, the members' routes.
+    std::unordered_set<int> group_nets;
+    for (const MeanderRequest& m : members) group_nets.insert(m.net);
+    std::vector<Obstacle> obstacles;
+    for (const StoredSegment& s : grid_.stored_segments()) {
+        if (group_nets.count(s.net)) continue;
+        obstacles.push_back({Obstacle::SEG, s.net, s.x1, s.y1, s.x2, s.y2, s.width, 0.0f,
+                             s.layer_idx, s.layer_idx, 0.0f});
+    }
+    const int all_layers = grid_.layers() - 1;
+    for (const StoredVia& v : grid_.stored_vias()) {
+        if (group_nets.count(v.net)) continue;
+        obstacles.push_back({Obstacle::VIA, v.net, v.x, v.y, v.x, v.y, v.diameter, 0.0f, 0,
+                             all_layers, 0.0f});
+    }
+    for (const PadInfo& p : grid_.pads()) {
+        obstacles.push_back({Obstacle::PAD, p.net, p.x, p.y, p.x, p.y, p.width, p.height,
+                             p.layer_idx, p.layer_idx, p.clearance_override});
+    }
+    for (const MeanderRequest& m : members) {
+        for (const Segment& s : m.segments) {
+            obstacles.push_back({Obstacle::SEG, m.net, s.x1, s.y1, s.x2, s.y2, s.width, 0.0f,
+                                 s.layer, s.layer, 0.0f});
+        }
+        for (const Via& v : m.vias) {
+            obstacles.push_back({Obstacle::VIA, m.net, v.x, v.y, v.x, v.y, v.diameter, 0.0f,
+                                 std::min(v.layer_from, v.layer_to),
+                                 std::max(v.layer_from, v.layer_to), 0.0f});
+        }
+    }
+    ObstacleIndex index;
+    index.build(std::move(obstacles));
+
+    const MeanderConfig& cfg = config_;
+    const float reach = std::max({cfg.trace_clearance, cfg.via_clearance, cfg.pad_clearance});
+
+    // New loop segments clear the board and ``overlay`` (other members'
+    // accepted loops).
+    auto clear = [&](const std::vector<Segment>& segs, int net,
+                     const std::vector<Segment>* overlay) {
+        for (const Segment& s : segs) {
+            const float hw = s.width / 2;
+            const float grow = hw + reach;
+            const float x0 = std::min(s.x1, s.x2) - grow, x1 = std::max(s.x1, s.x2) + grow;
+            const float y0 = std::min(s.y1, s.y2) - grow, y1 = std::max(s.y1, s.y2) + grow;
+            const bool ok = index.visit(x0, y0, x1, y1, [&](const Obstacle& o) {
+                if (o.net == net) return true;
+                switch (o.kind) {
+                    case Obstacle::SEG: {
+                        if (o.layer_lo != s.layer) return true;
+                        const float d = segment_to_segment_distance(s.x1, s.y1, s.x2, s.y2,
+                                                                    o.x1, o.y1, o.x2, o.y2);
+                        return d - hw - o.width / 2 >= cfg.trace_clearance - kEps;
+                    }
+                    case Obstacle::VIA: {
+                        if (cfg.via_clearance < 0.0f) return true;
+                        if (s.layer < o.layer_lo || s.layer > o.layer_hi) return true;
+                        const float d = point_to_segment_distance(o.x1, o.y1, s.x1, s.y1, s.x2,
+                                                                  s.y2);
+                        return d - hw - o.width / 2 >= cfg.via_clearance - kEps;
+                    }
+                    default: {
+                        if (o.layer_lo != -1 && o.layer_lo != s.layer) return true;
+                        const float need = o.clearance_override > 0.0f ? o.clearance_override
+                                                                       : cfg.pad_clearance;
+                        const float d = rect_segment_centerline_distance(
+                            o.x1, o.y1, o.width, o.height, s.x1, s.y1, s.x2, s.y2);
+                        return d - hw >= need - kEps;
+                    }
+                }
+            });
+            if (!ok) return false;
+            if (!overlay) continue;
+            for (const Segment& o : *overlay) {
+                if (o.net == net || o.layer != s.layer) continue;
+                if (std::max(o.x1, o.x2) + o.width / 2 < x0 ||
+                    std::min(o.x1, o.x2) - o.width / 2 > x1 ||
+                    std::max(o.y1, o.y2) + o.width / 2 < y0 ||
+                    std::min(o.y1, o.y2) - o.width / 2 > y1) {
+                    continue;
+                }
+                const float d = segment_to_segment_distance(s.x1, s.y1, s.x2, s.y2, o.x1, o.y1,
+                                                            o.x2, o.y2);
+                if (d - hw - o.width / 2 < cfg.trace_clearance - kEps) return false;
+            }
+        }
+        return true;
+    };
+
+    // Bulge side for a host: away from the nearest other member
+    // (``_outer_normal_hint_group``), as +1 / -1 against the left normal.
+    auto outer_side = [&](const Segment& host, size_t self) {
+        const float mx = (host.x1 + host.x2) / 2, my = (host.y1 + host.y2) / 2;
+        float best = std::numeric_limits<float>::max(), hx = 0.0f, hy = 0.0f;
+        for (size_t j = 0; j < n; ++j) {
+            if (j == self) continue;
+            for (const Segment& o : members[j].segments) {
+                const float ox = o.x2 - o.x1, oy = o.y2 - o.y1;
+                const float l2 = ox * ox + oy * oy;
+                float t = l2 > 0.0f ? ((mx - o.x1) * ox + (my - o.y1) * oy) / l2 : 0.0f;
+                t = std::clamp(t, 0.0f, 1.0f);
+                const float cx = o.x1 + t * ox, cy = o.y1 + t * oy;
+                const float d2 = (cx - mx) * (cx - mx) + (cy - my) * (cy - my);
+                if (d2 < best) {
+                    best = d2;
+                    hx = mx - cx;
+                    hy = my - cy;
+                }
+            }
+        }
+        const auto [ux, uy] = snap_direction_8(host.x2 - host.x1, host.y2 - host.y1);
+        if (hx == 0.0f && hy == 0.0f) return 1;
+        return -uy * hx + ux * hy >= 0.0f ? 1 : -1;
+    };
+
+    const float gap = cfg.min_spacing * cfg.gap_factor;
+    auto tune_member = [&](size_t i, const std::vector<Segment>* overlay,
+                           std::vector<Segment>& added) {
+        const MeanderRequest& req = members[i];
+        MeanderResult res;
+        res.net = req.net;
+        res.segments = req.segments;
+        res.length_before = res.length_after = length(req.segments);
+        added.clear();
+        if (req.target_length - res.length_before <= cfg.tolerance) return res;
+
+        std::vector<Segment> current = merge_collinear(req.segments);
+        int status = MEANDER_BLOCKED;
+        for (int insert = 0; insert < cfg.max_inserts; ++insert) {
+            const float need = req.target_length - length(current);
+            if (need <= cfg.tolerance) break;
+            float floor_len = cfg.min_segment_length;
+            std::vector<int> hosts = rank_hosts(current, floor_len, cfg.max_candidates);
+            if (hosts.empty()) {
+                // Shortest host that fits one loop.
+                floor_len = std::min(floor_len, 3.0f * gap / 0.9f + 1e-5f);
+                hosts = rank_hosts(current, floor_len, cfg.max_candidates);
+            }
+            if (hosts.empty()) {
+                status = MEANDER_NO_SEGMENT;
+                break;
+            }
+            bool committed = false;
+            bool generated = false;
+            for (int h : hosts) {
+                const int side = outer_side(current[h], i);
+                for (float factor : cfg.amplitude_backoff) {
+                    const float ladder = cfg.amplitude * factor;
+                    const int planned =
+                        std::max(1, static_cast<int>(std::ceil(need / (2.0f * ladder))));
+                    const float amp = need / (2.0f * planned) * (1.0f + 1e-6f);
+                    std::vector<Segment> loop = trombone(current[h], need, amp, side, floor_len);
+                    if (loop.empty()) break;  // host too short at any amplitude
+                    generated = true;
+                    if (!clear(loop, req.net, overlay)) continue;
+                    current.erase(current.begin() + h);
+                    current.insert(current.begin() + h, loop.begin(), loop.end());
+                    added.insert(added.end(), loop.begin(), loop.end());
+                    res.inserts += 1;
+                    res.loops += static_cast<int>(loop.size()) / 4;  // 4 legs a loop, 1-2 exit
+                    committed = true;
+                    break;
+                }
+                if (committed) break;
+            }
+            if (!committed) {
+                status = generated ? MEANDER_BLOCKED : MEANDER_NO_SEGMENT;
+                break;
+            }
+        }
+        if (res.inserts == 0) {
+            res.status = status;
+            return res;
+        }
+        res.segments = std::move(current);
+        res.length_after = length(res.segments);
+        res.status = std::abs(req.target_length - res.length_after) <= cfg.tolerance
+                         ? MEANDER_TUNED
+                         : MEANDER_PARTIAL;
+        return res;
+    };
+
+    std::vector<std::vector<Segment>> added(n);
+    size_t threads = num_threads > 0 ? static_cast<size_t>(num_threads)
+                                     : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, n));
+    std::atomic<size_t> next{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    auto work = [&]() {
+        try {
+            for (size_t i = next.fetch_add(1); i < n; i = next.fetch_add(1)) {
+                results[i] = tune_member(i, nullptr, added[i]);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failure_mutex);
+            if (!failure) failure = std::current_exception();
+            next.store(n);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(work);
+    work();
+    for (std::thread& th : pool) th.join();
+    if (failure) std::rethrow_exception(failure);
+
+    // Members were tuned against each other's original routes; re-tune any
+    // whose loops clash with loops accepted earlier in request order.
+    std::vector<Segment> accepted;
+    for (size_t i = 0; i < n; ++i) {
+        if (!added[i].empty() && !clear(added[i], members[i].net, &accepted)) {
+            results[i] = tune_member(i, &accepted, added[i]);
+        }
+        accepted.insert(accepted.end(), added[i].begin(), added[i].end());
+    }
+    return results;
+}
+
+}  // namespace router
@@ -16,16 +16,30 @@
  * general arbitrary-segment constraint facility.  That matches the P1 need:
  * the only constraints we require are the board outline and the pad keep-out
  * boundaries.
+ *
+ * The ``NavMesh`` binding (navmesh.hpp) is registered here as well: it is
+ * built straight from this triangulation (``NavMesh.from_cdt``) and runs the
+ * corridor A* + funnel natively.  ``IncrementalCDT`` (incremental_cdt.hpp)
+ * adopts this triangulation and edits its hole set locally afterwards.
  */
 
+#include "incremental_cdt.hpp"
+#include "navmesh.hpp"
 #include "poly2tri.h"
 
 #include <nanobind/nanobind.h>
+#include <nanobind/stl/array.h>
+#include <nanobind/stl/map.h>
+#include <nanobind/stl/optional.h>
+#include <nanobind/stl/string.h>
 #include <nanobind/stl/vector.h>
 #include <nanobind/stl/pair.h>
 #include <nanobind/stl/tuple.h>
 
+#include <array>
 #include <cmath>
+#include <optional>
+#include <string>
 #include <memory>
 #include <tuple>
 #include <unordered_map>
@@ -135,6 +149,18 @@ MeshResult constrained_delaunay(const std::vector<Coord>& outer,
     return result;
 }
 
+router::NavMesh::Pack parse_pack(const std::string& pack)
+{
+    // Same fallback as ``_narrow_portal``: anything else packs "largest".
+    if (pack == "left") {
+        return router::NavMesh::Pack::LEFT;
+    }
+    if (pack == "right") {
+        return router::NavMesh::Pack::RIGHT;
+    }
+    return router::NavMesh::Pack::LARGEST;
+}
+
 }  // namespace
 
 // Declared in bindings.cpp; called from NB_MODULE(router_cpp, ...).
@@ -146,4 +172,149 @@ void register_mesh(nb::module_& m)
           "holes plus interior Steiner points. Returns (vertices, triangles) "
           "where each triangle is an index triple into vertices. Empty result "
           "signals a meshing failure (degenerate input).");
+
+    using router::NavMesh;
+    using Edge = NavMesh::Edge;
+    nb::class_<NavMesh>(m, "NavMesh")
+        .def(nb::init<const std::vector<NavMesh::Pt>&,
+                      const std::vector<std::array<int, 3>>&, double>(),
+             nb::arg("vertices"), nb::arg("triangles"), nb::arg("channel") = 0.0)
+        .def_static(
+            "from_cdt",
+            [](const std::vector<Coord>& outer,
+               const std::vector<std::vector<Coord>>& holes,
+               const std::vector<Coord>& steiner, double channel) {
+                MeshResult mesh = constrained_delaunay(outer, holes, steiner);
+                std::vector<std::array<int, 3>> tris;
+                tris.reserve(mesh.second.size());
+                for (const auto& [a, b, c] : mesh.second) {
+                    tris.push_back({a, b, c});
+                }
+                return NavMesh(mesh.first, tris, channel);
+            },
+            nb::arg("outer"), nb::arg("holes"), nb::arg("steiner"),
+            nb::arg("channel") = 0.0,
+            "Triangulate (poly2tri) and build the navmesh in one call. An "
+            "empty mesh signals a meshing failure.")
+        .def_prop_ro("num_vertices", &NavMesh::num_vertices)
+        .def_prop_ro("num_triangles", &NavMesh::num_triangles)
+        .def(
+            "apply_cdt_update",
+            [](NavMesh& self, const router::IncrementalCDT& cdt,
+               const router::IncrementalCDT::Update& update) {
+                self.apply_update(cdt.vertices(), cdt.triangles(), update.changed,
+                                  update.moved);
+            },
+            nb::arg("cdt"), nb::arg("update"),
+            "Patch the mesh in place after one IncrementalCDT edit; occupancy "
+            "and history on the portals it leaves in place carry over.")
+        .def_prop_ro("channel", &NavMesh::channel)
+        .def_prop_ro("has_history", &NavMesh::has_history)
+        .def("locate", &NavMesh::locate, nb::arg("p"))
+        .def("edge_length", &NavMesh::edge_length, nb::arg("edge"))
+        .def("capacity", &NavMesh::capacity, nb::arg("edge"))
+        .def("occupancy", &NavMesh::occupancy, nb::arg("edge"))
+        .def("history", &NavMesh::history, nb::arg("edge"))
+        .def("commit_portal", &NavMesh::commit_portal, nb::arg("edge"))
+        .def("release_portal", &NavMesh::release_portal, nb::arg("edge"))
+        .def("reset_occupancy", &NavMesh::reset_occupancy)
+        .def("add_history", &NavMesh::add_history, nb::arg("edge"), nb::arg("increment"))
+        .def("clear_history", &NavMesh::clear_history)
+        .def("occupied_portals", &NavMesh::occupied_portals)
+        .def("astar", &NavMesh::astar, nb::arg("start"), nb::arg("goal"),
+             nb::arg("present_cost_factor") = 0.0, nb::arg("cost_congestion") = 0.0,
+             nb::arg("congestion_threshold") = 0.0,
+             nb::call_guard<nb::gil_scoped_release>(),
+             "Portal-midpoint A* over the triangle dual; None when start and "
+             "goal are disconnected.")
+        .def("corridor_portals", &NavMesh::corridor_portals, nb::arg("corridor"))
+        .def(
+            "corridor_to_portals",
+            [](const NavMesh& nm, const std::vector<int>& corridor,
+               const NavMesh::Pt& start, const NavMesh::Pt& goal,
+               const std::optional<NavMesh::ConsumedBands>& consumed,
+               const std::string& pack) {
+                return nm.corridor_to_portals(corridor, start, goal,
+                                              consumed ? *consumed : NavMesh::ConsumedBands{},
+                                              parse_pack(pack));
+            },
+            nb::arg("corridor"), nb::arg("start"), nb::arg("goal"),
+            nb::arg("consumed") = nb::none(), nb::arg("pack") = "largest")
+        .def_static("string_pull", &NavMesh::string_pull, nb::arg("portals"))
+        .def(
+            "find_path",
+            [](const NavMesh& nm, const NavMesh::Pt& start, const NavMesh::Pt& goal,
+               double present_cost_factor, double cost_congestion,
+               double congestion_threshold,
+               const std::optional<NavMesh::ConsumedBands>& consumed,
+               const std::string& pack)
+                -> std::optional<std::tuple<std::vector<int>, std::vector<Edge>,
+                                            std::vector<NavMesh::Pt>>> {
+                const NavMesh::Pack p = parse_pack(pack);
+                std::optional<NavMesh::PathResult> res;
+                {
+                    nb::gil_scoped_release release;
+                    res = nm.find_path(start, goal, present_cost_factor, cost_congestion,
+                                       congestion_threshold,
+                                       consumed ? *consumed : NavMesh::ConsumedBands{}, p);
+                }
+                if (!res) {
+                    return std::nullopt;
+                }
+                return std::make_tuple(std::move(res->corridor), std::move(res->portals),
+                                       std::move(res->path));
+            },
+            nb::arg("start"), nb::arg("goal"), nb::arg("present_cost_factor") = 0.0,
+            nb::arg("cost_congestion") = 0.0, nb::arg("congestion_threshold") = 0.0,
+            nb::arg("consumed") = nb::none(), nb::arg("pack") = "largest",
+            "A* + oriented portals + funnel in one call. Returns (corridor, "
+            "portal_edges, polyline) or None when start and goal are "
+            "disconnected.");
+
+    using router::IncrementalCDT;
+    nb::class_<IncrementalCDT::Update>(m, "CdtUpdate")
+        .def_ro("ok", &IncrementalCDT::Update::ok)
+        .def_ro("hole_id", &IncrementalCDT::Update::hole_id)
+        .def_ro("changed", &IncrementalCDT::Update::changed)
+        .def_ro("moved", &IncrementalCDT::Update::moved);
+
+    nb::class_<IncrementalCDT>(m, "IncrementalCDT")
+        .def(nb::init<const std::vector<Coord>&, const std::vector<std::array<int, 3>>&>(),
+             nb::arg("vertices"), nb::arg("triangles"),
+             "Adopt a triangulation (``constrained_delaunay`` output); every "
+             "inner boundary loop becomes a removable hole.")
+        .def_prop_ro("vertices", &IncrementalCDT::vertices)
+        .def_prop_ro("triangles", &IncrementalCDT::triangles)
+        .def_prop_ro("num_triangles",
+                     [](const IncrementalCDT& self) { return self.triangles().size(); })
+        .def(
+            "triangles_at",
+            [](const IncrementalCDT& self, const std::vector<int>& ids) {
+                std::vector<std::array<int, 3>> out;
+                out.reserve(ids.size());
+                for (int t : ids) out.push_back(self.triangles().at(t));
+                return out;
+            },
+            nb::arg("ids"), "The triangles at ``ids`` (an update's slots).")
+        .def(
+            "vertices_at",
+            [](const IncrementalCDT& self, const std::vector<int>& ids) {
+                std::vector<Coord> out;
+                out.reserve(ids.size());
+                for (int v : ids) out.push_back(self.vertices().at(v));
+                return out;
+            },
+            nb::arg("ids"), "The vertices at ``ids``.")
+        .def("hole_ids", &IncrementalCDT::hole_ids)
+        .def("hole_loop", &IncrementalCDT::hole_loop, nb::arg("hole_id"))
+        .def("hole_at", &IncrementalCDT::hole_at, nb::arg("p"))
+        .def("insert_hole", &IncrementalCDT::insert_hole, nb::arg("polygon"),
+             nb::call_guard<nb::gil_scoped_release>(),
+             "Cut a hole polygon out of the mesh, re-triangulating only the "
+             "touched cavity. ``ok`` is False (mesh untouched) when the hole "
+             "leaves the domain or overlaps another hole.")
+        .def("remove_hole", &IncrementalCDT::remove_hole, nb::arg("hole_id"),
+             nb::call_guard<nb::gil_scoped_release>(),
+             "Fill a hole back in, re-triangulating only its surroundings.")
+        .def("is_valid", &IncrementalCDT::is_valid);
 }
@@ -0,0 +1,718 @@
+/*
+ * Router C++ Core - triangle-dual navmesh for the mesh router
+ *
+ * Implementation of navmesh.hpp.  Each block mirrors the Python function
+ * named in its comment (``router/mesh/navmesh.py`` / ``funnel.py`` /
+ * ``geometry.py``), including its tolerances and tie-breaks, so the native
+ * and Python paths return the same corridors and geodesics.
+ */
+
+#include "navmesh.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <string>
+
+namespace router {
+
+namespace {
+
+using Pt = NavMesh::Pt;
+
+inline uint64_t edge_key(int u, int v) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(u)) << 32) |
+           static_cast<uint32_t>(v);
+}
+
+inline double dist(const Pt& a, const Pt& b) {
+    return std::hypot(b.first - a.first, b.second - a.second);
+}
+
+// ``geometry.tri_area2``.
+inline double tri_area2(const Pt& a, const Pt& b, const Pt& c) {
+    return (b.first - a.first) * (c.second - a.second) -
+           (c.first - a.first) * (b.second - a.second);
+}
+
+// Mononen ``triarea2`` (``funnel._area`` / ``navmesh._mononen_area``).
+inline double mononen_area(const Pt& a, const Pt& b, const Pt& c) {
+    const double ax = b.first - a.first;
+    const double ay = b.second - a.second;
+    const double bx = c.first - a.first;
+    const double by = c.second - a.second;
+    return bx * ay - ax * by;
+}
+
+inline bool point_equal(const Pt& a, const Pt& b) {
+    return std::abs(a.first - b.first) <= NavMesh::kEps &&
+           std::abs(a.second - b.second) <= NavMesh::kEps;
+}
+
+// ``geometry.point_in_triangle`` (winding-agnostic, boundary inclusive).
+inline bool point_in_triangle(const Pt& p, const Pt& a, const Pt& b, const Pt& c) {
+    const double d1 = tri_area2(p, a, b);
+    const double d2 = tri_area2(p, b, c);
+    const double d3 = tri_area2(p, c, a);
+    const double e = NavMesh::kEps;
+    const bool has_neg = d1 < -e || d2 < -e || d3 < -e;
+    const bool has_pos = d1 > e || d2 > e || d3 > e;
+    return !(has_neg && has_pos);
+}
+
+// Reject a triangle naming a vertex outside ``vertices`` before any table
+// is indexed with it (the Python side hands these over unchecked).
+void check_triangles(const char* caller, size_t num_vertices,
+                     const std::vector<std::array<int, 3>>& triangles) {
+    for (const auto& tri : triangles) {
+        for (int v : tri) {
+            if (v < 0 || static_cast<size_t>(v) >= num_vertices) {
+                throw std::invalid_argument(std::string(caller) +
+                                            ": triangle vertex index out of range");
+            }
+        }
+    }
+}
+
+// ``geometry.merge_intervals``.
+std::vector<NavMesh::Interval> merge_intervals(std::vector<NavMesh::Interval> ivals) {
+    std::vector<NavMesh::Interval> out;
+    if (ivals.empty()) return out;
+    std::sort(ivals.begin(), ivals.end());
+    out.push_back(ivals[0]);
+    for (size_t i = 1; i < ivals.size(); ++i) {
+        if (ivals[i].first <= out.back().second + 1e-9) {
+            out.back().second = std::max(out.back().second, ivals[i].second);
+        } else {
+            out.push_back(ivals[i]);
+        }
+    }
+    return out;
+}
+
+// ``navmesh._narrow_portal``: clip the oriented portal to one free gap.
+NavMesh::Portal narrow_portal(const Pt& left, const Pt& right, bool reversed,
+                              const std::vector<NavMesh::Interval>& bands,
+                              NavMesh::Pack pack) {
+    std::vector<NavMesh::Interval> s_bands;
+    s_bands.reserve(bands.size());
+    for (const auto& [t0, t1] : bands) {
+        double s0 = reversed ? 1.0 - t1 : t0;
+        double s1 = reversed ? 1.0 - t0 : t1;
+        s_bands.emplace_back(std::max(0.0, std::min(1.0, s0)),
+                             std::max(0.0, std::min(1.0, s1)));
+    }
+    const std::vector<NavMesh::Interval> consumed = merge_intervals(std::move(s_bands));
+    if (consumed.empty()) return {left, right};
+
+    std::vector<NavMesh::Interval> gaps;
+    double cursor = 0.0;
+    for (const auto& [c0, c1] : consumed) {
+        if (c0 > cursor) gaps.emplace_back(cursor, c0);
+        cursor = std::max(cursor, c1);
+    }
+    if (cursor < 1.0) gaps.emplace_back(cursor, 1.0);
+    // Fully consumed: collapse onto the right wall (the fit declines it).
+    if (gaps.empty()) return {right, right};
+
+    NavMesh::Interval gap;
+    if (pack == NavMesh::Pack::LEFT) {
+        gap = gaps.front();
+    } else if (pack == NavMesh::Pack::RIGHT) {
+        gap = gaps.back();
+    } else {
+        // First widest gap (Python ``max`` keeps the first on ties).
+        gap = gaps.front();
+        for (const auto& g : gaps) {
+            if (g.second - g.first > gap.second - gap.first) gap = g;
+        }
+    }
+    const auto [lo, hi] = gap;
+    return {{left.first + lo * (right.first - left.first),
+             left.second + lo * (right.second - left.second)},
+            {left.first + hi * (right.first - left.first),
+             left.second + hi * (right.second - left.second)}};
+}
+
+}  // namespace
+
+NavMesh::NavMesh(const std::vector<Pt>& vertices,
+                 const std::vector<std::array<int, 3>>& triangles,
+                 double channel)
+    : vertices_(vertices), triangles_(triangles), channel_(channel) {
+    check_triangles("NavMesh", vertices_.size(), triangles_);
+    const int nt = static_cast<int>(triangles_.size());
+    tri_edges_.assign(nt, {-1, -1, -1});
+    tri_nbr_.assign(nt, {-1, -1, -1});
+    tri_nbr_edge_.assign(nt, {-1, -1, -1});
+    centroids_.resize(nt);
+    edge_id_.reserve(static_cast<size_t>(nt) * 2);
+
+    // Edge table in first-seen order (``_edge_tris`` insertion order).
+    for (int t = 0; t < nt; ++t) {
+        const auto& tri = triangles_[t];
+        const Pt& a = vertices_[tri[0]];
+        const Pt& b = vertices_[tri[1]];
+        const Pt& c = vertices_[tri[2]];
+        centroids_[t] = {(a.first + b.first + c.first) / 3.0,
+                         (a.second + b.second + c.second) / 3.0};
+        for (int k = 0; k < 3; ++k) {
+            int u = tri[k], v = tri[(k + 1) % 3];
+            if (u > v) std::swap(u, v);
+            auto [it, inserted] = edge_id_.emplace(edge_key(u, v), static_cast<int>(edges_.size()));
+            if (inserted) {
+                edges_.emplace_back(u, v);
+                const Pt& p = vertices_[u];
+                const Pt& q = vertices_[v];
+                edge_mid_.emplace_back((p.first + q.first) / 2.0, (p.second + q.second) / 2.0);
+                edge_len_.push_back(dist(p, q));
+                edge_tris_.push_back({t, -1});
+                edge_count_.push_back(1);
+            } else {
+                const int e = it->second;
+                if (edge_count_[e] == 1) edge_tris_[e][1] = t;
+                ++edge_count_[e];
+            }
+            tri_edges_[t][k] = it->second;
+        }
+    }
+    const int ne = static_cast<int>(edges_.size());
+    edge_is_portal_.assign(ne, 0);
+    for (int e = 0; e < ne; ++e) edge_is_portal_[e] = edge_count_[e] == 2;
+
+    for (int t = 0; t < nt; ++t) link_neighbours(t);
+
+    // Vertex -> incident triangles.
+    vtx_tris_.resize(vertices_.size());
+    for (int t = 0; t < nt; ++t) {
+        for (int v : triangles_[t]) vtx_tris_[v].push_back(t);
+    }
+
+    occupancy_.assign(ne, 0);
+    history_.assign(ne, 0.0);
+    build_buckets();
+}
+
+// Neighbour links sorted by shared-edge id (``_adj`` order).
+void NavMesh::link_neighbours(int t) {
+    std::array<int, 3> ids = tri_edges_[t];
+    std::sort(ids.begin(), ids.end());
+    tri_nbr_[t] = {-1, -1, -1};
+    tri_nbr_edge_[t] = {-1, -1, -1};
+    int n = 0;
+    for (int k = 0; k < 3; ++k) {
+        const int e = ids[k];
+        if (!edge_is_portal_[e]) continue;
+        if (k > 0 && ids[k - 1] == e) continue;  // degenerate triangle
+        const auto& et = edge_tris_[e];
+        tri_nbr_[t][n] = et[0] == t ? et[1] : et[0];
+        tri_nbr_edge_[t][n] = e;
+        ++n;
+    }
+}
+
+void NavMesh::build_buckets() {
+    const int nt = static_cast<int>(triangles_.size());
+    if (nt == 0) return;
+    double x0 = std::numeric_limits<double>::infinity(), y0 = x0;
+    double x1 = -x0, y1 = -x0;
+    for (const auto& tri : triangles_) {
+        for (int v : tri) {
+            x0 = std::min(x0, vertices_[v].first);
+            y0 = std::min(y0, vertices_[v].second);
+            x1 = std::max(x1, vertices_[v].first);
+            y1 = std::max(y1, vertices_[v].second);
+        }
+    }
+    // About two triangles per bucket on a uniform mesh.
+    const int side = std::clamp(static_cast<int>(std::sqrt(nt / 2.0)), 1, 1024);
+    bucket_cols_ = bucket_rows_ = side;
+    bx0_ = x0;
+    by0_ = y0;
+    bucket_w_ = x1 > x0 ? (x1 - x0) / side : 1.0;
+    bucket_h_ = y1 > y0 ? (y1 - y0) / side : 1.0;
+
+    buckets_.assign(static_cast<size_t>(bucket_cols_) * bucket_rows_, {});
+    std::vector<int> hit;
+    for (int t = 0; t < nt; ++t) {
+        tri_buckets(triangles_[t], hit);
+        for (int b : hit) buckets_[b].push_back(t);
+    }
+}
+
+// Buckets the bounding box of ``tri`` (grown by ``kEps``) overlaps.
+void NavMesh::tri_buckets(const std::array<int, 3>& tri, std::vector<int>& out) const {
+    out.clear();
+    if (bucket_cols_ == 0) return;
+    auto col_of = [&](double x) {
+        return std::clamp(static_cast<int>(std::floor((x - bx0_) / bucket_w_)), 0, bucket_cols_ - 1);
+    };
+    auto row_of = [&](double y) {
+        return std::clamp(static_cast<int>(std::floor((y - by0_) / bucket_h_)), 0, bucket_rows_ - 1);
+    };
+    double tx0 = vertices_[tri[0]].first, tx1 = tx0;
+    double ty0 = vertices_[tri[0]].second, ty1 = ty0;
+    for (int k = 1; k < 3; ++k) {
+        tx0 = std::min(tx0, vertices_[tri[k]].first);
+        tx1 = std::max(tx1, vertices_[tri[k]].first);
+        ty0 = std::min(ty0, vertices_[tri[k]].second);
+        ty1 = std::max(ty1, vertices_[tri[k]].second);
+    }
+    const int c0 = col_of(tx0 - kEps), c1 = col_of(tx1 + kEps);
+    const int r0 = row_of(ty0 - kEps), r1 = row_of(ty1 + kEps);
+    for (int r = r0; r <= r1; ++r) {
+        for (int c = c0; c <= c1; ++c) out.push_back(r * bucket_cols_ + c);
+    }
+}
+
+int NavMesh::bucket_of(double x, double y) const {
+    const int c = std::clamp(static_cast<int>(std::floor((x - bx0_) / bucket_w_)), 0, bucket_cols_ - 1);
+    const int r = std::clamp(static_cast<int>(std::floor((y - by0_) / bucket_h_)), 0, bucket_rows_ - 1);
+    return r * bucket_cols_ + c;
+}
+
+// Slots ``changed`` and the ``moved`` targets receive new contents; those
+// slots and the truncated tail lose their old ones.  Unlinking the departing
+// triangles and linking the arriving ones touches only their edges, fans and
+// buckets; every triangle on a touched edge then relinks its neighbours.
+// IncrementalCDT meshes are manifold, so ``edge_tris_`` always holds every
+// incidence of a live edge.
+void NavMesh::apply_update(const std::vector<Pt>& vertices,
+                           const std::vector<std::array<int, 3>>& triangles,
+                           const std::vector<int>& changed,
+                           const std::vector<std::pair<int, int>>& moved) {
+    const int old_nt = static_cast<int>(triangles_.size());
+    const int new_nt = static_cast<int>(triangles.size());
+    check_triangles("NavMesh.apply_update", vertices.size(), triangles);
+    auto in_range = [new_nt](int t) { return t >= 0 && t < new_nt; };
+    if (!std::all_of(changed.begin(), changed.end(), in_range) ||
+        !std::all_of(moved.begin(), moved.end(),
+                     [&](const std::pair<int, int>& mv) { return in_range(mv.second); })) {
+        throw std::invalid_argument("NavMesh.apply_update: triangle index out of range");
+    }
+    auto sort_unique = [](std::vector<int>& ids) {
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    };
+    auto erase_sorted = [](std::vector<int>& ids, int t) {
+        auto it = std::lower_bound(ids.begin(), ids.end(), t);
+        if (it != ids.end() && *it == t) ids.erase(it);
+    };
+    auto insert_sorted = [](std::vector<int>& ids, int t) {
+        auto it = std::lower_bound(ids.begin(), ids.end(), t);
+        if (it == ids.end() || *it != t) ids.insert(it, t);
+    };
+
+    std::vector<int> arrived(changed);
+    for (const auto& mv : moved) arrived.push_back(mv.second);
+    sort_unique(arrived);
+    std::vector<int> gone;
+    for (int t : arrived) {
+        if (t < old_nt) gone.push_back(t);
+    }
+    for (int t = new_nt; t < old_nt; ++t) gone.push_back(t);
+
+    std::vector<int> touched;
+    std::vector<int> hit;
+    for (int t : gone) {
+        const auto& tri = triangles_[t];
+        tri_buckets(tri, hit);
+        for (int b : hit) erase_sorted(buckets_[b], t);
+        for (int v : tri) erase_sorted(vtx_tris_[v], t);
+        for (int e : tri_edges_[t]) {
+            auto& et = edge_tris_[e];
+            if (et[0] == t) {
+                et[0] = et[1];
+                et[1] = -1;
+            } else if (et[1] == t) {
+                et[1] = -1;
+            }
+            --edge_count_[e];
+            touched.push_back(e);
+        }
+    }
+
+    triangles_.resize(new_nt);
+    tri_edges_.resize(new_nt, {-1, -1, -1});
+    tri_nbr_.resize(new_nt, {-1, -1, -1});
+    tri_nbr_edge_.resize(new_nt, {-1, -1, -1});
+    centroids_.resize(new_nt);
+    if (vertices.size() > vertices_.size()) {
+        vertices_.resize(vertices.size());
+        vtx_tris_.resize(vertices.size());
+    }
+    // Vertex ids are stable but recycled: refresh the ones the new
+    // triangles use (dropped vertices are in no triangle, so never read).
+    for (int t : arrived) {
+        triangles_[t] = triangles[t];
+        for (int v : triangles_[t]) vertices_[v] = vertices[v];
+    }
+
+    for (int t : arrived) {
+        const auto& tri = triangles_[t];
+        const Pt& a = vertices_[tri[0]];
+        const Pt& b = vertices_[tri[1]];
+        const Pt& c = vertices_[tri[2]];
+        centroids_[t] = {(a.first + b.first + c.first) / 3.0,
+                         (a.second + b.second + c.second) / 3.0};
+        for (int v : tri) insert_sorted(vtx_tris_[v], t);
+        tri_buckets(tri, hit);
+        for (int bk : hit) insert_sorted(buckets_[bk], t);
+        for (int k = 0; k < 3; ++k) {
+            int u = tri[k], v = tri[(k + 1) % 3];
+            if (u > v) std::swap(u, v);
+            auto [it, inserted] = edge_id_.emplace(edge_key(u, v), static_cast<int>(edges_.size()));
+            if (inserted) {
+                edges_.emplace_back(u, v);
+                edge_mid_.emplace_back(0.0, 0.0);
+                edge_len_.push_back(0.0);
+                edge_tris_.push_back({-1, -1});
+                edge_count_.push_back(0);
+                edge_is_portal_.push_back(0);
+                occupancy_.push_back(0);
+                history_.push_back(0.0);
+            }
+            const int e = it->second;
+            if (edge_count_[e] < 2) edge_tris_[e][edge_count_[e]] = t;
+            ++edge_count_[e];
+            tri_edges_[t][k] = e;
+            touched.push_back(e);
+        }
+    }
+
+    // Touched edges: refresh geometry and portal status.  An edge the edit
+    // removed drops its negotiation state so a later edge reusing the
+    // (recycled) vertex pair starts clean.
+    sort_unique(touched);
+    std::vector<int> relink(arrived);
+    for (int e : touched) {
+        const Pt& p = vertices_[edges_[e].first];
+        const Pt& q = vertices_[edges_[e].second];
+        edge_mid_[e] = {(p.first + q.first) / 2.0, (p.second + q.second) / 2.0};
+        edge_len_[e] = dist(p, q);
+        edge_is_portal_[e] = edge_count_[e] == 2;
+        if (edge_count_[e] == 0) {
+            occupancy_[e] = 0;
+            history_[e] = 0.0;
+        }
+        for (int t : edge_tris_[e]) {
+            if (t >= 0) relink.push_back(t);
+        }
+    }
+    sort_unique(relink);
+    for (int t : relink) link_neighbours(t);
+
+    if (bucket_cols_ == 0) build_buckets();
+}
+
+// ``NavMesh.locate`` (+ ``_vertex_index``).
+std::vector<int> NavMesh::locate(const Pt& p) const {
+    std::vector<int> hits;
+    if (triangles_.empty()) return hits;
+    const int b = bucket_of(p.first, p.second);
+
+    // Coincident vertex: the nearest within kEps; Python scans vertices in
+    // index order with ``<=``, so the highest index wins a tie.
+    int best = -1;
+    double best_d = kEps;
+    for (int t : buckets_[b]) {
+        for (int v : triangles_[t]) {
+            const double d = dist(vertices_[v], p);
+            if (d < best_d || (d == best_d && v > best)) {
+                best_d = d;
+                best = v;
+            }
+        }
+    }
+    if (best >= 0 && !vtx_tris_[best].empty()) return vtx_tris_[best];
+
+    for (int t : buckets_[b]) {
+        const auto& tri = triangles_[t];
+        if (point_in_triangle(p, vertices_[tri[0]], vertices_[tri[1]], vertices_[tri[2]])) {
+            hits.push_back(t);
+        }
+    }
+    return hits;
+}
+
+int NavMesh::edge_index(const Edge& e) const {
+    int u = e.first, v = e.second;
+    if (u > v) std::swap(u, v);
+    auto it = edge_id_.find(edge_key(u, v));
+    return it == edge_id_.end() ? -1 : it->second;
+}
+
+double NavMesh::edge_length(const Edge& e) const {
+    const int id = edge_index(e);
+    if (id >= 0) return edge_len_[id];
+    return dist(vertices_.at(e.first), vertices_.at(e.second));
+}
+
+// ``NavMesh.capacity``: ``floor(edge_len / channel)``; unbounded when the
+// capacity model is off.
+int NavMesh::capacity(const Edge& e) const {
+    if (channel_ <= 0.0) return 1000000000;
+    return static_cast<int>(edge_length(e) / channel_);
+}
+
+int NavMesh::occupancy(const Edge& e) const {
+    const int id = edge_index(e);
+    return id >= 0 ? occupancy_[id] : 0;
+}
+
+double NavMesh::history(const Edge& e) const {
+    const int id = edge_index(e);
+    return id >= 0 ? history_[id] : 0.0;
+}
+
+void NavMesh::commit_portal(const Edge& e) {
+    const int id = edge_index(e);
+    if (id >= 0) ++occupancy_[id];
+}
+
+void NavMesh::release_portal(const Edge& e) {
+    const int id = edge_index(e);
+    if (id >= 0 && occupancy_[id] > 0) --occupancy_[id];
+}
+
+void NavMesh::reset_occupancy() {
+    std::fill(occupancy_.begin(), occupancy_.end(), 0);
+}
+
+void NavMesh::add_history(const Edge& e, double increment) {
+    const int id = edge_index(e);
+    if (id < 0) return;
+    history_[id] += increment;
+    has_history_ = true;
+}
+
+void NavMesh::clear_history() {
+    std::fill(history_.begin(), history_.end(), 0.0);
+    has_history_ = false;
+}
+
+std::vector<NavMesh::Edge> NavMesh::occupied_portals() const {
+    std::vector<Edge> out;
+    for (size_t e = 0; e < edges_.size(); ++e) {
+        if (occupancy_[e] > 0) out.push_back(edges_[e]);
+    }
+    return out;
+}
+
+// ``NavMesh.portal_penalty``: PathFinder present + history multiplier.
+double NavMesh::portal_penalty(int edge_id, double present_cost_factor,
+                               double cost_congestion, double congestion_threshold) const {
+    const int cap = channel_ <= 0.0 ? 1000000000
+                                    : static_cast<int>(edge_len_[edge_id] / channel_);
+    const int occ = occupancy_[edge_id];
+    const double density = cap <= 0 ? static_cast<double>(occ + 1)
+                                     : static_cast<double>(occ + 1) / cap;
+    double present = 0.0;
+    if (density > congestion_threshold) {
+        present = cost_congestion * (density - congestion_threshold);
+    }
+    return present_cost_factor * present + history_[edge_id];
+}
+
+// ``NavMesh.astar``: portal-midpoint step cost, straight-line heuristic,
+// ``(f, push counter)`` heap order and the same stale-entry guard.
+std::optional<std::vector<int>> NavMesh::astar(const Pt& start, const Pt& goal,
+                                               double present_cost_factor,
+                                               double cost_congestion,
+                                               double congestion_threshold) const {
+    const std::vector<int> start_tris = locate(start);
+    const std::vector<int> goal_tris = locate(goal);
+    if (start_tris.empty() || goal_tris.empty()) return std::nullopt;
+
+    const int nt = static_cast<int>(triangles_.size());
+    std::vector<uint8_t> is_goal(nt, 0), is_start(nt, 0);
+    for (int t : goal_tris) is_goal[t] = 1;
+    for (int t : start_tris) is_start[t] = 1;
+
+    const bool negotiating = present_cost_factor != 0.0 || has_history_;
+    auto h = [&goal](const Pt& p) {
+        return std::hypot(goal.first - p.first, goal.second - p.second);
+    };
+
+    struct Item {
+        double f;
+        uint64_t seq;
+        int tri;
+        Pt entry;
+    };
+    struct ItemGreater {
+        bool operator()(const Item& a, const Item& b) const {
+            if (a.f != b.f) return a.f > b.f;
+            return a.seq > b.seq;
+        }
+    };
+    std::priority_queue<Item, std::vector<Item>, ItemGreater> open;
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> g_score(nt, inf);
+    std::vector<int> came_from(nt, -1);
+    uint64_t seq = 0;
+    for (int t : start_tris) {
+        g_score[t] = 0.0;
+        open.push({h(start), seq++, t, start});
+    }
+
+    while (!open.empty()) {
+        const Item cur = open.top();
+        open.pop();
+        const double g = g_score[cur.tri];
+        if (cur.f - h(cur.entry) > g + 1e-6) continue;
+        if (is_goal[cur.tri]) {
+            std::vector<int> corridor{cur.tri};
+            int t = cur.tri;
+            while (!is_start[t] && came_from[t] >= 0) {
+                t = came_from[t];
+                corridor.push_back(t);
+            }
+            std::reverse(corridor.begin(), corridor.end());
+            return corridor;
+        }
+        for (int k = 0; k < 3 && tri_nbr_[cur.tri][k] >= 0; ++k) {
+            const int nbr = tri_nbr_[cur.tri][k];
+            const int e = tri_nbr_edge_[cur.tri][k];
+            const Pt& mid = edge_mid_[e];
+            double step = dist(cur.entry, mid);
+            if (negotiating) {
+                step *= 1.0 + portal_penalty(e, present_cost_factor, cost_congestion,
+                                             congestion_threshold);
+            }
+            const double tentative = g + step;
+            if (tentative < g_score[nbr] - 1e-9) {
+                g_score[nbr] = tentative;
+                came_from[nbr] = cur.tri;
+                open.push({tentative + h(mid), seq++, nbr, mid});
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+// ``NavMesh._shared_edge``.
+int NavMesh::shared_edge_id(int t0, int t1) const {
+    for (int a : tri_edges_[t0]) {
+        for (int b : tri_edges_[t1]) {
+            if (a == b) return a;
+        }
+    }
+    return -1;
+}
+
+std::vector<NavMesh::Edge> NavMesh::corridor_portals(const std::vector<int>& corridor) const {
+    std::vector<Edge> out;
+    for (size_t i = 0; i + 1 < corridor.size(); ++i) {
+        const int e = shared_edge_id(corridor[i], corridor[i + 1]);
+        if (e >= 0) out.push_back(edges_[e]);
+    }
+    return out;
+}
+
+// ``NavMesh.corridor_to_portals``: orient each shared edge with the
+// near-triangle centroid, then narrow it by the consumed bands (#4274).
+std::vector<NavMesh::Portal> NavMesh::corridor_to_portals(const std::vector<int>& corridor,
+                                                          const Pt& start, const Pt& goal,
+                                                          const ConsumedBands& consumed,
+                                                          Pack pack) const {
+    std::vector<Portal> portals;
+    portals.reserve(corridor.size() + 1);
+    portals.emplace_back(start, start);
+    for (size_t i = 0; i + 1 < corridor.size(); ++i) {
+        const int cur = corridor[i];
+        const int e = shared_edge_id(cur, corridor[i + 1]);
+        if (e < 0) continue;
+        const Pt& p = vertices_[edges_[e].first];
+        const Pt& q = vertices_[edges_[e].second];
+        const bool reversed = !(mononen_area(centroids_[cur], p, q) > 0.0);
+        const Pt& left = reversed ? q : p;
+        const Pt& right = reversed ? p : q;
+        if (!consumed.empty()) {
+            auto it = consumed.find(edges_[e]);
+            if (it != consumed.end() && !it->second.empty()) {
+                portals.push_back(narrow_portal(left, right, reversed, it->second, pack));
+                continue;
+            }
+        }
+        portals.emplace_back(left, right);
+    }
+    portals.emplace_back(goal, goal);
+    return portals;
+}
+
+// ``funnel.string_pull`` (Mononen's Simple Stupid Funnel, transcribed with
+// his sign convention).
+std::vector<Pt> NavMesh::string_pull(const std::vector<Portal>& portals) {
+    std::vector<Pt> path;
+    if (portals.empty()) return path;
+
+    Pt apex = portals[0].first;
+    Pt portal_left = portals[0].first;
+    Pt portal_right = portals[0].second;
+    size_t apex_index = 0, left_index = 0, right_index = 0;
+    path.push_back(apex);
+
+    size_t i = 1;
+    while (i < portals.size()) {
+        const Pt& left = portals[i].first;
+        const Pt& right = portals[i].second;
+
+        if (mononen_area(apex, portal_right, right) <= 0.0) {
+            if (point_equal(apex, portal_right) || mononen_area(apex, portal_left, right) > 0.0) {
+                portal_right = right;
+                right_index = i;
+            } else {
+                // Right crossed over left: left becomes the new apex.
+                if (!point_equal(path.back(), portal_left)) path.push_back(portal_left);
+                apex = portal_left;
+                apex_index = left_index;
+                portal_left = portal_right = apex;
+                left_index = right_index = apex_index;
+                i = apex_index + 1;
+                continue;
+            }
+        }
+
+        if (mononen_area(apex, portal_left, left) >= 0.0) {
+            if (point_equal(apex, portal_left) || mononen_area(apex, portal_right, left) < 0.0) {
+                portal_left = left;
+                left_index = i;
+            } else {
+                // Left crossed over right: right becomes the new apex.
+                if (!point_equal(path.back(), portal_right)) path.push_back(portal_right);
+                apex = portal_right;
+                apex_index = right_index;
+                portal_left = portal_right = apex;
+                left_index = right_index = apex_index;
+                i = apex_index + 1;
+                continue;
+            }
+        }
+        ++i;
+    }
+
+    const Pt& goal = portals.back().first;
+    if (!point_equal(path.back(), goal)) path.push_back(goal);
+    return path;
+}
+
+std::optional<NavMesh::PathResult> NavMesh::find_path(const Pt& start, const Pt& goal,
+                                                      double present_cost_factor,
+                                                      double cost_congestion,
+                                                      double congestion_threshold,
+                                                      const ConsumedBands& consumed,
+                                                      Pack pack) const {
+    std::optional<std::vector<int>> corridor =
+        astar(start, goal, present_cost_factor, cost_congestion, congestion_threshold);
+    if (!corridor) return std::nullopt;
+    PathResult out;
+    out.path = string_pull(corridor_to_portals(*corridor, start, goal, consumed, pack));
+    out.portals = corridor_portals(*corridor);
+    out.corridor = std::move(*corridor);
+    return out;
+}
+
+}  // namespace router
@@ -6,6 +6,8 @@
 #include "pathfinder.hpp"
 #include <queue>
 #include <unordered_set>
+#include <unordered_map>
+#include <limits>
 #include <cmath>
 #include <algorithm>
 #include <chrono>
@@ -136,6 +138,15 @@ void Pathfinder::set_routable_layers(const std::vector<int>& layers) {
     routable_layers_ = layers;
 }
 
+void Pathfinder::set_search_corridor(const std::vector<uint8_t>& bits) {
+    const size_t cells = static_cast<size_t>(grid_.cols()) * grid_.rows();
+    if (bits.size() == cells) {
+        search_corridor_ = bits;
+    } else {
+        search_corridor_.clear();
+    }
+}
+
 // Issue #3309: Size the flat A* arrays for the current grid and bump
 // the generation counter so every prior cell's stamp is invalidated
 // in O(1).  Called at the top of every fresh search (one-shot route()
@@ -1039,6 +1050,7 @@ RouteResult Pathfinder::route(
                 }
                 continue;
             }
+            if (!in_search_corridor(nx, ny)) continue;
 
             if (dx != 0 && dy != 0) {
                 if (is_diagonal_blocked(current.x, current.y, dx, dy, nlayer, net,
@@ -1610,6 +1622,7 @@ RouteResult Pathfinder::run_astar_loop() {
                 }
                 continue;
             }
+            if (!in_search_corridor(nx, ny)) continue;
 
             if (dx != 0 && dy != 0) {
                 if (is_diagonal_blocked(current.x, current.y, dx, dy, nlayer,
@@ -2042,4 +2055,292 @@ RouteResult Pathfinder::reconstruct_path(
     return result;
 }
 
+// ---------------------------------------------------------------------------
+// Multi-resolution A* (refinement regions)
+// ---------------------------------------------------------------------------
+
+RouteResult Pathfinder::route_multires(
+    float start_x, float start_y, int start_layer,
+    float end_x, float end_y, int end_layer,
+    int net,
+    const std::vector<int>& start_layers,
+    const std::vector<int>& end_layers,
+    int max_search_iterations) {
+    RouteResult result;
+    result.net = net;
+    last_iterations_ = 0;
+    last_nodes_explored_ = 0;
+
+    const int cols = grid_.cols(), rows = grid_.rows(), layers = grid_.layers();
+    const float coarse_res = grid_.resolution();
+    const int64_t coarse_nodes = static_cast<int64_t>(cols) * rows * layers;
+    const int regions = grid_.num_refinements();
+    std::vector<int64_t> base(regions + 1, coarse_nodes);
+    for (int r = 0; r < regions; ++r) {
+        const RefinementRegion& reg = grid_.refinement(r);
+        base[r + 1] = base[r] + static_cast<int64_t>(reg.cols) * reg.rows * layers;
+    }
+
+    // A node is a coarse cell (region -1) or a fine cell of a region.
+    struct Ref { int region, x, y, layer; };
+    auto encode = [&](const Ref& n) -> int64_t {
+        if (n.region < 0) {
+            return (static_cast<int64_t>(n.layer) * rows + n.y) * cols + n.x;
+        }
+        const RefinementRegion& reg = grid_.refinement(n.region);
+        return base[n.region] +
+               (static_cast<int64_t>(n.layer) * reg.rows + n.y) * reg.cols + n.x;
+    };
+    auto decode = [&](int64_t id) -> Ref {
+        if (id < coarse_nodes) {
+            const int64_t plane = static_cast<int64_t>(cols) * rows;
+            const int layer = static_cast<int>(id / plane);
+            const int64_t rem = id % plane;
+            return {-1, static_cast<int>(rem % cols), static_cast<int>(rem / cols), layer};
+        }
+        const auto it = std::upper_bound(base.begin(), base.end(), id);
+        const int r = static_cast<int>(it - base.begin()) - 1;
+        const RefinementRegion& reg = grid_.refinement(r);
+        const int64_t local = id - base[r];
+        const int64_t plane = static_cast<int64_t>(reg.cols) * reg.rows;
+        const int64_t rem = local % plane;
+        return {r, static_cast<int>(rem % reg.cols), static_cast<int>(rem / reg.cols),
+                static_cast<int>(local / plane)};
+    };
+    auto world = [&](const Ref& n) -> std::pair<float, float> {
+        return n.region < 0 ? grid_.grid_to_world(n.x, n.y)
+                            : grid_.fine_to_world(n.region, n.x, n.y);
+    };
+    auto locate = [&](float x, float y, int layer) -> Ref {
+        const auto [gx, gy] = grid_.world_to_grid(x, y);
+        const int r = grid_.refinement_at(gx, gy);
+        if (r < 0) return {-1, gx, gy, layer};
+        const auto [fx, fy] = grid_.world_to_fine(r, x, y);
+        return {r, fx, fy, layer};
+    };
+
+    auto fine_free = [&](int r, int fx, int fy, int layer) {
+        const GridCell& cell = grid_.fine_at(r, fx, fy, layer);
+        return !cell.blocked || cell.net == net;
+    };
+    auto passable = [&](const Ref& n) {
+        if (n.region >= 0) return fine_free(n.region, n.x, n.y, n.layer);
+        return in_search_corridor(n.x, n.y) && !is_trace_blocked(n.x, n.y, n.layer, net, false);
+    };
+    // Fine cells carry the trace clearance halo already; a via needs the
+    // extra (via radius - trace half-width) free on every routable layer.
+    auto fine_via_ok = [&](int r, int fx, int fy) {
+        const RefinementRegion& reg = grid_.refinement(r);
+        const float extra = std::max(0.0f, (rules_.via_diameter - rules_.trace_width) / 2);
+        const int radius = static_cast<int>(std::ceil(extra / reg.resolution));
+        for (int layer : routable_layers_) {
+            for (int dy = -radius; dy <= radius; ++dy) {
+                for (int dx = -radius; dx <= radius; ++dx) {
+                    if (dx * dx + dy * dy > radius * radius) continue;
+                    const int cx = fx + dx, cy = fy + dy;
+                    if (cx < 0 || cx >= reg.cols || cy < 0 || cy >= reg.rows) continue;
+                    if (!fine_free(r, cx, cy, layer)) return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    const std::vector<int> starts_l =
+        start_layers.empty() ? std::vector<int>{start_layer} : start_layers;
+    const std::vector<int> ends_l =
+        end_layers.empty() ? std::vector<int>{end_layer} : end_layers;
+    std::unordered_set<int64_t> goals;
+    for (int layer : ends_l) {
+        if (layer >= 0 && layer < layers) goals.insert(encode(locate(end_x, end_y, layer)));
+    }
+    if (goals.empty()) {
+        result.failure_reason = FAILURE_NO_PATH;
+        return result;
+    }
+
+    auto heuristic = [&](const Ref& n) {
+        const auto [wx, wy] = world(n);
+        return std::hypot(wx - end_x, wy - end_y) / coarse_res * rules_.cost_straight;
+    };
+
+    struct State {
+        float g = std::numeric_limits<float>::infinity();
+        int64_t parent = -1;
+        bool via = false;
+        bool closed = false;
+    };
+    std::unordered_map<int64_t, State> state;
+    state.reserve(1 << 16);
+    struct Open {
+        float f, g;
+        uint64_t seq;
+        int64_t id;
+        // Same ordering as AStarNode: f, then higher g, then FIFO.
+        bool operator>(const Open& o) const {
+            if (f != o.f) return f > o.f;
+            if (g != o.g) return g < o.g;
+            return seq > o.seq;
+        }
+    };
+    std::priority_queue<Open, std::vector<Open>, std::greater<Open>> open;
+    uint64_t seq = 0;
+
+    for (int layer : starts_l) {
+        if (layer < 0 || layer >= layers) continue;
+        const Ref n = locate(start_x, start_y, layer);
+        const int64_t id = encode(n);
+        State& st = state[id];
+        if (st.g == 0.0f) continue;
+        st.g = 0.0f;
+        open.push({heuristic(n), 0.0f, seq++, id});
+    }
+
+    const int64_t total_nodes = base.back();
+    const int64_t cap = max_search_iterations > 0
+                            ? max_search_iterations
+                            : std::min<int64_t>(total_nodes * 4, std::numeric_limits<int>::max());
+    const float cost_per_mm = rules_.cost_straight / coarse_res;
+
+    int64_t goal_id = -1;
+    int64_t iterations = 0;
+    while (!open.empty()) {
+        const Open top = open.top();
+        open.pop();
+        State& cur = state[top.id];
+        if (cur.closed || top.g > cur.g) continue;
+        cur.closed = true;
+        if (goals.count(top.id)) {
+            goal_id = top.id;
+            break;
+        }
+        if (++iterations > cap) {
+            result.failure_reason = FAILURE_ITERATION_LIMIT;
+            break;
+        }
+        const float g = cur.g;
+        const Ref n = decode(top.id);
+        const auto [nx, ny] = world(n);
+
+        auto relax = [&](const Ref& v, float step, bool via) {
+            const int64_t vid = encode(v);
+            State& st = state[vid];
+            if (st.closed) return;
+            if (!goals.count(vid) && !passable(v)) return;
+            const float ng = g + step;
+            if (ng >= st.g) return;
+            st.g = ng;
+            st.parent = top.id;
+            st.via = via;
+            open.push({ng + heuristic(v), ng, seq++, vid});
+        };
+        auto link_cost = [&](const Ref& v) {
+            const auto [vx, vy] = world(v);
+            return std::hypot(vx - nx, vy - ny) * cost_per_mm;
+        };
+
+        if (n.region < 0) {
+            for (const Neighbor& nb : neighbors_2d_) {
+                const int x2 = n.x + nb.dx, y2 = n.y + nb.dy;
+                if (!grid_.is_valid(x2, y2, n.layer) || grid_.refinement_at(x2, y2) >= 0) continue;
+                if (is_diagonal_blocked(n.x, n.y, nb.dx, nb.dy, n.layer, net, false)) continue;
+                relax({-1, x2, y2, n.layer}, rules_.cost_straight * nb.cost_mult, false);
+            }
+            for (const auto& [r, fine] : grid_.refinement_links(n.x, n.y)) {
+                const int fcols = grid_.refinement(r).cols;
+                const Ref v{r, fine % fcols, fine / fcols, n.layer};
+                relax(v, link_cost(v), false);
+            }
+            if (routable_layers_.size() > 1 && !is_via_blocked(n.x, n.y, net, false)) {
+                for (int layer : routable_layers_) {
+                    if (layer != n.layer) relax({-1, n.x, n.y, layer}, rules_.cost_via, true);
+                }
+            }
+        } else {
+            const RefinementRegion& reg = grid_.refinement(n.region);
+            const float fine_step = rules_.cost_straight / reg.factor;
+            for (const Neighbor& nb : neighbors_2d_) {
+                const int x2 = n.x + nb.dx, y2 = n.y + nb.dy;
+                if (x2 < 0 || x2 >= reg.cols || y2 < 0 || y2 >= reg.rows) continue;
+                if (nb.dx != 0 && nb.dy != 0 &&
+                    (!fine_free(n.region, n.x + nb.dx, n.y, n.layer) ||
+                     !fine_free(n.region, n.x, n.y + nb.dy, n.layer))) {
+                    continue;
+                }
+                relax({n.region, x2, y2, n.layer}, fine_step * nb.cost_mult, false);
+            }
+            for (int coarse : grid_.refinement_links_fine(n.region, n.x, n.y)) {
+                const Ref v{-1, coarse % cols, coarse / cols, n.layer};
+                relax(v, link_cost(v), false);
+            }
+            if (routable_layers_.size() > 1 && fine_via_ok(n.region, n.x, n.y)) {
+                for (int layer : routable_layers_) {
+                    if (layer != n.layer) {
+                        relax({n.region, n.x, n.y, layer}, rules_.cost_via, true);
+                    }
+                }
+            }
+        }
+    }
+    constexpr int64_t kIntMax = std::numeric_limits<int>::max();
+    last_iterations_ = static_cast<int>(std::min(iterations, kIntMax));
+    last_nodes_explored_ =
+        static_cast<int>(std::min(static_cast<int64_t>(state.size()), kIntMax));
+
+    if (goal_id < 0) {
+        if (result.failure_reason == FAILURE_NONE) result.failure_reason = FAILURE_NO_PATH;
+        return result;
+    }
+
+    // Node chain -> polylines per layer run (collinear points merged) and
+    // vias at the layer changes, from the exact start to the exact end.
+    std::vector<Ref> chain;
+    for (int64_t id = goal_id; id >= 0; id = state[id].parent) chain.push_back(decode(id));
+    std::reverse(chain.begin(), chain.end());
+
+    std::vector<std::pair<float, float>> run{{start_x, start_y}};
+    int run_layer = chain.front().layer;
+    auto push_point = [&](float x, float y) {
+        if (std::abs(run.back().first - x) > 1e-6f || std::abs(run.back().second - y) > 1e-6f) {
+            run.emplace_back(x, y);
+        }
+    };
+    auto flush = [&]() {
+        std::vector<std::pair<float, float>> pts;
+        for (const auto& p : run) {
+            while (pts.size() >= 2) {
+                const auto& a = pts[pts.size() - 2];
+                const auto& b = pts.back();
+                const float cross = (b.first - a.first) * (p.second - a.second) -
+                                    (b.second - a.second) * (p.first - a.first);
+                const float dot = (b.first - a.first) * (p.first - b.first) +
+                                  (b.second - a.second) * (p.second - b.second);
+                if (std::abs(cross) > 1e-9f || dot < 0.0f) break;
+                pts.pop_back();
+            }
+            pts.push_back(p);
+        }
+        for (size_t k = 1; k < pts.size(); ++k) {
+            result.segments.push_back({pts[k - 1].first, pts[k - 1].second, pts[k].first,
+                                       pts[k].second, rules_.trace_width, run_layer, net});
+        }
+    };
+    for (const Ref& n : chain) {
+        const auto [wx, wy] = world(n);
+        if (n.layer != run_layer) {
+            flush();
+            result.vias.push_back({wx, wy, rules_.via_drill, rules_.via_diameter, run_layer,
+                                   n.layer, net});
+            run.assign(1, {wx, wy});
+            run_layer = n.layer;
+            continue;
+        }
+        push_point(wx, wy);
+    }
+    push_point(end_x, end_y);
+    flush();
+    result.success = true;
+    return result;
+}
+
 }  // namespace router
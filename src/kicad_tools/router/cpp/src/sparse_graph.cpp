@@ -0,0 +1,588 @@
+/*
+ * Router C++ Core - sparse clearance-contour routing graph
+ *
+ * See sparse_graph.hpp for the model and where it departs from
+ * ``router/sparse.py``.
+ */
+
+#include "sparse_graph.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+
+namespace router {
+
+namespace {
+
+// Obstacle boxes are shrunk by this much for line of sight, so segments
+// running along a clearance boundary (or through its corner) stay visible.
+constexpr double kBoundaryEps = 1e-7;
+
+// Positions closer than this are the same via site (``_find_via_waypoint``
+// and ``_find_pad_waypoints`` use 0.01 mm).
+constexpr double kSiteTolerance = 0.01;
+
+// Liang-Barsky: does segment (x1, y1)-(x2, y2) meet the closed box?
+bool segment_meets_box(double x1, double y1, double x2, double y2, double min_x, double min_y,
+                       double max_x, double max_y) {
+    const double dx = x2 - x1;
+    const double dy = y2 - y1;
+    const double p[4] = {-dx, dx, -dy, dy};
+    const double q[4] = {x1 - min_x, max_x - x1, y1 - min_y, max_y - y1};
+    double t0 = 0.0, t1 = 1.0;
+    for (int k = 0; k < 4; ++k) {
+        if (p[k] == 0.0) {
+            if (q[k] < 0.0) return false;
+            continue;
+        }
+        const double r = q[k] / p[k];
+        if (p[k] < 0.0) {
+            if (r > t1) return false;
+            t0 = std::max(t0, r);
+        } else {
+            if (r < t0) return false;
+            t1 = std::min(t1, r);
+        }
+    }
+    return t0 <= t1;
+}
+
+double point_segment_distance(double px, double py, double x1, double y1, double x2,
+                              double y2) {
+    const double dx = x2 - x1;
+    const double dy = y2 - y1;
+    const double len2 = dx * dx + dy * dy;
+    double t = len2 > 0.0 ? ((px - x1) * dx + (py - y1) * dy) / len2 : 0.0;
+    t = std::clamp(t, 0.0, 1.0);
+    return std::hypot(px - (x1 + t * dx), py - (y1 + t * dy));
+}
+
+double cross(double ax, double ay, double bx, double by, double cx, double cy) {
+    return (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+}
+
+double segment_distance(double ax, double ay, double bx, double by, double cx, double cy,
+                        double dx, double dy) {
+    const double d1 = cross(cx, cy, dx, dy, ax, ay);
+    const double d2 = cross(cx, cy, dx, dy, bx, by);
+    const double d3 = cross(ax, ay, bx, by, cx, cy);
+    const double d4 = cross(ax, ay, bx, by, dx, dy);
+    if (((d1 > 0 && d2 < 0) || (d1 < 0 && d2 > 0)) && ((d3 > 0 && d4 < 0) || (d3 < 0 && d4 > 0))) {
+        return 0.0;
+    }
+    return std::min({point_segment_distance(ax, ay, cx, cy, dx, dy),
+                     point_segment_distance(bx, by, cx, cy, dx, dy),
+                     point_segment_distance(cx, cy, ax, ay, bx, by),
+                     point_segment_distance(dx, dy, ax, ay, bx, by)});
+}
+
+struct SiteKey {
+    long long x, y;
+    bool operator==(const SiteKey& o) const { return x == o.x && y == o.y; }
+};
+
+struct SiteKeyHash {
+    size_t operator()(const SiteKey& k) const {
+        return std::hash<long long>()(k.x * 73856093LL ^ k.y * 19349663LL);
+    }
+};
+
+SiteKey site_of(double x, double y) {
+    return {std::llround(x / kSiteTolerance), std::llround(y / kSiteTolerance)};
+}
+
+}  // namespace
+
+SparseGraph::SparseGraph(double width, double height, double origin_x, double origin_y,
+                         int num_layers, double clearance_buffer, int contour_samples)
+    : width_(width),
+      height_(height),
+      origin_x_(origin_x),
+      origin_y_(origin_y),
+      layers_(std::max(1, num_layers)),
+      buffer_(clearance_buffer),
+      contour_samples_(std::max(4, contour_samples)) {}
+
+void SparseGraph::invalidate() {
+    if (built_) {
+        waypoints_.resize(base_count_);
+        owner_.resize(base_count_);
+        offsets_.clear();
+        adj_.clear();
+        cost_.clear();
+        is_via_.clear();
+        built_ = false;
+    }
+}
+
+std::vector<int> SparseGraph::add_pad(double x, double y, double half_w, double half_h, int net,
+                                      const std::vector<int>& layers) {
+    invalidate();
+    std::vector<int> ids;
+    for (int layer : layers) {
+        if (layer < 0 || layer >= layers_) continue;
+        const Obstacle o{x, y, half_w + buffer_, half_h + buffer_, layer, net};
+        obstacles_.push_back(o);
+        ids.push_back(static_cast<int>(waypoints_.size()));
+        waypoints_.push_back({x, y, layer, SPARSE_PAD, net});
+        owner_.push_back(static_cast<int>(obstacles_.size()) - 1);
+        add_contour(o);
+    }
+    base_count_ = waypoints_.size();
+    index_dirty_ = true;
+    return ids;
+}
+
+void SparseGraph::add_obstacle(double x, double y, double half_w, double half_h, int net,
+                               const std::vector<int>& layers) {
+    invalidate();
+    for (int layer : layers) {
+        if (layer < 0 || layer >= layers_) continue;
+        const Obstacle o{x, y, half_w + buffer_, half_h + buffer_, layer, net};
+        obstacles_.push_back(o);
+        add_contour(o);
+    }
+    base_count_ = waypoints_.size();
+    index_dirty_ = true;
+}
+
+void SparseGraph::add_contour(const Obstacle& o) {
+    // Corners first, then ``per_side`` evenly spaced points on each side.
+    const int per_side = (contour_samples_ - 4) / 4;
+    std::vector<std::pair<double, double>> pts = {
+        {o.cx + o.ew, o.cy + o.eh},
+        {o.cx - o.ew, o.cy + o.eh},
+        {o.cx - o.ew, o.cy - o.eh},
+        {o.cx + o.ew, o.cy - o.eh},
+    };
+    for (int k = 1; k <= per_side; ++k) {
+        const double f = -1.0 + 2.0 * k / (per_side + 1);
+        pts.emplace_back(o.cx + o.ew, o.cy + f * o.eh);
+        pts.emplace_back(o.cx + f * o.ew, o.cy + o.eh);
+        pts.emplace_back(o.cx - o.ew, o.cy + f * o.eh);
+        pts.emplace_back(o.cx + f * o.ew, o.cy - o.eh);
+    }
+    for (const auto& [wx, wy] : pts) {
+        if (wx < origin_x_ || wx > origin_x_ + width_ || wy < origin_y_ ||
+            wy > origin_y_ + height_) {
+            continue;  // ``_in_bounds``
+        }
+        waypoints_.push_back({wx, wy, o.layer, SPARSE_CONTOUR, 0});
+        owner_.push_back(-1);
+    }
+}
+
+int SparseGraph::add_sparse_grid(double spacing) {
+    if (spacing <= 0.0) return 0;
+    invalidate();
+    index_obstacles();
+    const int cols = static_cast<int>(width_ / spacing) + 1;
+    const int rows = static_cast<int>(height_ / spacing) + 1;
+    int added = 0;
+    for (int layer = 0; layer < layers_; ++layer) {
+        for (int r = 0; r < rows; ++r) {
+            for (int c = 0; c < cols; ++c) {
+                const double x = origin_x_ + c * spacing;
+                const double y = origin_y_ + r * spacing;
+                if (point_blocked(x, y, layer)) continue;
+                waypoints_.push_back({x, y, layer, SPARSE_LATTICE, 0});
+                owner_.push_back(-1);
+                ++added;
+            }
+        }
+    }
+    base_count_ = waypoints_.size();
+    return added;
+}
+
+void SparseGraph::index_obstacles() {
+    if (!index_dirty_) return;
+    double min_x = origin_x_, min_y = origin_y_;
+    double max_x = origin_x_ + width_, max_y = origin_y_ + height_;
+    for (const Obstacle& o : obstacles_) {
+        min_x = std::min(min_x, o.cx - o.ew);
+        min_y = std::min(min_y, o.cy - o.eh);
+        max_x = std::max(max_x, o.cx + o.ew);
+        max_y = std::max(max_y, o.cy + o.eh);
+    }
+    for (const SparseWaypoint& w : waypoints_) {
+        min_x = std::min(min_x, w.x);
+        min_y = std::min(min_y, w.y);
+        max_x = std::max(max_x, w.x);
+        max_y = std::max(max_y, w.y);
+    }
+    // About one obstacle per bucket per layer, within sane bounds.
+    const double area = std::max(1e-6, (max_x - min_x) * (max_y - min_y));
+    const double per_layer = std::max<double>(1.0, double(obstacles_.size()) / layers_);
+    bucket_ = std::clamp(std::sqrt(area / per_layer), 0.25, 10.0);
+    bucket_ = std::max(bucket_, std::sqrt(area / 4.0e6));
+    bx0_ = min_x;
+    by0_ = min_y;
+    bcols_ = std::max(1, static_cast<int>(std::ceil((max_x - min_x) / bucket_)) + 1);
+    brows_ = std::max(1, static_cast<int>(std::ceil((max_y - min_y) / bucket_)) + 1);
+    buckets_.assign(layers_, std::vector<std::vector<int>>(static_cast<size_t>(bcols_) * brows_));
+    for (size_t id = 0; id < obstacles_.size(); ++id) {
+        const Obstacle& o = obstacles_[id];
+        const int c0 = std::clamp(static_cast<int>((o.cx - o.ew - bx0_) / bucket_), 0, bcols_ - 1);
+        const int c1 = std::clamp(static_cast<int>((o.cx + o.ew - bx0_) / bucket_), 0, bcols_ - 1);
+        const int r0 = std::clamp(static_cast<int>((o.cy - o.eh - by0_) / bucket_), 0, brows_ - 1);
+        const int r1 = std::clamp(static_cast<int>((o.cy + o.eh - by0_) / bucket_), 0, brows_ - 1);
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                buckets_[o.layer][static_cast<size_t>(r) * bcols_ + c].push_back(
+                    static_cast<int>(id));
+            }
+        }
+    }
+    index_dirty_ = false;
+}
+
+bool SparseGraph::point_blocked(double x, double y, int layer) const {
+    auto inside = [&](const Obstacle& o) {
+        return o.layer == layer && std::abs(x - o.cx) < o.ew && std::abs(y - o.cy) < o.eh;
+    };
+    if (index_dirty_) {
+        return std::any_of(obstacles_.begin(), obstacles_.end(), inside);
+    }
+    if (layer < 0 || layer >= layers_) return false;
+    const int c = static_cast<int>(std::floor((x - bx0_) / bucket_));
+    const int r = static_cast<int>(std::floor((y - by0_) / bucket_));
+    if (c < 0 || c >= bcols_ || r < 0 || r >= brows_) return false;
+    for (int id : buckets_[layer][static_cast<size_t>(r) * bcols_ + c]) {
+        if (inside(obstacles_[id])) return true;
+    }
+    return false;
+}
+
+bool SparseGraph::line_of_sight(double x1, double y1, double x2, double y2, int layer,
+                                int skip_a, int skip_b) const {
+    auto hits = [&](int id) {
+        if (id == skip_a || id == skip_b) return false;
+        const Obstacle& o = obstacles_[id];
+        if (o.layer != layer) return false;
+        const double ew = o.ew - kBoundaryEps;
+        const double eh = o.eh - kBoundaryEps;
+        if (ew <= 0.0 || eh <= 0.0) return false;
+        return segment_meets_box(x1, y1, x2, y2, o.cx - ew, o.cy - eh, o.cx + ew, o.cy + eh);
+    };
+    if (index_dirty_) {
+        for (size_t id = 0; id < obstacles_.size(); ++id) {
+            if (hits(static_cast<int>(id))) return false;
+        }
+        return true;
+    }
+    if (layer < 0 || layer >= layers_) return true;
+
+    // Amanatides-Woo walk over the buckets the segment passes through.  An
+    // obstacle is filed in every bucket its box overlaps, so any obstacle
+    // the segment crosses shares a visited bucket.
+    const auto& grid = buckets_[layer];
+    const double gx1 = (x1 - bx0_) / bucket_, gy1 = (y1 - by0_) / bucket_;
+    const double gx2 = (x2 - bx0_) / bucket_, gy2 = (y2 - by0_) / bucket_;
+    int c = std::clamp(static_cast<int>(std::floor(gx1)), 0, bcols_ - 1);
+    int r = std::clamp(static_cast<int>(std::floor(gy1)), 0, brows_ - 1);
+    const int ce = std::clamp(static_cast<int>(std::floor(gx2)), 0, bcols_ - 1);
+    const int re = std::clamp(static_cast<int>(std::floor(gy2)), 0, brows_ - 1);
+    const double dx = gx2 - gx1, dy = gy2 - gy1;
+    const int step_c = dx > 0 ? 1 : -1;
+    const int step_r = dy > 0 ? 1 : -1;
+    const double inf = std::numeric_limits<double>::infinity();
+    double t_max_c = dx != 0.0 ? ((c + (dx > 0 ? 1 : 0)) - gx1) / dx : inf;
+    double t_max_r = dy != 0.0 ? ((r + (dy > 0 ? 1 : 0)) - gy1) / dy : inf;
+    const double t_delta_c = dx != 0.0 ? std::abs(1.0 / dx) : inf;
+    const double t_delta_r = dy != 0.0 ? std::abs(1.0 / dy) : inf;
+    const int max_steps = std::abs(ce - c) + std::abs(re - r) + 2;
+    for (int step = 0; step <= max_steps; ++step) {
+        for (int id : grid[static_cast<size_t>(r) * bcols_ + c]) {
+            if (hits(id)) return false;
+        }
+        if (c == ce && r == re) break;
+        if (t_max_c < t_max_r) {
+            t_max_c += t_delta_c;
+            c = std::clamp(c + step_c, 0, bcols_ - 1);
+        } else {
+            t_max_r += t_delta_r;
+            r = std::clamp(r + step_r, 0, brows_ - 1);
+        }
+    }
+    return true;
+}
+
+void SparseGraph::build(double max_edge_length, int num_threads) {
+    invalidate();
+    index_obstacles();
+    const size_t base = waypoints_.size();
+
+    // Contour / lattice points that ended up inside another obstacle can
+    // never see anything; leave them out.  Pad centers sit inside their own
+    // pad and stay.
+    std::vector<uint8_t> dead(base, 0);
+    for (size_t i = 0; i < base; ++i) {
+        const SparseWaypoint& w = waypoints_[i];
+        dead[i] = w.type != SPARSE_PAD && point_blocked(w.x, w.y, w.layer);
+    }
+
+    // Via twins: every live waypoint gets a counterpart on each other layer
+    // where its position is free (``_find_via_waypoint``).
+    std::unordered_map<SiteKey, std::vector<int>, SiteKeyHash> sites;
+    for (size_t i = 0; i < base; ++i) {
+        if (!dead[i]) sites[site_of(waypoints_[i].x, waypoints_[i].y)].push_back(int(i));
+    }
+    for (size_t i = 0; i < base; ++i) {
+        if (dead[i]) continue;
+        const SparseWaypoint w = waypoints_[i];
+        std::vector<int>& site = sites[site_of(w.x, w.y)];
+        for (int layer = 0; layer < layers_; ++layer) {
+            if (layer == w.layer) continue;
+            const bool present = std::any_of(site.begin(), site.end(), [&](int k) {
+                return waypoints_[k].layer == layer;
+            });
+            if (present || point_blocked(w.x, w.y, layer)) continue;
+            site.push_back(static_cast<int>(waypoints_.size()));
+            waypoints_.push_back({w.x, w.y, layer, SPARSE_VIA, 0});
+            owner_.push_back(-1);
+        }
+    }
+    const size_t n = waypoints_.size();
+    dead.resize(n, 0);
+
+    // Candidate pairs through a per-layer hash of ``max_edge_length`` cells.
+    const double reach = std::max(max_edge_length, 1e-6);
+    const double cell_x0 = bx0_, cell_y0 = by0_;
+    const int hcols = std::max(1, static_cast<int>((bcols_ * bucket_) / reach) + 1);
+    const int hrows = std::max(1, static_cast<int>((brows_ * bucket_) / reach) + 1);
+    auto hcell = [&](double x, double y) {
+        const int c = std::clamp(static_cast<int>((x - cell_x0) / reach), 0, hcols - 1);
+        const int r = std::clamp(static_cast<int>((y - cell_y0) / reach), 0, hrows - 1);
+        return std::make_pair(c, r);
+    };
+    std::vector<std::vector<std::vector<int>>> hash(
+        layers_, std::vector<std::vector<int>>(static_cast<size_t>(hcols) * hrows));
+    for (size_t i = 0; i < n; ++i) {
+        if (dead[i]) continue;
+        const auto [c, r] = hcell(waypoints_[i].x, waypoints_[i].y);
+        hash[waypoints_[i].layer][static_cast<size_t>(r) * hcols + c].push_back(int(i));
+    }
+
+    std::vector<std::vector<std::pair<int, double>>> found(n);
+    auto visit = [&](size_t i) {
+        if (dead[i]) return;
+        const SparseWaypoint& a = waypoints_[i];
+        const auto [c, r] = hcell(a.x, a.y);
+        for (int rr = std::max(0, r - 1); rr <= std::min(hrows - 1, r + 1); ++rr) {
+            for (int cc = std::max(0, c - 1); cc <= std::min(hcols - 1, c + 1); ++cc) {
+                for (int j : hash[a.layer][static_cast<size_t>(rr) * hcols + cc]) {
+                    if (j <= static_cast<int>(i)) continue;
+                    const SparseWaypoint& b = waypoints_[j];
+                    const double d = std::hypot(b.x - a.x, b.y - a.y);
+                    if (d > max_edge_length) continue;
+                    if (line_of_sight(a.x, a.y, b.x, b.y, a.layer, owner_[i], owner_[j])) {
+                        found[i].emplace_back(j, d);
+                    }
+                }
+            }
+        }
+    };
+
+    size_t threads = num_threads > 0 ? static_cast<size_t>(num_threads)
+                                     : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, n / 64 + 1));
+    std::atomic<size_t> next{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    auto work = [&]() {
+        try {
+            for (size_t i = next.fetch_add(1); i < n; i = next.fetch_add(1)) visit(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failure_mutex);
+            if (!failure) failure = std::current_exception();
+            next.store(n);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(work);
+    work();
+    for (std::thread& th : pool) th.join();
+    if (failure) std::rethrow_exception(failure);
+
+    // Via edges between the live waypoints of each site.
+    std::vector<std::vector<int>> via(n);
+    for (auto& [key, members] : sites) {
+        for (size_t p = 0; p < members.size(); ++p) {
+            for (size_t q = 0; q < members.size(); ++q) {
+                if (p != q && waypoints_[members[p]].layer != waypoints_[members[q]].layer) {
+                    via[members[p]].push_back(members[q]);
+                }
+            }
+        }
+    }
+    for (auto& list : via) std::sort(list.begin(), list.end());
+
+    // CSR: visibility edges in both directions, then via edges.
+    std::vector<int> degree(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+        degree[i] += static_cast<int>(found[i].size() + via[i].size());
+        for (const auto& [j, d] : found[i]) ++degree[j];
+    }
+    offsets_.assign(n + 1, 0);
+    for (size_t i = 0; i < n; ++i) offsets_[i + 1] = offsets_[i] + degree[i];
+    adj_.assign(offsets_[n], 0);
+    cost_.assign(offsets_[n], 0.0);
+    is_via_.assign(offsets_[n], 0);
+    std::vector<int> fill(offsets_.begin(), offsets_.end() - 1);
+    auto push = [&](size_t from, int to, double w, bool v) {
+        const int k = fill[from]++;
+        adj_[k] = to;
+        cost_[k] = w;
+        is_via_[k] = v ? 1 : 0;
+    };
+    for (size_t i = 0; i < n; ++i) {
+        for (const auto& [j, d] : found[i]) {
+            push(i, j, d, false);
+            push(static_cast<size_t>(j), static_cast<int>(i), d, false);
+        }
+    }
+    for (size_t i = 0; i < n; ++i) {
+        for (int j : via[i]) push(i, j, 0.0, true);
+    }
+    built_ = true;
+}
+
+std::vector<std::tuple<double, double, int, int, int>> SparseGraph::waypoints_from(
+    size_t first) const {
+    std::vector<std::tuple<double, double, int, int, int>> out;
+    for (size_t i = first; i < waypoints_.size(); ++i) {
+        const SparseWaypoint& w = waypoints_[i];
+        out.emplace_back(w.x, w.y, w.layer, w.type, w.net);
+    }
+    return out;
+}
+
+std::vector<std::tuple<int, double, bool>> SparseGraph::neighbors(int id) const {
+    std::vector<std::tuple<int, double, bool>> out;
+    if (!built_ || id < 0 || static_cast<size_t>(id) >= waypoints_.size()) return out;
+    for (int k = offsets_[id]; k < offsets_[id + 1]; ++k) {
+        out.emplace_back(adj_[k], cost_[k], is_via_[k] != 0);
+    }
+    return out;
+}
+
+std::vector<int> SparseGraph::pad_waypoints(int net, double x, double y) const {
+    std::vector<int> out;
+    for (size_t i = 0; i < base_count_; ++i) {
+        const SparseWaypoint& w = waypoints_[i];
+        if (w.type == SPARSE_PAD && w.net == net && std::abs(w.x - x) < kSiteTolerance &&
+            std::abs(w.y - y) < kSiteTolerance) {
+            out.push_back(static_cast<int>(i));
+        }
+    }
+    return out;
+}
+
+void SparseGraph::set_corridor(
+    int net, const std::vector<std::tuple<double, double, double, double, int>>& segments,
+    double half_width) {
+    corridors_[net] = Corridor{segments, half_width};
+}
+
+void SparseGraph::clear_corridor(int net) { corridors_.erase(net); }
+
+void SparseGraph::clear_all_corridors() { corridors_.clear(); }
+
+double SparseGraph::corridor_cost(const SparseWaypoint& a, const SparseWaypoint& b,
+                                  int net) const {
+    int crossings = 0;
+    for (const auto& [owner, corridor] : corridors_) {
+        if (owner == net) continue;
+        for (const auto& [x1, y1, x2, y2, layer] : corridor.segments) {
+            if (layer != a.layer) continue;
+            if (segment_distance(a.x, a.y, b.x, b.y, x1, y1, x2, y2) <= corridor.half_width) {
+                ++crossings;
+                break;
+            }
+        }
+    }
+    return crossings * std::hypot(b.x - a.x, b.y - a.y) * corridor_penalty;
+}
+
+SparsePath SparseGraph::route(int net, const std::vector<int>& starts,
+                              const std::vector<int>& goals, double via_cost,
+                              bool use_corridors) const {
+    if (!built_) throw std::logic_error("SparseGraph::route called before build()");
+    SparsePath out;
+    const int n = static_cast<int>(waypoints_.size());
+    std::vector<int> goal_ids;
+    std::vector<uint8_t> is_goal(n, 0);
+    for (int g : goals) {
+        if (g >= 0 && g < n && !is_goal[g]) {
+            is_goal[g] = 1;
+            goal_ids.push_back(g);
+        }
+    }
+    if (goal_ids.empty()) return out;
+
+    auto heuristic = [&](int i) {
+        const SparseWaypoint& w = waypoints_[i];
+        double best = std::numeric_limits<double>::infinity();
+        for (int g : goal_ids) {
+            const SparseWaypoint& t = waypoints_[g];
+            best = std::min(best, std::hypot(w.x - t.x, w.y - t.y) +
+                                      std::abs(w.layer - t.layer) * via_cost);
+        }
+        return best;
+    };
+    auto usable = [&](int i) { return waypoints_[i].net == 0 || waypoints_[i].net == net; };
+    const bool corridors = use_corridors && !corridors_.empty();
+
+    using Entry = std::pair<double, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+    std::vector<double> g(n, std::numeric_limits<double>::infinity());
+    std::vector<int> parent(n, -1);
+    std::vector<uint8_t> via_from_parent(n, 0), closed(n, 0);
+    for (int s : starts) {
+        if (s < 0 || s >= n || g[s] == 0.0) continue;
+        g[s] = 0.0;
+        open.emplace(heuristic(s), s);
+    }
+
+    while (!open.empty()) {
+        const int u = open.top().second;
+        open.pop();
+        if (closed[u]) continue;
+        closed[u] = 1;
+        ++out.expanded;
+        if (is_goal[u]) {
+            for (int v = u; v >= 0; v = parent[v]) {
+                out.waypoints.push_back(v);
+                out.via_before.push_back(via_from_parent[v]);
+            }
+            std::reverse(out.waypoints.begin(), out.waypoints.end());
+            std::reverse(out.via_before.begin(), out.via_before.end());
+            out.success = true;
+            out.cost = g[u];
+            return out;
+        }
+        for (int k = offsets_[u]; k < offsets_[u + 1]; ++k) {
+            const int v = adj_[k];
+            if (closed[v] || !usable(v)) continue;
+            double step = is_via_[k] ? via_cost : cost_[k];
+            if (corridors && !is_via_[k]) step += corridor_cost(waypoints_[u], waypoints_[v], net);
+            const double ng = g[u] + step;
+            if (ng < g[v]) {
+                g[v] = ng;
+                parent[v] = u;
+                via_from_parent[v] = is_via_[k];
+                open.emplace(ng + heuristic(v), v);
+            }
+        }
+    }
+    return out;
+}
+
+}  // namespace router
@@ -0,0 +1,423 @@
+/*
+ * Router C++ Core - rectilinear Steiner minimum trees
+ *
+ * See steiner.hpp for the model.  Relocation follows
+ * ``relocate_blocked_point`` / ``make_blocked_cell_predicate`` in
+ * ``router/algorithms/steiner.py`` cell for cell.
+ */
+
+#include "steiner.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+namespace router {
+
+namespace {
+
+using Point = std::pair<double, double>;
+
+// Gains at or below this are treated as no improvement (coordinates are mm).
+constexpr double kGainEps = 1e-9;
+
+// Degrees up to this are solved exactly by Hanan-subset enumeration.
+constexpr int kExactDegree = 5;
+
+struct TreeEdge {
+    double w;
+    int a, b;
+};
+
+inline double manhattan(const Point& p, const Point& q) {
+    return std::abs(p.first - q.first) + std::abs(p.second - q.second);
+}
+
+// Prim's MST over ``pts``; appends (parent, child) edges to ``out`` when
+// given and returns the total length.
+double prim_mst(const std::vector<Point>& pts, std::vector<TreeEdge>* out) {
+    const int n = static_cast<int>(pts.size());
+    if (n < 2) return 0.0;
+    std::vector<double> key(n, std::numeric_limits<double>::infinity());
+    std::vector<int> parent(n, -1);
+    std::vector<uint8_t> in_tree(n, 0);
+    key[0] = 0.0;
+    double total = 0.0;
+    for (int it = 0; it < n; ++it) {
+        int u = -1;
+        for (int v = 0; v < n; ++v) {
+            if (!in_tree[v] && (u < 0 || key[v] < key[u])) u = v;
+        }
+        in_tree[u] = 1;
+        if (parent[u] >= 0) {
+            total += key[u];
+            if (out) out->push_back({key[u], parent[u], u});
+        }
+        for (int v = 0; v < n; ++v) {
+            if (in_tree[v]) continue;
+            const double d = manhattan(pts[u], pts[v]);
+            if (d < key[v]) {
+                key[v] = d;
+                parent[v] = u;
+            }
+        }
+    }
+    return total;
+}
+
+void sort_by_weight(std::vector<TreeEdge>& edges) {
+    std::sort(edges.begin(), edges.end(), [](const TreeEdge& x, const TreeEdge& y) {
+        if (x.w != y.w) return x.w < y.w;
+        return x.a != y.a ? x.a < y.a : x.b < y.b;
+    });
+}
+
+class DisjointSet {
+public:
+    void reset(int n) {
+        parent_.resize(n);
+        std::iota(parent_.begin(), parent_.end(), 0);
+    }
+    int find(int x) {
+        while (parent_[x] != x) {
+            parent_[x] = parent_[parent_[x]];
+            x = parent_[x];
+        }
+        return x;
+    }
+    bool unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        parent_[b] = a;
+        return true;
+    }
+
+private:
+    std::vector<int> parent_;
+};
+
+// MST of ``pts`` + ``c`` (as index pts.size()) from ``tree`` (the MST of
+// ``pts``, ascending weight).  The new MST only needs the old tree edges
+// plus ``c``'s nearest point in each octant: for two points q, r in the same
+// octant of c with |cr| <= |cq|, |qr| <= |cq|, so edge (c, q) is the
+// heaviest on the cycle c-r-q.  Kruskal over the merged, already-sorted
+// lists is linear.  Writes the new tree (ascending weight) to ``out`` when
+// given and returns its length.
+double extend_mst(const std::vector<Point>& pts, const std::vector<TreeEdge>& tree,
+                  const Point& c, DisjointSet& dsu, std::vector<TreeEdge>* out) {
+    const int m = static_cast<int>(pts.size());
+    TreeEdge nearest[8];
+    bool have[8] = {};
+    for (int i = 0; i < m; ++i) {
+        const double dx = pts[i].first - c.first;
+        const double dy = pts[i].second - c.second;
+        const int oct = (dx >= 0.0 ? 0 : 2) + (dy >= 0.0 ? 0 : 4) +
+                        (std::abs(dx) >= std::abs(dy) ? 0 : 1);
+        const double d = std::abs(dx) + std::abs(dy);
+        if (!have[oct] || d < nearest[oct].w) {
+            nearest[oct] = {d, i, m};
+            have[oct] = true;
+        }
+    }
+    TreeEdge spokes[8];
+    int num_spokes = 0;
+    for (int o = 0; o < 8; ++o) {
+        if (have[o]) spokes[num_spokes++] = nearest[o];
+    }
+    std::sort(spokes, spokes + num_spokes, [](const TreeEdge& x, const TreeEdge& y) {
+        return x.w != y.w ? x.w < y.w : x.a < y.a;
+    });
+
+    dsu.reset(m + 1);
+    if (out) out->clear();
+    double total = 0.0;
+    int joined = 0;
+    size_t i = 0;
+    int j = 0;
+    while (joined < m && (i < tree.size() || j < num_spokes)) {
+        const bool take_tree = j >= num_spokes || (i < tree.size() && tree[i].w <= spokes[j].w);
+        const TreeEdge& e = take_tree ? tree[i++] : spokes[j++];
+        if (!dsu.unite(e.a, e.b)) continue;
+        total += e.w;
+        ++joined;
+        if (out) out->push_back(e);
+    }
+    return total;
+}
+
+// Hanan grid of the terminals: sorted distinct coordinates, cell index
+// ``xi * ys.size() + yi`` (x outer, like ``_hanan_grid``).
+struct Hanan {
+    std::vector<double> xs, ys;
+    std::vector<uint8_t> taken;  // terminal or current Steiner point
+
+    explicit Hanan(const std::vector<Point>& terminals) {
+        for (const Point& p : terminals) {
+            xs.push_back(p.first);
+            ys.push_back(p.second);
+        }
+        for (auto* v : {&xs, &ys}) {
+            std::sort(v->begin(), v->end());
+            v->erase(std::unique(v->begin(), v->end()), v->end());
+        }
+        taken.assign(xs.size() * ys.size(), 0);
+        for (const Point& p : terminals) taken[cell_of(p)] = 1;
+    }
+    size_t size() const { return taken.size(); }
+    Point point(size_t cell) const { return {xs[cell / ys.size()], ys[cell % ys.size()]}; }
+    size_t cell_of(const Point& p) const {
+        const size_t xi = std::lower_bound(xs.begin(), xs.end(), p.first) - xs.begin();
+        const size_t yi = std::lower_bound(ys.begin(), ys.end(), p.second) - ys.begin();
+        return xi * ys.size() + yi;
+    }
+};
+
+// Drop Steiner points (indices >= n) of degree <= 2 in ``pts``' MST: a
+// leaf only adds length and a pass-through corner is never shorter than
+// the direct edge.  Returns true when anything was removed.
+bool prune_steiner(std::vector<Point>& pts, int n, Hanan& hanan) {
+    if (static_cast<int>(pts.size()) <= n) return false;
+    std::vector<TreeEdge> tree;
+    prim_mst(pts, &tree);
+    std::vector<int> degree(pts.size(), 0);
+    for (const TreeEdge& e : tree) {
+        ++degree[e.a];
+        ++degree[e.b];
+    }
+    std::vector<Point> kept(pts.begin(), pts.begin() + n);
+    for (size_t k = n; k < pts.size(); ++k) {
+        if (degree[k] >= 3) {
+            kept.push_back(pts[k]);
+        } else {
+            hanan.taken[hanan.cell_of(pts[k])] = 0;
+        }
+    }
+    if (kept.size() == pts.size()) return false;
+    pts.swap(kept);
+    return true;
+}
+
+// Exact RSMT for small degrees: the cheapest MST over the terminals plus a
+// Hanan subset of size <= n - 2 (smallest subsets first, so ties keep the
+// fewest Steiner points).
+void exact_steiner(std::vector<Point>& pts, int n, Hanan& hanan) {
+    std::vector<Point> cands;
+    for (size_t cell = 0; cell < hanan.size(); ++cell) {
+        if (!hanan.taken[cell]) cands.push_back(hanan.point(cell));
+    }
+    std::vector<Point> trial(pts);
+    double best = prim_mst(trial, nullptr);
+    std::vector<int> best_pick;
+    const int num = static_cast<int>(cands.size());
+    for (int k = 1; k <= n - 2 && k <= num; ++k) {
+        std::vector<int> pick(k);
+        std::iota(pick.begin(), pick.end(), 0);
+        while (true) {
+            trial.resize(n);
+            for (int idx : pick) trial.push_back(cands[idx]);
+            const double cost = prim_mst(trial, nullptr);
+            if (cost < best - kGainEps) {
+                best = cost;
+                best_pick = pick;
+            }
+            // Next k-combination in lexicographic order.
+            int pos = k - 1;
+            while (pos >= 0 && pick[pos] == num - k + pos) --pos;
+            if (pos < 0) break;
+            ++pick[pos];
+            for (int q = pos + 1; q < k; ++q) pick[q] = pick[q - 1] + 1;
+        }
+    }
+    for (int idx : best_pick) {
+        pts.push_back(cands[idx]);
+        hanan.taken[hanan.cell_of(cands[idx])] = 1;
+    }
+}
+
+// Batched 1-Steiner with incremental MST scoring (see steiner.hpp).
+void batched_one_steiner(std::vector<Point>& pts, int n, Hanan& hanan, int max_iterations) {
+    DisjointSet dsu;
+    std::vector<TreeEdge> tree, next;
+    std::vector<std::pair<double, size_t>> scored;
+    int inserted = 0;
+    while (inserted < max_iterations) {
+        tree.clear();
+        double cost = prim_mst(pts, &tree);
+        sort_by_weight(tree);
+
+        scored.clear();
+        for (size_t cell = 0; cell < hanan.size(); ++cell) {
+            if (hanan.taken[cell]) continue;
+            const double gain = cost - extend_mst(pts, tree, hanan.point(cell), dsu, nullptr);
+            if (gain > kGainEps) scored.emplace_back(gain, cell);
+        }
+        if (scored.empty()) break;
+        std::stable_sort(scored.begin(), scored.end(),
+                         [](const auto& x, const auto& y) { return x.first > y.first; });
+
+        bool progress = false;
+        for (const auto& [gain, cell] : scored) {
+            if (inserted >= max_iterations) break;
+            const Point c = hanan.point(cell);
+            const double trial = extend_mst(pts, tree, c, dsu, &next);
+            if (cost - trial <= kGainEps) continue;  // an earlier insertion took its gain
+            pts.push_back(c);
+            hanan.taken[cell] = 1;
+            tree.swap(next);
+            cost = trial;
+            ++inserted;
+            progress = true;
+        }
+        prune_steiner(pts, n, hanan);
+        if (!progress) break;
+    }
+}
+
+// Run ``build_one(k)`` for k in [0, count) on up to ``num_threads`` workers
+// (0 = hardware concurrency); the first exception is rethrown.
+template <typename Fn>
+void for_each_request(size_t count, int num_threads, Fn&& build_one) {
+    size_t threads = num_threads > 0 ? static_cast<size_t>(num_threads)
+                                     : std::max<size_t>(1, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, count));
+    std::atomic<size_t> next{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    auto work = [&]() {
+        try {
+            for (size_t k = next.fetch_add(1); k < count; k = next.fetch_add(1)) build_one(k);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failure_mutex);
+            if (!failure) failure = std::current_exception();
+            next.store(count);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(work);
+    work();
+    for (std::thread& th : pool) th.join();
+    if (failure) std::rethrow_exception(failure);
+}
+
+}  // namespace
+
+SteinerTree build_rsmt(const std::vector<std::pair<double, double>>& terminals,
+                       int max_iterations) {
+    SteinerTree out;
+    const int n = static_cast<int>(terminals.size());
+    out.num_terminals = n;
+    out.points = terminals;
+    if (n < 2) return out;
+    if (max_iterations < 0) max_iterations = n <= 9 ? 50 : std::min(n, 30);
+
+    if (n > 2) {
+        Hanan hanan(terminals);
+        if (n <= kExactDegree) {
+            exact_steiner(out.points, n, hanan);
+        } else {
+            batched_one_steiner(out.points, n, hanan, max_iterations);
+        }
+        prune_steiner(out.points, n, hanan);
+    }
+
+    std::vector<TreeEdge> tree;
+    out.length = prim_mst(out.points, &tree);
+    std::stable_sort(tree.begin(), tree.end(),
+                     [](const TreeEdge& x, const TreeEdge& y) { return x.w < y.w; });
+    out.edges.reserve(tree.size());
+    for (const TreeEdge& e : tree) out.edges.emplace_back(e.a, e.b);
+    return out;
+}
+
+std::vector<SteinerTree> build_rsmt_all(const std::vector<SteinerNetRequest>& requests,
+                                        int num_threads, int max_iterations) {
+    const size_t count = requests.size();
+    std::vector<SteinerTree> out(count);
+    if (count == 0) return out;
+    for_each_request(count, num_threads, [&](size_t k) {
+        out[k] = build_rsmt(requests[k].terminals, max_iterations);
+        out[k].net = requests[k].net;
+    });
+    return out;
+}
+
+SteinerBuilder::SteinerBuilder(const Grid3D& grid, int margin_cells,
+                               const std::vector<int>& routable_layers, int max_radius)
+    : grid_(grid),
+      margin_(std::max(0, margin_cells)),
+      layers_(routable_layers),
+      max_radius_(std::max(0, max_radius)) {
+    if (layers_.empty()) {
+        for (int l = 0; l < grid_.layers(); ++l) layers_.push_back(l);
+    }
+}
+
+bool SteinerBuilder::point_blocked(int gx, int gy, int net) const {
+    // ``CppGrid.is_blocked_for_net``: out of bounds, net-0 obstacles and
+    // foreign-net copper block; same-net copper does not.
+    auto blocked = [&](int x, int y, int layer) {
+        if (!grid_.is_valid(x, y, layer)) return true;
+        const GridCell& cell = grid_.at(x, y, layer);
+        return cell.blocked && (cell.net == 0 || cell.net != net);
+    };
+    for (int layer : layers_) {
+        bool layer_ok = true;
+        for (int dy = -margin_; dy <= margin_ && layer_ok; ++dy) {
+            for (int dx = -margin_; dx <= margin_; ++dx) {
+                if (blocked(gx + dx, gy + dy, layer)) {
+                    layer_ok = false;
+                    break;
+                }
+            }
+        }
+        if (layer_ok) return false;
+    }
+    return true;
+}
+
+std::pair<int, int> SteinerBuilder::relocate(int gx, int gy, int net) const {
+    if (!point_blocked(gx, gy, net)) return {gx, gy};
+    for (int radius = 1; radius <= max_radius_; ++radius) {
+        for (int dy = -radius; dy <= radius; ++dy) {
+            // Interior rows only contribute the two ring columns.
+            const int step = (dy == -radius || dy == radius) ? 1 : 2 * radius;
+            for (int dx = -radius; dx <= radius; dx += step) {
+                if (!point_blocked(gx + dx, gy + dy, net)) return {gx + dx, gy + dy};
+            }
+        }
+    }
+    return {gx, gy};
+}
+
+std::vector<SteinerTree> SteinerBuilder::build_all(const std::vector<SteinerNetRequest>& requests,
+                                                   int num_threads, int max_iterations) const {
+    const size_t count = requests.size();
+    std::vector<SteinerTree> out(count);
+    if (count == 0) return out;
+
+    auto build_one = [&](size_t k) {
+        const SteinerNetRequest& req = requests[k];
+        SteinerTree tree = build_rsmt(req.terminals, max_iterations);
+        tree.net = req.net;
+        for (size_t p = tree.num_terminals; p < tree.points.size(); ++p) {
+            const auto [sx, sy] = tree.points[p];
+            const auto [gx, gy] =
+                grid_.world_to_grid(static_cast<float>(sx), static_cast<float>(sy));
+            const auto [rx, ry] = relocate(gx, gy, req.net);
+            const auto [wx, wy] = grid_.grid_to_world(rx, ry);
+            tree.points[p] = {wx, wy};
+        }
+        out[k] = std::move(tree);
+    };
+
+    for_each_request(count, num_threads, build_one);
+    return out;
+}
+
+}  // namespace router
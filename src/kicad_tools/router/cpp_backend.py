@@ -25,10 +25,13 @@ import os
 import time
 from typing import TYPE_CHECKING
 
+import numpy as np
+
 if TYPE_CHECKING:
-    import numpy as np
+    from collections.abc import Iterable
 
     from .grid import RoutingGrid
+    from .optimizer.serpentine import SerpentineConfig
     from .pathfinder import Router
     from .primitives import Pad, Route
     from .rules import DesignRules, NetClassRouting
@@ -47,7 +50,7 @@ logger = logging.getLogger(__name__)
 # ``AttributeError`` deep in the routing code (e.g. ``router_cpp.PadBounds``
 # missing).  The guard below catches that at import time and falls back to the
 # pure-Python router with an actionable ``kct build-native`` hint.
-_REQUIRED_CPP_BUILD_VERSION = 17
+_REQUIRED_CPP_BUILD_VERSION = 35
 
 # Try to import C++ module with detailed error tracking
 _CPP_IMPORT_ERROR: str | None = None
@@ -762,6 +765,34 @@ class CppGrid:
         """Mark cells around a via as blocked on all layers."""
         self._impl.mark_via(x, y, net, radius_cells)
 
+    def add_refinement(
+        self,
+        x0: int,
+        y0: int,
+        x1: int,
+        y1: int,
+        factor: int,
+        trace_half_width: float,
+        clearance: float,
+    ) -> int:
+        """Refine coarse cells ``[x0, x1] x [y0, y1]`` by ``factor``.
+
+        The fine cells are rasterized from the pads registered by
+        :meth:`from_routing_grid` and the stored routes, and are searched by
+        :meth:`CppPathfinder.route_multires`.  Regions must not overlap.
+        Returns the region index.
+        """
+        return self._impl.add_refinement(x0, y0, x1, y1, factor, trace_half_width, clearance)
+
+    def clear_refinements(self) -> None:
+        """Drop every refinement region."""
+        self._impl.clear_refinements()
+
+    @property
+    def num_refinements(self) -> int:
+        """Number of refinement regions."""
+        return self._impl.num_refinements
+
     def get_congestion(self, x: int, y: int, layer: int) -> float:
         """Get congestion level for a cell."""
         return self._impl.get_congestion(x, y, layer)
@@ -801,6 +832,41 @@ class CppGrid:
         self._impl.clear_stored_routes()
         self._synced_route_count = 0
 
+    def sync_stored_routes(self, py_grid: RoutingGrid) -> None:
+        """Copy routes committed on ``py_grid`` since the last sync.
+
+        Append-only (tracked by ``_synced_route_count``); used by
+        :class:`CppPathfinder` before validation and by
+        :class:`CppEscapePlanner` before planning.
+        """
+        current_count = len(py_grid.routes)
+        if current_count <= self._synced_route_count:
+            return
+
+        # Add segments/vias from newly completed routes
+        for route in py_grid.routes[self._synced_route_count :]:
+            for seg in route.segments:
+                layer_idx = py_grid.layer_to_index(seg.layer.value)
+                self._impl.add_stored_segment(
+                    seg.x1,
+                    seg.y1,
+                    seg.x2,
+                    seg.y2,
+                    seg.width,
+                    layer_idx,
+                    seg.net,
+                )
+            for via in route.vias:
+                self._impl.add_stored_via(
+                    via.x,
+                    via.y,
+                    via.drill,
+                    via.diameter,
+                    via.net,
+                )
+
+        self._synced_route_count = current_count
+
 
 class CppPathfinder:
     """C++ Pathfinder wrapper.
@@ -1015,6 +1081,13 @@ class CppPathfinder:
         # search uses the pre-#3143 cost function identically.
         self._pad_channel_budgets: list = []  # list[router_cpp.PadChannelBudget]
 
+        # Per-net conflict-cell counts from the most recent
+        # :meth:`find_blocking_nets` / :meth:`find_blocking_nets_relaxed`
+        # call (``Grid3D::collect_blocking_nets``).  The public methods keep
+        # returning the blocker *set*; rip-up ranking can read the counts
+        # here to prefer the net that occupies most of the failed corridor.
+        self.last_blocking_net_counts: dict[int, int] = {}
+
     def set_segment_foreign_context(
         self,
         foreign_vias: list | None = None,
@@ -1195,6 +1268,86 @@ class CppPathfinder:
         # dedicated C++ getter binding.
         self._routable_layers = list(layers)
 
+    def set_search_corridor(self, bits: list[int] | bytes | None) -> None:
+        """Restrict the search to a flat ``cols*rows`` corridor bitset.
+
+        ``bits`` is typically :meth:`CppGlobalRouter.corridor_bitset` for the
+        net about to be routed; it must cover both endpoints.  ``None`` (or
+        an empty / wrongly sized mask) lifts the restriction.
+        """
+        if bits is None:
+            self._impl.clear_search_corridor()
+        else:
+            self._impl.set_search_corridor(list(bits))
+
+    def route_multires(
+        self,
+        start: Pad,
+        end: Pad,
+        net_class: NetClassRouting | None = None,
+        start_layers: list[int] | None = None,
+        end_layers: list[int] | None = None,
+    ) -> Route | None:
+        """Route between two pads across the grid's refinement regions.
+
+        One native A* searches coarse cells and the fine cells of the regions
+        added with :meth:`CppGrid.add_refinement` (see
+        :func:`~kicad_tools.router.adaptive_grid.install_refinement_regions`;
+        ``Autorouter.route_with_adaptive_grid(single_search=True)`` drives
+        both), so off-grid fine-pitch pads are reached without a separate escape
+        pass.  Negotiated costs, pad bounds, diff-pair clearances and the
+        Python fallback are not applied; the route is still checked with the
+        C++ clearance validator.
+
+        Returns:
+            Route object if successful, None if no path found or the route
+            fails validation.
+        """
+        routable_layers = self._grid.get_routable_indices()
+        start_layer = self._grid.layer_to_index(start.layer.value)
+        end_layer = self._grid.layer_to_index(end.layer.value)
+        if start_layers is None:
+            start_layers = (
+                routable_layers if getattr(start, "through_hole", False) else [start_layer]
+            )
+        if end_layers is None:
+            end_layers = routable_layers if getattr(end, "through_hole", False) else [end_layer]
+
+        py_grid = getattr(self._grid, "_py_grid", None)
+        if py_grid is not None:
+            # Stamps the committed routes into the fine cells as well.
+            self._sync_stored_routes(py_grid)
+
+        result = self._impl.route_multires(
+            start.x,
+            start.y,
+            start_layer,
+            end.x,
+            end.y,
+            end_layer,
+            start.net,
+            start_layers,
+            end_layers,
+            self._max_search_iterations,
+        )
+        if not result.success:
+            self._capture_failure_info(result)
+            return None
+
+        if net_class is None:
+            net_class = self._net_class_map.get(start.net_name)
+        route = self._convert_result_to_route(result, start, end, net_class)
+        trace_width = net_class.trace_width if net_class else self._rules.trace_width
+        trace_clearance = net_class.clearance if net_class else self._rules.trace_clearance
+        trace_radius_cells = max(
+            1, math.ceil((trace_width / 2 + trace_clearance) / self._grid.resolution)
+        )
+        if self._validate_route_clearance(
+            route, start, end, trace_radius_cells, net_class=net_class
+        ):
+            return None
+        return route
+
     def _apply_allowed_layers_to_routable(self) -> None:
         """Restrict the C++ via-expansion to ``allowed_layers`` (Issue #715).
 
@@ -2698,35 +2851,9 @@ class CppPathfinder:
 
         Issue #2439: Incrementally adds new route data to the C++ Grid3D
         so that validate_route() can check clearances without Python callbacks.
-        Only copies routes added since the last sync.
+        See :meth:`CppGrid.sync_stored_routes`.
         """
-        current_count = len(py_grid.routes)
-        if current_count <= self._grid._synced_route_count:
-            return
-
-        # Add segments/vias from newly completed routes
-        for route in py_grid.routes[self._grid._synced_route_count :]:
-            for seg in route.segments:
-                layer_idx = py_grid.layer_to_index(seg.layer.value)
-                self._grid._impl.add_stored_segment(
-                    seg.x1,
-                    seg.y1,
-                    seg.x2,
-                    seg.y2,
-                    seg.width,
-                    layer_idx,
-                    seg.net,
-                )
-            for via in route.vias:
-                self._grid._impl.add_stored_via(
-                    via.x,
-                    via.y,
-                    via.drill,
-                    via.diameter,
-                    via.net,
-                )
-
-        self._grid._synced_route_count = current_count
+        self._grid.sync_stored_routes(py_grid)
 
     def find_blocking_nets(
         self,
@@ -2739,7 +2866,10 @@ class CppPathfinder:
 
         Uses Bresenham's line algorithm to trace the ideal direct path,
         then identifies which net IDs are blocking cells along that path.
-        This is used for targeted rip-up in negotiated routing.
+        This is used for targeted rip-up in negotiated routing.  The walk
+        runs natively (``Grid3D::collect_blocking_nets``) with the circular
+        clearance kernel; per-net conflict-cell counts are left on
+        :attr:`last_blocking_net_counts`.
 
         Issue #2587 / Epic #2556 Phase 1C-cont: When the source net has a
         diff-pair partner (resolvable via :meth:`_resolve_partner_net_id`),
@@ -2760,12 +2890,9 @@ class CppPathfinder:
             Set of net IDs that block the path (excluding net 0, the source
             net, and -- when configured -- the diff-pair partner net).
         """
-        blocking_nets: set[int] = set()
-        source_net = start.net
-
         # Issue #2587 / Phase 1C-cont: Resolve the diff-pair partner net id
         # (or -1 when no partner is configured).  Cells belonging to the
-        # partner are skipped below so they are not flagged for rip-up.
+        # partner are skipped so they are not flagged for rip-up.
         partner_net_id = self._resolve_partner_net_id(start.net_name) or -1
 
         # Convert to grid coordinates
@@ -2779,17 +2906,6 @@ class CppPathfinder:
             # an inner layer on 4-layer stacks.
             layer = self._grid.layer_to_index(start.layer.value)
 
-        # Trace a direct line from start to end using Bresenham's algorithm
-        gx1, gy1 = start_gx, start_gy
-        gx2, gy2 = end_gx, end_gy
-
-        dx = abs(gx2 - gx1)
-        dy = abs(gy2 - gy1)
-        sx = 1 if gx1 < gx2 else -1
-        sy = 1 if gy1 < gy2 else -1
-        err = dx - dy
-        gx, gy = gx1, gy1
-
         # Determine trace half width in cells
         # Issue #1692: Use per-net-class trace width when available,
         # falling back to the global rules.trace_width.
@@ -2800,36 +2916,19 @@ class CppPathfinder:
             int((net_trace_width / 2 + net_trace_clearance) / self._grid.resolution + 0.5),
         )
 
-        while True:
-            # Check this cell and nearby cells (accounting for trace width)
-            for check_dy in range(-trace_half_width_cells, trace_half_width_cells + 1):
-                for check_dx in range(-trace_half_width_cells, trace_half_width_cells + 1):
-                    cx, cy = gx + check_dx, gy + check_dy
-                    if 0 <= cx < self._grid.cols and 0 <= cy < self._grid.rows:
-                        if self._grid._impl.is_valid(cx, cy, layer):
-                            cell = self._grid._impl.at(cx, cy, layer)
-                            if (
-                                cell.blocked
-                                and cell.net != source_net
-                                and cell.net != 0
-                                and cell.net != partner_net_id
-                            ):
-                                # This cell is blocked by another net's route
-                                if cell.usage_count > 0:
-                                    blocking_nets.add(cell.net)
-
-            if gx == gx2 and gy == gy2:
-                break
-
-            e2 = 2 * err
-            if e2 > -dy:
-                err -= dy
-                gx += sx
-            if e2 < dx:
-                err += dx
-                gy += sy
-
-        return blocking_nets
+        # Walk the direct start->end line natively: Bresenham plus the
+        # circular clearance kernel, counting foreign routed-copper cells
+        # (``usage_count > 0``) per net.
+        counts = self._grid._impl.collect_blocking_nets(
+            [(start_gx, start_gy, end_gx, end_gy, int(layer))],
+            [],
+            trace_half_width_cells,
+            False,
+            start.net,
+            partner_net_id,
+        )
+        self.last_blocking_net_counts = dict(counts)
+        return set(self.last_blocking_net_counts)
 
     def find_blocking_nets_relaxed(
         self,
@@ -2841,9 +2940,10 @@ class CppPathfinder:
     ) -> set[int]:
         """Find blocking nets using relaxed A* (Issue #2274 / #2386).
 
-        Python-side mirror of :meth:`Router.find_blocking_nets_relaxed` for
-        the C++ backend. Re-uses the existing C++ ``route`` path; only the
-        segment-walking and original-grid lookup happens in Python.
+        Mirror of :meth:`Router.find_blocking_nets_relaxed` for the C++
+        backend. Re-uses the existing C++ ``route`` path; the segment walk
+        and original-grid lookup run natively in
+        ``Grid3D::collect_blocking_nets``.
 
         Runs A* with routed-net obstacles temporarily removed (the caller is
         responsible for invoking this inside a
@@ -2874,11 +2974,9 @@ class CppPathfinder:
             per_net_timeout=per_net_timeout,
         )
         if route is None:
+            self.last_blocking_net_counts = {}
             return set()
 
-        blocking: set[int] = set()
-        source_net = start.net
-
         # Compute trace half-width in cells (mirrors pathfinder.py:117).
         # CppPathfinder doesn't currently cache _trace_half_width_cells,
         # so compute it here on demand.
@@ -2893,74 +2991,32 @@ class CppPathfinder:
             ),
         )
 
-        # _pad_blocked lookup requires the original Python RoutingGrid.
-        # CppGrid.from_routing_grid stores it on self._py_grid. If the
-        # CppGrid was built without a Python source, fall back to False
-        # (slightly looser, but safe -- at worst a few extra blockers).
-        py_grid = getattr(self._grid, "_py_grid", None)
-
-        def _pad_blocked_at(layer_idx: int, cy: int, cx: int) -> bool:
-            if py_grid is None:
-                return False
-            return bool(py_grid._pad_blocked[layer_idx, cy, cx])
-
-        # 2. Walk every cell along every segment of the relaxed path and
-        #    check the *original* (saved) blocked/net arrays to find which
-        #    routed nets occupied those cells.
+        # 2. Walk every segment of the relaxed path (plus every via location
+        #    on all layers) against the *original* (saved) blocked/net
+        #    arrays in one native pass.  ``Grid3D::collect_blocking_nets``
+        #    reads the snapshots zero-copy and skips ``pad_blocked`` cells
+        #    (static pad metal is never a rip-up candidate).
+        segments = []
         for seg in route.segments:
             gx1, gy1 = self._grid.world_to_grid(seg.x1, seg.y1)
             gx2, gy2 = self._grid.world_to_grid(seg.x2, seg.y2)
-            layer_idx = self._grid.layer_to_index(seg.layer.value)
-
-            # Walk segment cells (Bresenham)
-            dx = abs(gx2 - gx1)
-            dy = abs(gy2 - gy1)
-            sx = 1 if gx1 < gx2 else -1
-            sy = 1 if gy1 < gy2 else -1
-            err = dx - dy
-            gx, gy = gx1, gy1
-            while True:
-                # Check this cell and clearance envelope
-                for cdy in range(-trace_half_width_cells, trace_half_width_cells + 1):
-                    for cdx in range(-trace_half_width_cells, trace_half_width_cells + 1):
-                        cx, cy = gx + cdx, gy + cdy
-                        if 0 <= cx < self._grid.cols and 0 <= cy < self._grid.rows:
-                            was_blocked = bool(saved_blocked[layer_idx, cy, cx])
-                            orig_net = int(saved_net[layer_idx, cy, cx])
-                            if (
-                                was_blocked
-                                and orig_net != 0
-                                and orig_net != source_net
-                                and not _pad_blocked_at(layer_idx, cy, cx)
-                            ):
-                                blocking.add(orig_net)
-
-                if gx == gx2 and gy == gy2:
-                    break
-                e2 = 2 * err
-                if e2 > -dy:
-                    err -= dy
-                    gx += sx
-                if e2 < dx:
-                    err += dx
-                    gy += sy
-
-        # 3. Also check via locations on every layer
-        for via in route.vias:
-            vgx, vgy = self._grid.world_to_grid(via.x, via.y)
-            for layer_idx in range(self._grid.num_layers):
-                if 0 <= vgx < self._grid.cols and 0 <= vgy < self._grid.rows:
-                    was_blocked = bool(saved_blocked[layer_idx, vgy, vgx])
-                    orig_net = int(saved_net[layer_idx, vgy, vgx])
-                    if (
-                        was_blocked
-                        and orig_net != 0
-                        and orig_net != source_net
-                        and not _pad_blocked_at(layer_idx, vgy, vgx)
-                    ):
-                        blocking.add(orig_net)
+            segments.append((gx1, gy1, gx2, gy2, self._grid.layer_to_index(seg.layer.value)))
+        via_cells = [self._grid.world_to_grid(via.x, via.y) for via in route.vias]
+
+        from kicad_tools.acceleration import to_numpy
 
-        return blocking
+        counts = self._grid._impl.collect_blocking_nets(
+            segments,
+            via_cells,
+            trace_half_width_cells,
+            True,
+            start.net,
+            -1,
+            np.ascontiguousarray(to_numpy(saved_blocked), dtype=np.bool_),
+            np.ascontiguousarray(to_numpy(saved_net), dtype=np.int32),
+        )
+        self.last_blocking_net_counts = dict(counts)
+        return set(self.last_blocking_net_counts)
 
 
 def create_hybrid_router(
@@ -3047,9 +3103,10 @@ class CppCoupledPathfinder:
     -- so C++ and Python produce byte-identical routes for the same joint
     path (Issue #4065 curator guidance: do NOT port ``_reconstruct``).
 
-    v1 scope (deferred features stay on the Python fallback): this wrapper is
-    only used for the ``partner_aware`` heuristic with ``allow_swap_via`` off;
-    the Python caller checks those preconditions before dispatching here.
+    Every coupled configuration is native: ``allow_swap_via`` (the Issue
+    #2473 polarity-swap move) and ``heuristic_mode="manhattan_sum"`` (the
+    legacy Issue #3115 heuristic), deferred to Python in v1, are forwarded
+    to the C++ search.
     """
 
     def __init__(
@@ -3063,6 +3120,9 @@ class CppCoupledPathfinder:
         via_drill_cells: int,
         spacing_penalty_factor: float,
         heuristic_weight: float,
+        distance_heuristic: bool = False,
+        allow_swap_via: bool = False,
+        heuristic_mode: str = "partner_aware",
     ):
         if not _CPP_AVAILABLE:
             raise RuntimeError("C++ router backend not available")
@@ -3097,6 +3157,12 @@ class CppCoupledPathfinder:
             float(spacing_penalty_factor),
             float(heuristic_weight),
         )
+        # Opt-in goal-distance heuristic (per-head backward Dijkstra from the
+        # goal, bounded by the corridor); see ``CoupledPathfinder`` in
+        # coupled_pathfinder.hpp.
+        self._impl.distance_heuristic = bool(distance_heuristic)
+        self._impl.allow_swap_via = bool(allow_swap_via)
+        self._impl.heuristic_mode = str(heuristic_mode)
 
     def route(
         self,
@@ -3148,6 +3214,68 @@ class CppCoupledPathfinder:
             int(max_iterations_budget),
             float(timeout_seconds),
         )
+        return self._unpack_result(res)
+
+    def route_batch(
+        self,
+        requests: list[dict],
+        *,
+        num_threads: int = 0,
+        max_rounds: int = 0,
+    ) -> list[tuple[list[tuple[int, int, int, int, int, int, bool]] | None, dict]]:
+        """Route several pairs concurrently (``CoupledPathfinder::route_batch``).
+
+        Each request is a dict of the :meth:`route` keyword arguments plus an
+        optional ``priority`` (lower commits first, the
+        ``Autorouter._get_net_priority`` convention; ties keep list order).
+        The searches run on ``num_threads`` C++ workers (0 = hardware
+        concurrency) with the GIL released, against the shared grid; paths
+        commit in priority order and a pair whose path conflicts with an
+        earlier commit is re-searched around it, up to ``max_rounds``
+        rounds (0 = until every pair commits or fails).
+
+        Returns one ``(path, diagnostics)`` entry per request, in request
+        order, shaped like :meth:`route`'s result.  ``diagnostics`` also
+        carries ``committed`` / ``requeues`` and the batch-wide ``rounds``.
+        Only committed paths are returned; the caller marks them on its
+        grid as it would a sequentially routed pair.
+        """
+        cpp_requests = []
+        for req in requests:
+            r = router_cpp.CoupledPairRequest()
+            r.p_start_x, r.p_start_y = (int(v) for v in req["p_start_xy"])
+            r.n_start_x, r.n_start_y = (int(v) for v in req["n_start_xy"])
+            r.start_layer = int(req["start_layer"])
+            r.p_goal_x, r.p_goal_y = (int(v) for v in req["p_goal_xy"])
+            r.n_goal_x, r.n_goal_y = (int(v) for v in req["n_goal_xy"])
+            r.end_layer = int(req["end_layer"])
+            r.p_net = int(req["p_net"])
+            r.n_net = int(req["n_net"])
+            r.effective_target_spacing = int(req["effective_target_spacing"])
+            r.effective_approach_radius = int(req["effective_approach_radius"])
+            r.effective_departure_radius = int(req["effective_departure_radius"])
+            r.routable_layers = list(req["routable_layers"])
+            r.corridor_bitset = list(req.get("corridor_bitset") or [])
+            r.max_iterations_budget = int(req.get("max_iterations_budget") or 0)
+            r.timeout_seconds = float(req.get("timeout_seconds") or 0.0)
+            r.priority = int(req.get("priority", 0))
+            cpp_requests.append(r)
+
+        batch = self._impl.route_batch(cpp_requests, int(num_threads), int(max_rounds))
+        out = []
+        for i, res in enumerate(batch.results):
+            path, diagnostics = self._unpack_result(res)
+            diagnostics["committed"] = bool(batch.committed[i])
+            diagnostics["requeues"] = int(batch.requeues[i])
+            diagnostics["rounds"] = int(batch.rounds)
+            out.append((path if diagnostics["committed"] else None, diagnostics))
+        return out
+
+    @staticmethod
+    def _unpack_result(
+        res,
+    ) -> tuple[list[tuple[int, int, int, int, int, int, bool]] | None, dict]:
+        """Convert a ``CoupledRouteResult`` into ``(path, diagnostics)``."""
         diagnostics = {
             "iterations": int(res.iterations),
             "best_progress": float(res.best_progress),
@@ -3166,3 +3294,354 @@ class CppCoupledPathfinder:
             (n.p_x, n.p_y, n.p_layer, n.n_x, n.n_y, n.n_layer, n.via_from_parent) for n in res.path
         ]
         return path, diagnostics
+
+
+# ---------------------------------------------------------------------------
+# Native global router over the grid's congestion tiles
+# ---------------------------------------------------------------------------
+
+
+class CppGlobalRouter:
+    """C++ wrapper for the coarse negotiated global router.
+
+    Native counterpart of :class:`~kicad_tools.router.global_router.GlobalRouter`
+    over a :class:`~kicad_tools.router.region_graph.RegionGraph`, planned
+    directly on a :class:`CppGrid`: the regions are the grid's 8x8-cell
+    congestion tiles and each boundary's capacity is counted from the
+    unblocked grid cells on both sides, divided by the trace pitch.  The
+    negotiation loop (history cost on overflowed boundaries, rip-up and
+    reroute of the nets crossing them) runs in C++ with each batch of nets
+    searched concurrently.
+
+    :meth:`route_all` returns the per-net tile trees; :meth:`corridor_bitset`
+    expands a net's tree (dilated by ``halo`` tiles) into the flat
+    ``cols*rows`` bitset :meth:`CppPathfinder.set_search_corridor` and
+    :class:`CppCoupledPathfinder` take.
+    """
+
+    def __init__(
+        self,
+        cpp_grid: CppGrid,
+        rules: DesignRules,
+        *,
+        halo: int = 1,
+        negotiated: bool = True,
+        max_iterations: int = 15,
+        history_increment: float = 1.0,
+        routable_layers: list[int] | None = None,
+    ):
+        if not _CPP_AVAILABLE:
+            raise RuntimeError("C++ router backend not available")
+        self._grid = cpp_grid
+        pitch = (rules.trace_width + rules.trace_clearance) / rules.grid_resolution
+        layers = cpp_grid.get_routable_indices() if routable_layers is None else routable_layers
+        self._impl = router_cpp.GlobalRouter(
+            cpp_grid._impl, max(1, round(pitch)), [int(v) for v in layers]
+        )
+        self._impl.negotiated = bool(negotiated)
+        self._impl.max_iterations = int(max_iterations)
+        self._impl.history_increment = float(history_increment)
+        self.halo = int(halo)
+        self._tiles: dict[int, list[int]] = {}
+
+    def route_all(
+        self,
+        nets: dict[int, list[tuple[float, float]]],
+        net_order: list[int] | None = None,
+        *,
+        num_threads: int = 0,
+        batch_size: int = 32,
+    ) -> dict:
+        """Plan every net's corridor.
+
+        Args:
+            nets: Net ID -> pad positions in world coordinates (mm)
+            net_order: Optional commit order (default: sorted by ID); net 0
+                is never planned
+            num_threads: C++ workers per batch (0 = hardware concurrency)
+            batch_size: Nets searched concurrently against the same usage
+
+        Returns:
+            ``{"tiles": {net: [tile, ...]}, "failed_nets": [...],
+            "iterations": int, "final_overflow": int}``
+        """
+        if net_order is None:
+            net_order = sorted(n for n in nets if n != 0)
+        else:
+            net_order = [n for n in net_order if n != 0 and n in nets]
+        requests = []
+        for net_id in net_order:
+            req = router_cpp.GlobalNetRequest()
+            req.net = int(net_id)
+            req.pins = [self._grid.world_to_grid(x, y) for x, y in nets[net_id]]
+            requests.append(req)
+
+        res = self._impl.route_all(requests, int(num_threads), int(batch_size))
+        self._tiles = {
+            int(net): list(tiles) for net, tiles in zip(res.nets, res.tiles, strict=True)
+        }
+        return {
+            "tiles": dict(self._tiles),
+            "failed_nets": list(res.failed_nets),
+            "iterations": int(res.iterations),
+            "final_overflow": int(res.final_overflow),
+        }
+
+    def corridor_bitset(self, net: int, halo: int | None = None) -> bytes | None:
+        """Flat ``cols*rows`` corridor bitset for ``net`` (None if unplanned).
+
+        One byte per cell; expand it just before routing the net rather than
+        holding one per net.
+        """
+        tiles = self._tiles.get(net)
+        if tiles is None:
+            return None
+        return bytes(self._impl.corridor_bitset(tiles, self.halo if halo is None else int(halo)))
+
+    def refresh_capacity(self) -> None:
+        """Recount boundary capacities after new copper is marked on the grid."""
+        self._impl.refresh_capacity()
+
+    def total_overflow(self) -> int:
+        """Boundary overflow of the last :meth:`route_all`."""
+        return int(self._impl.total_overflow())
+
+
+class CppEscapePlanner:
+    """C++ wrapper for the package escape (fanout) planner.
+
+    Native counterpart of the fanout generators in
+    :mod:`~kicad_tools.router.escape` (BGA ring escape, QFP/QFN alternating
+    escape).  :meth:`plan` computes one stub per pin for a whole package in
+    a single call, checks every candidate in
+    parallel against the board state registered on the :class:`CppGrid`
+    (pads, stored segments and vias) and resolves clashes between the
+    package's own stubs outer ring first.  :meth:`commit` marks the accepted
+    stubs on the grid cells and soft-reserves a short corridor past each
+    escape point.
+    """
+
+    PATTERNS = ("ring", "alternating")
+
+    def __init__(
+        self,
+        cpp_grid: CppGrid,
+        rules: DesignRules,
+        *,
+        escape_clearance: float = 0.0,
+        via_spacing: float = 0.0,
+        corridor_cells: int = 4,
+        num_threads: int = 0,
+    ):
+        if not _CPP_AVAILABLE:
+            raise RuntimeError("C++ router backend not available")
+        cpp_rules = router_cpp.DesignRules()
+        cpp_rules.trace_width = rules.trace_width
+        cpp_rules.trace_clearance = rules.trace_clearance
+        cpp_rules.via_drill = rules.via_drill
+        cpp_rules.via_diameter = rules.via_diameter
+        cpp_rules.via_clearance = rules.via_clearance
+        cpp_rules.grid_resolution = rules.grid_resolution
+        self.grid = cpp_grid
+        self._impl = router_cpp.EscapePlanner(cpp_grid._impl, cpp_rules)
+        self._config = router_cpp.EscapeConfig()
+        self._config.escape_clearance = float(escape_clearance)
+        self._config.via_spacing = float(via_spacing)
+        # Via drills keep the manufacturer hole-to-hole spacing, as in
+        # ``EscapeRouter``'s staggered fanout.
+        self._config.min_drill_clearance = float(getattr(rules, "min_hole_to_hole", 0.0))
+        self._config.corridor_cells = int(corridor_cells)
+        self._config.num_threads = int(num_threads)
+
+    def plan(
+        self,
+        pins: list[tuple[float, float, float, float, int, int]],
+        pattern: str = "ring",
+        inner_layers: list[int] | None = None,
+    ) -> list:
+        """Plan the fanout of one package.
+
+        Args:
+            pins: ``(x, y, width, height, net, layer_idx)`` per pin;
+                ``layer_idx`` -1 marks a through-hole pin (skipped, as is
+                net 0)
+            pattern: One of :attr:`PATTERNS`
+            inner_layers: Grid layers the vias drop to, cycled ring by ring
+                (default: every routable layer)
+
+        Returns:
+            One ``router_cpp.EscapeStub`` per pin, in order; ``stub.status``
+            is ``router_cpp.ESCAPE_OK`` for the accepted stubs.
+        """
+        if pattern not in self.PATTERNS:
+            raise ValueError(f"unknown escape pattern {pattern!r}")
+        self._config.pattern = self.PATTERNS.index(pattern)
+        if inner_layers is None:
+            inner_layers = self.grid.get_routable_indices()
+        self._config.inner_layers = [int(v) for v in inner_layers]
+        native_pins = [
+            router_cpp.EscapePin(x, y, w, h, int(net), int(layer))
+            for x, y, w, h, net, layer in pins
+        ]
+        return self._impl.plan(native_pins, self._config)
+
+    def commit(self, stubs: list, *, store_geometry: bool = True, reserve: bool = True) -> int:
+        """Mark the accepted stubs on the grid; returns how many.
+
+        Callers that keep a Python :class:`RoutingGrid` in sync pass
+        ``store_geometry=False`` (the routes reach the C++ grid through
+        :meth:`CppGrid.sync_stored_routes`) and ``reserve=False`` (reserve
+        :meth:`corridor_cells` through ``RoutingGrid.reserve_corridor_cells``,
+        which mirrors to C++).
+        """
+        return int(self._impl.commit(stubs, self._config, store_geometry, reserve))
+
+    def corridor_cells(self, stub) -> list[tuple[int, int]]:
+        """Cells :meth:`commit` soft-reserves past ``stub``'s escape point."""
+        return [tuple(c) for c in self._impl.corridor_cells(stub, self._config)]
+
+    @property
+    def last_candidates(self) -> int:
+        """Candidate stubs checked against the board by the last :meth:`plan`."""
+        return int(self._impl.last_candidates)
+
+
+class CppMeanderTuner:
+    """C++ wrapper for the match-group serpentine (meander) tuner.
+
+    Native counterpart of the single-ended cascade in
+    :mod:`~kicad_tools.router.match_group_tuning`.  :meth:`tune_group`
+    tunes every member of a match group in one call: trombones are
+    generated with the same shape as
+    :meth:`SerpentineGenerator.generate_trombone` and checked against the
+    board held by the :class:`CppGrid` (stored segments / vias and pads),
+    members in parallel, then reconciled against each other in request
+    order.
+
+    Lengths are planar; callers that tune via-inclusively fold the via
+    delta into each member's target.
+    """
+
+    def __init__(
+        self,
+        cpp_grid: CppGrid,
+        *,
+        trace_clearance: float,
+        via_clearance: float | None,
+        pad_clearance: float,
+        tolerance: float,
+        config: SerpentineConfig | None = None,
+        max_inserts: int = 3,
+        num_threads: int = 0,
+    ):
+        if not _CPP_AVAILABLE:
+            raise RuntimeError("C++ router backend not available")
+        from .optimizer.serpentine import SerpentineConfig
+
+        config = config or SerpentineConfig()
+        native = router_cpp.MeanderConfig()
+        native.amplitude = float(config.amplitude)
+        native.min_spacing = float(config.min_spacing)
+        native.gap_factor = float(config.gap_factor)
+        native.min_segment_length = float(config.min_segment_length)
+        native.max_loops = int(config.max_iterations)
+        native.max_inserts = int(max_inserts)
+        native.trace_clearance = float(trace_clearance)
+        # ``None`` skips the via check, like the Python cascade's via pass.
+        native.via_clearance = -1.0 if via_clearance is None else float(via_clearance)
+        native.pad_clearance = float(pad_clearance)
+        native.tolerance = float(tolerance)
+        self.grid = cpp_grid
+        self.num_threads = int(num_threads)
+        self._impl = router_cpp.MeanderTuner(cpp_grid._impl, native)
+
+    def tune_group(
+        self,
+        members: list[tuple[Route, float]],
+        board_routes: Iterable[Route] | None = None,
+    ) -> list[tuple[Route, object]]:
+        """Tune ``(route, planar_target_mm)`` members; one result per member.
+
+        Args:
+            members: Each member's current route and the planar length it
+                should reach (targets at or below the current length leave
+                the route untouched)
+            board_routes: When given, the routes the loops must clear are
+                loaded from here instead of the grid's synced routes.  The
+                grid's stored routes are rebuilt on the next
+                :meth:`CppGrid.sync_stored_routes` either way.
+
+        Returns:
+            ``(route, router_cpp.MeanderResult)`` per member, in order.
+            ``route`` is the member's original Route object unless at
+            least one trombone was committed.
+        """
+        from .layers import Layer
+        from .primitives import Route, Segment
+
+        grid = self.grid
+        if board_routes is not None:
+            grid._impl.clear_stored_routes()
+            for route in board_routes:
+                for seg in route.segments:
+                    grid._impl.add_stored_segment(
+                        seg.x1,
+                        seg.y1,
+                        seg.x2,
+                        seg.y2,
+                        seg.width,
+                        grid.layer_to_index(seg.layer.value),
+                        seg.net,
+                    )
+                for via in route.vias:
+                    grid._impl.add_stored_via(via.x, via.y, via.drill, via.diameter, via.net)
+
+        requests = []
+        for route, target in members:
+            segments = []
+            for seg in route.segments:
+                cs = router_cpp.Segment()
+                cs.x1, cs.y1, cs.x2, cs.y2 = seg.x1, seg.y1, seg.x2, seg.y2
+                cs.width = seg.width
+                cs.layer = grid.layer_to_index(seg.layer.value)
+                cs.net = seg.net
+                segments.append(cs)
+            vias = []
+            for via in route.vias:
+                cv = router_cpp.Via()
+                cv.x, cv.y = via.x, via.y
+                cv.drill = via.drill
+                cv.diameter = via.diameter
+                cv.layer_from = grid.layer_to_index(via.layers[0].value)
+                cv.layer_to = grid.layer_to_index(via.layers[1].value)
+                cv.net = via.net
+                vias.append(cv)
+            requests.append(router_cpp.MeanderRequest(route.net, segments, vias, float(target)))
+
+        try:
+            native_results = self._impl.tune_group(requests, self.num_threads)
+        finally:
+            if board_routes is not None:
+                grid.invalidate_stored_routes()
+
+        tuned: list[tuple[Route, object]] = []
+        for (route, _target), result in zip(members, native_results, strict=True):
+            if result.inserts == 0:
+                tuned.append((route, result))
+                continue
+            new_route = Route(net=route.net, net_name=route.net_name, vias=route.vias.copy())
+            for s in result.segments:
+                new_route.segments.append(
+                    Segment(
+                        x1=s.x1,
+                        y1=s.y1,
+                        x2=s.x2,
+                        y2=s.y2,
+                        width=s.width,
+                        layer=Layer(grid.index_to_layer(s.layer)),
+                        net=route.net,
+                        net_name=route.net_name,
+                    )
+                )
+            tuned.append((new_route, result))
+        return tuned
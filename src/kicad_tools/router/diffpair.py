@@ -668,6 +668,15 @@ class DifferentialPairConfig:
     # budget-exit behaviour (0/9 coupled, 21/21 single-ended reach).
     enable_shadow_construction: bool = False
 
+    # Tighten the open coupled A* heuristic with a per-head backward
+    # distance field from each goal (turn-aware).  The bound is admissible,
+    # so with the flag-off ``heuristic_weight=1.0`` the search still returns
+    # an optimal route -- it just stops flooding the detour basins that used
+    # to exhaust ``COUPLED_FLAGOFF_MAX_ITERATIONS``.  Corridor-bounded
+    # attempts build the field regardless (the corridor caps its cost); an
+    # open search pays for a board-wide field per pair, so flows opt in.
+    distance_heuristic: bool = False
+
     def get_rules(self, pair_type: DifferentialPairType) -> DifferentialPairRules:
         """Get rules with any config overrides applied."""
         base_rules = DifferentialPairRules.for_type(pair_type)
@@ -557,6 +557,42 @@ class StubEdgeSpec:
     end: Pad
 
 
+@dataclass(frozen=True)
+class CoupledSearchEndpoints:
+    """Grid endpoints and spacing radii of one coupled search.
+
+    Derived from the four pads by
+    :meth:`CoupledPathfinder._search_endpoints`; shared by ``route_coupled``
+    and ``route_coupled_batch`` so a batched pair searches exactly the
+    state space its serial search would.
+    """
+
+    p_start: GridPos
+    n_start: GridPos
+    p_goal: GridPos
+    n_goal: GridPos
+    effective_target_spacing: int
+    effective_approach_radius: int
+    effective_departure_radius: int
+
+
+@dataclass
+class CoupledCorridorPrefetch:
+    """One pair's corridor-phase search, run ahead of the serial pair loop.
+
+    Built by :meth:`DiffPairRouter._prefetch_coupled_batch`.  ``routes`` is
+    the committed ``(p_route, n_route)`` or ``None``; ``diagnostics`` is
+    ``None`` when the guide probe failed and no corridor was searched.
+    ``elapsed`` and ``iterations`` are what the probe and the corridor
+    search charged against the pair's budgets.
+    """
+
+    routes: tuple[Route, Route] | None
+    diagnostics: dict | None
+    elapsed: float
+    iterations: int = 0
+
+
 @dataclass(order=True)
 class CoupledNode:
     """Node for coupled A* priority queue.
@@ -705,6 +741,7 @@ class CoupledPathfinder:
         heuristic_mode: Literal["manhattan_sum", "partner_aware"] = "partner_aware",
         spacing_penalty_factor: float = 0.25,
         heuristic_weight: float = 1.0,
+        distance_heuristic: bool = False,
     ):
         """Initialize coupled pathfinder.
 
@@ -767,6 +804,18 @@ class CoupledPathfinder:
                 test under :mod:`tests.test_diffpair_phase_b` empirically
                 showed lifts the asymmetric-escape case.  Ignored when
                 ``heuristic_mode == "manhattan_sum"``.
+            distance_heuristic: When True, the C++ search tightens the
+                ``"partner_aware"`` heuristic with a per-head backward
+                Dijkstra cost-to-goal field (bounded by the corridor), so
+                detours around congestion no longer flood the joint state
+                space.  Never looser than ``"partner_aware"``.  Searches
+                bounded by a corridor build the field even when False,
+                since the corridor caps its cost; the flag extends it to
+                open searches, whose field spans the whole board.  Only the
+                C++ backend implements it; the pure-Python fallback
+                ignores the flag, and so does the C++ search when
+                ``allow_swap_via`` is set (a swap moves each trace onto its
+                partner's cell, which the per-trace bound cannot price).
         """
         self.grid = grid
         self.rules = rules
@@ -802,6 +851,7 @@ class CoupledPathfinder:
         # (serpentine / Phase 3I tuner), and the corridor mask already
         # bounds how far from the guide path the route can wander.
         self.heuristic_weight = max(1.0, float(heuristic_weight))
+        self.distance_heuristic = bool(distance_heuristic)
         # Issue #3089: set when the most-recent ``route_coupled`` call
         # exited early due to ``timeout_seconds`` being exceeded.
         # Callers (``route_differential_pair_coupled``) read this to
@@ -896,10 +946,10 @@ class CoupledPathfinder:
         ]
 
         # Issue #4065: opt-in flag for the C++ coupled joint-state A*.
-        # Default ON when a C++ backend is present; the search still falls
-        # back to pure Python for the v1-deferred features
-        # (``allow_swap_via``, ``manhattan_sum``) and whenever construction
-        # of the C++ pathfinder raises.  Env-overridable
+        # Default ON when a C++ backend is present; the search falls back to
+        # pure Python only when construction of the C++ pathfinder raises
+        # (the v1-deferred ``allow_swap_via`` / ``manhattan_sum`` features
+        # are native now).  Env-overridable
         # (KCT_COUPLED_CPP=0) so measurement / parity tests can force the
         # Python path without monkeypatching.
         self._use_cpp_coupled = os.environ.get("KCT_COUPLED_CPP", "1") != "0"
@@ -1695,17 +1745,13 @@ class CoupledPathfinder:
     def _cpp_coupled_available(self) -> bool:
         """Whether the C++ coupled search may handle THIS pathfinder.
 
-        v1 scope (Issue #4065): the C++ port covers the ``partner_aware``
-        heuristic with ``allow_swap_via`` off.  The legacy ``manhattan_sum``
-        heuristic and the USB-C polarity-swap ``allow_swap_via`` move are
-        deferred and stay on the pure-Python search.
+        Issue #4065 shipped the ``partner_aware`` / no-swap configuration;
+        the legacy ``manhattan_sum`` heuristic and the USB-C polarity-swap
+        ``allow_swap_via`` move are native as well, so every configuration
+        qualifies whenever the backend is built and not disabled.
         """
         if not self._use_cpp_coupled:
             return False
-        if self.allow_swap_via:
-            return False
-        if self.heuristic_mode != "partner_aware":
-            return False
         from .cpp_backend import is_cpp_available
 
         return is_cpp_available()
@@ -1769,6 +1815,9 @@ class CoupledPathfinder:
                 ),
                 spacing_penalty_factor=self.spacing_penalty_factor,
                 heuristic_weight=self.heuristic_weight,
+                distance_heuristic=self.distance_heuristic,
+                allow_swap_via=self.allow_swap_via,
+                heuristic_mode=self.heuristic_mode,
             )
         except Exception:
             logger.debug("C++ coupled pathfinder construction failed; using Python", exc_info=True)
@@ -1811,18 +1860,8 @@ class CoupledPathfinder:
         if impl is None:
             return None
 
-        # Marshal the corridor frozenset -> flat cols*rows bitset for O(1)
-        # C++ membership (diffpair_routing.py:446 build_corridor_mask churn
-        # -> a byte array here).  Empty list = no corridor.
-        corridor_bitset: list[int] = []
-        if corridor is not None:
-            cols, rows = self.grid.cols, self.grid.rows
-            bitset = bytearray(cols * rows)
-            for cx, cy in corridor:
-                if 0 <= cx < cols and 0 <= cy < rows:
-                    bitset[cy * cols + cx] = 1
-            corridor_bitset = list(bitset)
-
+        corridor_bitset = self._corridor_bitset(corridor)
+        impl.distance_heuristic = self.distance_heuristic or corridor is not None
         routable_layers = list(self.grid.get_routable_indices())
 
         path, diagnostics = impl.route(
@@ -1851,7 +1890,34 @@ class CoupledPathfinder:
             ),
         )
 
-        # Mirror the diagnostic bookkeeping the Python loop maintains.
+        self._record_cpp_diagnostics(diagnostics)
+        if path is None:
+            return True, None
+
+        return True, self._reconstruct_coupled_routes_from_cpp_path(path)
+
+    def _corridor_bitset(self, corridor: frozenset[tuple[int, int]] | None) -> list[int]:
+        """Marshal a corridor mask into the flat ``cols*rows`` C++ bitset.
+
+        O(1) membership on the C++ side instead of the
+        :func:`build_corridor_mask` frozenset; empty list = no corridor.
+        """
+        if corridor is None:
+            return []
+        cols, rows = self.grid.cols, self.grid.rows
+        bitset = bytearray(cols * rows)
+        for cx, cy in corridor:
+            if 0 <= cx < cols and 0 <= cy < rows:
+                bitset[cy * cols + cx] = 1
+        return list(bitset)
+
+    def _record_cpp_diagnostics(self, diagnostics: dict) -> None:
+        """Mirror a C++ search's diagnostics into the ``last_*`` bookkeeping.
+
+        The same fields the Python loop maintains, so budget-exit handling
+        does not care which backend (or a ``route_coupled_batch`` call) ran
+        the search.
+        """
         self.last_iterations = int(diagnostics["iterations"])
         bp = diagnostics["best_progress"]
         self.last_best_progress = float("inf") if bp < 0 else float(bp)
@@ -1874,11 +1940,6 @@ class CoupledPathfinder:
         # empty on the C++ path and no guard-pruning signal survived).
         self.last_rejections = collections.defaultdict(int, diagnostics.get("rejections", {}) or {})
 
-        if path is None:
-            return True, None
-
-        return True, self._reconstruct_coupled_routes_from_cpp_path(path)
-
     def _reconstruct_coupled_routes_from_cpp_path(
         self,
         path: list[tuple[int, int, int, int, int, int, bool]],
@@ -1909,6 +1970,167 @@ class CoupledPathfinder:
         self._build_route_from_path(n_route, n_path, n_start, n_end)
         return p_route, n_route
 
+    def route_coupled_batch(
+        self,
+        specs: list[CoupledSegmentSpec],
+        timeout_seconds: float | list[float | None] | None = None,
+        max_iterations_budget: int | None = None,
+        corridors: list[frozenset[tuple[int, int]] | None] | None = None,
+    ) -> list[tuple[tuple[Route, Route] | None, dict]] | None:
+        """Route several pairs' coupled searches in one native call.
+
+        Each spec gets the search ``route_coupled`` would run for it with
+        its entry of ``corridors`` (``None`` = open search) and the same
+        budgets; a list ``timeout_seconds`` gives each spec its own.  The
+        searches run concurrently in ``CppCoupledPathfinder.route_batch``
+        and commit in spec order, so a later pair routes around the
+        clearance envelope of an earlier one -- the order the serial loop
+        would have marked them.
+
+        Returns one ``(routes, diagnostics)`` entry per spec, ``routes``
+        being the reconstructed ``(p_route, n_route)`` or ``None`` when the
+        pair did not commit.  Feed ``diagnostics`` to
+        :meth:`_record_cpp_diagnostics` to surface them as ``last_*``.
+        Returns ``None`` when the C++ backend is unavailable; the caller
+        then routes each pair with ``route_coupled``.
+        """
+        if not self._cpp_coupled_available():
+            return None
+        impl = self._get_cpp_coupled_impl()
+        if impl is None:
+            return None
+
+        routable_layers = list(self.grid.get_routable_indices())
+        if not isinstance(timeout_seconds, list):
+            timeout_seconds = [timeout_seconds] * len(specs)
+        if corridors is None:
+            corridors = [None] * len(specs)
+        # One setting per batch: the field only when every search is bounded
+        # (see ``distance_heuristic`` in ``__init__``).
+        impl.distance_heuristic = self.distance_heuristic or all(
+            corridor is not None for corridor in corridors
+        )
+        requests = []
+        for index, (spec, timeout, corridor) in enumerate(
+            zip(specs, timeout_seconds, corridors, strict=True)
+        ):
+            ends = self._search_endpoints(spec.p_start, spec.p_end, spec.n_start, spec.n_end)
+            requests.append(
+                {
+                    "p_start_xy": (ends.p_start.x, ends.p_start.y),
+                    "n_start_xy": (ends.n_start.x, ends.n_start.y),
+                    "start_layer": ends.p_start.layer,
+                    "p_goal_xy": (ends.p_goal.x, ends.p_goal.y),
+                    "n_goal_xy": (ends.n_goal.x, ends.n_goal.y),
+                    "end_layer": ends.p_goal.layer,
+                    "p_net": spec.p_start.net,
+                    "n_net": spec.n_start.net,
+                    "effective_target_spacing": ends.effective_target_spacing,
+                    "effective_approach_radius": ends.effective_approach_radius,
+                    "effective_departure_radius": ends.effective_departure_radius,
+                    "routable_layers": routable_layers,
+                    "corridor_bitset": self._corridor_bitset(corridor),
+                    "max_iterations_budget": max_iterations_budget,
+                    "timeout_seconds": timeout,
+                    "priority": index,
+                }
+            )
+
+        out: list[tuple[tuple[Route, Route] | None, dict]] = []
+        for spec, (path, diagnostics) in zip(specs, impl.route_batch(requests), strict=True):
+            routes = None
+            if path is not None:
+                self._cpp_reconstruct_pads = (spec.p_start, spec.p_end, spec.n_start, spec.n_end)
+                routes = self._reconstruct_coupled_routes_from_cpp_path(path)
+            out.append((routes, diagnostics))
+        return out
+
+    def _search_endpoints(
+        self, p_start: Pad, p_end: Pad, n_start: Pad, n_end: Pad
+    ) -> CoupledSearchEndpoints:
+        """Grid start/goal states and spacing radii for a coupled search."""
+        # Convert to grid coordinates
+        p_start_gx, p_start_gy = self.grid.world_to_grid(p_start.x, p_start.y)
+        p_end_gx, p_end_gy = self.grid.world_to_grid(p_end.x, p_end.y)
+        n_start_gx, n_start_gy = self.grid.world_to_grid(n_start.x, n_start.y)
+        n_end_gx, n_end_gy = self.grid.world_to_grid(n_end.x, n_end.y)
+
+        # Determine start layer
+        start_layer = self.grid.layer_to_index(p_start.layer.value)
+        end_layer = self.grid.layer_to_index(p_end.layer.value)
+
+        # Create start and goal states
+        p_start_pos = GridPos(p_start_gx, p_start_gy, start_layer)
+        n_start_pos = GridPos(n_start_gx, n_start_gy, start_layer)
+        p_goal_pos = GridPos(p_end_gx, p_end_gy, end_layer)
+        n_goal_pos = GridPos(n_end_gx, n_end_gy, end_layer)
+
+        # Issue #2473: Derive the actual target spacing from the start
+        # pad pair on the grid.  Real-world differential pairs (USB-C,
+        # USB device-side connectors) often have pad spacing that
+        # exceeds the manufacturer-minimum spacing configured on the
+        # rules.  Using the configured spacing as a hard target prevents
+        # the search from leaving the start state.  We honor the larger
+        # of the configured spacing and the actual start-pad distance,
+        # which keeps clearance valid while letting the coupled run
+        # follow the natural pad pitch.
+        #
+        # Issue #2484: Keep this widened value as a per-call local
+        # rather than mutating ``self.target_spacing_cells``.  The
+        # previous implementation permanently widened the instance
+        # attribute on the first wide-pad call and leaked the new
+        # spacing into every subsequent ``route_coupled`` invocation
+        # on the same pathfinder.
+        actual_start_spacing = math.sqrt(
+            (p_start_gx - n_start_gx) ** 2 + (p_start_gy - n_start_gy) ** 2
+        )
+        actual_end_spacing = math.sqrt((p_end_gx - n_end_gx) ** 2 + (p_end_gy - n_end_gy) ** 2)
+
+        # Issue #3508: the mid-route spacing target is the CONFIGURED
+        # coupled spacing, NOT the start pad pitch.  The legacy code
+        # (#2473) widened ``effective_target_spacing`` to the start-pad
+        # distance, which forced the pair to fly the ENTIRE route at
+        # connector pitch (0.75-1.0 mm on board 06's FFC / USB-C
+        # sources -- not electrically coupled at all) and then made the
+        # endgame infeasible: a 16-20-cell-wide pair cannot thread the
+        # dense pad field around the destination IC, and the
+        # ``_heuristic`` spacing penalty (which uses the configured
+        # ``self.target_spacing_cells``) actively fought the move
+        # filter the whole way.  Instead, keep the configured target
+        # and let the DEPARTURE phase below absorb the start-pitch
+        # mismatch, exactly mirroring how the approach phase absorbs
+        # the goal-pitch mismatch.
+        effective_target_spacing = self.target_spacing_cells
+
+        # Issue #2490: Size the approach radius to accommodate the
+        # full pitch transition between the coupled target and the
+        # goal pads.  The legacy ``max(target, 6)`` radius can be
+        # smaller than the number of single-cell spacing reductions
+        # required to converge, leaving the search no room to relax
+        # spacing without exceeding the per-step tolerance.  Scale the
+        # radius with the absolute spacing difference plus a small
+        # buffer so each cell of the approach can change spacing by
+        # at most one cell.
+        end_spacing_delta = int(round(abs(actual_end_spacing - effective_target_spacing)))
+        effective_approach_radius = max(effective_target_spacing, 6, end_spacing_delta * 2 + 4)
+
+        # Issue #3508: departure radius -- the mirror of the approach
+        # radius, sized by the start-pitch transition.  Within this
+        # radius of the start pads the spacing tolerance is widened so
+        # the pair can converge from the physical pad pitch down to
+        # the coupled target one cell per step.
+        start_spacing_delta = int(round(abs(actual_start_spacing - effective_target_spacing)))
+        effective_departure_radius = max(effective_target_spacing, 6, start_spacing_delta * 2 + 4)
+        return CoupledSearchEndpoints(
+            p_start=p_start_pos,
+            n_start=n_start_pos,
+            p_goal=p_goal_pos,
+            n_goal=n_goal_pos,
+            effective_target_spacing=effective_target_spacing,
+            effective_approach_radius=effective_approach_radius,
+            effective_departure_radius=effective_departure_radius,
+        )
+
     def route_coupled(
         self,
         p_start: Pad,
@@ -2011,78 +2233,13 @@ class CoupledPathfinder:
         # reconstruction uses, so routes are byte-identical).
         self._cpp_reconstruct_pads = (p_start, p_end, n_start, n_end)
 
-        # Convert to grid coordinates
-        p_start_gx, p_start_gy = self.grid.world_to_grid(p_start.x, p_start.y)
-        p_end_gx, p_end_gy = self.grid.world_to_grid(p_end.x, p_end.y)
-        n_start_gx, n_start_gy = self.grid.world_to_grid(n_start.x, n_start.y)
-        n_end_gx, n_end_gy = self.grid.world_to_grid(n_end.x, n_end.y)
-
-        # Determine start layer
-        start_layer = self.grid.layer_to_index(p_start.layer.value)
-        end_layer = self.grid.layer_to_index(p_end.layer.value)
-
-        # Create start and goal states
-        p_start_pos = GridPos(p_start_gx, p_start_gy, start_layer)
-        n_start_pos = GridPos(n_start_gx, n_start_gy, start_layer)
-        p_goal_pos = GridPos(p_end_gx, p_end_gy, end_layer)
-        n_goal_pos = GridPos(n_end_gx, n_end_gy, end_layer)
-
-        # Issue #2473: Derive the actual target spacing from the start
-        # pad pair on the grid.  Real-world differential pairs (USB-C,
-        # USB device-side connectors) often have pad spacing that
-        # exceeds the manufacturer-minimum spacing configured on the
-        # rules.  Using the configured spacing as a hard target prevents
-        # the search from leaving the start state.  We honor the larger
-        # of the configured spacing and the actual start-pad distance,
-        # which keeps clearance valid while letting the coupled run
-        # follow the natural pad pitch.
-        #
-        # Issue #2484: Keep this widened value as a per-call local
-        # rather than mutating ``self.target_spacing_cells``.  The
-        # previous implementation permanently widened the instance
-        # attribute on the first wide-pad call and leaked the new
-        # spacing into every subsequent ``route_coupled`` invocation
-        # on the same pathfinder.
-        actual_start_spacing = math.sqrt(
-            (p_start_gx - n_start_gx) ** 2 + (p_start_gy - n_start_gy) ** 2
-        )
-        actual_end_spacing = math.sqrt((p_end_gx - n_end_gx) ** 2 + (p_end_gy - n_end_gy) ** 2)
-
-        # Issue #3508: the mid-route spacing target is the CONFIGURED
-        # coupled spacing, NOT the start pad pitch.  The legacy code
-        # (#2473) widened ``effective_target_spacing`` to the start-pad
-        # distance, which forced the pair to fly the ENTIRE route at
-        # connector pitch (0.75-1.0 mm on board 06's FFC / USB-C
-        # sources -- not electrically coupled at all) and then made the
-        # endgame infeasible: a 16-20-cell-wide pair cannot thread the
-        # dense pad field around the destination IC, and the
-        # ``_heuristic`` spacing penalty (which uses the configured
-        # ``self.target_spacing_cells``) actively fought the move
-        # filter the whole way.  Instead, keep the configured target
-        # and let the DEPARTURE phase below absorb the start-pitch
-        # mismatch, exactly mirroring how the approach phase absorbs
-        # the goal-pitch mismatch.
-        effective_target_spacing = self.target_spacing_cells
-
-        # Issue #2490: Size the approach radius to accommodate the
-        # full pitch transition between the coupled target and the
-        # goal pads.  The legacy ``max(target, 6)`` radius can be
-        # smaller than the number of single-cell spacing reductions
-        # required to converge, leaving the search no room to relax
-        # spacing without exceeding the per-step tolerance.  Scale the
-        # radius with the absolute spacing difference plus a small
-        # buffer so each cell of the approach can change spacing by
-        # at most one cell.
-        end_spacing_delta = int(round(abs(actual_end_spacing - effective_target_spacing)))
-        effective_approach_radius = max(effective_target_spacing, 6, end_spacing_delta * 2 + 4)
-
-        # Issue #3508: departure radius -- the mirror of the approach
-        # radius, sized by the start-pitch transition.  Within this
-        # radius of the start pads the spacing tolerance is widened so
-        # the pair can converge from the physical pad pitch down to
-        # the coupled target one cell per step.
-        start_spacing_delta = int(round(abs(actual_start_spacing - effective_target_spacing)))
-        effective_departure_radius = max(effective_target_spacing, 6, start_spacing_delta * 2 + 4)
+        endpoints = self._search_endpoints(p_start, p_end, n_start, n_end)
+        p_start_pos, n_start_pos = endpoints.p_start, endpoints.n_start
+        p_goal_pos, n_goal_pos = endpoints.p_goal, endpoints.n_goal
+        start_layer, end_layer = p_start_pos.layer, p_goal_pos.layer
+        effective_target_spacing = endpoints.effective_target_spacing
+        effective_approach_radius = endpoints.effective_approach_radius
+        effective_departure_radius = endpoints.effective_departure_radius
 
         # Issue #4065: try the C++ coupled joint-state A* first.  The C++
         # search consumes the SAME Grid3D the single-ended C++ pathfinder
@@ -2090,9 +2247,8 @@ class CoupledPathfinder:
         # the UNCHANGED ``_build_route_from_path`` -- so C++ and Python
         # produce byte-identical Routes for the same joint path.  Preserved
         # as an optional accelerator: the pure-Python A* below is the
-        # fallback, exercised when the backend is absent/stale, when the
-        # v1-deferred features are requested (``allow_swap_via`` /
-        # ``manhattan_sum``), or when ``_use_cpp_coupled`` is disabled.
+        # fallback, exercised when the backend is absent/stale or when
+        # ``_use_cpp_coupled`` is disabled.
         cpp_path = self._try_cpp_route_coupled(
             p_start_pos=p_start_pos,
             n_start_pos=n_start_pos,
@@ -2947,6 +3103,18 @@ class DiffPairRouter:
         # config by ``route_all_with_diffpairs``; tests may set it
         # directly.
         self.enable_shadow_construction: bool = False
+        # Goal-distance heuristic for the open coupled search (see
+        # ``DifferentialPairConfig.distance_heuristic``); corridor-bounded
+        # searches always use it.  Independent of the shadow flag: it never
+        # changes the optimal path cost, it only lets a flag-off search
+        # converge inside its iteration budget.
+        self.distance_heuristic: bool = False
+        # Corridor-phase outcomes of the current multi-pair flow, keyed by
+        # pair name (see ``_prefetch_coupled_batch``); consumed once per pair.
+        self._batch_coupled_results: dict[str, CoupledCorridorPrefetch] = {}
+        # Progress prints of the multi-pair flows; set from their
+        # ``verbose`` argument.
+        self.verbose: bool = True
 
     def _collect_existing_drills(self) -> list[tuple[float, float, float]]:
         """Assemble a board-wide drill registry for the hole-to-hole guard.
@@ -4964,75 +5132,10 @@ class DiffPairRouter:
             if hasattr(router, "clear_avoidance_costs"):
                 router.clear_avoidance_costs()
 
-    def route_differential_pair_coupled(
-        self,
-        pair: DifferentialPair,
-        spacing: float | None = None,
-        coupled_only: bool = False,
-        extra_spacing_cells: int = 0,
-        per_pair_timeout: float | None = None,
-        per_pair_max_iterations: int | None = None,
-    ) -> tuple[list[Route], LengthMismatchWarning | None]:
-        """Route a differential pair using coupled pathfinding.
-
-        Routes both P and N traces simultaneously while maintaining
-        constant spacing between them.
-
-        Args:
-            pair: The differential pair to route.
-            spacing: Optional spacing override.
-            coupled_only: Issue #2464: When True, do not fall back to
-                independent routing if the coupled pathfinder cannot
-                handle the pair (e.g., 3-pad nets, no path found).
-                Returns ``([], None)`` instead.  Used by the diff-pair
-                pre-pass so that pairs that cannot be coupled are left
-                for the main strategy to route normally.
-            extra_spacing_cells: Issue #3040 Phase B: additional grid
-                cells to add to both the target ``spacing_cells`` and
-                ``min_spacing_cells`` floor passed to the
-                :class:`CoupledPathfinder`.  Used by the Phase B repair
-                pass to widen the search's spacing target on retry when
-                the first attempt produced an intra-pair clearance
-                violation due to grid quantisation.  Each additional
-                cell adds one ``grid.resolution`` of edge-to-edge
-                separation, which is normally enough to push the
-                routed clearance above the per-pair threshold.
-                Default ``0`` preserves legacy behaviour.
-            per_pair_timeout: Issue #3089: Optional wall-clock budget
-                (seconds) passed through to
-                :meth:`CoupledPathfinder.route_coupled` for each
-                coupled-segment search this pair triggers.  ``None``
-                preserves the legacy unbounded behaviour.  When the
-                budget is exceeded the coupled search returns ``None``
-                and this method falls through to the same
-                "coupled routing failed" handler used for genuine
-                no-path-found results (independent routing fallback
-                when ``coupled_only=False``; ``([], None)`` return
-                otherwise), so callers do not need a separate
-                code-path for budget exits.
-        """
-        # Issue #3089: reset the budget-exit flag at the start of each
-        # call so callers see only the most-recent invocation's state.
-        self._last_pair_budget_exit = False
-
-        if pair.rules is None:
-            return [], None
-
-        if spacing is None:
-            spacing = pair.rules.spacing
-
-        print(f"\n  Routing differential pair {pair} (coupled mode)")
-        print(f"    Type: {pair.pair_type.value}")
-        print(f"    Spacing: {spacing}mm, Max delta: {pair.rules.max_length_delta}mm")
-
-        # Get pads
-        pad_result = self._get_pair_pads(pair)
-        if pad_result is None:
-            print("    ERROR: Could not find pads for differential pair")
-            return [], None
-
-        p_pads, n_pads = pad_result
-
+    def _coupled_segment_specs(
+        self, p_pads: list[Pad], n_pads: list[Pad]
+    ) -> tuple[list[CoupledSegmentSpec], list[StubEdgeSpec]]:
+        """Split a pair's pads into coupled segments and single-net stubs."""
         # Issue #2473: Pair pads using the MST-based N-pad helper.
         # For 2-pad nets this still produces a single coupled segment
         # with no stubs; for 3+ pad nets (USB-C) it returns one or
@@ -5067,17 +5170,16 @@ class DiffPairRouter:
             stub_specs: list[StubEdgeSpec] = []
         else:
             coupled_specs, stub_specs = self._pair_pads_for_coupled_routing_npad(p_pads, n_pads)
+        return coupled_specs, stub_specs
 
-        if not coupled_specs:
-            if coupled_only:
-                print(
-                    "    Skipping diff-pair pre-pass: complex pad configuration "
-                    "(coupled pathfinder could not pair pads)"
-                )
-                return [], None
-            print("    WARNING: Complex pad configuration, falling back to independent routing")
-            return self.route_differential_pair_independent(pair, spacing)
+    def _coupled_spacing(
+        self, pair: DifferentialPair, spacing: float, extra_spacing_cells: int
+    ) -> tuple[int, int, float]:
+        """Return ``(spacing_cells, min_spacing_cells, intra_pair_clearance_mm)``.
 
+        The two cell counts configure the coupled search; the clearance is
+        the threshold the committed pair is audited against.
+        """
         # Issue #3012: Calculate the effective spacing.  The legacy
         # behaviour used ``int(spacing / resolution)`` where ``spacing``
         # came from the per-type ``DifferentialPairRules.spacing``
@@ -5156,50 +5258,10 @@ class DiffPairRouter:
         if extra_spacing_cells > 0:
             min_spacing_cells += extra_spacing_cells
             spacing_cells += extra_spacing_cells
+        return spacing_cells, min_spacing_cells, pair_intra_clearance
 
-        # If any segment requires polarity-swap, enable swap-via moves.
-        #
-        # Issue #3508: swap-via moves are DISABLED.  The swap move
-        # exchanges the two heads' exact grid positions onto one shared
-        # new layer, so reconstruction emits the SAME A->B segment for
-        # both nets (P: A->B, N: B->A) -- coincident copper, i.e. a
-        # short.  Every swap-containing result was therefore rejected
-        # by the #3320 severe-overlap gate at exactly
-        # ``-trace_width`` (board 06 PCIE/USB3, board 07 DQS -- the
-        # "swap-overlap gate" rejection documented in #3473).  With
-        # mid-route asymmetric moves now enabled (this issue), a
-        # polarity swap is achievable WITHOUT vias: the advancing
-        # trace walks a discrete arc around its holding partner
-        # (offset-vector rotation through 180 degrees), which the
-        # trail-proximity guard keeps clearance-legal.  Re-enable only
-        # after the swap reconstruction emits a genuine two-layer
-        # crossover (staggered vias, partner segments on different
-        # layers).
-        any_polarity_swap = any(s.polarity_swap for s in coupled_specs)
-        del any_polarity_swap  # documented above; swap moves disabled
-
-        # Create coupled pathfinder.
-        # Issue #3508: heuristic_weight > 1 (weighted A*) -- without it
-        # the joint-state search floods cost_turn-deep f-plateaus
-        # (~90k iterations for ONE 5-point shell on board 06) and no
-        # CI-affordable iteration budget converges.  See the
-        # ``heuristic_weight`` rationale in ``CoupledPathfinder``.
-        #
-        # Issue #3547: the weighted-A* search upgrade is gated behind
-        # ``enable_shadow_construction``.  Weighting the heuristic changes
-        # WHICH joint states the always-running coupled pre-phase explores
-        # (goal-ward gradient dominates shell-flooding), so a search that
-        # DEFERRED on the pre-#3508 baseline can CONVERGE with the flag
-        # off -- committing a route where main deferred re-exposes the
-        # gated hazards (#3542 corridor competition, #3544 pre-phase
-        # seg-seg violations).  With the shadow constructor disabled
-        # (default) fall back to classic optimal A* (``heuristic_weight=
-        # 1.0``), the pre-#3508 search behaviour, so a flag-off run keeps
-        # recipes on their pre-#3508 budget-exit path.
-        coupled_heuristic_weight = (
-            COUPLED_HEURISTIC_WEIGHT if self.enable_shadow_construction else 1.0
-        )
-
+    def _coupled_iteration_budget(self, per_pair_max_iterations: int | None) -> int | None:
+        """Per-pair iteration budget of the coupled search."""
         # Issue #3547: bound the flag-off classic-A* search so it DEFERS
         # promptly instead of grinding the ``cols * rows * 4`` memory
         # backstop.  With the shadow constructor OFF (default) the search
@@ -5226,7 +5288,7 @@ class DiffPairRouter:
         # best-progress plateaus identically to the 1000-iter run
         # (398->398, 61->64 cells from goal) while wall-time balloons
         # 562s -> >600s.  The reason is the ``heuristic_weight`` note
-        # above: classic optimal A* (weight=1.0, the flag-off search)
+        # in ``_new_coupled_pathfinder``: classic optimal A* (weight=1.0, the flag-off search)
         # floods cost_turn f-plateaus and "no CI-affordable iteration
         # budget converges".  The historical 6/9 convergence came from the
         # geometric SHADOW CONSTRUCTOR (``enable_shadow_construction=
@@ -5239,16 +5301,319 @@ class DiffPairRouter:
             and COUPLED_FLAGOFF_MAX_ITERATIONS > 0
         ):
             per_pair_max_iterations = COUPLED_FLAGOFF_MAX_ITERATIONS
+        return per_pair_max_iterations
 
-        pathfinder = CoupledPathfinder(
+    def _new_coupled_pathfinder(
+        self, spacing_cells: int, min_spacing_cells: int
+    ) -> CoupledPathfinder:
+        """Build the coupled pathfinder for a pair with the given spacing."""
+        # Issue #3508: heuristic_weight > 1 (weighted A*) -- without it
+        # the joint-state search floods cost_turn-deep f-plateaus
+        # (~90k iterations for ONE 5-point shell on board 06) and no
+        # CI-affordable iteration budget converges.  See the
+        # ``heuristic_weight`` rationale in ``CoupledPathfinder``.
+        #
+        # Issue #3547: the weighted-A* search upgrade is gated behind
+        # ``enable_shadow_construction``.  Weighting the heuristic changes
+        # WHICH joint states the always-running coupled pre-phase explores
+        # (goal-ward gradient dominates shell-flooding), so a search that
+        # DEFERRED on the pre-#3508 baseline can CONVERGE with the flag
+        # off -- committing a route where main deferred re-exposes the
+        # gated hazards (#3542 corridor competition, #3544 pre-phase
+        # seg-seg violations).  With the shadow constructor disabled
+        # (default) fall back to classic optimal A* (``heuristic_weight=
+        # 1.0``), the pre-#3508 search behaviour, so a flag-off run keeps
+        # recipes on their pre-#3508 budget-exit path.
+        coupled_heuristic_weight = (
+            COUPLED_HEURISTIC_WEIGHT if self.enable_shadow_construction else 1.0
+        )
+
+        return CoupledPathfinder(
             self.autorouter.grid,
             self.autorouter.rules,
             spacing_cells,
             net_class_map=self.autorouter.net_class_map,
-            allow_swap_via=False,  # Issue #3508: see rationale above
+            allow_swap_via=False,  # Issue #3508: see route_differential_pair_coupled
             min_spacing_cells=min_spacing_cells,
             heuristic_weight=coupled_heuristic_weight,
+            # The goal-distance field is admissible, so unlike the #3508
+            # weighting it keeps classic A* optimal and is safe flag-off.
+            distance_heuristic=self.distance_heuristic,
+        )
+
+    def _prefetch_coupled_batch(
+        self,
+        pairs: list[DifferentialPair],
+        spacing: float | None,
+        per_pair_timeout: float | None,
+        per_pair_max_iterations: int | None,
+        deadline: float | None = None,
+    ) -> None:
+        """Run the corridor-phase coupled searches of a multi-pair flow in one call.
+
+        A byte lane or a USB3/PCIe group routes several 2-pad pairs back to
+        back.  Each pair's single-ended guide probe runs here as it would in
+        ``route_differential_pair_coupled``, and pairs that share a spacing
+        configuration have their corridor-bounded searches handed to
+        ``CoupledPathfinder.route_coupled_batch`` together, with the same
+        per-pair corridor budgets.  It runs them concurrently and commits
+        them in ``pairs`` order, the order the serial loop marks them.
+        Each outcome is stashed in ``_batch_coupled_results``; the serial
+        loop then runs the open search only for the pairs whose corridor
+        attempt failed, on what is left of their budget.
+
+        Without the C++ backend (or with the shadow constructor on, which
+        never reaches the joint search) nothing is stashed and every pair
+        takes the serial path.  Probing stops at ``deadline``; the rest of
+        the pairs take the serial path as well.
+        """
+        self._batch_coupled_results = {}
+        if self.enable_shadow_construction or len(pairs) < 2:
+            return
+        groups: dict[tuple[int, int], list[tuple[DifferentialPair, CoupledSegmentSpec]]] = {}
+        for pair in pairs:
+            if pair.rules is None:
+                continue
+            pad_result = self._get_pair_pads(pair)
+            if pad_result is None or len(pad_result[0]) != 2 or len(pad_result[1]) != 2:
+                continue
+            specs, _stubs = self._coupled_segment_specs(*pad_result)
+            if len(specs) != 1:
+                continue
+            pair_spacing = spacing if spacing is not None else pair.rules.spacing
+            spacing_cells, min_spacing_cells, _clearance = self._coupled_spacing(
+                pair, pair_spacing, 0
+            )
+            groups.setdefault((spacing_cells, min_spacing_cells), []).append((pair, specs[0]))
+
+        # The corridor half of the budgets, as in the serial attempt.
+        budget = self._coupled_iteration_budget(per_pair_max_iterations)
+        corridor_iterations = max(1, budget // 2) if budget is not None and budget > 0 else None
+        probe_timeout = per_pair_timeout * 0.125 if per_pair_timeout is not None else None
+        for (spacing_cells, min_spacing_cells), members in groups.items():
+            if len(members) < 2:
+                continue
+            pathfinder = self._new_coupled_pathfinder(spacing_cells, min_spacing_cells)
+            if not pathfinder._cpp_coupled_available():
+                return
+            if pathfinder._get_cpp_coupled_impl() is None:
+                return
+            searched: list[tuple[DifferentialPair, CoupledSegmentSpec, float]] = []
+            corridors: list[frozenset[tuple[int, int]] | None] = []
+            timeouts: list[float | None] = []
+            for pair, spec in members:
+                if deadline is not None and time.monotonic() >= deadline:
+                    break
+                probe_t0 = time.monotonic()
+                guide_route = self._single_ended_guide_route(
+                    spec.p_start, spec.p_end, per_net_timeout=probe_timeout
+                )
+                probe_elapsed = time.monotonic() - probe_t0
+                if guide_route is None or not guide_route.segments:
+                    self._batch_coupled_results[pair.name] = CoupledCorridorPrefetch(
+                        None, None, probe_elapsed
+                    )
+                    continue
+                searched.append((pair, spec, probe_elapsed))
+                corridors.append(self._coupled_corridor(spec, guide_route, spacing_cells))
+                timeouts.append(
+                    None
+                    if per_pair_timeout is None
+                    else max(0.5, per_pair_timeout * 0.5 - probe_elapsed)
+                )
+            if not searched:
+                continue
+            t0 = time.monotonic()
+            results = pathfinder.route_coupled_batch(
+                [spec for _pair, spec, _elapsed in searched],
+                timeout_seconds=timeouts,
+                max_iterations_budget=corridor_iterations,
+                corridors=corridors,
+            )
+            if results is None:
+                self._batch_coupled_results = {}
+                return
+            batch_elapsed = time.monotonic() - t0
+            for (pair, _spec, probe_elapsed), timeout, (routes, diagnostics) in zip(
+                searched, timeouts, results, strict=True
+            ):
+                used = batch_elapsed if timeout is None else min(batch_elapsed, timeout)
+                self._batch_coupled_results[pair.name] = CoupledCorridorPrefetch(
+                    routes, diagnostics, probe_elapsed + used, int(diagnostics["iterations"])
+                )
+            if self.verbose:
+                print(
+                    f"  [coupled-batch] {len(searched)} corridor searches in one call: "
+                    f"{sum(routes is not None for routes, _ in results)} committed "
+                    f"in {batch_elapsed:.2f}s"
+                )
+
+    def _coupled_corridor(
+        self, spec: CoupledSegmentSpec, guide_route: Route, spacing_cells: int
+    ) -> frozenset[tuple[int, int]]:
+        """Corridor mask for ``spec``'s coupled search around ``guide_route``."""
+        grid = self.autorouter.grid
+        resolution = grid.resolution
+        start_spacing_cells = (
+            math.dist((spec.p_start.x, spec.p_start.y), (spec.n_start.x, spec.n_start.y))
+            / resolution
+        )
+        end_spacing_cells = (
+            math.dist((spec.p_end.x, spec.p_end.y), (spec.n_end.x, spec.n_end.y)) / resolution
         )
+        # The corridor must admit the N trace alongside the guide path at
+        # the WIDEST spacing the run will see (start/end pad pitch can
+        # exceed the target), plus maneuvering slack for local detours.
+        corridor_radius = int(
+            math.ceil(max(spacing_cells, start_spacing_cells, end_spacing_cells))
+        ) + max(6, spacing_cells)
+        return build_corridor_mask(
+            grid,
+            guide_route,
+            corridor_radius,
+            extra_cells=(
+                grid.world_to_grid(spec.p_start.x, spec.p_start.y),
+                grid.world_to_grid(spec.p_end.x, spec.p_end.y),
+                grid.world_to_grid(spec.n_start.x, spec.n_start.y),
+                grid.world_to_grid(spec.n_end.x, spec.n_end.y),
+            ),
+        )
+
+    def _coupled_routes_clear(
+        self, pathfinder: CoupledPathfinder, routes: tuple[Route, Route]
+    ) -> bool:
+        """True when the cells under every segment of ``routes`` are still legal.
+
+        A prefetched batch path was searched before the serial loop marked
+        the copper committed ahead of it; anything the batch did not see
+        (a pair from another spacing group, a re-searched pair) shows up
+        here as a blocked cell.
+        """
+        grid = self.autorouter.grid
+        for route in routes:
+            for seg in route.segments:
+                layer_idx = grid.layer_to_index(seg.layer.value)
+                if not self._segment_cells_clear(
+                    pathfinder, seg.x1, seg.y1, seg.x2, seg.y2, layer_idx, route.net
+                ):
+                    return False
+        return True
+
+    def route_differential_pair_coupled(
+        self,
+        pair: DifferentialPair,
+        spacing: float | None = None,
+        coupled_only: bool = False,
+        extra_spacing_cells: int = 0,
+        per_pair_timeout: float | None = None,
+        per_pair_max_iterations: int | None = None,
+    ) -> tuple[list[Route], LengthMismatchWarning | None]:
+        """Route a differential pair using coupled pathfinding.
+
+        Routes both P and N traces simultaneously while maintaining
+        constant spacing between them.
+
+        Args:
+            pair: The differential pair to route.
+            spacing: Optional spacing override.
+            coupled_only: Issue #2464: When True, do not fall back to
+                independent routing if the coupled pathfinder cannot
+                handle the pair (e.g., 3-pad nets, no path found).
+                Returns ``([], None)`` instead.  Used by the diff-pair
+                pre-pass so that pairs that cannot be coupled are left
+                for the main strategy to route normally.
+            extra_spacing_cells: Issue #3040 Phase B: additional grid
+                cells to add to both the target ``spacing_cells`` and
+                ``min_spacing_cells`` floor passed to the
+                :class:`CoupledPathfinder`.  Used by the Phase B repair
+                pass to widen the search's spacing target on retry when
+                the first attempt produced an intra-pair clearance
+                violation due to grid quantisation.  Each additional
+                cell adds one ``grid.resolution`` of edge-to-edge
+                separation, which is normally enough to push the
+                routed clearance above the per-pair threshold.
+                Default ``0`` preserves legacy behaviour.
+            per_pair_timeout: Issue #3089: Optional wall-clock budget
+                (seconds) passed through to
+                :meth:`CoupledPathfinder.route_coupled` for each
+                coupled-segment search this pair triggers.  ``None``
+                preserves the legacy unbounded behaviour.  When the
+                budget is exceeded the coupled search returns ``None``
+                and this method falls through to the same
+                "coupled routing failed" handler used for genuine
+                no-path-found results (independent routing fallback
+                when ``coupled_only=False``; ``([], None)`` return
+                otherwise), so callers do not need a separate
+                code-path for budget exits.
+        """
+        # Issue #3089: reset the budget-exit flag at the start of each
+        # call so callers see only the most-recent invocation's state.
+        self._last_pair_budget_exit = False
+
+        if pair.rules is None:
+            return [], None
+
+        if spacing is None:
+            spacing = pair.rules.spacing
+
+        print(f"\n  Routing differential pair {pair} (coupled mode)")
+        print(f"    Type: {pair.pair_type.value}")
+        print(f"    Spacing: {spacing}mm, Max delta: {pair.rules.max_length_delta}mm")
+
+        # Get pads
+        pad_result = self._get_pair_pads(pair)
+        if pad_result is None:
+            print("    ERROR: Could not find pads for differential pair")
+            return [], None
+
+        p_pads, n_pads = pad_result
+
+        coupled_specs, stub_specs = self._coupled_segment_specs(p_pads, n_pads)
+
+        if not coupled_specs:
+            if coupled_only:
+                print(
+                    "    Skipping diff-pair pre-pass: complex pad configuration "
+                    "(coupled pathfinder could not pair pads)"
+                )
+                return [], None
+            print("    WARNING: Complex pad configuration, falling back to independent routing")
+            return self.route_differential_pair_independent(pair, spacing)
+
+        spacing_cells, min_spacing_cells, pair_intra_clearance = self._coupled_spacing(
+            pair, spacing, extra_spacing_cells
+        )
+
+        # If any segment requires polarity-swap, enable swap-via moves.
+        #
+        # Issue #3508: swap-via moves are DISABLED.  The swap move
+        # exchanges the two heads' exact grid positions onto one shared
+        # new layer, so reconstruction emits the SAME A->B segment for
+        # both nets (P: A->B, N: B->A) -- coincident copper, i.e. a
+        # short.  Every swap-containing result was therefore rejected
+        # by the #3320 severe-overlap gate at exactly
+        # ``-trace_width`` (board 06 PCIE/USB3, board 07 DQS -- the
+        # "swap-overlap gate" rejection documented in #3473).  With
+        # mid-route asymmetric moves now enabled (this issue), a
+        # polarity swap is achievable WITHOUT vias: the advancing
+        # trace walks a discrete arc around its holding partner
+        # (offset-vector rotation through 180 degrees), which the
+        # trail-proximity guard keeps clearance-legal.  Re-enable only
+        # after the swap reconstruction emits a genuine two-layer
+        # crossover (staggered vias, partner segments on different
+        # layers).
+        any_polarity_swap = any(s.polarity_swap for s in coupled_specs)
+        del any_polarity_swap  # documented above; swap moves disabled
+
+        per_pair_max_iterations = self._coupled_iteration_budget(per_pair_max_iterations)
+        pathfinder = self._new_coupled_pathfinder(spacing_cells, min_spacing_cells)
+
+        # A multi-pair flow may already have run this pair's probe and
+        # corridor search in ``_prefetch_coupled_batch`` (one-spec pairs at
+        # the base spacing).
+        prefetched: CoupledCorridorPrefetch | None = None
+        if len(coupled_specs) == 1 and extra_spacing_cells <= 0:
+            prefetched = self._batch_coupled_results.pop(pair.name, None)
 
         routes: list[Route] = []
         p_routes: list[Route] = []
@@ -5288,6 +5653,25 @@ class DiffPairRouter:
             # budget -- the 4000+4000 double-spend on board 06).
             corridor_iterations_used = 0
 
+            if prefetched is not None and prefetched.routes is not None:
+                if self._coupled_routes_clear(pathfinder, prefetched.routes):
+                    result = prefetched.routes
+                    coupled_phase = "batch"
+                    pathfinder._record_cpp_diagnostics(prefetched.diagnostics)
+                else:
+                    if self.verbose:
+                        print("    [coupled-batch] prefetched path is blocked now; re-searching")
+                    prefetched = None
+            elif prefetched is not None:
+                # The batch already ran this pair's probe (and its corridor
+                # search, when the probe found a guide) without landing it:
+                # charge that to the pair and go straight to the open search
+                # on the remaining budget.
+                spec_t0 -= prefetched.elapsed
+                corridor_iterations_used = prefetched.iterations
+                if prefetched.diagnostics is not None:
+                    pathfinder._record_cpp_diagnostics(prefetched.diagnostics)
+
             # Issue #3473: bound the probe.  It is only a guide route;
             # give it a small slice of the corridor half-budget (an
             # eighth of the per-pair budget, e.g. 7.5s of 60s).  If
@@ -5325,16 +5709,18 @@ class DiffPairRouter:
                 probe_timeout = min(_SHADOW_PER_PAIR_BUDGET_S, per_pair_timeout)
             else:
                 probe_timeout = per_pair_timeout * 0.125
-            probe_t0 = time.monotonic()
-            guide_route = self._single_ended_guide_route(
-                spec.p_start, spec.p_end, per_net_timeout=probe_timeout
-            )
-            print(
-                f"    [corridor-probe] guide_route="
-                f"{'ok' if guide_route is not None and guide_route.segments else 'FAILED'} "
-                f"elapsed={time.monotonic() - probe_t0:.2f}s "
-                f"segments={len(guide_route.segments) if guide_route is not None else 0}"
-            )
+            guide_route = None
+            if result is None and prefetched is None:
+                probe_t0 = time.monotonic()
+                guide_route = self._single_ended_guide_route(
+                    spec.p_start, spec.p_end, per_net_timeout=probe_timeout
+                )
+                print(
+                    f"    [corridor-probe] guide_route="
+                    f"{'ok' if guide_route is not None and guide_route.segments else 'FAILED'} "
+                    f"elapsed={time.monotonic() - probe_t0:.2f}s "
+                    f"segments={len(guide_route.segments) if guide_route is not None else 0}"
+                )
             # Issue #3508: geometric shadow construction FIRST.  When
             # the guide exists, building N as a validated parallel
             # offset of the guide is deterministic, takes milliseconds,
@@ -5419,40 +5805,7 @@ class DiffPairRouter:
                 and guide_route is not None
                 and guide_route.segments
             ):
-                grid = self.autorouter.grid
-                resolution = grid.resolution
-                start_spacing_cells = (
-                    math.dist(
-                        (spec.p_start.x, spec.p_start.y),
-                        (spec.n_start.x, spec.n_start.y),
-                    )
-                    / resolution
-                )
-                end_spacing_cells = (
-                    math.dist(
-                        (spec.p_end.x, spec.p_end.y),
-                        (spec.n_end.x, spec.n_end.y),
-                    )
-                    / resolution
-                )
-                # The corridor must admit the N trace alongside the
-                # guide path at the WIDEST spacing the run will see
-                # (start/end pad pitch can exceed the target), plus
-                # maneuvering slack for local detours.
-                corridor_radius = int(
-                    math.ceil(max(spacing_cells, start_spacing_cells, end_spacing_cells))
-                ) + max(6, spacing_cells)
-                corridor = build_corridor_mask(
-                    grid,
-                    guide_route,
-                    corridor_radius,
-                    extra_cells=(
-                        grid.world_to_grid(spec.p_start.x, spec.p_start.y),
-                        grid.world_to_grid(spec.p_end.x, spec.p_end.y),
-                        grid.world_to_grid(spec.n_start.x, spec.n_start.y),
-                        grid.world_to_grid(spec.n_end.x, spec.n_end.y),
-                    ),
-                )
+                corridor = self._coupled_corridor(spec, guide_route, spacing_cells)
                 # Half the per-pair budget for probe + corridor
                 # attempt combined; the rest is reserved for the
                 # open-search fallback so a corridor pathology can
@@ -6823,6 +7176,7 @@ class DiffPairRouter:
     def route_diffpair_prepass(
         self,
         diffpair_config: DifferentialPairConfig | None = None,
+        verbose: bool = True,
     ) -> tuple[list[Route], list[LengthMismatchWarning], set[int]]:
         """Route only the differential pairs, leaving other nets to a follow-up strategy.
 
@@ -6835,6 +7189,7 @@ class DiffPairRouter:
         Args:
             diffpair_config: Configuration for diff-pair routing.  If None
                 or ``enabled`` is False, this method is a no-op.
+            verbose: Print the coupled-batch progress lines.
 
         Returns:
             ``(routes, warnings, diff_net_ids)`` where:
@@ -6868,6 +7223,13 @@ class DiffPairRouter:
         warnings: list[LengthMismatchWarning] = []
         routed_net_ids: set[int] = set()
 
+        self.verbose = verbose
+        self._prefetch_coupled_batch(
+            [p for p in diff_pairs if self._resolve_engagement(p)[0]],
+            diffpair_config.spacing,
+            per_pair_timeout=None,
+            per_pair_max_iterations=None,
+        )
         for pair in diff_pairs:
             p_id, n_id = pair.get_net_ids()
             # Issue #2638, Epic #2556 Phase 2E: engagement gate.  When the
@@ -6907,6 +7269,7 @@ class DiffPairRouter:
             all_routes.extend(pair_routes)
             if warning:
                 warnings.append(warning)
+        self._batch_coupled_results = {}
 
         unrouted_pairs = [p for p in diff_pairs if p.get_net_ids()[0] not in routed_net_ids]
         if all_routes:
@@ -6932,6 +7295,7 @@ class DiffPairRouter:
         per_pair_timeout: float | None = None,
         per_pair_max_iterations: int | None = None,
         aggregate_timeout: float | None = None,
+        verbose: bool = True,
     ) -> tuple[list[Route], list[LengthMismatchWarning]]:
         """Route all nets with differential pair-aware routing.
 
@@ -6981,7 +7345,9 @@ class DiffPairRouter:
                 defers to the config value, and if that is also
                 ``None`` the legacy per-pair-only behaviour is
                 preserved.
+            verbose: Print the coupled-batch progress lines.
         """
+        self.verbose = verbose
         # Issue #3089: prefer the explicit kwarg, otherwise fall back to
         # the config field so callers configuring everything via
         # ``DifferentialPairConfig(per_pair_timeout=60.0)`` work without
@@ -7004,6 +7370,7 @@ class DiffPairRouter:
             self.enable_shadow_construction = bool(
                 getattr(diffpair_config, "enable_shadow_construction", False)
             )
+            self.distance_heuristic = bool(getattr(diffpair_config, "distance_heuristic", False))
         # Issue #4095: reset the budget-exit surface + instrumentation
         # counters up front (before any early return) so they always
         # describe only the latest invocation and never leak stale data
@@ -7068,6 +7435,22 @@ class DiffPairRouter:
         if effective_aggregate_timeout is not None and effective_aggregate_timeout > 0:
             coupled_phase_deadline = time.monotonic() + float(effective_aggregate_timeout)
         aggregate_deferred_pairs = 0
+        # Run the corridor-phase searches of every engaged pair in one native
+        # batch up front; the loop below consumes the outcomes pair by pair
+        # and runs the open search only where the corridor attempt failed.
+        batch_timeout = effective_per_pair_timeout
+        if coupled_phase_deadline is not None:
+            batch_timeout = min(
+                batch_timeout if batch_timeout is not None else float("inf"),
+                float(effective_aggregate_timeout),
+            )
+        self._prefetch_coupled_batch(
+            [p for p in diff_pairs if self._resolve_engagement(p)[0]],
+            diffpair_config.spacing,
+            per_pair_timeout=batch_timeout,
+            per_pair_max_iterations=effective_per_pair_max_iterations,
+            deadline=coupled_phase_deadline,
+        )
         for pair in diff_pairs:
             p_id, n_id = pair.get_net_ids()
             # Issue #2638, Epic #2556 Phase 2E: engagement gate.  Refuse
@@ -7170,6 +7553,8 @@ class DiffPairRouter:
             if warning:
                 warnings.append(warning)
 
+        self._batch_coupled_results = {}
+
         if aggregate_deferred_pairs:
             print(
                 f"  [diffpair-aggregate] deferred {aggregate_deferred_pairs} "
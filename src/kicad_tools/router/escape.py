@@ -212,6 +212,8 @@ class EscapeRoute:
         segments: Trace segments for the escape
         via: Via object if layer change needed
         ring_index: For BGA, which ring this pad is in (0=outer)
+        native_stub: ``router_cpp.EscapeStub`` when the stub was planned by
+            :class:`~kicad_tools.router.cpp_backend.CppEscapePlanner`
     """
 
     pad: Pad
@@ -222,6 +224,7 @@ class EscapeRoute:
     segments: list[Segment] = field(default_factory=list)
     via: Via | None = None
     ring_index: int = 0
+    native_stub: object | None = None
 
 
 @dataclass
@@ -1501,6 +1504,12 @@ class EscapeRouter:
                     exc,
                 )
 
+        # Native package fanout (``CppEscapePlanner``), built lazily against
+        # the C++ grid attached to ``self.grid``.  ``KCT_ESCAPE_CPP=0`` keeps
+        # the Python generators.
+        self._native_escape_planner = None
+        self.use_native_escape: bool = _os.environ.get("KCT_ESCAPE_CPP", "1") != "0"
+
     def _get_trace_width_for_net(self, net_name: str) -> float:
         """Get the trace width for a net based on its net class.
 
@@ -3244,6 +3253,10 @@ class EscapeRouter:
         # in ``_escape_qfp_alternating`` (Issue #2513).
         routable_pads = [p for p in package.pads if p.net != 0]
 
+        native = self._escape_native(package, routable_pads, "ring")
+        if native is not None:
+            return native
+
         # Group pads by ring (distance from center)
         rings = self._group_pads_by_ring(routable_pads, center_x, center_y)
 
@@ -3265,6 +3278,151 @@ class EscapeRouter:
 
         return escapes
 
+    def _native_planner(self):
+        """``CppEscapePlanner`` over the attached C++ grid, or None.
+
+        None when disabled (``KCT_ESCAPE_CPP=0``), when the C++ backend is
+        not built, or when no ``CppGrid`` mirrors ``self.grid`` yet.
+        """
+        if not self.use_native_escape:
+            return None
+        cpp_grid = getattr(self.grid, "_cpp_grid", None)
+        if cpp_grid is None:
+            return None
+        from .cpp_backend import CppEscapePlanner, is_cpp_available
+
+        if not is_cpp_available():
+            return None
+        planner = self._native_escape_planner
+        if planner is None or planner.grid is not cpp_grid:
+            planner = CppEscapePlanner(
+                cpp_grid,
+                self.rules,
+                escape_clearance=self.escape_clearance,
+                via_spacing=self.via_spacing,
+            )
+            self._native_escape_planner = planner
+        return planner
+
+    def _escape_native(
+        self, package: PackageInfo, routable_pads: list[Pad], pattern: str
+    ) -> list[EscapeRoute] | None:
+        """Plan a package fanout natively (see ``cpp/include/escape.hpp``).
+
+        ``pattern`` is ``"ring"`` (BGA) or ``"alternating"`` (QFP/QFN).
+        Unlike the Python generators, every returned stub already clears
+        the board and the package's other stubs; pins without a legal stub
+        get no escape and are routed from the pad by the main router.
+
+        Returns:
+            Escape routes outer ring first, or None to use the Python path.
+        """
+        planner = self._native_planner()
+        if planner is None or not routable_pads:
+            return None
+        if any(p.through_hole for p in routable_pads):
+            return None
+        layers = {p.layer for p in routable_pads}
+        if len(layers) != 1:
+            return None
+        surface = self.grid.layer_to_index(next(iter(layers)).value)
+        inner = [i for i in self.grid.get_routable_indices() if i != surface]
+        if not inner:
+            return None
+
+        # Stubs are checked against the stored routes, so bring them up to
+        # date with everything committed on the Python grid.
+        planner.grid.sync_stored_routes(self.grid)
+        pins = [(p.x, p.y, p.width, p.height, p.net, surface) for p in routable_pads]
+        stubs = planner.plan(pins, pattern, inner)
+
+        from .cpp_backend import router_cpp
+
+        directions = {
+            (0, 1): EscapeDirection.NORTH,
+            (0, -1): EscapeDirection.SOUTH,
+            (1, 0): EscapeDirection.EAST,
+            (-1, 0): EscapeDirection.WEST,
+        }
+        escapes: list[EscapeRoute] = []
+        for stub in stubs:
+            if stub.status != router_cpp.ESCAPE_OK:
+                continue
+            pad = routable_pads[stub.pin]
+            escape_layer = Layer(self.grid.index_to_layer(stub.escape_layer))
+            segments = [
+                Segment(
+                    x1=seg.x1,
+                    y1=seg.y1,
+                    x2=seg.x2,
+                    y2=seg.y2,
+                    width=seg.width,
+                    layer=Layer(self.grid.index_to_layer(seg.layer)),
+                    net=pad.net,
+                    net_name=pad.net_name,
+                )
+                for seg in stub.segments
+            ]
+            via = None
+            if stub.has_via:
+                via = Via(
+                    x=stub.via.x,
+                    y=stub.via.y,
+                    drill=stub.via.drill,
+                    diameter=stub.via.diameter,
+                    layers=(pad.layer, escape_layer),
+                    net=pad.net,
+                    net_name=pad.net_name,
+                )
+            escapes.append(
+                EscapeRoute(
+                    pad=pad,
+                    direction=directions.get(
+                        (round(stub.dir_x), round(stub.dir_y)), EscapeDirection.VIA_DOWN
+                    ),
+                    escape_point=(stub.escape_x, stub.escape_y),
+                    escape_layer=escape_layer,
+                    via_pos=(via.x, via.y) if via else None,
+                    segments=segments,
+                    via=via,
+                    ring_index=stub.ring,
+                    native_stub=stub,
+                )
+            )
+        escapes.sort(key=lambda e: e.ring_index)
+        logger.debug(
+            "Native %s escape %s: %d/%d pins escaped (%d candidates checked)",
+            pattern,
+            package.ref,
+            len(escapes),
+            len(routable_pads),
+            planner.last_candidates,
+        )
+        return escapes
+
+    def _commit_native_escapes(self, escapes: list[EscapeRoute]) -> None:
+        """Mark natively planned escapes on the C++ grid.
+
+        ``grid.mark_route`` only updates the Python grid; the planner marks
+        the same stubs on the C++ cells.  Stored geometry arrives through
+        the next ``sync_stored_routes`` and the corridor reservations go
+        through ``reserve_corridor_cells`` so both grids agree.
+        """
+        planner = self._native_escape_planner
+        if planner is None or planner.grid is not getattr(self.grid, "_cpp_grid", None):
+            return
+        native = [e for e in escapes if e.native_stub is not None]
+        if not native:
+            return
+        stubs = [e.native_stub for e in native]
+        planner.commit(stubs, store_geometry=False, reserve=False)
+        for escape, stub in zip(native, stubs, strict=True):
+            cells = planner.corridor_cells(stub)
+            if cells:
+                self.grid.reserve_corridor_cells(
+                    stub.escape_layer, cells, [escape.pad.net], soft=True
+                )
+
     def _group_pads_by_ring(
         self,
         pads: list[Pad],
@@ -3547,6 +3705,20 @@ class EscapeRouter:
             package.pin_pitch <= in_pad_pitch_ceiling and not self.via_in_pad_supported
         )
 
+        # The native planner covers the plain alternating scheme; the
+        # perpendicular-only and via-in-pad rescue variants stay in Python.
+        if not use_perpendicular_only and not try_in_pad_fallback:
+            edge_pads = north_pads + south_pads + east_pads + west_pads
+            native = self._escape_native(package, edge_pads, "alternating")
+            if native is not None:
+                if wants_in_pad_but_unavailable and len(native) < len(edge_pads):
+                    # Pins left without a legal stub are the ones an in-pad
+                    # via would have rescued.
+                    self.missed_via_in_pad_rescues += len(edge_pads) - len(native)
+                    if package.ref:
+                        self.missed_via_in_pad_components.add(package.ref)
+                return native
+
         # Effective clearance and escape width for the in-pad rescue
         # fallback.  We mirror the values used inside
         # ``_create_fine_pitch_row_escapes`` so the in-pad routes are
@@ -8640,6 +8812,7 @@ class EscapeRouter:
                 "hard intersection with foreign-net via (Issue #2998)",
                 skipped_seg_vs_via,
             )
+        self._commit_native_escapes(committed_escapes)
 
         return routes
 
@@ -21,7 +21,9 @@ per copper layer:
 
 from __future__ import annotations
 
+import os
 from collections import defaultdict
+from functools import cached_property
 
 from ..primitives import Pad
 from .geometry import (
@@ -106,7 +108,18 @@ class LatticeObstacleModel:
                     self._pad_buckets[(ix, iy)].append(idx)
 
         # node_pads[L][key] / edge_pads[L][edge] -> pad indices whose keep-out
-        # covers that resource on layer L.
+        # covers that resource on layer L.  With the native lattice the masks
+        # live there and the predicates query it; the dicts are mirrored only
+        # on first read.
+        self._native = lattice.native
+        if self._native is not None:
+            self._native.set_pads(
+                [tuple(r) for r in self.pad_rects],
+                [pad.net for pad in self.pads],
+                [list(layers) for layers in self.pad_layer_indices],
+                self.num_layers,
+            )
+            return
         self.node_pads: list[dict[NodeKey, list[int]]] = [{} for _ in range(num_layers)]
         self.edge_pads: list[dict[EdgeKey, list[int]]] = [{} for _ in range(num_layers)]
         for key, point in lattice.nodes.items():
@@ -124,6 +137,24 @@ class LatticeObstacleModel:
                     for layer in pad_layer_indices[idx]:
                         self.edge_pads[layer].setdefault(edge, []).append(idx)
 
+    @cached_property
+    def node_pads(self) -> list[dict[NodeKey, list[int]]]:
+        nodes = self.lattice.node_list
+        out: list[dict[NodeKey, list[int]]] = [{} for _ in range(self.num_layers)]
+        for layer, pairs in enumerate(self._native.node_pad_pairs()):
+            for node, idx in pairs:
+                out[layer].setdefault(nodes[node], []).append(idx)
+        return out
+
+    @cached_property
+    def edge_pads(self) -> list[dict[EdgeKey, list[int]]]:
+        edges = self.lattice.edge_list
+        out: list[dict[EdgeKey, list[int]]] = [{} for _ in range(self.num_layers)]
+        for layer, pairs in enumerate(self._native.edge_pad_pairs()):
+            for edge, idx in pairs:
+                out[layer].setdefault(edges[edge], []).append(idx)
+        return out
+
     # -- queries -------------------------------------------------------------
 
     def pads_near(self, x0: float, y0: float, x1: float, y1: float) -> set[int]:
@@ -136,10 +167,16 @@ class LatticeObstacleModel:
 
     def node_blocked(self, key: NodeKey, layer: int, net: int) -> bool:
         """True if the node sits in an OTHER-net pad keep-out on ``layer``."""
+        if self._native is not None:
+            node = self._native.node_index(key)
+            return node >= 0 and self._native.node_blocked(node, layer, net)
         return any(self.pads[idx].net != net for idx in self.node_pads[layer].get(key, ()))
 
     def edge_blocked(self, edge: EdgeKey, layer: int, net: int) -> bool:
         """True if the edge crosses an OTHER-net pad keep-out on ``layer``."""
+        if self._native is not None:
+            index = self._native.edge_index(edge[0], edge[1])
+            return index >= 0 and self._native.edge_blocked(index, layer, net)
         return any(self.pads[idx].net != net for idx in self.edge_pads[layer].get(edge, ()))
 
     def segment_blocked(self, a: Pt, b: Pt, layer: int, net: int, extra: float = 0.0) -> bool:
@@ -167,6 +204,26 @@ class LatticeObstacleModel:
         return False
 
 
+def _native_copper(
+    num_layers: int,
+    trace_half: float,
+    clearance: float,
+    via_radius: float,
+    via_via_gap: float,
+    same_net_via_gap: float,
+):
+    """Build the ``router_cpp.LatticeCopper`` twin, or ``None`` when unavailable."""
+    if os.environ.get("KCT_LATTICE_CPP", "1") == "0":
+        return None
+    from ..cpp_backend import is_cpp_available, router_cpp
+
+    if not is_cpp_available() or not hasattr(router_cpp, "LatticeCopper"):
+        return None
+    return router_cpp.LatticeCopper(
+        num_layers, trace_half, clearance, via_radius, via_via_gap, same_net_via_gap
+    )
+
+
 class CommittedCopper:
     """Copper committed by already-routed nets in one negotiation pass.
 
@@ -207,6 +264,12 @@ class CommittedCopper:
         self.same_net_via_gap = same_net_via_gap  # hole-to-hole floor
         self.copper: list[SegHash] = [SegHash() for _ in range(num_layers)]
         self.vias: list[tuple[Pt, int]] = []
+        # Native twin read by the lattice A* (issue #4278); every mutation
+        # below is mirrored into it.  The Python tables stay authoritative
+        # for the coupled (fat-agent) predicates, which read them directly.
+        self.native = _native_copper(
+            num_layers, trace_half, clearance, via_radius, via_via_gap, same_net_via_gap
+        )
 
     # -- mutation --------------------------------------------------------
 
@@ -224,6 +287,8 @@ class CommittedCopper:
         for a, b in zip(points, points[1:], strict=False):
             if dist(a, b) > 1e-9:
                 self.copper[layer].add(a, b, net, half_width, clr)
+        if self.native is not None:
+            self.native.add_run(layer, points, net, half_width, clr)
 
     def add_run_widths(
         self,
@@ -246,10 +311,14 @@ class CommittedCopper:
         for (a, b), hw in zip(zip(points, points[1:], strict=False), seg_halves, strict=False):
             if dist(a, b) > 1e-9:
                 self.copper[layer].add(a, b, net, hw, clr)
+        if self.native is not None:
+            self.native.add_run_widths(layer, points, net, seg_halves, clr)
 
     def add_via(self, point: Pt, net: int) -> None:
         """Commit a through-via (blocks the site on ALL layers)."""
         self.vias.append((point, net))
+        if self.native is not None:
+            self.native.add_via(point, net)
 
     # -- predicates --------------------------------------------------------
 
@@ -550,13 +550,7 @@ class LatticePathfinder:
             )
         extra = max(0.0, half + clr - self._agent_radius)
 
-        candidates: list[tuple[float, NodeKey, Pt]] = []
-        pad_pt = (pad.x, pad.y)
-        for key, point in lattice.nodes.items():
-            d = dist(point, pad_pt)
-            if d <= search_radius:
-                candidates.append((d, key, point))
-        candidates.sort()
+        candidates = lattice.nodes_within((pad.x, pad.y), search_radius)
 
         out: list[tuple[NodeKey, int, list[Pt], float]] = []
         for _d, key, point in candidates:
@@ -788,6 +782,64 @@ class LatticePathfinder:
                 return False
         return committed.via_clear(point, net)
 
+    def _native_astar(
+        self,
+        lattice: OctilinearLattice,
+        starts: dict[_State, float],
+        goal: dict[_State, tuple[float, list[Pt]]],
+        end_pt: Pt,
+        net: int,
+        half: float,
+        clr: float,
+        extra: float,
+        committed: CommittedCopper,
+        history: dict[Resource, float],
+        present: float,
+        allow_vias: bool,
+    ) -> tuple[list[_State], list[str]] | None:
+        """Run the non-fat (node, layer) A* in the native lattice (#4278).
+
+        Same search as the Python loop in :meth:`_route_impl` -- same costs,
+        tolerances and tie-breaking -- over node / edge indices.  Via
+        legality stays :meth:`_via_ok` (pad-geometry rules), called back per
+        node.  Returns the ``(chain, moves)`` reconstruction, or ``None``.
+        """
+        native = lattice.native
+        edge_history: list[tuple[int, int, float]] = []
+        via_history: list[tuple[int, float]] = []
+        if present:
+            for resource, value in history.items():
+                if resource[0] == "e":
+                    e = native.edge_index(*resource[1])  # type: ignore[misc]
+                    if e >= 0:
+                        edge_history.append((e, resource[2], value))  # type: ignore[arg-type]
+                elif resource[0] == "v":
+                    n = native.node_index(resource[1])
+                    if n >= 0:
+                        via_history.append((n, value))
+        found = native.astar(
+            [(native.node_index(key), layer, length) for (key, layer), length in starts.items()],
+            [(native.node_index(key), layer, stub[0]) for (key, layer), stub in goal.items()],
+            end_pt,
+            net,
+            half,
+            clr,
+            extra,
+            committed.native,
+            edge_history,
+            via_history,
+            present,
+            allow_vias,
+            self.num_layers,
+            self.via_cost,
+            lambda n: self._via_ok(native.node_key(n), net, committed),
+        )
+        if found is None:
+            return None
+        keys, layers, moves = found
+        chain = [(native.node_key(n), layer) for n, layer in zip(keys, layers, strict=True)]
+        return chain, list(moves)
+
     # -- the route contract ------------------------------------------------------
 
     def route(
@@ -920,132 +972,154 @@ class LatticePathfinder:
                 heapq.heappush(heap, (length + h(key), counter, state))
                 counter += 1
 
-        edge_ok: dict[tuple[EdgeKey, int], bool] = {}
-        node_ok: dict[_State, bool] = {}
-        via_ok: dict[NodeKey, bool] = {}
-        end_state: _State | None = None
-
-        while heap:
-            f, _c, state = heapq.heappop(heap)
-            if state == _GOAL:
-                end_state = came[_GOAL][0]
-                break
-            key, layer = state
-            g = g_score.get(state, math.inf)
-            if f > g + h(key) + 1e-9:
-                continue  # stale heap entry
-            if state in goal:
-                total = g + goal[state][0]
-                if total < g_score.get(_GOAL, math.inf) - 1e-12:
-                    g_score[_GOAL] = total
-                    came[_GOAL] = (state, "arrive")
-                    heapq.heappush(heap, (total, counter, _GOAL))
-                    counter += 1
-            for nbr, elen in lattice.adj.get(key, ()):
-                edge = (min(key, nbr), max(key, nbr))
-                ek = (edge, layer)
-                ok = edge_ok.get(ek)
-                if ok is None:
-                    if fat:
-                        pa = lattice.node_point(edge[0])
-                        pb = lattice.node_point(edge[1])
-                        ok = not pads_block_segment_grown(
-                            obstacles, pa, pb, layer, pair_nets, extra_clearance, exempt_pads
-                        ) and committed_seg_clear_grown(
-                            committed, pa, pb, layer, pair_nets, extra_clearance
-                        )
-                    else:
-                        ea = lattice.node_point(edge[0])
-                        eb = lattice.node_point(edge[1])
-                        ok = (
-                            not obstacles.edge_blocked(edge, layer, net)
-                            and not (
-                                extra > 0.0 and obstacles.segment_blocked(ea, eb, layer, net, extra)
+        if not fat and lattice.native is not None and committed.native is not None:
+            # Issue #4278: the non-fat search runs in the native lattice.
+            # Fat agents keep the Python loop (grown coupled predicates).
+            searched = self._native_astar(
+                lattice,
+                g_score,
+                goal,
+                end_pt,
+                net,
+                half,
+                clr,
+                extra,
+                committed,
+                history,
+                present,
+                allow_vias,
+            )
+            if searched is None:
+                return None, "no-path"
+            chain, moves = searched
+        else:
+            edge_ok: dict[tuple[EdgeKey, int], bool] = {}
+            node_ok: dict[_State, bool] = {}
+            via_ok: dict[NodeKey, bool] = {}
+            end_state: _State | None = None
+
+            while heap:
+                f, _c, state = heapq.heappop(heap)
+                if state == _GOAL:
+                    end_state = came[_GOAL][0]
+                    break
+                key, layer = state
+                g = g_score.get(state, math.inf)
+                if f > g + h(key) + 1e-9:
+                    continue  # stale heap entry
+                if state in goal:
+                    total = g + goal[state][0]
+                    if total < g_score.get(_GOAL, math.inf) - 1e-12:
+                        g_score[_GOAL] = total
+                        came[_GOAL] = (state, "arrive")
+                        heapq.heappush(heap, (total, counter, _GOAL))
+                        counter += 1
+                for nbr, elen in lattice.adj.get(key, ()):
+                    edge = (min(key, nbr), max(key, nbr))
+                    ek = (edge, layer)
+                    ok = edge_ok.get(ek)
+                    if ok is None:
+                        if fat:
+                            pa = lattice.node_point(edge[0])
+                            pb = lattice.node_point(edge[1])
+                            ok = not pads_block_segment_grown(
+                                obstacles, pa, pb, layer, pair_nets, extra_clearance, exempt_pads
+                            ) and committed_seg_clear_grown(
+                                committed, pa, pb, layer, pair_nets, extra_clearance
                             )
-                            and committed.seg_clear(ea, eb, layer, net, half, clr)
-                        )
-                    edge_ok[ek] = ok
-                if not ok:
-                    continue
-                nstate = (nbr, layer)
-                nok = node_ok.get(nstate)
-                if nok is None:
-                    if fat:
-                        npt = lattice.node_point(nbr)
-                        nok = not pads_block_point_grown(
-                            obstacles, npt, layer, pair_nets, extra_clearance, exempt_pads
-                        ) and committed_point_clear_grown(
-                            committed, npt, layer, pair_nets, extra_clearance
-                        )
-                    else:
-                        npt = lattice.node_point(nbr)
-                        nok = (
-                            not obstacles.node_blocked(nbr, layer, net)
-                            and not (
-                                extra > 0.0
-                                and obstacles.segment_blocked(npt, npt, layer, net, extra)
+                        else:
+                            ea = lattice.node_point(edge[0])
+                            eb = lattice.node_point(edge[1])
+                            ok = (
+                                not obstacles.edge_blocked(edge, layer, net)
+                                and not (
+                                    extra > 0.0
+                                    and obstacles.segment_blocked(ea, eb, layer, net, extra)
+                                )
+                                and committed.seg_clear(ea, eb, layer, net, half, clr)
                             )
-                            and committed.node_clear(npt, layer, net, half, clr)
-                        )
-                    node_ok[nstate] = nok
-                if not nok:
-                    continue
-                step = elen + present * history.get(("e", edge, layer), 0.0)
-                tentative = g + step
-                if tentative < g_score.get(nstate, math.inf) - 1e-12:
-                    g_score[nstate] = tentative
-                    came[nstate] = (state, "move")
-                    heapq.heappush(heap, (tentative + h(nbr), counter, nstate))
-                    counter += 1
-            if allow_vias and self.num_layers > 1:
-                vok = via_ok.get(key)
-                if vok is None:
-                    vok = self._via_ok(key, net, committed)
-                    via_ok[key] = vok
-                if vok:
-                    # Via edges join matching nodes on ADJACENT layers only
-                    # (issue #4278 acceptance 6).  The emitted via is still a
-                    # through-via; a multi-layer dip pays via_cost per hop.
-                    for nl in (layer - 1, layer + 1):
-                        if nl < 0 or nl >= self.num_layers:
-                            continue
-                        nstate = (key, nl)
-                        nok = node_ok.get(nstate)
-                        if nok is None:
-                            kpt = lattice.node_point(key)
+                        edge_ok[ek] = ok
+                    if not ok:
+                        continue
+                    nstate = (nbr, layer)
+                    nok = node_ok.get(nstate)
+                    if nok is None:
+                        if fat:
+                            npt = lattice.node_point(nbr)
+                            nok = not pads_block_point_grown(
+                                obstacles, npt, layer, pair_nets, extra_clearance, exempt_pads
+                            ) and committed_point_clear_grown(
+                                committed, npt, layer, pair_nets, extra_clearance
+                            )
+                        else:
+                            npt = lattice.node_point(nbr)
                             nok = (
-                                not obstacles.node_blocked(key, nl, net)
+                                not obstacles.node_blocked(nbr, layer, net)
                                 and not (
                                     extra > 0.0
-                                    and obstacles.segment_blocked(kpt, kpt, nl, net, extra)
+                                    and obstacles.segment_blocked(npt, npt, layer, net, extra)
                                 )
-                                and committed.node_clear(kpt, nl, net, half, clr)
+                                and committed.node_clear(npt, layer, net, half, clr)
                             )
-                            node_ok[nstate] = nok
-                        if not nok:
-                            continue
-                        step = self.via_cost + present * history.get(("v", key), 0.0)
-                        tentative = g + step
-                        if tentative < g_score.get(nstate, math.inf) - 1e-12:
-                            g_score[nstate] = tentative
-                            came[nstate] = (state, "via")
-                            heapq.heappush(heap, (tentative + h(key), counter, nstate))
-                            counter += 1
-
-        if end_state is None:
-            return None, "no-path"
-
-        # -- reconstruct ---------------------------------------------------
-        chain: list[_State] = [end_state]
-        moves: list[str] = []
-        cur = end_state
-        while cur in came:
-            prev, move = came[cur]
-            chain.append(prev)
-            moves.append(move)
-            cur = prev
-        chain.reverse()
-        moves.reverse()
+                        node_ok[nstate] = nok
+                    if not nok:
+                        continue
+                    step = elen + present * history.get(("e", edge, layer), 0.0)
+                    tentative = g + step
+                    if tentative < g_score.get(nstate, math.inf) - 1e-12:
+                        g_score[nstate] = tentative
+                        came[nstate] = (state, "move")
+                        heapq.heappush(heap, (tentative + h(nbr), counter, nstate))
+                        counter += 1
+                if allow_vias and self.num_layers > 1:
+                    vok = via_ok.get(key)
+                    if vok is None:
+                        vok = self._via_ok(key, net, committed)
+                        via_ok[key] = vok
+                    if vok:
+                        # Via edges join matching nodes on ADJACENT layers only
+                        # (issue #4278 acceptance 6).  The emitted via is still a
+                        # through-via; a multi-layer dip pays via_cost per hop.
+                        for nl in (layer - 1, layer + 1):
+                            if nl < 0 or nl >= self.num_layers:
+                                continue
+                            nstate = (key, nl)
+                            nok = node_ok.get(nstate)
+                            if nok is None:
+                                kpt = lattice.node_point(key)
+                                nok = (
+                                    not obstacles.node_blocked(key, nl, net)
+                                    and not (
+                                        extra > 0.0
+                                        and obstacles.segment_blocked(kpt, kpt, nl, net, extra)
+                                    )
+                                    and committed.node_clear(kpt, nl, net, half, clr)
+                                )
+                                node_ok[nstate] = nok
+                            if not nok:
+                                continue
+                            step = self.via_cost + present * history.get(("v", key), 0.0)
+                            tentative = g + step
+                            if tentative < g_score.get(nstate, math.inf) - 1e-12:
+                                g_score[nstate] = tentative
+                                came[nstate] = (state, "via")
+                                heapq.heappush(heap, (tentative + h(key), counter, nstate))
+                                counter += 1
+
+            if end_state is None:
+                return None, "no-path"
+
+            # -- reconstruct ---------------------------------------------------
+            chain: list[_State] = [end_state]
+            moves: list[str] = []
+            cur = end_state
+            while cur in came:
+                prev, move = came[cur]
+                chain.append(prev)
+                moves.append(move)
+                cur = prev
+            chain.reverse()
+            moves.reverse()
         start_state = chain[0]
 
         resources: set[Resource] = set()
@@ -1073,7 +1147,7 @@ class LatticePathfinder:
                 resources.add(("e", (min(prev_key, key), max(prev_key, key)), layer))
                 cur_pts.append(lattice.node_point(key))
                 cur_ws.append(body_w)
-        _stub_len, stub_b_poly = goal[end_state]
+        _stub_len, stub_b_poly = goal[chain[-1]]
         tail = list(reversed(stub_b_poly[:-1]))  # last node -> pad (exact)
         cur_pts.extend(tail)
         cur_ws.extend([width_b] * len(tail))
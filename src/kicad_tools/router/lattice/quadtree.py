@@ -23,13 +23,23 @@ its midpoint and the corner->midpoint sub-edges remain axis-aligned.
 Octilinearity survives refinement boundaries because of this invariant --
 it is property-tested before any routing test
 (``tests/router/lattice/test_quadtree_properties.py``).
+
+When the C++ backend is built, the quadtree, balance and graph build run in
+``router_cpp.OctilinearLattice`` (same leaves, node keys and edges); the
+native object is kept on :attr:`OctilinearLattice.native` for the pad masks,
+the lattice A* and the escape-stub node scan.  The Python graph attributes
+are then materialised from its flat arrays only on first read (the fat-agent
+A* walks ``adj``; tests and diagnostics read the rest).
+``KCT_LATTICE_CPP=0`` (or ``use_native=False``) forces the pure-Python build.
 """
 
 from __future__ import annotations
 
 import math
+import os
 from collections import defaultdict
 from dataclasses import dataclass
+from functools import cached_property
 
 from .geometry import Pt, Rect, dist, rects_overlap
 
@@ -63,6 +73,16 @@ class RefineRegion:
         return max(0, math.ceil(math.log2(coarse / self.fine) - 1e-9))
 
 
+def _native_lattice(bbox: Rect, regions: list[RefineRegion], coarse: float):
+    """Build the ``router_cpp.OctilinearLattice`` twin, or ``None`` when unavailable."""
+    from ..cpp_backend import is_cpp_available, router_cpp
+
+    if not is_cpp_available() or not hasattr(router_cpp, "OctilinearLattice"):
+        return None
+    native_regions = [router_cpp.RefineRegion(tuple(r.rect), r.fine) for r in regions]
+    return router_cpp.OctilinearLattice(tuple(bbox), native_regions, coarse)
+
+
 class OctilinearLattice:
     """Balanced quadtree lattice over a rectangular board region.
 
@@ -74,6 +94,9 @@ class OctilinearLattice:
         adj: node key -> list of ``(neighbor_key, edge_length)``.
         edges: set of undirected edges as ``(min_key, max_key)`` tuples.
         leaves: the balanced quadtree leaf cells (for tests/diagnostics).
+        native: the ``router_cpp.OctilinearLattice`` twin, or ``None`` on the
+            pure-Python build.  Its node / edge indices are positions in
+            :attr:`node_list` / :attr:`edge_list`.
     """
 
     def __init__(
@@ -82,6 +105,7 @@ class OctilinearLattice:
         refine_regions: list[RefineRegion],
         *,
         coarse: float = 3.2,
+        use_native: bool | None = None,
     ) -> None:
         if coarse <= 0:
             raise ValueError(f"coarse cell size must be positive, got {coarse}")
@@ -102,12 +126,75 @@ class OctilinearLattice:
             (r.rect, r.level_for(coarse)) for r in self.refine_regions
         ]
 
-        self.leaves: set[CellKey] = self._build_quadtree()
-        self._balance()
-        self.nodes: dict[NodeKey, Pt]
-        self.adj: dict[NodeKey, list[tuple[NodeKey, float]]]
-        self.edges: set[EdgeKey]
-        self.nodes, self.adj, self.edges = self._build_graph()
+        if use_native is None:
+            use_native = os.environ.get("KCT_LATTICE_CPP", "1") != "0"
+        self.native = (
+            _native_lattice(bbox, self.refine_regions, coarse) if use_native else None
+        )
+        if self.native is None:
+            # Pure-Python build: assigning the attributes shadows the lazy
+            # native mirrors below.
+            self.leaves = self._build_quadtree()
+            self._balance()
+            self.nodes, self.adj, self.edges = self._build_graph()
+            self.node_list = sorted(self.nodes)
+            self.edge_list = sorted(self.edges)
+
+    # -- graph attributes (lazy mirrors of the native arrays) ---------------
+
+    @cached_property
+    def leaves(self) -> set[CellKey]:
+        return {tuple(c) for c in self.native.leaves()}
+
+    @cached_property
+    def node_list(self) -> list[NodeKey]:
+        return [tuple(k) for k in self.native.node_keys()]
+
+    @cached_property
+    def nodes(self) -> dict[NodeKey, Pt]:
+        return {k: self.node_point(k) for k in self.node_list}
+
+    @cached_property
+    def edge_list(self) -> list[EdgeKey]:
+        keys = self.node_list
+        return [(keys[a], keys[b]) for a, b in self.native.edges()]
+
+    @cached_property
+    def edges(self) -> set[EdgeKey]:
+        return set(self.edge_list)
+
+    @cached_property
+    def adj(self) -> dict[NodeKey, list[tuple[NodeKey, float]]]:
+        # Native CSR order (edge list order, both directions), so the Python
+        # and native A* expand neighbours alike.
+        adj: dict[NodeKey, list[tuple[NodeKey, float]]] = defaultdict(list)
+        for (k1, k2), length in zip(self.edge_list, self.native.edge_lengths(), strict=True):
+            adj[k1].append((k2, length))
+            adj[k2].append((k1, length))
+        return dict(adj)
+
+    @cached_property
+    def node_index(self) -> dict[NodeKey, int]:
+        return {k: n for n, k in enumerate(self.node_list)}
+
+    @cached_property
+    def edge_index(self) -> dict[EdgeKey, int]:
+        return {e: n for n, e in enumerate(self.edge_list)}
+
+    def nodes_within(self, point: Pt, radius: float) -> list[tuple[float, NodeKey, Pt]]:
+        """``(distance, key, point)`` of every node within ``radius``, ascending."""
+        if self.native is not None:
+            return [
+                (d, (int(k[0]), int(k[1])), (p[0], p[1]))
+                for d, k, p in self.native.nodes_within(point, radius)
+            ]
+        out = []
+        for key, node_pt in self.nodes.items():
+            d = dist(node_pt, point)
+            if d <= radius:
+                out.append((d, key, node_pt))
+        out.sort()
+        return out
 
     # -- quadtree ----------------------------------------------------------
 
@@ -305,6 +392,8 @@ class OctilinearLattice:
         across the epic: 16 B coordinates + 8 B mask word per node per layer,
         plus 2 x (8 B index + 8 B length) per undirected edge per layer.
         """
-        n = len(self.nodes)
-        m = len(self.edges)
+        if self.native is not None:
+            n, m = self.native.num_nodes, self.native.num_edges
+        else:
+            n, m = len(self.nodes), len(self.edges)
         return n, m, n_layers * (n * (16 + 8) + m * 32)
@@ -155,6 +155,7 @@ Out of scope for Phase 2F:
 from __future__ import annotations
 
 import logging
+import os
 from collections import Counter
 from dataclasses import dataclass, field
 from typing import TYPE_CHECKING
@@ -172,6 +173,7 @@ from .optimizer.serpentine import (
 if TYPE_CHECKING:
     from collections.abc import Iterable
 
+    from .cpp_backend import CppGrid
     from .match_group_length import MatchGroup
     from .primitives import Pad, Route, Segment
 
@@ -275,6 +277,7 @@ TUNE_RESULT_REASONS: tuple[str, ...] = (
     "cascade_budget_exhausted",
     "post_insertion_drc_violation",
     "no_suitable_segment",
+    "partial_tune",
     "unrouted",
     "not_length_critical",
 )
@@ -294,6 +297,7 @@ REASON_SUMMARY_LABELS: dict[str, str] = {
     "longer_than_reference": "longer-than-ref",
     "unrouted": "unrouted",
     "no_suitable_segment": "no-segment",
+    "partial_tune": "partial",
 }
 
 #: Buckets that are ALWAYS printed (the legacy five) in canonical order.
@@ -308,12 +312,14 @@ _ALWAYS_SHOWN_BUCKETS: tuple[str, ...] = (
 #: Buckets printed only when non-zero, in canonical order.  These are
 #: the reason buckets that were previously counted by NOTHING (Issue
 #: #3440 root cause): ``reference`` / ``longer_than_reference`` /
-#: ``unrouted`` plus ``no_suitable_segment``.
+#: ``unrouted`` plus ``no_suitable_segment``; ``partial`` is the native
+#: tuner's short-of-tolerance outcome.
 _OPTIONAL_BUCKETS: tuple[str, ...] = (
     "reference",
     "longer-than-ref",
     "unrouted",
     "no-segment",
+    "partial",
 )
 
 
@@ -323,8 +329,8 @@ def format_reason_counts(reasons: Iterable[str]) -> str:
     Counts EVERY member: the five legacy buckets (``tuned`` / ``clean``
     / ``rolled back`` / ``budget-exhausted`` / ``skipped``) always
     appear; the remaining registered buckets (``reference``,
-    ``longer-than-ref``, ``unrouted``, ``no-segment``) appear when
-    non-zero; any UNREGISTERED reason value appears as
+    ``longer-than-ref``, ``unrouted``, ``no-segment``, ``partial``) appear
+    when non-zero; any UNREGISTERED reason value appears as
     ``N other(<reason>)`` so no member can ever fall into a silent
     bucket (Issue #3440 observability AC).
 
@@ -440,6 +446,9 @@ class TuneResult:
               made on this member.
             * ``"no_suitable_segment"`` -- the member has no segment
               long enough to host any trombone amplitude.
+            * ``"partial_tune"`` -- the native tuner committed some
+              loops but ran out of hosts that could take more before
+              reaching tolerance (insert budget not exhausted).
             * ``"unrouted"`` -- the member was not in ``routes_by_net``.
             * ``"not_length_critical"`` -- the engagement gate fired:
               ``length_critical=False``, no change was made.
@@ -488,6 +497,7 @@ def tune_match_group_v2(
     board_thickness_mm: float | None = None,
     num_copper_layers: int = 4,
     blind_buried_supported: bool = True,
+    cpp_grid: CppGrid | None = None,
 ) -> dict[int, tuple[Route, TuneResult]]:
     """Tune the lengths of an N-trace match group to within tolerance.
 
@@ -616,6 +626,13 @@ def tune_match_group_v2(
             had, so ``kct check`` re-derived a nonzero skew from the
             promoted through-vias (board 07 ADDR_BUS 0.000 vs 1.069mm).
             Defaults to ``True`` (legacy partial-span behavior).
+        cpp_grid: Optional :class:`~kicad_tools.router.cpp_backend.CppGrid`
+            mirroring the board.  When supplied (and the C++ backend is
+            built, and ``KCT_MEANDER_CPP`` is not ``"0"``) a length-critical
+            single-ended group is tuned by
+            :func:`_tune_match_group_native` -- every member in one
+            parallel native call -- instead of the Python cascade.  The
+            pair-aware path is unaffected.
 
     Returns:
         ``{net_id: (route, result)}`` for every member of ``group``.
@@ -699,6 +716,22 @@ def tune_match_group_v2(
             grid_resolution_mm=grid_resolution_mm,
         )
 
+    if cpp_grid is not None and length_critical and _native_meander_enabled():
+        return _tune_match_group_native(
+            group,
+            routes_by_net,
+            cpp_grid=cpp_grid,
+            tolerance_mm=tolerance_mm,
+            intra_group_clearance_mm=intra_group_clearance_mm,
+            config=config,
+            max_inserts_per_member=max_inserts_per_member,
+            via_clearance_mm=via_clearance_mm,
+            pad_clearance_mm=pad_clearance_mm,
+            board_thickness_mm=board_thickness_mm,
+            num_copper_layers=num_copper_layers,
+            blind_buried_supported=blind_buried_supported,
+        )
+
     return _tune_match_group_single_ended(
         group,
         routes_by_net,
@@ -718,6 +751,145 @@ def tune_match_group_v2(
     )
 
 
+def _resolve_group_reference(
+    group: MatchGroup,
+    member_lengths: dict[int, float],
+    tolerance_mm: float,
+) -> tuple[float | None, int | None]:
+    """Resolve ``(ref_length, effective_reference_net_id)`` for a group.
+
+    Same policy as :meth:`MatchGroupTracker.get_reference_length`, computed
+    from the caller's measured ``member_lengths``.
+    """
+    ref_length: float | None
+    if group.reference_net_id is not None:
+        ref_length = member_lengths.get(group.reference_net_id)
+    else:
+        # Longest-in-group default.
+        ref_length = max(member_lengths.values()) if member_lengths else None
+
+    # --- Issue #3440: auto-promote when the pace car is not the longest -
+    # The tuner is lengthen-only.  When the declared reference routes
+    # SHORTER than another member (by more than tolerance), strict
+    # pace-car semantics are structurally unsatisfiable: the reference
+    # is untouchable and the over-length members cannot be shortened,
+    # so the group's max-min skew can never reach tolerance (board 07
+    # ADDR_BUS, A0 declared as reference but routed shortest -> 15.4mm
+    # skew left untouched).  Policy decision (curator option (a)): log
+    # a structured warning and fall back to longest-in-group semantics
+    # -- the effective reference length becomes the longest member's
+    # length and EVERY member (including the declared pace car) becomes
+    # tunable.  This satisfies the DRC ``match_group_length_skew`` rule,
+    # which measures max-min spread, not distance-to-declared-reference.
+    #
+    # When the declared reference is longer than (or within tolerance
+    # of) every member, strict pace-car semantics are preserved
+    # byte-for-byte: the reference returns ``reason="reference"`` and
+    # members within tolerance above it return
+    # ``reason="longer_than_reference"``.
+    effective_reference_net_id: int | None = group.reference_net_id
+    if group.reference_net_id is not None and ref_length is not None and member_lengths:
+        longest_id, longest_len = max(member_lengths.items(), key=lambda kv: kv[1])
+        if longest_len > ref_length + tolerance_mm:
+            logger.warning(
+                "[match_group] group %r: declared reference net %s (%.3fmm) "
+                "is shorter than member net %s (%.3fmm) by more than the "
+                "%.3fmm tolerance.  The lengthen-only tuner cannot satisfy "
+                "a shortest-member pace car; auto-promoting longest-in-group "
+                "as the effective reference (the declared reference will be "
+                "lengthened toward %.3fmm).",
+                group.name,
+                group.reference_net_id,
+                ref_length,
+                longest_id,
+                longest_len,
+                tolerance_mm,
+                longest_len,
+            )
+            effective_reference_net_id = None
+            ref_length = longest_len
+    return ref_length, effective_reference_net_id
+
+
+def _untuned_member_result(
+    group: MatchGroup,
+    net_id: int,
+    current_length: float,
+    ref_length: float | None,
+    effective_reference_net_id: int | None,
+    tolerance_mm: float,
+) -> TuneResult | None:
+    """Result for a routed member the tuner leaves as is, or None to tune it.
+
+    Shared by the Python cascade and :func:`_tune_match_group_native` so
+    both paths report the same reason buckets for untouched members.
+    """
+    # If we couldn't derive a reference, nothing to do.
+    if ref_length is None:
+        return TuneResult(
+            success=False,
+            reason="unrouted",
+            length_before_mm=current_length,
+            length_after_mm=current_length,
+            message=(
+                f"Group {group.name!r} has no derivable reference length "
+                "(reference net unrouted or no members routed)."
+            ),
+        )
+
+    # Explicit-reference member is the pace car; never touch.
+    # (After Issue #3440 auto-promotion the effective reference may
+    # be ``None`` even when ``group.reference_net_id`` is set -- the
+    # declared reference is then tuned like any other member.)
+    if effective_reference_net_id == net_id:
+        return TuneResult(
+            success=True,
+            reason="reference",
+            length_before_mm=current_length,
+            length_after_mm=current_length,
+            message=(
+                f"Net {net_id} is the explicit reference for group "
+                f"{group.name!r}; never modified."
+            ),
+        )
+
+    delta = ref_length - current_length
+
+    # Already within tolerance -- byte-for-byte unchanged.
+    if abs(delta) <= tolerance_mm:
+        return TuneResult(
+            success=True,
+            reason="already_within_tolerance",
+            length_before_mm=current_length,
+            length_after_mm=current_length,
+            message=(
+                f"Net {net_id} already matched: "
+                f"|delta|={abs(delta):.4f}mm <= tol={tolerance_mm:.4f}mm"
+            ),
+        )
+
+    # Member is LONGER than the reference -- we cannot shorten;
+    # leave it alone.  This is the explicit "longer_than_reference"
+    # case the curator called out as a new reason value vs the
+    # pair tuner.  In the longest-in-group default policy this
+    # branch never fires because the reference IS the longest.
+    # In the explicit "pace-car" policy it fires for any member
+    # that's already longer than the pace-car length.
+    if delta < 0:
+        return TuneResult(
+            success=True,
+            reason="longer_than_reference",
+            length_before_mm=current_length,
+            length_after_mm=current_length,
+            message=(
+                f"Net {net_id} is longer than reference "
+                f"({current_length:.4f}mm > {ref_length:.4f}mm); "
+                "tuner cannot remove length."
+            ),
+        )
+    return None
+
+
 def _tune_match_group_single_ended(
     group: MatchGroup,
     routes_by_net: dict[int, Route],
@@ -819,54 +991,9 @@ def _tune_match_group_single_ended(
             continue
         member_lengths[net_id] = _measure(route)
 
-    # Resolve the reference length per policy.
-    ref_length: float | None
-    if group.reference_net_id is not None:
-        ref_length = member_lengths.get(group.reference_net_id)
-    else:
-        # Longest-in-group default.
-        ref_length = max(member_lengths.values()) if member_lengths else None
-
-    # --- Issue #3440: auto-promote when the pace car is not the longest -
-    # The tuner is lengthen-only.  When the declared reference routes
-    # SHORTER than another member (by more than tolerance), strict
-    # pace-car semantics are structurally unsatisfiable: the reference
-    # is untouchable and the over-length members cannot be shortened,
-    # so the group's max-min skew can never reach tolerance (board 07
-    # ADDR_BUS, A0 declared as reference but routed shortest -> 15.4mm
-    # skew left untouched).  Policy decision (curator option (a)): log
-    # a structured warning and fall back to longest-in-group semantics
-    # -- the effective reference length becomes the longest member's
-    # length and EVERY member (including the declared pace car) becomes
-    # tunable.  This satisfies the DRC ``match_group_length_skew`` rule,
-    # which measures max-min spread, not distance-to-declared-reference.
-    #
-    # When the declared reference is longer than (or within tolerance
-    # of) every member, strict pace-car semantics are preserved
-    # byte-for-byte: the reference returns ``reason="reference"`` and
-    # members within tolerance above it return
-    # ``reason="longer_than_reference"``.
-    effective_reference_net_id: int | None = group.reference_net_id
-    if group.reference_net_id is not None and ref_length is not None and member_lengths:
-        longest_id, longest_len = max(member_lengths.items(), key=lambda kv: kv[1])
-        if longest_len > ref_length + tolerance_mm:
-            logger.warning(
-                "[match_group] group %r: declared reference net %s (%.3fmm) "
-                "is shorter than member net %s (%.3fmm) by more than the "
-                "%.3fmm tolerance.  The lengthen-only tuner cannot satisfy "
-                "a shortest-member pace car; auto-promoting longest-in-group "
-                "as the effective reference (the declared reference will be "
-                "lengthened toward %.3fmm).",
-                group.name,
-                group.reference_net_id,
-                ref_length,
-                longest_id,
-                longest_len,
-                tolerance_mm,
-                longest_len,
-            )
-            effective_reference_net_id = None
-            ref_length = longest_len
+    ref_length, effective_reference_net_id = _resolve_group_reference(
+        group, member_lengths, tolerance_mm
+    )
 
     # --- Per-member iteration -------------------------------------------
     total_inserts_committed = 0  # group-level cumulative counter
@@ -885,87 +1012,15 @@ def _tune_match_group_single_ended(
             continue
 
         current_length = member_lengths[net_id]
-
-        # If we couldn't derive a reference, nothing to do.
-        if ref_length is None:
-            results[net_id] = (
-                route,
-                TuneResult(
-                    success=False,
-                    reason="unrouted",
-                    length_before_mm=current_length,
-                    length_after_mm=current_length,
-                    message=(
-                        f"Group {group.name!r} has no derivable reference length "
-                        "(reference net unrouted or no members routed)."
-                    ),
-                ),
-            )
-            continue
-
-        # Explicit-reference member is the pace car; never touch.
-        # (After Issue #3440 auto-promotion the effective reference may
-        # be ``None`` even when ``group.reference_net_id`` is set -- the
-        # declared reference is then tuned like any other member.)
-        if effective_reference_net_id == net_id:
-            results[net_id] = (
-                route,
-                TuneResult(
-                    success=True,
-                    reason="reference",
-                    length_before_mm=current_length,
-                    length_after_mm=current_length,
-                    message=(
-                        f"Net {net_id} is the explicit reference for group "
-                        f"{group.name!r}; never modified."
-                    ),
-                ),
-            )
+        untouched = _untuned_member_result(
+            group, net_id, current_length, ref_length, effective_reference_net_id, tolerance_mm
+        )
+        if untouched is not None:
+            results[net_id] = (route, untouched)
             continue
-
+        assert ref_length is not None  # narrowed by _untuned_member_result
         delta = ref_length - current_length
 
-        # Already within tolerance -- byte-for-byte unchanged.
-        if abs(delta) <= tolerance_mm:
-            results[net_id] = (
-                route,
-                TuneResult(
-                    success=True,
-                    reason="already_within_tolerance",
-                    length_before_mm=current_length,
-                    length_after_mm=current_length,
-                    message=(
-                        f"Net {net_id} already matched: "
-                        f"|delta|={abs(delta):.4f}mm <= tol={tolerance_mm:.4f}mm"
-                    ),
-                ),
-            )
-            continue
-
-        # Member is LONGER than the reference -- we cannot shorten;
-        # leave it alone.  This is the explicit "longer_than_reference"
-        # case the curator called out as a new reason value vs the
-        # pair tuner.  In the longest-in-group default policy this
-        # branch never fires because the reference IS the longest.
-        # In the explicit "pace-car" policy it fires for any member
-        # that's already longer than the pace-car length.
-        if delta < 0:
-            results[net_id] = (
-                route,
-                TuneResult(
-                    success=True,
-                    reason="longer_than_reference",
-                    length_before_mm=current_length,
-                    length_after_mm=current_length,
-                    message=(
-                        f"Net {net_id} is longer than reference "
-                        f"({current_length:.4f}mm > {ref_length:.4f}mm); "
-                        "tuner cannot remove length."
-                    ),
-                ),
-            )
-            continue
-
         # --- Cascade loop on this member -----------------------------
         original_route = route
         original_segments = route.segments
@@ -1334,6 +1389,179 @@ def _tune_match_group_single_ended(
     return results
 
 
+# ---------------------------------------------------------------------------
+# Native single-ended path (C++ ``MeanderTuner``)
+# ---------------------------------------------------------------------------
+
+
+def _native_meander_enabled() -> bool:
+    """True unless ``KCT_MEANDER_CPP=0`` or the C++ backend is not built."""
+    if os.environ.get("KCT_MEANDER_CPP", "1") == "0":
+        return False
+    from .cpp_backend import is_cpp_available
+
+    return is_cpp_available()
+
+
+def _tune_match_group_native(
+    group: MatchGroup,
+    routes_by_net: dict[int, Route],
+    *,
+    cpp_grid: CppGrid,
+    tolerance_mm: float,
+    intra_group_clearance_mm: float,
+    config: SerpentineConfig | None = None,
+    max_inserts_per_member: int,
+    via_clearance_mm: float | None = None,
+    pad_clearance_mm: float | None = None,
+    board_thickness_mm: float | None = None,
+    num_copper_layers: int = 4,
+    blind_buried_supported: bool = True,
+) -> dict[int, tuple[Route, TuneResult]]:
+    """Single-ended path on the C++ ``MeanderTuner`` (``cpp/include/meander.hpp``).
+
+    Same reference policy, reason codes, budgets and in-place
+    ``routes_by_net`` update as :func:`_tune_match_group_single_ended`,
+    but every tunable member is tuned in one native call: the members
+    run in parallel against a bucket index of the board, then are
+    reconciled against each other's loops in ``group.net_ids`` order.
+
+    Differences from the Python cascade:
+
+    * the board is every route in ``routes_by_net`` plus the pads
+      registered on ``cpp_grid``, checked against exact pad rectangles
+      (honoring per-pad clearance overrides) rather than bounding
+      circles;
+    * a member's diff-pair partner outside the group is held to
+      ``intra_group_clearance_mm`` (never looser than the intra-pair
+      floor the Python check applies);
+    * :data:`MAX_TOTAL_INSERTS_PER_GROUP` is applied to the native
+      results in member order -- a member past the ceiling keeps its
+      original route with ``reason="cascade_budget_exhausted"``.
+
+    Via-inclusive lengths stay on the Python side: each member's native
+    target is its planar length plus its via-inclusive delta.
+    """
+    from .cpp_backend import CppMeanderTuner, router_cpp
+    from .length import LengthTracker
+    from .match_group_length import MatchGroupTracker  # avoid cycle
+
+    def _measure(route: Route) -> float:
+        return MatchGroupTracker._measure_route_total(
+            route,
+            board_thickness_mm,
+            num_copper_layers,
+            blind_buried_supported=blind_buried_supported,
+        )
+
+    member_lengths: dict[int, float] = {}
+    for net_id in group.net_ids:
+        route = routes_by_net.get(net_id)
+        if route is not None:
+            member_lengths[net_id] = _measure(route)
+    ref_length, effective_reference_net_id = _resolve_group_reference(
+        group, member_lengths, tolerance_mm
+    )
+
+    results: dict[int, tuple[Route, TuneResult]] = {}
+    tunable: list[int] = []
+    for net_id in group.net_ids:
+        route = routes_by_net.get(net_id)
+        if route is None:
+            results[net_id] = (
+                _empty_route(net_id),
+                TuneResult(
+                    success=False,
+                    reason="unrouted",
+                    message=f"Net {net_id} is unrouted; nothing to tune.",
+                ),
+            )
+            continue
+        untouched = _untuned_member_result(
+            group,
+            net_id,
+            member_lengths[net_id],
+            ref_length,
+            effective_reference_net_id,
+            tolerance_mm,
+        )
+        if untouched is not None:
+            results[net_id] = (route, untouched)
+        else:
+            tunable.append(net_id)
+    if not tunable:
+        return results
+    assert ref_length is not None  # narrowed by _untuned_member_result
+
+    tuner = CppMeanderTuner(
+        cpp_grid,
+        trace_clearance=intra_group_clearance_mm,
+        via_clearance=via_clearance_mm,
+        pad_clearance=(
+            pad_clearance_mm if pad_clearance_mm is not None else intra_group_clearance_mm
+        ),
+        tolerance=tolerance_mm,
+        config=config,
+        max_inserts=max_inserts_per_member,
+    )
+    members = [
+        (
+            routes_by_net[net_id],
+            LengthTracker.calculate_route_length(routes_by_net[net_id])
+            + ref_length
+            - member_lengths[net_id],
+        )
+        for net_id in tunable
+    ]
+    tuned = tuner.tune_group(members, board_routes=list(routes_by_net.values()))
+
+    total_inserts_committed = 0
+    for net_id, (route, native) in zip(tunable, tuned, strict=True):
+        original_route = routes_by_net[net_id]
+        current_length = member_lengths[net_id]
+        result = TuneResult(length_before_mm=current_length, length_after_mm=current_length)
+        if native.inserts > 0 and (
+            total_inserts_committed + native.inserts > MAX_TOTAL_INSERTS_PER_GROUP
+        ):
+            result.reason = "cascade_budget_exhausted"
+            result.message = (
+                f"Group {group.name!r} cumulative budget "
+                f"({MAX_TOTAL_INSERTS_PER_GROUP}) exhausted before tuning "
+                f"net {net_id}; no insertion attempted."
+            )
+            results[net_id] = (original_route, result)
+            continue
+
+        result.inserts_applied = native.inserts
+        result.attempts = native.inserts + (native.status != router_cpp.MEANDER_TUNED)
+        if native.inserts > 0:
+            total_inserts_committed += native.inserts
+            result.length_after_mm = _measure(route)
+            routes_by_net[net_id] = route
+        skew_after = abs(ref_length - result.length_after_mm)
+        if native.status == router_cpp.MEANDER_TUNED or skew_after <= tolerance_mm:
+            result.success = True
+            result.reason = "tuned" if native.inserts > 0 else "already_within_tolerance"
+        elif native.status == router_cpp.MEANDER_NO_SEGMENT:
+            result.reason = "no_suitable_segment"
+        elif native.status == router_cpp.MEANDER_BLOCKED:
+            # Every candidate trombone was rejected by the clearance check.
+            result.reason = "post_insertion_drc_violation"
+        elif native.inserts >= max_inserts_per_member:
+            result.reason = "exceeded_max_inserts"
+        else:
+            result.reason = "partial_tune"
+        result.message = (
+            f"Native meander on net {net_id}: {result.reason} "
+            f"(inserts={native.inserts}, loops={native.loops}, "
+            f"requested {ref_length - current_length:.3f}mm, achieved "
+            f"{result.length_after_mm - current_length:.3f}mm, "
+            f"skew={skew_after:.4f}mm vs tol={tolerance_mm:.4f}mm)"
+        )
+        results[net_id] = (route, result)
+    return {net_id: results[net_id] for net_id in group.net_ids}
+
+
 # ---------------------------------------------------------------------------
 # Candidate-segment ranking (Issue #3274 -- per-segment retry)
 # ---------------------------------------------------------------------------
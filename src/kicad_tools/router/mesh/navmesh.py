@@ -10,15 +10,24 @@ it near-optimal (1.055x) with no mesh refinement.
 The A* result is a *corridor* (triangle sequence), converted to an oriented
 ``(left, right)`` portal list for the funnel string-pull, which produces the
 actual Euclidean geodesic.
+
+When the C++ backend is built, the adjacency, the A*, portal narrowing and the
+funnel run natively (``router_cpp.NavMesh``): this class then only forwards,
+and :meth:`NavMesh.find_path` is the whole A* -> portals -> funnel pipeline in
+one call.  ``KCT_MESH_CPP=0`` (or ``use_native=False``) forces the pure-Python
+path, which stays the reference implementation for parity tests.
 """
 
 from __future__ import annotations
 
+import bisect
 import heapq
 import math
+import os
 from collections.abc import Callable
+from functools import cached_property
 
-from .funnel import Portal
+from .funnel import Portal, string_pull
 from .geometry import EPS, Pt, centroid, merge_intervals, point_in_triangle
 
 Triangle = tuple[int, int, int]
@@ -40,6 +49,18 @@ LayeredStep = tuple[int, int, Pt, bool]
 PortalBlockedFn = Callable[[tuple[int, int], int], bool]
 ViaAllowedFn = Callable[[Pt, int, int], bool]
 
+# Parametric consumed bands per portal edge (issue #4274 lane assignment).
+ConsumedBands = dict[tuple[int, int], list[tuple[float, float]]]
+
+
+def _native_navmesh(vertices: list[Pt], triangles: list[Triangle], channel: float):
+    """Build the ``router_cpp.NavMesh`` twin, or ``None`` when unavailable."""
+    from ..cpp_backend import is_cpp_available, router_cpp
+
+    if not is_cpp_available() or not hasattr(router_cpp, "NavMesh"):
+        return None
+    return router_cpp.NavMesh(vertices, [tuple(t) for t in triangles], channel)
+
 
 class NavMesh:
     """Triangle-dual navmesh over a constrained-Delaunay triangulation."""
@@ -49,6 +70,8 @@ class NavMesh:
         vertices: list[Pt],
         triangles: list[Triangle],
         channel: float = 0.0,
+        *,
+        use_native: bool | None = None,
     ) -> None:
         self.vertices = vertices
         self.triangles = triangles
@@ -62,29 +85,160 @@ class NavMesh:
         # Per-portal (shared-edge key) occupancy + history congestion tables.
         # Keyed by the same sorted vertex-index pairs used in ``_adj`` so the
         # A* step and the negotiation bookkeeping speak the same portal id.
+        # With the native twin these stay empty: it owns the tables.
         self._occupancy: dict[tuple[int, int], int] = {}
         self._history: dict[tuple[int, int], float] = {}
-        self._centroids: list[Pt] = [
-            centroid(vertices[a], vertices[b], vertices[c]) for (a, b, c) in triangles
-        ]
-        # edge (sorted vertex-index pair) -> list of incident triangle indices
-        self._edge_tris: dict[tuple[int, int], list[int]] = {}
-        for ti, (a, b, c) in enumerate(triangles):
+        if use_native is None:
+            use_native = os.environ.get("KCT_MESH_CPP", "1") != "0"
+        self._native = (
+            _native_navmesh(vertices, triangles, channel) if use_native and triangles else None
+        )
+
+    # The Python-side adjacency is built lazily: with the native twin only the
+    # 2.5D ``astar_layered`` (whose per-layer callbacks stay in Python) and the
+    # pathfinder's portal-blocked test read it.
+
+    @cached_property
+    def _centroids(self) -> list[Pt]:
+        v = self.vertices
+        return [centroid(v[a], v[b], v[c]) for (a, b, c) in self.triangles]
+
+    @cached_property
+    def _edge_tris(self) -> dict[tuple[int, int], list[int]]:
+        """Edge (sorted vertex-index pair) -> list of incident triangle indices."""
+        edge_tris: dict[tuple[int, int], list[int]] = {}
+        for ti, (a, b, c) in enumerate(self.triangles):
             for u, v in ((a, b), (b, c), (c, a)):
                 key = (u, v) if u < v else (v, u)
-                self._edge_tris.setdefault(key, []).append(ti)
-        # adjacency: triangle -> list of (neighbor triangle, shared edge)
-        self._adj: list[list[tuple[int, tuple[int, int]]]] = [[] for _ in triangles]
+                edge_tris.setdefault(key, []).append(ti)
+        return edge_tris
+
+    @cached_property
+    def _adj(self) -> list[list[tuple[int, tuple[int, int]]]]:
+        """Triangle -> list of (neighbor triangle, shared edge)."""
+        adj: list[list[tuple[int, tuple[int, int]]]] = [[] for _ in self.triangles]
         for key, tris in self._edge_tris.items():
             if len(tris) == 2:
                 t0, t1 = tris
-                self._adj[t0].append((t1, key))
-                self._adj[t1].append((t0, key))
-        # vertex index -> incident triangles (for endpoint location)
-        self._vertex_tris: dict[int, list[int]] = {}
-        for ti, (a, b, c) in enumerate(triangles):
+                adj[t0].append((t1, key))
+                adj[t1].append((t0, key))
+        return adj
+
+    @cached_property
+    def _edge_ids(self) -> dict[tuple[int, int], int]:
+        """Edge -> first-seen position (the ``_adj`` neighbour order)."""
+        return {key: i for i, key in enumerate(self._edge_tris)}
+
+    @cached_property
+    def _vertex_tris(self) -> dict[int, list[int]]:
+        """Vertex index -> incident triangles (for endpoint location)."""
+        vertex_tris: dict[int, list[int]] = {}
+        for ti, (a, b, c) in enumerate(self.triangles):
             for v in (a, b, c):
-                self._vertex_tris.setdefault(v, []).append(ti)
+                vertex_tris.setdefault(v, []).append(ti)
+        return vertex_tris
+
+    @property
+    def is_native(self) -> bool:
+        """True when A*, portals and funnel run on ``router_cpp.NavMesh``."""
+        return self._native is not None
+
+    # -- local pour edits --------------------------------------------------
+
+    def apply_cdt_update(self, cdt: object, update: object) -> None:
+        """Patch the mesh in place after one ``router_cpp.IncrementalCDT`` edit.
+
+        ``update`` is the edit's ``CdtUpdate``: the slots in ``changed`` and
+        the ``moved`` targets hold new triangles, and the tail past the new
+        triangle count is gone.  Only those slots, the edges they touch and
+        the triangles on those edges are rebuilt -- the native twin likewise
+        (``NavMesh::apply_update``) -- so the edit scales with the pour.
+        Occupancy and history stay on every portal the edit leaves in place;
+        a portal it removes loses them.
+        """
+        old_n = len(self.triangles)
+        new_n = int(cdt.num_triangles)
+        arrived = sorted(set(update.changed) | {dst for _src, dst in update.moved})
+        gone = sorted({t for t in arrived if t < old_n} | set(range(new_n, old_n)))
+        new_tris: list[Triangle] = [
+            (int(a), int(b), int(c)) for (a, b, c) in cdt.triangles_at(arrived)
+        ]
+        new_verts = sorted({v for tri in new_tris for v in tri})
+        coords = cdt.vertices_at(new_verts)
+
+        if self._native is not None:
+            self._native.apply_cdt_update(cdt, update)
+
+        cache = self.__dict__
+        edge_tris = cache.get("_edge_tris")
+        vertex_tris = cache.get("_vertex_tris")
+        touched: set[tuple[int, int]] = set()
+        for t in gone:
+            tri = self.triangles[t]
+            for key in _tri_edge_keys(tri):
+                touched.add(key)
+                if edge_tris is not None and t in edge_tris.get(key, ()):
+                    edge_tris[key].remove(t)
+            if vertex_tris is not None:
+                for v in set(tri):
+                    fan = vertex_tris.get(v)
+                    if fan is not None and t in fan:
+                        fan.remove(t)
+                        if not fan:
+                            del vertex_tris[v]
+
+        del self.triangles[new_n:]
+        self.triangles.extend([(0, 0, 0)] * (new_n - len(self.triangles)))
+        if new_verts and new_verts[-1] >= len(self.vertices):
+            self.vertices.extend([(math.nan, math.nan)] * (new_verts[-1] + 1 - len(self.vertices)))
+        for v, (x, y) in zip(new_verts, coords):
+            self.vertices[v] = (float(x), float(y))
+        for t, tri in zip(arrived, new_tris):
+            self.triangles[t] = tri
+
+        centroids = cache.get("_centroids")
+        if centroids is not None:
+            del centroids[new_n:]
+            centroids.extend([(0.0, 0.0)] * (new_n - len(centroids)))
+        edge_ids = cache.get("_edge_ids")
+        v = self.vertices
+        for t, tri in zip(arrived, new_tris):
+            if centroids is not None:
+                centroids[t] = centroid(v[tri[0]], v[tri[1]], v[tri[2]])
+            if vertex_tris is not None:
+                for vi in set(tri):
+                    bisect.insort(vertex_tris.setdefault(vi, []), t)
+            for key in _tri_edge_keys(tri):
+                touched.add(key)
+                if edge_tris is not None:
+                    if edge_ids is not None and key not in edge_tris:
+                        edge_ids[key] = len(edge_ids)
+                    edge_tris.setdefault(key, []).append(t)
+
+        # Removed edges drop their negotiation state: a recycled vertex pair
+        # is a different portal.  (With the native twin the tables are empty.)
+        if self._occupancy or self._history:
+            alive = self._edge_tris
+            for key in touched:
+                if not alive.get(key):
+                    self._occupancy.pop(key, None)
+                    self._history.pop(key, None)
+
+        adj = cache.get("_adj")
+        if adj is not None:
+            del adj[new_n:]
+            adj.extend([] for _ in range(new_n - len(adj)))
+            relink = set(arrived)
+            for key in touched:
+                relink.update(self._edge_tris.get(key, ()))
+            order = self._edge_ids
+            for t in relink:
+                row: list[tuple[int, tuple[int, int]]] = []
+                for key in sorted(set(_tri_edge_keys(self.triangles[t])), key=order.__getitem__):
+                    tris = self._edge_tris[key]
+                    if len(tris) == 2:
+                        row.append((tris[0] if tris[1] == t else tris[1], key))
+                adj[t] = row
 
     # -- endpoint location -------------------------------------------------
 
@@ -106,6 +260,8 @@ class NavMesh:
         free point falls inside exactly one.  Returns all candidate triangles
         so A* can seed / terminate on any of them.
         """
+        if self._native is not None:
+            return self._native.locate(p)
         vi = self._vertex_index(p)
         if vi is not None and vi in self._vertex_tris:
             return list(self._vertex_tris[vi])
@@ -130,24 +286,36 @@ class NavMesh:
         ``channel <= 0`` (capacity model disabled) reports a very large
         capacity so no portal is ever congested -- the single-net P1 default.
         """
+        if self._native is not None:
+            return self._native.capacity(edge)
         if self.channel <= 0.0:
             return 1_000_000_000
         return int(self.edge_length(edge) / self.channel)
 
     def occupancy(self, edge: tuple[int, int]) -> int:
         """Number of nets currently routed across a portal."""
+        if self._native is not None:
+            return self._native.occupancy(edge)
         return self._occupancy.get(edge, 0)
 
     def history(self, edge: tuple[int, int]) -> float:
         """Accumulated cross-iteration history congestion for a portal."""
+        if self._native is not None:
+            return self._native.history(edge)
         return self._history.get(edge, 0.0)
 
     def commit_portal(self, edge: tuple[int, int]) -> None:
         """Record one more net crossing this portal (a committed route)."""
+        if self._native is not None:
+            self._native.commit_portal(edge)
+            return
         self._occupancy[edge] = self._occupancy.get(edge, 0) + 1
 
     def release_portal(self, edge: tuple[int, int]) -> None:
         """Undo one net crossing (rip-up)."""
+        if self._native is not None:
+            self._native.release_portal(edge)
+            return
         cur = self._occupancy.get(edge, 0)
         if cur > 0:
             self._occupancy[edge] = cur - 1
@@ -158,16 +326,36 @@ class NavMesh:
         History is deliberately preserved -- it is the persistent memory that
         drives PathFinder/VPR convergence across iterations.
         """
+        if self._native is not None:
+            self._native.reset_occupancy()
+            return
         self._occupancy.clear()
 
     def add_history(self, edge: tuple[int, int], increment: float) -> None:
         """Bump a portal's persistent history congestion (over-capacity penalty)."""
+        if self._native is not None:
+            self._native.add_history(edge, increment)
+            return
         self._history[edge] = self._history.get(edge, 0.0) + increment
 
     def occupied_portals(self) -> list[tuple[int, int]]:
         """Portal keys with non-zero present occupancy."""
+        if self._native is not None:
+            return self._native.occupied_portals()
         return [e for e, occ in self._occupancy.items() if occ > 0]
 
+    def clear_history(self) -> None:
+        """Drop all history congestion (start of a fresh negotiation)."""
+        if self._native is not None:
+            self._native.clear_history()
+            return
+        self._history.clear()
+
+    def _has_history(self) -> bool:
+        if self._native is not None:
+            return self._native.has_history
+        return bool(self._history)
+
     def portal_penalty(
         self,
         edge: tuple[int, int],
@@ -199,6 +387,8 @@ class NavMesh:
 
     def corridor_portals(self, corridor: list[int]) -> list[tuple[int, int]]:
         """Portal (shared-edge) keys crossed by a triangle corridor."""
+        if self._native is not None:
+            return self._native.corridor_portals(corridor)
         portals: list[tuple[int, int]] = []
         for i in range(len(corridor) - 1):
             edge = self._shared_edge(corridor[i], corridor[i + 1])
@@ -229,12 +419,16 @@ class NavMesh:
         == 0`` and no history) the arithmetic reduces to the P1 portal-midpoint
         distance exactly -- the single-net path is unchanged.
         """
+        if self._native is not None:
+            return self._native.astar(
+                start, goal, present_cost_factor, cost_congestion, congestion_threshold
+            )
         start_tris = self.locate(start)
         goal_tris = set(self.locate(goal))
         if not start_tris or not goal_tris:
             return None
 
-        negotiating = present_cost_factor != 0.0 or bool(self._history)
+        negotiating = present_cost_factor != 0.0 or self._has_history()
 
         def edge_mid(edge: tuple[int, int]) -> Pt:
             a = self.vertices[edge[0]]
@@ -332,7 +526,7 @@ class NavMesh:
         if not start_tris or not goal_tris:
             return None
 
-        negotiating = present_cost_factor != 0.0 or bool(self._history)
+        negotiating = present_cost_factor != 0.0 or self._has_history()
 
         def edge_mid(edge: tuple[int, int]) -> Pt:
             a = self.vertices[edge[0]]
@@ -443,6 +637,8 @@ class NavMesh:
         ``None``, so the single-net P1/P2 contract (full openings) is unchanged
         byte-for-byte.
         """
+        if self._native is not None:
+            return self._native.corridor_to_portals(corridor, start, goal, consumed, pack)
         portals: list[Portal] = [(start, start)]
         for i in range(len(corridor) - 1):
             cur = corridor[i]
@@ -468,6 +664,59 @@ class NavMesh:
         portals.append((goal, goal))
         return portals
 
+    def pull(
+        self,
+        corridor: list[int],
+        start: Pt,
+        goal: Pt,
+        consumed: ConsumedBands | None = None,
+        pack: str = "largest",
+    ) -> list[Pt]:
+        """Funnel string-pull of a corridor (optionally narrowed) into a geodesic."""
+        portals = self.corridor_to_portals(corridor, start, goal, consumed, pack)
+        if self._native is not None:
+            return self._native.string_pull(portals)
+        return string_pull(portals)
+
+    def find_path(
+        self,
+        start: Pt,
+        goal: Pt,
+        *,
+        present_cost_factor: float = 0.0,
+        cost_congestion: float = 0.0,
+        congestion_threshold: float = 0.0,
+        consumed: ConsumedBands | None = None,
+        pack: str = "largest",
+    ) -> tuple[list[int], list[tuple[int, int]], list[Pt]] | None:
+        """A* + oriented portals + funnel: ``(corridor, portal_edges, geodesic)``.
+
+        The same result as :meth:`astar`, :meth:`corridor_portals` and
+        :meth:`pull` chained, in a single native call when the C++ twin is
+        available.  ``None`` if the endpoints are in disconnected regions.
+        """
+        if self._native is not None:
+            return self._native.find_path(
+                start,
+                goal,
+                present_cost_factor,
+                cost_congestion,
+                congestion_threshold,
+                consumed,
+                pack,
+            )
+        corridor = self.astar(
+            start,
+            goal,
+            present_cost_factor=present_cost_factor,
+            cost_congestion=cost_congestion,
+            congestion_threshold=congestion_threshold,
+        )
+        if corridor is None:
+            return None
+        geodesic = self.pull(corridor, start, goal, consumed, pack)
+        return corridor, self.corridor_portals(corridor), geodesic
+
     def _shared_edge(self, t0: int, t1: int) -> tuple[int, int] | None:
         s0 = set(self.triangles[t0])
         s1 = set(self.triangles[t1])
@@ -477,6 +726,12 @@ class NavMesh:
         return None
 
 
+def _tri_edge_keys(tri: Triangle) -> tuple[tuple[int, int], ...]:
+    """The three sorted vertex-index edge keys of a triangle."""
+    a, b, c = tri
+    return tuple((u, w) if u < w else (w, u) for u, w in ((a, b), (b, c), (c, a)))
+
+
 def _narrow_portal(
     left: Pt,
     right: Pt,
@@ -107,6 +107,12 @@ class MeshPathfinder:
         # Static navmesh + triangulation-call counter (built lazily, once).
         self._navmesh: NavMesh | None = None
         self.triangulation_calls: int = 0
+        # Local remeshing for pour edits after the build (``add_pour`` /
+        # ``remove_pour``): the native ``IncrementalCDT`` adopted from the
+        # built mesh, and each pour's hole id in it (``None`` = not a hole).
+        self._cdt: object | None = None
+        self._pour_hole_ids: list[int | None] = []
+        self.incremental_updates: int = 0
 
     # -- construction from a board ----------------------------------------
 
@@ -157,6 +163,7 @@ class MeshPathfinder:
         steiner = [(p.x, p.y) for p in self.pads]
         holes = self._pour_holes()
         self.triangulation_calls += 1
+        self._cdt = None
         verts, tris = router_cpp.constrained_delaunay(self.outline, holes, steiner)
         if not verts or not tris:
             self._navmesh = NavMesh([], [], channel=self.channel)
@@ -176,22 +183,109 @@ class MeshPathfinder:
         still checks legs against the true (un-inflated) pour, so the emitted
         copper keeps at least the clearance margin from the pour.
         """
+        holes: list[list[Pt]] = []
+        for poly in self.pours:
+            hole = self._pour_hole(poly)
+            if hole is not None:
+                holes.append(hole)
+        return holes
+
+    def _pour_hole(self, poly: list[Pt]) -> list[Pt] | None:
+        """One pour's inflated mesh hole, or ``None`` if it cannot be a hole."""
+        if len(poly) < 3:
+            return None
         bx0, by0, bx1, by1 = self._bbox
         margin = 1e-3
         agent_radius = self.rules.trace_width / 2.0 + self.rules.trace_clearance
-        holes: list[list[Pt]] = []
+        inflated = _inflate_polygon([(pt[0], pt[1]) for pt in poly], agent_radius)
+        # Only keep pours fully inside the (slightly inset) outline: poly2tri
+        # holes must not touch or cross the outer boundary.
+        if all(
+            bx0 + margin <= x <= bx1 - margin and by0 + margin <= y <= by1 - margin
+            for (x, y) in inflated
+        ):
+            return inflated
+        return None
+
+    # -- local pour edits -------------------------------------------------
+
+    def add_pour(self, polygon: list[Pt]) -> bool:
+        """Add a filled pour, cutting it into an already-built mesh locally.
+
+        The native ``IncrementalCDT`` re-triangulates only the triangles the
+        inflated pour touches, so the edit scales with the pour, not the board,
+        and :attr:`triangulation_calls` does not move.  Returns ``False`` when
+        the local edit is refused (e.g. the pour overlaps another one); the
+        mesh is then dropped and the next :meth:`build` remeshes in full.
+        The navmesh is patched in place (:meth:`NavMesh.apply_cdt_update`), so
+        portal congestion and history outside the edit carry over.
+        """
+        cdt = self._incremental_cdt() if self._navmesh is not None else None
+        self.pours.append(list(polygon))
+        if self._navmesh is None:
+            return True
+        hole = self._pour_hole(polygon)
+        if hole is None:
+            # Obstacle-model only (touches the outline), as in ``build``.
+            self._pour_hole_ids.append(None)
+            return True
+        update = cdt.insert_hole(hole) if cdt is not None else None
+        if update is None or not update.ok:
+            self._invalidate_mesh()
+            return False
+        self._pour_hole_ids.append(update.hole_id)
+        self._adopt_cdt(update)
+        return True
+
+    def remove_pour(self, index: int) -> bool:
+        """Remove ``self.pours[index]``, filling its mesh hole back in locally.
+
+        Same contract as :meth:`add_pour`.
+        """
+        cdt = self._incremental_cdt() if self._navmesh is not None else None
+        self.pours.pop(index)
+        if self._navmesh is None:
+            return True
+        if cdt is None:
+            self._invalidate_mesh()
+            return False
+        hole_id = self._pour_hole_ids.pop(index)
+        if hole_id is None:
+            return True
+        update = cdt.remove_hole(hole_id)
+        if not update.ok:
+            self._invalidate_mesh()
+            return False
+        self._adopt_cdt(update)
+        return True
+
+    def _incremental_cdt(self) -> object | None:
+        """The ``IncrementalCDT`` over the built mesh (adopted on first use)."""
+        if self._cdt is not None:
+            return self._cdt
+        import kicad_tools.router.router_cpp as router_cpp  # type: ignore[import-not-found]
+
+        navmesh = self._navmesh
+        if navmesh is None or not navmesh.triangles or not hasattr(router_cpp, "IncrementalCDT"):
+            return None
+        cdt = router_cpp.IncrementalCDT(navmesh.vertices, navmesh.triangles)
+        ids: list[int | None] = []
         for poly in self.pours:
-            if len(poly) < 3:
-                continue
-            inflated = _inflate_polygon([(pt[0], pt[1]) for pt in poly], agent_radius)
-            # Only keep pours fully inside the (slightly inset) outline: poly2tri
-            # holes must not touch or cross the outer boundary.
-            if all(
-                bx0 + margin <= x <= bx1 - margin and by0 + margin <= y <= by1 - margin
-                for (x, y) in inflated
-            ):
-                holes.append(inflated)
-        return holes
+            hole = self._pour_hole(poly)
+            hole_id = cdt.hole_at(hole[0]) if hole is not None else -1
+            ids.append(hole_id if hole_id >= 0 else None)
+        self._cdt = cdt
+        self._pour_hole_ids = ids
+        return cdt
+
+    def _adopt_cdt(self, update: object) -> None:
+        self._navmesh.apply_cdt_update(self._cdt, update)
+        self.incremental_updates += 1
+
+    def _invalidate_mesh(self) -> None:
+        self._navmesh = None
+        self._cdt = None
+        self._pour_hole_ids = []
 
     # -- the route contract -----------------------------------------------
 
@@ -276,21 +370,26 @@ class MeshPathfinder:
         congestion_threshold = self.rules.congestion_threshold
         pcf = present_cost_factor if negotiated_mode else 0.0
 
-        corridor = navmesh.astar(
+        # A* + portals + funnel in one (native, when built) call.
+        found = navmesh.find_path(
             start_pt,
             end_pt,
             present_cost_factor=pcf,
             cost_congestion=cost_congestion,
             congestion_threshold=congestion_threshold,
+            consumed=consumed,
         )
-        if corridor is None:
+        if found is None:
             return None
+        corridor, portal_edges, geodesic = found
 
         # First try the full-opening funnel (the P2 geodesic).  When no copper
         # is committed yet -- the first net, and every net on ``--route-engine``
         # paths that never narrow -- this is the only attempt and the result is
         # byte-identical to P2.
-        fitted = self._fit_corridor(navmesh, corridor, start_pt, end_pt, obstacles, consumed)
+        fitted = octilinear_fit(geodesic, obstacles.is_clear)
+        if fitted is not None and len(fitted) < 2:
+            fitted = None
 
         # Issue #4274 re-funnel: if the taut geodesic collides with copper a
         # prior net committed this pass, narrow this net's portals to their
@@ -300,7 +399,7 @@ class MeshPathfinder:
         # declines (``None``) rather than crossing.
         if fitted is None and consumed is None and committed:
             derived: dict[tuple[int, int], list[tuple[float, float]]] = {}
-            for edge in navmesh.corridor_portals(corridor):
+            for edge in portal_edges:
                 bands = _edge_consumed_bands(navmesh, edge, committed)
                 if bands:
                     derived[edge] = bands
@@ -320,7 +419,7 @@ class MeshPathfinder:
             return None
 
         route = self._build_route(start, net, trace_w, fitted)
-        return route, navmesh.corridor_portals(corridor)
+        return route, portal_edges
 
     def _fit_corridor(
         self,
@@ -385,7 +484,7 @@ class MeshPathfinder:
         navmesh = self.build()
         # Fresh negotiation: clear any stale occupancy/history from a prior run.
         navmesh.reset_occupancy()
-        navmesh._history.clear()
+        navmesh.clear_history()
 
         # Shortest-first: short nets are easier and fence off less area, which
         # materially lifts the completion rate under committed-copper blocking.
@@ -1005,9 +1104,7 @@ def _pull(
     consumed: dict[tuple[int, int], list[tuple[float, float]]] | None = None,
     pack: str = "largest",
 ) -> list[Pt]:
-    from .funnel import string_pull
-
-    return string_pull(navmesh.corridor_to_portals(corridor, start, end, consumed, pack))
+    return navmesh.pull(corridor, start, end, consumed, pack)
 
 
 def _outline_from_edges(
@@ -18,12 +18,19 @@ The key insight is that valid routing paths must either:
 
 By encoding clearance constraints into the waypoint positions, we eliminate
 per-segment clearance checking during routing.
+
+When the C++ backend is built, ``SparseRoutingGraph`` hands waypoint
+generation, visibility and A* to ``router_cpp.SparseGraph``: rectangular
+clearance contours, exact segment/box visibility over a bucket index, and a
+CSR search.  ``KCT_SPARSE_CPP=0`` (or ``use_native=False``) keeps the
+pure-Python graph.
 """
 
 from __future__ import annotations
 
 import heapq
 import math
+import os
 from dataclasses import dataclass, field
 from typing import TYPE_CHECKING
 
@@ -171,6 +178,23 @@ class SparseNode:
         return self.f_score < other.f_score
 
 
+# ``router_cpp.SPARSE_*`` waypoint kinds, in ``Waypoint.waypoint_type`` terms.
+_NATIVE_WAYPOINT_TYPES = ("pad", "contour", "sparse", "via")
+
+
+def _native_sparse_graph(use_native: bool | None):
+    """``router_cpp`` when the native sparse graph should be used, else ``None``."""
+    if use_native is None:
+        use_native = os.environ.get("KCT_SPARSE_CPP", "1") != "0"
+    if not use_native:
+        return None
+    from .cpp_backend import is_cpp_available, router_cpp
+
+    if not is_cpp_available() or not hasattr(router_cpp, "SparseGraph"):
+        return None
+    return router_cpp
+
+
 class SparseRoutingGraph:
     """Sparse routing graph using clearance contours.
 
@@ -194,6 +218,8 @@ class SparseRoutingGraph:
         contour_samples: int = 8,
         sparse_grid_spacing: float = 2.0,
         net_class_map: dict[str, NetClassRouting] | None = None,
+        *,
+        use_native: bool | None = None,
     ):
         """Initialize sparse routing graph.
 
@@ -205,6 +231,9 @@ class SparseRoutingGraph:
             contour_samples: Number of waypoints per obstacle contour (8 = octagon)
             sparse_grid_spacing: Spacing for sparse interior grid points (mm)
             net_class_map: Optional net class map for per-net trace widths
+            use_native: Build and search the graph in C++ (``router_cpp.SparseGraph``).
+                ``None`` uses it when the backend is built and ``KCT_SPARSE_CPP``
+                is not ``"0"``.
         """
         self.width = width
         self.height = height
@@ -249,6 +278,23 @@ class SparseRoutingGraph:
         # Edge cost multiplier for edges passing through other nets' corridors
         self.corridor_crossing_penalty: float = 3.0
 
+        # Native graph (None = pure Python).  ``_native_wps[i]`` mirrors native
+        # waypoint ``i``; the via twins created by ``build()`` stay out of
+        # ``self.waypoints`` and are dropped again by the next add.
+        self._native = None
+        self._native_wps: list[Waypoint] = []
+        native = _native_sparse_graph(use_native)
+        if native is not None:
+            self._native = native.SparseGraph(
+                width,
+                height,
+                origin_x,
+                origin_y,
+                num_layers,
+                self.clearance_buffer,
+                contour_samples,
+            )
+
     def add_pad(self, pad: Pad) -> None:
         """Add a pad to the sparse graph.
 
@@ -278,6 +324,14 @@ class SparseRoutingGraph:
         else:
             layers = [0]  # Assume top layer for SMD
 
+        if self._native is not None:
+            self._drop_native_twins()
+            self._native.add_pad(pad.x, pad.y, half_w, half_h, pad.net, layers)
+            for layer in layers:
+                self.obstacles[layer].append((pad.x, pad.y, half_w, half_h, self.clearance_buffer))
+            self._sync_native_waypoints()
+            return
+
         for layer in layers:
             # Add pad center waypoint
             pad_wp = Waypoint(
@@ -304,6 +358,64 @@ class SparseRoutingGraph:
             contour_dist = max(half_w, half_h) + self.clearance_buffer
             self._add_contour_waypoints(pad.x, pad.y, contour_dist, layer, pad.net)
 
+    def add_obstacle(
+        self,
+        x: float,
+        y: float,
+        half_w: float,
+        half_h: float,
+        net: int = 0,
+        layers: list[int] | None = None,
+    ) -> None:
+        """Add a via or keepout: an obstacle and its contour, no connection point.
+
+        Args:
+            x, y: Obstacle center
+            half_w, half_h: Obstacle half-size (before the clearance buffer)
+            net: Owning net (0 for keepouts)
+            layers: Affected layers (default: all)
+        """
+        if layers is None:
+            layers = list(range(self.num_layers))
+
+        if self._native is not None:
+            self._drop_native_twins()
+            self._native.add_obstacle(x, y, half_w, half_h, net, layers)
+            for layer in layers:
+                self.obstacles[layer].append((x, y, half_w, half_h, self.clearance_buffer))
+            self._sync_native_waypoints()
+            return
+
+        for layer in layers:
+            self.obstacles[layer].append((x, y, half_w, half_h, self.clearance_buffer))
+            contour_dist = max(half_w, half_h) + self.clearance_buffer
+            self._add_contour_waypoints(x, y, contour_dist, layer, net)
+
+    def _drop_native_twins(self) -> None:
+        """Forget the via twins of a built native graph before it is extended."""
+        del self._native_wps[self._native.num_base_waypoints :]
+
+    def _sync_native_waypoints(self) -> None:
+        """Mirror native waypoints added since the last sync into the Python views."""
+        first = len(self._native_wps)
+        for x, y, layer, kind, net in self._native.waypoints_from(first):
+            waypoint_type = _NATIVE_WAYPOINT_TYPES[kind]
+            wp = Waypoint(
+                x=x,
+                y=y,
+                layer=layer,
+                waypoint_type=waypoint_type,
+                pad_ref=f"{net}" if waypoint_type == "pad" else None,
+                net=net,
+            )
+            self._native_wps.append(wp)
+            if waypoint_type == "via":
+                continue
+            self.waypoints[layer].append(wp)
+            self.stats[f"{waypoint_type}_waypoints"] += 1
+            if waypoint_type == "pad":
+                self.pad_waypoints.setdefault((net, layer), []).append(wp)
+
     def _add_contour_waypoints(
         self, cx: float, cy: float, radius: float, layer: int, exclude_net: int = 0
     ) -> None:
@@ -333,6 +445,12 @@ class SparseRoutingGraph:
 
         These enable long-distance routing across empty board regions.
         """
+        if self._native is not None:
+            self._drop_native_twins()
+            self._native.add_sparse_grid(self.sparse_grid_spacing)
+            self._sync_native_waypoints()
+            return
+
         cols = int(self.width / self.sparse_grid_spacing) + 1
         rows = int(self.height / self.sparse_grid_spacing) + 1
 
@@ -359,6 +477,15 @@ class SparseRoutingGraph:
         Args:
             max_edge_length: Maximum edge length to consider (limits search space)
         """
+        if self._native is not None:
+            # Native edges live in the C++ CSR; ``self.edges`` stays empty.
+            # ``total_edges`` also counts the via edges between twins.
+            self._drop_native_twins()
+            self._native.build(max_edge_length)
+            self._sync_native_waypoints()
+            self.stats["total_edges"] = self._native.num_edges
+            return
+
         for layer in range(self.num_layers):
             wps = self.waypoints[layer]
             n = len(wps)
@@ -456,6 +583,12 @@ class SparseRoutingGraph:
         Returns:
             Route if successful, None otherwise
         """
+        if self._native is not None:
+            end_node = self._native_search(start_pad, end_pad, use_corridors=False)
+            if end_node is None:
+                return None
+            return self._reconstruct_route(end_node, start_pad, end_pad)
+
         # Find start and end waypoints
         start_wps = self._find_pad_waypoints(start_pad)
         end_wps = self._find_pad_waypoints(end_pad)
@@ -531,6 +664,44 @@ class SparseRoutingGraph:
 
         return None
 
+    def _native_search(
+        self, start_pad: Pad, end_pad: Pad, *, use_corridors: bool
+    ) -> SparseNode | None:
+        """Run the native A* and return its path as a ``SparseNode`` chain."""
+        if not self._native.built:
+            self.build_visibility_graph()
+        starts = self._native.pad_waypoints(start_pad.net, start_pad.x, start_pad.y)
+        goals = self._native.pad_waypoints(end_pad.net, end_pad.x, end_pad.y)
+        if not starts or not goals:
+            return None
+
+        if use_corridors:
+            self._sync_native_corridors()
+        path = self._native.route(start_pad.net, starts, goals, self.rules.cost_via, use_corridors)
+        if not path.success:
+            return None
+
+        node: SparseNode | None = None
+        for wp_id, via_before in zip(path.waypoints, path.via_before, strict=True):
+            node = SparseNode(0.0, 0.0, self._native_wps[wp_id], node, bool(via_before))
+        return node
+
+    def _sync_native_corridors(self) -> None:
+        """Push ``reserved_corridors`` (which callers may edit directly) to C++."""
+        self._native.corridor_penalty = self.corridor_crossing_penalty
+        self._native.clear_all_corridors()
+        for net, corridor in self.reserved_corridors.items():
+            segments = [
+                (wp1.x, wp1.y, wp2.x, wp2.y, layer)
+                for start_idx, end_idx, layer in corridor.layer_segments
+                for wp1, wp2 in zip(
+                    corridor.waypoints[start_idx:end_idx],
+                    corridor.waypoints[start_idx + 1 : end_idx + 1],
+                    strict=True,
+                )
+            ]
+            self._native.set_corridor(net, segments, corridor.width)
+
     def _find_pad_waypoints(self, pad: Pad) -> list[Waypoint]:
         """Find waypoints associated with a pad."""
         result = []
@@ -689,6 +860,12 @@ class SparseRoutingGraph:
         Returns:
             List of waypoints forming the global path, or None if no path found
         """
+        if self._native is not None:
+            end_node = self._native_search(start_pad, end_pad, use_corridors=True)
+            if end_node is None:
+                return None
+            return self._reconstruct_waypoint_path(end_node)
+
         # Find start and end waypoints
         start_wps = self._find_pad_waypoints(start_pad)
         end_wps = self._find_pad_waypoints(end_pad)
@@ -891,6 +1068,8 @@ class SparseRouter:
         origin_y: float = 0,
         num_layers: int = 2,
         net_class_map: dict[str, NetClassRouting] | None = None,
+        *,
+        use_native: bool | None = None,
     ):
         """Initialize sparse router.
 
@@ -900,6 +1079,7 @@ class SparseRouter:
             origin_x, origin_y: Board origin
             num_layers: Number of copper layers
             net_class_map: Optional net class map for per-net trace widths
+            use_native: Passed to ``SparseRoutingGraph`` (``None`` = auto)
         """
         self.graph = SparseRoutingGraph(
             width=width,
@@ -911,6 +1091,7 @@ class SparseRouter:
             contour_samples=8,  # Octagonal contours
             sparse_grid_spacing=max(2.0, rules.trace_clearance * 10),
             net_class_map=net_class_map,
+            use_native=use_native,
         )
         self.rules = rules
         self.pads: dict[str, Pad] = {}
@@ -6,6 +6,7 @@ Provides classes for parsing and manipulating KiCad PCB files (.kicad_pcb).
 from __future__ import annotations
 
 import logging
+import math
 import re
 import uuid
 from collections.abc import Iterator
@@ -244,6 +245,140 @@ class Net:
     name: str
 
 
+def _convex_hull(points: list[tuple[float, float]]) -> list[tuple[float, float]]:
+    """Counter-clockwise convex hull (Andrew's monotone chain)."""
+    pts = sorted(set(points))
+    if len(pts) < 3:
+        return pts
+
+    def half(seq):
+        chain: list[tuple[float, float]] = []
+        for p in seq:
+            while len(chain) >= 2:
+                (ax, ay), (bx, by) = chain[-2], chain[-1]
+                if (bx - ax) * (p[1] - ay) - (by - ay) * (p[0] - ax) > 0:
+                    break
+                chain.pop()
+            chain.append(p)
+        return chain[:-1]
+
+    return half(pts) + half(reversed(pts))
+
+
+def _polygon_covers(
+    poly: list[tuple[float, float]], inner: list[tuple[float, float]]
+) -> bool:
+    """Whether the simple polygon ``poly`` contains the convex polygon ``inner``.
+
+    Every ``inner`` vertex must lie inside or on ``poly``, no ``poly``
+    vertex may lie strictly inside ``inner`` and no pair of edges may
+    cross properly.  Touching boundaries count as covered.
+    """
+
+    def cross(o, a, b) -> float:
+        return (a[0] - o[0]) * (b[1] - o[1]) - (a[1] - o[1]) * (b[0] - o[0])
+
+    def inside_or_on(pt) -> bool:
+        hit = False
+        for a, b in zip(poly, poly[1:] + poly[:1]):
+            if (
+                abs(cross(a, b, pt)) <= 1e-12
+                and min(a[0], b[0]) <= pt[0] <= max(a[0], b[0])
+                and min(a[1], b[1]) <= pt[1] <= max(a[1], b[1])
+            ):
+                return True
+            if (a[1] > pt[1]) != (b[1] > pt[1]):
+                if pt[0] < a[0] + (pt[1] - a[1]) * (b[0] - a[0]) / (b[1] - a[1]):
+                    hit = not hit
+        return hit
+
+    inner_edges = list(zip(inner, inner[1:] + inner[:1]))
+    if not all(inside_or_on(p) for p in inner):
+        return False
+    sign = 1.0 if cross(inner[0], inner[1], inner[2]) > 0 else -1.0
+    for p in poly:
+        if all(sign * cross(a, b, p) > 1e-12 for a, b in inner_edges):
+            return False
+    for a, b in zip(poly, poly[1:] + poly[:1]):
+        for c, d in inner_edges:
+            if (
+                cross(a, b, c) * cross(a, b, d) < 0
+                and cross(c, d, a) * cross(c, d, b) < 0
+            ):
+                return False
+    return True
+
+
+def _custom_pad_outline(
+    primitives: SExp, size: tuple[float, float], anchor_circle: bool = False
+) -> tuple[list[tuple[float, float]], float]:
+    """Pad-local copper outline of a ``custom`` pad and its stroke width.
+
+    The anchor pad (a ``size`` rect, or with ``anchor_circle`` the octagon
+    around a ``size[0]`` circle) is copper too.  A lone ``gr_poly`` that
+    covers it is the outline as drawn; otherwise the anchor and every
+    ``gr_poly`` / ``gr_rect`` / ``gr_circle`` / ``gr_line`` primitive are
+    merged into their convex hull, which never undercuts the copper.
+    Returns ``([], 0.0)`` when no usable primitive is found.
+    """
+    shapes: list[list[tuple[float, float]]] = []
+    tags: list[str] = []
+    width = 0.0
+    for prim in primitives.iter_children():
+        pts: list[tuple[float, float]] = []
+        if prim.tag == "gr_poly":
+            for xy_list in prim.find_children("pts"):
+                pts.extend(
+                    (xy.get_float(0) or 0.0, xy.get_float(1) or 0.0)
+                    for xy in xy_list.find_children("xy")
+                )
+        elif prim.tag in ("gr_rect", "gr_line"):
+            start, end = prim.find("start"), prim.find("end")
+            if start is None or end is None:
+                continue
+            x1, y1 = start.get_float(0) or 0.0, start.get_float(1) or 0.0
+            x2, y2 = end.get_float(0) or 0.0, end.get_float(1) or 0.0
+            if prim.tag == "gr_rect":
+                pts = [(x1, y1), (x2, y1), (x2, y2), (x1, y2)]
+            else:
+                pts = [(x1, y1), (x2, y2)]
+        elif prim.tag == "gr_circle":
+            center, end = prim.find("center"), prim.find("end")
+            if center is None or end is None:
+                continue
+            cx, cy = center.get_float(0) or 0.0, center.get_float(1) or 0.0
+            r = math.hypot((end.get_float(0) or 0.0) - cx, (end.get_float(1) or 0.0) - cy)
+            pts = [(cx - r, cy - r), (cx + r, cy - r), (cx + r, cy + r), (cx - r, cy + r)]
+        if not pts:
+            continue
+        shapes.append(pts)
+        tags.append(prim.tag)
+        stroke = prim.find("width")
+        if stroke is None and (stroke_node := prim.find("stroke")) is not None:
+            stroke = stroke_node.find("width")
+        if stroke is not None:
+            width = max(width, stroke.get_float(0) or 0.0)
+
+    if not shapes:
+        return [], 0.0
+    if anchor_circle:
+        r, step = size[0] / 2.0 / math.cos(math.pi / 8.0), math.pi / 4.0
+        anchor = [
+            (r * math.cos((k + 0.5) * step), r * math.sin((k + 0.5) * step)) for k in range(8)
+        ]
+    else:
+        hw, hh = size[0] / 2.0, size[1] / 2.0
+        anchor = [(-hw, -hh), (hw, -hh), (hw, hh), (-hw, hh)]
+    if (
+        tags == ["gr_poly"]
+        and len(set(shapes[0])) >= 3
+        and _polygon_covers(shapes[0], anchor)
+    ):
+        return shapes[0], width
+    hull = _convex_hull(anchor + [p for pts in shapes for p in pts])
+    return (hull, width) if len(hull) >= 3 else ([], 0.0)
+
+
 @dataclass
 class Pad:
     """Component pad."""
@@ -269,6 +404,11 @@ class Pad:
     # Corner-radius ratio for ``roundrect`` pads: radius = rratio * min(w, h).
     # KiCad's default is 0.25 when ``(roundrect_rratio ...)`` is absent.
     roundrect_rratio: float = 0.25
+    # Copper outline of a ``custom`` pad, pad-local and unrotated like
+    # ``position`` offsets (see ``_custom_pad_outline``); empty otherwise.
+    custom_outline: list[tuple[float, float]] = field(default_factory=list)
+    # Stroke width of the custom primitives: the outline grows by half of it.
+    custom_outline_width: float = 0.0
 
     @property
     def net(self) -> int:
@@ -306,6 +446,16 @@ class Pad:
             if value is not None:
                 pad.roundrect_rratio = value
 
+        # Custom pad copper outline
+        if pad.shape == "custom" and (primitives := sexp.find("primitives")):
+            options = sexp.find("options")
+            anchor = options.find("anchor") if options is not None else None
+            pad.custom_outline, pad.custom_outline_width = _custom_pad_outline(
+                primitives,
+                pad.size,
+                anchor_circle=anchor is not None and anchor.get_string(0) == "circle",
+            )
+
         # Layers
         if layers := sexp.find("layers"):
             pad.layers = [
@@ -84,7 +84,14 @@ class CopperElement:
     # analytic axis-aligned-rectangle formulas, which over-approximate
     # rounded corners and produce phantom sub-10um shorts (issue #3826).
     # ``None`` for segments and vias (which use the analytic disc path).
+    # Left unset when the native pad shape kernels are available; the
+    # fallback builds it from ``pad_shape`` on demand.
     polygon: object | None = None
+    # For pads: (shape, center_x, center_y, width, height, rotation_deg,
+    # roundrect_rratio, custom_outline, custom_outline_width) -- the inputs
+    # of the true outline, measured natively by
+    # ``drc_cpp.pad_shape_clearance``.  ``None`` otherwise.
+    pad_shape: tuple | None = None
 
     @classmethod
     def from_segment(cls, seg: Segment) -> CopperElement:
@@ -106,10 +113,29 @@ class CopperElement:
         # Transform pad dimensions to axis-aligned bounding box (retained
         # for the AABB-bounds fast path / location reporting).
         width, height = _transform_pad_dimensions(pad, footprint)
-        # Build the TRUE copper outline (roundrect/oval honored) so the
+        outline = _custom_outline_offsets(pad)
+        if len(outline) >= 3:
+            # A custom outline may reach past the anchor ``size``; the box
+            # stays centred on the pad, so it spans the farthest vertex.
+            stroke = getattr(pad, "custom_outline_width", 0.0)
+            width = max(width, 2.0 * max(abs(dx) for dx, _ in outline) + stroke)
+            height = max(height, 2.0 * max(abs(dy) for _, dy in outline) + stroke)
+        # Keep the TRUE copper outline (roundrect/oval honored) so the
         # pad-pad clearance path can use exact geometry instead of the
-        # over-approximating analytic AABB formulas (issue #3826).
-        polygon = _pad_polygon(pad, footprint)
+        # over-approximating analytic AABB formulas (issue #3826).  The
+        # shapely polygon is only built when there is no native kernel.
+        pad_shape = (
+            pad.shape,
+            abs_x,
+            abs_y,
+            pad.size[0],
+            pad.size[1],
+            getattr(pad, "rotation", 0.0),
+            getattr(pad, "roundrect_rratio", 0.25),
+            outline,
+            getattr(pad, "custom_outline_width", 0.0),
+        )
+        polygon = None if _native_pad_shapes() is not None else _shape_polygon(*pad_shape)
         return cls(
             element_type="pad",
             layer="*",  # Pads can span multiple layers
@@ -118,6 +144,7 @@ class CopperElement:
             reference=f"{footprint.reference}-{pad.number}",
             net_name=pad.net_name if pad.net_number != 0 else "",
             polygon=polygon,
+            pad_shape=pad_shape,
         )
 
     @classmethod
@@ -157,6 +184,21 @@ def _transform_pad_position(pad: Pad, footprint: Footprint) -> tuple[float, floa
     return abs_x, abs_y
 
 
+def _custom_outline_offsets(pad: Pad) -> tuple[tuple[float, float], ...]:
+    """Board-frame offsets of a ``custom`` pad's outline from its centre.
+
+    The pad-local outline turned by the pad's absolute orientation with the
+    same negated-angle convention as :func:`_transform_pad_position`.
+    Empty for every other shape.
+    """
+    if pad.shape != "custom":
+        return ()
+    rotation = getattr(pad, "rotation", 0.0)
+    return tuple(
+        _rotate_pad_offset(x, y, rotation) for x, y in getattr(pad, "custom_outline", ())
+    )
+
+
 def _transform_pad_dimensions(pad: Pad, footprint: Footprint) -> tuple[float, float]:
     """Transform pad dimensions to axis-aligned bounding box in board coordinates.
 
@@ -218,6 +260,8 @@ def _pad_polygon(pad: Pad, footprint: Footprint):
       semicircular caps on the minor axis).
     * ``roundrect`` -> rectangle with rounded corners of radius
       ``roundrect_rratio * min(w, h)`` (KiCad default ratio 0.25).
+    * ``custom`` with primitives -> the ``Pad.custom_outline`` polygon,
+      grown by half its stroke width.
     * ``rect`` (and any unknown shape) -> exact rectangle, with no
       over-approximation.
 
@@ -231,22 +275,50 @@ def _pad_polygon(pad: Pad, footprint: Footprint):
     Returns ``None`` for degenerate (non-positive) sizes so callers can
     skip them.
     """
+    cx, cy = _transform_pad_position(pad, footprint)
+    # pad.rotation is stored in the ABSOLUTE board frame (it already includes
+    # footprint.rotation per KiCad's file convention -- see Pad.rotation and
+    # issue #3902), so it is the pad shape's board-frame orientation directly.
+    return _shape_polygon(
+        pad.shape,
+        cx,
+        cy,
+        pad.size[0],  # LOCAL size -- the rotation orients the polygon
+        pad.size[1],
+        getattr(pad, "rotation", 0.0),
+        getattr(pad, "roundrect_rratio", 0.25),
+        _custom_outline_offsets(pad),
+        getattr(pad, "custom_outline_width", 0.0),
+    )
+
+
+def _shape_polygon(
+    shape: str,
+    cx: float,
+    cy: float,
+    w: float,
+    h: float,
+    total_rot: float,
+    rratio: float,
+    outline: tuple[tuple[float, float], ...] = (),
+    outline_width: float = 0.0,
+):
+    """Build the :func:`_pad_polygon` outline from a ``CopperElement.pad_shape``."""
     require_shapely("pad clearance geometry")
     import shapely
     from shapely.affinity import rotate, translate  # type: ignore[import-untyped]
-    from shapely.geometry import Point
+    from shapely.geometry import Point, Polygon
+
+    if shape == "custom" and len(outline) >= 3:
+        # Already turned by the pad orientation (_custom_outline_offsets).
+        poly = Polygon(outline)
+        if outline_width > 0:
+            poly = poly.buffer(outline_width / 2.0)
+        return translate(poly, cx, cy)
 
-    cx, cy = _transform_pad_position(pad, footprint)
-    w, h = pad.size  # LOCAL size -- the rotation below orients the polygon
     if w <= 0 or h <= 0:
         return None
 
-    # pad.rotation is stored in the ABSOLUTE board frame (it already includes
-    # footprint.rotation per KiCad's file convention -- see Pad.rotation and
-    # issue #3902), so it is the pad shape's board-frame orientation directly.
-    total_rot = getattr(pad, "rotation", 0.0)
-    shape = pad.shape
-
     if shape == "circle" or (shape in ("oval", "obround") and abs(w - h) < 1e-6):
         # Symmetric disc -- rotation and the (origin) translate are no-ops
         # on a circle, so build it directly at the board position.
@@ -263,8 +335,7 @@ def _pad_polygon(pad: Pad, footprint: Footprint):
             core = shapely.box(0.0, -(h / 2.0 - r), 0.0, (h / 2.0 - r))
         poly = core.buffer(r)
     elif shape == "roundrect":
-        rr = getattr(pad, "roundrect_rratio", 0.25)
-        r = rr * min(w, h)
+        r = rratio * min(w, h)
         if r <= 0:
             poly = shapely.box(-w / 2.0, -h / 2.0, w / 2.0, h / 2.0)
         else:
@@ -277,6 +348,16 @@ def _pad_polygon(pad: Pad, footprint: Footprint):
     return translate(poly, cx, cy)
 
 
+def _native_pad_shapes():
+    """Return ``drc_cpp`` when it has the exact pad shape kernels, else ``None``.
+
+    Imported lazily: ``kicad_tools.drc`` imports from ``validate.rules``.
+    """
+    from kicad_tools.drc.cpp_backend import drc_cpp, is_pad_shape_available
+
+    return drc_cpp if is_pad_shape_available() else None
+
+
 # _point_to_segment_distance and _segment_to_segment_distance are imported
 # from kicad_tools.core.geometry (consolidated in #2349).
 
@@ -670,13 +751,15 @@ def _rect_segment_centerline_distance(
 def _element_to_shapely_geom(elem: CopperElement):
     """Return a shapely geometry for a pad/via copper element.
 
-    Pads carry a precomputed ``polygon`` (true outline).  Vias (and any
-    element without a polygon) are represented as a circle buffered around
-    their center using the AABB diameter.  Returns ``None`` if no geometry
-    can be built.
+    Pads carry a precomputed ``polygon`` (true outline), or build it from
+    ``pad_shape``.  Vias (and any element without a polygon) are
+    represented as a circle buffered around their center using the AABB
+    diameter.  Returns ``None`` if no geometry can be built.
     """
     if elem.polygon is not None:
         return elem.polygon
+    if elem.pad_shape is not None:
+        return _shape_polygon(*elem.pad_shape)
     from shapely.geometry import Point
 
     x, y, w, h = elem.geometry
@@ -686,6 +769,47 @@ def _element_to_shapely_geom(elem: CopperElement):
     return Point(x, y).buffer(radius)
 
 
+def _native_shape(drc_cpp, elem: CopperElement):
+    """Return the ``drc_cpp.PadShape`` of a pad/via copper element.
+
+    Same outlines as :func:`_element_to_shapely_geom`; ``None`` when the
+    element has no copper.
+    """
+    from kicad_tools.drc.cpp_backend import PAD_SHAPE_CIRCLE, native_pad_shape
+
+    if elem.pad_shape is None:
+        x, y, w, h = elem.geometry
+        diameter = max(w, h)
+        if diameter <= 0:
+            return None
+        return drc_cpp.PadShape(PAD_SHAPE_CIRCLE, x, y, diameter, diameter)
+
+    shape, x, y, w, h, rotation_deg, rratio, outline, outline_width = elem.pad_shape
+    if (w <= 0 or h <= 0) and not (shape == "custom" and len(outline) >= 3):
+        return None
+    return native_pad_shape(shape, x, y, w, h, rotation_deg, rratio, outline, outline_width)
+
+
+def _native_pair_clearance(
+    c1: CopperElement, c2: CopperElement
+) -> tuple[float, float, float] | None:
+    """Exact native clearance between two pad/via copper shapes.
+
+    Rounded corners and oval caps are measured as true arcs (no polygon
+    approximation); overlaps report minus the penetration depth.  Returns
+    ``None`` without the native kernels or when a shape has no copper.
+    """
+    drc_cpp = _native_pad_shapes()
+    if drc_cpp is None:
+        return None
+    s1 = _native_shape(drc_cpp, c1)
+    s2 = _native_shape(drc_cpp, c2)
+    if s1 is None or s2 is None:
+        return None
+    result = drc_cpp.pad_shape_clearance(s1, s2)
+    return result.clearance, result.location_x, result.location_y
+
+
 def _polygon_pair_clearance(
     c1: CopperElement, c2: CopperElement
 ) -> tuple[float, float, float] | None:
@@ -746,11 +870,18 @@ def _circle_circle_clearance(c1: CopperElement, c2: CopperElement) -> tuple[floa
     x2, y2, w2, h2 = c2.geometry
 
     # Exact-geometry path: when at least one element is a pad with a true
-    # copper polygon, use shapely so rounded corners are modeled
-    # faithfully.  A circular via (no polygon) is represented as a
-    # buffered point; this keeps pad-via and pad-pad pairs exact.
-    if c1.polygon is not None or c2.polygon is not None:
-        result = _polygon_pair_clearance(c1, c2)
+    # copper outline, measure it natively (or with shapely as a fallback)
+    # so rounded corners are modeled faithfully.  A circular via is
+    # represented as a disc; this keeps pad-via and pad-pad pairs exact.
+    if (
+        c1.pad_shape is not None
+        or c2.pad_shape is not None
+        or c1.polygon is not None
+        or c2.polygon is not None
+    ):
+        result = _native_pair_clearance(c1, c2)
+        if result is None:
+            result = _polygon_pair_clearance(c1, c2)
         if result is not None:
             return result
 
@@ -907,10 +1038,18 @@ class ClearanceRule(DRCRule):
         # per-class threshold.  See Issue #2560.
         diff_pair_set = _build_diff_pair_set(pcb)
 
+        # The native copper engine runs every layer's pairwise pass at once
+        # (per-layer grid indexes, multithreaded) with the same skips and
+        # geometry as ``_check_layer``; without it, scan layer by layer.
+        native = self._check_layers_native(pcb, min_clearance, diff_pair_set)
+
         # Process each copper layer
         for layer in pcb.copper_layers:
             layer_name = layer.name
-            violations = self._check_layer(pcb, layer_name, min_clearance, diff_pair_set)
+            if native is not None:
+                violations = native.get(layer_name, [])
+            else:
+                violations = self._check_layer(pcb, layer_name, min_clearance, diff_pair_set)
             for v in violations:
                 results.add(v)
 
@@ -1026,6 +1165,19 @@ class ClearanceRule(DRCRule):
                     ):
                         continue
 
+                # Pad/via broadphase: the discs circumscribing each
+                # element's AABB bound the exact clearance from below, so
+                # a pair whose discs already clear never reaches the
+                # exact outline test.
+                if elem1.element_type != "segment" and elem2.element_type != "segment":
+                    x1, y1, w1, h1 = elem1.geometry
+                    x2, y2, w2, h2 = elem2.geometry
+                    lower_bound = math.hypot(x2 - x1, y2 - y1) - (
+                        math.hypot(w1, h1) / 2 + math.hypot(w2, h2) / 2
+                    )
+                    if lower_bound + DRC_TOLERANCE >= min_clearance:
+                        continue
+
                 # Calculate clearance
                 clearance, loc_x, loc_y = _calculate_clearance(elem1, elem2)
 
@@ -1038,6 +1190,47 @@ class ClearanceRule(DRCRule):
 
         return violations
 
+    def _check_layers_native(
+        self,
+        pcb: PCB,
+        min_clearance: float,
+        diff_pair_set: set[tuple[int, int]],
+    ) -> dict[str, list[DRCViolation]] | None:
+        """Run ``_check_layer`` for every copper layer in one native call.
+
+        Returns violations grouped by layer name, in ``_check_layer``'s
+        order, or ``None`` when the native copper engine is unavailable
+        or the board has more copper layers than it indexes.
+        """
+        from kicad_tools.drc.cpp_backend import (
+            CHECK_CLEARANCE,
+            CopperBoardItems,
+            is_copper_drc_available,
+            run_copper_drc_cpp,
+        )
+
+        if not is_copper_drc_available() or len(pcb.copper_layers) > 64:
+            return None
+        items = CopperBoardItems(pcb, CHECK_CLEARANCE)
+        raw = run_copper_drc_cpp(
+            items, min_clearance, checks=CHECK_CLEARANCE, exempt_net_pairs=diff_pair_set
+        )
+        by_layer: dict[str, list[DRCViolation]] = {}
+        for v in raw:
+            layer_name = items.layers[v.layer]
+            by_layer.setdefault(layer_name, []).append(
+                self._create_violation(
+                    items.element(v.type1, v.index1),
+                    items.element(v.type2, v.index2),
+                    v.actual,
+                    v.required,
+                    layer_name,
+                    v.location_x,
+                    v.location_y,
+                )
+            )
+        return by_layer
+
     def _collect_elements(self, pcb: PCB, layer_name: str) -> list[CopperElement]:
         """Collect all copper elements on a layer."""
         elements: list[CopperElement] = []
@@ -1390,6 +1583,37 @@ def _collect_zone_fills(pcb: PCB) -> dict[str, list[_ZoneFill]]:
     return fills_by_layer
 
 
+def _native_zone_violations(
+    pcb: PCB, min_clearance: float, kinds: tuple[int, ...]
+) -> list[DRCViolation] | None:
+    """Zone fill clearance of the ``kinds`` copper items in one native pass.
+
+    ``kinds`` are ``drc.cpp_backend.COPPER_*`` item types.  The engine
+    resolves fill nets and skips same-net and net-0 pairs as
+    :func:`_collect_zone_fills` and the zone rules do.  Returns ``None``
+    when the native copper engine is unavailable or the board has more
+    copper layers than it indexes.
+    """
+    from kicad_tools.drc.cpp_backend import (
+        CHECK_ZONE,
+        COPPER_PAD,
+        CopperBoardItems,
+        _zone_violation,
+        is_copper_drc_available,
+        run_copper_drc_cpp,
+    )
+
+    if not is_copper_drc_available() or len(pcb.copper_layers) > 64:
+        return None
+    items = CopperBoardItems(pcb, CHECK_ZONE, include_pads=COPPER_PAD in kinds)
+    if not items.zones:
+        return []
+    raw = run_copper_drc_cpp(items, min_clearance, checks=CHECK_ZONE)
+    return [
+        _zone_violation(items, v, items.layers[v.layer]) for v in raw if v.type1 in kinds
+    ]
+
+
 class SegmentZoneClearanceRule(DRCRule):
     """Check track segments against foreign-net zone fill copper.
 
@@ -1423,7 +1647,9 @@ class SegmentZoneClearanceRule(DRCRule):
     per layer; each segment only visits fills whose bounding box
     intersects its inflated bbox, and all distance math is exact
     shapely C geometry (no centerline sampling), so the rule is safe
-    to run inside CI gates on large boards.
+    to run inside CI gates on large boards.  With the native copper
+    engine built the pass runs in ``drc_cpp`` instead
+    (:func:`_native_zone_violations`).
     """
 
     rule_id = "clearance_segment_zone"
@@ -1445,6 +1671,17 @@ class SegmentZoneClearanceRule(DRCRule):
             DRCResults containing segment-vs-zone-fill shorts and
             clearance violations
         """
+        results = DRCResults()
+        results.rules_checked = 1
+
+        from kicad_tools.drc.cpp_backend import COPPER_SEGMENT
+
+        native = _native_zone_violations(pcb, design_rules.min_clearance_mm, (COPPER_SEGMENT,))
+        if native is not None:
+            for v in native:
+                results.add(v)
+            return results
+
         # shapely is a core dependency (issue #3824).  Guard up front so a
         # broken/partial install fails with an actionable install hint
         # instead of a raw ``ModuleNotFoundError`` deep inside the geometry
@@ -1452,9 +1689,6 @@ class SegmentZoneClearanceRule(DRCRule):
         # missing shapely would otherwise let through silently.
         require_shapely("zone-vs-segment clearance DRC")
 
-        results = DRCResults()
-        results.rules_checked = 1
-
         fills_by_layer = self._collect_fills(pcb)
         if not fills_by_layer:
             return results
@@ -1613,7 +1847,8 @@ class ViaZoneClearanceRule(DRCRule):
     The rule_id is ``clearance_via_zone`` for vias and ``clearance_pad_zone``
     for pads, so the existing strict CI gate (which counts every blocking
     ``clearance_*`` violation ``kct check`` reports) picks them up with no
-    allowlist surgery.
+    allowlist surgery.  Like the sibling rule, it hands the pass to the
+    native copper engine when that is built.
     """
 
     rule_id = "clearance_via_zone"
@@ -1635,15 +1870,25 @@ class ViaZoneClearanceRule(DRCRule):
             DRCResults containing via/pad-vs-zone-fill shorts and
             clearance violations.
         """
+        results = DRCResults()
+        results.rules_checked = 1
+
+        from kicad_tools.drc.cpp_backend import COPPER_PAD, COPPER_VIA
+
+        native = _native_zone_violations(
+            pcb, design_rules.min_clearance_mm, (COPPER_VIA, COPPER_PAD)
+        )
+        if native is not None:
+            for v in native:
+                results.add(v)
+            return results
+
         # shapely is a core dependency (issue #3824).  Guard up front so a
         # broken/partial install fails with an actionable install hint
         # instead of a raw ``ModuleNotFoundError`` deep inside the geometry
         # query.
         require_shapely("zone-vs-via/pad clearance DRC")
 
-        results = DRCResults()
-        results.rules_checked = 1
-
         fills_by_layer = _collect_zone_fills(pcb)
         if not fills_by_layer:
             return results
@@ -193,6 +193,12 @@ class DimensionRules(DRCRule):
         """
         min_clearance = design_rules.min_hole_to_hole_mm
 
+        native = self._check_drill_clearance_native(pcb, min_clearance)
+        if native is not None:
+            for violation in native:
+                results.add(violation)
+            return
+
         # Collect all drill holes: vias + through-hole pads
         # Each entry: (position, drill_diameter, item_description,
         #              footprint_reference, net_name)
@@ -292,3 +298,30 @@ class DimensionRules(DRCRule):
                             nets=(net1, net2),
                         )
                     )
+
+    def _check_drill_clearance_native(
+        self,
+        pcb: PCB,
+        min_clearance: float,
+    ) -> list[DRCViolation] | None:
+        """Run :meth:`_check_drill_clearance` in the native copper engine.
+
+        The drill pseudo-layer is indexed once, so the pass is not
+        quadratic in the hole count.  Returns ``None`` when the engine is
+        unavailable or the board has more copper layers than it indexes.
+        """
+        from kicad_tools.drc.cpp_backend import (
+            CHECK_HOLE_TO_HOLE,
+            CopperBoardItems,
+            _hole_to_hole_violation,
+            is_copper_drc_available,
+            run_copper_drc_cpp,
+        )
+
+        if not is_copper_drc_available() or len(pcb.copper_layers) > 64:
+            return None
+        items = CopperBoardItems(pcb, CHECK_HOLE_TO_HOLE)
+        raw = run_copper_drc_cpp(
+            items, 0.0, min_hole_to_hole=min_clearance, checks=CHECK_HOLE_TO_HOLE
+        )
+        return [_hole_to_hole_violation(items, v) for v in raw]
@@ -26,6 +26,10 @@ polygon difference.  ``shapely`` is a core dependency (issue #3824); if it
 is ever unavailable (a broken/partial install) the correctness-critical
 entry points fail **loud** via :func:`kicad_tools._shapely.require_shapely`
 rather than silently returning a non-clearance-correct fill.
+
+When the C++ DRC backend is built, every fill is carved in one batched
+native pass (``drc_cpp.carve_zone_fills``) against the obstacles' exact
+outlines; shapely carves any fill the native engine declines.
 """
 
 from __future__ import annotations
@@ -53,6 +57,13 @@ class _Geometry(Protocol):
     def intersects(self, other: Any) -> bool: ...
 
 
+# drc_cpp PadShape kinds (kicad_tools.drc.cpp_backend.PAD_SHAPE_*), spelled
+# out so collecting obstacles does not import the DRC package.
+_NATIVE_CIRCLE = 0
+_NATIVE_RECT = 1
+_NATIVE_OVAL = 3
+
+
 @dataclass(frozen=True)
 class _Obstacle:
     """A foreign-net copper obstacle to subtract from a fill polygon."""
@@ -65,6 +76,9 @@ class _Obstacle:
     # (``None`` for vias).  Lets the isolated-island remediator set a per-pad
     # ``zone_connect`` override on the exact pad that stranded a sliver.
     source_pad: SExp | None = None
+    # The same copper as native PadShape parameters ``(kind, x, y, width,
+    # height, rotation_rad)`` for the C++ carving path.
+    native: tuple[int, float, float, float, float, float] | None = None
 
 
 def _build_net_name_map(doc: SExp) -> dict[int, str]:
@@ -206,6 +220,7 @@ def _collect_obstacles(
                     layers=tuple(pad_layers),
                     shape=shape,
                     source_pad=pad,
+                    native=(_NATIVE_RECT, abs_x, abs_y, box_w, box_h, 0.0),
                 )
             )
 
@@ -234,7 +249,14 @@ def _collect_obstacles(
             else ["F.Cu", "B.Cu"]
         )
         shape = Point(cx, cy).buffer(diameter / 2.0)
-        obstacles.append(_Obstacle(net_key=net_key, layers=tuple(via_layers), shape=shape))
+        obstacles.append(
+            _Obstacle(
+                net_key=net_key,
+                layers=tuple(via_layers),
+                shape=shape,
+                native=(_NATIVE_CIRCLE, cx, cy, diameter, diameter, 0.0),
+            )
+        )
 
     # --- Track segments (top level) ---
     # A foreign-net trace routed across a pour is copper the fill must clear,
@@ -265,11 +287,27 @@ def _collect_obstacles(
         if width <= 0:
             continue
         shape = LineString([(sx, sy), (ex, ey)]).buffer(width / 2.0)
-        obstacles.append(_Obstacle(net_key=net_key, layers=(layer,), shape=shape))
+        native = _track_shape(sx, sy, ex, ey, width)
+        obstacles.append(_Obstacle(net_key=net_key, layers=(layer,), shape=shape, native=native))
 
     return obstacles
 
 
+def _track_shape(
+    sx: float, sy: float, ex: float, ey: float, width: float
+) -> tuple[int, float, float, float, float, float]:
+    """A track as a native stadium: centreline length plus round caps."""
+    length = math.hypot(ex - sx, ey - sy)
+    return (
+        _NATIVE_OVAL,
+        (sx + ex) / 2.0,
+        (sy + ey) / 2.0,
+        length + width,
+        width,
+        math.atan2(ey - sy, ex - sx),
+    )
+
+
 def _axis_aligned_box_dims(w: float, h: float, rotation_deg: float) -> tuple[float, float]:
     """Axis-aligned bounding-box dimensions of a rotated rectangle.
 
@@ -928,16 +966,58 @@ def apply_foreign_pad_clearance(
     """
     require_shapely("foreign-net pad clearance carving")
     import shapely
-    from shapely import make_valid
-    from shapely.geometry import Polygon
 
     name_map = _build_net_name_map(doc)
     obstacles = _collect_obstacles(doc, shapely, name_map)
     if not obstacles:
         return 0
 
+    fills = _collect_fills(doc, name_map, default_clearance)
+    # One batched native pass when the C++ backend is built; any fill it
+    # cannot take (beyond its integer grid) is carved with shapely below.
+    native = _carve_fills_native(doc, name_map, obstacles, fills)
+
     modified = 0
+    for k, fill in enumerate(fills):
+        if native is not None and native[k] is not None:
+            rings = native[k]
+        else:
+            rings = _carve_fill_shapely(doc, shapely, name_map, obstacles, fill)
+        if not rings:
+            continue
+
+        _replace_pts(fill.filled, rings[0])
+        modified += 1
+
+        for extra_ring in rings[1:]:
+            clone = SExp.list("filled_polygon")
+            if fill.has_layer_node:
+                clone.append(SExp.list("layer", fill.layer))
+            clone.append(_ring_to_xy_node(extra_ring))
+            fill.zone.append(clone)
+            modified += 1
+
+    return modified
+
+
+@dataclass(frozen=True)
+class _Fill:
+    """A committed ``filled_polygon`` queued for antipad carving."""
+
+    zone: SExp
+    filled: SExp
+    layer: str
+    # Whether the node carries its own ``(layer ...)`` (copied onto clones).
+    has_layer_node: bool
+    net_key: str
+    # ``clearance + min_thickness / 2`` of the owning zone.
+    antipad: float
+    ring: list[tuple[float, float]]
+
 
+def _collect_fills(doc: SExp, name_map: dict[int, str], default_clearance: float) -> list[_Fill]:
+    """Gather every net-assigned zone's ``filled_polygon`` rings."""
+    fills: list[_Fill] = []
     for zone in doc.find_all("zone"):
         zone_net = _net_key(zone.find("net"), name_map)
         # Keepout / unassigned zones carry net 0 and no fill copper to
@@ -981,106 +1061,199 @@ def apply_foreign_pad_clearance(
             ]
             if len(ring) < 3:
                 continue
+            fills.append(
+                _Fill(
+                    zone=zone,
+                    filled=filled,
+                    layer=fill_layer,
+                    has_layer_node=layer_node is not None,
+                    net_key=zone_net,
+                    antipad=buffer_dist,
+                    ring=ring,
+                )
+            )
+    return fills
 
-            fill_poly = Polygon(ring)
-            if not fill_poly.is_valid:
-                # KiCad encodes thermal/pad cut-outs as a self-touching
-                # single ring; make_valid reconstructs the holed polygon
-                # without dropping copper lobes (buffer(0) can).  This
-                # matches the DRC's _repair_fill_polygon so our subtraction
-                # operates on the same geometry the check measures.
-                fill_poly = make_valid(fill_poly)
-            if fill_poly.is_empty:
-                continue
 
-            # Union the foreign-net antipads that actually touch this fill.
-            # Buffering each obstacle by buffer_dist guarantees the carved
-            # gap is at least the zone clearance.  Skip obstacles whose
-            # buffered footprint does not reach the fill so untouched fills
-            # are left byte-for-byte unchanged (no spurious geometry churn).
-            cutters = []
-            for obs in obstacles:
-                if obs.net_key == zone_net:
-                    continue
-                if not _obstacle_on_layer(obs, fill_layer):
-                    continue
-                buffered = obs.shape.buffer(buffer_dist)
-                if buffered.intersects(fill_poly):
-                    cutters.append(buffered)
-            if not cutters:
-                continue
+def _carve_fills_native(
+    doc: SExp,
+    name_map: dict[int, str],
+    obstacles: list[_Obstacle],
+    fills: list[_Fill],
+) -> list[list[list[tuple[float, float]]] | None] | None:
+    """Carve every fill in one native call (``drc_cpp.carve_zone_fills``).
+
+    Runs the same stage as :func:`_carve_fill_shapely` -- subtract, vent,
+    drop islands, gate -- with the obstacles' exact outlines grown by the
+    antipad.  Returns, per fill, the rings replacing it (``[]`` to leave it
+    untouched) or ``None`` where the native engine declined and shapely
+    must decide.  Returns ``None`` outright when the backend is not built.
+    """
+    from kicad_tools.drc import cpp_backend
 
-            cut_union = shapely.unary_union(cutters)
-            # Only rewrite a fill whose copper actually intrudes within
-            # clearance of a foreign obstacle.  ``buffer_dist`` already
-            # encodes the clearance, so a positive-area intersection of the
-            # raw fill with the buffered cutters is exactly "this fill has a
-            # real violation to fix".  Fills that merely sit *near* an
-            # obstacle (the intersects() pre-filter above) but keep adequate
-            # clearance are left byte-for-byte unchanged.
-            if fill_poly.intersection(cut_union).area <= _AREA_EPS:
-                continue
+    if not fills or not cpp_backend.is_zone_fill_available():
+        return None
 
-            result = fill_poly.difference(cut_union)
-            parts = _result_polygons(result)
-            if not parts:
-                # Subtracting everything would leave no copper; leave the
-                # original fill untouched rather than delete it (the zone
-                # was intentionally placed and an empty fill is worse than
-                # a tight one — this should not happen for real boards).
-                continue
+    # Fill layers become bits of the obstacle layer masks.
+    layer_bits: dict[str, int] = {}
+    for fill in fills:
+        layer_bits.setdefault(fill.layer, len(layer_bits))
+    if len(layer_bits) > 64:
+        return None
+    net_ids: dict[str, int] = {}
 
-            # The difference keeps the original thermal/pad holes AND adds
-            # the new foreign-net antipads as holes.  KiCad fill rings can't
-            # carry holes, so vent every hole out to the exterior with a
-            # hair-thin slit, producing simply-connected polygons; emit one
-            # filled_polygon per resulting region, all on the original layer.
-            rings: list[list[tuple[float, float]]] = []
-            for part in parts:
-                for vented in _vent_holes(part):
-                    rings.append(_strip_close(list(vented.exterior.coords)))
-            rings = [r for r in rings if len(r) >= 3]
-            if not rings:
-                continue
+    def net_id(key: str) -> int:
+        return net_ids.setdefault(key, len(net_ids) + 1)
 
-            # Island removal (matches KiCad ``island_removal_mode 0``).
-            # Subtracting the foreign antipads — and venting the resulting
-            # holes out to the exterior — can shed thin sliver lobes that are
-            # no longer electrically tied to the pour.  Emitting them produces
-            # ``isolated_copper`` warnings (the board-06 split-fill regression
-            # class).  Keep only rings that overlap a same-net pad/via/track so
-            # the rewritten pour stays a single connected copper component.
-            if len(rings) > 1:
-                anchors = _collect_same_net_anchors(doc, shapely, name_map, zone_net, fill_layer)
-                rings = _keep_connected_rings(rings, anchors, Polygon)
-
-            # Safety gate: reconstruct exactly what the DRC will read from
-            # the rewritten rings (via the same _repair_fill_polygon path)
-            # and accept the rewrite ONLY when it (a) removes the foreign
-            # overlap and (b) adds no copper the original fill did not have
-            # (no spurious lobe from a degenerate vent).  If the re-encode
-            # is not faithful, leave the original fill untouched so the
-            # correction can only ever improve a board, never regress it.
-            recon = _reconstruct_fill(rings, make_valid)
-            if recon is None or recon.is_empty:
-                continue
-            if recon.intersection(cut_union).area > _AREA_EPS:
-                continue  # still overlaps a foreign antipad -> reject
-            if recon.difference(fill_poly).area > _AREA_EPS:
-                continue  # gained copper outside the original -> reject
+    def mask(obs: _Obstacle) -> int:
+        return sum(1 << bit for layer, bit in layer_bits.items() if _obstacle_on_layer(obs, layer))
 
-            _replace_pts(filled, rings[0])
-            modified += 1
+    rows = []
+    for obs in obstacles:
+        if obs.native is None:
+            return None
+        rows.append((*obs.native, mask(obs), net_id(obs.net_key), True))
 
-            for extra_ring in rings[1:]:
-                clone = SExp.list("filled_polygon")
-                if layer_node is not None:
-                    clone.append(SExp.list("layer", fill_layer))
-                clone.append(_ring_to_xy_node(extra_ring))
-                zone.append(clone)
-                modified += 1
+    # Zero-width tracks are no obstacle, but still tie their net's islands
+    # (the shapely path anchors them as bare centrelines).
+    for seg in doc.find_all("segment"):
+        net_key = _net_key(seg.find("net"), name_map)
+        layer_node = seg.find("layer")
+        layer = layer_node.get_string(0) if layer_node is not None else None
+        if net_key is None or layer not in layer_bits:
+            continue
+        width_node = seg.find("width")
+        width = (width_node.get_float(0) if width_node is not None else None) or 0.0
+        start = seg.find("start")
+        end = seg.find("end")
+        if width > 0 or start is None or end is None:
+            continue
+        native = _track_shape(
+            start.get_float(0) or 0.0,
+            start.get_float(1) or 0.0,
+            end.get_float(0) or 0.0,
+            end.get_float(1) or 0.0,
+            0.0,
+        )
+        rows.append((*native, 1 << layer_bits[layer], net_id(net_key), False))
 
-    return modified
+    results = cpp_backend.carve_zone_fills_cpp(
+        [(fill.ring, layer_bits[fill.layer], net_id(fill.net_key), fill.antipad) for fill in fills],
+        rows,
+        slit_width=_SLIT_WIDTH_MM,
+        area_epsilon=_AREA_EPS,
+    )
+    out: list[list[list[tuple[float, float]]] | None] = []
+    for status, rings in results:
+        if status == cpp_backend.ZONE_FILL_UNSUPPORTED:
+            out.append(None)
+        elif status == cpp_backend.ZONE_FILL_CARVED:
+            out.append(rings)
+        else:
+            out.append([])
+    return out
+
+
+def _carve_fill_shapely(
+    doc: SExp,
+    shapely_mod,
+    name_map: dict[int, str],
+    obstacles: list[_Obstacle],
+    fill: _Fill,
+) -> list[list[tuple[float, float]]] | None:
+    """Carve one fill with shapely; ``None`` leaves it untouched."""
+    from shapely import make_valid
+    from shapely.geometry import Polygon
+
+    fill_poly = Polygon(fill.ring)
+    if not fill_poly.is_valid:
+        # KiCad encodes thermal/pad cut-outs as a self-touching
+        # single ring; make_valid reconstructs the holed polygon
+        # without dropping copper lobes (buffer(0) can).  This
+        # matches the DRC's _repair_fill_polygon so our subtraction
+        # operates on the same geometry the check measures.
+        fill_poly = make_valid(fill_poly)
+    if fill_poly.is_empty:
+        return None
+
+    # Union the foreign-net antipads that actually touch this fill.
+    # Buffering each obstacle by the antipad distance guarantees the carved
+    # gap is at least the zone clearance.  Skip obstacles whose
+    # buffered footprint does not reach the fill so untouched fills
+    # are left byte-for-byte unchanged (no spurious geometry churn).
+    cutters = []
+    for obs in obstacles:
+        if obs.net_key == fill.net_key:
+            continue
+        if not _obstacle_on_layer(obs, fill.layer):
+            continue
+        buffered = obs.shape.buffer(fill.antipad)
+        if buffered.intersects(fill_poly):
+            cutters.append(buffered)
+    if not cutters:
+        return None
+
+    cut_union = shapely_mod.unary_union(cutters)
+    # Only rewrite a fill whose copper actually intrudes within
+    # clearance of a foreign obstacle.  The antipad distance already
+    # encodes the clearance, so a positive-area intersection of the
+    # raw fill with the buffered cutters is exactly "this fill has a
+    # real violation to fix".  Fills that merely sit *near* an
+    # obstacle (the intersects() pre-filter above) but keep adequate
+    # clearance are left byte-for-byte unchanged.
+    if fill_poly.intersection(cut_union).area <= _AREA_EPS:
+        return None
+
+    result = fill_poly.difference(cut_union)
+    parts = _result_polygons(result)
+    if not parts:
+        # Subtracting everything would leave no copper; leave the
+        # original fill untouched rather than delete it (the zone
+        # was intentionally placed and an empty fill is worse than
+        # a tight one — this should not happen for real boards).
+        return None
+
+    # The difference keeps the original thermal/pad holes AND adds
+    # the new foreign-net antipads as holes.  KiCad fill rings can't
+    # carry holes, so vent every hole out to the exterior with a
+    # hair-thin slit, producing simply-connected polygons; emit one
+    # filled_polygon per resulting region, all on the original layer.
+    rings: list[list[tuple[float, float]]] = []
+    for part in parts:
+        for vented in _vent_holes(part):
+            rings.append(_strip_close(list(vented.exterior.coords)))
+    rings = [r for r in rings if len(r) >= 3]
+    if not rings:
+        return None
+
+    # Island removal (matches KiCad ``island_removal_mode 0``).
+    # Subtracting the foreign antipads — and venting the resulting
+    # holes out to the exterior — can shed thin sliver lobes that are
+    # no longer electrically tied to the pour.  Emitting them produces
+    # ``isolated_copper`` warnings (the board-06 split-fill regression
+    # class).  Keep only rings that overlap a same-net pad/via/track so
+    # the rewritten pour stays a single connected copper component.
+    if len(rings) > 1:
+        anchors = _collect_same_net_anchors(
+            doc, shapely_mod, name_map, fill.net_key, fill.layer
+        )
+        rings = _keep_connected_rings(rings, anchors, Polygon)
+
+    # Safety gate: reconstruct exactly what the DRC will read from
+    # the rewritten rings (via the same _repair_fill_polygon path)
+    # and accept the rewrite ONLY when it (a) removes the foreign
+    # overlap and (b) adds no copper the original fill did not have
+    # (no spurious lobe from a degenerate vent).  If the re-encode
+    # is not faithful, leave the original fill untouched so the
+    # correction can only ever improve a board, never regress it.
+    recon = _reconstruct_fill(rings, make_valid)
+    if recon is None or recon.is_empty:
+        return None
+    if recon.intersection(cut_union).area > _AREA_EPS:
+        return None  # still overlaps a foreign antipad -> reject
+    if recon.difference(fill_poly).area > _AREA_EPS:
+        return None  # gained copper outside the original -> reject
+    return rings
 
 
 def _reconstruct_fill(rings, make_valid_fn):
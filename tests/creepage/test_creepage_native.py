@@ -0,0 +1,109 @@
+"""Tests for the native creepage matrix (``drc_cpp.creepage_matrix``).
+
+The census measures every HV pair in one native call over a shared slot
+visibility graph when the C++ backend is built.  Without a slot it must
+report exactly what the shapely surface paths report; with one, it is the
+true shortest surface path, so it never exceeds the shapely nearest-points
+detour and never drops below the clearance.
+"""
+
+from __future__ import annotations
+
+import math
+
+import pytest
+
+from kicad_tools._shapely import has_shapely
+from kicad_tools.creepage.engine import (
+    _edge_line_segments,
+    board_slot_obstacles,
+    compute_creepage_census,
+    resolve_hv_nets,
+)
+from kicad_tools.drc.cpp_backend import (
+    CHECK_ZONE,
+    CopperBoardItems,
+    creepage_matrix_cpp,
+    is_creepage_available,
+)
+
+from .fixtures import board_same_footprint_fail_source, board_source
+
+pytestmark = [
+    pytest.mark.skipif(not has_shapely(), reason="creepage requires shapely"),
+    pytest.mark.skipif(not is_creepage_available(), reason="C++ DRC creepage matrix not built"),
+]
+
+
+def _load(tmp_path, source):
+    from kicad_tools.schema.pcb import PCB
+
+    p = tmp_path / "board.kicad_pcb"
+    p.write_text(source)
+    return PCB.load(p)
+
+
+def _census(pcb, monkeypatch=None):
+    from kicad_tools.router.rules import net_class_map_from_dict
+
+    hv = resolve_hv_nets(pcb, "HV", net_class_map_from_dict({"L_MAINS": {"name": "HV"}}))
+    if monkeypatch is not None:
+        monkeypatch.setattr("kicad_tools.drc.cpp_backend.is_creepage_available", lambda: False)
+    report = compute_creepage_census(pcb, hv, min_mm=1.0)
+    return {(p.net_a, p.net_b): p for p in report.pairs}
+
+
+def _matrix(pcb, num_threads=0):
+    obstacles = board_slot_obstacles(pcb)
+    return creepage_matrix_cpp(
+        CopperBoardItems(pcb, CHECK_ZONE),
+        [net.number for net in pcb.nets.values() if net.number],
+        [(a, b) for a, b in _edge_line_segments(pcb) if math.dist(a, b) > 1e-9],
+        [list(obs.exterior.coords)[:-1] for obs in obstacles],
+        num_threads=num_threads,
+    )
+
+
+@pytest.mark.parametrize(
+    "source", [board_source(with_slot=False), board_same_footprint_fail_source()]
+)
+def test_census_matches_shapely_without_slots(tmp_path, monkeypatch, source):
+    pcb = _load(tmp_path, source)
+    native = _census(pcb)
+    python = _census(pcb, monkeypatch)
+
+    assert native.keys() == python.keys()
+    for key, pair in native.items():
+        ref = python[key]
+        assert (pair.kind, pair.layer, pair.relationship) == (ref.kind, ref.layer, ref.relationship)
+        assert pair.clearance_mm == pytest.approx(ref.clearance_mm, abs=1e-6)
+        assert pair.creepage_mm == pytest.approx(ref.creepage_mm, abs=1e-6)
+
+
+def test_census_slot_detour_is_no_longer_than_shapely(tmp_path, monkeypatch):
+    pcb = _load(tmp_path, board_source(with_slot=True))
+    native = _census(pcb)
+    python = _census(pcb, monkeypatch)
+
+    pair = native[("L_MAINS", "GND")]
+    assert pair.clearance_mm == pytest.approx(18.0, abs=1e-6)
+    # Pad corner (111, 109) -> slot corners (119.8, 103), (120.2, 103) -> (129, 109).
+    assert pair.creepage_mm == pytest.approx(2 * math.hypot(8.8, 6.0) + 0.4, abs=1e-6)
+    assert pair.clearance_mm < pair.creepage_mm <= python[("L_MAINS", "GND")].creepage_mm + 1e-6
+
+
+def test_matrix_is_symmetric_and_thread_invariant(tmp_path):
+    pcb = _load(tmp_path, board_same_footprint_fail_source())
+    one = _matrix(pcb, num_threads=1)
+    many = _matrix(pcb, num_threads=4)
+    assert list(one.creepage) == list(many.creepage)
+    assert list(one.layer) == list(many.layer)
+
+    nets = list(one.nets)
+    assert list(one.sources) == nets
+    n = len(nets)
+    for i in range(n):
+        assert math.isinf(one.creepage[i * n + i])
+        for j in range(n):
+            assert one.creepage[i * n + j] == pytest.approx(one.creepage[j * n + i], abs=1e-9)
+            assert one.clearance[i * n + j] <= one.creepage[i * n + j]
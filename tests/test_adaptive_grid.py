@@ -172,6 +172,13 @@ class TestAdaptiveGridRouter:
         router = AdaptiveGridRouter(grid, rules, fine_pitch_threshold=0.5)
         assert router.fine_pitch_threshold == 0.5
 
+    def test_single_search_needs_native_router(self):
+        """single_search falls back to the two-phase escape without CppPathfinder."""
+        grid, rules = make_grid_and_rules()
+        router = AdaptiveGridRouter(grid, rules, single_search=True)
+        assert router.single_search
+        assert not router.uses_single_search
+
     def test_phase1_detects_fine_pitch(self):
         """Phase 1 should detect and escape fine-pitch pads."""
         grid, rules = make_grid_and_rules()
@@ -0,0 +1,139 @@
+"""Tests for native blocker identification (``Grid3D.collect_blocking_nets``).
+
+``CppPathfinder.find_blocking_nets`` and ``find_blocking_nets_relaxed`` used
+to walk the failed net's corridor in Python (layers x path cells x clearance
+square).  Both now delegate to ``Grid3D::collect_blocking_nets``, which walks
+the corridor with Bresenham plus the circular clearance kernel and returns
+per-net conflict-cell counts.
+
+These tests cover:
+
+1. Strict mode only reports routed copper (``usage_count > 0``) and skips
+   the source net, net 0 and the diff-pair partner.
+2. Relaxed mode reads the caller's saved snapshots and skips pad metal.
+3. Via cells are inspected on every layer.
+4. Counts are distinct cells (overlapping kernels are deduplicated).
+5. The ``CppPathfinder`` wrappers still return sets and expose the counts.
+"""
+
+from __future__ import annotations
+
+import numpy as np
+import pytest
+
+from kicad_tools.router.cpp_backend import (
+    CppGrid,
+    CppPathfinder,
+    is_cpp_available,
+)
+from kicad_tools.router.layers import Layer
+from kicad_tools.router.primitives import Pad
+from kicad_tools.router.rules import DesignRules
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+
+def _routed_cell(grid, x: int, y: int, layer: int, net: int) -> None:
+    """Mark a single cell as routed copper of ``net`` (blocked + used)."""
+    grid._impl.mark_segment(x, y, x, y, layer, net, 0)
+    grid._impl.increment_usage(x, y, layer)
+
+
+def test_strict_counts_routed_foreign_cells_only():
+    grid = CppGrid(cols=20, rows=10, layers=2, resolution=0.1)
+    # Routed foreign copper on the direct line.
+    _routed_cell(grid, 10, 5, 0, 7)
+    _routed_cell(grid, 11, 5, 0, 7)
+    # Static blockage (usage 0) must not be reported in strict mode.
+    grid._impl.mark_blocked(5, 5, 0, 8)
+    # Source net and partner net copper are never blockers.
+    _routed_cell(grid, 12, 5, 0, 1)
+    _routed_cell(grid, 13, 5, 0, 2)
+
+    counts = grid._impl.collect_blocking_nets([(0, 5, 19, 5, 0)], [], 1, False, 1, 2)
+
+    assert counts == [(7, 2)]
+
+
+def test_strict_uses_circular_kernel():
+    grid = CppGrid(cols=20, rows=20, layers=1, resolution=0.1)
+    # Diagonal corner of the radius-2 square: dx=2, dy=2 (dist^2 = 8 > 4).
+    _routed_cell(grid, 12, 12, 0, 9)
+    # Axis-aligned edge of the disc: dx=0, dy=2 (dist^2 = 4).
+    _routed_cell(grid, 10, 12, 0, 4)
+
+    counts = grid._impl.collect_blocking_nets([(10, 10, 10, 10, 0)], [], 2, False, 1)
+
+    assert counts == [(4, 1)]
+
+
+def test_relaxed_reads_saved_snapshot_and_skips_pad_metal():
+    grid = CppGrid(cols=20, rows=10, layers=2, resolution=0.1)
+    saved_blocked = np.zeros((2, 10, 20), dtype=np.bool_)
+    saved_net = np.zeros((2, 10, 20), dtype=np.int32)
+    # Routed-net copper recorded only in the snapshot (live grid is clear).
+    saved_blocked[0, 5, 8:11] = True
+    saved_net[0, 5, 8:11] = 42
+    # Pad metal of another net: blocked in the snapshot but never a blocker.
+    grid._impl.mark_blocked(15, 5, 0, 43, True, True)
+    saved_blocked[0, 5, 15] = True
+    saved_net[0, 5, 15] = 43
+
+    counts = grid._impl.collect_blocking_nets(
+        [(0, 5, 19, 5, 0)], [], 1, True, 1, -1, saved_blocked, saved_net
+    )
+
+    assert counts == [(42, 3)]
+
+
+def test_relaxed_rejects_mismatched_snapshot_shape():
+    grid = CppGrid(cols=20, rows=10, layers=2, resolution=0.1)
+    with pytest.raises(ValueError):
+        grid._impl.collect_blocking_nets(
+            [(0, 5, 19, 5, 0)],
+            [],
+            1,
+            True,
+            1,
+            -1,
+            np.zeros((1, 10, 20), dtype=np.bool_),
+            np.zeros((1, 10, 20), dtype=np.int32),
+        )
+
+
+def test_via_cells_checked_on_every_layer():
+    grid = CppGrid(cols=10, rows=10, layers=4, resolution=0.1)
+    _routed_cell(grid, 4, 4, 3, 11)
+
+    counts = grid._impl.collect_blocking_nets([], [(4, 4)], 1, False, 1)
+
+    assert counts == [(11, 1)]
+
+
+def test_overlapping_kernels_count_distinct_cells():
+    grid = CppGrid(cols=30, rows=10, layers=1, resolution=0.1)
+    _routed_cell(grid, 15, 6, 0, 5)
+
+    # Every step of the horizontal walk sees (15, 6) within its kernel at
+    # some point; the cell must still be counted once.
+    counts = grid._impl.collect_blocking_nets([(0, 5, 29, 5, 0)], [], 2, False, 1)
+
+    assert counts == [(5, 1)]
+
+
+def test_find_blocking_nets_wrapper_returns_set_and_counts():
+    rules = DesignRules()
+    rules.trace_width = 0.2
+    rules.trace_clearance = 0.2
+    grid = CppGrid(cols=40, rows=20, layers=2, resolution=0.2)
+    for x in range(18, 22):
+        _routed_cell(grid, x, 10, 0, 77)
+    pathfinder = CppPathfinder(grid, rules)
+
+    start = Pad(x=0.4, y=2.0, width=0.2, height=0.2, net=1, net_name="A", layer=Layer.F_CU)
+    end = Pad(x=7.6, y=2.0, width=0.2, height=0.2, net=1, net_name="A", layer=Layer.F_CU)
+
+    blockers = pathfinder.find_blocking_nets(start, end, layer=0)
+
+    assert blockers == {77}
+    assert pathfinder.last_blocking_net_counts[77] >= 4
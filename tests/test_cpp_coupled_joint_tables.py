@@ -0,0 +1,165 @@
+"""Tests for the dense joint-state tables in the C++ ``CoupledPathfinder``.
+
+The coupled diff-pair search used to key its closed set and g-scores by a
+six-coordinate ``JointKey`` in ``std::unordered_set`` / ``unordered_map``,
+rebuild ``p_visited`` / ``n_visited`` hash sets on every pop, and count move
+rejections into a ``std::unordered_map<std::string, int64_t>``.  It now uses
+a generation-stamped open-addressing table over packed 64-bit joint keys,
+per-cell trail stamp arrays, and a fixed per-reason rejection array, all
+reused across ``route()`` calls.
+
+These tests cover the observable contract:
+
+1. ``CoupledRouteResult.rejections`` is still a ``reason -> count`` dict with
+   the pure-Python vocabulary and only non-zero entries.
+2. Reusing one ``CoupledPathfinder`` across calls (generation reset) gives
+   the same result as a fresh instance, including after a larger search has
+   grown the tables.
+3. The self-intersection / trail-proximity guard still prunes candidates.
+"""
+
+from __future__ import annotations
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+_KNOWN_REJECTION_KEYS = {
+    "sym_blocked_p",
+    "sym_blocked_n",
+    "sym_spacing",
+    "sym_floor",
+    "sym_trail",
+    "asym_blocked_p",
+    "asym_spacing_p",
+    "asym_floor_p",
+    "asym_trail_p",
+    "asym_blocked_n",
+    "asym_spacing_n",
+    "asym_floor_n",
+    "asym_trail_n",
+    "via_blocked_p",
+    "via_blocked_n",
+    "via_trace_blocked_p",
+    "via_trace_blocked_n",
+    "corridor",
+}
+
+
+def _make_rules():
+    from kicad_tools.router import router_cpp
+
+    rules = router_cpp.DesignRules()
+    rules.trace_width = 0.2
+    rules.trace_clearance = 0.2
+    rules.via_diameter = 0.6
+    rules.via_drill = 0.3
+    rules.via_clearance = 0.2
+    rules.grid_resolution = 0.1
+    return rules
+
+
+def _make_grid(cols: int = 40, rows: int = 24):
+    from kicad_tools.router import router_cpp
+
+    grid = router_cpp.Grid3D(cols, rows, 2, 0.1, 0.0, 0.0)
+    # A foreign-net wall across the upper half: pairs starting above it must
+    # detour (the search prunes candidates for several distinct reasons),
+    # pairs starting below it route straight across.
+    for y in range(0, rows - 12):
+        grid.mark_blocked(20, y, 0, 9)
+        grid.mark_blocked(20, y, 1, 9)
+    return grid
+
+
+def _make_pathfinder(grid):
+    from kicad_tools.router import router_cpp
+
+    return router_cpp.CoupledPathfinder(grid, _make_rules(), 2, 2, 1, 1, 0, 0.5, 1.0)
+
+
+def _route(pf, *, p_y: int = 4, n_y: int = 6, goal_x: int = 36, budget: int = 0, corridor=None):
+    return pf.route(
+        p_start_x=2,
+        p_start_y=p_y,
+        n_start_x=2,
+        n_start_y=n_y,
+        start_layer=0,
+        p_goal_x=goal_x,
+        p_goal_y=p_y,
+        n_goal_x=goal_x,
+        n_goal_y=n_y,
+        end_layer=0,
+        p_net=1,
+        n_net=2,
+        effective_target_spacing=2,
+        effective_approach_radius=3,
+        effective_departure_radius=3,
+        routable_layers=[0, 1],
+        corridor_bitset=corridor or [],
+        max_iterations_budget=budget,
+        timeout_seconds=0.0,
+    )
+
+
+def _path_tuple(res):
+    return [(n.p_x, n.p_y, n.p_layer, n.n_x, n.n_y, n.n_layer, n.via_from_parent) for n in res.path]
+
+
+def test_rejections_surface_as_nonzero_string_dict():
+    res = _route(_make_pathfinder(_make_grid()))
+
+    assert isinstance(res.rejections, dict)
+    assert len(res.rejections) > 0
+    assert set(res.rejections) <= _KNOWN_REJECTION_KEYS
+    assert all(isinstance(v, int) and v > 0 for v in res.rejections.values())
+
+
+def test_corridor_rejections_counted():
+    cols, rows = 40, 24
+    grid = _make_grid(cols, rows)
+    corridor = [0] * (cols * rows)
+    for y in range(2, 9):
+        for x in range(cols):
+            corridor[y * cols + x] = 1
+
+    res = _route(_make_pathfinder(grid), budget=200, corridor=corridor)
+
+    assert res.rejections.get("corridor", 0) > 0
+
+
+def test_trail_guard_still_prunes():
+    res = _route(_make_pathfinder(_make_grid()))
+
+    assert res.rejections.get("sym_trail", 0) > 0
+
+
+def test_reused_pathfinder_matches_fresh_instance():
+    grid = _make_grid()
+    reused = _make_pathfinder(grid)
+
+    first = _route(reused, p_y=14, n_y=16, goal_x=38)
+    assert first.success
+    # A much larger (exhausting) search in between grows the tables; the
+    # next call must start from a clean generation.
+    _route(reused)
+    again = _route(reused, p_y=14, n_y=16, goal_x=38)
+    fresh = _route(_make_pathfinder(grid), p_y=14, n_y=16, goal_x=38)
+
+    for res in (again, fresh):
+        assert res.success == first.success
+        assert res.iterations == first.iterations
+        assert res.best_progress == first.best_progress
+        assert res.rejections == first.rejections
+        assert _path_tuple(res) == _path_tuple(first)
+
+
+def test_budget_exit_reports_rejections():
+    res = _route(_make_pathfinder(_make_grid()), budget=5)
+
+    assert not res.success
+    assert res.timeout_exceeded
+    assert res.iteration_limited
+    assert set(res.rejections) <= _KNOWN_REJECTION_KEYS
@@ -0,0 +1,307 @@
+"""Tests for ``CoupledPathfinder.route_batch`` (parallel diff-pair batches).
+
+``route_batch`` runs several pairs' joint searches on a worker pool against
+the shared, read-only ``Grid3D``, commits the successful paths in
+``(priority, request index)`` order into a batch-local claim overlay, and
+re-searches any pair whose path entered the clearance envelope of a pair
+committed ahead of it.
+
+Fixture: a foreign-net wall at x=20 spans y=8..20 on both layers, leaving a
+gap above (y<8) and below (y>20).  Pair A (y=2/4) routes straight through
+the upper gap.  Pair B (y=12/14) prefers the upper gap too, so whichever
+pair commits second must be re-queued and detour.
+
+These tests cover:
+
+1. The lower-priority pair is re-queued and detours through the lower gap.
+2. Priority, not request order, decides who keeps the upper gap.
+3. Results are identical for every thread count.
+4. A round limit leaves still-conflicting pairs uncommitted and failed.
+5. The ``CppCoupledPathfinder.route_batch`` wrapper returns per-request
+   ``(path, diagnostics)`` entries.
+6. A multi-pair diff-pair flow runs its pairs' corridor searches in one
+   ``route_batch`` call and commits the batch paths without a serial search.
+7. A pair whose batched corridor search failed is not probed again and gets
+   one open search on what is left of its per-pair budget.
+"""
+
+from __future__ import annotations
+
+import logging
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+
+def _make_pathfinder():
+    from kicad_tools.router import router_cpp
+
+    grid = router_cpp.Grid3D(40, 24, 2, 0.1, 0.0, 0.0)
+    for y in range(8, 21):
+        grid.mark_blocked(20, y, 0, 9)
+        grid.mark_blocked(20, y, 1, 9)
+    pf = router_cpp.CoupledPathfinder(grid, router_cpp.DesignRules(), 2, 2, 1, 1, 0, 0.5, 1.0)
+    pf.distance_heuristic = True
+    return grid, pf
+
+
+def _request(p_y: int, n_y: int, p_net: int, n_net: int, priority: int):
+    from kicad_tools.router import router_cpp
+
+    r = router_cpp.CoupledPairRequest()
+    r.p_start_x, r.p_start_y = 2, p_y
+    r.n_start_x, r.n_start_y = 2, n_y
+    r.p_goal_x, r.p_goal_y = 36, p_y
+    r.n_goal_x, r.n_goal_y = 36, n_y
+    r.start_layer = r.end_layer = 0
+    r.p_net, r.n_net = p_net, n_net
+    r.effective_target_spacing = 2
+    r.effective_approach_radius = 3
+    r.effective_departure_radius = 3
+    r.routable_layers = [0, 1]
+    r.priority = priority
+    return r
+
+
+def _pairs(a_priority: int = 0, b_priority: int = 1):
+    return [_request(2, 4, 1, 2, a_priority), _request(12, 14, 3, 4, b_priority)]
+
+
+def _ys(res):
+    return [y for n in res.path for y in (n.p_y, n.n_y)]
+
+
+def _path_tuple(res):
+    return [(n.p_x, n.p_y, n.p_layer, n.n_x, n.n_y, n.n_layer, n.via_from_parent) for n in res.path]
+
+
+def test_conflicting_pair_is_requeued_and_detours():
+    _, pf = _make_pathfinder()
+
+    batch = pf.route_batch(_pairs(), num_threads=2)
+
+    assert list(batch.commit_order) == [0, 1]
+    assert list(batch.committed) == [1, 1]
+    assert list(batch.requeues) == [0, 1]
+    assert batch.rounds == 2
+    a, b = batch.results
+    assert a.success and b.success
+    assert max(_ys(a)) <= 4
+    # B gave up the upper gap and passes below the wall.
+    assert max(_ys(b)) > 20
+
+
+def test_priority_decides_commit_order():
+    _, pf = _make_pathfinder()
+
+    batch = pf.route_batch(_pairs(a_priority=5, b_priority=0), num_threads=2)
+
+    assert list(batch.commit_order) == [1, 0]
+    assert list(batch.requeues) == [1, 0]
+    # B now keeps the upper gap.
+    assert min(_ys(batch.results[1])) < 8
+
+
+def test_results_do_not_depend_on_thread_count():
+    _, pf = _make_pathfinder()
+
+    runs = [pf.route_batch(_pairs(), num_threads=t) for t in (1, 2, 4)]
+
+    for batch in runs[1:]:
+        assert list(batch.commit_order) == list(runs[0].commit_order)
+        assert list(batch.requeues) == list(runs[0].requeues)
+        for res, ref in zip(batch.results, runs[0].results, strict=True):
+            assert res.iterations == ref.iterations
+            assert _path_tuple(res) == _path_tuple(ref)
+
+
+def test_round_limit_reports_unresolved_conflict():
+    _, pf = _make_pathfinder()
+
+    batch = pf.route_batch(_pairs(), num_threads=2, max_rounds=1)
+
+    assert batch.rounds == 1
+    assert list(batch.committed) == [1, 0]
+    assert not batch.results[1].success
+    assert len(batch.results[1].path) == 0
+
+
+def test_empty_batch():
+    _, pf = _make_pathfinder()
+
+    batch = pf.route_batch([])
+
+    assert batch.rounds == 0
+    assert len(batch.results) == 0
+
+
+def test_wrapper_returns_per_request_entries():
+    from kicad_tools.router.cpp_backend import CppCoupledPathfinder, CppGrid
+    from kicad_tools.router.rules import DesignRules
+
+    grid = CppGrid(cols=40, rows=24, layers=2, resolution=0.1)
+    for y in range(8, 21):
+        grid._impl.mark_blocked(20, y, 0, 9)
+        grid._impl.mark_blocked(20, y, 1, 9)
+    pf = CppCoupledPathfinder(
+        grid,
+        DesignRules(),
+        target_spacing_cells=2,
+        min_spacing_cells=2,
+        trace_half_width_cells=1,
+        via_extra_cells=1,
+        via_drill_cells=0,
+        spacing_penalty_factor=0.5,
+        heuristic_weight=1.0,
+        distance_heuristic=True,
+    )
+
+    def request(p_y, n_y, p_net, n_net, priority):
+        return {
+            "p_start_xy": (2, p_y),
+            "n_start_xy": (2, n_y),
+            "start_layer": 0,
+            "p_goal_xy": (36, p_y),
+            "n_goal_xy": (36, n_y),
+            "end_layer": 0,
+            "p_net": p_net,
+            "n_net": n_net,
+            "effective_target_spacing": 2,
+            "effective_approach_radius": 3,
+            "effective_departure_radius": 3,
+            "routable_layers": [0, 1],
+            "priority": priority,
+        }
+
+    out = pf.route_batch([request(2, 4, 1, 2, 0), request(12, 14, 3, 4, 1)], num_threads=2)
+
+    assert len(out) == 2
+    (a_path, a_diag), (b_path, b_diag) = out
+    assert a_path is not None and b_path is not None
+    assert a_diag["committed"] and b_diag["committed"]
+    assert (a_diag["requeues"], b_diag["requeues"]) == (0, 1)
+    assert a_diag["rounds"] == b_diag["rounds"] == 2
+    assert a_path[0][:2] == (2, 2) and a_path[-1][:2] == (36, 2)
+
+
+def _usb3_router():
+    """30x10 mm board with two straight 2-pad USB3 pairs, one above the other."""
+    from kicad_tools.router.core import Autorouter
+    from kicad_tools.router.rules import DesignRules, NetClassRouting
+
+    names = ["USB3_TX_P", "USB3_TX_N", "USB3_RX_P", "USB3_RX_N"]
+    opt_in = NetClassRouting(name="HighSpeedOptIn", coupled_routing=True)
+    router = Autorouter(
+        width=30.0,
+        height=10.0,
+        rules=DesignRules(trace_width=0.2, trace_clearance=0.15, grid_resolution=0.1),
+        net_class_map=dict.fromkeys(names, opt_in),
+    )
+    ys = [2.6, 3.4, 6.6, 7.4]
+    for ref, x in (("U1", 5.0), ("J1", 25.0)):
+        router.add_component(
+            ref,
+            [
+                {
+                    "number": str(net),
+                    "x": x,
+                    "y": y,
+                    "width": 0.4,
+                    "height": 0.4,
+                    "net": net,
+                    "net_name": name,
+                }
+                for net, (name, y) in enumerate(zip(names, ys, strict=True), start=1)
+            ],
+        )
+    return router
+
+
+def test_multi_pair_flow_goes_through_the_batch(monkeypatch, caplog):
+    from kicad_tools.router.cpp_backend import CppCoupledPathfinder
+    from kicad_tools.router.diffpair import DifferentialPairConfig
+    from kicad_tools.router.diffpair_routing import CoupledPathfinder
+
+    batch_sizes: list[int] = []
+    real_batch = CppCoupledPathfinder.route_batch
+
+    def spy_batch(self, requests, **kwargs):
+        batch_sizes.append(len(requests))
+        return real_batch(self, requests, **kwargs)
+
+    serial_searches: list[str] = []
+    real_route = CoupledPathfinder.route_coupled
+
+    def spy_route(self, p_start, *args, **kwargs):
+        serial_searches.append(p_start.net_name)
+        return real_route(self, p_start, *args, **kwargs)
+
+    monkeypatch.setattr(CppCoupledPathfinder, "route_batch", spy_batch)
+    monkeypatch.setattr(CoupledPathfinder, "route_coupled", spy_route)
+    router = _usb3_router()
+
+    with caplog.at_level(logging.INFO, logger="kicad_tools.router.diffpair_routing"):
+        _routes, _warnings, routed = router.route_diffpair_prepass(
+            DifferentialPairConfig(enabled=True, spacing=0.8)
+        )
+
+    assert batch_sizes == [2]
+    assert serial_searches == []
+    assert routed == {1, 2, 3, 4}
+    timings = [r.getMessage() for r in caplog.records if "coupled timing" in r.getMessage()]
+    assert len(timings) == 2
+    assert all("phase=batch" in t for t in timings)
+
+
+def test_failed_batch_corridor_falls_back_to_open_search(monkeypatch):
+    from kicad_tools.router.cpp_backend import CppCoupledPathfinder
+    from kicad_tools.router.diffpair import DifferentialPairConfig
+    from kicad_tools.router.diffpair_routing import CoupledPathfinder, DiffPairRouter
+
+    real_batch = CppCoupledPathfinder.route_batch
+
+    dropped: list[int] = []
+
+    def batch_drops_second(self, requests, **kwargs):
+        assert all(any(r["corridor_bitset"]) for r in requests)
+        dropped.append(requests[1]["p_net"])
+        out = real_batch(self, requests, **kwargs)
+        return [out[0], (None, {**out[1][1], "committed": False})]
+
+    probes: list[str] = []
+    real_probe = DiffPairRouter._single_ended_guide_route
+
+    def spy_probe(self, start, *args, **kwargs):
+        probes.append(start.net_name)
+        return real_probe(self, start, *args, **kwargs)
+
+    serial_searches: list[tuple[int, float | None, bool]] = []
+    real_route = CoupledPathfinder.route_coupled
+
+    def spy_route(self, p_start, *args, **kwargs):
+        serial_searches.append(
+            (p_start.net, kwargs.get("timeout_seconds"), kwargs.get("corridor") is None)
+        )
+        return real_route(self, p_start, *args, **kwargs)
+
+    monkeypatch.setattr(CppCoupledPathfinder, "route_batch", batch_drops_second)
+    monkeypatch.setattr(DiffPairRouter, "_single_ended_guide_route", spy_probe)
+    monkeypatch.setattr(CoupledPathfinder, "route_coupled", spy_route)
+    router = _usb3_router()
+
+    router._diffpair.route_all_with_diffpairs(
+        DifferentialPairConfig(enabled=True, spacing=0.8),
+        non_diffpair_strategy=list,
+        coupled_only=True,
+        per_pair_timeout=30.0,
+        verbose=False,
+    )
+
+    assert sorted(probes) == ["USB3_RX_P", "USB3_TX_P"]
+    assert len(dropped) == 1 and len(serial_searches) == 1
+    net, timeout, open_search = serial_searches[0]
+    assert net == dropped[0] and open_search
+    assert 0.0 < timeout < 30.0
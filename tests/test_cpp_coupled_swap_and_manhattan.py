@@ -0,0 +1,165 @@
+"""Tests for the native ``allow_swap_via`` / ``manhattan_sum`` coupled modes.
+
+The C++ ``CoupledPathfinder`` originally deferred the Issue #2473
+polarity-swap via move and the legacy Issue #3115 ``manhattan_sum``
+heuristic to the pure-Python ``route_coupled`` loop.  Both are native now
+(``allow_swap_via`` / ``heuristic_mode`` properties), so every diff-pair
+configuration runs on the C++ search.
+
+These tests cover:
+
+1. A polarity-swapped pair routes through a swap via only when
+   ``allow_swap_via`` is on.  The swap exchanges the heads' cells on the
+   new layer.
+2. ``heuristic_mode`` round-trips and rejects unknown modes.
+3. ``manhattan_sum`` routes a straight pair the same way ``partner_aware``
+   does.
+4. ``route_coupled`` with ``manhattan_sum`` agrees with the pure-Python
+   fallback on routed length.
+"""
+
+from __future__ import annotations
+
+import math
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+
+def _make_pathfinder(cost_via: float = 1.0):
+    from kicad_tools.router import router_cpp
+
+    grid = router_cpp.Grid3D(40, 24, 2, 0.1, 0.0, 0.0)
+    rules = router_cpp.DesignRules()
+    # Cheap vias make the swap (3 * cost_via) cheaper than any same-layer
+    # crossing manoeuvre, so the swapped pair has a clear optimum.
+    rules.cost_via = cost_via
+    return router_cpp.CoupledPathfinder(grid, rules, 2, 2, 1, 1, 0, 0.5, 1.0)
+
+
+def _route(pf, *, swapped: bool):
+    p_goal_y, n_goal_y = (6, 4) if swapped else (4, 6)
+    return pf.route(
+        p_start_x=2,
+        p_start_y=4,
+        n_start_x=2,
+        n_start_y=6,
+        start_layer=0,
+        p_goal_x=36,
+        p_goal_y=p_goal_y,
+        n_goal_x=36,
+        n_goal_y=n_goal_y,
+        end_layer=0,
+        p_net=1,
+        n_net=2,
+        effective_target_spacing=2,
+        effective_approach_radius=3,
+        effective_departure_radius=3,
+        routable_layers=[0, 1],
+        corridor_bitset=[],
+        max_iterations_budget=0,
+        timeout_seconds=0.0,
+    )
+
+
+def _swap_steps(path):
+    steps = []
+    for prev, node in zip(path, path[1:], strict=False):
+        if (
+            node.via_from_parent
+            and (node.p_x, node.p_y) == (prev.n_x, prev.n_y)
+            and (node.n_x, node.n_y) == (prev.p_x, prev.p_y)
+        ):
+            steps.append(node)
+    return steps
+
+
+def test_swap_via_routes_polarity_swapped_pair():
+    pf = _make_pathfinder()
+    assert pf.allow_swap_via is False
+
+    no_swap = _route(pf, swapped=True)
+    pf.allow_swap_via = True
+    with_swap = _route(pf, swapped=True)
+
+    assert not no_swap.success
+    assert with_swap.success
+    swaps = _swap_steps(with_swap.path)
+    assert len(swaps) == 1
+    assert swaps[0].p_layer == swaps[0].n_layer == 1
+    last = with_swap.path[-1]
+    assert (last.p_x, last.p_y, last.n_x, last.n_y) == (36, 6, 36, 4)
+
+
+def test_swap_via_unused_on_straight_pair():
+    pf = _make_pathfinder()
+    pf.allow_swap_via = True
+
+    res = _route(pf, swapped=False)
+
+    assert res.success
+    assert _swap_steps(res.path) == []
+
+
+def test_heuristic_mode_round_trips_and_validates():
+    pf = _make_pathfinder()
+    assert pf.heuristic_mode == "partner_aware"
+    pf.heuristic_mode = "manhattan_sum"
+    assert pf.heuristic_mode == "manhattan_sum"
+    with pytest.raises(ValueError):
+        pf.heuristic_mode = "euclidean"
+
+
+def test_manhattan_sum_routes_straight_pair_like_partner_aware():
+    partner = _make_pathfinder(cost_via=10.0)
+    manhattan = _make_pathfinder(cost_via=10.0)
+    manhattan.heuristic_mode = "manhattan_sum"
+
+    a = _route(partner, swapped=False)
+    b = _route(manhattan, swapped=False)
+
+    assert a.success and b.success
+    assert len(a.path) == len(b.path)
+
+
+def test_route_coupled_manhattan_sum_matches_python_fallback():
+    from kicad_tools.router.diffpair_routing import CoupledPathfinder
+    from kicad_tools.router.grid import RoutingGrid
+    from kicad_tools.router.layers import Layer
+    from kicad_tools.router.primitives import Pad
+    from kicad_tools.router.rules import DesignRules
+
+    pads = (
+        Pad(x=2.0, y=4.0, width=0.4, height=0.4, net=1, net_name="D+", layer=Layer.F_CU),
+        Pad(x=10.0, y=4.0, width=0.4, height=0.4, net=1, net_name="D+", layer=Layer.F_CU),
+        Pad(x=2.0, y=6.0, width=0.4, height=0.4, net=2, net_name="D-", layer=Layer.F_CU),
+        Pad(x=10.0, y=6.0, width=0.4, height=0.4, net=2, net_name="D-", layer=Layer.F_CU),
+    )
+
+    def route(use_cpp: bool):
+        grid = RoutingGrid(width=12.7, height=12.7, rules=DesignRules())
+        pf = CoupledPathfinder(
+            grid=grid,
+            rules=DesignRules(),
+            target_spacing_cells=2,
+            min_spacing_cells=2,
+            heuristic_mode="manhattan_sum",
+        )
+        pf._use_cpp_coupled = use_cpp
+        res = pf.route_coupled(*pads)
+        return pf, res
+
+    cpp_pf, cpp_res = route(True)
+    _, py_res = route(False)
+
+    assert cpp_pf.last_coupled_backend == "cpp"
+    assert cpp_res is not None and py_res is not None
+
+    def length(route):
+        return sum(math.hypot(s.x2 - s.x1, s.y2 - s.y1) for s in route.segments)
+
+    for cpp_route, py_route in zip(cpp_res, py_res, strict=True):
+        assert length(cpp_route) == pytest.approx(length(py_route), abs=0.2)
@@ -0,0 +1,308 @@
+"""Tests for the native package escape planner (``router_cpp.EscapePlanner``).
+
+``EscapePlanner.plan`` computes one escape stub per pin for a whole package
+and checks every candidate against the ``Grid3D`` board state;
+``EscapePlanner.commit`` marks the accepted stubs and soft-reserves a
+corridor past each escape point.
+
+These tests cover:
+
+1. A full BGA ring fanout: every signal ball escapes, net-0 balls are
+   skipped, and the stubs pass the native clearance validator against the
+   pads and each other.
+2. Candidates that clip foreign copper or a keep-out fall back or are
+   reported ``ESCAPE_BLOCKED``.
+3. ``commit`` marks cells and reservations on the grid.
+4. The QFN alternating pattern.
+5. The ``CppEscapePlanner`` wrapper.
+6. ``EscapeRouter`` plans a fine-pitch QFN through the native planner and
+   commits the stubs on the C++ grid.
+"""
+
+from __future__ import annotations
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+RES = 0.1
+TRACE = 0.1
+CLEARANCE = 0.1
+PITCH = 0.8
+ORIGIN = 7.0
+
+
+def _rules():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    rules = router_cpp.DesignRules()
+    rules.trace_width = TRACE
+    rules.trace_clearance = CLEARANCE
+    rules.via_diameter = 0.4
+    rules.via_drill = 0.2
+    rules.via_clearance = CLEARANCE
+    rules.grid_resolution = RES
+    return rules
+
+
+def _bga(grid, size: int = 10, ground=((4, 4),)):
+    """``size`` x ``size`` BGA at 0.8 mm pitch; ``ground`` balls are net 0."""
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    pins = []
+    net = 1
+    for row in range(size):
+        for col in range(size):
+            x, y = ORIGIN + PITCH * col, ORIGIN + PITCH * row
+            pin_net = 0 if (col, row) in ground else net
+            net += pin_net != 0
+            pins.append(router_cpp.EscapePin(x, y, 0.35, 0.35, pin_net, 0))
+            grid.add_pad(x, y, 0.35, 0.35, pin_net, 0, 0, 0.0)
+    return pins
+
+
+def _config(pattern=None):
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    config = router_cpp.EscapeConfig()
+    config.pattern = router_cpp.ESCAPE_RING if pattern is None else pattern
+    config.inner_layers = [1, 2]
+    config.num_threads = 2
+    return config
+
+
+def _assert_valid(grid, stubs):
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    for stub in stubs:
+        if stub.status != router_cpp.ESCAPE_OK:
+            continue
+        vias = [stub.via] if stub.has_via else []
+        check = grid.validate_route(stub.segments, vias, stub.net, [], CLEARANCE, CLEARANCE, 0.1)
+        assert check.valid, (stub.pin, check.violation_x, check.violation_y)
+
+
+def test_bga_ring_fanout_escapes_every_signal_ball():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = router_cpp.Grid3D(250, 250, 4, RES, 0.0, 0.0)
+    pins = _bga(grid)
+    planner = router_cpp.EscapePlanner(grid, _rules())
+    config = _config()
+    stubs = planner.plan(pins, config)
+
+    assert len(stubs) == len(pins)
+    assert [s.pin for s in stubs] == list(range(len(pins)))
+    statuses = [s.status for s in stubs]
+    assert statuses.count(router_cpp.ESCAPE_SKIPPED) == 1
+    assert statuses.count(router_cpp.ESCAPE_OK) == len(pins) - 1
+    assert planner.last_candidates >= len(pins) - 1
+
+    for stub in stubs:
+        if stub.status != router_cpp.ESCAPE_OK:
+            continue
+        assert (stub.segments[0].x1, stub.segments[0].y1) == pytest.approx(
+            (pins[stub.pin].x, pins[stub.pin].y)
+        )
+        if stub.ring == 0:
+            # Outer ring: a surface stub ending past the package edge.
+            assert not stub.has_via and stub.escape_layer == 0
+            assert len(stub.segments) == 1
+        else:
+            # Inner rings: a dog-bone via to the ring's inner layer.
+            assert stub.has_via
+            assert stub.escape_layer == config.inner_layers[(stub.ring - 1) % 2]
+            assert stub.via.layer_from == 0 and stub.via.layer_to == stub.escape_layer
+
+    # Accepted stubs clear the pads and each other.
+    assert planner.commit(stubs, config, True, False) == len(pins) - 1
+    _assert_valid(grid, stubs)
+
+
+def test_blocked_candidates_fall_back_or_report():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = router_cpp.Grid3D(250, 250, 4, RES, 0.0, 0.0)
+    pins = _bga(grid, size=6, ground=())
+    # Foreign trace along the west edge, in the outer ring's escape path.
+    grid.add_stored_segment(ORIGIN - 0.4, 0.0, ORIGIN - 0.4, 20.0, TRACE, 0, 999)
+    planner = router_cpp.EscapePlanner(grid, _rules())
+    stubs = planner.plan(pins, _config())
+
+    west = [s for s in stubs if pins[s.pin].x == ORIGIN]
+    for stub in west:
+        if stub.status == router_cpp.ESCAPE_OK:
+            # Corner balls leave along the other axis instead.
+            assert stub.dir_x == 0.0
+        else:
+            assert stub.status == router_cpp.ESCAPE_BLOCKED
+    assert any(s.status == router_cpp.ESCAPE_BLOCKED for s in west)
+    _assert_valid(grid, stubs)
+
+    # Net-0 keep-out cells block candidates the same way.
+    grid = router_cpp.Grid3D(250, 250, 4, RES, 0.0, 0.0)
+    pins = _bga(grid, size=6, ground=())
+    gx, _ = grid.world_to_grid(ORIGIN + PITCH * 5 + 0.4, 0.0)
+    for gy in range(250):
+        for layer in range(4):
+            grid.mark_blocked(gx, gy, layer, 0, True, False)
+    stubs = router_cpp.EscapePlanner(grid, _rules()).plan(pins, _config())
+    east = [s for s in stubs if pins[s.pin].x == pytest.approx(ORIGIN + PITCH * 5)]
+    assert all(s.status == router_cpp.ESCAPE_BLOCKED or s.dir_x == 0.0 for s in east)
+
+
+def test_commit_marks_cells_and_reserves_corridor():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = router_cpp.Grid3D(250, 250, 4, RES, 0.0, 0.0)
+    pins = _bga(grid, size=6, ground=())
+    planner = router_cpp.EscapePlanner(grid, _rules())
+    config = _config()
+    stubs = planner.plan(pins, config)
+    ok = [s for s in stubs if s.status == router_cpp.ESCAPE_OK]
+    corridors = {s.pin: planner.corridor_cells(s, config) for s in ok}
+    assert all(corridors.values())
+
+    assert planner.commit(stubs, config) == len(ok)
+    for stub in ok:
+        ex, ey = grid.world_to_grid(stub.escape_x, stub.escape_y)
+        cell = grid.at(ex, ey, stub.escape_layer)
+        assert cell.blocked and cell.net == stub.net
+        for x, y in corridors[stub.pin]:
+            assert grid.is_reserved_for(x, y, stub.escape_layer, stub.net)
+    assert grid.reserved_cell_count() > 0
+
+    # Replanning sees the committed stubs: the same package still escapes,
+    # and a foreign package overlapping the fanout does not.
+    assert all(s.status == router_cpp.ESCAPE_OK for s in planner.plan(pins, config))
+    foreign = [router_cpp.EscapePin(p.x, p.y, p.width, p.height, p.net + 100, 0) for p in pins]
+    replanned = planner.plan(foreign, config)
+    assert all(s.status != router_cpp.ESCAPE_OK for s in replanned)
+
+
+def test_alternating_pattern():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    # QFN: 10 pins a side at 0.5 mm pitch around a thermal pad.
+    grid = router_cpp.Grid3D(250, 250, 2, 0.05, 0.0, 0.0)
+    pins = []
+    net = 1
+    for i in range(10):
+        o = -2.25 + 0.5 * i
+        for x, y, w, h in (
+            (10 + o, 10 - 2.85, 0.25, 0.8),
+            (10 + o, 10 + 2.85, 0.25, 0.8),
+            (10 - 2.85, 10 + o, 0.8, 0.25),
+            (10 + 2.85, 10 + o, 0.8, 0.25),
+        ):
+            pins.append(router_cpp.EscapePin(x, y, w, h, net, 0))
+            net += 1
+    pins.append(router_cpp.EscapePin(10.0, 10.0, 3.0, 3.0, 99, 0))
+    for pin in pins:
+        grid.add_pad(pin.x, pin.y, pin.width, pin.height, pin.net, 0, 0, 0.0)
+    config = _config(router_cpp.ESCAPE_ALTERNATING)
+    config.inner_layers = [1]
+    stubs = router_cpp.EscapePlanner(grid, _rules()).plan(pins, config)
+
+    assert stubs[-1].status == router_cpp.ESCAPE_SKIPPED
+    ok = [s for s in stubs if s.status == router_cpp.ESCAPE_OK]
+    assert len(ok) == 40
+    # Every other pin along an edge drops a via.
+    assert sum(s.has_via for s in ok) == 20
+    _assert_valid(grid, stubs)
+
+
+def test_cpp_escape_planner_wrapper():
+    from kicad_tools.router.cpp_backend import CppEscapePlanner, CppGrid, router_cpp
+    from kicad_tools.router.rules import DesignRules
+
+    grid = CppGrid(250, 250, 4, RES)
+    pins = []
+    for row in range(4):
+        for col in range(4):
+            x, y = ORIGIN + PITCH * col, ORIGIN + PITCH * row
+            pins.append((x, y, 0.35, 0.35, 1 + row * 4 + col, 0))
+            grid._impl.add_pad(x, y, 0.35, 0.35, 1 + row * 4 + col, 0, 0, 0.0)
+    rules = DesignRules(
+        trace_width=TRACE,
+        trace_clearance=CLEARANCE,
+        via_diameter=0.4,
+        via_drill=0.2,
+        via_clearance=CLEARANCE,
+        grid_resolution=RES,
+    )
+    planner = CppEscapePlanner(grid, rules)
+    stubs = planner.plan(pins, "ring", [1, 2, 3])
+    assert all(s.status == router_cpp.ESCAPE_OK for s in stubs)
+    assert planner.last_candidates > 0
+    assert planner.corridor_cells(stubs[0])
+    assert planner.commit(stubs) == len(pins)
+
+    with pytest.raises(ValueError):
+        planner.plan(pins, "spiral")
+
+
+def test_escape_router_plans_qfn_natively():
+    from kicad_tools.router.cpp_backend import CppGrid
+    from kicad_tools.router.escape import EscapeRouter, PackageType
+    from kicad_tools.router.grid import RoutingGrid
+    from kicad_tools.router.layers import Layer
+    from kicad_tools.router.primitives import Pad
+    from kicad_tools.router.rules import DesignRules
+
+    rules = DesignRules(
+        trace_width=TRACE,
+        trace_clearance=CLEARANCE,
+        via_diameter=0.4,
+        via_drill=0.2,
+        via_clearance=CLEARANCE,
+        grid_resolution=0.05,
+    )
+    grid = RoutingGrid(20.0, 20.0, rules)
+
+    def pad(x, y, w, h, net, pin):
+        return Pad(
+            x=x,
+            y=y,
+            width=w,
+            height=h,
+            net=net,
+            net_name=f"N{net}" if net else "",
+            layer=Layer.F_CU,
+            ref="U1",
+            pin=pin,
+        )
+
+    # 10 pins a side at 0.5 mm pitch around a net-0 thermal pad.
+    pads = []
+    for i in range(10):
+        o = -2.25 + 0.5 * i
+        for x, y, w, h in (
+            (10 + o, 10 - 2.85, 0.25, 0.8),
+            (10 + o, 10 + 2.85, 0.25, 0.8),
+            (10 - 2.85, 10 + o, 0.8, 0.25),
+            (10 + 2.85, 10 + o, 0.8, 0.25),
+        ):
+            pads.append(pad(x, y, w, h, len(pads) + 1, str(len(pads) + 1)))
+    pads.append(pad(10.0, 10.0, 3.0, 3.0, 0, "EP"))
+    for pad in pads:
+        grid.add_pad(pad)
+    CppGrid.from_routing_grid(grid)
+
+    router = EscapeRouter(grid, rules)
+    package = router.analyze_package(pads)
+    assert package.package_type == PackageType.QFN
+    escapes = router.generate_escapes(package)
+    assert escapes
+    assert all(e.native_stub is not None and e.pad.net != 0 for e in escapes)
+    assert any(e.via is not None for e in escapes)
+
+    routes = router.apply_escape_routes(escapes)
+    assert routes
+    committed = router._native_escape_planner
+    assert committed is not None and committed.grid is grid._cpp_grid
+
+    router.use_native_escape = False
+    assert all(e.native_stub is None for e in router.generate_escapes(package))
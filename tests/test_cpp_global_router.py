@@ -0,0 +1,224 @@
+"""Tests for the native global router (``router_cpp.GlobalRouter``).
+
+``GlobalRouter`` plans coarse corridors over a ``Grid3D``'s congestion tiles
+(the native counterpart of ``RegionGraph`` + ``GlobalRouter``): boundary
+capacities are counted from the grid cells, the negotiation loop runs in
+C++ with batches of nets searched concurrently, and each net's corridor is
+a flat ``cols*rows`` bitset that ``Pathfinder.set_search_corridor`` takes.
+
+These tests cover:
+
+1. Boundary capacity reflects blocked grid cells.
+2. Plans are trees that cover every pin tile, and do not depend on the
+   thread count.
+3. Overflow at the wall gap triggers negotiation and history costs.
+4. ``Pathfinder.set_search_corridor`` confines the detailed search, and the
+   planned corridor still admits the route.
+5. The two-phase router plans Phase 1 natively when its detailed router is
+   the C++ pathfinder, restricts each net's search to its corridor, and
+   retries unrestricted on the remaining per-net budget when nothing lands
+   inside.
+"""
+
+from __future__ import annotations
+
+import random
+import time
+from unittest.mock import MagicMock, call
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+COLS, ROWS, RES = 120, 90, 0.1
+# Wall on the boundary between tile columns 7 and 8 (x = 64), open for
+# rows 40..49 only.
+WALL_X = (63, 64)
+GAP = range(40, 50)
+
+
+def _grid():
+    from kicad_tools.router.cpp_backend import CppGrid
+
+    grid = CppGrid(COLS, ROWS, 2, RES)
+    for layer in range(2):
+        for y in range(ROWS):
+            if y not in GAP:
+                for x in WALL_X:
+                    grid._impl.mark_blocked(x, y, layer, 0, True)
+    return grid
+
+
+def _router(grid, **kwargs):
+    from kicad_tools.router.cpp_backend import CppGlobalRouter
+    from kicad_tools.router.rules import DesignRules
+
+    rules = DesignRules(trace_width=0.1, trace_clearance=0.1, grid_resolution=RES)
+    return CppGlobalRouter(grid, rules, **kwargs)
+
+
+def _nets(count: int = 40) -> dict[int, list[tuple[float, float]]]:
+    rng = random.Random(1)
+    return {
+        n: [(rng.randrange(COLS) * RES, rng.randrange(ROWS) * RES) for _ in range(2 + n % 3)]
+        for n in range(1, count + 1)
+    }
+
+
+def test_capacity_counts_free_boundary_cells():
+    gr = _router(_grid())
+    impl = gr._impl
+    assert (impl.tile_cols, impl.tile_rows) == (COLS // 8, ROWS // 8)
+    wall = {}
+    for e in range(impl.num_edges):
+        a, b = impl.edge_tiles(e)
+        if b == a + 1 and a % impl.tile_cols == 7:
+            wall[a // impl.tile_cols] = impl.capacity(e)
+    # Pitch is 2 cells; rows 40..47 sit in tile row 5 and 48..49 in row 6.
+    assert wall[5] == 2 * (8 // 2)
+    assert wall[6] == 2 * (2 // 2)
+    assert all(cap == 0 for row, cap in wall.items() if row not in (5, 6))
+    # An open boundary: 8 rows / pitch 2, two layers.
+    assert impl.capacity(0) == 8
+
+
+def test_plans_are_trees_over_the_pins_and_thread_independent():
+    grid = _grid()
+    nets = _nets()
+    gr = _router(grid)
+    one = gr.route_all(nets, num_threads=1, batch_size=8)
+    four = gr.route_all(nets, num_threads=4, batch_size=8)
+    assert one == four
+
+    for net, tiles in one["tiles"].items():
+        bits = gr.corridor_bitset(net, halo=0)
+        assert len(bits) == COLS * ROWS
+        for x, y in nets[net]:
+            gx, gy = grid.world_to_grid(x, y)
+            assert gr._impl.tile_of(gx, gy) in tiles
+            assert bits[gy * COLS + gx]
+    # world_to_grid clamps, so every net is plannable.
+    assert one["failed_nets"] == []
+    assert gr.corridor_bitset(12345) is None
+
+
+def test_overflow_triggers_negotiation():
+    grid = _grid()
+    greedy = _router(grid, negotiated=False).route_all(_nets())
+    assert greedy["iterations"] == 0
+    assert greedy["final_overflow"] > 0
+
+    gr = _router(grid, max_iterations=4)
+    negotiated = gr.route_all(_nets())
+    assert 1 <= negotiated["iterations"] <= 4
+    assert negotiated["final_overflow"] == gr.total_overflow()
+    assert any(gr._impl.history(e) > 0 for e in range(gr._impl.num_edges))
+
+
+def test_pathfinder_search_corridor():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = _grid()
+    gr = _router(grid)
+    start, end = (0.5, 0.5), (11.0, 8.0)
+    plan = gr.route_all({7: [start, end]})
+    assert 7 in plan["tiles"]
+
+    rules = router_cpp.DesignRules()
+    rules.grid_resolution = RES
+    pf = router_cpp.Pathfinder(grid._impl, rules, False)
+    assert pf.route(*start, 0, *end, 0, 7).success
+
+    tiny = bytearray(COLS * ROWS)
+    for y in range(10):
+        tiny[y * COLS : y * COLS + 10] = b"\x01" * 10
+    pf.set_search_corridor(list(tiny))
+    assert pf.has_search_corridor
+    assert not pf.route(*start, 0, *end, 0, 7).success
+
+    pf.set_search_corridor(gr.corridor_bitset(7))
+    assert pf.route(*start, 0, *end, 0, 7).success
+    pf.clear_search_corridor()
+    assert not pf.has_search_corridor
+
+
+def _two_phase(router, pads):
+    from kicad_tools.router.algorithms.two_phase import TwoPhaseRouter
+    from kicad_tools.router.rules import DesignRules
+
+    return TwoPhaseRouter(
+        grid=MagicMock(),
+        router=router,
+        rules=DesignRules(trace_width=0.1, trace_clearance=0.1, grid_resolution=RES),
+        net_class_map=None,
+        nets={7: list(pads)},
+        net_names={7: "N7"},
+        pads=pads,
+        routes=[],
+        routing_failures=[],
+        get_net_priority=lambda net: net,
+        route_net=MagicMock(),
+        route_net_with_corridor=MagicMock(),
+        mark_route=MagicMock(),
+    )
+
+
+def test_two_phase_restricts_initial_search_to_native_corridor(monkeypatch):
+    from kicad_tools.router.cpp_backend import CppGlobalRouter
+    from kicad_tools.router.primitives import Layer, Pad
+
+    pads = {
+        (ref, "1"): Pad(
+            x=x,
+            y=y,
+            width=0.3,
+            height=0.3,
+            net=7,
+            net_name="N7",
+            layer=Layer.F_CU,
+            ref=ref,
+            pin="1",
+        )
+        for ref, x, y in (("U1", 0.5, 0.5), ("U2", 11.0, 8.0))
+    }
+    router = MagicMock(spec=["set_search_corridor", "_grid"])
+    router._grid = _grid()
+    tp = _two_phase(router, pads)
+
+    gr = tp._native_global_router()
+    assert isinstance(gr, CppGlobalRouter)
+    tp._plan_search_corridors(gr, [7], 1, lambda: "0.0s")
+    bits = gr.corridor_bitset(7)
+    assert isinstance(bits, bytes) and len(bits) == COLS * ROWS
+    # Only the tiles are held between nets.
+    assert tp._search_corridors == {7: gr._tiles[7]}
+
+    # Nothing inside the corridor: the net is routed again unrestricted on
+    # the rest of its per-net budget.
+    timeouts = []
+
+    def route(timeout):
+        timeouts.append(timeout)
+        return [] if len(timeouts) == 1 else ["route"]
+
+    assert tp._route_in_search_corridor(7, route, 30.0) == ["route"]
+    assert router.set_search_corridor.call_args_list == [call(bits), call(None)]
+    assert timeouts[0] == 30.0 and 0.0 < timeouts[1] <= 30.0
+
+    # A corridor attempt that used the whole budget is not retried.
+    def slow(timeout):
+        timeouts.append(timeout)
+        time.sleep(0.02)
+        return []
+
+    timeouts.clear()
+    assert tp._route_in_search_corridor(7, slow, 0.01) == []
+    assert timeouts == [0.01]
+
+    # Unplanned nets, and the Python fallback switch.
+    assert tp._route_in_search_corridor(8, lambda timeout: ["other"]) == ["other"]
+    assert router.set_search_corridor.call_count == 4
+    monkeypatch.setenv("KCT_GLOBAL_CPP", "0")
+    assert _two_phase(router, pads)._native_global_router() is None
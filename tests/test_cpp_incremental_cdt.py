@@ -0,0 +1,255 @@
+"""Tests for the native incremental constrained-Delaunay mesh (``IncrementalCDT``).
+
+``IncrementalCDT`` adopts a ``constrained_delaunay`` mesh and edits its
+hole set locally: it re-triangulates only the touched cavity, restores the
+Delaunay property with edge flips, and keeps triangle ids outside the edit
+stable.  ``MeshPathfinder.add_pour`` / ``remove_pour`` use it so a pour
+edit no longer costs a full board remesh.
+
+These tests cover:
+
+1. An insert/remove round trip keeps the mesh valid and its area exact.
+   Triangles outside ``changed`` / ``moved`` keep their ids and contents.
+2. Holes that overlap another hole or cross the outline are refused, and
+   the mesh is left untouched.
+3. ``hole_at`` finds adopted holes.
+4. ``MeshPathfinder.add_pour`` routes around a pour added after the build,
+   and ``remove_pour`` restores the straight route.  Neither triggers a
+   second triangulation.
+5. ``NavMesh.apply_cdt_update`` patches the navmesh to match a fresh build
+   of the edited mesh, native and Python alike.  Portal occupancy and
+   history outside the edit survive; portals the edit removes read 0.
+6. ``Autorouter`` feeds filled zones of non-routed nets to the mesh as
+   pours, and ``clear_zones`` fills them back in without a remesh.
+"""
+
+from __future__ import annotations
+
+import math
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+OUTER = [(0.0, 0.0), (40.0, 0.0), (40.0, 40.0), (0.0, 40.0)]
+HOLE = [(10.0, 10.0), (14.0, 10.0), (14.0, 14.0), (10.0, 14.0)]
+
+
+def _square(cx: float, cy: float, r: float):
+    return [(cx - r, cy - r), (cx + r, cy - r), (cx + r, cy + r), (cx - r, cy + r)]
+
+
+def _mesh():
+    from kicad_tools.router import router_cpp
+
+    steiner = [(x + 0.5, y + 0.25) for x in range(2, 39, 4) for y in range(2, 39, 4)]
+    steiner = [p for p in steiner if not (9.0 < p[0] < 15.0 and 9.0 < p[1] < 15.0)]
+    verts, tris = router_cpp.constrained_delaunay(OUTER, [HOLE], steiner)
+    assert verts and tris
+    return router_cpp.IncrementalCDT(verts, tris)
+
+
+def _area(cdt) -> float:
+    v = cdt.vertices
+    total = 0.0
+    for a, b, c in cdt.triangles:
+        total += (
+            (v[b][0] - v[a][0]) * (v[c][1] - v[a][1]) - (v[c][0] - v[a][0]) * (v[b][1] - v[a][1])
+        ) / 2.0
+    return total
+
+
+def test_insert_remove_round_trip_is_local_and_exact():
+    cdt = _mesh()
+    assert cdt.is_valid()
+    assert cdt.hole_ids() == [0]
+    assert _area(cdt) == pytest.approx(1600.0 - 16.0)
+
+    before = [tuple(t) for t in cdt.triangles]
+    up = cdt.insert_hole(_square(30.0, 30.0, 1.5))
+    assert up.ok and up.hole_id == 1
+    assert cdt.is_valid()
+    assert _area(cdt) == pytest.approx(1600.0 - 16.0 - 9.0)
+
+    # Only the patch (and its flips) changed; every other id is untouched.
+    moved_to = {new for _old, new in up.moved}
+    after = [tuple(t) for t in cdt.triangles]
+    untouched = [
+        t for t in range(min(len(before), len(after))) if t not in up.changed and t not in moved_to
+    ]
+    assert len(up.changed) < len(before) // 4
+    assert all(before[t] == after[t] for t in untouched)
+
+    down = cdt.remove_hole(up.hole_id)
+    assert down.ok
+    assert cdt.is_valid()
+    assert _area(cdt) == pytest.approx(1600.0 - 16.0)
+    assert cdt.hole_ids() == [0]
+
+
+def test_overlapping_or_outline_crossing_hole_is_refused():
+    cdt = _mesh()
+    before = [tuple(t) for t in cdt.triangles]
+
+    assert not cdt.insert_hole(_square(12.0, 12.0, 3.0)).ok  # overlaps the hole
+    assert not cdt.insert_hole(_square(0.5, 20.0, 1.0)).ok  # crosses the outline
+    assert not cdt.insert_hole(_square(60.0, 60.0, 1.0)).ok  # outside the board
+    assert [tuple(t) for t in cdt.triangles] == before
+    assert cdt.is_valid()
+
+
+def test_hole_at_and_remove_adopted_hole():
+    cdt = _mesh()
+    assert cdt.hole_at((12.0, 12.0)) == 0
+    assert cdt.hole_at(HOLE[0]) == 0
+    assert cdt.hole_at((30.0, 30.0)) == -1
+
+    up = cdt.remove_hole(0)
+    assert up.ok
+    assert cdt.is_valid()
+    assert _area(cdt) == pytest.approx(1600.0)
+    assert cdt.hole_ids() == []
+
+
+def test_mesh_pathfinder_add_and_remove_pour_remesh_locally():
+    from kicad_tools.router.layers import Layer
+    from kicad_tools.router.mesh.geometry import segment_intersects_polygon
+    from kicad_tools.router.mesh.pathfinder import MeshPathfinder
+    from kicad_tools.router.primitives import Pad
+
+    def pad(x: float, y: float, ref: str) -> Pad:
+        return Pad(
+            x=x,
+            y=y,
+            width=1.0,
+            height=1.0,
+            net=1,
+            net_name="SIG",
+            layer=Layer.F_CU,
+            ref=ref,
+            pin="1",
+        )
+
+    pour = [(15.0, 17.0), (25.0, 17.0), (25.0, 23.0), (15.0, 23.0)]
+    a, b = pad(5.0, 20.0, "R1"), pad(35.0, 20.0, "R2")
+    mp = MeshPathfinder(OUTER, [a, b])
+    straight = mp.route(a, b)
+    assert straight is not None
+    assert mp.triangulation_calls == 1
+
+    assert mp.add_pour(pour)
+    around = mp.route(a, b)
+    assert around is not None
+    assert not any(
+        segment_intersects_polygon((s.x1, s.y1), (s.x2, s.y2), pour) for s in around.segments
+    )
+    assert mp.triangulation_calls == 1
+    assert mp.incremental_updates == 1
+
+    assert mp.remove_pour(0)
+    again = mp.route(a, b)
+    assert again is not None
+    assert len(again.segments) == len(straight.segments)
+    assert mp.triangulation_calls == 1
+    assert mp.incremental_updates == 2
+
+
+def _lattice_cdt():
+    from kicad_tools.router import router_cpp
+
+    steiner = [(float(x), float(y)) for x in range(2, 40, 4) for y in range(2, 40, 4)]
+    verts, tris = router_cpp.constrained_delaunay(OUTER, [], steiner)
+    return router_cpp.IncrementalCDT(
+        [(float(x), float(y)) for x, y in verts], [tuple(int(i) for i in t) for t in tris]
+    )
+
+
+def _geodesic_length(mesh, start, goal) -> float:
+    found = mesh.find_path(start, goal)
+    assert found is not None
+    path = found[2]
+    return sum(math.dist(path[i], path[i + 1]) for i in range(len(path) - 1))
+
+
+@pytest.mark.parametrize("use_native", [True, False])
+def test_navmesh_patch_matches_fresh_build_and_keeps_portal_state(use_native):
+    from kicad_tools.router.mesh.navmesh import NavMesh
+
+    cdt = _lattice_cdt()
+    mesh = NavMesh(list(cdt.vertices), list(cdt.triangles), channel=0.3, use_native=use_native)
+    vid = {(round(x), round(y)): i for i, (x, y) in enumerate(cdt.vertices)}
+    far = tuple(sorted((vid[(2, 2)], vid[(6, 2)])))
+    inner = tuple(sorted((vid[(18, 18)], vid[(22, 18)])))
+    for edge in (far, inner):
+        assert len(mesh._edge_tris[edge]) == 2
+        mesh.commit_portal(edge)
+        mesh.add_history(edge, 2.5)
+
+    update = cdt.insert_hole([(16.0, 16.0), (24.0, 16.0), (24.0, 24.0), (16.0, 24.0)])
+    assert update.ok
+    mesh.apply_cdt_update(cdt, update)
+
+    fresh = NavMesh(list(cdt.vertices), list(cdt.triangles), channel=0.3, use_native=use_native)
+    assert mesh.triangles == fresh.triangles
+    for p in [(1.0, 1.0), (20.0, 12.5), (13.0, 27.0), (38.5, 39.0)]:
+        assert mesh.locate(p) == fresh.locate(p)
+    for start, goal in [((2.0, 20.0), (38.0, 20.0)), ((20.0, 2.0), (20.0, 38.0))]:
+        assert _geodesic_length(mesh, start, goal) == pytest.approx(
+            _geodesic_length(fresh, start, goal)
+        )
+    assert (mesh.occupancy(far), mesh.history(far)) == (1, 2.5)
+    assert (mesh.occupancy(inner), mesh.history(inner)) == (0, 0.0)
+
+    removal = cdt.remove_hole(update.hole_id)
+    assert removal.ok
+    mesh.apply_cdt_update(cdt, removal)
+    fresh = NavMesh(list(cdt.vertices), list(cdt.triangles), channel=0.3, use_native=use_native)
+    assert mesh.triangles == fresh.triangles
+    assert _geodesic_length(mesh, (2.0, 20.0), (38.0, 20.0)) == pytest.approx(
+        _geodesic_length(fresh, (2.0, 20.0), (38.0, 20.0))
+    )
+    assert (mesh.occupancy(far), mesh.history(far)) == (1, 2.5)
+
+
+def test_autorouter_zone_changes_edit_the_mesh_pours_locally():
+    from kicad_tools.router.core import Autorouter
+    from kicad_tools.router.layers import Layer
+    from kicad_tools.router.mesh.geometry import segment_intersects_polygon
+    from kicad_tools.router.primitives import Pad
+    from kicad_tools.router.zones import FilledZone
+    from kicad_tools.schema.pcb import Zone
+
+    router = Autorouter(40, 40, strategy="mesh")
+    for x, y, ref in ((5.0, 20.0, "R1"), (35.0, 20.0, "R2")):
+        pad = Pad(
+            x=x,
+            y=y,
+            width=1.0,
+            height=1.0,
+            net=1,
+            net_name="SIG",
+            layer=Layer.F_CU,
+            ref=ref,
+            pin="1",
+        )
+        router.pads[(ref, "1")] = pad
+        router.nets.setdefault(1, []).append((ref, "1"))
+    pour = [(15.0, 17.0), (25.0, 17.0), (25.0, 23.0), (15.0, 23.0)]
+    # A zone of a net outside the routable set is foreign copper.
+    zone = Zone(net_number=2, net_name="GND", layer="F.Cu", polygon=pour)
+    router.zone_manager.filled_zones = [FilledZone(zone=zone, filled_cells={(0, 0)})]
+
+    routes = router._route_net_mesh(1)
+    pf = router._mesh_pathfinder
+    assert pf.pours == [pour]
+    assert routes and routes[0].segments
+    assert not any(
+        segment_intersects_polygon((s.x1, s.y1), (s.x2, s.y2), pour) for s in routes[0].segments
+    )
+
+    router.clear_zones()
+    assert pf.pours == []
+    assert pf.triangulation_calls == 1
+    assert pf.incremental_updates == 1
@@ -0,0 +1,210 @@
+"""Parity tests for the native octilinear lattice (``router_cpp.OctilinearLattice``).
+
+``router/lattice/quadtree.py::OctilinearLattice`` builds its balanced quadtree
+and graph in C++ when the backend is built; ``LatticeObstacleModel`` builds
+its pad masks there, ``CommittedCopper`` mirrors into ``LatticeCopper`` and the
+non-fat ``_route_impl`` search runs natively (issue #4278).  The pure-Python
+build (``use_native=False`` / ``KCT_LATTICE_CPP=0``) is the reference.
+
+These tests cover:
+
+1. Leaves, node keys, edges and adjacency lengths match the Python build.
+2. The per-layer pad masks match ``LatticeObstacleModel``'s Python loops.
+3. ``LatticeCopper`` predicates match ``CommittedCopper``.
+4. Single-net routes on board 02 cost the same either way.
+"""
+
+from __future__ import annotations
+
+import math
+import random
+from pathlib import Path
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+_REPO = Path(__file__).resolve().parents[1]
+_CHARLIEPLEX = _REPO / "boards/02-charlieplex-led/output/charlieplex_3x3.kicad_pcb"
+
+BBOX = (-1.3, 0.7, 27.9, 19.4)
+
+
+def _regions():
+    from kicad_tools.router.lattice.quadtree import RefineRegion
+
+    return [
+        RefineRegion((3.0, 3.0, 5.0, 5.0), 0.4),
+        RefineRegion((12.0, 8.0, 12.6, 8.6), 0.2),
+        RefineRegion((20.0, 14.0, 24.0, 16.0), 0.8),
+    ]
+
+
+def _pair():
+    from kicad_tools.router.lattice.quadtree import OctilinearLattice
+
+    native = OctilinearLattice(BBOX, _regions(), coarse=3.2, use_native=True)
+    python = OctilinearLattice(BBOX, _regions(), coarse=3.2, use_native=False)
+    assert native.native is not None and python.native is None
+    return native, python
+
+
+def test_lattice_graph_matches_python():
+    native, python = _pair()
+    assert native.max_level == python.max_level
+    assert native.leaves == python.leaves
+    assert native.node_list == python.node_list
+    assert native.nodes == python.nodes
+    assert native.edges == python.edges
+    assert native.edge_list == python.edge_list
+    for key, nbrs in python.adj.items():
+        mine = sorted(native.adj[key])
+        assert [k for k, _ in mine] == [k for k, _ in sorted(nbrs)]
+        assert [d for _, d in mine] == pytest.approx([d for _, d in sorted(nbrs)])
+    for direction in "EWNS":
+        for level, i, j in sorted(python.leaves)[::7]:
+            assert native.native.neighbor_max_level(
+                level, i, j, direction
+            ) == python.neighbor_max_level(level, i, j, direction)
+
+
+def _random_pads():
+    from kicad_tools.router.layers import Layer
+    from kicad_tools.router.primitives import Pad
+
+    rng = random.Random(7)
+    pads = [
+        Pad(
+            x=rng.uniform(0.0, 26.0),
+            y=rng.uniform(1.0, 19.0),
+            width=rng.uniform(0.3, 2.0),
+            height=rng.uniform(0.3, 2.0),
+            net=rng.randint(1, 4),
+            net_name="N",
+            layer=Layer.F_CU,
+            ref=f"U{k}",
+            pin="1",
+        )
+        for k in range(20)
+    ]
+    layers = [(0, 1) if k % 4 == 0 else (k % 2,) for k in range(len(pads))]
+    return pads, layers
+
+
+def test_pad_masks_match_python():
+    from kicad_tools.router.lattice.obstacles import LatticeObstacleModel
+
+    native, python = _pair()
+    pads, layers = _random_pads()
+    n_model = LatticeObstacleModel(native, pads, layers, 2, 0.25)
+    p_model = LatticeObstacleModel(python, pads, layers, 2, 0.25)
+    for layer in range(2):
+        assert {k: sorted(v) for k, v in n_model.node_pads[layer].items()} == {
+            k: sorted(v) for k, v in p_model.node_pads[layer].items()
+        }
+        assert {k: sorted(v) for k, v in n_model.edge_pads[layer].items()} == {
+            k: sorted(v) for k, v in p_model.edge_pads[layer].items()
+        }
+    for n, key in enumerate(native.node_list[::11]):
+        for net in (1, 2):
+            idx = native.node_index[key]
+            assert native.native.node_blocked(idx, n % 2, net) == p_model.node_blocked(
+                key, n % 2, net
+            )
+
+
+def test_native_lattice_answers_escapes_and_masks_without_python_graph():
+    from kicad_tools.router.lattice.obstacles import LatticeObstacleModel
+
+    native, python = _pair()
+    pads, layers = _random_pads()
+    n_model = LatticeObstacleModel(native, pads, layers, 2, 0.25)
+    p_model = LatticeObstacleModel(python, pads, layers, 2, 0.25)
+
+    for point, radius in [((12.3, 8.3), 1.5), ((3.0, 3.0), 4.0), ((25.0, 19.0), 0.0)]:
+        assert native.nodes_within(point, radius) == python.nodes_within(point, radius)
+    for n, edge in enumerate(python.edge_list[::13]):
+        for net in (1, 2):
+            assert n_model.edge_blocked(edge, n % 2, net) == p_model.edge_blocked(
+                edge, n % 2, net
+            )
+    for n, key in enumerate(python.node_list[::11]):
+        assert n_model.node_blocked(key, n % 2, 1) == p_model.node_blocked(key, n % 2, 1)
+
+    # None of that materialised the Python graph or mask dicts.
+    for name in ("leaves", "node_list", "nodes", "edge_list", "edges", "adj", "node_index"):
+        assert name not in vars(native)
+    assert "node_pads" not in vars(n_model) and "edge_pads" not in vars(n_model)
+
+
+def test_committed_copper_predicates_match_python(monkeypatch):
+    from kicad_tools.router.lattice.obstacles import CommittedCopper
+
+    kwargs = dict(
+        trace_half=0.1, clearance=0.15, via_radius=0.3, via_via_gap=0.75, same_net_via_gap=0.8
+    )
+    monkeypatch.setenv("KCT_LATTICE_CPP", "0")
+    python = CommittedCopper(2, **kwargs)
+    monkeypatch.delenv("KCT_LATTICE_CPP")
+    native = CommittedCopper(2, **kwargs)
+    assert native.native is not None and python.native is None
+
+    rng = random.Random(3)
+    for cc in (native, python):
+        cc.add_run(0, [(1.0, 1.0), (6.0, 1.0), (9.0, 4.0)], 1, 0.1)
+        cc.add_run_widths(1, [(2.0, 5.0), (2.0, 9.0), (5.0, 9.0)], 2, [0.05, 0.3], 0.3)
+        cc.add_via((6.0, 1.0), 1)
+        cc.add_via((4.0, 7.0), 3)
+    assert native.native.num_segments == 4 and native.native.num_vias == 2
+
+    for _ in range(300):
+        a = (rng.uniform(0.0, 10.0), rng.uniform(0.0, 10.0))
+        b = (a[0] + rng.uniform(-2.0, 2.0), a[1] + rng.uniform(-2.0, 2.0))
+        layer, net = rng.randrange(2), rng.randint(1, 3)
+        assert native.native.seg_clear(a, b, layer, net) == python.seg_clear(a, b, layer, net)
+        assert native.native.seg_clear(a, b, layer, net, 0.2, 0.25) == python.seg_clear(
+            a, b, layer, net, 0.2, 0.25
+        )
+        assert native.native.node_clear(a, layer, net) == python.node_clear(a, layer, net)
+        assert native.native.via_clear(a, net) == python.via_clear(a, net)
+    # Same-net body over a via center is refused; the endpoint tap is not (#4318).
+    assert not native.native.seg_clear((5.0, 1.0), (7.0, 1.0), 1, 1)
+    assert native.native.seg_clear((6.0, 1.0), (6.0, 3.0), 1, 1)
+
+
+def _route_cost(route, via_cost: float) -> float:
+    length = sum(math.hypot(s.x2 - s.x1, s.y2 - s.y1) for s in route.segments)
+    return length + via_cost * len(route.vias)
+
+
+def test_single_net_routes_cost_the_same(monkeypatch):
+    from kicad_tools.router.io import load_pads_for_analysis
+    from kicad_tools.router.lattice.pathfinder import LatticePathfinder
+
+    text = _CHARLIEPLEX.read_text()
+    pads = load_pads_for_analysis(text)
+    bynet: dict[int, list] = {}
+    for p in pads:
+        if p.net > 0:
+            bynet.setdefault(p.net, []).append(p)
+    pairs = [(ps[0], ps[-1]) for ps in bynet.values() if len(ps) >= 2][:6]
+    assert pairs
+
+    # Route natively first: the committed-copper twin is created per route,
+    # so the environment switch must come after.
+    native = LatticePathfinder.from_board(text)
+    assert native.build().native is not None
+    n_routes = [native.route(a, b) for a, b in pairs]
+    monkeypatch.setenv("KCT_LATTICE_CPP", "0")
+    python = LatticePathfinder.from_board(text)
+    assert python.build().native is None
+    p_routes = [python.route(a, b) for a, b in pairs]
+
+    for n_route, p_route in zip(n_routes, p_routes, strict=True):
+        assert (n_route is None) == (p_route is None)
+        if n_route is not None:
+            assert _route_cost(n_route, native.via_cost) == pytest.approx(
+                _route_cost(p_route, python.via_cost), abs=1e-6
+            )
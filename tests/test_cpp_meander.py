@@ -0,0 +1,297 @@
+"""Tests for the native serpentine tuner (``router_cpp.MeanderTuner``).
+
+``MeanderTuner.tune_group`` tunes every member of a match group in one
+call: trombones are generated with the Python generator's shape and
+checked against the ``Grid3D`` board state (stored routes and pads) and
+the other members.
+
+These tests cover:
+
+1. A parallel bus reaching its targets, clearing the board and each
+   other, with the same result at any thread count.
+2. Members that are already long enough or have no host segment.
+3. Members hemmed in by foreign copper reported ``MEANDER_BLOCKED``.
+4. The trombone shape (45-degree legs, exact added length).
+5. ``tune_match_group_v2`` dispatching a single-ended group natively, and
+   its per-status reasons (and the disabled via check).
+"""
+
+from __future__ import annotations
+
+import math
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+RES = 0.1
+TRACE = 0.15
+CLEARANCE = 0.2
+
+
+def _segment(x1, y1, x2, y2, net, layer=0):
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    seg = router_cpp.Segment()
+    seg.x1, seg.y1, seg.x2, seg.y2 = x1, y1, x2, y2
+    seg.width = TRACE
+    seg.layer = layer
+    seg.net = net
+    return seg
+
+
+def _config():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    config = router_cpp.MeanderConfig()
+    config.trace_clearance = CLEARANCE
+    config.via_clearance = CLEARANCE
+    config.pad_clearance = CLEARANCE
+    config.tolerance = 0.05
+    return config
+
+
+def _bus(targets, pitch=1.2):
+    """Horizontal traces from x=2 to x=30, two collinear pieces each."""
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    members = []
+    for i, target in enumerate(targets):
+        y = 5.0 + pitch * i
+        segments = [_segment(2.0, y, 15.0, y, i + 1), _segment(15.0, y, 30.0, y, i + 1)]
+        members.append(router_cpp.MeanderRequest(i + 1, segments, [], target))
+    return members
+
+
+def _coords(segments):
+    return [(s.x1, s.y1, s.x2, s.y2) for s in segments]
+
+
+def test_bus_reaches_targets_and_clears_board():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = router_cpp.Grid3D(400, 200, 2, RES, 0.0, 0.0)
+    grid.add_stored_segment(0.0, 3.5, 40.0, 3.5, TRACE, 0, 900)
+    grid.add_pad(16.0, 14.6, 0.6, 0.6, 901, -1, 0, 0.0)
+    targets = [32.0, 30.0, 35.0, 31.0, 29.0, 33.0]
+    tuner = router_cpp.MeanderTuner(grid, _config())
+    results = tuner.tune_group(_bus(targets), 4)
+
+    assert [r.net for r in results] == list(range(1, len(targets) + 1))
+    for result, target in zip(results, targets, strict=True):
+        assert result.status == router_cpp.MEANDER_TUNED
+        assert result.inserts >= 1 and result.loops >= 1
+        assert result.length_before == pytest.approx(28.0)
+        assert result.length_after == pytest.approx(target, abs=0.05)
+        assert router_cpp.MeanderTuner.length(result.segments) == pytest.approx(
+            result.length_after
+        )
+        # Still one connected path between the original endpoints.
+        segs = result.segments
+        assert (segs[0].x1, segs[0].y1) == pytest.approx((2.0, 5.0 + 1.2 * (result.net - 1)))
+        assert (segs[-1].x2, segs[-1].y2) == pytest.approx((30.0, segs[0].y1))
+        for a, b in zip(segs, segs[1:], strict=False):
+            assert (a.x2, a.y2) == pytest.approx((b.x1, b.y1), abs=1e-4)
+
+    # Tuned members clear the foreign copper and each other.
+    for result in results:
+        for seg in result.segments:
+            grid.add_stored_segment(seg.x1, seg.y1, seg.x2, seg.y2, seg.width, seg.layer, seg.net)
+    for result in results:
+        check = grid.validate_route(result.segments, [], result.net, [], CLEARANCE, CLEARANCE, 0.1)
+        assert check.valid, (result.net, check.violation_x, check.violation_y)
+
+    # Parallel tuning is deterministic.
+    grid.clear_stored_routes()
+    grid.add_stored_segment(0.0, 3.5, 40.0, 3.5, TRACE, 0, 900)
+    serial = tuner.tune_group(_bus(targets), 1)
+    assert [_coords(r.segments) for r in serial] == [_coords(r.segments) for r in results]
+
+
+def test_untouched_and_unhostable_members():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = router_cpp.Grid3D(400, 200, 2, RES, 0.0, 0.0)
+    tuner = router_cpp.MeanderTuner(grid, _config())
+    members = _bus([28.0, 20.0])
+    # A staircase of 0.3 mm steps cannot host a single loop.
+    stairs = [
+        _segment(2.0 + 0.3 * k, 12.0 + 0.3 * (k % 2), 2.3 + 0.3 * k, 12.0 + 0.3 * (k % 2), 3)
+        for k in range(10)
+    ]
+    members.append(router_cpp.MeanderRequest(3, stairs, [], 10.0))
+    results = tuner.tune_group(members)
+
+    assert [r.status for r in results] == [
+        router_cpp.MEANDER_WITHIN_TOLERANCE,
+        router_cpp.MEANDER_WITHIN_TOLERANCE,
+        router_cpp.MEANDER_NO_SEGMENT,
+    ]
+    for result, member in zip(results, members, strict=True):
+        assert result.inserts == 0
+        assert _coords(result.segments) == _coords(member.segments)
+        assert result.length_after == result.length_before
+
+
+def test_foreign_copper_blocks_loops():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = router_cpp.Grid3D(400, 200, 2, RES, 0.0, 0.0)
+    # Foreign traces 0.45 mm either side leave no room for any bump.
+    grid.add_stored_segment(0.0, 4.55, 40.0, 4.55, TRACE, 0, 900)
+    grid.add_stored_segment(0.0, 5.45, 40.0, 5.45, TRACE, 0, 901)
+    members = _bus([32.0])
+    results = router_cpp.MeanderTuner(grid, _config()).tune_group(members)
+    assert results[0].status == router_cpp.MEANDER_BLOCKED
+    assert _coords(results[0].segments) == _coords(members[0].segments)
+
+    # The same traces on the other layer do not interfere.
+    grid.clear_stored_routes()
+    grid.add_stored_segment(0.0, 4.55, 40.0, 4.55, TRACE, 1, 900)
+    grid.add_stored_segment(0.0, 5.45, 40.0, 5.45, TRACE, 1, 901)
+    results = router_cpp.MeanderTuner(grid, _config()).tune_group(_bus([32.0]))
+    assert results[0].status == router_cpp.MEANDER_TUNED
+
+
+def test_negative_via_clearance_skips_the_via_check():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = router_cpp.Grid3D(400, 200, 2, RES, 0.0, 0.0)
+    # A fence of foreign vias either side of the trace.
+    for k in range(80):
+        for y in (4.55, 5.45):
+            grid.add_stored_via(0.5 * k, y, 0.1, 0.2, 900)
+    results = router_cpp.MeanderTuner(grid, _config()).tune_group(_bus([32.0]))
+    assert results[0].status == router_cpp.MEANDER_BLOCKED
+
+    config = _config()
+    config.via_clearance = -1.0
+    results = router_cpp.MeanderTuner(grid, config).tune_group(_bus([32.0]))
+    assert results[0].status == router_cpp.MEANDER_TUNED
+
+
+def test_trombone_shape():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = router_cpp.Grid3D(100, 100, 2, RES, 0.0, 0.0)
+    tuner = router_cpp.MeanderTuner(grid, _config())
+    host = _segment(0.0, 0.0, 10.0, 0.0, 1)
+
+    loops = tuner.trombone(host, 4.0, 1.0, 1, 2.0)
+    assert router_cpp.MeanderTuner.length(loops) == pytest.approx(14.0)
+    assert (loops[0].x1, loops[0].y1, loops[-1].x2, loops[-1].y2) == (0.0, 0.0, 10.0, 0.0)
+    # Side +1 bulges left of travel only.
+    assert min(s.y1 for s in loops) == pytest.approx(0.0)
+    assert max(s.y1 for s in loops) == pytest.approx(1.0)
+
+    alternating = tuner.trombone(host, 4.0, 1.0, 0, 2.0)
+    assert min(s.y1 for s in alternating) == pytest.approx(-1.0)
+
+    # Off-angle hosts keep every leg on the 45-degree set.
+    for seg in tuner.trombone(_segment(0.0, 0.0, 10.0, 3.0, 1), 4.0, 1.0, 1, 2.0):
+        angle = math.degrees(math.atan2(seg.y2 - seg.y1, seg.x2 - seg.x1)) % 45.0
+        assert min(angle, 45.0 - angle) < 0.01
+
+    assert tuner.trombone(_segment(0.0, 0.0, 1.0, 0.0, 1), 4.0, 1.0, 1, 2.0) == []
+
+
+def test_match_group_tuning_dispatches_natively():
+    from kicad_tools.router.cpp_backend import CppGrid
+    from kicad_tools.router.layers import Layer
+    from kicad_tools.router.match_group_length import MatchGroup
+    from kicad_tools.router.match_group_tuning import tune_match_group_v2
+    from kicad_tools.router.primitives import Route, Segment
+
+    def route(net, length, y):
+        seg = Segment(
+            x1=2.0,
+            y1=y,
+            x2=2.0 + length,
+            y2=y,
+            width=TRACE,
+            layer=Layer.F_CU,
+            net=net,
+            net_name=f"D{net}",
+        )
+        return Route(net=net, net_name=f"D{net}", segments=[seg])
+
+    grid = CppGrid(400, 200, 2, RES)
+    routes_by_net = {1: route(1, 30.0, 5.0), 2: route(2, 27.0, 6.2), 3: route(3, 28.0, 7.4)}
+    untouched = routes_by_net[1]
+    group = MatchGroup(name="DATA", net_ids=[1, 2, 3, 4], tolerance=0.1)
+    results = tune_match_group_v2(
+        group,
+        routes_by_net,
+        intra_group_clearance_mm=CLEARANCE,
+        via_clearance_mm=CLEARANCE,
+        pad_clearance_mm=CLEARANCE,
+        cpp_grid=grid,
+    )
+
+    assert list(results) == [1, 2, 3, 4]
+    assert {net: res.reason for net, (_r, res) in results.items()} == {
+        1: "already_within_tolerance",
+        2: "tuned",
+        3: "tuned",
+        4: "unrouted",
+    }
+    assert results[1][0] is untouched
+    for net in (2, 3):
+        tuned, res = results[net]
+        assert res.success and res.inserts_applied >= 1
+        assert res.length_after_mm == pytest.approx(30.0, abs=0.1)
+        assert routes_by_net[net] is tuned
+        assert all(s.layer == Layer.F_CU and s.net_name == f"D{net}" for s in tuned.segments)
+
+
+@pytest.mark.parametrize(
+    ("status", "inserts", "reason"),
+    [
+        ("MEANDER_PARTIAL", 1, "partial_tune"),
+        ("MEANDER_PARTIAL", 3, "exceeded_max_inserts"),
+        ("MEANDER_BLOCKED", 0, "post_insertion_drc_violation"),
+    ],
+)
+def test_native_status_reasons(monkeypatch, status, inserts, reason):
+    from types import SimpleNamespace
+
+    from kicad_tools.router.cpp_backend import CppGrid, CppMeanderTuner, router_cpp
+    from kicad_tools.router.layers import Layer
+    from kicad_tools.router.match_group_length import MatchGroup
+    from kicad_tools.router.match_group_tuning import tune_match_group_v2
+    from kicad_tools.router.primitives import Route, Segment
+
+    def route(net, length):
+        seg = Segment(
+            x1=2.0,
+            y1=5.0 + net,
+            x2=2.0 + length,
+            y2=5.0 + net,
+            width=TRACE,
+            layer=Layer.F_CU,
+            net=net,
+            net_name=f"D{net}",
+        )
+        return Route(net=net, net_name=f"D{net}", segments=[seg])
+
+    seen = {}
+
+    def tune_group(self, members, board_routes=None):
+        seen["via_clearance"] = self._impl.config.via_clearance
+        native = SimpleNamespace(status=getattr(router_cpp, status), inserts=inserts, loops=0)
+        return [(r, native) for r, _target in members]
+
+    monkeypatch.setattr(CppMeanderTuner, "tune_group", tune_group)
+    results = tune_match_group_v2(
+        MatchGroup(name="DATA", net_ids=[1, 2], tolerance=0.1),
+        {1: route(1, 30.0), 2: route(2, 27.0)},
+        intra_group_clearance_mm=CLEARANCE,
+        max_inserts_per_member=3,
+        cpp_grid=CppGrid(400, 200, 2, RES),
+    )
+    assert results[2][1].reason == reason
+    assert not results[2][1].success
+    # No via clearance given: the native via check is switched off.
+    assert seen["via_clearance"] < 0.0
@@ -0,0 +1,280 @@
+"""Tests for multi-resolution search (``Grid3D.add_refinement`` +
+``Pathfinder.route_multires``).
+
+Refinement regions give ``Grid3D`` fine cells around fine-pitch packages;
+``route_multires`` runs one A* over coarse and fine cells, crossing between
+them on the regions' transition edges.
+
+These tests cover:
+
+1. Region geometry: fine cell size, world <-> fine mapping, transitions.
+2. Fine cells are rasterized from the registered pads and stored routes.
+3. A pad row that is unreachable on the coarse grid routes through a
+   region, and the routes pass the native clearance validator.
+4. ``install_refinement_regions`` refines only fine-pitch components and
+   merges touching regions.
+5. ``AdaptiveGridRouter(single_search=True)`` refines the native grid and
+   routes a fine-pitch row without escape segments, replacing the regions
+   of a previous pass.
+"""
+
+from __future__ import annotations
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+RES = 0.25
+TRACE = 0.1
+CLEARANCE = 0.1
+PITCH = 0.4
+ROW_Y = 7.51
+
+
+def _rules():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    rules = router_cpp.DesignRules()
+    rules.trace_width = TRACE
+    rules.trace_clearance = CLEARANCE
+    rules.via_diameter = 0.45
+    rules.via_drill = 0.2
+    rules.grid_resolution = RES
+    return rules
+
+
+def _pad_row_grid(count: int = 10):
+    """0.4 mm pitch row of 0.2 x 0.6 mm pads, off the 0.25 mm grid.
+
+    Pads are registered for validation and their clearance halo is marked
+    on the coarse cells the way ``CppGrid.from_routing_grid`` would.
+    """
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = router_cpp.Grid3D(80, 60, 2, RES, 0.0, 0.0)
+    halo = TRACE / 2 + CLEARANCE
+    for i in range(count):
+        x = 5.03 + PITCH * i
+        grid.add_pad(x, ROW_Y, 0.2, 0.6, i + 1, 0, 0, 0.0)
+        x0, y0 = grid.world_to_grid(x - 0.1 - halo, ROW_Y - 0.3 - halo)
+        x1, y1 = grid.world_to_grid(x + 0.1 + halo, ROW_Y + 0.3 + halo)
+        for gx in range(x0, x1 + 1):
+            for gy in range(y0, y1 + 1):
+                grid.mark_blocked(gx, gy, 0, i + 1, False, True)
+    return grid
+
+
+def _refine_row(grid, factor: int = 4) -> int:
+    x0, y0 = grid.world_to_grid(4.0, 6.5)
+    x1, y1 = grid.world_to_grid(9.5, 8.5)
+    return grid.add_refinement(x0, y0, x1, y1, factor, TRACE / 2, CLEARANCE)
+
+
+def test_region_geometry():
+    grid = _pad_row_grid()
+    region = _refine_row(grid)
+    assert grid.num_refinements == 1
+    reg = grid.refinement(region)
+    assert reg.factor == 4
+    assert reg.resolution == pytest.approx(RES / 4)
+    assert reg.cols == (reg.x1 - reg.x0 + 1) * 4
+    assert reg.rows == (reg.y1 - reg.y0 + 1) * 4
+    # Every fine cell on the region border links to one outside coarse cell.
+    assert reg.num_transitions == 2 * (reg.cols + reg.rows)
+
+    assert grid.refinement_at(reg.x0, reg.y0) == region
+    assert grid.refinement_at(reg.x0 - 1, reg.y0) == -1
+    fx, fy = grid.world_to_fine(region, 6.0, 7.0)
+    wx, wy = grid.fine_to_world(region, fx, fy)
+    assert abs(wx - 6.0) <= reg.resolution / 2 + 1e-4
+    assert abs(wy - 7.0) <= reg.resolution / 2 + 1e-4
+
+    grid.clear_refinements()
+    assert grid.num_refinements == 0
+    assert grid.refinement_at(reg.x0, reg.y0) == -1
+
+
+def test_fine_cells_follow_pads_and_stored_routes():
+    grid = _pad_row_grid()
+    region = _refine_row(grid)
+
+    # Pad metal belongs to its net.
+    fx, fy = grid.world_to_fine(region, 5.03 + PITCH * 2, ROW_Y)
+    cell = grid.fine_cell(region, fx, fy, 0)
+    assert cell.blocked and cell.net == 3 and cell.pad_blocked
+    # The 0.2 mm gap is inside both neighbours' halos: shared, so net -1.
+    fx, fy = grid.world_to_fine(region, 5.03 + PITCH * 2.5, ROW_Y)
+    cell = grid.fine_cell(region, fx, fy, 0)
+    assert cell.blocked and cell.net == -1 and not cell.pad_blocked
+    # The other layer only sees SMD pads on layer 0, and the row is open
+    # a halo away from the pad ends.
+    assert not grid.fine_cell(region, fx, fy, 1).blocked
+    fx, fy = grid.world_to_fine(region, 5.03 + PITCH * 2.5, ROW_Y + 0.5)
+    assert not grid.fine_cell(region, fx, fy, 0).blocked
+
+    # A stored segment is stamped incrementally; clearing re-rasterizes.
+    fx, fy = grid.world_to_fine(region, 7.0, 6.75)
+    assert not grid.fine_cell(region, fx, fy, 1).blocked
+    grid.add_stored_segment(4.0, 6.75, 9.0, 6.75, TRACE, 1, 99)
+    cell = grid.fine_cell(region, fx, fy, 1)
+    assert cell.blocked and cell.net == 99
+    grid.clear_stored_routes()
+    assert not grid.fine_cell(region, fx, fy, 1).blocked
+
+
+def test_route_multires_reaches_off_grid_pads():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = _pad_row_grid()
+    rules = _rules()
+    pf = router_cpp.Pathfinder(grid, rules, True)
+    middle = 5.03 + PITCH * 4
+
+    coarse = pf.route_multires(middle, ROW_Y, 0, 15.0, 12.0, 0, 5)
+    assert not coarse.success
+    assert coarse.failure_reason == router_cpp.FAILURE_NO_PATH
+
+    _refine_row(grid)
+    routed = 0
+    for i in range(10):
+        x = 5.03 + PITCH * i
+        result = pf.route_multires(x, ROW_Y, 0, 6.0 + i, 12.0, 0, i + 1)
+        if not result.success:
+            continue
+        routed += 1
+        assert (result.segments[0].x1, result.segments[0].y1) == pytest.approx((x, ROW_Y))
+        assert (result.segments[-1].x2, result.segments[-1].y2) == pytest.approx((6.0 + i, 12.0))
+        check = grid.validate_route(
+            result.segments, result.vias, i + 1, [], CLEARANCE, CLEARANCE, 0.102
+        )
+        assert check.valid, (i, check.violation_x, check.violation_y)
+        for seg in result.segments:
+            grid.add_stored_segment(seg.x1, seg.y1, seg.x2, seg.y2, seg.width, seg.layer, i + 1)
+            a = grid.world_to_grid(seg.x1, seg.y1)
+            b = grid.world_to_grid(seg.x2, seg.y2)
+            grid.mark_segment(a[0], a[1], b[0], b[1], seg.layer, i + 1, 1)
+        for via in result.vias:
+            grid.add_stored_via(via.x, via.y, via.drill, via.diameter, i + 1)
+    assert routed >= 6
+    assert pf.iterations > 0
+
+
+def test_route_multires_places_vias_for_layer_change():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    grid = _pad_row_grid()
+    _refine_row(grid)
+    pf = router_cpp.Pathfinder(grid, _rules(), True)
+
+    result = pf.route_multires(20.0, 3.0, 0, 20.0, 10.0, 1, 42)
+    assert result.success
+    assert len(result.vias) == 1
+    assert {seg.layer for seg in result.segments} == {0, 1}
+
+    # Iteration cap is honoured.
+    capped = pf.route_multires(5.03, ROW_Y, 0, 18.0, 14.0, 0, 1, [], [], 5)
+    assert not capped.success
+    assert capped.failure_reason == router_cpp.FAILURE_ITERATION_LIMIT
+
+
+def test_install_refinement_regions_merges_fine_pitch_components():
+    from kicad_tools.router.adaptive_grid import install_refinement_regions
+    from kicad_tools.router.cpp_backend import CppGrid
+    from kicad_tools.router.layers import Layer
+    from kicad_tools.router.primitives import Pad
+    from kicad_tools.router.rules import DesignRules
+
+    def row(ref, x, y, pitch, count, net, size):
+        return [
+            Pad(
+                x=x + pitch * i,
+                y=y,
+                width=size,
+                height=0.6,
+                net=net + i,
+                net_name=f"N{net + i}",
+                layer=Layer.F_CU,
+                ref=ref,
+            )
+            for i in range(count)
+        ]
+
+    pads = (
+        row("U1", 5.0, 7.5, 0.4, 10, 1, 0.2)
+        + row("U2", 9.5, 8.0, 0.5, 4, 20, 0.25)  # touches U1's region
+        + row("J1", 30.0, 20.0, 2.54, 4, 40, 1.5)  # coarse pitch
+        + row("U3", 30.0, 5.0, 0.5, 4, 50, 0.25)
+    )
+    grid = CppGrid(80, 60, 2, RES)
+    regions = install_refinement_regions(
+        grid, pads, DesignRules(trace_width=TRACE, trace_clearance=CLEARANCE)
+    )
+    assert len(regions) == grid.num_refinements == 2
+
+    first = grid._impl.refinement(regions[0])
+    assert grid._impl.refinement_at(*grid.world_to_grid(5.0, 7.5)) == regions[0]
+    assert grid._impl.refinement_at(*grid.world_to_grid(11.0, 8.0)) == regions[0]
+    assert grid._impl.refinement_at(*grid.world_to_grid(30.0 + 2.54, 20.0)) == -1
+    assert 2 <= first.factor <= 8
+
+
+def test_adaptive_single_search_routes_through_regions():
+    from kicad_tools.router.adaptive_grid import AdaptiveGridRouter
+    from kicad_tools.router.cpp_backend import CppPathfinder, create_hybrid_router
+    from kicad_tools.router.grid import RoutingGrid
+    from kicad_tools.router.layers import Layer, LayerStack
+    from kicad_tools.router.primitives import Pad
+    from kicad_tools.router.rules import DesignRules
+
+    rules = DesignRules(trace_width=TRACE, trace_clearance=CLEARANCE, grid_resolution=RES)
+    grid = RoutingGrid(20.0, 15.0, rules, layer_stack=LayerStack.two_layer())
+    pads = {}
+    nets = {}
+    for i in range(4):
+        net = i + 1
+        row = Pad(
+            x=5.03 + PITCH * i,
+            y=ROW_Y,
+            width=0.2,
+            height=0.6,
+            net=net,
+            net_name=f"N{net}",
+            layer=Layer.F_CU,
+            ref="U1",
+            pin=str(net),
+        )
+        far = Pad(
+            x=5.0 + 2.0 * i,
+            y=12.0,
+            width=0.6,
+            height=0.6,
+            net=net,
+            net_name=f"N{net}",
+            layer=Layer.F_CU,
+            ref="J1",
+            pin=str(net),
+        )
+        for pad in (row, far):
+            pads[(pad.ref, pad.pin)] = pad
+            grid.add_pad(pad)
+        nets[net] = [("U1", str(net)), ("J1", str(net))]
+
+    router = create_hybrid_router(grid, rules)
+    assert isinstance(router, CppPathfinder)
+    adaptive = AdaptiveGridRouter(grid, rules, router, single_search=True)
+    assert adaptive.uses_single_search
+
+    result = adaptive.route_adaptive(nets, pads)
+    assert "U1" in result.fine_resolutions and "J1" not in result.fine_resolutions
+    assert router._grid.num_refinements == 1
+    assert result.escape_routes == []
+    assert result.nets_attempted == 4
+    assert result.nets_routed == 4
+    for route in result.main_routes:
+        assert route.segments
+
+    # A second pass replaces the regions rather than stacking them.
+    adaptive._phase1_refine(pads)
+    assert router._grid.num_refinements == 1
@@ -0,0 +1,136 @@
+"""Parity tests for the native mesh-router navmesh (``router_cpp.NavMesh``).
+
+``router/mesh/navmesh.py::NavMesh`` delegates the triangle-dual A*, portal
+narrowing (issue #4274) and the funnel string-pull to the C++ twin when the
+backend is built.  The pure-Python implementation (``use_native=False``) is
+the reference: the native path must return the same corridor, portal edges
+and geodesic on a real poly2tri mesh.
+
+These tests cover:
+
+1. ``astar`` / ``corridor_portals`` / ``corridor_to_portals`` / ``string_pull``
+   agree with the Python reference on the 20x20 square with a hole.
+2. Narrowed portals (consumed bands, every ``pack``) agree.
+3. Congestion-aware A* (occupancy + history) agrees, and the bookkeeping
+   round-trips through the native tables.
+4. ``find_path`` equals the chained calls, and ``from_cdt`` equals the
+   two-step build.
+5. A triangle naming a vertex outside the vertex list is refused with
+   ``ValueError`` instead of reading out of bounds.
+"""
+
+from __future__ import annotations
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+OUTER = [(0.0, 0.0), (20.0, 0.0), (20.0, 20.0), (0.0, 20.0)]
+HOLE = [(6.0, 6.0), (14.0, 6.0), (14.0, 14.0), (6.0, 14.0)]
+START, GOAL = (2.0, 2.0), (18.0, 18.0)
+
+
+def _pair():
+    from kicad_tools.router import router_cpp
+    from kicad_tools.router.mesh.navmesh import NavMesh
+
+    verts, tris = router_cpp.constrained_delaunay(OUTER, [HOLE], [START, GOAL])
+    vertices = [(float(v[0]), float(v[1])) for v in verts]
+    triangles = [(int(t[0]), int(t[1]), int(t[2])) for t in tris]
+    native = NavMesh(vertices, triangles, channel=0.5, use_native=True)
+    python = NavMesh(vertices, triangles, channel=0.5, use_native=False)
+    assert native.is_native and not python.is_native
+    return native, python
+
+
+def _approx_points(a, b):
+    assert len(a) == len(b)
+    for p, q in zip(a, b, strict=True):
+        assert p == pytest.approx(q, abs=1e-9)
+
+
+def test_corridor_portals_and_geodesic_match_python():
+    native, python = _pair()
+
+    corridor = native.astar(START, GOAL)
+    assert corridor == python.astar(START, GOAL)
+    assert native.corridor_portals(corridor) == python.corridor_portals(corridor)
+
+    n_portals = native.corridor_to_portals(corridor, START, GOAL)
+    p_portals = python.corridor_to_portals(corridor, START, GOAL)
+    assert len(n_portals) == len(p_portals)
+    for (nl, nr), (pl, pr) in zip(n_portals, p_portals, strict=True):
+        assert nl == pytest.approx(pl) and nr == pytest.approx(pr)
+
+    _approx_points(native.pull(corridor, START, GOAL), python.pull(corridor, START, GOAL))
+
+
+@pytest.mark.parametrize("pack", ["largest", "left", "right"])
+def test_narrowed_portals_match_python(pack):
+    native, python = _pair()
+    corridor = python.astar(START, GOAL)
+    edges = python.corridor_portals(corridor)
+    consumed = {edges[0]: [(0.1, 0.3), (0.25, 0.5)], edges[-1]: [(0.6, 0.9)]}
+
+    _approx_points(
+        native.pull(corridor, START, GOAL, consumed, pack),
+        python.pull(corridor, START, GOAL, consumed, pack),
+    )
+
+
+def test_congestion_aware_astar_matches_python():
+    native, python = _pair()
+    first = python.astar(START, GOAL)
+    for nm in (native, python):
+        for edge in nm.corridor_portals(first):
+            nm.commit_portal(edge)
+            nm.commit_portal(edge)
+            nm.add_history(edge, 0.75)
+
+    kwargs = dict(present_cost_factor=2.0, cost_congestion=1.0, congestion_threshold=0.5)
+    rerouted = python.astar(START, GOAL, **kwargs)
+    assert native.astar(START, GOAL, **kwargs) == rerouted
+    assert rerouted != first
+
+    assert sorted(native.occupied_portals()) == sorted(python.occupied_portals())
+    edge = python.corridor_portals(first)[0]
+    assert native.occupancy(edge) == python.occupancy(edge) == 2
+    assert native.history(edge) == pytest.approx(python.history(edge))
+    assert native.capacity(edge) == python.capacity(edge)
+
+    native.release_portal(edge)
+    assert native.occupancy(edge) == 1
+    native.reset_occupancy()
+    assert native.occupied_portals() == []
+    assert native.history(edge) > 0.0
+    native.clear_history()
+    assert native.history(edge) == 0.0
+
+
+def test_find_path_matches_chained_calls_and_from_cdt():
+    from kicad_tools.router import router_cpp
+
+    native, python = _pair()
+    corridor, portals, geodesic = native.find_path(START, GOAL)
+    assert corridor == python.astar(START, GOAL)
+    assert portals == python.corridor_portals(corridor)
+    _approx_points(geodesic, python.pull(corridor, START, GOAL))
+
+    direct = router_cpp.NavMesh.from_cdt(OUTER, [HOLE], [START, GOAL], 0.5)
+    assert direct.num_triangles == len(python.triangles)
+    assert direct.astar(START, GOAL) == corridor
+
+    # A point outside the outline cannot be located.
+    assert native.find_path(START, (30.0, 30.0)) is None
+
+
+@pytest.mark.parametrize("bad", [3, -1])
+def test_out_of_range_vertex_index_is_refused(bad):
+    from kicad_tools.router import router_cpp
+
+    vertices = [(0.0, 0.0), (1.0, 0.0), (0.0, 1.0)]
+    assert router_cpp.NavMesh(vertices, [(0, 1, 2)], 0.5).num_triangles == 1
+    with pytest.raises(ValueError, match="vertex index out of range"):
+        router_cpp.NavMesh(vertices, [(0, 1, bad)], 0.5)
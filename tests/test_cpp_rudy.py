@@ -0,0 +1,190 @@
+"""Tests for the native RUDY congestion map (``RudyMap``).
+
+``router_cpp.RudyMap`` and ``placement_cpp.RudyMap`` bind the same
+header-only kernel: each net's HPWL is spread over its bbox tiles through a
+2-D difference array, and moving a component re-applies only its nets.
+``CongestionEstimator.from_nets`` uses it when the router backend is built
+(``use_native=False`` / ``KCT_RUDY_CPP=0`` keep the Python loops).
+
+These tests cover:
+
+1. ``CongestionEstimator`` demand and net scores match the Python loops.
+2. Incremental component moves and net removal match a fresh build.
+3. The placement module exposes the same kernel over the same tiling.
+4. ``PlacementCongestion`` tracks moved and rotated components
+   incrementally and matches the Python RUDY over the same pads.
+"""
+
+from __future__ import annotations
+
+import random
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+
+def _pads_and_nets(seed: int = 11):
+    from kicad_tools.router.primitives import Pad
+
+    rng = random.Random(seed)
+    pads = {}
+    nets: dict[int, list[tuple[str, str]]] = {}
+    for net in range(1, 61):
+        keys = []
+        for k in range(rng.randint(1, 5)):
+            key = (f"U{net}", str(k + 1))
+            pads[key] = Pad(
+                x=rng.uniform(-2.0, 82.0),
+                y=rng.uniform(-2.0, 62.0),
+                width=0.5,
+                height=0.5,
+                net=net,
+                net_name=f"N{net}",
+                ref=key[0],
+                pin=key[1],
+            )
+            keys.append(key)
+        nets[net] = keys
+    return pads, nets
+
+
+def test_estimator_matches_python():
+    from kicad_tools.router.congestion_estimator import CongestionEstimator
+
+    pads, nets = _pads_and_nets()
+    kwargs = dict(
+        nets=nets,
+        pads=pads,
+        board_origin_x=0.0,
+        board_origin_y=0.0,
+        board_width=80.0,
+        board_height=60.0,
+        target_tiles=120,
+        pour_net_ids={7},
+    )
+    native = CongestionEstimator.from_nets(**kwargs, use_native=True)
+    python = CongestionEstimator.from_nets(**kwargs, use_native=False)
+    assert native.native is not None and python.native is None
+
+    for n_row, p_row in zip(native.demand, python.demand, strict=True):
+        assert n_row == pytest.approx(p_row, abs=1e-9)
+    assert native.net_scores.keys() == python.net_scores.keys()
+    for net, score in python.net_scores.items():
+        assert native.net_scores[net] == pytest.approx(score, abs=1e-9)
+    assert 7 not in native.net_scores
+
+
+def _random_pins(rng: random.Random, count: int):
+    return [
+        (rng.uniform(0.0, 50.0), rng.uniform(0.0, 40.0), rng.randrange(8)) for _ in range(count)
+    ]
+
+
+def test_incremental_moves_match_fresh_build():
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    rng = random.Random(4)
+    nets = {net: _random_pins(rng, rng.randint(2, 4)) for net in range(1, 31)}
+    live = router_cpp.RudyMap(0.0, 0.0, 5.0, 5.0, 10, 8)
+    for net, pins in nets.items():
+        live.set_net(net, pins)
+
+    for _ in range(50):
+        comp, dx, dy = rng.randrange(8), rng.uniform(-3.0, 3.0), rng.uniform(-3.0, 3.0)
+        touched = live.move_component(comp, dx, dy)
+        moved = 0
+        for net, pins in nets.items():
+            if any(c == comp for _, _, c in pins):
+                moved += 1
+                nets[net] = [(x + dx, y + dy, c) if c == comp else (x, y, c) for x, y, c in pins]
+        assert touched == moved
+    assert live.remove_net(3)
+    del nets[3]
+    assert not live.remove_net(3)
+
+    fresh = router_cpp.RudyMap(0.0, 0.0, 5.0, 5.0, 10, 8)
+    for net, pins in nets.items():
+        fresh.set_net(net, pins)
+    assert live.demand() == pytest.approx(fresh.demand(), abs=1e-9)
+    assert [n for n, _ in live.net_scores()] == [n for n, _ in fresh.net_scores()]
+    assert [v for _, v in live.net_scores()] == pytest.approx(
+        [v for _, v in fresh.net_scores()], abs=1e-9
+    )
+    assert live.peak() == pytest.approx(fresh.peak())
+    assert live.overflow(2.0) == pytest.approx(fresh.overflow(2.0))
+
+
+def test_placement_module_shares_the_kernel():
+    from kicad_tools.placement import cpp_backend as placement_backend
+    from kicad_tools.placement.cost import BoardOutline
+    from kicad_tools.router.congestion_estimator import TileGrid
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    if not placement_backend.is_cpp_available():
+        pytest.skip("C++ placement backend not built")
+
+    board = BoardOutline(0.0, 0.0, 80.0, 60.0)
+    placed = placement_backend.create_rudy_map(board, target_tiles=120)
+    grid = TileGrid.from_board(0.0, 0.0, 80.0, 60.0, target_tiles=120)
+    routed = router_cpp.RudyMap(
+        grid.origin_x, grid.origin_y, grid.tile_w, grid.tile_h, grid.cols, grid.rows
+    )
+    assert (placed.cols, placed.rows) == (grid.cols, grid.rows)
+
+    rng = random.Random(9)
+    for net in range(1, 21):
+        pins = [(rng.uniform(0.0, 80.0), rng.uniform(0.0, 60.0), net % 5) for _ in range(3)]
+        placed.set_net(net, pins)
+        routed.set_net(net, pins)
+    placed.move_component(2, 4.0, -1.5)
+    routed.move_component(2, 4.0, -1.5)
+    assert placed.demand() == routed.demand()
+    assert placed.net_scores() == routed.net_scores()
+
+
+def test_placement_congestion_is_incremental():
+    from kicad_tools.placement import cpp_backend as placement_backend
+    from kicad_tools.placement.cost import BoardOutline, Net
+    from kicad_tools.placement.vector import PlacedComponent, TransformedPad
+
+    if not placement_backend.is_cpp_available():
+        pytest.skip("C++ placement backend not built")
+
+    offsets = [(-1.0, 0.0), (1.0, 0.5)]
+
+    def place(ref, x, y, rotation):
+        pads = []
+        for k, (dx, dy) in enumerate(offsets):
+            for _ in range(int(rotation) // 90):
+                dx, dy = -dy, dx
+            pads.append(TransformedPad(str(k + 1), x + dx, y + dy, 0.5, 0.5))
+        return PlacedComponent(ref, x, y, rotation, 0, tuple(pads))
+
+    rng = random.Random(5)
+    refs = [f"U{k}" for k in range(12)]
+    nets = [
+        Net(f"N{n}", [(rng.choice(refs), str(rng.randint(1, 2))) for _ in range(rng.randint(2, 4))])
+        for n in range(25)
+    ]
+    board = BoardOutline(0.0, 0.0, 80.0, 60.0)
+    poses = {ref: (rng.uniform(5.0, 75.0), rng.uniform(5.0, 55.0), 0.0) for ref in refs}
+
+    live = placement_backend.PlacementCongestion(board, nets, use_native=True)
+    assert live.native
+    for step in range(30):
+        placements = [place(ref, *poses[ref]) for ref in refs]
+        fresh = placement_backend.PlacementCongestion(board, nets, use_native=True)
+        python = placement_backend.PlacementCongestion(board, nets, use_native=False)
+        peak = live.update(placements)
+        assert peak == pytest.approx(fresh.update(placements), abs=1e-9)
+        assert peak == pytest.approx(python.update(placements), abs=1e-9)
+
+        # Mostly translations (one move_component each), every fifth a rotation.
+        ref = rng.choice(refs)
+        x, y, rotation = poses[ref]
+        if step % 5 == 4:
+            rotation = (rotation + 90.0) % 360.0
+        poses[ref] = (x + rng.uniform(-3.0, 3.0), y + rng.uniform(-3.0, 3.0), rotation)
@@ -0,0 +1,190 @@
+"""Tests for the native sparse routing graph (``router_cpp.SparseGraph``).
+
+``SparseRoutingGraph`` builds its waypoints, visibility edges and A* in C++
+when the router backend is built: rectangular clearance contours, exact
+segment / box line of sight over a bucket index, via twins created at
+``build()`` and a CSR search.
+
+These tests cover:
+
+1. The Python views (``waypoints``, ``pad_waypoints``, ``stats``) mirror the
+   native graph, and via twins stay out of them.
+2. Bucket-indexed ``line_of_sight`` / ``point_blocked`` match a brute-force
+   check against every obstacle.
+3. Routes never pass through another net's pads, come back as valid
+   ``Route`` objects, and corridors steer ``find_global_path``.
+4. ``build`` does not depend on the thread count, and adding obstacles
+   after a build drops the old edges.
+"""
+
+from __future__ import annotations
+
+import random
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+
+@pytest.fixture
+def rules():
+    from kicad_tools.router.rules import DesignRules
+
+    return DesignRules(
+        trace_width=0.127,
+        trace_clearance=0.127,
+        via_drill=0.3,
+        via_diameter=0.5,
+        grid_resolution=0.0635,
+    )
+
+
+def _pad(x: float, y: float, net: int, *, through_hole: bool = False):
+    from kicad_tools.router.layers import Layer
+    from kicad_tools.router.primitives import Pad
+
+    return Pad(
+        x=x,
+        y=y,
+        width=0.5,
+        height=0.5,
+        net=net,
+        net_name=f"NET{net}",
+        layer=Layer.F_CU,
+        through_hole=through_hole,
+        drill=0.8 if through_hole else 0,
+    )
+
+
+def _graph(rules, **kwargs):
+    from kicad_tools.router.sparse import SparseRoutingGraph
+
+    return SparseRoutingGraph(width=40.0, height=30.0, rules=rules, use_native=True, **kwargs)
+
+
+def test_python_views_mirror_native_graph(rules):
+    graph = _graph(rules)
+    assert graph._native is not None
+    graph.add_pad(_pad(10.0, 10.0, 1))
+    graph.add_pad(_pad(20.0, 15.0, 2, through_hole=True))
+    graph.add_obstacle(25.0, 20.0, 0.3, 0.3, net=3)
+
+    stats = graph.get_statistics()
+    assert stats["pad_waypoints"] == 3  # SMD on layer 0, TH on both layers
+    assert stats["contour_waypoints"] == 8 + 2 * 8 + 2 * 8
+    assert len(graph.pad_waypoints[(2, 1)]) == 1
+
+    graph.add_sparse_grid()
+    graph.build_visibility_graph()
+    native = graph._native
+    assert native.num_waypoints > native.num_base_waypoints  # via twins
+    assert graph.get_statistics()["total_waypoints"] == native.num_base_waypoints
+    assert graph.get_statistics()["total_edges"] == native.num_edges > 0
+    kinds = {wp.waypoint_type for wps in graph.waypoints.values() for wp in wps}
+    assert kinds == {"pad", "contour", "sparse"}
+
+
+def test_line_of_sight_matches_brute_force(rules):
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    rng = random.Random(7)
+    buffer = rules.trace_clearance + rules.trace_width / 2
+    native = router_cpp.SparseGraph(40.0, 30.0, 0.0, 0.0, 2, buffer)
+    boxes = []
+    for net in range(1, 120):
+        x, y = rng.uniform(0, 40), rng.uniform(0, 30)
+        hw, hh = rng.uniform(0.1, 1.5), rng.uniform(0.1, 1.5)
+        layer = net % 2
+        native.add_obstacle(x, y, hw, hh, net, [layer])
+        boxes.append((x, y, hw + buffer, hh + buffer, layer))
+    native.build()
+
+    def blocked(px, py, layer):
+        return any(
+            lay == layer and abs(px - cx) < ew and abs(py - cy) < eh
+            for cx, cy, ew, eh, lay in boxes
+        )
+
+    def visible(x1, y1, x2, y2, layer):
+        # Dense sampling: conservative enough at this scale for random segments.
+        steps = 400
+        return not any(
+            blocked(x1 + (x2 - x1) * k / steps, y1 + (y2 - y1) * k / steps, layer)
+            for k in range(1, steps)
+        )
+
+    for _ in range(300):
+        x1, y1 = rng.uniform(0, 40), rng.uniform(0, 30)
+        x2, y2 = x1 + rng.uniform(-6, 6), y1 + rng.uniform(-6, 6)
+        layer = rng.randrange(2)
+        assert native.point_blocked(x1, y1, layer) == blocked(x1, y1, layer)
+        if blocked(x1, y1, layer) or blocked(x2, y2, layer):
+            continue
+        if native.line_of_sight(x1, y1, x2, y2, layer):
+            assert visible(x1, y1, x2, y2, layer)
+
+
+def test_routes_avoid_foreign_pads(rules):
+    graph = _graph(rules)
+    pads = [_pad(5.0 + 3.0 * i, 8.0 + 2.0 * (i % 3), 1 + i % 4) for i in range(10)]
+    for pad in pads:
+        graph.add_pad(pad)
+    graph.add_sparse_grid()
+    graph.build_visibility_graph()
+
+    start, end = pads[0], pads[8]
+    route = graph.route(start, end)
+    assert route is not None and route.segments
+    assert (route.segments[0].x1, route.segments[0].y1) == (start.x, start.y)
+    assert (route.segments[-1].x2, route.segments[-1].y2) == (end.x, end.y)
+
+    path = graph.find_global_path(start, end)
+    assert path[0].waypoint_type == path[-1].waypoint_type == "pad"
+    assert all(wp.net in (0, start.net) for wp in path)
+
+
+def test_corridor_penalty_steers_global_path(rules):
+    from kicad_tools.router.sparse import Waypoint
+
+    graph = _graph(rules, num_layers=1)
+    start, end = _pad(5.0, 15.0, 1), _pad(35.0, 15.0, 1)
+    graph.add_pad(start)
+    graph.add_pad(end)
+    graph.add_sparse_grid()
+    graph.build_visibility_graph()
+    direct = graph.find_global_path(start, end)
+
+    # Another net's corridor across the straight line, open above and below.
+    graph.reserve_corridor(2, [Waypoint(20.0, 10.0, 0), Waypoint(20.0, 20.0, 0)], width=1.0)
+    detour = graph.find_global_path(start, end)
+    assert detour != direct
+    assert any(abs(wp.y - 15.0) > 4.0 for wp in detour)
+
+    graph.clear_all_corridors()
+    assert graph.find_global_path(start, end) == direct
+
+
+def test_build_is_thread_independent_and_invalidated_by_adds(rules):
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    def build(num_threads):
+        rng = random.Random(3)
+        native = router_cpp.SparseGraph(40.0, 30.0, 0.0, 0.0, 2, 0.2)
+        for net in range(1, 60):
+            native.add_pad(rng.uniform(0, 40), rng.uniform(0, 30), 0.3, 0.4, net, [0, 1])
+        native.add_sparse_grid(2.0)
+        native.build(10.0, num_threads)
+        return native
+
+    one, four = build(1), build(4)
+    assert one.num_edges == four.num_edges
+    for wp in range(0, one.num_waypoints, 17):
+        assert one.neighbors(wp) == four.neighbors(wp)
+
+    base = one.num_base_waypoints
+    one.add_obstacle(20.0, 15.0, 1.0, 1.0, 0, [0])
+    assert not one.built
+    assert one.num_edges == 0
+    assert one.num_waypoints == one.num_base_waypoints > base
@@ -0,0 +1,220 @@
+"""Tests for the native RSMT builder (``router_cpp.build_rsmt`` / ``SteinerBuilder``).
+
+``build_rsmt`` (without a ``congestion_fn``) builds its topology in C++ when
+the router backend is built: exact Hanan-subset enumeration up to five
+terminals, batched 1-Steiner with incremental MST scoring above.
+``build_rsmt_batch`` builds a whole board's nets in one threaded call and,
+on a ``CppGrid``, relocates blocked Steiner points against its cells.
+
+These tests cover:
+
+1. Native trees are valid spanning trees, sorted shortest edge first, never
+   longer than the MST, and never longer than the Python tree up to five
+   terminals (where the native builder is exact).
+2. ``SteinerBuilder.relocate`` matches ``relocate_blocked_point`` with the
+   ``make_blocked_cell_predicate`` predicate.
+3. ``build_rsmt_batch`` keeps Steiner points off blocked cells and does not
+   depend on the thread count.
+4. Without a grid, ``build_rsmt_batch`` builds through ``build_rsmt_all``
+   and matches the per-net native trees; ``MSTRouter.route_net`` decomposes
+   through the grid-aware native batch.
+"""
+
+from __future__ import annotations
+
+import random
+
+import pytest
+
+from kicad_tools.router.cpp_backend import is_cpp_available
+
+pytestmark = pytest.mark.skipif(not is_cpp_available(), reason="C++ router backend not built")
+
+
+def _pads(terminals, net: int = 1):
+    from kicad_tools.router.primitives import Pad
+
+    return [
+        Pad(x=x, y=y, width=0.5, height=0.5, net=net, net_name=f"N{net}") for x, y in terminals
+    ]
+
+
+def _length(pads, edges) -> float:
+    return sum(abs(pads[i].x - pads[j].x) + abs(pads[i].y - pads[j].y) for i, j in edges)
+
+
+def _assert_tree(pads, edges, num_terminals: int, *, sorted_edges: bool = True):
+    assert len(edges) == len(pads) - 1
+    parent = list(range(len(pads)))
+
+    def find(i: int) -> int:
+        while parent[i] != i:
+            i = parent[i]
+        return i
+
+    for i, j in edges:
+        parent[find(i)] = find(j)
+    assert len({find(i) for i in range(len(pads))}) == 1
+    assert all(p.steiner_point for p in pads[num_terminals:])
+    if sorted_edges:
+        lengths = [_length(pads, [e]) for e in edges]
+        assert lengths == sorted(lengths)
+
+
+@pytest.mark.parametrize("count", [3, 4, 5, 7, 12, 25])
+def test_native_trees_match_or_beat_python(count: int):
+    from kicad_tools.router.algorithms.steiner import _mst_cost, build_rsmt
+
+    rng = random.Random(count)
+    for _ in range(15):
+        terminals = [(rng.randrange(40) * 0.5, rng.randrange(40) * 0.5) for _ in range(count)]
+        pads = _pads(terminals)
+        native, native_edges = build_rsmt(pads, use_native=True)
+        _assert_tree(native, native_edges, count)
+        native_len = _length(native, native_edges)
+        assert native_len <= _mst_cost(terminals) + 1e-9
+        if count <= 5:
+            python, python_edges = build_rsmt(pads, use_native=False)
+            assert native_len <= _length(python, python_edges) + 1e-9
+
+
+def test_binding_and_congestion_fn_fallback():
+    from kicad_tools.router import cpp_backend
+    from kicad_tools.router.algorithms.steiner import build_rsmt
+
+    pads = _pads([(0.0, 0.0), (4.0, 0.0), (2.0, 3.0), (1.0, 5.0)])
+    tree = cpp_backend.router_cpp.build_rsmt([(p.x, p.y) for p in pads])
+    assert tree.num_terminals == 4
+    assert tree.length == pytest.approx(_length(*build_rsmt(pads, use_native=True)))
+
+    def cost(x1, y1, x2, y2):
+        return abs(x1 - x2) + abs(y1 - y2)
+
+    extended, edges = build_rsmt(pads, congestion_fn=cost, use_native=True)
+    _assert_tree(extended, edges, 4)
+
+
+def _blocked_grid():
+    from kicad_tools.router.cpp_backend import CppGrid
+
+    grid = CppGrid(80, 60, 2, 0.1)
+    for layer in range(2):
+        for y in range(15, 45):
+            for x in range(25, 55):
+                grid._impl.mark_blocked(x, y, layer, 0, True)
+    # Foreign copper on one layer only: still routable on the other.
+    for y in range(5, 10):
+        for x in range(5, 10):
+            grid._impl.mark_blocked(x, y, 0, 9, False)
+    return grid
+
+
+def test_relocate_matches_python_ring_scan():
+    from kicad_tools.router.algorithms.steiner import (
+        _relocation_margin_cells,
+        make_blocked_cell_predicate,
+        relocate_blocked_point,
+    )
+    from kicad_tools.router.cpp_backend import router_cpp
+    from kicad_tools.router.rules import DesignRules
+
+    grid = _blocked_grid()
+    rules = DesignRules(trace_width=0.2, trace_clearance=0.1, grid_resolution=0.1)
+    builder = router_cpp.SteinerBuilder(grid._impl, _relocation_margin_cells(grid, rules))
+    for net in (1, 9):
+        predicate = make_blocked_cell_predicate(grid, rules, net)
+        for gx, gy in [(40, 30), (26, 16), (54, 44), (7, 7), (0, 0), (79, 59), (60, 30)]:
+            assert builder.point_blocked(gx, gy, net) == predicate(gx, gy)
+            assert builder.relocate(gx, gy, net) == relocate_blocked_point(gx, gy, predicate)
+
+
+def test_batch_relocates_and_is_thread_independent():
+    from kicad_tools.router.algorithms.steiner import (
+        build_rsmt_batch,
+        make_blocked_cell_predicate,
+    )
+    from kicad_tools.router.rules import DesignRules
+
+    grid = _blocked_grid()
+    rules = DesignRules(trace_width=0.2, trace_clearance=0.1, grid_resolution=0.1)
+    rng = random.Random(5)
+    nets = {
+        net: _pads(
+            [(rng.uniform(0.0, 7.9), rng.uniform(0.0, 5.9)) for _ in range(2 + net % 9)], net
+        )
+        for net in range(1, 41)
+    }
+    one = build_rsmt_batch(nets, grid, rules, num_threads=1)
+    four = build_rsmt_batch(nets, grid, rules, num_threads=4)
+    assert one.keys() == nets.keys()
+
+    steiner_points = 0
+    for net, (extended, edges) in one.items():
+        other, other_edges = four[net]
+        assert edges == other_edges
+        assert [(p.x, p.y) for p in extended] == [(p.x, p.y) for p in other]
+        # Edges are ordered by the unsnapped lengths, so skip that check.
+        _assert_tree(extended, edges, len(nets[net]), sorted_edges=False)
+        predicate = make_blocked_cell_predicate(grid, rules, net)
+        for pad in extended[len(nets[net]) :]:
+            gx, gy = grid.world_to_grid(pad.x, pad.y)
+            assert (pad.x, pad.y) == pytest.approx(grid.grid_to_world(gx, gy))
+            assert not predicate(gx, gy)
+            steiner_points += 1
+    assert steiner_points > 0
+
+
+def test_gridless_batch_matches_per_net_native(monkeypatch):
+    from kicad_tools.router.algorithms import steiner
+    from kicad_tools.router.cpp_backend import router_cpp
+
+    rng = random.Random(11)
+    nets = {
+        net: _pads([(rng.randrange(40) * 0.5, rng.randrange(40) * 0.5) for _ in range(net)], net)
+        for net in range(3, 20)
+    }
+    calls = []
+    build_all = router_cpp.build_rsmt_all
+    monkeypatch.setattr(
+        router_cpp,
+        "build_rsmt_all",
+        lambda *args, **kwargs: calls.append(args) or build_all(*args, **kwargs),
+    )
+    trees = steiner.build_rsmt_batch(nets)
+    assert len(calls) == 1
+    for net, pads in nets.items():
+        extended, edges = trees[net]
+        expected, expected_edges = steiner.build_rsmt(pads, use_native=True)
+        assert edges == expected_edges
+        assert [(p.x, p.y) for p in extended] == [(p.x, p.y) for p in expected]
+
+
+def test_mst_router_decomposes_on_native_grid(monkeypatch):
+    from unittest.mock import MagicMock
+
+    from kicad_tools.router.algorithms import steiner
+    from kicad_tools.router.algorithms.mst import MSTRouter
+    from kicad_tools.router.cpp_backend import router_cpp
+    from kicad_tools.router.rules import DesignRules
+
+    grid = _blocked_grid()
+    rules = DesignRules(trace_width=0.2, trace_clearance=0.1, grid_resolution=0.1)
+    built = []
+    builder_cls = router_cpp.SteinerBuilder
+    monkeypatch.setattr(
+        router_cpp,
+        "SteinerBuilder",
+        lambda *args, **kwargs: built.append(args) or builder_cls(*args, **kwargs),
+    )
+    router = MagicMock()
+    router.route.return_value = None
+    pads = _pads([(2.0, 1.0), (6.0, 5.0), (2.0, 5.0), (6.0, 1.0)])
+    MSTRouter(grid, router, rules, {}).route_net(pads, lambda route: None)
+
+    assert len(built) == 1
+    expected, expected_edges = steiner.build_rsmt_batch({1: pads}, grid, rules)[1]
+    routed = [(call.args[0], call.args[1]) for call in router.route.call_args_list]
+    assert [((a.x, a.y), (b.x, b.y)) for a, b in routed] == [
+        ((expected[i].x, expected[i].y), (expected[j].x, expected[j].y))
+        for i, j in expected_edges
+    ]
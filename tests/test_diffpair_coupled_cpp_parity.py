@@ -190,22 +190,20 @@ def test_route_coupled_falls_back_when_cpp_disabled():
     assert len(p.segments) > 0 and len(n.segments) > 0
 
 
-def test_swap_via_and_manhattan_defer_to_python():
-    """The v1-deferred features must NOT be handled by the C++ path."""
+def test_swap_via_and_manhattan_use_cpp():
+    """The v1-deferred features are native now and stay on the C++ path."""
     grid = _make_grid()
-    # allow_swap_via -> deferred.
     pf_swap = CoupledPathfinder(
         grid=grid, rules=DesignRules(), target_spacing_cells=2, allow_swap_via=True
     )
-    assert not pf_swap._cpp_coupled_available()
-    # manhattan_sum heuristic -> deferred.
+    assert pf_swap._cpp_coupled_available()
     pf_man = CoupledPathfinder(
         grid=grid,
         rules=DesignRules(),
         target_spacing_cells=2,
         heuristic_mode="manhattan_sum",
     )
-    assert not pf_man._cpp_coupled_available()
+    assert pf_man._cpp_coupled_available()
 
 
 # ---------------------------------------------------------------------------
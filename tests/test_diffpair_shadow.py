@@ -634,10 +634,11 @@ class _StubPathfinder:
 
 
 def _patch_pathfinder_capture_weight(monkeypatch, result, rescue_eligible=True):
-    """Patch the module ``CoupledPathfinder``; capture ``heuristic_weight``.
+    """Patch the module ``CoupledPathfinder``; capture its search knobs.
 
-    Returns a ``captured`` dict whose ``"heuristic_weight"`` key records the
-    value the pre-phase constructed the pathfinder with.
+    Returns a ``captured`` dict whose ``"heuristic_weight"`` and
+    ``"distance_heuristic"`` keys record the values the pre-phase
+    constructed the pathfinder with.
     """
     import kicad_tools.router.diffpair_routing as dpr_mod
 
@@ -645,6 +646,7 @@ def _patch_pathfinder_capture_weight(monkeypatch, result, rescue_eligible=True):
 
     def _factory(*_a, **kwargs):
         captured["heuristic_weight"] = kwargs.get("heuristic_weight")
+        captured["distance_heuristic"] = kwargs.get("distance_heuristic")
         return _StubPathfinder(result, rescue_eligible=rescue_eligible)
 
     monkeypatch.setattr(dpr_mod, "CoupledPathfinder", _factory)
@@ -700,6 +702,98 @@ def test_flag_on_uses_weighted_astar_search(monkeypatch):
     )
 
 
+@pytest.mark.parametrize("shadow", [False, True])
+def test_distance_heuristic_follows_its_own_setting(monkeypatch, shadow):
+    """The goal-distance field is keyed on ``distance_heuristic``, not the shadow flag.
+
+    It is admissible, so it keeps the flag-off classic A* optimal; the open
+    search is off by default and gets it only when a flow opts in.
+    """
+    router, pair = _two_pad_coupled_router_and_pair()
+    dpr = router._diffpair
+    dpr.enable_shadow_construction = shadow
+    monkeypatch.setattr(dpr, "_single_ended_guide_route", lambda *a, **k: None)
+    captured = _patch_pathfinder_capture_weight(monkeypatch, None, rescue_eligible=False)
+
+    dpr.route_differential_pair_coupled(pair, coupled_only=True)
+    assert captured.get("distance_heuristic") is False
+
+    dpr.distance_heuristic = True
+    dpr.route_differential_pair_coupled(pair, coupled_only=True)
+    assert captured.get("distance_heuristic") is True
+
+
+def test_distance_heuristic_plumbed_from_config():
+    """``route_all_with_diffpairs`` copies ``distance_heuristic`` onto the router."""
+    from kicad_tools.router.core import Autorouter
+    from kicad_tools.router.diffpair import DifferentialPairConfig
+
+    router = Autorouter(width=12.7, height=12.7, rules=DesignRules())
+    dpr = router._diffpair
+    assert DifferentialPairConfig().distance_heuristic is False
+
+    router.route_all_with_diffpairs(
+        diffpair_config=DifferentialPairConfig(enabled=True, distance_heuristic=True)
+    )
+    assert dpr.distance_heuristic is True
+    router.route_all_with_diffpairs(diffpair_config=DifferentialPairConfig(enabled=True))
+    assert dpr.distance_heuristic is False
+
+
+def test_flag_off_detour_converges_within_flagoff_budget(monkeypatch):
+    """A flag-off pair forced around a wall converges inside the flag-off budget.
+
+    A foreign-net pad walls off the straight run between the pads, so the
+    pair has to detour below it.  The flag-off search (classic A*, no
+    explicit budget, so ``COUPLED_FLAGOFF_MAX_ITERATIONS`` applies) must
+    commit the coupled route without tripping that budget.
+    """
+    import kicad_tools.router.diffpair_routing as dpr_mod
+    from kicad_tools.router.cpp_backend import is_cpp_available
+    from kicad_tools.router.diffpair_routing import COUPLED_FLAGOFF_MAX_ITERATIONS
+
+    if not is_cpp_available():
+        pytest.skip("C++ router backend not built")
+    assert COUPLED_FLAGOFF_MAX_ITERATIONS > 0
+
+    router, pair = _two_pad_coupled_router_and_pair()
+    router.add_component(
+        "W1",
+        [
+            {
+                "number": "1",
+                "x": 15.0,
+                "y": 3.5,
+                "width": 0.6,
+                "height": 6.0,
+                "net": 3,
+                "net_name": "GND",
+            }
+        ],
+    )
+    dpr = router._diffpair
+    dpr.enable_shadow_construction = False
+
+    created = []
+    real_pathfinder = dpr_mod.CoupledPathfinder
+
+    def _spy(*args, **kwargs):
+        created.append(real_pathfinder(*args, **kwargs))
+        return created[-1]
+
+    monkeypatch.setattr(dpr_mod, "CoupledPathfinder", _spy)
+
+    routes, _warning = dpr.route_differential_pair_coupled(pair, coupled_only=True)
+
+    assert created and not created[0].distance_heuristic
+    pathfinder = created[0]
+    assert routes, "flag-off detour pair must converge in the coupled search"
+    # The corridor attempt builds the goal-distance field on its own.
+    assert pathfinder._cpp_coupled_impl.distance_heuristic
+    assert not pathfinder.last_timeout_exceeded
+    assert 0 < pathfinder.last_iterations <= COUPLED_FLAGOFF_MAX_ITERATIONS
+
+
 # ---------------------------------------------------------------------------
 # Issue #3921: coupled budget-exit DIAGNOSTIC.
 #
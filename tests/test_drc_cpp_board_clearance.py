@@ -0,0 +1,169 @@
+"""Tests for the whole-board pad clearance sweep (``drc_cpp.check_board_clearance``).
+
+``IncrementalDRC.full_check`` sends every footprint to the native sweep in one
+call instead of one ``check_pair_clearance`` call per candidate pair.  The
+sweep must report exactly the violations the per-pair path reports.
+"""
+
+from __future__ import annotations
+
+import random
+from pathlib import Path
+from unittest.mock import patch
+
+import pytest
+
+from kicad_tools.drc.cpp_backend import is_board_clearance_available
+from kicad_tools.drc.incremental import IncrementalDRC
+from kicad_tools.manufacturers.base import DesignRules
+from kicad_tools.schema.pcb import PCB
+
+pytestmark = pytest.mark.skipif(
+    not is_board_clearance_available(), reason="C++ DRC board clearance sweep not built"
+)
+
+_HEADER = """(kicad_pcb
+  (version 20240108)
+  (generator "test")
+  (generator_version "8.0")
+  (general (thickness 1.6) (legacy_teardrops no))
+  (paper "A4")
+  (layers
+    (0 "F.Cu" signal)
+    (31 "B.Cu" signal)
+    (44 "Edge.Cuts" user)
+  )
+  (setup (pad_to_mask_clearance 0))
+  (net 0 "")
+{nets}
+"""
+
+_FOOTPRINT = """  (footprint "Package_SO:Test"
+    (layer "F.Cu")
+    (uuid "00000000-0000-0000-0000-{uid:012d}")
+    (at {x:.4f} {y:.4f} {rot})
+    (property "Reference" "{ref}" (at 0 -1.5 0) (layer "F.SilkS"))
+{pads}
+  )
+"""
+
+_PAD = (
+    '    (pad "{num}" smd rect (at {x:.4f} {y:.4f}) (size {w:.3f} {h:.3f}) '
+    '(layers "F.Cu" "F.Paste" "F.Mask") (net {net} "{name}"))'
+)
+
+
+def _random_board(seed: int, count: int) -> str:
+    """Dense board of small multi-pad parts, some placed too close."""
+    rng = random.Random(seed)
+    nets = "\n".join(f'  (net {n} "N{n}")' for n in range(1, 21))
+    parts = [_HEADER.format(nets=nets)]
+    side = (count**0.5) * 2.5
+    for k in range(count):
+        pads = []
+        for p in range(rng.randint(1, 6)):
+            net = rng.randint(0, 20)
+            pads.append(
+                _PAD.format(
+                    num=p + 1,
+                    x=rng.uniform(-1.2, 1.2),
+                    y=rng.uniform(-0.8, 0.8),
+                    w=rng.uniform(0.2, 0.9),
+                    h=rng.uniform(0.2, 0.9),
+                    net=net,
+                    name=f"N{net}" if net else "",
+                )
+            )
+        parts.append(
+            _FOOTPRINT.format(
+                uid=k + 1,
+                x=100 + rng.uniform(0, side),
+                y=100 + rng.uniform(0, side),
+                rot=rng.choice([0, 45, 90, 180, 270]),
+                ref=f"U{k + 1}",
+                pads="\n".join(pads),
+            )
+        )
+    parts.append(")\n")
+    return "".join(parts)
+
+
+def _load_pcb(tmp_path: Path, content: str) -> PCB:
+    pcb_file = tmp_path / "board.kicad_pcb"
+    pcb_file.write_text(content)
+    return PCB.load(str(pcb_file))
+
+
+@pytest.fixture
+def rules() -> DesignRules:
+    return DesignRules(
+        min_trace_width_mm=0.1,
+        min_clearance_mm=0.2,
+        min_via_drill_mm=0.3,
+        min_via_diameter_mm=0.6,
+        min_annular_ring_mm=0.15,
+    )
+
+
+def _key(violation):
+    return tuple(sorted(violation.items))
+
+
+@pytest.mark.parametrize("seed", [1, 2, 3])
+def test_board_sweep_matches_per_pair_checks(tmp_path: Path, rules: DesignRules, seed: int):
+    pcb = _load_pcb(tmp_path, _random_board(seed, 150))
+
+    swept = IncrementalDRC(pcb, rules).full_check()
+    with patch("kicad_tools.drc.incremental.is_board_clearance_available", return_value=False):
+        per_pair = IncrementalDRC(pcb, rules).full_check()
+    with patch("kicad_tools.drc.incremental._is_drc_cpp_available", return_value=False):
+        python = IncrementalDRC(pcb, rules).full_check()
+
+    assert swept, "fixture should contain violations"
+    # Same pairs, worst pads, clearance and location as the per-pair kernel.
+    assert sorted((v.items, v.nets, v.actual_value, v.location) for v in swept) == sorted(
+        (v.items, v.nets, v.actual_value, v.location) for v in per_pair
+    )
+    assert {_key(v) for v in swept} == {_key(v) for v in python}
+    assert all(v.rule_id == "clearance" and v.required_value == 0.2 for v in swept)
+
+
+def test_sweep_orders_pairs_and_threads_deterministically():
+    from kicad_tools.drc.cpp_backend import drc_cpp
+
+    # Three single-pad parts in a row; the outer two are far apart.
+    args = (
+        [0.0, 0.0, 0.0],
+        [0.0, 0.0, 0.0],
+        [1.0, 1.0, 1.0],
+        [1.0, 1.0, 1.0],
+        [1, 2, 3],
+        [0, 1, 2, 3],
+        [0.0, 1.1, 2.2],
+        [0.0, 0.0, 0.0],
+        [0.0, 0.0, 0.0],
+        0.2,
+    )
+    results = drc_cpp.check_board_clearance(*args)
+    assert [(r.footprint1, r.footprint2) for r in results] == [(0, 1), (1, 2)]
+    assert results[0].min_clearance == pytest.approx(0.1)
+    assert (results[0].location_x, results[0].location_y) == pytest.approx((0.55, 0.0))
+    for threads in (1, 2, 8):
+        again = drc_cpp.check_board_clearance(*args, num_threads=threads)
+        assert [(r.footprint1, r.footprint2, r.min_clearance) for r in again] == [
+            (r.footprint1, r.footprint2, r.min_clearance) for r in results
+        ]
+
+    # Same-net pads may touch.
+    same_net = list(args)
+    same_net[4] = [1, 1, 1]
+    assert drc_cpp.check_board_clearance(*same_net) == []
+
+
+def test_sweep_rejects_mismatched_offsets():
+    from kicad_tools.drc.cpp_backend import drc_cpp
+
+    with pytest.raises(ValueError):
+        drc_cpp.check_board_clearance(
+            [0.0], [0.0], [1.0], [1.0], [1], [0, 2], [0.0], [0.0], [0.0], 0.2
+        )
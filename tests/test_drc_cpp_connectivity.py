@@ -0,0 +1,186 @@
+"""Tests for the native copper connectivity engine (``drc_cpp.CopperConnectivity``).
+
+Board copper is joined by a union-find over a per-layer spatial index, and
+routes are committed incrementally.  The different-net short verifier and
+the router's per-pad reachability walk run on it when it is built, and must
+report exactly what their pairwise Python loops report.
+"""
+
+from __future__ import annotations
+
+import random
+
+import pytest
+
+from kicad_tools.drc.copper_connectivity import ConnectivityTracker
+from kicad_tools.drc.cpp_backend import (
+    COPPER_PAD,
+    COPPER_SEGMENT,
+    COPPER_VIA,
+    is_connectivity_available,
+)
+from kicad_tools.drc.different_net_short import find_different_net_shorts
+from kicad_tools.router.connectivity import check_net_pad_connectivity
+from kicad_tools.router.layers import Layer as RouteLayer
+from kicad_tools.router.primitives import Segment as RouteSegment
+from kicad_tools.router.primitives import Via as RouteVia
+from kicad_tools.schema.pcb import Footprint, Layer, Net, Pad, Segment, Via
+
+pytestmark = pytest.mark.skipif(
+    not is_connectivity_available(), reason="C++ DRC connectivity engine not built"
+)
+
+_LAYERS = ("F.Cu", "In1.Cu", "In2.Cu", "B.Cu")
+
+
+class _Board:
+    """The PCB surface the marshalling and the short verifier read."""
+
+    def __init__(self, segments=(), vias=(), footprints=(), nets=4):
+        self.segments = list(segments)
+        self.vias = list(vias)
+        self.footprints = list(footprints)
+        self.zones = []
+        self._nets = {n: Net(n, f"N{n}" if n else "") for n in range(nets + 1)}
+        self.copper_layers = [Layer(i, name, "signal") for i, name in enumerate(_LAYERS)]
+
+    @property
+    def nets(self):
+        return self._nets
+
+
+def _seg(x1, y1, x2, y2, width=0.2, layer="F.Cu", net=1):
+    return Segment((x1, y1), (x2, y2), width, layer, net, f"N{net}" if net else "")
+
+
+def _via(x, y, size=0.6, layers=("F.Cu", "B.Cu"), net=1):
+    return Via((x, y), size, 0.3, list(layers), net, f"N{net}" if net else "")
+
+
+def _fp(ref, pads):
+    fp = Footprint(name="fp", reference=ref, value="", position=(0.0, 0.0), rotation=0.0,
+                   layer="F.Cu")
+    fp.pads = [
+        Pad(number=str(k + 1), type="smd", shape="circle", position=(x, y), size=(0.5, 0.5),
+            layers=["F.Cu"], net_number=net, net_name=f"N{net}")
+        for k, (x, y, net) in enumerate(pads)
+    ]
+    return fp
+
+
+def _random_copper(rng: random.Random, n_seg=60, n_via=25):
+    segments = [
+        _seg(*(rng.uniform(0, 10) for _ in range(4)), width=rng.choice([0.15, 0.2, 0.3]),
+             layer=rng.choice(_LAYERS), net=rng.randint(0, 4))
+        for _ in range(n_seg)
+    ]
+    vias = [
+        _via(rng.uniform(0, 10), rng.uniform(0, 10),
+             layers=rng.choice([("F.Cu", "B.Cu"), ("F.Cu", "In1.Cu"), ("In2.Cu", "B.Cu")]),
+             net=rng.randint(0, 4))
+        for _ in range(n_via)
+    ]
+    return segments, vias
+
+
+def _python_backend(monkeypatch):
+    monkeypatch.setattr(
+        "kicad_tools.drc.cpp_backend.is_connectivity_available", lambda: False
+    )
+
+
+@pytest.mark.parametrize("seed", range(8))
+@pytest.mark.parametrize("clearance", [0.0, 0.15])
+def test_different_net_shorts_match_python(monkeypatch, seed: int, clearance: float):
+    board = _Board(*_random_copper(random.Random(seed)))
+    native = find_different_net_shorts(board, clearance=clearance)
+    _python_backend(monkeypatch)
+    python = find_different_net_shorts(board, clearance=clearance)
+
+    assert [(s.kind, s.net_a_name, s.net_b_name, s.layer) for s in native] == [
+        (s.kind, s.net_a_name, s.net_b_name, s.layer) for s in python
+    ]
+    for a, b in zip(native, python, strict=True):
+        assert (a.x, a.y) == pytest.approx((b.x, b.y))
+        assert a.gap == pytest.approx(b.gap, abs=1e-9)
+        assert (a.via_a, a.via_b) == (b.via_a, b.via_b)
+
+
+@pytest.mark.parametrize("seed", range(8))
+def test_pad_reachability_matches_python(monkeypatch, seed: int):
+    # F.Cu rows and In1.Cu columns, no two on one line, so same-layer copper
+    # only meets end-on-track; vias and pads join both layers at a point.
+    rng = random.Random(seed)
+    grid = [(float(x), float(y)) for x in range(5) for y in range(5)]
+    pads = rng.sample(grid, 4)
+    segments = []
+    for y in rng.sample(range(5), 3):
+        x1, x2 = sorted(rng.sample(range(5), 2))
+        segments.append(RouteSegment(x1=x1, y1=y, x2=x2, y2=y, width=0.2, layer=RouteLayer.F_CU))
+    for x in rng.sample(range(5), 3):
+        y1, y2 = sorted(rng.sample(range(5), 2))
+        segments.append(
+            RouteSegment(x1=x, y1=y1, x2=x, y2=y2, width=0.2, layer=RouteLayer.IN1_CU)
+        )
+    vias = [
+        RouteVia(x=x, y=y, drill=0.3, diameter=0.6, layers=(RouteLayer.F_CU, RouteLayer.B_CU))
+        for x, y in rng.sample(grid, rng.randint(0, 3))
+    ]
+
+    native = check_net_pad_connectivity(pads, segments, vias)
+    _python_backend(monkeypatch)
+    assert check_net_pad_connectivity(pads, segments, vias) == native
+
+
+def test_commit_reports_new_shorts_and_joins():
+    board = _Board(
+        segments=[_seg(0, 0, 5, 0, net=1)],
+        footprints=[_fp("U1", [(0, 0, 1), (10, 0, 1), (5, 5, 2)])],
+    )
+    tracker = ConnectivityTracker(board)
+    assert tracker.pads_connected(1) == (1, 2)
+    assert [pad.number for _, pad in tracker.stranded_pads()] == ["2"]
+
+    assert tracker.commit(segments=[_seg(5, 0, 10, 0, net=1)]) == []
+    assert tracker.pads_connected(1) == (2, 2)
+    assert tracker.stranded_pads() == []
+
+    # A net-2 via dropped on the net-1 track shorts it on F.Cu.
+    shorts = tracker.commit(vias=[_via(7, 0, net=2)])
+    assert [(s.kind, s.net_a_name, s.net_b_name, s.layer) for s in shorts] == [
+        ("via-segment", "N2", "N1", "F.Cu")
+    ]
+    assert shorts[0].via_a is tracker.items.vias[0]
+    assert tracker.shorts() == shorts
+    assert tracker.islands() == [tracker.items.vias[0]]
+
+
+def test_remove_net_rips_up_tracks_and_shorts():
+    board = _Board(footprints=[_fp("U1", [(0, 0, 1), (10, 0, 1), (5, -5, 2), (5, 5, 2)])])
+    tracker = ConnectivityTracker(board)
+    tracker.commit(segments=[_seg(0, 0, 10, 0, net=1)])
+    assert len(tracker.commit(segments=[_seg(5, -5, 5, 5, net=2)])) == 1
+    assert tracker.incomplete_nets() == []
+
+    tracker.remove_net(2)
+    assert tracker.shorts() == []
+    assert tracker.incomplete_nets() == [2]
+    assert tracker._engine.component(COPPER_SEGMENT, 1) == -1
+    assert tracker._engine.component(COPPER_SEGMENT, 0) == tracker._engine.component(
+        COPPER_PAD, 1
+    )
+
+
+def test_via_joins_only_the_layers_it_spans():
+    board = _Board(
+        segments=[_seg(0, 0, 5, 0, layer="F.Cu"), _seg(5, 0, 10, 0, layer="In2.Cu")],
+        vias=[_via(5, 0, layers=("F.Cu", "In1.Cu"))],
+    )
+    tracker = ConnectivityTracker(board)
+    engine = tracker._engine
+    assert engine.component(COPPER_VIA, 0) == engine.component(COPPER_SEGMENT, 0)
+    assert engine.component(COPPER_VIA, 0) != engine.component(COPPER_SEGMENT, 1)
+
+    tracker.commit(vias=[_via(5, 0, layers=("F.Cu", "B.Cu"))])
+    assert engine.component(COPPER_VIA, 1) == engine.component(COPPER_SEGMENT, 1)
+    assert engine.component(COPPER_SEGMENT, 0) == engine.component(COPPER_SEGMENT, 1)
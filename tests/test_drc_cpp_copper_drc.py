@@ -0,0 +1,338 @@
+"""Tests for the native copper DRC engine (``drc_cpp.check_copper_drc``).
+
+One native pass runs segment/via/pad clearance, zone fill clearance,
+hole-to-hole and hole-to-track checks over per-layer grid indexes.  Each
+class must report what the Python rule it replaces reports:
+``ClearanceRule._check_layer``, the two zone fill rules and
+``DimensionRules._check_drill_clearance`` all hand their scans to it.
+"""
+
+from __future__ import annotations
+
+import random
+
+import pytest
+
+from kicad_tools.drc.cpp_backend import (
+    CHECK_ALL,
+    CHECK_CLEARANCE,
+    CHECK_HOLE_TO_COPPER,
+    CHECK_HOLE_TO_HOLE,
+    CHECK_ZONE,
+    CopperBoardItems,
+    check_copper_drc_cpp,
+    is_copper_drc_available,
+    run_copper_drc_cpp,
+)
+from kicad_tools.schema.pcb import Footprint, Layer, Net, Pad, Segment, Via, Zone
+from kicad_tools.validate.rules.clearance import (
+    ClearanceRule,
+    SegmentZoneClearanceRule,
+    ViaZoneClearanceRule,
+)
+from kicad_tools.validate.rules.dimensions import DimensionRules
+from kicad_tools.validate.violations import DRCResults
+
+pytestmark = pytest.mark.skipif(
+    not is_copper_drc_available(), reason="C++ DRC copper engine not built"
+)
+
+_LAYERS = ("F.Cu", "In1.Cu", "In2.Cu", "B.Cu")
+
+
+class _Rules:
+    def __init__(self, min_clearance=0.2, min_hole_to_hole=0.5):
+        self.min_clearance_mm = min_clearance
+        self.min_hole_to_hole_mm = min_hole_to_hole
+
+
+class _Board:
+    """The PCB surface the clearance rules and the marshalling read."""
+
+    def __init__(self, segments=(), vias=(), footprints=(), zones=(), nets=4):
+        self.segments = list(segments)
+        self.vias = list(vias)
+        self.footprints = list(footprints)
+        self.zones = list(zones)
+        self.nets = {n: Net(n, f"N{n}" if n else "") for n in range(nets + 1)}
+        self.copper_layers = [Layer(i, name, "signal") for i, name in enumerate(_LAYERS)]
+
+    def segments_on_layer(self, layer):
+        return [s for s in self.segments if s.layer == layer]
+
+    def get_net(self, number):
+        return self.nets.get(number)
+
+
+def _seg(x1, y1, x2, y2, width=0.2, layer="F.Cu", net=1, uuid="s"):
+    return Segment((x1, y1), (x2, y2), width, layer, net, f"N{net}" if net else "", uuid)
+
+
+def _via(x, y, size=0.6, drill=0.3, layers=("F.Cu", "B.Cu"), net=1, uuid="v"):
+    return Via((x, y), size, drill, list(layers), net, f"N{net}" if net else "", uuid)
+
+
+def _pad(number, x, y, size=(1.0, 0.6), shape="rect", net=1, layers=("F.Cu",), drill=0.0):
+    return Pad(
+        number=number,
+        type="thru_hole" if drill else "smd",
+        shape=shape,
+        position=(x, y),
+        size=size,
+        layers=list(layers),
+        net_number=net,
+        net_name=f"N{net}" if net else "",
+        drill=drill,
+    )
+
+
+def _fp(ref, pads, position=(0.0, 0.0), rotation=0.0):
+    fp = Footprint(
+        name="fp", reference=ref, value="", position=position, rotation=rotation, layer="F.Cu"
+    )
+    fp.pads = list(pads)
+    return fp
+
+
+def _random_board(rng: random.Random) -> _Board:
+    segments = [
+        _seg(
+            rng.uniform(0, 10),
+            rng.uniform(0, 10),
+            rng.uniform(0, 10),
+            rng.uniform(0, 10),
+            width=rng.choice([0.15, 0.2, 0.3]),
+            layer=rng.choice(_LAYERS),
+            net=rng.randint(0, 4),
+            uuid=f"seg{k:05d}",
+        )
+        for k in range(40)
+    ]
+    vias = [
+        _via(
+            rng.uniform(0, 10),
+            rng.uniform(0, 10),
+            layers=rng.choice([("F.Cu", "B.Cu"), ("F.Cu", "In1.Cu"), ("In2.Cu", "B.Cu")]),
+            net=rng.randint(0, 4),
+            uuid=f"via{k:05d}",
+        )
+        for k in range(15)
+    ]
+    footprints = []
+    for k in range(4):
+        pads = [
+            _pad(
+                str(p + 1),
+                rng.uniform(-1.5, 1.5),
+                rng.uniform(-1.5, 1.5),
+                size=(rng.uniform(0.3, 1.5), rng.uniform(0.3, 1.5)),
+                shape=rng.choice(["rect", "roundrect", "oval", "circle"]),
+                net=rng.randint(0, 4),
+                layers=rng.choice([("F.Cu",), ("B.Cu",), ("*.Cu",)]),
+            )
+            for p in range(rng.randint(1, 5))
+        ]
+        footprints.append(
+            _fp(
+                f"U{k + 1}",
+                pads,
+                (rng.uniform(1, 9), rng.uniform(1, 9)),
+                rotation=rng.choice([0.0, 90.0, 180.0]),
+            )
+        )
+    return _Board(segments, vias, footprints)
+
+
+def _key(v):
+    return (v.rule_id, v.layer, v.items, v.nets, v.message.split()[0])
+
+
+@pytest.mark.parametrize("seed", [1, 2, 3, 4, 5])
+def test_clearance_matches_check_layer(seed: int):
+    pcb = _random_board(random.Random(seed))
+    rule = ClearanceRule()
+    native = rule._check_layers_native(pcb, 0.2, set())
+    assert native is not None
+    for layer in _LAYERS:
+        expected = rule._check_layer(pcb, layer, 0.2, set())
+        got = native.get(layer, [])
+        assert [_key(v) for v in got] == [_key(v) for v in expected]
+        for a, b in zip(got, expected, strict=True):
+            assert a.actual_value == pytest.approx(b.actual_value, abs=1e-5)
+            assert a.location == pytest.approx(b.location, abs=2e-3)
+
+
+def _python_only(monkeypatch):
+    monkeypatch.setattr("kicad_tools.drc.cpp_backend.is_copper_drc_available", lambda: False)
+
+
+def _random_zones(rng: random.Random) -> list[Zone]:
+    zones = []
+    for k in range(6):
+        x, y = rng.uniform(0, 8), rng.uniform(0, 8)
+        w, h = rng.uniform(1, 4), rng.uniform(1, 4)
+        zones.append(
+            Zone(
+                net_number=rng.randint(1, 4),
+                net_name="",
+                layer=rng.choice(_LAYERS),
+                filled_polygons=[[(x, y), (x + w, y), (x + w, y + h), (x, y + h)]],
+                uuid=f"zone{k}",
+            )
+        )
+    return zones
+
+
+def _assert_same_violations(got, expected):
+    def key(v):
+        return (v.rule_id, v.layer, v.items, v.nets, v.severity, v.message.split()[0])
+
+    got, expected = sorted(got, key=key), sorted(expected, key=key)
+    assert [key(v) for v in got] == [key(v) for v in expected]
+    for a, b in zip(got, expected, strict=True):
+        if b.actual_value > 0:
+            assert a.actual_value == pytest.approx(b.actual_value, abs=2e-4)
+            assert a.location == pytest.approx(b.location, abs=2e-3)
+        else:
+            # Shorts: the native depth is the penetration depth, shapely's
+            # a representative point's (see check_copper_drc_cpp).
+            assert a.actual_value <= 0
+
+
+@pytest.mark.parametrize("seed", [1, 2, 3])
+@pytest.mark.parametrize("rule_class", [SegmentZoneClearanceRule, ViaZoneClearanceRule])
+def test_zone_rules_match_shapely(seed: int, rule_class, monkeypatch):
+    pytest.importorskip("shapely")
+    rng = random.Random(seed)
+    pcb = _random_board(rng)
+    pcb.zones = _random_zones(rng)
+
+    native = rule_class().check(pcb, _Rules()).violations
+    _python_only(monkeypatch)
+    expected = rule_class().check(pcb, _Rules()).violations
+    assert expected, "the random board should exercise the rule"
+    _assert_same_violations(native, expected)
+
+
+@pytest.mark.parametrize("seed", [1, 2, 3])
+def test_drill_clearance_matches_python(seed: int, monkeypatch):
+    rng = random.Random(seed)
+    vias = [
+        _via(rng.uniform(0, 10), rng.uniform(0, 10), net=rng.randint(0, 4), uuid=f"v{k}")
+        for k in range(25)
+    ]
+    footprints = [
+        _fp(
+            f"J{k + 1}",
+            [
+                _pad(str(p + 1), p * 1.0, 0.0, drill=rng.choice([0.6, 0.8, 1.0]), layers=("*.Cu",))
+                for p in range(rng.randint(1, 4))
+            ],
+            (rng.uniform(0, 8), rng.uniform(0, 10)),
+            rotation=rng.choice([0.0, 90.0, 180.0]),
+        )
+        for k in range(4)
+    ]
+    pcb = _Board(vias=vias, footprints=footprints)
+
+    rule = DimensionRules()
+    native = DRCResults()
+    rule._check_drill_clearance(pcb, _Rules(), native)
+    _python_only(monkeypatch)
+    expected = DRCResults()
+    rule._check_drill_clearance(pcb, _Rules(), expected)
+    assert expected.violations, "the random board should exercise the rule"
+    _assert_same_violations(native.violations, expected.violations)
+
+
+def test_thread_count_does_not_change_results():
+    pcb = _random_board(random.Random(11))
+    items = CopperBoardItems(pcb)
+    runs = [
+        [
+            (v.check, v.layer, v.type1, v.index1, v.type2, v.index2, v.actual)
+            for v in run_copper_drc_cpp(items, 0.2, min_hole_to_hole=0.5, num_threads=n)
+        ]
+        for n in (1, 3, 8)
+    ]
+    assert runs[0] == runs[1] == runs[2]
+
+
+def test_diff_pair_exemption_is_segment_only():
+    pcb = _Board(
+        segments=[_seg(0, 0, 10, 0, net=1, uuid="a"), _seg(0, 0.3, 10, 0.3, net=2, uuid="b")],
+        vias=[_via(5, -0.45, size=0.4, net=2, uuid="c")],
+    )
+    items = CopperBoardItems(pcb, CHECK_CLEARANCE)
+    raw = run_copper_drc_cpp(items, 0.2, checks=CHECK_CLEARANCE, exempt_net_pairs=[(2, 1)])
+    kinds = {(v.type1, v.type2) for v in raw}
+    assert (0, 0) not in kinds  # segment pair left to the diff-pair rule
+    assert raw, "segment-to-via on the exempt nets is still checked"
+
+
+def test_via_pairs_only_on_declared_layers():
+    pcb = _Board(vias=[_via(0, 0, net=1, uuid="a"), _via(0.7, 0, net=2, uuid="b")])
+    violations = check_copper_drc_cpp(pcb, _Rules(min_hole_to_hole=0.0)).violations
+    clearance = [v for v in violations if v.rule_id == "clearance_via_via"]
+    assert sorted(v.layer for v in clearance) == ["B.Cu", "F.Cu"]
+    assert clearance[0].actual_value == pytest.approx(0.1)
+
+
+def test_zone_fill_matches_via_zone_rule():
+    square = [(100.0, 100.0), (110.0, 100.0), (110.0, 110.0), (100.0, 110.0)]
+    zone = Zone(net_number=2, net_name="N2", layer="F.Cu", filled_polygons=[square])
+    vias = [_via(99.6, 105.0, net=1, uuid="graze"), _via(120.0, 105.0, net=1, uuid="far")]
+    pcb = _Board(vias=vias, zones=[zone])
+
+    native = check_copper_drc_cpp(pcb, _Rules(), checks=CHECK_ZONE).violations
+    expected = ViaZoneClearanceRule().check(pcb, _Rules()).violations
+    assert [(v.rule_id, v.items, v.layer) for v in native] == [
+        (v.rule_id, v.items, v.layer) for v in expected
+    ]
+    assert native[0].actual_value == pytest.approx(0.1)
+
+
+def test_hole_to_hole_vocabulary():
+    pads = [
+        _pad("1", 0.0, 0.0, drill=0.8, layers=("*.Cu",)),
+        _pad("2", 1.0, 0.0, drill=0.8, layers=("*.Cu",)),
+    ]
+    pcb = _Board(footprints=[_fp("J1", pads, (10.0, 10.0))], vias=[_via(13.0, 10.0, net=3)])
+    violations = check_copper_drc_cpp(pcb, _Rules(), checks=CHECK_HOLE_TO_HOLE).violations
+
+    assert len(violations) == 1
+    v = violations[0]
+    assert v.rule_id == "hole_to_hole_clearance"
+    assert v.severity == "warning"  # same footprint
+    assert v.layer is None
+    assert v.items == ("J1-1:N1", "J1-2:N1")
+    assert v.actual_value == pytest.approx(0.2)
+
+
+def test_hole_to_track():
+    pcb = _Board(
+        segments=[_seg(0, 0.45, 10, 0.45, width=0.2, layer="In1.Cu", net=2, uuid="track")],
+        vias=[_via(5, 0, size=0.6, drill=0.3, net=1, uuid="hole")],
+    )
+    assert not check_copper_drc_cpp(pcb, _Rules(), checks=CHECK_HOLE_TO_COPPER).violations
+
+    violations = check_copper_drc_cpp(
+        pcb, _Rules(), min_hole_to_copper=0.25, checks=CHECK_HOLE_TO_COPPER
+    ).violations
+    assert [(v.rule_id, v.layer, v.items) for v in violations] == [
+        ("drill_clearance", "In1.Cu", ("Via-hole", "Trace-track"))
+    ]
+    assert violations[0].actual_value == pytest.approx(0.2)
+
+
+def test_rejects_mismatched_arrays():
+    from kicad_tools.drc.cpp_backend import drc_cpp
+
+    board = drc_cpp.CopperBoard()
+    board.num_layers = 1
+    board.seg_x1 = [0.0]
+    board.zone_offsets = [0]
+    rules = drc_cpp.CopperRules()
+    rules.checks = CHECK_ALL
+    with pytest.raises(ValueError):
+        drc_cpp.check_copper_drc(board, rules)
@@ -0,0 +1,245 @@
+"""Tests for the native incremental clearance state (``drc_cpp.IncrementalClearance``).
+
+``IncrementalDRC`` keeps footprints, transformed pads, the spatial index and
+the per-pair violation cache in C++.  After any sequence of moves the cache
+must equal a fresh whole-board sweep of the moved placement.
+"""
+
+from __future__ import annotations
+
+import copy
+import math
+import random
+import statistics
+import time
+
+import pytest
+
+from kicad_tools.drc.cpp_backend import (
+    _board_pad_arrays,
+    create_incremental_clearance_cpp,
+    drc_cpp,
+    is_incremental_clearance_available,
+    is_move_screening_available,
+)
+from kicad_tools.drc.incremental import IncrementalDRC, NativeSpatialIndex
+from kicad_tools.schema.pcb import Footprint, Net, Pad
+
+pytestmark = pytest.mark.skipif(
+    not is_incremental_clearance_available(), reason="C++ DRC incremental state not built"
+)
+
+
+class _Rules:
+    min_clearance_mm = 0.2
+
+
+class _Board:
+    """The PCB surface IncrementalDRC reads."""
+
+    def __init__(self, footprints):
+        self.footprints = list(footprints)
+        self.segments = []
+        self.nets = {n: Net(n, f"N{n}" if n else "") for n in range(8)}
+
+    def get_footprint(self, ref):
+        return next((fp for fp in self.footprints if fp.reference == ref), None)
+
+    def get_net(self, number):
+        return self.nets.get(number)
+
+
+def _footprint(rng: random.Random, ref: str, side: float) -> Footprint:
+    fp = Footprint(
+        name="fp",
+        reference=ref,
+        value="",
+        position=(rng.uniform(0, side), rng.uniform(0, side)),
+        rotation=rng.choice([0.0, 90.0, 45.0]),
+        layer="F.Cu",
+    )
+    for k in range(rng.randint(2, 8)):
+        net = rng.randint(0, 7)
+        fp.pads.append(
+            Pad(
+                number=str(k + 1),
+                type="smd",
+                shape="rect",
+                position=(rng.uniform(-1.5, 1.5), rng.uniform(-1.5, 1.5)),
+                size=(rng.uniform(0.2, 1.0), rng.uniform(0.2, 1.0)),
+                layers=["F.Cu"],
+                net_number=net,
+                net_name=f"N{net}" if net else "",
+            )
+        )
+    return fp
+
+
+def _random_board(seed: int, n: int = 60, side: float = 25.0) -> _Board:
+    rng = random.Random(seed)
+    return _Board(_footprint(rng, f"U{k + 1}", side) for k in range(n))
+
+
+def _key(v):
+    return (v.footprint1, v.footprint2, v.pad1_index, v.pad2_index)
+
+
+@pytest.mark.parametrize("seed", [1, 2, 3])
+def test_moves_match_fresh_sweep(seed: int):
+    board = _random_board(seed)
+    state = create_incremental_clearance_cpp(board.footprints, _Rules.min_clearance_mm)
+    rng = random.Random(seed)
+    for _ in range(80):
+        f = rng.randrange(len(board.footprints))
+        state.apply_move(f, rng.uniform(-2, 2), rng.uniform(-2, 2), rng.choice([0.0, 0.5]))
+
+    moved = copy.deepcopy(board.footprints)
+    for k, fp in enumerate(moved):
+        fp.position = (state.x(k), state.y(k))
+        fp.rotation = -math.degrees(state.rotation(k))
+    fresh = drc_cpp.check_board_clearance(
+        *_board_pad_arrays(moved), _Rules.min_clearance_mm, 1e-4
+    )
+    got = state.violations()
+    assert [_key(v) for v in got] == [_key(v) for v in fresh]
+    for a, b in zip(got, fresh, strict=True):
+        assert a.min_clearance == pytest.approx(b.min_clearance, abs=1e-5)
+
+
+def test_check_move_previews_without_committing():
+    board = _random_board(4)
+    state = create_incremental_clearance_cpp(board.footprints, _Rules.min_clearance_mm)
+    before = [_key(v) for v in state.violations()]
+    x0, y0 = state.x(0), state.y(0)
+
+    preview = state.check_move(0, 1.0, -1.0, 0.3)
+    assert [_key(v) for v in state.violations()] == before
+    assert (state.x(0), state.y(0)) == (x0, y0)
+
+    applied = state.apply_move(0, 1.0, -1.0, 0.3)
+    assert [_key(v) for v in applied.violations] == [_key(v) for v in preview.violations]
+    assert [_key(v) for v in applied.resolved] == [_key(v) for v in preview.resolved]
+    assert all(0 in (v.footprint1, v.footprint2) for v in applied.violations)
+
+
+def test_incremental_drc_matches_full_check_after_moves():
+    board = _random_board(5, n=30, side=15.0)
+    drc = IncrementalDRC(board, _Rules())
+    drc.full_check()
+    assert isinstance(drc.state.spatial_index, NativeSpatialIndex)
+
+    rng = random.Random(5)
+    moved = copy.deepcopy(board)
+    for _ in range(20):
+        ref = f"U{rng.randint(1, 30)}"
+        bounds = drc.state.component_bounds[ref]
+        dx, dy = rng.uniform(-1.5, 1.5), rng.uniform(-1.5, 1.5)
+        rotation = rng.choice([None, 0.0, 90.0])
+        drc.apply_move(ref, bounds.center_x + dx, bounds.center_y + dy, rotation)
+
+        fp = moved.get_footprint(ref)
+        fp.position = (fp.position[0] + dx, fp.position[1] + dy)
+        if rotation is not None:
+            fp.rotation = rotation
+
+    expected = IncrementalDRC(moved, _Rules()).full_check()
+
+    def items(violations):
+        return sorted((v.items, round(v.actual_value, 4)) for v in violations)
+
+    assert items(drc.get_current_violations()) == items(expected)
+
+
+def test_delta_lists_resolved_and_neighbours():
+    footprints = []
+    for ref, x, net in (("A", 0.0, 1), ("B", 1.0, 2)):
+        fp = Footprint(
+            name="fp", layer="F.Cu", position=(x, 0.0), rotation=0.0, reference=ref, value=""
+        )
+        fp.pads.append(
+            Pad(
+                number="1",
+                type="smd",
+                shape="circle",
+                position=(0.0, 0.0),
+                size=(0.5, 0.5),
+                layers=["F.Cu"],
+                net_number=net,
+                net_name=f"N{net}",
+            )
+        )
+        footprints.append(fp)
+    drc = IncrementalDRC(_Board(footprints), _Rules())
+    assert len(drc.full_check()) == 0
+
+    closer = drc.apply_move("A", 0.6, 0.0)  # 0.4 apart, pads 0.5 wide: overlap
+    assert [v.items for v in closer.new_violations] == [("A-1", "B-1")]
+    assert closer.affected_components == ["A", "B"]
+
+    away = drc.check_move("A", -5.0, 0.0)
+    assert away.new_violations == []
+    assert [v.items for v in away.resolved_violations] == [("A-1", "B-1")]
+    assert len(drc.get_current_violations()) == 1  # preview only
+
+
+@pytest.mark.skipif(not is_move_screening_available(), reason="C++ DRC move screening not built")
+def test_screen_moves_match_check_move():
+    board = _random_board(6)
+    state = create_incremental_clearance_cpp(board.footprints, _Rules.min_clearance_mm)
+    rng = random.Random(6)
+    fs = [rng.randrange(len(board.footprints)) for _ in range(200)]
+    dx = [rng.uniform(-2, 2) for _ in fs]
+    dy = [rng.uniform(-2, 2) for _ in fs]
+    drot = [rng.choice([0.0, 0.4]) for _ in fs]
+    before = [_key(v) for v in state.violations()]
+
+    screen = state.screen_moves(fs, dx, dy, drot, num_threads=1)
+    assert [_key(v) for v in state.violations()] == before
+    threaded = state.screen_moves(fs, dx, dy, drot, num_threads=4)
+    assert list(threaded.violations) == list(screen.violations)
+    assert list(threaded.min_clearance) == list(screen.min_clearance)
+
+    for k, f in enumerate(fs):
+        move = state.check_move(f, dx[k], dy[k], drot[k])
+        cached = sum(1 for v in state.violations() if f in (v.footprint1, v.footprint2))
+        assert screen.violations[k] == len(move.violations)
+        assert screen.net_change[k] == len(move.violations) - cached
+        worst = min((v.min_clearance for v in move.violations), default=math.inf)
+        assert screen.min_clearance[k] == min(worst, screen.min_clearance[k])
+        if not move.violations:
+            assert screen.min_clearance[k] >= _Rules.min_clearance_mm - 1e-4
+
+
+@pytest.mark.skipif(not is_move_screening_available(), reason="C++ DRC move screening not built")
+def test_incremental_drc_screen_matches_python_path(monkeypatch):
+    board = _random_board(7, n=30, side=15.0)
+    rng = random.Random(7)
+    candidates = [
+        (f"U{rng.randint(1, 30)}", rng.uniform(0, 15), rng.uniform(0, 15), rng.choice([None, 90.0]))
+        for _ in range(100)
+    ]
+    candidates.append(("NOPE", 1.0, 1.0, None))
+
+    native = IncrementalDRC(board, _Rules()).screen_moves(candidates)
+    monkeypatch.setattr("kicad_tools.drc.incremental.is_move_screening_available", lambda: False)
+    python = IncrementalDRC(board, _Rules()).screen_moves(candidates)
+
+    for a, b in zip(native, python, strict=True):
+        assert (a.ref, a.violations, a.net_change) == (b.ref, b.violations, b.net_change)
+        # Beyond the clearance only reach (box rounding) can differ.
+        assert min(a.min_clearance, 0.2) == pytest.approx(min(b.min_clearance, 0.2), abs=1e-4)
+    assert math.isinf(native[-1].min_clearance) and native[-1].violations == 0
+
+
+@pytest.mark.benchmark(group="drc")
+def test_move_feedback_is_sub_millisecond():
+    board = _random_board(9, n=1000, side=120.0)
+    state = create_incremental_clearance_cpp(board.footprints, _Rules.min_clearance_mm)
+    rng = random.Random(9)
+    timings = []
+    for _ in range(500):
+        f = rng.randrange(1000)
+        start = time.perf_counter()
+        state.check_move(f, rng.uniform(-1, 1), rng.uniform(-1, 1), 0.0)
+        timings.append(time.perf_counter() - start)
+    assert statistics.median(timings) < 1e-3
@@ -0,0 +1,236 @@
+"""Tests for the exact native pad shape kernels (``drc_cpp.pad_shape_clearance``).
+
+``check_pair_clearance`` models every pad as a ``max(w, h) / 2`` disc, so
+``ClearanceRule`` re-checked pad pairs with shapely polygons (issue #3826).
+The native kernels measure rect / roundrect / oval / circle / custom
+outlines exactly, so the shapely polygons are only a fallback.
+"""
+
+from __future__ import annotations
+
+import math
+import random
+from unittest.mock import patch
+
+import pytest
+
+from kicad_tools.drc.cpp_backend import is_pad_shape_available
+from kicad_tools.schema.pcb import Footprint, Pad
+from kicad_tools.sexp import parse_string
+from kicad_tools.validate.rules.clearance import (
+    CopperElement,
+    _calculate_clearance,
+    _polygon_pair_clearance,
+)
+
+pytestmark = pytest.mark.skipif(
+    not is_pad_shape_available(), reason="C++ DRC pad shape kernels not built"
+)
+
+
+def _shape(kind: str, x: float, y: float, w: float, h: float, rot: float = 0.0, corner=0.0):
+    from kicad_tools.drc.cpp_backend import drc_cpp
+
+    return drc_cpp.PadShape(
+        getattr(drc_cpp.PadShapeKind, kind).value, x, y, w, h, math.radians(rot), corner
+    )
+
+
+def _fp(ref: str, position=(0.0, 0.0), rotation=0.0, pads=()) -> Footprint:
+    fp = Footprint(
+        name="fp",
+        reference=ref,
+        value="",
+        position=position,
+        rotation=rotation,
+        layer="F.Cu",
+    )
+    fp.pads = list(pads)
+    return fp
+
+
+def _pad(number, shape, size, position=(0.0, 0.0), rotation=0.0, net=1) -> Pad:
+    return Pad(
+        number=number,
+        type="smd",
+        shape=shape,
+        position=position,
+        size=size,
+        layers=["F.Cu"],
+        net_number=net,
+        net_name=f"N{net}" if net else "",
+        rotation=rotation,
+    )
+
+
+class TestPadShapeClearance:
+    def test_rect_to_rect_gap(self):
+        from kicad_tools.drc.cpp_backend import drc_cpp
+
+        r = drc_cpp.pad_shape_clearance(_shape("RECT", 0, 0, 1, 1), _shape("RECT", 1.5, 0, 1, 1))
+        assert r.clearance == pytest.approx(0.5)
+        assert (r.location_x, r.location_y) == pytest.approx((0.75, 0.0))
+
+    def test_roundrect_corners_are_true_arcs(self):
+        from kicad_tools.drc.cpp_backend import drc_cpp
+
+        a = _shape("ROUNDRECT", 0, 0, 1, 1, corner=0.25)
+        b = _shape("ROUNDRECT", 1.2, 1.2, 1, 1, corner=0.25)
+        expected = math.hypot(0.7, 0.7) - 0.5
+        assert drc_cpp.pad_shape_clearance(a, b).clearance == pytest.approx(expected, abs=1e-12)
+
+    def test_rotated_oval_cap(self):
+        from kicad_tools.drc.cpp_backend import drc_cpp
+
+        # 4 x 1 stadium turned upright: its cap reaches y = 2.
+        a = _shape("OVAL", 0, 0, 4, 1, rot=90)
+        b = _shape("CIRCLE", 0, 3, 1, 1)
+        assert drc_cpp.pad_shape_clearance(a, b).clearance == pytest.approx(0.5)
+
+    def test_overlap_reports_penetration_depth(self):
+        from kicad_tools.drc.cpp_backend import drc_cpp
+
+        r = drc_cpp.pad_shape_clearance(_shape("RECT", 0, 0, 1, 1), _shape("RECT", 0.8, 0, 1, 1))
+        assert r.clearance == pytest.approx(-0.2)
+
+    def test_custom_polygon(self):
+        from kicad_tools.drc.cpp_backend import drc_cpp
+
+        polygon = drc_cpp.PadShapeKind.POLYGON.value
+        poly = drc_cpp.PadShape(
+            polygon, 0, 0, 0, 0, polygon_x=[-1.0, 1.0, 1.0, -1.0], polygon_y=[-1.0, -1.0, 1.0, 1.0]
+        )
+        assert drc_cpp.pad_shape_clearance(poly, _shape("CIRCLE", 2.5, 0, 1, 1)).clearance == (
+            pytest.approx(1.0)
+        )
+        assert drc_cpp.pad_bounding_radius(poly) == pytest.approx(math.sqrt(2))
+
+        bad = drc_cpp.PadShape(polygon, 0, 0, 0, 0, polygon_x=[0.0], polygon_y=[0.0])
+        with pytest.raises(ValueError):
+            drc_cpp.pad_shape_clearance(bad, poly)
+
+
+@pytest.mark.parametrize("seed", [1, 2, 3])
+def test_native_matches_shapely_outlines(seed: int):
+    """Native and shapely clearances agree to shapely's arc tolerance."""
+    rng = random.Random(seed)
+    shapes = ("rect", "roundrect", "oval", "circle")
+    for _ in range(300):
+        elems = []
+        for ref in ("U1", "U2"):
+            pad = _pad(
+                "1",
+                rng.choice(shapes),
+                (rng.uniform(0.2, 2.0), rng.uniform(0.2, 2.0)),
+                rotation=rng.choice([0.0, 30.0, 45.0, 90.0, 135.0]),
+            )
+            fp = _fp(ref, position=(rng.uniform(0, 3), rng.uniform(0, 3)))
+            elems.append(CopperElement.from_pad(pad, fp))
+        a, b = elems
+
+        native, _, _ = _calculate_clearance(a, b)
+        shapely_result = _polygon_pair_clearance(a, b)
+        assert shapely_result is not None
+        if native >= 0 and shapely_result[0] >= 0:
+            # Shapely flattens arcs into chords, so it sits slightly outside.
+            assert native == pytest.approx(shapely_result[0], abs=2e-3)
+        elif native < -2e-3:
+            assert shapely_result[0] < 0  # both call it a short
+
+
+def test_rule_skips_shapely_polygons_when_native():
+    pad = _pad("roundrect", (1.0, 0.5))
+    elem = CopperElement.from_pad(pad, _fp("U1"))
+    assert elem.polygon is None
+    assert elem.pad_shape is not None
+
+    with patch("kicad_tools.validate.rules.clearance._native_pad_shapes", return_value=None):
+        fallback = CopperElement.from_pad(pad, _fp("U1"))
+    assert fallback.polygon is not None
+
+
+class TestCustomPad:
+    # An L of two 2 x 1 arms around its anchor, drawn with a 0.1 mm stroke.
+    L_PAD = """(pad "1" smd custom (at 0 0 {rot}) (size 0.5 0.5) (layers "F.Cu") (net 1 "A")
+      (primitives
+        (gr_poly (pts (xy -0.5 -0.5) (xy 1.5 -0.5) (xy 1.5 0.5) (xy 0.5 0.5) (xy 0.5 1.5)
+                      (xy -0.5 1.5)) (width 0.1) (fill yes))
+      ))"""
+
+    def _custom(self, rot=0.0) -> Pad:
+        pad = Pad.from_sexp(parse_string(self.L_PAD.format(rot=rot)))
+        assert pad is not None
+        return pad
+
+    def test_outline_parsed(self):
+        pad = self._custom()
+        assert pad.custom_outline == [
+            (-0.5, -0.5), (1.5, -0.5), (1.5, 0.5), (0.5, 0.5), (0.5, 1.5), (-0.5, 1.5)
+        ]
+        assert pad.custom_outline_width == pytest.approx(0.1)
+
+        # A lone polygon that leaves the anchor uncovered is merged with it.
+        offset = Pad.from_sexp(
+            parse_string(
+                """(pad "1" smd custom (at 0 0) (size 1 1) (layers "F.Cu")
+                  (primitives (gr_poly (pts (xy 0 0) (xy 2 0) (xy 2 1)) (width 0))))"""
+            )
+        )
+        assert sorted(offset.custom_outline) == sorted(
+            [(-0.5, -0.5), (0.5, -0.5), (2.0, 0.0), (2.0, 1.0), (-0.5, 0.5)]
+        )
+        round_anchor = Pad.from_sexp(
+            parse_string(
+                """(pad "1" smd custom (at 0 0) (size 1 1) (layers "F.Cu")
+                  (options (clearance outline) (anchor circle))
+                  (primitives (gr_poly (pts (xy 0.1 -0.1) (xy 2 -0.1) (xy 2 0.1)) (width 0))))"""
+            )
+        )
+        # The octagon around the circle anchor reaches its radius on the axes.
+        xs = [x for x, _ in round_anchor.custom_outline]
+        assert (min(xs), max(xs)) == pytest.approx((-0.5, 2.0))
+
+        merged = Pad.from_sexp(
+            parse_string(
+                """(pad "1" smd custom (at 0 0) (size 0.5 0.5) (layers "F.Cu")
+                  (primitives (gr_rect (start -1 -1) (end 1 0.5) (width 0))
+                              (gr_circle (center 0 1) (end 0.5 1) (width 0.2))))"""
+            )
+        )
+        # Several primitives merge into their convex hull with the anchor.
+        assert sorted(merged.custom_outline) == sorted(
+            [(-1.0, -1.0), (1.0, -1.0), (1.0, 0.5), (0.5, 1.5), (-0.5, 1.5), (-1.0, 0.5)]
+        )
+        assert merged.custom_outline_width == pytest.approx(0.2)
+
+    @pytest.mark.parametrize("rot, corner", [(0.0, (1.1, 1.1)), (180.0, (-1.1, -1.1))])
+    def test_notch_measured_by_outline(self, rot, corner):
+        # A 0.4 mm disc in the L's notch: 0.6 mm from both arms, less the
+        # 0.2 mm radius and half the stroke.  The anchor box alone would
+        # put it more than 1 mm away.
+        l_pad = CopperElement.from_pad(self._custom(rot), _fp("U1"))
+        disc = CopperElement.from_pad(_pad("1", "circle", (0.4, 0.4), net=2), _fp("U2", corner))
+
+        clearance, _, _ = _calculate_clearance(l_pad, disc)
+        assert clearance == pytest.approx(0.35, abs=1e-9)
+        assert l_pad.geometry[2:] == pytest.approx((3.1, 3.1))
+
+    def test_native_matches_shapely(self):
+        pytest.importorskip("shapely")
+        rng = random.Random(5)
+        for _ in range(100):
+            a = CopperElement.from_pad(
+                self._custom(rng.choice([0.0, 30.0, 90.0, 225.0])),
+                _fp("U1", rotation=rng.choice([0.0, 90.0])),
+            )
+            pad = _pad("1", rng.choice(("rect", "oval")), (rng.uniform(0.2, 1.0), 0.3))
+            b = CopperElement.from_pad(
+                pad, _fp("U2", (rng.uniform(-3, 3), rng.uniform(-3, 3)))
+            )
+            native, _, _ = _calculate_clearance(a, b)
+            shapely_result = _polygon_pair_clearance(a, b)
+            assert shapely_result is not None
+            if native >= 0 and shapely_result[0] >= 0:
+                assert native == pytest.approx(shapely_result[0], abs=2e-3)
+            elif native < -2e-3:
+                assert shapely_result[0] < 0
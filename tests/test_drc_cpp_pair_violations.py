@@ -0,0 +1,185 @@
+"""Tests for full violation enumeration (``drc_cpp.check_pair_violations``).
+
+``check_pair_clearance`` reports only the closest pad pair.  The enumeration
+returns every pair below a threshold, or the k closest, in one pass; it must
+agree with a brute-force loop, with the minimum-only check, and across SIMD
+levels.
+"""
+
+from __future__ import annotations
+
+import math
+import random
+
+import pytest
+
+from kicad_tools.drc.cpp_backend import (
+    drc_cpp,
+    is_pair_violations_available,
+    simd_levels,
+)
+from kicad_tools.drc.incremental import IncrementalDRC
+from kicad_tools.schema.pcb import Footprint, Pad
+
+pytestmark = pytest.mark.skipif(
+    not is_pair_violations_available(), reason="C++ DRC violation enumeration not built"
+)
+
+
+def _side(rng: random.Random, n: int):
+    return (
+        [rng.uniform(-3, 3) for _ in range(n)],
+        [rng.uniform(-3, 3) for _ in range(n)],
+        [rng.uniform(0.05, 0.6) for _ in range(n)],
+        [rng.randint(0, 3) for _ in range(n)],
+    )
+
+
+def _random_args(seed: int):
+    rng = random.Random(seed)
+    return (
+        *_side(rng, rng.randint(1, 41)), 0.0, 0.0, 0.3,
+        *_side(rng, rng.randint(1, 37)), 1.5, 0.5, -1.2,
+    )
+
+
+def _brute_force(args, threshold: float):
+    """(clearance, i, j) below threshold, with the kernel's transforms."""
+    lx1, ly1, r1, n1, x1, y1, a1, lx2, ly2, r2, n2, x2, y2, a2 = args
+
+    def placed(lx, ly, x, y, a):
+        c, s = math.cos(a), math.sin(a)
+        return [(x + u * c - v * s, y + u * s + v * c) for u, v in zip(lx, ly, strict=True)]
+
+    p1 = placed(lx1, ly1, x1, y1, a1)
+    p2 = placed(lx2, ly2, x2, y2, a2)
+    found = []
+    for i, (ax, ay) in enumerate(p1):
+        for j, (bx, by) in enumerate(p2):
+            if n1[i] == n2[j] and n1[i] != 0:
+                continue
+            clearance = math.hypot(bx - ax, by - ay) - r1[i] - r2[j]
+            if clearance < threshold:
+                found.append((clearance, i, j))
+    return sorted(found)
+
+
+def _pairs(result):
+    return list(zip(result.pad1_index, result.pad2_index, strict=True))
+
+
+@pytest.mark.parametrize("seed", range(6))
+def test_matches_brute_force(seed: int):
+    args = _random_args(seed)
+    result = drc_cpp.check_pair_violations(*args, 0.1)
+    expected = _brute_force(args, 0.1)
+
+    # Float vs double: only pairs right at the threshold may differ.
+    clear = [e for e in expected if abs(e[0] - 0.1) > 1e-4]
+    got = set(_pairs(result))
+    assert {(i, j) for _, i, j in clear} <= got
+    assert len(result) == len(result.clearance) == len(result.location_x)
+    assert all(c < 0.1 for c in result.clearance)
+    assert list(result.clearance) == sorted(result.clearance)
+
+
+@pytest.mark.parametrize("seed", range(6))
+def test_top_k_is_prefix_of_full_list(seed: int):
+    args = _random_args(seed)
+    full = drc_cpp.check_pair_violations(*args, math.inf)
+    for k in (1, 3, 17):
+        top = drc_cpp.check_pair_violations(*args, math.inf, k)
+        assert _pairs(top) == _pairs(full)[:k]
+        assert list(top.clearance) == list(full.clearance)[:k]
+
+
+@pytest.mark.parametrize("seed", range(6))
+def test_first_pair_is_check_pair_clearance_minimum(seed: int):
+    args = _random_args(seed)
+    best = drc_cpp.check_pair_clearance(*args)
+    top = drc_cpp.check_pair_violations(*args, math.inf, 1)
+    assert best.has_result == (len(top) == 1)
+    if best.has_result:
+        assert _pairs(top) == [(best.pad1_index, best.pad2_index)]
+        assert top.clearance[0] == best.min_clearance
+        assert (top.location_x[0], top.location_y[0]) == (best.location_x, best.location_y)
+
+
+@pytest.mark.parametrize("seed", range(4))
+def test_simd_levels_agree(seed: int):
+    args = _random_args(seed)
+    active = drc_cpp.simd_level()
+    try:
+        results = set()
+        for level in simd_levels():
+            drc_cpp.set_simd_level(drc_cpp.SimdLevel(level))
+            for k in (0, 5):
+                r = drc_cpp.check_pair_violations(*args, 0.3, k)
+                results.add((k, tuple(_pairs(r)), tuple(r.clearance)))
+        assert len(results) == 2
+    finally:
+        drc_cpp.set_simd_level(active)
+
+
+def test_threshold_excludes_ties_and_same_net():
+    xs = [0.0, 1.0, 2.0]
+    args = (xs, [0.0] * 3, [0.1] * 3, [1, 2, 3], 0.0, 0.0, 0.0,
+            xs, [0.0] * 3, [0.1] * 3, [1, 5, 6], 0.0, 0.5, 0.0)
+    # Vertical neighbours sit at 0.3; pad 0 pairs share net 1.
+    result = drc_cpp.check_pair_violations(*args, 0.31)
+    assert _pairs(result) == [(1, 1), (2, 2)]
+    assert len(drc_cpp.check_pair_violations(*args, result.clearance[0])) == 0
+
+
+class _Rules:
+    min_clearance_mm = 0.2
+
+
+class _Board:
+    def __init__(self, footprints):
+        self.footprints = footprints
+        self.segments = []
+
+    def get_footprint(self, ref):
+        return next((fp for fp in self.footprints if fp.reference == ref), None)
+
+    def get_net(self, number):
+        return None
+
+
+def _row(ref: str, x: float, nets: list[int]) -> Footprint:
+    fp = Footprint(name="fp", layer="F.Cu", position=(x, 0.0), rotation=0.0, reference=ref,
+                   value="")
+    for k, net in enumerate(nets):
+        fp.pads.append(
+            Pad(
+                number=str(k + 1),
+                type="smd",
+                shape="circle",
+                position=(0.0, k * 1.0),
+                size=(0.4, 0.4),
+                layers=["F.Cu"],
+                net_number=net,
+                net_name=f"N{net}",
+            )
+        )
+    return fp
+
+
+def test_incremental_drc_pair_violations_match_python(monkeypatch):
+    # Two pad columns 0.5 apart: every pad faces a 0.1mm gap.
+    board = _Board([_row("A", 0.0, [1, 2, 3, 4]), _row("B", 0.5, [5, 2, 6, 7])])
+    drc = IncrementalDRC(board, _Rules())
+
+    native = drc.pair_violations("A", "B")
+    assert [v.items for v in native] == [("A-1", "B-1"), ("A-3", "B-3"), ("A-4", "B-4")]
+    assert native[0].items == drc._check_pair_clearance("A", "B").items
+    assert [v.items for v in drc.pair_violations("A", "B", max_results=2)] == [
+        v.items for v in native[:2]
+    ]
+
+    monkeypatch.setattr("kicad_tools.drc.incremental._is_drc_cpp_available", lambda: False)
+    python = drc.pair_violations("A", "B")
+    assert [v.items for v in python] == [v.items for v in native]
+    for a, b in zip(python, native, strict=True):
+        assert a.actual_value == pytest.approx(b.actual_value, abs=1e-5)
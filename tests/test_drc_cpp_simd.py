@@ -0,0 +1,161 @@
+"""Tests for the SIMD pad-pair kernels behind ``drc_cpp.check_pair_clearance``.
+
+The inner loop runs SSE2, AVX2 or AVX-512 kernels chosen at runtime.  Every
+level must return the same float minimum and the same pad indices as the
+scalar loop, bit for bit, so the dispatch is invisible to DRC output.
+"""
+
+from __future__ import annotations
+
+import math
+import random
+import struct
+import time
+
+import pytest
+
+from kicad_tools.drc.cpp_backend import (
+    SIMD_SCALAR,
+    is_simd_dispatch_available,
+    simd_level_name,
+    simd_levels,
+)
+from kicad_tools.library.generators import create_bga, create_qfn
+
+pytestmark = pytest.mark.skipif(
+    not is_simd_dispatch_available(), reason="C++ DRC SIMD dispatch not built"
+)
+
+
+@pytest.fixture
+def drc_cpp():
+    from kicad_tools.drc.cpp_backend import drc_cpp
+
+    active = drc_cpp.simd_level()
+    yield drc_cpp
+    drc_cpp.set_simd_level(active)
+
+
+def _arrays(footprint, nets: int):
+    """Library footprint pads as check_pair_clearance SoA arrays."""
+    pads = footprint.pads
+    return (
+        [p.x for p in pads],
+        [p.y for p in pads],
+        [max(p.width, p.height) / 2.0 for p in pads],
+        [k % nets for k in range(len(pads))],
+    )
+
+
+def _bits(value: float) -> bytes:
+    return struct.pack("<f", value)
+
+
+def _run_all_levels(drc_cpp, args):
+    results = {}
+    for level in simd_levels():
+        assert int(drc_cpp.set_simd_level(drc_cpp.SimdLevel(level))) == level
+        r = drc_cpp.check_pair_clearance(*args)
+        results[level] = (_bits(r.min_clearance), r.pad1_index, r.pad2_index, r.has_result)
+    return results
+
+
+def _pair_args(fp1, fp2, placement1, placement2, nets=24):
+    return (
+        *_arrays(fp1, nets),
+        *placement1,
+        *_arrays(fp2, nets),
+        *placement2,
+    )
+
+
+_PACKAGES = [
+    (create_qfn(32, pitch=0.5, body_size=5.0), create_qfn(48, pitch=0.5, body_size=7.0)),
+    (create_bga(16, 16, pitch=0.8), create_qfn(64, pitch=0.5, body_size=9.0)),
+    (create_bga(12, 12, pitch=0.5), create_bga(10, 10, pitch=0.8)),
+]
+
+
+@pytest.mark.parametrize("pair", range(len(_PACKAGES)))
+@pytest.mark.parametrize("rotation", [0.0, 37.0, 90.0])
+def test_levels_agree_on_package_pairs(drc_cpp, pair: int, rotation: float):
+    fp1, fp2 = _PACKAGES[pair]
+    args = _pair_args(
+        fp1, fp2, (10.0, 10.0, 0.0), (21.3, 10.4, math.radians(-rotation))
+    )
+    results = _run_all_levels(drc_cpp, args)
+    assert len(set(results.values())) == 1, {simd_level_name(k): v for k, v in results.items()}
+
+
+@pytest.mark.parametrize("seed", range(8))
+def test_levels_agree_on_random_pads(drc_cpp, seed: int):
+    rng = random.Random(seed)
+
+    def side(n):
+        return (
+            [rng.uniform(-3, 3) for _ in range(n)],
+            [rng.uniform(-3, 3) for _ in range(n)],
+            [rng.uniform(0.05, 0.6) for _ in range(n)],
+            [rng.randint(0, 3) for _ in range(n)],
+        )
+
+    # Odd sizes leave partial vectors in every kernel width.
+    args = (*side(rng.randint(1, 41)), 0.0, 0.0, 0.3, *side(rng.randint(1, 37)), 2.0, 1.0, -1.2)
+    results = _run_all_levels(drc_cpp, args)
+    assert len(set(results.values())) == 1
+
+
+def test_ties_report_first_pair(drc_cpp):
+    # Identical spacing everywhere: the first pair in pad1-major order wins.
+    xs = [0.0, 1.0, 2.0, 3.0, 4.0]
+    args = (xs, [0.0] * 5, [0.1] * 5, [1, 2, 3, 4, 5], 0.0, 0.0, 0.0,
+            xs, [0.0] * 5, [0.1] * 5, [6, 7, 8, 9, 10], 0.0, 2.0, 0.0)
+    for level, (_, i, j, found) in _run_all_levels(drc_cpp, args).items():
+        assert (i, j, found) == (0, 0, True), simd_level_name(level)
+
+
+def test_same_net_pairs_are_masked(drc_cpp):
+    # The only foreign-net pair is far away; same-net neighbours must not win.
+    args = ([0.0, 10.0], [0.0, 0.0], [0.2, 0.2], [3, 4], 0.0, 0.0, 0.0,
+            [0.5, 0.5], [0.0, 0.0], [0.2, 0.2], [3, 3], 0.0, 0.0, 0.0)
+    for level, (bits, i, j, _) in _run_all_levels(drc_cpp, args).items():
+        assert (i, j) == (1, 0), simd_level_name(level)
+        assert struct.unpack("<f", bits)[0] == pytest.approx(9.1, abs=1e-5)
+
+    all_same = ([0.0], [0.0], [0.2], [5], 0.0, 0.0, 0.0, [0.5], [0.0], [0.2], [5], 0.0, 0.0, 0.0)
+    assert not any(found for *_, found in _run_all_levels(drc_cpp, all_same).values())
+
+
+def test_set_simd_level_clamps_to_cpu(drc_cpp):
+    detected = drc_cpp.detect_simd_level()
+    assert drc_cpp.set_simd_level(drc_cpp.SimdLevel.AVX512) == detected
+    assert drc_cpp.set_simd_level(drc_cpp.SimdLevel.SCALAR) == drc_cpp.SimdLevel(SIMD_SCALAR)
+    assert drc_cpp.simd_level() == drc_cpp.SimdLevel(SIMD_SCALAR)
+
+
+@pytest.mark.benchmark(group="drc")
+def test_simd_speedup_on_bga_qfn_pair(drc_cpp):
+    """Widest kernel vs scalar on a 256-ball BGA against a 64-pin QFN."""
+    levels = simd_levels()
+    if len(levels) < 2:
+        pytest.skip("no SIMD level on this CPU")
+    args = _pair_args(
+        create_bga(16, 16, pitch=0.8), create_qfn(64, pitch=0.5, body_size=9.0),
+        (10.0, 10.0, 0.0), (30.0, 10.0, 0.0),
+    )
+
+    def per_call(level: int) -> float:
+        drc_cpp.set_simd_level(drc_cpp.SimdLevel(level))
+        best = math.inf
+        for _ in range(5):
+            start = time.perf_counter()
+            for _ in range(200):
+                drc_cpp.check_pair_clearance(*args)
+            best = min(best, time.perf_counter() - start)
+        return best / 200
+
+    timings = {simd_level_name(level): per_call(level) for level in levels}
+    # Python marshalling dominates small calls; still expect a clear win.
+    assert timings[simd_level_name(levels[-1])] < timings["scalar"], {
+        name: f"{t * 1e6:.1f} us" for name, t in timings.items()
+    }
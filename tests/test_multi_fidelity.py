@@ -437,6 +437,79 @@ class TestFidelity1:
         # Area should be computed
         assert result.score.breakdown.area > 0.0
 
+    def test_congestion_scored_from_pads(
+        self,
+        placed_components,
+        component_defs,
+        simple_nets,
+        simple_board,
+        design_rules,
+    ):
+        """Fidelity 1 adds the RUDY congestion of the nets' real pads."""
+        result = evaluate_placement_multifidelity(
+            placements=placed_components,
+            nets=simple_nets,
+            board=simple_board,
+            fidelity=FidelityLevel.DRC,
+            component_defs=component_defs,
+            design_rules=design_rules,
+        )
+        assert result.score.breakdown.congestion > 0.0
+
+        evaluator = make_fixed_fidelity_evaluator(
+            fidelity=FidelityLevel.DRC,
+            nets=simple_nets,
+            board=simple_board,
+            component_defs=component_defs,
+            design_rules=design_rules,
+        )
+        # The evaluator's map persists; re-evaluating the same placement
+        # must score the same congestion as a one-shot evaluation.
+        for _ in range(2):
+            reused = evaluator(placed_components)
+            assert reused.score.breakdown.congestion == pytest.approx(
+                result.score.breakdown.congestion
+            )
+
+    def test_congestion_weight_is_opt_in(
+        self,
+        placed_components,
+        component_defs,
+        simple_nets,
+        simple_board,
+        design_rules,
+    ):
+        """At the default weight of 0 the score is the pre-congestion total."""
+        kwargs = {
+            "placements": placed_components,
+            "nets": simple_nets,
+            "board": simple_board,
+            "fidelity": FidelityLevel.DRC,
+            "component_defs": component_defs,
+            "design_rules": design_rules,
+        }
+        result = evaluate_placement_multifidelity(**kwargs)
+        b = result.score.breakdown
+        cost = PlacementCostConfig()
+        assert cost.congestion_weight == 0.0
+        assert b.congestion > 0.0
+        assert result.score.total == pytest.approx(
+            cost.overlap_weight * b.overlap
+            + cost.drc_weight * b.drc
+            + cost.boundary_weight * b.boundary
+            + cost.wirelength_weight * b.wirelength
+            + cost.area_weight * b.area
+            + cost.block_boundary_weight * (b.block_boundary + b.inter_block)
+            + cost.creepage_weight * b.creepage
+            + cost.cohesion_weight * b.cohesion
+        )
+
+        weighted = evaluate_placement_multifidelity(
+            config=FidelityConfig(cost_config=PlacementCostConfig(congestion_weight=2.0)),
+            **kwargs,
+        )
+        assert weighted.score.total - result.score.total == pytest.approx(2.0 * b.congestion)
+
 
 # ---------------------------------------------------------------------------
 # Fidelity 2 (Global Route) validation tests
@@ -734,7 +734,7 @@ class TestNegotiatedRouterCongestionEstimator:
 
         captured_fn = {}
 
-        def fake_build_rsmt(pad_objs, congestion_fn=None, snap_fn=None):
+        def fake_build_rsmt(pad_objs, congestion_fn=None, snap_fn=None, use_native=None):
             captured_fn["fn"] = congestion_fn
             return list(pad_objs), [(0, 1), (1, 2)]
 
@@ -779,7 +779,7 @@ class TestNegotiatedRouterCongestionEstimator:
 
         captured_fn = {}
 
-        def fake_build_rsmt(pad_objs, congestion_fn=None, snap_fn=None):
+        def fake_build_rsmt(pad_objs, congestion_fn=None, snap_fn=None, use_native=None):
             captured_fn["fn"] = congestion_fn
             return list(pad_objs), [(0, 1), (1, 2)]
 
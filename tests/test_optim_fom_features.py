@@ -20,6 +20,7 @@ from kicad_tools.optim.fom_features import (
     routed_net_length,
     segment_length,
     steiner_lower_bound,
+    steiner_lower_bounds,
 )
 from kicad_tools.schema.pcb import PCB, Footprint, Pad, Segment
 
@@ -201,6 +202,21 @@ def test_steiner_lower_bound_three_pads_is_at_most_mst():
     assert bound <= mst_cost + 1e-9
 
 
+def test_steiner_lower_bounds_batch_matches_per_net():
+    nets = {
+        1: [_pad_feature(0, 0, net=1), _pad_feature(2, 0, net=1), _pad_feature(1, 2, net=1)],
+        2: [_pad_feature(0, 0, net=2), _pad_feature(3, 4, net=2)],
+        3: [_pad_feature(5, 5, net=3)],
+        4: [_pad_feature(x, (x * 7) % 5, net=4) for x in range(6)],
+    }
+    bounds = steiner_lower_bounds(nets)
+    assert set(bounds) == set(nets)
+    for net, pads in nets.items():
+        assert bounds[net] == pytest.approx(steiner_lower_bound(pads))
+    assert bounds[2] == pytest.approx(7.0)
+    assert bounds[3] == 0.0
+
+
 # --------------------------------------------------------------------
 # Synthesized PCB integration
 # --------------------------------------------------------------------
@@ -2,6 +2,8 @@
 
 from __future__ import annotations
 
+import math
+
 import pytest
 
 from kicad_tools.drc.predictive import PredictiveAnalyzer, PredictiveWarning
@@ -308,6 +310,36 @@ class TestPredictiveAnalyzer:
         assert 0.0 <= congestion <= 1.0
 
 
+class TestMoveScreening:
+    """Tests for PredictiveAnalyzer.screen_moves (batch candidate scoring)."""
+
+    @pytest.fixture
+    def analyzer(self, tmp_path) -> PredictiveAnalyzer:
+        pcb_file = tmp_path / "test.kicad_pcb"
+        pcb_file.write_text(PCB_CLUSTERED)
+        return PredictiveAnalyzer(PlacementSession(PCB.load(str(pcb_file))))
+
+    def test_screens_each_candidate_in_order(self, analyzer) -> None:
+        before = len(analyzer._drc_engine.get_current_violations())
+        screens = analyzer.screen_moves(
+            [
+                ("R1", (125.0, 120.0)),  # on top of R2
+                ("R1", (180.0, 180.0), 90.0),  # nothing within reach
+                ("NOPE", (0.0, 0.0)),
+            ]
+        )
+
+        assert [s.ref for s in screens] == ["R1", "R1", "NOPE"]
+        on_top, clear, unknown = screens
+        assert on_top.violations >= 1 and on_top.net_change >= 1
+        assert on_top.min_clearance < 0.0
+        assert (clear.violations, clear.rotation) == (0, 90.0)
+        assert math.isinf(clear.min_clearance)
+        assert unknown.violations == 0 and math.isinf(unknown.min_clearance)
+        # Screening never moves anything.
+        assert len(analyzer._drc_engine.get_current_violations()) == before
+
+
 class TestPredictiveWarningInfo:
     """Tests for PredictiveWarningInfo MCP type."""
 
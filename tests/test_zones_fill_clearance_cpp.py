@@ -0,0 +1,185 @@
+"""Tests for the native zone fill carving (``drc_cpp.carve_zone_fills``).
+
+When the C++ backend is built, :func:`apply_foreign_pad_clearance` carves
+every ``filled_polygon`` in one native pass.  The rewritten copper must
+clear foreign pads, vias and tracks by the zone clearance exactly as the
+shapely path does, keep the same-net islands, and fall back to shapely for
+any fill the native integer grid cannot hold.
+"""
+
+from __future__ import annotations
+
+import math
+
+import pytest
+
+from kicad_tools.drc.cpp_backend import (
+    PAD_SHAPE_CIRCLE,
+    PAD_SHAPE_RECT,
+    ZONE_FILL_CARVED,
+    ZONE_FILL_UNCHANGED,
+    ZONE_FILL_UNSUPPORTED,
+    carve_zone_fills_cpp,
+    is_zone_fill_available,
+)
+from kicad_tools.sexp import SExp, parse_string
+from kicad_tools.validate.rules.clearance import _repair_fill_polygon
+from kicad_tools.zones.fill_clearance import apply_foreign_pad_clearance
+
+shapely = pytest.importorskip("shapely")
+from shapely.geometry import LineString, Point, Polygon  # noqa: E402
+
+pytestmark = pytest.mark.skipif(
+    not is_zone_fill_available(), reason="C++ DRC zone fill carving not built"
+)
+
+
+def _board(fill: str, extra: str = "") -> str:
+    return f"""
+(kicad_pcb
+  (version 20240108)
+  (generator "test")
+  (net 0 "")
+  (net 1 "VCC")
+  (net 2 "LED_ANODE")
+  (net 3 "GND")
+  (footprint "lib:foreign"
+    (layer "F.Cu")
+    (at 5 5 30)
+    (pad "1" thru_hole rect (at 0 0) (size 1.7 1.0) (drill 0.6) (layers "*.Cu" "*.Mask") (net 3 "GND"))
+  )
+  (footprint "lib:samenet"
+    (layer "F.Cu")
+    (at 15 15)
+    (pad "1" thru_hole rect (at 0 0) (size 1.7 1.7) (drill 1.0) (layers "*.Cu" "*.Mask") (net 1 "VCC"))
+  )
+  (via (at 12 5) (size 0.6) (drill 0.3) (layers "F.Cu" "B.Cu") (net 2 "LED_ANODE"))
+  (segment (start 3 12) (end 9 16) (width 0.25) (layer "F.Cu") (net 3 "GND"))
+  {extra}
+  (zone
+    (net "VCC")
+    (layer "F.Cu")
+    (uuid "test-zone")
+    (hatch edge 0.5)
+    (connect_pads (clearance 0.3))
+    (min_thickness 0.25)
+    (fill yes (thermal_gap 0.3) (thermal_bridge_width 0.4))
+    (polygon (pts {fill}))
+    (filled_polygon
+      (layer "F.Cu")
+      (pts {fill})
+    )
+  )
+)
+"""
+
+
+_SQUARE = "(xy 0 0) (xy 20 0) (xy 20 20) (xy 0 20)"
+
+
+def _carve(board: str, monkeypatch=None) -> tuple[int, SExp]:
+    if monkeypatch is not None:
+        monkeypatch.setattr("kicad_tools.drc.cpp_backend.is_zone_fill_available", lambda: False)
+    doc = parse_string(board)
+    return apply_foreign_pad_clearance(doc), doc
+
+
+def _fill_polygon(doc: SExp):
+    rings = [
+        [(xy.get_float(0), xy.get_float(1)) for xy in filled.find("pts").find_all("xy")]
+        for filled in doc.find_all("zone")[0].find_all("filled_polygon")
+    ]
+    return _union(rings)
+
+
+def _union(rings):
+    """The copper the DRC reads back from fill rings."""
+    polys = []
+    for ring in rings:
+        poly = Polygon(ring)
+        if not poly.is_valid:
+            poly = _repair_fill_polygon(poly)
+        if not poly.is_empty:
+            polys.append(poly)
+    return shapely.unary_union(polys)
+
+
+def _foreign_copper():
+    # The rotated GND pad is carved by its axis-aligned bounding box.
+    w = 1.7 * math.cos(math.radians(30)) + 1.0 * math.sin(math.radians(30))
+    h = 1.7 * math.sin(math.radians(30)) + 1.0 * math.cos(math.radians(30))
+    return [
+        shapely.box(5 - w / 2, 5 - h / 2, 5 + w / 2, 5 + h / 2),
+        Point(12.0, 5.0).buffer(0.3),
+        LineString([(3, 12), (9, 16)]).buffer(0.125),
+    ]
+
+
+def test_native_carve_clears_foreign_copper_like_shapely(monkeypatch):
+    native_count, native_doc = _carve(_board(_SQUARE))
+    python_count, python_doc = _carve(_board(_SQUARE), monkeypatch)
+
+    assert native_count == python_count == 1
+    native, python = _fill_polygon(native_doc), _fill_polygon(python_doc)
+    for copper in _foreign_copper():
+        assert native.intersection(copper).area == pytest.approx(0.0, abs=1e-9)
+        assert native.distance(copper) >= 0.3 - 1e-6
+    # Same-net pad kept; only the antipads (a few mm^2) removed.
+    assert native.intersection(shapely.box(14.15, 14.15, 15.85, 15.85)).area > 0.0
+    assert native.area == pytest.approx(python.area, abs=0.05)
+    assert native.symmetric_difference(python).area < 0.1
+
+
+def test_stranded_lobe_dropped_natively():
+    # A 2 mm strip cut in two by the GND track; only the VCC pad's side stays.
+    strip = "(xy 0 11) (xy 20 11) (xy 20 13) (xy 0 13)"
+    extra = """(footprint "lib:vcc" (layer "F.Cu") (at 1.5 12)
+    (pad "1" smd rect (at 0 0) (size 1 1) (layers "F.Cu") (net 1 "VCC")))"""
+    _, doc = _carve(_board(strip, extra))
+
+    fill = _fill_polygon(doc)
+    assert fill.geom_type == "Polygon"
+    assert fill.intersection(shapely.box(1, 11.5, 2, 12.5)).area > 0.0
+    assert fill.intersection(shapely.box(18, 11.5, 19, 12.5)).area == pytest.approx(0.0, abs=1e-9)
+
+
+def test_fill_beyond_native_grid_falls_back_to_shapely():
+    huge = "(xy 0 0) (xy 1200 0) (xy 1200 1200) (xy 0 1200)"
+    results = carve_zone_fills_cpp(
+        [([(0, 0), (1200, 0), (1200, 1200), (0, 1200)], 0, 1, 0.425)],
+        [(PAD_SHAPE_CIRCLE, 12.0, 5.0, 0.6, 0.6, 0.0, 1, 2, True)],
+    )
+    assert results[0][0] == ZONE_FILL_UNSUPPORTED
+
+    count, doc = _carve(_board(huge))
+    assert count == 1
+    fill = _fill_polygon(doc)
+    for copper in _foreign_copper():
+        assert fill.distance(copper) >= 0.3 - 1e-6
+
+
+def test_batch_statuses_and_thread_invariance():
+    square = [(0.0, 0.0), (20.0, 0.0), (20.0, 20.0), (0.0, 20.0)]
+    fills = [
+        (square, 0, 1, 0.425),
+        ([(x + 40.0, y) for x, y in square], 0, 1, 0.425),
+        (square, 1, 1, 0.425),
+    ]
+    obstacles = [
+        (PAD_SHAPE_RECT, 5.0 + 10.0 * i, 5.0 + 3.0 * j, 1.0, 0.6, 0.3 * i, 0b01, 3, True)
+        for i in range(2)
+        for j in range(5)
+    ]
+    one = carve_zone_fills_cpp(fills, obstacles, num_threads=1)
+    many = carve_zone_fills_cpp(fills, obstacles, num_threads=4)
+    assert one == many
+
+    # Only the first fill shares the obstacles' layer and footprint.
+    assert [status for status, _ in one] == [
+        ZONE_FILL_CARVED,
+        ZONE_FILL_UNCHANGED,
+        ZONE_FILL_UNCHANGED,
+    ]
+    # Ten 1.0 x 0.6 pads grown by 0.425 mm: 0.6 + 2 * 1.6 * 0.425 + pi * 0.425^2 each.
+    carved = _union(one[0][1])
+    assert carved.area == pytest.approx(400.0 - 10 * 2.5275, abs=0.05)